@@ -0,0 +1,94 @@
+/*******************************************************************************
+* File Name:   diag_black_box_file_nv.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the file-backed non-volatile storage of the fault black box.
+* The storage is intended for the host and is excluded from the target build (see .cyignore).
+* It replaces the flash of the target by a file, so the frames written by one run are
+* read again by the next one, like after a reset of the target. A region, which was never
+* written, reads as erased flash (0xFF). The read and write functions match the storage
+* functions of the black box:
+* blackBoxConfig.nvRead = NexaWatt_Diag_BlackBox_FileNv_Read;
+* blackBoxConfig.nvWrite = NexaWatt_Diag_BlackBox_FileNv_Write;
+* blackBoxConfig.nvContext = &fileNv;
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_DIAG_BLACK_BOX_FILE_NV_H
+#define NEXAWATT_IV_DC_DIAG_BLACK_BOX_FILE_NV_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include "platform_types.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+typedef struct sNexaWattBlackBoxFileNv
+{
+    FILE* file;
+    uint32 failAfterBytes;
+} NexaWattBlackBoxFileNv;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Function used to open the file of a storage. An existing file is kept, a missing file is created empty.
+ * \param fileNv - A pointer to the storage to be opened.
+ * \param path - The path of the file.
+ * \return nwTrue - The file is open. nwFalse - A pointer is NULL or the file cannot be opened.
+ */
+nw_bool NexaWatt_Diag_BlackBox_FileNv_Open(NexaWattBlackBoxFileNv* fileNv, const char* path);
+
+/**
+ * \brief Function used to close the file of a storage, e.g. to simulate a reset.
+ * \param fileNv - A pointer to an open storage.
+ */
+void NexaWatt_Diag_BlackBox_FileNv_Close(NexaWattBlackBoxFileNv* fileNv);
+
+/**
+ * \brief Function used to simulate a power loss during the following writes: the writes stop after the provided
+ * number of bytes and fail, e.g. to check the detection of an interrupted write.
+ * \param fileNv - A pointer to an open storage.
+ * \param failAfterBytes - The number of bytes written before the failure.
+ */
+void NexaWatt_Diag_BlackBox_FileNv_Inject_Failure(NexaWattBlackBoxFileNv* fileNv, uint32 failAfterBytes);
+
+/**
+ * \brief Reads a region of the storage. See NwBlackBoxNvRead.
+ * \param nvContext - A pointer to an open storage.
+ * \param offset - The offset of the region in bytes.
+ * \param data - The buffer receiving the region.
+ * \param dataLen - The length of the region in bytes.
+ * \return nwTrue - The region is read. nwFalse - The file cannot be read.
+ */
+nw_bool NexaWatt_Diag_BlackBox_FileNv_Read(void* nvContext, uint32 offset, void* data, uint32 dataLen);
+
+/**
+ * \brief Writes a region of the storage and flushes the file. See NwBlackBoxNvWrite.
+ * \param nvContext - A pointer to an open storage.
+ * \param offset - The offset of the region in bytes.
+ * \param data - The written data.
+ * \param dataLen - The length of the region in bytes.
+ * \return nwTrue - The region is written. nwFalse - The file cannot be written or a failure is injected.
+ */
+nw_bool NexaWatt_Diag_BlackBox_FileNv_Write(void* nvContext, uint32 offset, const void* data, uint32 dataLen);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+#endif
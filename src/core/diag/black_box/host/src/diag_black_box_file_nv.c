@@ -0,0 +1,129 @@
+/*******************************************************************************
+* File Name:   diag_black_box_file_nv.c
+*
+* Description: This is the source file containing definitions,
+* related to the file-backed non-volatile storage of the fault black box.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "diag_black_box_file_nv.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Value of an erased byte of the flash.
+ */
+#define NW_FILE_NV_ERASED_BYTE              (0xFFu)
+
+/**
+ * \brief Marker of a storage without an injected failure.
+ */
+#define NW_FILE_NV_NO_FAILURE               (0xFFFFFFFFu)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+nw_bool NexaWatt_Diag_BlackBox_FileNv_Open(NexaWattBlackBoxFileNv* const fileNv, const char* const path)
+{
+    nw_bool retRes = nwFalse;
+
+    if ((fileNv != NULL) &&
+        (path != NULL))
+    {
+        fileNv->file = fopen(path, "r+b");
+        if (fileNv->file == NULL)
+        {
+            fileNv->file = fopen(path, "w+b");
+        }
+        fileNv->failAfterBytes = NW_FILE_NV_NO_FAILURE;
+
+        retRes = (fileNv->file != NULL) ? nwTrue : nwFalse;
+    }
+
+    return retRes;
+}
+
+void NexaWatt_Diag_BlackBox_FileNv_Close(NexaWattBlackBoxFileNv* const fileNv)
+{
+    if ((fileNv != NULL) &&
+        (fileNv->file != NULL))
+    {
+        (void)fclose(fileNv->file);
+        fileNv->file = NULL;
+    }
+}
+
+void NexaWatt_Diag_BlackBox_FileNv_Inject_Failure(NexaWattBlackBoxFileNv* const fileNv, const uint32 failAfterBytes)
+{
+    if (fileNv != NULL)
+    {
+        fileNv->failAfterBytes = failAfterBytes;
+    }
+}
+
+nw_bool NexaWatt_Diag_BlackBox_FileNv_Read(void* const nvContext, const uint32 offset, void* const data, const uint32 dataLen)
+{
+    NexaWattBlackBoxFileNv* const fileNv = (NexaWattBlackBoxFileNv*)nvContext;
+    nw_bool retRes = nwFalse;
+    size_t readLen = 0u;
+
+    if ((fileNv != NULL) &&
+        (fileNv->file != NULL) &&
+        (data != NULL) &&
+        (fseek(fileNv->file, (long)offset, SEEK_SET) == 0))
+    {
+        // The part beyond the end of the file was never written
+        readLen = fread(data, 1u, dataLen, fileNv->file);
+        (void)memset(&((uint8*)data)[readLen], NW_FILE_NV_ERASED_BYTE, dataLen - readLen);
+
+        retRes = (ferror(fileNv->file) == 0) ? nwTrue : nwFalse;
+        clearerr(fileNv->file);
+    }
+
+    return retRes;
+}
+
+nw_bool NexaWatt_Diag_BlackBox_FileNv_Write(void* const nvContext, const uint32 offset, const void* const data, const uint32 dataLen)
+{
+    NexaWattBlackBoxFileNv* const fileNv = (NexaWattBlackBoxFileNv*)nvContext;
+    nw_bool retRes = nwFalse;
+    uint32 writeLen = dataLen;
+
+    if ((fileNv != NULL) &&
+        (fileNv->file != NULL) &&
+        (data != NULL) &&
+        (fseek(fileNv->file, (long)offset, SEEK_SET) == 0))
+    {
+        if (fileNv->failAfterBytes != NW_FILE_NV_NO_FAILURE)
+        {
+            writeLen = (fileNv->failAfterBytes < dataLen) ? fileNv->failAfterBytes : dataLen;
+        }
+
+        retRes = ((fwrite(data, 1u, writeLen, fileNv->file) == writeLen) && (fflush(fileNv->file) == 0)) ? nwTrue : nwFalse;
+        if (writeLen < dataLen)
+        {
+            retRes = nwFalse;
+        }
+    }
+
+    return retRes;
+}
@@ -0,0 +1,199 @@
+/*******************************************************************************
+* File Name:   diag_black_box.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the fault black box of the NexaWatt-IV.DC framework.
+* The black box keeps a rolling history of the last NW_BLACK_BOX_HISTORY_LEN samples
+* of up to NW_BLACK_BOX_MAX_SIGNALS 32-bit signals, recorded every control period.
+* When the safety checker latches a new fault, the history is frozen into a freeze frame
+* together with the state of the converter state machine, the fault masks and a time stamp.
+* The record path only copies the history to the pending frame; the frame is written to
+* the non-volatile storage by a deferred event (see nexa_mini_os_event.h) in the main loop.
+* A new fault, which occurs while a frame is still pending, is counted as a lost frame.
+* The non-volatile storage is provided by the application as read and write functions
+* (e.g. a flash driver, or the file-backed storage of core/diag/black_box/host on the host).
+* The frames are stored in a ring of slots; every frame carries a sequence number and a
+* checksum, so the newest frames are found again after a reset and an interrupted write
+* is detected. A write replaces a whole slot; a flash backend erases the slot before programming it.
+* Typical usage at the end of the control ISR:
+* NexaWatt_Diag_BlackBox_Record(&blackBox);
+* and after a reset:
+* retRes = NexaWatt_Diag_BlackBox_Read_Frame(&blackBox, 0u, &frame);
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_DIAG_BLACK_BOX_H
+#define NEXAWATT_IV_DC_DIAG_BLACK_BOX_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+#include "safety_checker.h"
+#include "state_manager.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Maximum number of recorded signals.
+ */
+#define NW_BLACK_BOX_MAX_SIGNALS            (8u)
+
+/**
+ * \brief Number of samples of the history and of a freeze frame.
+ */
+#define NW_BLACK_BOX_HISTORY_LEN            (64u)
+
+/**
+ * \brief Maximum number of slots of the non-volatile storage.
+ */
+#define NW_BLACK_BOX_MAX_SLOTS              (16u)
+
+/**
+ * \brief Marker of a stored freeze frame ("NWBF").
+ */
+#define NW_BLACK_BOX_FRAME_MAGIC            (0x4E574246u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+typedef enum eNexaWattBlackBoxStatusResult
+{
+    NW_BLACK_BOX_SUCCESS    = 0u,
+    NW_BLACK_BOX_BAD_PARAM  = 1u,
+    NW_BLACK_BOX_NV_ERR     = 2u,
+    NW_BLACK_BOX_NOT_FOUND  = 3u,
+} NexaWattBlackBoxStatusResult;
+
+/**
+ * \brief Functions of the non-volatile storage. The offsets are in bytes, relative to the storage of the black box.
+ * The functions are called from the main loop only and return nwTrue on success.
+ */
+typedef nw_bool(*NwBlackBoxNvRead)(void* nvContext, uint32 offset, void* data, uint32 dataLen);
+typedef nw_bool(*NwBlackBoxNvWrite)(void* nvContext, uint32 offset, const void* data, uint32 dataLen);
+
+/**
+ * \brief Freeze frame. The samples are in chronological order, the last one recorded in the period of the fault.
+ * The state is NW_STATE_NONE without a state machine. The time stamp is the time of the mini OS time base.
+ * The layout contains no padding, so the frame is stored as it is.
+ */
+typedef struct sNexaWattBlackBoxFrame
+{
+    uint32 magic;
+    uint32 sequence;
+    uint64 timestampUs;
+    uint32 latchedFaults;
+    uint32 newFaults;
+    uint8 state;
+    uint8 signalCnt;
+    uint16 sampleCnt;
+    uint32 samples[NW_BLACK_BOX_HISTORY_LEN][NW_BLACK_BOX_MAX_SIGNALS];
+    uint32 checksum;
+} NexaWattBlackBoxFrame;
+
+/**
+ * \brief Configuration of the black box. The state machine is optional. The storage holds slotCnt frames from its offset 0.
+ */
+typedef struct sNexaWattBlackBoxConfig
+{
+    const volatile uint32* signals[NW_BLACK_BOX_MAX_SIGNALS];
+    uint8 signalCnt;
+    const NexaWattSafetyChecker* safetyChecker;
+    const NexaWattStateMachine* stateMachine;
+    NwBlackBoxNvRead nvRead;
+    NwBlackBoxNvWrite nvWrite;
+    void* nvContext;
+    uint8 slotCnt;
+} NexaWattBlackBoxConfig;
+
+/**
+ * \brief Statistics of the black box. The lost frames were frozen while another frame was pending, or their event was dropped.
+ */
+typedef struct sNexaWattBlackBoxStats
+{
+    uint32 frozenCnt;
+    uint32 storedCnt;
+    uint32 lostCnt;
+    uint32 nvErrCnt;
+} NexaWattBlackBoxStats;
+
+typedef struct sNexaWattBlackBox
+{
+    const volatile uint32* signals[NW_BLACK_BOX_MAX_SIGNALS];
+    uint8 signalCnt;
+    const NexaWattSafetyChecker* safetyChecker;
+    const NexaWattStateMachine* stateMachine;
+    NwBlackBoxNvRead nvRead;
+    NwBlackBoxNvWrite nvWrite;
+    void* nvContext;
+    uint8 slotCnt;
+    uint8 nextSlot;
+    uint8 validFrameCnt;
+    uint32 nextSequence;
+    uint32 history[NW_BLACK_BOX_HISTORY_LEN][NW_BLACK_BOX_MAX_SIGNALS];
+    uint32 historyIdx;
+    uint32 recordedCnt;
+    uint32 lastFaults;
+    volatile nw_bool isFramePending;
+    NexaWattBlackBoxFrame pendingFrame;
+    NexaWattBlackBoxStats stats;
+} NexaWattBlackBox;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Function used to initialize a black box. The slots of the storage are scanned for the newest valid frame,
+ * so the next frame follows the frames stored before the reset. Must be called before the recording starts.
+ * \param blackBox - A pointer to the black box to be initialized.
+ * \param blackBoxConfig - A pointer to the configuration.
+ * \return NW_BLACK_BOX_BAD_PARAM - A pointer is NULL, a count is out of range or a signal is NULL.
+ * \return NW_BLACK_BOX_SUCCESS - The black box is ready. Slots, which cannot be read, are treated as empty.
+ */
+NexaWattBlackBoxStatusResult NexaWatt_Diag_BlackBox_Init(NexaWattBlackBox* blackBox, const NexaWattBlackBoxConfig* blackBoxConfig);
+
+/**
+ * \brief Records a sample of the signals to the history and freezes a frame, when the safety checker latched a new fault.
+ * The function performs no validation and is intended to be executed in the control ISR, after the safety checker.
+ * \param blackBox - A pointer to an initialized black box.
+ */
+void NexaWatt_Diag_BlackBox_Record(NexaWattBlackBox* blackBox);
+
+/**
+ * \brief Function used to read a stored frame. Must be called from the main loop.
+ * \param blackBox - A pointer to an initialized black box.
+ * \param frameAge - The age of the frame, 0 for the newest one.
+ * \param frame - A pointer to the structure receiving the frame.
+ * \return NW_BLACK_BOX_BAD_PARAM - A pointer is NULL.
+ * \return NW_BLACK_BOX_NV_ERR - The storage cannot be read or the frame is corrupted.
+ * \return NW_BLACK_BOX_NOT_FOUND - No valid frame of the age is stored.
+ * \return NW_BLACK_BOX_SUCCESS - The frame is copied.
+ */
+NexaWattBlackBoxStatusResult NexaWatt_Diag_BlackBox_Read_Frame(const NexaWattBlackBox* blackBox, uint8 frameAge, NexaWattBlackBoxFrame* frame);
+
+/**
+ * \brief Function used to obtain the number of valid frames in the storage.
+ * \param blackBox - A pointer to an initialized black box.
+ * \return The number of frames, which can be read.
+ */
+uint8 NexaWatt_Diag_BlackBox_Get_Frame_Cnt(const NexaWattBlackBox* blackBox);
+
+/**
+ * \brief Function used to obtain the statistics of a black box.
+ * \param blackBox - A pointer to an initialized black box.
+ * \param blackBoxStats - A pointer to the structure, where the statistics are copied.
+ */
+void NexaWatt_Diag_BlackBox_Get_Stats(const NexaWattBlackBox* blackBox, NexaWattBlackBoxStats* blackBoxStats);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+#endif
@@ -0,0 +1,350 @@
+/*******************************************************************************
+* File Name:   diag_black_box.c
+*
+* Description: This is the source file containing definitions,
+* related to the fault black box of the NexaWatt-IV.DC framework.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "diag_black_box.h"
+#include "nexa_mini_os_event.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Reflected polynomial of the CRC-32 (IEEE 802.3) of the frame checksum.
+ */
+#define NW_BLACK_BOX_CRC_POLY               (0xEDB88320u)
+
+/**
+ * \brief Number of bytes of a frame covered by the checksum.
+ */
+#define NW_BLACK_BOX_CHECKED_LEN            (offsetof(NexaWattBlackBoxFrame, checksum))
+
+NW_STATIC_ASSERT((NW_BLACK_BOX_HISTORY_LEN & (NW_BLACK_BOX_HISTORY_LEN - 1u)) == 0u, black_box_history_len_power_of_two);
+NW_STATIC_ASSERT(NW_BLACK_BOX_HISTORY_LEN <= 0xFFFFu, black_box_history_len_fit_frame);
+NW_STATIC_ASSERT(NW_BLACK_BOX_CHECKED_LEN == (sizeof(NexaWattBlackBoxFrame) - sizeof(uint32)), black_box_frame_no_padding);
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that freezes the history into the pending frame and posts its storing.
+ * \param blackBox - A pointer to the black box.
+ * \param latchedFaults - The latched faults of the safety checker.
+ * \param newFaults - The faults latched in the current period.
+ */
+static void NexaWatt_Diag_BlackBox_Freeze(NexaWattBlackBox* blackBox, uint32 latchedFaults, uint32 newFaults);
+
+/**
+ * \brief Handler of the deferred event, which writes the pending frame to the next slot of the storage.
+ * \param eventContext - A pointer to the black box.
+ * \param eventArg - Not used.
+ */
+static void NexaWatt_Diag_BlackBox_Store_Handler(void* eventContext, uint32 eventArg);
+
+/**
+ * \brief Simple helper function that calculates the checksum of a frame.
+ * \param frame - A pointer to the frame.
+ * \return The CRC-32 of the frame without its checksum.
+ */
+static uint32 NexaWatt_Diag_BlackBox_Calc_Checksum(const NexaWattBlackBoxFrame* frame);
+
+/**
+ * \brief Simple helper function that reads a slot of the storage and validates its frame.
+ * \param blackBox - A pointer to the black box.
+ * \param slot - The slot.
+ * \param frame - A pointer to the structure receiving the frame.
+ * \return nwTrue - The slot contains a valid frame. nwFalse - The slot cannot be read or its frame is not valid.
+ */
+static nw_bool NexaWatt_Diag_BlackBox_Read_Slot(const NexaWattBlackBox* blackBox, uint8 slot, NexaWattBlackBoxFrame* frame);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattBlackBoxStatusResult NexaWatt_Diag_BlackBox_Init(NexaWattBlackBox* const blackBox, const NexaWattBlackBoxConfig* const blackBoxConfig)
+{
+    NexaWattBlackBoxStatusResult retRes = NW_BLACK_BOX_BAD_PARAM;
+    uint32 slotSequences[NW_BLACK_BOX_MAX_SLOTS];
+    nw_bool isSlotValid[NW_BLACK_BOX_MAX_SLOTS];
+    nw_bool hasFrame = nwFalse;
+    uint8 newestSlot = 0u;
+    uint8 slot = 0u;
+    uint8 signalIdx = 0u;
+
+    if ((blackBox != NULL) &&
+        (blackBoxConfig != NULL) &&
+        (blackBoxConfig->signalCnt > 0u) &&
+        (blackBoxConfig->signalCnt <= NW_BLACK_BOX_MAX_SIGNALS) &&
+        (blackBoxConfig->safetyChecker != NULL) &&
+        (blackBoxConfig->nvRead != NULL) &&
+        (blackBoxConfig->nvWrite != NULL) &&
+        (blackBoxConfig->slotCnt > 0u) &&
+        (blackBoxConfig->slotCnt <= NW_BLACK_BOX_MAX_SLOTS))
+    {
+        retRes = NW_BLACK_BOX_SUCCESS;
+        for (signalIdx = 0u; signalIdx < blackBoxConfig->signalCnt; signalIdx++)
+        {
+            if (blackBoxConfig->signals[signalIdx] == NULL)
+            {
+                retRes = NW_BLACK_BOX_BAD_PARAM;
+            }
+            blackBox->signals[signalIdx] = blackBoxConfig->signals[signalIdx];
+        }
+    }
+
+    if (retRes == NW_BLACK_BOX_SUCCESS)
+    {
+        blackBox->signalCnt = blackBoxConfig->signalCnt;
+        blackBox->safetyChecker = blackBoxConfig->safetyChecker;
+        blackBox->stateMachine = blackBoxConfig->stateMachine;
+        blackBox->nvRead = blackBoxConfig->nvRead;
+        blackBox->nvWrite = blackBoxConfig->nvWrite;
+        blackBox->nvContext = blackBoxConfig->nvContext;
+        blackBox->slotCnt = blackBoxConfig->slotCnt;
+        blackBox->historyIdx = 0u;
+        blackBox->recordedCnt = 0u;
+        // Faults latched before the initialization do not freeze a frame
+        blackBox->lastFaults = NexaWatt_SafetyChecker_Get_Faults(blackBoxConfig->safetyChecker);
+        blackBox->isFramePending = nwFalse;
+        blackBox->stats.frozenCnt = 0u;
+        blackBox->stats.storedCnt = 0u;
+        blackBox->stats.lostCnt = 0u;
+        blackBox->stats.nvErrCnt = 0u;
+
+        // The pending frame is free until the recording starts, so it serves as the buffer of the scan
+        for (slot = 0u; slot < blackBox->slotCnt; slot++)
+        {
+            isSlotValid[slot] = NexaWatt_Diag_BlackBox_Read_Slot(blackBox, slot, &blackBox->pendingFrame);
+            slotSequences[slot] = blackBox->pendingFrame.sequence;
+            if ((isSlotValid[slot] == nwTrue) &&
+                ((hasFrame == nwFalse) || (slotSequences[slot] > slotSequences[newestSlot])))
+            {
+                newestSlot = slot;
+                hasFrame = nwTrue;
+            }
+        }
+
+        blackBox->validFrameCnt = 0u;
+        if (hasFrame == nwTrue)
+        {
+            // Only the frames preceding the newest one without a gap are reachable by their age
+            slot = newestSlot;
+            while ((blackBox->validFrameCnt < blackBox->slotCnt) &&
+                   (isSlotValid[slot] == nwTrue) &&
+                   (slotSequences[slot] == (slotSequences[newestSlot] - blackBox->validFrameCnt)))
+            {
+                blackBox->validFrameCnt++;
+                slot = (uint8)((slot == 0u) ? (blackBox->slotCnt - 1u) : (slot - 1u));
+            }
+
+            blackBox->nextSlot = (uint8)(((newestSlot + 1u) < blackBox->slotCnt) ? (newestSlot + 1u) : 0u);
+            blackBox->nextSequence = slotSequences[newestSlot] + 1u;
+        }
+        else
+        {
+            blackBox->nextSlot = 0u;
+            blackBox->nextSequence = 0u;
+        }
+    }
+
+    return retRes;
+}
+
+void NexaWatt_Diag_BlackBox_Record(NexaWattBlackBox* const blackBox)
+{
+    uint32* const sample = blackBox->history[blackBox->historyIdx];
+    uint32 latchedFaults = 0u;
+    uint32 newFaults = 0u;
+    uint8 signalIdx = 0u;
+
+    for (signalIdx = 0u; signalIdx < blackBox->signalCnt; signalIdx++)
+    {
+        sample[signalIdx] = *blackBox->signals[signalIdx];
+    }
+    blackBox->historyIdx = (blackBox->historyIdx + 1u) & (NW_BLACK_BOX_HISTORY_LEN - 1u);
+    if (blackBox->recordedCnt < NW_BLACK_BOX_HISTORY_LEN)
+    {
+        blackBox->recordedCnt++;
+    }
+
+    // Every newly latched fault freezes a frame, also a fault following a cleared one
+    latchedFaults = NexaWatt_SafetyChecker_Get_Faults(blackBox->safetyChecker);
+    newFaults = latchedFaults & ~blackBox->lastFaults;
+    blackBox->lastFaults = latchedFaults;
+    if (newFaults != 0u)
+    {
+        NexaWatt_Diag_BlackBox_Freeze(blackBox, latchedFaults, newFaults);
+    }
+}
+
+NexaWattBlackBoxStatusResult NexaWatt_Diag_BlackBox_Read_Frame(const NexaWattBlackBox* const blackBox, const uint8 frameAge, NexaWattBlackBoxFrame* const frame)
+{
+    NexaWattBlackBoxStatusResult retRes = NW_BLACK_BOX_BAD_PARAM;
+    uint8 slot = 0u;
+
+    if ((blackBox != NULL) &&
+        (frame != NULL))
+    {
+        if (frameAge < blackBox->validFrameCnt)
+        {
+            slot = (uint8)(((uint32)blackBox->nextSlot + blackBox->slotCnt - 1u - frameAge) % blackBox->slotCnt);
+            if (NexaWatt_Diag_BlackBox_Read_Slot(blackBox, slot, frame) == nwFalse)
+            {
+                retRes = NW_BLACK_BOX_NV_ERR;
+            }
+            else if (frame->sequence != (blackBox->nextSequence - 1u - frameAge))
+            {
+                retRes = NW_BLACK_BOX_NOT_FOUND;
+            }
+            else
+            {
+                retRes = NW_BLACK_BOX_SUCCESS;
+            }
+        }
+        else
+        {
+            retRes = NW_BLACK_BOX_NOT_FOUND;
+        }
+    }
+
+    return retRes;
+}
+
+uint8 NexaWatt_Diag_BlackBox_Get_Frame_Cnt(const NexaWattBlackBox* const blackBox)
+{
+    uint8 retVal = 0u;
+
+    if (blackBox != NULL)
+    {
+        retVal = blackBox->validFrameCnt;
+    }
+
+    return retVal;
+}
+
+void NexaWatt_Diag_BlackBox_Get_Stats(const NexaWattBlackBox* const blackBox, NexaWattBlackBoxStats* const blackBoxStats)
+{
+    if ((blackBox != NULL) &&
+        (blackBoxStats != NULL))
+    {
+        *blackBoxStats = blackBox->stats;
+    }
+}
+
+static void NexaWatt_Diag_BlackBox_Freeze(NexaWattBlackBox* const blackBox, const uint32 latchedFaults, const uint32 newFaults)
+{
+    NexaWattBlackBoxFrame* const frame = &blackBox->pendingFrame;
+    const uint32 oldestIdx = (blackBox->historyIdx - blackBox->recordedCnt) & (NW_BLACK_BOX_HISTORY_LEN - 1u);
+    uint32 firstCnt = NW_BLACK_BOX_HISTORY_LEN - oldestIdx;
+
+    if (blackBox->isFramePending == nwTrue)
+    {
+        blackBox->stats.lostCnt++;
+    }
+    else
+    {
+        // The history is copied in chronological order: from the oldest sample to its end, then from its start
+        firstCnt = (firstCnt < blackBox->recordedCnt) ? firstCnt : blackBox->recordedCnt;
+        (void)memcpy(frame->samples, blackBox->history[oldestIdx], firstCnt * sizeof(blackBox->history[0u]));
+        (void)memcpy(frame->samples[firstCnt], blackBox->history[0u], (blackBox->recordedCnt - firstCnt) * sizeof(blackBox->history[0u]));
+
+        frame->magic = NW_BLACK_BOX_FRAME_MAGIC;
+        frame->timestampUs = NexaWatt_MiniOs_Time_Get_Us();
+        frame->latchedFaults = latchedFaults;
+        frame->newFaults = newFaults;
+        frame->state = (blackBox->stateMachine != NULL) ? NexaWatt_StateManager_Get_State(blackBox->stateMachine) : NW_STATE_NONE;
+        frame->signalCnt = blackBox->signalCnt;
+        frame->sampleCnt = (uint16)blackBox->recordedCnt;
+        blackBox->stats.frozenCnt++;
+
+        blackBox->isFramePending = nwTrue;
+        if (NexaWatt_MiniOs_Event_Post(NexaWatt_Diag_BlackBox_Store_Handler, blackBox, 0u) != NW_MINI_OS_SUCCESS)
+        {
+            blackBox->isFramePending = nwFalse;
+            blackBox->stats.lostCnt++;
+        }
+    }
+}
+
+static void NexaWatt_Diag_BlackBox_Store_Handler(void* const eventContext, const uint32 eventArg)
+{
+    NexaWattBlackBox* const blackBox = (NexaWattBlackBox*)eventContext;
+    NexaWattBlackBoxFrame* const frame = &blackBox->pendingFrame;
+
+    (void)eventArg;
+
+    frame->sequence = blackBox->nextSequence;
+    frame->checksum = NexaWatt_Diag_BlackBox_Calc_Checksum(frame);
+
+    // The oldest frame is overwritten by a full storage; it is not reachable anymore, even if the write fails
+    if (blackBox->validFrameCnt == blackBox->slotCnt)
+    {
+        blackBox->validFrameCnt--;
+    }
+
+    if (blackBox->nvWrite(blackBox->nvContext, (uint32)blackBox->nextSlot * sizeof(NexaWattBlackBoxFrame), frame, sizeof(NexaWattBlackBoxFrame)) == nwTrue)
+    {
+        blackBox->nextSlot = ((blackBox->nextSlot + 1u) < blackBox->slotCnt) ? (blackBox->nextSlot + 1u) : 0u;
+        blackBox->nextSequence++;
+        blackBox->validFrameCnt++;
+        blackBox->stats.storedCnt++;
+    }
+    else
+    {
+        // The slot is written again by the next frame
+        blackBox->stats.nvErrCnt++;
+    }
+
+    blackBox->isFramePending = nwFalse;
+}
+
+static uint32 NexaWatt_Diag_BlackBox_Calc_Checksum(const NexaWattBlackBoxFrame* const frame)
+{
+    const uint8* const bytes = (const uint8*)frame;
+    uint32 crc = 0xFFFFFFFFu;
+    uint32 byteIdx = 0u;
+    uint8 bitIdx = 0u;
+
+    for (byteIdx = 0u; byteIdx < NW_BLACK_BOX_CHECKED_LEN; byteIdx++)
+    {
+        crc ^= bytes[byteIdx];
+        for (bitIdx = 0u; bitIdx < 8u; bitIdx++)
+        {
+            crc = ((crc & 0x01u) != 0u) ? ((crc >> 1u) ^ NW_BLACK_BOX_CRC_POLY) : (crc >> 1u);
+        }
+    }
+
+    return ~crc;
+}
+
+static nw_bool NexaWatt_Diag_BlackBox_Read_Slot(const NexaWattBlackBox* const blackBox, const uint8 slot, NexaWattBlackBoxFrame* const frame)
+{
+    nw_bool retRes = blackBox->nvRead(blackBox->nvContext, (uint32)slot * sizeof(NexaWattBlackBoxFrame), frame, sizeof(NexaWattBlackBoxFrame));
+
+    if ((retRes == nwTrue) &&
+        ((frame->magic != NW_BLACK_BOX_FRAME_MAGIC) ||
+         (frame->signalCnt > NW_BLACK_BOX_MAX_SIGNALS) ||
+         (frame->sampleCnt > NW_BLACK_BOX_HISTORY_LEN) ||
+         (frame->checksum != NexaWatt_Diag_BlackBox_Calc_Checksum(frame))))
+    {
+        retRes = nwFalse;
+    }
+
+    return retRes;
+}
@@ -0,0 +1,222 @@
+/*******************************************************************************
+* File Name:   diag_fra.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the in-situ frequency response analyzer (FRA) of the NexaWatt-IV.DC framework.
+* The analyzer injects a small sinusoidal perturbation into a node of the control loop
+* and sweeps it over the configured frequencies. At every frequency it waits for the
+* settling periods of the sine, then correlates an excitation and a response signal
+* with the sine and the cosine of the perturbation over an integer number of periods
+* (a single-bin DFT, equivalent to the Goertzel filter at the injected frequency).
+* The ratio of the response to the excitation phasor is the measured transfer function.
+* With the excitation taken after the injection point and the negated response before it,
+* e.g. the controller output plus the perturbation and the negated controller output,
+* the ratio is the loop gain at the injection point (see NexaWatt_Diag_Fra_Pipeline_Stage()).
+* The ISR only looks up the sine table (generated by CORDIC at the initialization) and
+* updates four correlation sums, about 50 cycles per period. The gain and the phase of
+* every point are calculated by a deferred event (see nexa_mini_os_event.h) in the main loop.
+* The frequencies must stay below half of the sample frequency; the measurement of a point
+* takes (settleCycles + measureCycles) periods of its sine.
+* Typical usage in the control ISR:
+* perturbation = NexaWatt_Diag_Fra_Get_Perturbation(&fra);
+* NexaWatt_Diag_Fra_Step(&fra, excitation, response);
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_DIAG_FRA_H
+#define NEXAWATT_IV_DC_DIAG_FRA_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+#include "platform_fixed_point.h"
+#include "digital_controller_pipeline.h"
+#include "nexa_mini_os_event.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Maximum number of frequencies of a sweep.
+ */
+#define NW_FRA_MAX_POINTS                   (64u)
+
+/**
+ * \brief Number of entries of the sine table (a full period). Must be a power of two.
+ */
+#define NW_FRA_SINE_TABLE_BITS              (8u)
+#define NW_FRA_SINE_TABLE_LEN               (1u << NW_FRA_SINE_TABLE_BITS)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+typedef enum eNexaWattFraStatusResult
+{
+    NW_FRA_SUCCESS      = 0u,
+    NW_FRA_BAD_PARAM    = 1u,
+    NW_FRA_BUSY         = 2u,
+} NexaWattFraStatusResult;
+
+typedef enum eNexaWattFraState
+{
+    NW_FRA_STATE_IDLE       = 0x00u,
+    NW_FRA_STATE_SETTLING   = 0x01u,
+    NW_FRA_STATE_MEASURING  = 0x02u,
+    NW_FRA_STATE_DONE       = 0x03u,
+} NexaWattFraState;
+
+/**
+ * \brief Configuration of a sweep. The frequencies are measured in the order of the table, e.g. logarithmically spaced.
+ * The done handler is optional; it is posted with the number of points, once the last point is calculated.
+ * The injection output is used by the pipeline stage only.
+ */
+typedef struct sNexaWattFraConfig
+{
+    uint32 sampleFreqHz;
+    const uint32* frequenciesHz;
+    uint8 pointCnt;
+    NwQ15 amplitude;
+    uint16 settleCycles;
+    uint16 measureCycles;
+    uint8 injectionOutput;
+    NwMiniOsEventHandler doneHandler;
+    void* doneContext;
+} NexaWattFraConfig;
+
+/**
+ * \brief Correlation sums of a point: the excitation and the response multiplied by the cosine and the sine of the perturbation.
+ */
+typedef struct sNexaWattFraCorrelation
+{
+    int64 excitationCos;
+    int64 excitationSin;
+    int64 responseCos;
+    int64 responseSin;
+} NexaWattFraCorrelation;
+
+/**
+ * \brief Measured point: the gain in Q16.16 and the phase in 0.01 degrees in the range [-18000, 18000).
+ * A point is not valid, if its excitation was zero or it was lost, because the previous point was not calculated in time.
+ */
+typedef struct sNexaWattFraPoint
+{
+    uint32 frequencyHz;
+    NwQ16 gain;
+    int32 phaseCentiDeg;
+    nw_bool isValid;
+} NexaWattFraPoint;
+
+typedef struct sNexaWattFra
+{
+    uint32 phaseIncrements[NW_FRA_MAX_POINTS];
+    uint8 pointCnt;
+    NwQ15 amplitude;
+    uint16 settleCycles;
+    uint16 measureCycles;
+    uint8 injectionOutput;
+    NwMiniOsEventHandler doneHandler;
+    void* doneContext;
+    volatile NexaWattFraState state;
+    uint8 pointIdx;
+    uint32 phase;
+    uint32 phaseIncrement;
+    uint16 cycleCnt;
+    NwQ15 sine;
+    NwQ15 cosine;
+    NwQ15 perturbation;
+    NexaWattFraCorrelation correlation;
+    NexaWattFraCorrelation closedCorrelation;
+    volatile nw_bool isPointPending;
+    NexaWattFraPoint points[NW_FRA_MAX_POINTS];
+} NexaWattFra;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Function used to initialize an analyzer. The analyzer is idle and injects no perturbation until it is started.
+ * \param fra - A pointer to the analyzer to be initialized.
+ * \param fraConfig - A pointer to the configuration.
+ * \return NW_FRA_BAD_PARAM - A pointer is NULL, a count is out of range, a frequency is 0 or not below half of the sample frequency,
+ * the amplitude is not positive or the injection output does not exist.
+ * \return NW_FRA_SUCCESS - The analyzer is initialized.
+ */
+NexaWattFraStatusResult NexaWatt_Diag_Fra_Init(NexaWattFra* fra, const NexaWattFraConfig* fraConfig);
+
+/**
+ * \brief Function used to start a sweep from its first frequency. The results of the previous sweep are discarded.
+ * \param fra - A pointer to an initialized analyzer.
+ * \return NW_FRA_BAD_PARAM - The pointer is NULL.
+ * \return NW_FRA_BUSY - A sweep is running.
+ * \return NW_FRA_SUCCESS - The sweep is started.
+ */
+NexaWattFraStatusResult NexaWatt_Diag_Fra_Start(NexaWattFra* fra);
+
+/**
+ * \brief Function used to abort a sweep. The perturbation is removed in the next period.
+ * \param fra - A pointer to an initialized analyzer.
+ * \return NW_FRA_BAD_PARAM - The pointer is NULL.
+ * \return NW_FRA_SUCCESS - The analyzer is idle.
+ */
+NexaWattFraStatusResult NexaWatt_Diag_Fra_Stop(NexaWattFra* fra);
+
+/**
+ * \brief Executes a single period of the analyzer: correlates the signals of the period with the perturbation of the period
+ * and advances the perturbation to the next period. The function performs no validation and is intended to be executed in the control ISR.
+ * \param fra - A pointer to an initialized analyzer.
+ * \param excitation - The excitation signal, e.g. the node signal after the injection.
+ * \param response - The response signal, e.g. the negated node signal before the injection.
+ */
+void NexaWatt_Diag_Fra_Step(NexaWattFra* fra, NwQ15 excitation, NwQ15 response);
+
+/**
+ * \brief Control stage of the control pipeline, measuring the loop gain at an output: the perturbation is added to the output
+ * written by the preceding control stage; the output after the injection is the excitation, the negated output before it the response.
+ * \param stageContext - A pointer to an initialized analyzer.
+ * \param signals - The signals of the pipeline.
+ * \return nwTrue - Always, the chain continues.
+ */
+nw_bool NexaWatt_Diag_Fra_Pipeline_Stage(void* stageContext, NexaWattPipelineSignals* signals);
+
+/**
+ * \brief Function used to read a measured point, once the sweep is finished.
+ * \param fra - A pointer to an initialized analyzer.
+ * \param pointIdx - The index of the point in the frequency table.
+ * \param point - A pointer to the structure receiving the point.
+ * \return NW_FRA_BAD_PARAM - A pointer is NULL or the point does not exist.
+ * \return NW_FRA_BUSY - The sweep is not finished or its last point is not calculated yet.
+ * \return NW_FRA_SUCCESS - The point is copied.
+ */
+NexaWattFraStatusResult NexaWatt_Diag_Fra_Get_Point(const NexaWattFra* fra, uint8 pointIdx, NexaWattFraPoint* point);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/**
+ * \brief Returns the perturbation of the current period, to be added to the injection node. 0 while no sweep is running.
+ * \param fra - A pointer to an initialized analyzer.
+ * \return The Q15 perturbation.
+ */
+NW_LOCAL_INLINE NwQ15 NexaWatt_Diag_Fra_Get_Perturbation(const NexaWattFra* const fra)
+{
+    return fra->perturbation;
+}
+
+/**
+ * \brief Returns the state of an analyzer.
+ * \param fra - A pointer to an initialized analyzer.
+ * \return The state of the analyzer.
+ */
+NW_LOCAL_INLINE NexaWattFraState NexaWatt_Diag_Fra_Get_State(const NexaWattFra* const fra)
+{
+    return fra->state;
+}
+
+#endif
@@ -0,0 +1,489 @@
+/*******************************************************************************
+* File Name:   diag_fra.c
+*
+* Description: This is the source file containing definitions,
+* related to the in-situ frequency response analyzer (FRA) of the NexaWatt-IV.DC framework.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "diag_fra.h"
+#include "platform_critical_section.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Number of CORDIC iterations, giving an angle resolution below 0.001 degree.
+ */
+#define NW_FRA_CORDIC_ITERATIONS            (16u)
+
+/**
+ * \brief Inverse of the CORDIC gain of NW_FRA_CORDIC_ITERATIONS iterations in Q30, the start vector of the rotation.
+ */
+#define NW_FRA_CORDIC_INV_GAIN_Q30          (652032874)
+
+/**
+ * \brief Binary angles (a full turn is 2^32) of a quarter and a half turn.
+ */
+#define NW_FRA_ANGLE_QUARTER_TURN           (0x40000000u)
+#define NW_FRA_ANGLE_HALF_TURN              (0x80000000u)
+
+/**
+ * \brief Maximum magnitude of the CORDIC inputs, leaving headroom for the CORDIC gain of 1.65.
+ */
+#define NW_FRA_CORDIC_MAX_INPUT             ((uint64)1u << 29u)
+
+/**
+ * \brief Phase of a full turn in 0.01 degrees.
+ */
+#define NW_FRA_FULL_TURN_CENTI_DEG          (36000)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+/**
+ * \brief Array containing the CORDIC angles atan(2^-i) as binary angles.
+ */
+static const uint32 fraCordicAngles[NW_FRA_CORDIC_ITERATIONS] =
+{
+    536870912u, 316933406u, 167458907u, 85004756u, 42667331u, 21354465u, 10679838u, 5340245u,
+    2670163u, 1335087u, 667544u, 333772u, 166886u, 83443u, 41722u, 20861u,
+};
+
+/**
+ * \brief Array containing a full period of the sine in Q15, generated on the first initialization.
+ */
+static NwQ15 fraSineTable[NW_FRA_SINE_TABLE_LEN];
+static nw_bool isFraSineTableReady = nwFalse;
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that calculates the sine of a binary angle by CORDIC rotation.
+ * \param angle - The binary angle.
+ * \return The Q15 sine.
+ */
+static NwQ15 NexaWatt_Diag_Fra_Cordic_Sine(uint32 angle);
+
+/**
+ * \brief Simple helper function that calculates the angle and the magnitude of a vector by CORDIC vectoring.
+ * \param x - The real part of the vector. The magnitude of the parts must not exceed NW_FRA_CORDIC_MAX_INPUT.
+ * \param y - The imaginary part of the vector.
+ * \param magnitude - The magnitude of the vector, scaled by the CORDIC gain.
+ * \return The binary angle of the vector.
+ */
+static uint32 NexaWatt_Diag_Fra_Cordic_Vector(int32 x, int32 y, uint32* magnitude);
+
+/**
+ * \brief Simple helper function that looks up the sine of a binary angle, interpolating linearly between the table entries.
+ * \param angle - The binary angle.
+ * \return The Q15 sine.
+ */
+NW_LOCAL_INLINE NwQ15 NexaWatt_Diag_Fra_Lookup_Sine(uint32 angle);
+
+/**
+ * \brief Simple helper function that hands the correlation sums of the measured point over to the calculation event
+ * and moves the sweep to the next point.
+ * \param fra - A pointer to the analyzer.
+ */
+static void NexaWatt_Diag_Fra_Close_Point(NexaWattFra* fra);
+
+/**
+ * \brief Handler of the deferred event, which calculates the gain and the phase of a point from its correlation sums.
+ * \param eventContext - A pointer to the analyzer.
+ * \param eventArg - The index of the point.
+ */
+static void NexaWatt_Diag_Fra_Calc_Handler(void* eventContext, uint32 eventArg);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattFraStatusResult NexaWatt_Diag_Fra_Init(NexaWattFra* const fra, const NexaWattFraConfig* const fraConfig)
+{
+    NexaWattFraStatusResult retRes = NW_FRA_BAD_PARAM;
+    uint32 tableIdx = 0u;
+    uint8 pointIdx = 0u;
+
+    if ((fra != NULL) &&
+        (fraConfig != NULL) &&
+        (fraConfig->sampleFreqHz > 0u) &&
+        (fraConfig->frequenciesHz != NULL) &&
+        (fraConfig->pointCnt > 0u) &&
+        (fraConfig->pointCnt <= NW_FRA_MAX_POINTS) &&
+        (fraConfig->amplitude > 0) &&
+        (fraConfig->measureCycles > 0u) &&
+        (fraConfig->injectionOutput < NW_PIPELINE_MAX_OUTPUTS))
+    {
+        retRes = NW_FRA_SUCCESS;
+        for (pointIdx = 0u; pointIdx < fraConfig->pointCnt; pointIdx++)
+        {
+            if ((fraConfig->frequenciesHz[pointIdx] == 0u) ||
+                (fraConfig->frequenciesHz[pointIdx] >= (fraConfig->sampleFreqHz / 2u)))
+            {
+                retRes = NW_FRA_BAD_PARAM;
+            }
+        }
+    }
+
+    if (retRes == NW_FRA_SUCCESS)
+    {
+        if (isFraSineTableReady == nwFalse)
+        {
+            for (tableIdx = 0u; tableIdx < NW_FRA_SINE_TABLE_LEN; tableIdx++)
+            {
+                fraSineTable[tableIdx] = NexaWatt_Diag_Fra_Cordic_Sine(tableIdx << (32u - NW_FRA_SINE_TABLE_BITS));
+            }
+            isFraSineTableReady = nwTrue;
+        }
+
+        // The phase increments are divided once, so the sweep needs no division in the ISR
+        for (pointIdx = 0u; pointIdx < fraConfig->pointCnt; pointIdx++)
+        {
+            fra->phaseIncrements[pointIdx] = (uint32)(((uint64)fraConfig->frequenciesHz[pointIdx] << 32u) / fraConfig->sampleFreqHz);
+            fra->points[pointIdx].frequencyHz = fraConfig->frequenciesHz[pointIdx];
+            fra->points[pointIdx].gain = 0;
+            fra->points[pointIdx].phaseCentiDeg = 0;
+            fra->points[pointIdx].isValid = nwFalse;
+        }
+        fra->pointCnt = fraConfig->pointCnt;
+        fra->amplitude = fraConfig->amplitude;
+        fra->settleCycles = fraConfig->settleCycles;
+        fra->measureCycles = fraConfig->measureCycles;
+        fra->injectionOutput = fraConfig->injectionOutput;
+        fra->doneHandler = fraConfig->doneHandler;
+        fra->doneContext = fraConfig->doneContext;
+        fra->state = NW_FRA_STATE_IDLE;
+        fra->pointIdx = 0u;
+        fra->phase = 0u;
+        fra->phaseIncrement = 0u;
+        fra->cycleCnt = 0u;
+        fra->sine = 0;
+        fra->cosine = 0;
+        fra->perturbation = 0;
+        fra->isPointPending = nwFalse;
+    }
+
+    return retRes;
+}
+
+NexaWattFraStatusResult NexaWatt_Diag_Fra_Start(NexaWattFra* const fra)
+{
+    NexaWattFraStatusResult retRes = NW_FRA_BAD_PARAM;
+    NwCriticalSectionState criticalState;
+    uint8 pointIdx = 0u;
+
+    if (fra != NULL)
+    {
+        criticalState = NexaWatt_Platform_Critical_Section_Enter();
+        if ((fra->state == NW_FRA_STATE_SETTLING) ||
+            (fra->state == NW_FRA_STATE_MEASURING))
+        {
+            retRes = NW_FRA_BUSY;
+        }
+        else
+        {
+            for (pointIdx = 0u; pointIdx < fra->pointCnt; pointIdx++)
+            {
+                fra->points[pointIdx].isValid = nwFalse;
+            }
+            fra->pointIdx = 0u;
+            fra->phase = 0u;
+            fra->phaseIncrement = fra->phaseIncrements[0u];
+            fra->cycleCnt = 0u;
+            fra->sine = NexaWatt_Diag_Fra_Lookup_Sine(0u);
+            fra->cosine = NexaWatt_Diag_Fra_Lookup_Sine(NW_FRA_ANGLE_QUARTER_TURN);
+            fra->perturbation = NexaWatt_FixedPoint_Mul_Q15(fra->amplitude, fra->sine);
+            fra->state = NW_FRA_STATE_SETTLING;
+
+            retRes = NW_FRA_SUCCESS;
+        }
+        NexaWatt_Platform_Critical_Section_Exit(criticalState);
+    }
+
+    return retRes;
+}
+
+NexaWattFraStatusResult NexaWatt_Diag_Fra_Stop(NexaWattFra* const fra)
+{
+    NexaWattFraStatusResult retRes = NW_FRA_BAD_PARAM;
+    NwCriticalSectionState criticalState;
+
+    if (fra != NULL)
+    {
+        criticalState = NexaWatt_Platform_Critical_Section_Enter();
+        fra->perturbation = 0;
+        fra->state = NW_FRA_STATE_IDLE;
+        NexaWatt_Platform_Critical_Section_Exit(criticalState);
+
+        retRes = NW_FRA_SUCCESS;
+    }
+
+    return retRes;
+}
+
+void NexaWatt_Diag_Fra_Step(NexaWattFra* const fra, const NwQ15 excitation, const NwQ15 response)
+{
+    const NexaWattFraState state = fra->state;
+    const uint32 phase = fra->phase + fra->phaseIncrement;
+
+    if ((state == NW_FRA_STATE_SETTLING) ||
+        (state == NW_FRA_STATE_MEASURING))
+    {
+        if (state == NW_FRA_STATE_MEASURING)
+        {
+            fra->correlation.excitationCos += (int64)excitation * fra->cosine;
+            fra->correlation.excitationSin += (int64)excitation * fra->sine;
+            fra->correlation.responseCos += (int64)response * fra->cosine;
+            fra->correlation.responseSin += (int64)response * fra->sine;
+        }
+
+        // The wrap of the phase completes a period of the sine, so the correlation spans whole periods
+        if (phase < fra->phase)
+        {
+            fra->cycleCnt++;
+            if ((state == NW_FRA_STATE_SETTLING) &&
+                (fra->cycleCnt >= fra->settleCycles))
+            {
+                fra->correlation.excitationCos = 0;
+                fra->correlation.excitationSin = 0;
+                fra->correlation.responseCos = 0;
+                fra->correlation.responseSin = 0;
+                fra->cycleCnt = 0u;
+                fra->state = NW_FRA_STATE_MEASURING;
+            }
+            else if ((state == NW_FRA_STATE_MEASURING) &&
+                     (fra->cycleCnt >= fra->measureCycles))
+            {
+                NexaWatt_Diag_Fra_Close_Point(fra);
+            }
+            else
+            {
+                // The point continues
+            }
+        }
+        fra->phase = phase;
+
+        if (fra->state == NW_FRA_STATE_DONE)
+        {
+            fra->perturbation = 0;
+        }
+        else
+        {
+            fra->sine = NexaWatt_Diag_Fra_Lookup_Sine(phase);
+            fra->cosine = NexaWatt_Diag_Fra_Lookup_Sine(phase + NW_FRA_ANGLE_QUARTER_TURN);
+            fra->perturbation = NexaWatt_FixedPoint_Mul_Q15(fra->amplitude, fra->sine);
+        }
+    }
+}
+
+nw_bool NexaWatt_Diag_Fra_Pipeline_Stage(void* const stageContext, NexaWattPipelineSignals* const signals)
+{
+    NexaWattFra* const fra = (NexaWattFra*)stageContext;
+    const NwQ15 output = signals->outputs[fra->injectionOutput];
+    const NwQ15 excitation = NexaWatt_FixedPoint_Saturate(output + fra->perturbation, NW_Q15_MIN, NW_Q15_MAX);
+
+    // The loop returns the negated excitation at the controller output, so the negated output over the excitation is the loop gain
+    signals->outputs[fra->injectionOutput] = excitation;
+    NexaWatt_Diag_Fra_Step(fra, excitation, -output);
+
+    return nwTrue;
+}
+
+NexaWattFraStatusResult NexaWatt_Diag_Fra_Get_Point(const NexaWattFra* const fra, const uint8 pointIdx, NexaWattFraPoint* const point)
+{
+    NexaWattFraStatusResult retRes = NW_FRA_BAD_PARAM;
+
+    if ((fra != NULL) &&
+        (point != NULL) &&
+        (pointIdx < fra->pointCnt))
+    {
+        if ((fra->state == NW_FRA_STATE_DONE) &&
+            (fra->isPointPending == nwFalse))
+        {
+            *point = fra->points[pointIdx];
+
+            retRes = NW_FRA_SUCCESS;
+        }
+        else
+        {
+            retRes = NW_FRA_BUSY;
+        }
+    }
+
+    return retRes;
+}
+
+static NwQ15 NexaWatt_Diag_Fra_Cordic_Sine(const uint32 angle)
+{
+    int32 x = NW_FRA_CORDIC_INV_GAIN_Q30;
+    int32 y = 0;
+    int32 z = (int32)angle;
+    int32 nextX = 0;
+    nw_bool isNegated = nwFalse;
+    uint8 iterIdx = 0u;
+
+    // The rotation converges within a quarter turn; the angles beyond it are rotated by a half turn and the sine negated
+    if ((z > (int32)NW_FRA_ANGLE_QUARTER_TURN) || (z < -(int32)NW_FRA_ANGLE_QUARTER_TURN))
+    {
+        z = (int32)(angle + NW_FRA_ANGLE_HALF_TURN);
+        isNegated = nwTrue;
+    }
+
+    for (iterIdx = 0u; iterIdx < NW_FRA_CORDIC_ITERATIONS; iterIdx++)
+    {
+        if (z >= 0)
+        {
+            nextX = x - (y >> iterIdx);
+            y += (x >> iterIdx);
+            z -= (int32)fraCordicAngles[iterIdx];
+        }
+        else
+        {
+            nextX = x + (y >> iterIdx);
+            y -= (x >> iterIdx);
+            z += (int32)fraCordicAngles[iterIdx];
+        }
+        x = nextX;
+    }
+
+    // Q30 to Q15 with rounding
+    y = (y + (1 << 14)) >> 15;
+    y = (isNegated == nwTrue) ? -y : y;
+
+    return NexaWatt_FixedPoint_Saturate(y, NW_Q15_MIN, NW_Q15_MAX);
+}
+
+static uint32 NexaWatt_Diag_Fra_Cordic_Vector(int32 x, int32 y, uint32* const magnitude)
+{
+    uint32 angle = 0u;
+    int32 nextX = 0;
+    uint8 iterIdx = 0u;
+
+    // The vectoring converges in the right half-plane; a vector in the left one is rotated by a half turn first
+    if (x < 0)
+    {
+        x = -x;
+        y = -y;
+        angle = NW_FRA_ANGLE_HALF_TURN;
+    }
+
+    for (iterIdx = 0u; iterIdx < NW_FRA_CORDIC_ITERATIONS; iterIdx++)
+    {
+        if (y > 0)
+        {
+            nextX = x + (y >> iterIdx);
+            y -= (x >> iterIdx);
+            angle += fraCordicAngles[iterIdx];
+        }
+        else
+        {
+            nextX = x - (y >> iterIdx);
+            y += (x >> iterIdx);
+            angle -= fraCordicAngles[iterIdx];
+        }
+        x = nextX;
+    }
+    *magnitude = (uint32)x;
+
+    return angle;
+}
+
+NW_LOCAL_INLINE NwQ15 NexaWatt_Diag_Fra_Lookup_Sine(const uint32 angle)
+{
+    const uint32 tableIdx = angle >> (32u - NW_FRA_SINE_TABLE_BITS);
+    const int32 fraction = (int32)((angle >> (16u - NW_FRA_SINE_TABLE_BITS)) & 0xFFFFu);
+    const NwQ15 lower = fraSineTable[tableIdx];
+    const NwQ15 upper = fraSineTable[(tableIdx + 1u) & (NW_FRA_SINE_TABLE_LEN - 1u)];
+
+    return lower + (((upper - lower) * fraction) >> 16u);
+}
+
+static void NexaWatt_Diag_Fra_Close_Point(NexaWattFra* const fra)
+{
+    if (fra->isPointPending == nwTrue)
+    {
+        // The previous point is not calculated yet, so this one is lost
+        fra->points[fra->pointIdx].isValid = nwFalse;
+    }
+    else
+    {
+        fra->closedCorrelation = fra->correlation;
+        fra->isPointPending = nwTrue;
+        if (NexaWatt_MiniOs_Event_Post(NexaWatt_Diag_Fra_Calc_Handler, fra, fra->pointIdx) != NW_MINI_OS_SUCCESS)
+        {
+            fra->isPointPending = nwFalse;
+            fra->points[fra->pointIdx].isValid = nwFalse;
+        }
+    }
+
+    fra->pointIdx++;
+    if (fra->pointIdx >= fra->pointCnt)
+    {
+        fra->state = NW_FRA_STATE_DONE;
+        // Posted after the calculation of the last point, so the handler finds all points calculated
+        if (fra->doneHandler != NULL)
+        {
+            (void)NexaWatt_MiniOs_Event_Post(fra->doneHandler, fra->doneContext, fra->pointCnt);
+        }
+    }
+    else
+    {
+        fra->phaseIncrement = fra->phaseIncrements[fra->pointIdx];
+        fra->cycleCnt = 0u;
+        fra->state = NW_FRA_STATE_SETTLING;
+    }
+}
+
+static void NexaWatt_Diag_Fra_Calc_Handler(void* const eventContext, const uint32 eventArg)
+{
+    NexaWattFra* const fra = (NexaWattFra*)eventContext;
+    const NexaWattFraCorrelation* const correlation = &fra->closedCorrelation;
+    NexaWattFraPoint* const point = &fra->points[eventArg];
+    // The phasor of a signal x = cos(wt + phi) is (sum x*cos, -sum x*sin), proportional to (cos phi, sin phi)
+    const int64 parts[4u] = { correlation->excitationCos, -correlation->excitationSin, correlation->responseCos, -correlation->responseSin };
+    uint64 maxPart = 0u;
+    uint64 absPart = 0u;
+    uint32 excitationMagnitude = 0u;
+    uint32 responseMagnitude = 0u;
+    uint32 excitationAngle = 0u;
+    uint32 responseAngle = 0u;
+    uint8 shift = 0u;
+    uint8 partIdx = 0u;
+
+    // Both phasors are scaled by the same shift, so the ratio of their magnitudes is kept
+    for (partIdx = 0u; partIdx < 4u; partIdx++)
+    {
+        absPart = (parts[partIdx] < 0) ? (uint64)(-parts[partIdx]) : (uint64)parts[partIdx];
+        maxPart = (absPart > maxPart) ? absPart : maxPart;
+    }
+    while ((maxPart >> shift) >= NW_FRA_CORDIC_MAX_INPUT)
+    {
+        shift++;
+    }
+
+    excitationAngle = NexaWatt_Diag_Fra_Cordic_Vector((int32)(parts[0u] >> shift), (int32)(parts[1u] >> shift), &excitationMagnitude);
+    responseAngle = NexaWatt_Diag_Fra_Cordic_Vector((int32)(parts[2u] >> shift), (int32)(parts[3u] >> shift), &responseMagnitude);
+
+    if (excitationMagnitude > 0u)
+    {
+        point->gain = NexaWatt_FixedPoint_Saturate_I64((int64)((((uint64)responseMagnitude) << NW_Q16_FRAC_BITS) / excitationMagnitude));
+        point->phaseCentiDeg = (int32)(((int64)(int32)(responseAngle - excitationAngle) * NW_FRA_FULL_TURN_CENTI_DEG) >> 32u);
+        point->isValid = nwTrue;
+    }
+    else
+    {
+        point->isValid = nwFalse;
+    }
+
+    fra->isPointPending = nwFalse;
+}
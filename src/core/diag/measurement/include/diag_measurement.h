@@ -0,0 +1,208 @@
+/*******************************************************************************
+* File Name:   diag_measurement.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the measurement pipeline of the NexaWatt-IV.DC framework.
+* Every control period the raw ADC samples of the channels (e.g. voltages, currents,
+* temperatures) are calibrated by a linear characteristic to Q15 values, normalized to the
+* full scale of the channel, and the powers are calculated as the products of a voltage and
+* a current channel. For every quantity the running sum, the running sum of squares, the
+* minimum and the maximum of the window are updated; no samples are buffered.
+* At the end of the window (windowLen samples) the accumulators are handed over to a deferred
+* event (see nexa_mini_os_event.h), which calculates the mean, the RMS, the minimum, the maximum
+* and the peak-to-peak value in the main loop, so the divisions and square roots do not load the ISR.
+* The results are published in two alternating snapshots: the publisher writes the snapshot,
+* which is not published, and then advances the publish sequence. A reader copies the published
+* snapshot and repeats the copy, if the sequence changed meanwhile, so neither side takes a lock.
+* The quantities are indexed by their channel, the powers by NW_MEASUREMENT_POWER_IDX().
+* Typical usage as the scaling stage of the control pipeline:
+* NexaWatt_DigitalController_Pipeline_Register_Stage(&pipeline, NW_PIPELINE_STAGE_SCALE, NexaWatt_Diag_Measurement_Pipeline_Stage, &measurement);
+* and by a reader:
+* NexaWatt_Diag_Measurement_Get_Snapshot(&measurement, &snapshot);
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_DIAG_MEASUREMENT_H
+#define NEXAWATT_IV_DC_DIAG_MEASUREMENT_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+#include "platform_fixed_point.h"
+#include "digital_controller_pipeline.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Maximum number of calibrated channels. Channel n is written to the measurement n of the pipeline.
+ */
+#define NW_MEASUREMENT_MAX_CHANNELS         (NW_PIPELINE_MAX_SIGNALS)
+
+/**
+ * \brief Maximum number of powers.
+ */
+#define NW_MEASUREMENT_MAX_POWERS           (2u)
+
+/**
+ * \brief Number of quantities of a snapshot: the channels followed by the powers.
+ */
+#define NW_MEASUREMENT_MAX_QUANTITIES       (NW_MEASUREMENT_MAX_CHANNELS + NW_MEASUREMENT_MAX_POWERS)
+
+/**
+ * \brief Index of the quantity of a power.
+ */
+#define NW_MEASUREMENT_POWER_IDX(powerIdx)  (NW_MEASUREMENT_MAX_CHANNELS + (powerIdx))
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+typedef enum eNexaWattMeasurementStatusResult
+{
+    NW_MEASUREMENT_SUCCESS      = 0u,
+    NW_MEASUREMENT_BAD_PARAM    = 1u,
+} NexaWattMeasurementStatusResult;
+
+/**
+ * \brief Linear calibration of a channel: value = (sample - offset) * gain, saturated to the Q15 range.
+ * The gain maps the ADC codes to the Q15 full scale, e.g. NW_Q16_CONST(8.0) for 4096 codes per full scale.
+ */
+typedef struct sNexaWattMeasurementChannelConfig
+{
+    uint8 sampleIdx;
+    int32 offset;
+    NwQ16 gain;
+} NexaWattMeasurementChannelConfig;
+
+/**
+ * \brief Power calculated as the product of the calibrated values of a voltage and a current channel.
+ */
+typedef struct sNexaWattMeasurementPowerConfig
+{
+    uint8 voltageChannel;
+    uint8 currentChannel;
+} NexaWattMeasurementPowerConfig;
+
+/**
+ * \brief Configuration of the measurement pipeline. The window length is the number of samples per published snapshot.
+ */
+typedef struct sNexaWattMeasurementConfig
+{
+    NexaWattMeasurementChannelConfig channels[NW_MEASUREMENT_MAX_CHANNELS];
+    uint8 channelCnt;
+    NexaWattMeasurementPowerConfig powers[NW_MEASUREMENT_MAX_POWERS];
+    uint8 powerCnt;
+    uint16 windowLen;
+} NexaWattMeasurementConfig;
+
+/**
+ * \brief Running sums of a quantity over the current window.
+ */
+typedef struct sNexaWattMeasurementAccumulator
+{
+    int64 sum;
+    uint64 sumSquares;
+    NwQ15 minValue;
+    NwQ15 maxValue;
+} NexaWattMeasurementAccumulator;
+
+/**
+ * \brief Statistics of a quantity over a window, in Q15.
+ */
+typedef struct sNexaWattMeasurementStats
+{
+    NwQ15 mean;
+    NwQ15 rms;
+    NwQ15 minValue;
+    NwQ15 maxValue;
+    NwQ15 peakToPeak;
+} NexaWattMeasurementStats;
+
+/**
+ * \brief Published statistics. The sequence is the number of the window, starting at 1; 0 before the first window.
+ */
+typedef struct sNexaWattMeasurementSnapshot
+{
+    uint32 sequence;
+    NexaWattMeasurementStats stats[NW_MEASUREMENT_MAX_QUANTITIES];
+} NexaWattMeasurementSnapshot;
+
+typedef struct sNexaWattMeasurement
+{
+    NexaWattMeasurementChannelConfig channels[NW_MEASUREMENT_MAX_CHANNELS];
+    uint8 channelCnt;
+    NexaWattMeasurementPowerConfig powers[NW_MEASUREMENT_MAX_POWERS];
+    uint8 powerCnt;
+    uint16 windowLen;
+    uint16 sampleCnt;
+    NwQ15 values[NW_MEASUREMENT_MAX_QUANTITIES];
+    NexaWattMeasurementAccumulator accumulators[NW_MEASUREMENT_MAX_QUANTITIES];
+    NexaWattMeasurementAccumulator closedAccumulators[NW_MEASUREMENT_MAX_QUANTITIES];
+    volatile nw_bool isWindowPending;
+    uint32 lostWindowCnt;
+    NexaWattMeasurementSnapshot snapshots[2u];
+    volatile uint32 publishedSequence;
+} NexaWattMeasurement;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Function used to initialize a measurement pipeline. No snapshot is published until the first window ends.
+ * \param measurement - A pointer to the measurement pipeline to be initialized.
+ * \param measurementConfig - A pointer to the configuration.
+ * \return NW_MEASUREMENT_BAD_PARAM - A pointer is NULL, a count exceeds its maximum, a power refers to a missing channel
+ * or the window length is 0.
+ * \return NW_MEASUREMENT_SUCCESS - The measurement pipeline is ready.
+ */
+NexaWattMeasurementStatusResult NexaWatt_Diag_Measurement_Init(NexaWattMeasurement* measurement, const NexaWattMeasurementConfig* measurementConfig);
+
+/**
+ * \brief Calibrates the samples of a period and updates the statistics of the window. At the end of the window the
+ * accumulators are handed over to the publishing event; a window, which ends before the previous one is published, is lost.
+ * The function performs no validation and is intended to be executed in the control ISR.
+ * \param measurement - A pointer to an initialized measurement pipeline.
+ * \param samples - The samples of the ADC frame. Must contain the sample of every channel.
+ */
+void NexaWatt_Diag_Measurement_Update(NexaWattMeasurement* measurement, const NwAdcSample* samples);
+
+/**
+ * \brief Scaling stage of the control pipeline: updates the measurement pipeline and writes the calibrated value
+ * of channel n to the measurement n of the pipeline.
+ * \param stageContext - A pointer to an initialized measurement pipeline.
+ * \param signals - The signals of the pipeline.
+ * \return nwTrue - Always, the chain continues.
+ */
+nw_bool NexaWatt_Diag_Measurement_Pipeline_Stage(void* stageContext, NexaWattPipelineSignals* signals);
+
+/**
+ * \brief Function used to copy the published snapshot. Can be used from any context, without locks.
+ * \param measurement - A pointer to an initialized measurement pipeline.
+ * \param snapshot - A pointer to the structure receiving the snapshot.
+ * \return NW_MEASUREMENT_BAD_PARAM - A pointer is NULL.
+ * \return NW_MEASUREMENT_SUCCESS - The snapshot is copied.
+ */
+NexaWattMeasurementStatusResult NexaWatt_Diag_Measurement_Get_Snapshot(const NexaWattMeasurement* measurement, NexaWattMeasurementSnapshot* snapshot);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/**
+ * \brief Returns the calibrated value of a quantity in the last period.
+ * \param measurement - A pointer to an initialized measurement pipeline.
+ * \param quantityIdx - The index of the quantity (the channel, or NW_MEASUREMENT_POWER_IDX()).
+ * \return The Q15 value.
+ */
+NW_LOCAL_INLINE NwQ15 NexaWatt_Diag_Measurement_Get_Value(const NexaWattMeasurement* const measurement, const uint8 quantityIdx)
+{
+    return measurement->values[quantityIdx];
+}
+
+#endif
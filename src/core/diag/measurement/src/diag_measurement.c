@@ -0,0 +1,280 @@
+/*******************************************************************************
+* File Name:   diag_measurement.c
+*
+* Description: This is the source file containing definitions,
+* related to the measurement pipeline of the NexaWatt-IV.DC framework.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "diag_measurement.h"
+#include "platform_critical_section.h"
+#include "nexa_mini_os_event.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that adds a value to the running sums of a quantity.
+ * \param accumulator - A pointer to the accumulator of the quantity.
+ * \param value - The Q15 value.
+ */
+NW_LOCAL_INLINE void NexaWatt_Diag_Measurement_Accumulate(NexaWattMeasurementAccumulator* accumulator, NwQ15 value);
+
+/**
+ * \brief Simple helper function that empties an accumulator for a new window.
+ * \param accumulator - A pointer to the accumulator.
+ */
+static void NexaWatt_Diag_Measurement_Reset_Accumulator(NexaWattMeasurementAccumulator* accumulator);
+
+/**
+ * \brief Simple helper function that hands the accumulators of the ended window over to the publishing event.
+ * \param measurement - A pointer to the measurement pipeline.
+ */
+static void NexaWatt_Diag_Measurement_Close_Window(NexaWattMeasurement* measurement);
+
+/**
+ * \brief Handler of the deferred event, which calculates the statistics of the closed window and publishes them.
+ * \param eventContext - A pointer to the measurement pipeline.
+ * \param eventArg - Not used.
+ */
+static void NexaWatt_Diag_Measurement_Publish_Handler(void* eventContext, uint32 eventArg);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattMeasurementStatusResult NexaWatt_Diag_Measurement_Init(NexaWattMeasurement* const measurement, const NexaWattMeasurementConfig* const measurementConfig)
+{
+    NexaWattMeasurementStatusResult retRes = NW_MEASUREMENT_BAD_PARAM;
+    uint8 quantityIdx = 0u;
+    uint8 powerIdx = 0u;
+
+    if ((measurement != NULL) &&
+        (measurementConfig != NULL) &&
+        (measurementConfig->channelCnt > 0u) &&
+        (measurementConfig->channelCnt <= NW_MEASUREMENT_MAX_CHANNELS) &&
+        (measurementConfig->powerCnt <= NW_MEASUREMENT_MAX_POWERS) &&
+        (measurementConfig->windowLen > 0u))
+    {
+        retRes = NW_MEASUREMENT_SUCCESS;
+        for (powerIdx = 0u; powerIdx < measurementConfig->powerCnt; powerIdx++)
+        {
+            if ((measurementConfig->powers[powerIdx].voltageChannel >= measurementConfig->channelCnt) ||
+                (measurementConfig->powers[powerIdx].currentChannel >= measurementConfig->channelCnt))
+            {
+                retRes = NW_MEASUREMENT_BAD_PARAM;
+            }
+        }
+    }
+
+    if (retRes == NW_MEASUREMENT_SUCCESS)
+    {
+        for (quantityIdx = 0u; quantityIdx < measurementConfig->channelCnt; quantityIdx++)
+        {
+            measurement->channels[quantityIdx] = measurementConfig->channels[quantityIdx];
+        }
+        for (powerIdx = 0u; powerIdx < measurementConfig->powerCnt; powerIdx++)
+        {
+            measurement->powers[powerIdx] = measurementConfig->powers[powerIdx];
+        }
+        measurement->channelCnt = measurementConfig->channelCnt;
+        measurement->powerCnt = measurementConfig->powerCnt;
+        measurement->windowLen = measurementConfig->windowLen;
+        measurement->sampleCnt = 0u;
+        measurement->isWindowPending = nwFalse;
+        measurement->lostWindowCnt = 0u;
+        measurement->publishedSequence = 0u;
+
+        for (quantityIdx = 0u; quantityIdx < NW_MEASUREMENT_MAX_QUANTITIES; quantityIdx++)
+        {
+            measurement->values[quantityIdx] = 0;
+            NexaWatt_Diag_Measurement_Reset_Accumulator(&measurement->accumulators[quantityIdx]);
+            measurement->snapshots[0u].stats[quantityIdx].mean = 0;
+            measurement->snapshots[0u].stats[quantityIdx].rms = 0;
+            measurement->snapshots[0u].stats[quantityIdx].minValue = 0;
+            measurement->snapshots[0u].stats[quantityIdx].maxValue = 0;
+            measurement->snapshots[0u].stats[quantityIdx].peakToPeak = 0;
+        }
+        measurement->snapshots[0u].sequence = 0u;
+    }
+
+    return retRes;
+}
+
+void NexaWatt_Diag_Measurement_Update(NexaWattMeasurement* const measurement, const NwAdcSample* const samples)
+{
+    const NexaWattMeasurementChannelConfig* channel = NULL;
+    NwQ15 value = 0;
+    uint8 channelIdx = 0u;
+    uint8 powerIdx = 0u;
+
+    for (channelIdx = 0u; channelIdx < measurement->channelCnt; channelIdx++)
+    {
+        channel = &measurement->channels[channelIdx];
+        value = NexaWatt_FixedPoint_Mul_Q16((int32)samples[channel->sampleIdx] - channel->offset, channel->gain);
+        value = NexaWatt_FixedPoint_Saturate(value, NW_Q15_MIN, NW_Q15_MAX);
+
+        measurement->values[channelIdx] = value;
+        NexaWatt_Diag_Measurement_Accumulate(&measurement->accumulators[channelIdx], value);
+    }
+
+    for (powerIdx = 0u; powerIdx < measurement->powerCnt; powerIdx++)
+    {
+        value = NexaWatt_FixedPoint_Mul_Q15(measurement->values[measurement->powers[powerIdx].voltageChannel],
+                                            measurement->values[measurement->powers[powerIdx].currentChannel]);
+        // The product of two Q15 values reaches +1.0 for -1.0 * -1.0 only
+        value = NexaWatt_FixedPoint_Saturate(value, NW_Q15_MIN, NW_Q15_MAX);
+
+        measurement->values[NW_MEASUREMENT_POWER_IDX(powerIdx)] = value;
+        NexaWatt_Diag_Measurement_Accumulate(&measurement->accumulators[NW_MEASUREMENT_POWER_IDX(powerIdx)], value);
+    }
+
+    measurement->sampleCnt++;
+    if (measurement->sampleCnt >= measurement->windowLen)
+    {
+        NexaWatt_Diag_Measurement_Close_Window(measurement);
+    }
+}
+
+nw_bool NexaWatt_Diag_Measurement_Pipeline_Stage(void* const stageContext, NexaWattPipelineSignals* const signals)
+{
+    NexaWattMeasurement* const measurement = (NexaWattMeasurement*)stageContext;
+    uint8 channelIdx = 0u;
+
+    NexaWatt_Diag_Measurement_Update(measurement, signals->samples);
+
+    for (channelIdx = 0u; channelIdx < measurement->channelCnt; channelIdx++)
+    {
+        signals->measurements[channelIdx] = measurement->values[channelIdx];
+    }
+
+    return nwTrue;
+}
+
+NexaWattMeasurementStatusResult NexaWatt_Diag_Measurement_Get_Snapshot(const NexaWattMeasurement* const measurement, NexaWattMeasurementSnapshot* const snapshot)
+{
+    NexaWattMeasurementStatusResult retRes = NW_MEASUREMENT_BAD_PARAM;
+    uint32 sequence = 0u;
+
+    if ((measurement != NULL) &&
+        (snapshot != NULL))
+    {
+        // The copy is repeated, if the publisher advanced meanwhile and may have overwritten the copied snapshot
+        do
+        {
+            sequence = measurement->publishedSequence;
+            NexaWatt_Platform_Compiler_Barrier();
+            *snapshot = measurement->snapshots[sequence & 0x01u];
+            NexaWatt_Platform_Compiler_Barrier();
+        } while (sequence != measurement->publishedSequence);
+
+        retRes = NW_MEASUREMENT_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NW_LOCAL_INLINE void NexaWatt_Diag_Measurement_Accumulate(NexaWattMeasurementAccumulator* const accumulator, const NwQ15 value)
+{
+    accumulator->sum += value;
+    accumulator->sumSquares += (uint64)((int64)value * (int64)value);
+    accumulator->minValue = (value < accumulator->minValue) ? value : accumulator->minValue;
+    accumulator->maxValue = (value > accumulator->maxValue) ? value : accumulator->maxValue;
+}
+
+static void NexaWatt_Diag_Measurement_Reset_Accumulator(NexaWattMeasurementAccumulator* const accumulator)
+{
+    accumulator->sum = 0;
+    accumulator->sumSquares = 0u;
+    accumulator->minValue = NW_Q15_MAX;
+    accumulator->maxValue = NW_Q15_MIN;
+}
+
+static void NexaWatt_Diag_Measurement_Close_Window(NexaWattMeasurement* const measurement)
+{
+    const uint8 quantityCnt = NW_MEASUREMENT_MAX_CHANNELS + measurement->powerCnt;
+    uint8 quantityIdx = 0u;
+
+    if (measurement->isWindowPending == nwTrue)
+    {
+        measurement->lostWindowCnt++;
+    }
+    else
+    {
+        for (quantityIdx = 0u; quantityIdx < quantityCnt; quantityIdx++)
+        {
+            measurement->closedAccumulators[quantityIdx] = measurement->accumulators[quantityIdx];
+        }
+
+        measurement->isWindowPending = nwTrue;
+        if (NexaWatt_MiniOs_Event_Post(NexaWatt_Diag_Measurement_Publish_Handler, measurement, 0u) != NW_MINI_OS_SUCCESS)
+        {
+            measurement->isWindowPending = nwFalse;
+            measurement->lostWindowCnt++;
+        }
+    }
+
+    for (quantityIdx = 0u; quantityIdx < quantityCnt; quantityIdx++)
+    {
+        NexaWatt_Diag_Measurement_Reset_Accumulator(&measurement->accumulators[quantityIdx]);
+    }
+    measurement->sampleCnt = 0u;
+}
+
+static void NexaWatt_Diag_Measurement_Publish_Handler(void* const eventContext, const uint32 eventArg)
+{
+    NexaWattMeasurement* const measurement = (NexaWattMeasurement*)eventContext;
+    const uint32 sequence = measurement->publishedSequence + 1u;
+    NexaWattMeasurementSnapshot* const snapshot = &measurement->snapshots[sequence & 0x01u];
+    const NexaWattMeasurementAccumulator* accumulator = NULL;
+    NexaWattMeasurementStats* stats = NULL;
+    uint8 quantityIdx = 0u;
+
+    (void)eventArg;
+
+    for (quantityIdx = 0u; quantityIdx < NW_MEASUREMENT_MAX_QUANTITIES; quantityIdx++)
+    {
+        accumulator = &measurement->closedAccumulators[quantityIdx];
+        stats = &snapshot->stats[quantityIdx];
+
+        if ((quantityIdx < measurement->channelCnt) ||
+            ((quantityIdx >= NW_MEASUREMENT_MAX_CHANNELS) && (quantityIdx < (NW_MEASUREMENT_MAX_CHANNELS + measurement->powerCnt))))
+        {
+            stats->mean = (NwQ15)(accumulator->sum / (int64)measurement->windowLen);
+            stats->rms = (NwQ15)NexaWatt_FixedPoint_Sqrt_U64(accumulator->sumSquares / measurement->windowLen);
+            stats->minValue = accumulator->minValue;
+            stats->maxValue = accumulator->maxValue;
+            stats->peakToPeak = accumulator->maxValue - accumulator->minValue;
+        }
+        else
+        {
+            stats->mean = 0;
+            stats->rms = 0;
+            stats->minValue = 0;
+            stats->maxValue = 0;
+            stats->peakToPeak = 0;
+        }
+    }
+    snapshot->sequence = sequence;
+
+    // The snapshot must be complete in memory, before the readers can see the new sequence
+    NexaWatt_Platform_Compiler_Barrier();
+    measurement->publishedSequence = sequence;
+    measurement->isWindowPending = nwFalse;
+}
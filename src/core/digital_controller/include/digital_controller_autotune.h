@@ -0,0 +1,168 @@
+/*******************************************************************************
+* File Name:   digital_controller_autotune.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the relay-feedback automatic loop tuning of the NexaWatt-IV.DC framework.
+* During tuning, the controller is replaced by a relay with hysteresis, which forces
+* the loop into a limit cycle. The period and amplitude of the oscillation are measured
+* on the filtered feedback signal and used to calculate the ultimate gain and period
+* of the plant. The PID gains are derived from them by the selected tuning rule and
+* can be converted to NPNZ coefficients with NexaWatt_DigitalController_Npnz_From_Pid().
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_DIGITAL_CONTROLLER_AUTOTUNE_H
+#define NEXAWATT_IV_DC_DIGITAL_CONTROLLER_AUTOTUNE_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+#include "platform_fixed_point.h"
+#include "filtering_iir.h"
+#include "digital_controller_pid.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+typedef enum eNexaWattAutotuneRule
+{
+    NW_AUTOTUNE_RULE_ZN_PI          = 0x00u,
+    NW_AUTOTUNE_RULE_ZN_PID         = 0x01u,
+    NW_AUTOTUNE_RULE_NO_OVERSHOOT   = 0x02u,
+    NW_AUTOTUNE_RULE_INVALID        = 0x03u,
+} NexaWattAutotuneRule;
+
+typedef enum eNexaWattAutotuneState
+{
+    NW_AUTOTUNE_IDLE        = 0x00u,
+    NW_AUTOTUNE_RUNNING     = 0x01u,
+    NW_AUTOTUNE_MEASURED    = 0x02u,
+    NW_AUTOTUNE_DONE        = 0x03u,
+    NW_AUTOTUNE_ABORTED     = 0x04u,
+} NexaWattAutotuneState;
+
+typedef enum eNexaWattAutotuneAbortReason
+{
+    NW_AUTOTUNE_ABORT_NONE          = 0x00u,
+    NW_AUTOTUNE_ABORT_MEAS_LIMIT    = 0x01u,
+    NW_AUTOTUNE_ABORT_TIMEOUT       = 0x02u,
+    NW_AUTOTUNE_ABORT_USER          = 0x03u,
+    NW_AUTOTUNE_ABORT_BAD_RESULT    = 0x04u,
+} NexaWattAutotuneAbortReason;
+
+typedef struct sNexaWattAutotuneConfig
+{
+    NwQ15 setpoint;
+    NwQ15 outputBias;
+    NwQ15 relayAmplitude;
+    NwQ15 hysteresis;
+    NwQ15 measMin;
+    NwQ15 measMax;
+    NwQ15 safeOutput;
+    NwQ16 filterAlpha;
+    uint8 settleCycles;
+    uint8 measureCycles;
+    uint32 timeoutSamples;
+    NexaWattAutotuneRule rule;
+} NexaWattAutotuneConfig;
+
+typedef struct sNexaWattAutotuneResult
+{
+    NwQ16 ultimateGain;
+    uint32 ultimatePeriodSamples;
+    NwQ15 oscillationAmplitude;
+    NexaWattPidGains gains;
+} NexaWattAutotuneResult;
+
+typedef struct sNexaWattAutotune
+{
+    NexaWattAutotuneConfig config;
+    NexaWattFilterIir1 measFilter;
+    volatile NexaWattAutotuneState state;
+    volatile NexaWattAutotuneAbortReason abortReason;
+    nw_bool relayHigh;
+    nw_bool cycleStarted;
+    uint32 sampleCnt;
+    uint32 lastSwitchSample;
+    uint16 cycleCnt;
+    uint8 measuredCycles;
+    NwQ15 cycleMax;
+    NwQ15 cycleMin;
+    uint32 periodSum;
+    uint32 amplitudeSum;
+    NexaWattAutotuneResult result;
+} NexaWattAutotune;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Function used to validate the tuning configuration and start the relay experiment.
+ * The safety window (measMin, measMax) must contain the setpoint and the relay output
+ * (outputBias +/- relayAmplitude) must be a valid Q15 value.
+ * \param autotune - A pointer to the autotune instance.
+ * \param autotuneConfig - A pointer, containing the tuning configuration.
+ * \param initMeas - The current measurement in Q15 format, used to initialize the feedback filter.
+ * \return NW_CONTROLLER_BAD_PARAM - The validation of the provided configuration failed.
+ * \return NW_CONTROLLER_SUCCESS - The relay experiment is started. NexaWatt_DigitalController_Autotune_Step() must be executed at the control rate.
+ */
+NexaWattControllerStatusResult NexaWatt_DigitalController_Autotune_Start(NexaWattAutotune* autotune, const NexaWattAutotuneConfig* autotuneConfig, NwQ15 initMeas);
+
+/**
+ * \brief Executes a single step of the relay experiment. The function is intended to be executed in the control ISR,
+ * instead of the controller step. It contains no divisions. If the filtered measurement leaves the safety window
+ * or the timeout expires, the experiment is aborted and the safe output is returned from then on.
+ * \param autotune - A pointer to a started autotune instance.
+ * \param measurement - The measured value in Q15 format.
+ * \return The actuator command in Q15 format.
+ */
+NwQ15 NexaWatt_DigitalController_Autotune_Step(NexaWattAutotune* autotune, NwQ15 measurement);
+
+/**
+ * \brief Function used to calculate the ultimate gain and period of the plant and the PID gains
+ * from the collected relay experiment data. The function contains divisions and square root,
+ * hence it must be executed in thread context, once the state is NW_AUTOTUNE_MEASURED.
+ * \param autotune - A pointer to the autotune instance.
+ * \param result - A pointer, where the tuning result will be stored.
+ * \return NW_CONTROLLER_BAD_PARAM - One of the pointers is NULL or the measured oscillation is not usable (the instance is aborted).
+ * \return NW_CONTROLLER_NOT_READY - The relay experiment is not yet completed.
+ * \return NW_CONTROLLER_SUCCESS - The result is calculated. The state is changed to NW_AUTOTUNE_DONE.
+ */
+NexaWattControllerStatusResult NexaWatt_DigitalController_Autotune_Compute(NexaWattAutotune* autotune, NexaWattAutotuneResult* result);
+
+/**
+ * \brief Function used to abort a running relay experiment. The safe output is returned by the step function from then on.
+ * \param autotune - A pointer to the autotune instance.
+ */
+void NexaWatt_DigitalController_Autotune_Abort(NexaWattAutotune* autotune);
+
+/**
+ * \brief Function used to obtain the state of the autotune instance.
+ * \param autotune - A pointer to the autotune instance.
+ * \return The current state. NW_AUTOTUNE_IDLE is returned in case of NULL pointer.
+ */
+NexaWattAutotuneState NexaWatt_DigitalController_Autotune_Get_State(const NexaWattAutotune* autotune);
+
+/**
+ * \brief Function used to obtain the reason for which the relay experiment was aborted.
+ * \param autotune - A pointer to the autotune instance.
+ * \return The abort reason. NW_AUTOTUNE_ABORT_NONE is returned in case of NULL pointer or not aborted experiment.
+ */
+NexaWattAutotuneAbortReason NexaWatt_DigitalController_Autotune_Get_Abort_Reason(const NexaWattAutotune* autotune);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+#endif
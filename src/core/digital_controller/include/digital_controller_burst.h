@@ -0,0 +1,195 @@
+/*******************************************************************************
+* File Name:   digital_controller_burst.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the light-load burst mode of the NexaWatt-IV.DC framework.
+* At light load the switching is gated by a hysteretic band around the output voltage
+* reference: the power stage switches with a boosted duty cycle until the output voltage
+* exceeds the upper band and stays idle until it falls below the lower band. During the
+* burst mode the integrator of the controller is frozen, so the controller output
+* stays at the light-load operating point and the entry and exit are bumpless.
+* The integrator of the PID controller, passed at the initialization, is frozen by the burst mode;
+* other controllers must be frozen by the caller (see NexaWatt_DigitalController_Burst_Is_Active()).
+* Typical usage in the control ISR:
+* duty = NexaWatt_DigitalController_Pid_Step(&pid, ref, vout);
+* duty = NexaWatt_DigitalController_Burst_Step(&burst, ref, vout, iout, duty);
+* duty = NexaWatt_Topology_Pulse_Skip_Step(&pulseSkip, duty);
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_DIGITAL_CONTROLLER_BURST_H
+#define NEXAWATT_IV_DC_DIGITAL_CONTROLLER_BURST_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+#include "platform_fixed_point.h"
+#include "filtering_iir.h"
+#include "digital_controller_pid.h"
+#include "topology_config.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+typedef enum eNexaWattBurstMode
+{
+    NW_BURST_MODE_CONTINUOUS    = 0x00u,
+    NW_BURST_MODE_BURST         = 0x01u,
+} NexaWattBurstMode;
+
+/**
+ * \brief Configuration of the burst mode. The band limits are offsets from the output voltage reference.
+ * The burst mode is entered when the filtered load current stays below entryCurrent for entryDwellSamples
+ * and left immediately when it exceeds exitCurrent or the output voltage falls below the reference by exitUndershoot.
+ * burstDutyBoost is added to the controller output while switching in burst mode, so every burst charges the
+ * output capacitor to the upper band faster than the light load discharges it.
+ */
+typedef struct sNexaWattBurstConfig
+{
+    NwQ15 bandLow;
+    NwQ15 bandHigh;
+    NwQ15 exitUndershoot;
+    NwQ15 entryCurrent;
+    NwQ15 exitCurrent;
+    NwQ15 burstDutyBoost;
+    NwQ16 loadCurrentAlpha;
+    uint16 entryDwellSamples;
+} NexaWattBurstConfig;
+
+typedef struct sNexaWattBurst
+{
+    NexaWattBurstConfig config;
+    NexaWattFilterIir1 loadCurrentFilter;
+    NexaWattPidController* pid;
+    volatile NexaWattBurstMode mode;
+    nw_bool switchingEnabled;
+    uint16 dwellCnt;
+    uint32 burstCnt;
+} NexaWattBurst;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Function used to initialize the burst mode. The operation starts in continuous mode.
+ * \param burst - A pointer to the burst mode instance to be initialized.
+ * \param burstConfig - A pointer, containing the burst mode configuration.
+ * \param pid - A pointer to the PID controller, whose integrator is frozen during the burst mode.
+ * NULL, if the caller freezes the controller.
+ * \param initLoadCurrent - The current load current in Q15 format, used to initialize the load current filter.
+ * \return NW_CONTROLLER_BAD_PARAM - One of the pointers is NULL, a band limit is negative, the band does not lie
+ * within the exit undershoot or the entry current is not lower than the exit current.
+ * \return NW_CONTROLLER_SUCCESS - The burst mode is initialized.
+ */
+NexaWattControllerStatusResult NexaWatt_DigitalController_Burst_Init(NexaWattBurst* burst, const NexaWattBurstConfig* burstConfig, NexaWattPidController* pid, NwQ15 initLoadCurrent);
+
+/**
+ * \brief Function used to force the continuous mode, e.g. before a reference change or on a fault.
+ * The integrator of the PID controller, passed at the initialization, is released.
+ * \param burst - A pointer to an initialized burst mode instance.
+ */
+void NexaWatt_DigitalController_Burst_Force_Continuous(NexaWattBurst* burst);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/**
+ * \brief Executes a single step of the burst mode supervisor. The entry keeps the switching enabled until
+ * the output voltage reaches the upper band, so it causes no output excursion below the reference.
+ * The function performs no validation and is intended to be executed in the control ISR.
+ * \param burst - A pointer to an initialized burst mode instance.
+ * \param reference - The output voltage reference in Q15 format.
+ * \param outputVoltage - The measured output voltage in Q15 format.
+ * \param loadCurrent - The measured output (load) current in Q15 format. The inductor current must not be used,
+ * as it is interrupted by the burst gating.
+ * \param dutyCommand - The duty cycle command of the controller in Q15 format.
+ * \return The duty cycle command to be applied in Q15 format, limited to [0, NW_TOPOLOGY_DUTY_MAX].
+ * 0 means that the switching is gated in this period.
+ */
+NW_LOCAL_INLINE NwQ15 NexaWatt_DigitalController_Burst_Step(NexaWattBurst* const burst, const NwQ15 reference, const NwQ15 outputVoltage, const NwQ15 loadCurrent, const NwQ15 dutyCommand)
+{
+    NwQ15 loadCurrentFiltered = NexaWatt_Filtering_Iir1_Step(&burst->loadCurrentFilter, loadCurrent);
+    NwQ15 dutyApplied = dutyCommand;
+
+    if (burst->mode == NW_BURST_MODE_CONTINUOUS)
+    {
+        burst->switchingEnabled = nwTrue;
+        if (loadCurrentFiltered < burst->config.entryCurrent)
+        {
+            burst->dwellCnt++;
+            if (burst->dwellCnt >= burst->config.entryDwellSamples)
+            {
+                burst->dwellCnt = 0u;
+                burst->mode = NW_BURST_MODE_BURST;
+            }
+        }
+        else
+        {
+            burst->dwellCnt = 0u;
+        }
+    }
+    else if ((loadCurrentFiltered > burst->config.exitCurrent) ||
+             (outputVoltage < (reference - burst->config.exitUndershoot)))
+    {
+        burst->switchingEnabled = nwTrue;
+        burst->mode = NW_BURST_MODE_CONTINUOUS;
+    }
+    else if ((burst->switchingEnabled == nwTrue) && (outputVoltage > (reference + burst->config.bandHigh)))
+    {
+        burst->switchingEnabled = nwFalse;
+    }
+    else if ((burst->switchingEnabled == nwFalse) && (outputVoltage < (reference - burst->config.bandLow)))
+    {
+        burst->switchingEnabled = nwTrue;
+        burst->burstCnt++;
+    }
+
+    if (burst->mode == NW_BURST_MODE_BURST)
+    {
+        // The boost must not push the duty beyond the limit of the topology
+        dutyApplied = (burst->switchingEnabled == nwTrue) ?
+                      NexaWatt_FixedPoint_Saturate(dutyCommand + burst->config.burstDutyBoost, 0, NW_TOPOLOGY_DUTY_MAX) : 0;
+    }
+
+    if (burst->pid != NULL)
+    {
+        NexaWatt_DigitalController_Pid_Freeze_Integrator(burst->pid, (burst->mode == NW_BURST_MODE_BURST) ? nwTrue : nwFalse);
+    }
+
+    return dutyApplied;
+}
+
+/**
+ * \brief Returns the current operating mode of the burst mode supervisor.
+ * \param burst - A pointer to an initialized burst mode instance.
+ * \return NW_BURST_MODE_CONTINUOUS or NW_BURST_MODE_BURST.
+ */
+NW_LOCAL_INLINE NexaWattBurstMode NexaWatt_DigitalController_Burst_Get_Mode(const NexaWattBurst* const burst)
+{
+    return burst->mode;
+}
+
+/**
+ * \brief Checks whether the burst mode is active. The controller integrator must be frozen while it is.
+ * It is frozen by NexaWatt_DigitalController_Burst_Step(), if the controller was passed at the initialization.
+ * \param burst - A pointer to an initialized burst mode instance.
+ * \return nwTrue - The burst mode is active.
+ * \return nwFalse - The power stage operates in continuous mode.
+ */
+NW_LOCAL_INLINE nw_bool NexaWatt_DigitalController_Burst_Is_Active(const NexaWattBurst* const burst)
+{
+    return (burst->mode == NW_BURST_MODE_BURST) ? nwTrue : nwFalse;
+}
+
+#endif
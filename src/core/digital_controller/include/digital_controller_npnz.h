@@ -0,0 +1,131 @@
+/*******************************************************************************
+* File Name:   digital_controller_npnz.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the N-Pole N-Zero (NPNZ) compensator of the NexaWatt-IV.DC framework.
+* The compensator implements the difference equation:
+* u[n] = b0*e[n] + b1*e[n-1] + ... + bN*e[n-N] + a1*u[n-1] + ... + aN*u[n-N]
+* Note that the feedback coefficients are stored with inverted sign, so the
+* difference equation consists of additions only.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_DIGITAL_CONTROLLER_NPNZ_H
+#define NEXAWATT_IV_DC_DIGITAL_CONTROLLER_NPNZ_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+#include "platform_fixed_point.h"
+#include "digital_controller_pid.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Maximum order of the NPNZ compensator supported by the framework (3P3Z).
+ */
+#define NW_NPNZ_MAX_ORDER       (3u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+typedef struct sNexaWattNpnzConfig
+{
+    uint8 order;
+    NwQ16 bCoeffs[NW_NPNZ_MAX_ORDER + 1u];
+    NwQ16 aCoeffs[NW_NPNZ_MAX_ORDER + 1u];
+    NwQ15 outMin;
+    NwQ15 outMax;
+} NexaWattNpnzConfig;
+
+typedef struct sNexaWattNpnzController
+{
+    uint8 order;
+    NwQ16 bCoeffs[NW_NPNZ_MAX_ORDER + 1u];
+    NwQ16 aCoeffs[NW_NPNZ_MAX_ORDER + 1u];
+    NwQ15 errorHistory[NW_NPNZ_MAX_ORDER + 1u];
+    NwQ15 outputHistory[NW_NPNZ_MAX_ORDER + 1u];
+    NwQ15 outMin;
+    NwQ15 outMax;
+} NexaWattNpnzController;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Function used to initialize an NPNZ compensator instance with the provided configuration.
+ * The coefficients above the configured order are forced to zero and the history is cleared.
+ * \param npnz - A pointer to the NPNZ compensator instance to be initialized.
+ * \param npnzConfig - A pointer, containing the NPNZ compensator configuration. aCoeffs[0] is not used.
+ * \return NW_CONTROLLER_BAD_PARAM - One of the pointers is NULL, the order is not supported or the output limits are inverted.
+ * \return NW_CONTROLLER_SUCCESS - The compensator is initialized and ready for use.
+ */
+NexaWattControllerStatusResult NexaWatt_DigitalController_Npnz_Init(NexaWattNpnzController* npnz, const NexaWattNpnzConfig* npnzConfig);
+
+/**
+ * \brief Function used to convert per-sample PID gains to 2P2Z compensator coefficients.
+ * The conversion is based on the backward Euler discretization of the PID controller:
+ * u[n] = u[n-1] + (Kp + Ki + Kd)*e[n] - (Kp + 2*Kd)*e[n-1] + Kd*e[n-2].
+ * The output limits of the provided configuration are not modified.
+ * \param gains - A pointer, containing the per-sample PID gains.
+ * \param npnzConfig - A pointer to the NPNZ configuration that will be populated with 2P2Z coefficients.
+ * \return NW_CONTROLLER_BAD_PARAM - One of the pointers is NULL.
+ * \return NW_CONTROLLER_SUCCESS - The configuration is populated.
+ */
+NexaWattControllerStatusResult NexaWatt_DigitalController_Npnz_From_Pid(const NexaWattPidGains* gains, NexaWattNpnzConfig* npnzConfig);
+
+/**
+ * \brief Function used to clear the history of the NPNZ compensator.
+ * \param npnz - A pointer to the NPNZ compensator instance.
+ * \param outputVal - The value that will be preloaded into the output history. Can be used for bumpless transfer.
+ */
+void NexaWatt_DigitalController_Npnz_Reset(NexaWattNpnzController* npnz, NwQ15 outputVal);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/**
+ * \brief Executes a single step of the NPNZ compensator. The loop runs to the maximum supported order,
+ * so the execution time is constant and independent of the configured order.
+ * The function performs no validation and is intended to be executed in the control ISR.
+ * \param npnz - A pointer to an initialized NPNZ compensator instance.
+ * \param reference - The reference value in Q15 format.
+ * \param measurement - The measured value in Q15 format.
+ * \return The saturated compensator output in Q15 format.
+ */
+NW_LOCAL_INLINE NwQ15 NexaWatt_DigitalController_Npnz_Step(NexaWattNpnzController* const npnz, const NwQ15 reference, const NwQ15 measurement)
+{
+    int64 accumulator = 0;
+    NwQ15 output = 0;
+    uint8 histIdx = 0u;
+
+    for (histIdx = NW_NPNZ_MAX_ORDER; histIdx > 0u; histIdx--)
+    {
+        npnz->errorHistory[histIdx] = npnz->errorHistory[histIdx - 1u];
+        accumulator += (int64)npnz->bCoeffs[histIdx] * (int64)npnz->errorHistory[histIdx];
+        accumulator += (int64)npnz->aCoeffs[histIdx] * (int64)npnz->outputHistory[histIdx - 1u];
+    }
+    npnz->errorHistory[0u] = reference - measurement;
+    accumulator += (int64)npnz->bCoeffs[0u] * (int64)npnz->errorHistory[0u];
+
+    output = NexaWatt_FixedPoint_Saturate(NexaWatt_FixedPoint_Saturate_I64(accumulator >> NW_Q16_FRAC_BITS),
+                                          npnz->outMin, npnz->outMax);
+
+    for (histIdx = NW_NPNZ_MAX_ORDER; histIdx > 0u; histIdx--)
+    {
+        npnz->outputHistory[histIdx] = npnz->outputHistory[histIdx - 1u];
+    }
+    npnz->outputHistory[0u] = output;
+
+    return output;
+}
+
+#endif
@@ -0,0 +1,136 @@
+/*******************************************************************************
+* File Name:   digital_controller_pid.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the discrete PID controller of the NexaWatt-IV.DC framework.
+* The controller is executed in fixed point. The gains are provided per sample,
+* i.e. the integral gain already contains the sample period and the derivative
+* gain already contains the sample frequency.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_DIGITAL_CONTROLLER_PID_H
+#define NEXAWATT_IV_DC_DIGITAL_CONTROLLER_PID_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+#include "platform_fixed_point.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+typedef enum eNexaWattControllerStatusResult
+{
+    NW_CONTROLLER_SUCCESS   = 0u,
+    NW_CONTROLLER_BAD_PARAM = 1u,
+    NW_CONTROLLER_NOT_READY = 2u,
+} NexaWattControllerStatusResult;
+
+typedef struct sNexaWattPidGains
+{
+    NwQ16 kp;
+    NwQ16 ki;
+    NwQ16 kd;
+} NexaWattPidGains;
+
+typedef struct sNexaWattPidConfig
+{
+    NexaWattPidGains gains;
+    NwQ15 outMin;
+    NwQ15 outMax;
+} NexaWattPidConfig;
+
+typedef struct sNexaWattPidController
+{
+    NexaWattPidGains gains;
+    NwQ15 outMin;
+    NwQ15 outMax;
+    NwQ15 integrator;
+    NwQ15 prevError;
+    nw_bool integratorFrozen;
+} NexaWattPidController;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Function used to initialize a PID controller instance with the provided configuration.
+ * The internal state of the controller is reset.
+ * \param pid - A pointer to the PID controller instance to be initialized.
+ * \param pidConfig - A pointer, containing the PID controller configuration.
+ * \return NW_CONTROLLER_BAD_PARAM - One of the pointers is NULL or the output limits are inverted.
+ * \return NW_CONTROLLER_SUCCESS - The controller is initialized and ready for use.
+ */
+NexaWattControllerStatusResult NexaWatt_DigitalController_Pid_Init(NexaWattPidController* pid, const NexaWattPidConfig* pidConfig);
+
+/**
+ * \brief Function used to replace the gains of an already initialized PID controller.
+ * The integrator state is preserved, so the function can be used for bumpless gain scheduling.
+ * \param pid - A pointer to the PID controller instance.
+ * \param gains - A pointer, containing the new controller gains.
+ * \return NW_CONTROLLER_BAD_PARAM - One of the pointers is NULL.
+ * \return NW_CONTROLLER_SUCCESS - The new gains are applied.
+ */
+NexaWattControllerStatusResult NexaWatt_DigitalController_Pid_Set_Gains(NexaWattPidController* pid, const NexaWattPidGains* gains);
+
+/**
+ * \brief Function used to reset the internal state of the PID controller.
+ * \param pid - A pointer to the PID controller instance.
+ * \param integratorVal - The value that will be preloaded into the integrator. Can be used for bumpless transfer.
+ */
+void NexaWatt_DigitalController_Pid_Reset(NexaWattPidController* pid, NwQ15 integratorVal);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/**
+ * \brief Executes a single step of the PID controller. The integrator is clamped to the output limits
+ * to prevent windup. The function performs no validation and is intended to be executed in the control ISR.
+ * \param pid - A pointer to an initialized PID controller instance.
+ * \param reference - The reference value in Q15 format.
+ * \param measurement - The measured value in Q15 format.
+ * \return The saturated controller output in Q15 format.
+ */
+NW_LOCAL_INLINE NwQ15 NexaWatt_DigitalController_Pid_Step(NexaWattPidController* const pid, const NwQ15 reference, const NwQ15 measurement)
+{
+    NwQ15 error = reference - measurement;
+    int64 output = 0;
+
+    if (pid->integratorFrozen == nwFalse)
+    {
+        pid->integrator = NexaWatt_FixedPoint_Saturate(pid->integrator + NexaWatt_FixedPoint_Mul_Q16(error, pid->gains.ki),
+                                                       pid->outMin, pid->outMax);
+    }
+
+    output = (int64)NexaWatt_FixedPoint_Mul_Q16(error, pid->gains.kp) +
+             (int64)pid->integrator +
+             (int64)NexaWatt_FixedPoint_Mul_Q16(error - pid->prevError, pid->gains.kd);
+    pid->prevError = error;
+
+    return NexaWatt_FixedPoint_Saturate(NexaWatt_FixedPoint_Saturate_I64(output), pid->outMin, pid->outMax);
+}
+
+/**
+ * \brief Freezes or releases the integrator of the PID controller. A frozen integrator keeps its
+ * value, which is used by the framework when the modulator is not following the controller output.
+ * \param pid - A pointer to an initialized PID controller instance.
+ * \param freeze - nwTrue to freeze the integrator, nwFalse to release it.
+ */
+NW_LOCAL_INLINE void NexaWatt_DigitalController_Pid_Freeze_Integrator(NexaWattPidController* const pid, const nw_bool freeze)
+{
+    pid->integratorFrozen = freeze;
+}
+
+#endif
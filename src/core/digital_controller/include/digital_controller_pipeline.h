@@ -0,0 +1,238 @@
+/*******************************************************************************
+* File Name:   digital_controller_pipeline.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the control pipeline of the NexaWatt-IV.DC framework. The pipeline
+* executes the complete path from the ADC end of sequence to the PWM update as
+* one fused chain in the ADC frame callback: acquisition, scaling, filtering,
+* protection, control law and PWM commit. The stages are registered at the
+* initialization into a static array and called directly, without any lookup.
+* The execution time of every stage and of the whole chain is measured in CPU cycles
+* and checked against the cycle budget of the pipeline.
+* The PID and NPNZ controllers are registered as control stages through their adapters,
+* which clamp the output to the duty limits of the selected topology (see topology_descriptor.h):
+* NexaWatt_DigitalController_Pipeline_Register_Stage(&pipeline, NW_PIPELINE_STAGE_CONTROL, NexaWatt_DigitalController_Pipeline_Pid_Stage, &pidStage);
+* Typical usage in the ADC frame callback:
+* NexaWatt_DigitalController_Pipeline_Execute(&pipeline, frame->samples, frame->sampleCnt);
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_DIGITAL_CONTROLLER_PIPELINE_H
+#define NEXAWATT_IV_DC_DIGITAL_CONTROLLER_PIPELINE_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+#include "platform_fixed_point.h"
+#include "digital_controller_pid.h"
+#include "digital_controller_npnz.h"
+#include "topology_descriptor.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Maximum number of stages of a pipeline.
+ */
+#define NW_PIPELINE_MAX_STAGES          (8u)
+
+/**
+ * \brief Number of scaled measurement signals, shared between the stages.
+ */
+#define NW_PIPELINE_MAX_SIGNALS         (8u)
+
+/**
+ * \brief Number of actuation outputs (duty cycles), shared between the stages.
+ */
+#define NW_PIPELINE_MAX_OUTPUTS         (8u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+/**
+ * \brief Type of a pipeline stage. The stages must be registered in this order;
+ * several stages of the same type are allowed.
+ */
+typedef enum eNexaWattPipelineStageType
+{
+    NW_PIPELINE_STAGE_ACQUIRE   = 0x00u,
+    NW_PIPELINE_STAGE_SCALE     = 0x01u,
+    NW_PIPELINE_STAGE_FILTER    = 0x02u,
+    NW_PIPELINE_STAGE_PROTECT   = 0x03u,
+    NW_PIPELINE_STAGE_CONTROL   = 0x04u,
+    NW_PIPELINE_STAGE_ACTUATE   = 0x05u,
+} NexaWattPipelineStageType;
+
+/**
+ * \brief Signals passed along the pipeline. The samples point to the ADC frame, the measurements are
+ * written by the scaling and filtering stages and the outputs by the control stages.
+ */
+typedef struct sNexaWattPipelineSignals
+{
+    const NwAdcSample* samples;
+    uint8 sampleCnt;
+    NwQ15 measurements[NW_PIPELINE_MAX_SIGNALS];
+    NwQ15 outputs[NW_PIPELINE_MAX_OUTPUTS];
+} NexaWattPipelineSignals;
+
+/**
+ * \brief Function of a pipeline stage.
+ * \param stageContext - The context registered with the stage (e.g. a filter or a controller instance).
+ * \param signals - The signals of the pipeline.
+ * \return nwTrue - The chain continues with the next stage.
+ * \return nwFalse - The chain ends. A protection stage returning nwFalse must bring the power stage to its safe state itself.
+ */
+typedef nw_bool(*NwPipelineStageFnc)(void* stageContext, NexaWattPipelineSignals* signals);
+
+/**
+ * \brief Execution time statistics in CPU cycles.
+ */
+typedef struct sNexaWattPipelineTiming
+{
+    uint32 lastCycles;
+    uint32 maxCycles;
+} NexaWattPipelineTiming;
+
+typedef struct sNexaWattPipelineStage
+{
+    NwPipelineStageFnc stageFnc;
+    void* stageContext;
+    NexaWattPipelineStageType stageType;
+    NexaWattPipelineTiming timing;
+} NexaWattPipelineStage;
+
+/**
+ * \brief Context of a PID control stage: the controller regulates a measurement to the reference
+ * and writes the duty cycle to an output. The reference can be updated at any time, e.g. by the reference generator.
+ */
+typedef struct sNexaWattPipelinePidStage
+{
+    NexaWattPidController* pid;
+    volatile NwQ15 reference;
+    uint8 measurementIdx;
+    uint8 outputIdx;
+} NexaWattPipelinePidStage;
+
+/**
+ * \brief Context of an NPNZ control stage, equivalent to the PID control stage.
+ */
+typedef struct sNexaWattPipelineNpnzStage
+{
+    NexaWattNpnzController* npnz;
+    volatile NwQ15 reference;
+    uint8 measurementIdx;
+    uint8 outputIdx;
+} NexaWattPipelineNpnzStage;
+
+typedef struct sNexaWattControlPipeline
+{
+    NexaWattPipelineStage stages[NW_PIPELINE_MAX_STAGES];
+    uint8 stageCnt;
+    nw_bool isSealed;
+    NexaWattPipelineSignals signals;
+    NexaWattPipelineTiming totalTiming;
+    uint32 cycleBudget;
+    uint32 executionCnt;
+    uint32 overrunCnt;
+    uint32 abortCnt;
+} NexaWattControlPipeline;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Function used to initialize an empty pipeline. The timing measurements require the enabled cycle counter (see platform_cycle_counter.h).
+ * \param pipeline - A pointer to the pipeline to be initialized.
+ * \param cycleBudget - The maximum execution time of the whole chain in CPU cycles. Executions above it are counted as overruns.
+ * \return NW_CONTROLLER_BAD_PARAM - The pointer is NULL or the cycle budget is 0.
+ * \return NW_CONTROLLER_SUCCESS - The pipeline is initialized and stages can be registered.
+ */
+NexaWattControllerStatusResult NexaWatt_DigitalController_Pipeline_Init(NexaWattControlPipeline* pipeline, uint32 cycleBudget);
+
+/**
+ * \brief Function used to append a stage to the pipeline.
+ * \param pipeline - A pointer to an initialized pipeline.
+ * \param stageType - The type of the stage. Must not precede the type of the last registered stage.
+ * \param stageFnc - The function of the stage.
+ * \param stageContext - The context passed to the function of the stage. Can be NULL.
+ * \return NW_CONTROLLER_BAD_PARAM - A pointer is NULL, the pipeline is full or sealed, or the stage type is out of order.
+ * \return NW_CONTROLLER_SUCCESS - The stage is registered.
+ */
+NexaWattControllerStatusResult NexaWatt_DigitalController_Pipeline_Register_Stage(NexaWattControlPipeline* pipeline, NexaWattPipelineStageType stageType,
+                                                                                  NwPipelineStageFnc stageFnc, void* stageContext);
+
+/**
+ * \brief Function used to complete the registration. No stages can be registered afterwards.
+ * \param pipeline - A pointer to an initialized pipeline.
+ * \return NW_CONTROLLER_BAD_PARAM - The pointer is NULL or the last stage is not an actuation stage.
+ * \return NW_CONTROLLER_SUCCESS - The pipeline is ready for execution.
+ */
+NexaWattControllerStatusResult NexaWatt_DigitalController_Pipeline_Seal(NexaWattControlPipeline* pipeline);
+
+/**
+ * \brief Executes the chain of stages on an ADC frame and measures the execution time of each stage.
+ * The function performs no validation of the pointers and is intended to be executed in the ADC frame callback.
+ * \param pipeline - A pointer to a sealed pipeline.
+ * \param samples - The samples of the ADC frame. The pipeline does not copy them.
+ * \param sampleCnt - The number of samples.
+ * \return nwTrue - All stages were executed.
+ * \return nwFalse - The pipeline is not sealed or a stage ended the chain.
+ */
+nw_bool NexaWatt_DigitalController_Pipeline_Execute(NexaWattControlPipeline* pipeline, const NwAdcSample* samples, uint8 sampleCnt);
+
+/**
+ * \brief Function used to reset the timing statistics and the counters of the pipeline.
+ * \param pipeline - A pointer to an initialized pipeline.
+ */
+void NexaWatt_DigitalController_Pipeline_Reset_Timing(NexaWattControlPipeline* pipeline);
+
+/**
+ * \brief Control stage executing a PID controller. The output is clamped to the duty limits of the selected topology,
+ * as the last guard behind the output limits of the controller. The indexes are not validated.
+ * \param stageContext - A pointer to the PID stage context.
+ * \param signals - The signals of the pipeline.
+ * \return nwTrue - Always, the chain continues.
+ */
+nw_bool NexaWatt_DigitalController_Pipeline_Pid_Stage(void* stageContext, NexaWattPipelineSignals* signals);
+
+/**
+ * \brief Control stage executing an NPNZ controller. The output is clamped to the duty limits of the selected topology,
+ * as the last guard behind the output limits of the controller. The indexes are not validated.
+ * \param stageContext - A pointer to the NPNZ stage context.
+ * \param signals - The signals of the pipeline.
+ * \return nwTrue - Always, the chain continues.
+ */
+nw_bool NexaWatt_DigitalController_Pipeline_Npnz_Stage(void* stageContext, NexaWattPipelineSignals* signals);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/**
+ * \brief Returns the timing statistics of a stage.
+ * \param pipeline - A pointer to an initialized pipeline.
+ * \param stageIdx - The index of the stage in the order of registration.
+ * \return A pointer to the timing statistics or NULL for non-existing stages.
+ */
+NW_LOCAL_INLINE const NexaWattPipelineTiming* NexaWatt_DigitalController_Pipeline_Get_Stage_Timing(const NexaWattControlPipeline* const pipeline, const uint8 stageIdx)
+{
+    return (stageIdx < pipeline->stageCnt) ? &pipeline->stages[stageIdx].timing : NULL;
+}
+
+/**
+ * \brief Returns the timing statistics of the whole chain.
+ * \param pipeline - A pointer to an initialized pipeline.
+ * \return A pointer to the timing statistics.
+ */
+NW_LOCAL_INLINE const NexaWattPipelineTiming* NexaWatt_DigitalController_Pipeline_Get_Total_Timing(const NexaWattControlPipeline* const pipeline)
+{
+    return &pipeline->totalTiming;
+}
+
+#endif
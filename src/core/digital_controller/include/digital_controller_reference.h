@@ -0,0 +1,159 @@
+/*******************************************************************************
+* File Name:   digital_controller_reference.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the reference trajectory generator of the NexaWatt-IV.DC framework.
+* A step of the reference (e.g. the soft-start of the output voltage or a setpoint
+* change) causes an inrush current and an overshoot, so the generator moves the
+* reference to a new target along one of the trajectories:
+* - SLEW: a ramp with a constant rate;
+* - S_CURVE: a quintic smoothstep, whose rate and acceleration start and end at 0, so
+*   the jerk stays bounded. The duration is chosen so the peak rate (15/8 of the mean
+*   rate) does not exceed the rate limit;
+* - EXPONENTIAL: a first-order approach with the configured time constant.
+* The reference is kept with NW_REFERENCE_EXT_BITS additional fractional bits, so slow
+* ramps advance by a fraction of a Q15 step per sample. Every trajectory is monotonic
+* and ends exactly at the target. The divisions are done, when a target is set; the
+* per-sample step uses additions and multiplications only.
+* The end of a move can be posted as a deferred event, e.g. to post the SOFTSTART_DONE
+* event of the converter state machine.
+* Typical usage: the main loop (or a state entry action) sets the target, the control ISR calls
+* ref = NexaWatt_DigitalController_Reference_Step(&reference);
+* duty = NexaWatt_DigitalController_Pid_Step(&pid, ref, vout);
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_DIGITAL_CONTROLLER_REFERENCE_H
+#define NEXAWATT_IV_DC_DIGITAL_CONTROLLER_REFERENCE_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+#include "platform_fixed_point.h"
+#include "digital_controller_pid.h"
+#include "nexa_mini_os_event.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Number of fractional bits of the internal reference in addition to the Q15 format.
+ */
+#define NW_REFERENCE_EXT_BITS               (14u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+typedef enum eNexaWattReferenceProfile
+{
+    NW_REFERENCE_PROFILE_SLEW           = 0x00u,
+    NW_REFERENCE_PROFILE_S_CURVE        = 0x01u,
+    NW_REFERENCE_PROFILE_EXPONENTIAL    = 0x02u,
+} NexaWattReferenceProfile;
+
+/**
+ * \brief Configuration of the reference generator. The rate limit is given in Q15 units per second
+ * (NW_Q15_ONE is the full scale per second) and is used by the SLEW and S_CURVE profiles.
+ * The time constant is used by the EXPONENTIAL profile. The completion handler is optional.
+ */
+typedef struct sNexaWattReferenceConfig
+{
+    NexaWattReferenceProfile profile;
+    uint32 sampleFreqHz;
+    NwQ15 maxRate;
+    uint32 timeConstantUs;
+    NwMiniOsEventHandler doneHandler;
+    void* doneContext;
+} NexaWattReferenceConfig;
+
+typedef struct sNexaWattReference
+{
+    NexaWattReferenceProfile profile;
+    int32 slewStep;
+    int32 expAlpha;
+    NwMiniOsEventHandler doneHandler;
+    void* doneContext;
+    int32 position;
+    int32 targetPosition;
+    NwQ15 target;
+    int32 startPosition;
+    int32 moveSpan;
+    uint32 phase;
+    uint32 phaseStep;
+    uint32 remainingCnt;
+    volatile nw_bool isDone;
+} NexaWattReference;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Function used to initialize a reference generator. The reference starts at rest at the initial value.
+ * \param reference - A pointer to the reference generator to be initialized.
+ * \param referenceConfig - A pointer to the configuration.
+ * \param initValue - The initial reference in Q15 format, e.g. the measured pre-biased output voltage.
+ * \return NW_CONTROLLER_BAD_PARAM - A pointer is NULL, the profile or the sample frequency is invalid,
+ * the rate limit or the time constant is 0 or out of the resolution at the sample frequency.
+ * \return NW_CONTROLLER_SUCCESS - The reference generator is initialized.
+ */
+NexaWattControllerStatusResult NexaWatt_DigitalController_Reference_Init(NexaWattReference* reference, const NexaWattReferenceConfig* referenceConfig, NwQ15 initValue);
+
+/**
+ * \brief Function used to start a move to a new target. A move in progress continues from the current reference
+ * (an S-curve restarts from it at rest). Must not be called from a higher priority context than the step.
+ * \param reference - A pointer to an initialized reference generator.
+ * \param target - The target in Q15 format.
+ * \return NW_CONTROLLER_BAD_PARAM - The pointer is NULL or the target is out of the Q15 range.
+ * \return NW_CONTROLLER_SUCCESS - The move is started.
+ */
+NexaWattControllerStatusResult NexaWatt_DigitalController_Reference_Set_Target(NexaWattReference* reference, NwQ15 target);
+
+/**
+ * \brief Function used to set the reference immediately and stop the move in progress, e.g. on a shutdown.
+ * No completion event is posted.
+ * \param reference - A pointer to an initialized reference generator.
+ * \param value - The reference in Q15 format.
+ * \return NW_CONTROLLER_BAD_PARAM - The pointer is NULL or the value is out of the Q15 range.
+ * \return NW_CONTROLLER_SUCCESS - The reference is set.
+ */
+NexaWattControllerStatusResult NexaWatt_DigitalController_Reference_Reset(NexaWattReference* reference, NwQ15 value);
+
+/**
+ * \brief Executes a single step of the reference generator and posts the completion event at the end of a move.
+ * The function performs no validation and is intended to be executed in the control ISR.
+ * \param reference - A pointer to an initialized reference generator.
+ * \return The reference in Q15 format.
+ */
+NwQ15 NexaWatt_DigitalController_Reference_Step(NexaWattReference* reference);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/**
+ * \brief Returns the current reference.
+ * \param reference - A pointer to an initialized reference generator.
+ * \return The reference in Q15 format.
+ */
+NW_LOCAL_INLINE NwQ15 NexaWatt_DigitalController_Reference_Get_Value(const NexaWattReference* const reference)
+{
+    return (NwQ15)(reference->position >> NW_REFERENCE_EXT_BITS);
+}
+
+/**
+ * \brief Checks whether the reference reached its target.
+ * \param reference - A pointer to an initialized reference generator.
+ * \return nwTrue - The reference is at the target. nwFalse - A move is in progress.
+ */
+NW_LOCAL_INLINE nw_bool NexaWatt_DigitalController_Reference_Is_Done(const NexaWattReference* const reference)
+{
+    return reference->isDone;
+}
+
+#endif
@@ -0,0 +1,337 @@
+/*******************************************************************************
+* File Name:   digital_controller_autotune.c
+*
+* Description: This is the source file containing definitions,
+* related to the relay-feedback automatic loop tuning of the NexaWatt-IV.DC framework.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "digital_controller_autotune.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief The describing function gain of an ideal relay: 4 / PI in Q16.16 format.
+ */
+#define NW_AUTOTUNE_RELAY_DF_GAIN_Q16       (83443)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+/**
+ * \brief Tuning rule, expressed relative to the ultimate gain Ku and ultimate period Tu:
+ * Kp = kpFactor * Ku, Ki = Kp * kiFactor / Tu, Kd = Kp * kdFactor * Tu.
+ * The ultimate period is in samples, so the resulting gains are per sample.
+ */
+typedef struct sNexaWattAutotuneRuleFactors
+{
+    NwQ16 kpFactor;
+    NwQ16 kiFactor;
+    NwQ16 kdFactor;
+} NexaWattAutotuneRuleFactors;
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+/**
+ * \brief Array containing mapping between the NexaWattAutotuneRule tuning rules and their factors.
+ */
+static const NexaWattAutotuneRuleFactors autotuneRuleFactorsMap[] =
+{
+    // Ziegler-Nichols PI: Kp = 0.45 Ku, Ti = Tu / 1.2
+    { NW_Q16_CONST(0.45), NW_Q16_CONST(1.2), NW_Q16_CONST(0.0) },
+    // Ziegler-Nichols PID: Kp = 0.6 Ku, Ti = Tu / 2, Td = Tu / 8
+    { NW_Q16_CONST(0.6), NW_Q16_CONST(2.0), NW_Q16_CONST(0.125) },
+    // No overshoot PID: Kp = 0.2 Ku, Ti = Tu / 2, Td = Tu / 3
+    { NW_Q16_CONST(0.2), NW_Q16_CONST(2.0), NW_Q16_CONST(0.333333) },
+};
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that validates the provided NexaWattAutotuneConfig tuning configuration.
+ * \param autotuneConfig - A pointer, containing the tuning configuration.
+ * \return nwTrue - Validation is performed and the configuration is correct.
+ * \return nwFalse - Validation is performed, but the configuration contains incorrect data.
+ */
+NW_LOCAL_INLINE nw_bool NexaWatt_DigitalController_Autotune_Validate_Config(const NexaWattAutotuneConfig* autotuneConfig);
+
+/**
+ * \brief Simple helper function that completes a single oscillation cycle on a rising relay switch.
+ * The period and peak-to-peak amplitude of the cycle are accumulated, once the settling cycles are passed.
+ * \param autotune - A pointer to the autotune instance.
+ * \param filteredMeas - The filtered measurement at the switching instant.
+ */
+NW_LOCAL_INLINE void NexaWatt_DigitalController_Autotune_Complete_Cycle(NexaWattAutotune* autotune, NwQ15 filteredMeas);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattControllerStatusResult NexaWatt_DigitalController_Autotune_Start(NexaWattAutotune* const autotune, const NexaWattAutotuneConfig* const autotuneConfig, const NwQ15 initMeas)
+{
+    NexaWattControllerStatusResult retRes = NW_CONTROLLER_BAD_PARAM;
+    NexaWattFilterStatusResult filterInitRes = NW_FILTER_BAD_PARAM;
+
+    if ((autotune != NULL) &&
+        (NexaWatt_DigitalController_Autotune_Validate_Config(autotuneConfig) == nwTrue))
+    {
+        filterInitRes = NexaWatt_Filtering_Iir1_Init(&autotune->measFilter, autotuneConfig->filterAlpha, initMeas);
+        if (filterInitRes == NW_FILTER_SUCCESS)
+        {
+            autotune->config = *autotuneConfig;
+            autotune->abortReason = NW_AUTOTUNE_ABORT_NONE;
+            autotune->relayHigh = (initMeas < autotuneConfig->setpoint) ? nwTrue : nwFalse;
+            autotune->cycleStarted = nwFalse;
+            autotune->sampleCnt = 0u;
+            autotune->lastSwitchSample = 0u;
+            autotune->cycleCnt = 0u;
+            autotune->measuredCycles = 0u;
+            autotune->cycleMax = initMeas;
+            autotune->cycleMin = initMeas;
+            autotune->periodSum = 0u;
+            autotune->amplitudeSum = 0u;
+
+            // The state is changed last, as the step function may already be executed by the control ISR
+            autotune->state = NW_AUTOTUNE_RUNNING;
+
+            retRes = NW_CONTROLLER_SUCCESS;
+        }
+    }
+
+    return retRes;
+}
+
+NwQ15 NexaWatt_DigitalController_Autotune_Step(NexaWattAutotune* const autotune, const NwQ15 measurement)
+{
+    NwQ15 output = autotune->config.safeOutput;
+    NwQ15 filteredMeas = 0;
+    NwQ15 error = 0;
+
+    if (autotune->state == NW_AUTOTUNE_RUNNING)
+    {
+        filteredMeas = NexaWatt_Filtering_Iir1_Step(&autotune->measFilter, measurement);
+        autotune->sampleCnt++;
+
+        if ((filteredMeas < autotune->config.measMin) ||
+            (filteredMeas > autotune->config.measMax))
+        {
+            // The oscillation left the safety window, the experiment is stopped immediately
+            autotune->abortReason = NW_AUTOTUNE_ABORT_MEAS_LIMIT;
+            autotune->state = NW_AUTOTUNE_ABORTED;
+        }
+        else if (autotune->sampleCnt >= autotune->config.timeoutSamples)
+        {
+            // No stable limit cycle was established in the configured time
+            autotune->abortReason = NW_AUTOTUNE_ABORT_TIMEOUT;
+            autotune->state = NW_AUTOTUNE_ABORTED;
+        }
+        else
+        {
+            autotune->cycleMax = (filteredMeas > autotune->cycleMax) ? filteredMeas : autotune->cycleMax;
+            autotune->cycleMin = (filteredMeas < autotune->cycleMin) ? filteredMeas : autotune->cycleMin;
+
+            error = autotune->config.setpoint - filteredMeas;
+            if ((autotune->relayHigh == nwTrue) &&
+                (error < -autotune->config.hysteresis))
+            {
+                autotune->relayHigh = nwFalse;
+            }
+            else if ((autotune->relayHigh == nwFalse) &&
+                     (error > autotune->config.hysteresis))
+            {
+                autotune->relayHigh = nwTrue;
+                NexaWatt_DigitalController_Autotune_Complete_Cycle(autotune, filteredMeas);
+            }
+            else
+            {
+                // Relay output is kept inside of the hysteresis band
+            }
+
+            output = (autotune->relayHigh == nwTrue) ?
+                     (autotune->config.outputBias + autotune->config.relayAmplitude) :
+                     (autotune->config.outputBias - autotune->config.relayAmplitude);
+        }
+
+        if (autotune->state == NW_AUTOTUNE_ABORTED)
+        {
+            output = autotune->config.safeOutput;
+        }
+        else if (autotune->state == NW_AUTOTUNE_MEASURED)
+        {
+            output = autotune->config.outputBias;
+        }
+    }
+    else if ((autotune->state == NW_AUTOTUNE_MEASURED) ||
+             (autotune->state == NW_AUTOTUNE_DONE))
+    {
+        // Hold the operating point until the application takes over with the tuned controller
+        output = autotune->config.outputBias;
+    }
+
+    return output;
+}
+
+NexaWattControllerStatusResult NexaWatt_DigitalController_Autotune_Compute(NexaWattAutotune* const autotune, NexaWattAutotuneResult* const result)
+{
+    NexaWattControllerStatusResult retRes = NW_CONTROLLER_BAD_PARAM;
+    const NexaWattAutotuneRuleFactors* ruleFactors = NULL;
+    int64 amplitudeSq = 0;
+    int64 hysteresisSq = 0;
+    uint32 effectiveAmplitude = 0u;
+    uint32 periodAvg = 0u;
+    NwQ15 amplitudeAvg = 0;
+    NwQ16 kp = 0;
+
+    if ((autotune != NULL) &&
+        (result != NULL))
+    {
+        if (autotune->state != NW_AUTOTUNE_MEASURED)
+        {
+            retRes = NW_CONTROLLER_NOT_READY;
+        }
+        else
+        {
+            periodAvg = autotune->periodSum / autotune->measuredCycles;
+            amplitudeAvg = (NwQ15)(autotune->amplitudeSum / autotune->measuredCycles);
+
+            // The relay hysteresis shifts the switching instants: a_eff = sqrt(a^2 - h^2)
+            amplitudeSq = (int64)amplitudeAvg * (int64)amplitudeAvg;
+            hysteresisSq = (int64)autotune->config.hysteresis * (int64)autotune->config.hysteresis;
+            if (amplitudeSq > hysteresisSq)
+            {
+                effectiveAmplitude = NexaWatt_FixedPoint_Sqrt_U64((uint64)(amplitudeSq - hysteresisSq));
+            }
+
+            if ((effectiveAmplitude == 0u) ||
+                (periodAvg == 0u))
+            {
+                autotune->abortReason = NW_AUTOTUNE_ABORT_BAD_RESULT;
+                autotune->state = NW_AUTOTUNE_ABORTED;
+            }
+            else
+            {
+                ruleFactors = &autotuneRuleFactorsMap[autotune->config.rule];
+
+                result->ultimatePeriodSamples = periodAvg;
+                result->oscillationAmplitude = amplitudeAvg;
+                result->ultimateGain = NexaWatt_FixedPoint_Saturate_I64(
+                        ((int64)NW_AUTOTUNE_RELAY_DF_GAIN_Q16 * (int64)autotune->config.relayAmplitude) / (int64)effectiveAmplitude);
+
+                kp = NexaWatt_FixedPoint_Saturate_I64(((int64)result->ultimateGain * (int64)ruleFactors->kpFactor) >> NW_Q16_FRAC_BITS);
+                result->gains.kp = kp;
+                result->gains.ki = NexaWatt_FixedPoint_Saturate_I64(
+                        (((int64)kp * (int64)ruleFactors->kiFactor) >> NW_Q16_FRAC_BITS) / (int64)periodAvg);
+                result->gains.kd = NexaWatt_FixedPoint_Saturate_I64(
+                        (((int64)kp * (int64)ruleFactors->kdFactor) >> NW_Q16_FRAC_BITS) * (int64)periodAvg);
+
+                autotune->result = *result;
+                autotune->state = NW_AUTOTUNE_DONE;
+
+                retRes = NW_CONTROLLER_SUCCESS;
+            }
+        }
+    }
+
+    return retRes;
+}
+
+void NexaWatt_DigitalController_Autotune_Abort(NexaWattAutotune* const autotune)
+{
+    if ((autotune != NULL) &&
+        (autotune->state == NW_AUTOTUNE_RUNNING))
+    {
+        autotune->abortReason = NW_AUTOTUNE_ABORT_USER;
+        autotune->state = NW_AUTOTUNE_ABORTED;
+    }
+}
+
+NexaWattAutotuneState NexaWatt_DigitalController_Autotune_Get_State(const NexaWattAutotune* const autotune)
+{
+    NexaWattAutotuneState retState = NW_AUTOTUNE_IDLE;
+
+    if (autotune != NULL)
+    {
+        retState = autotune->state;
+    }
+
+    return retState;
+}
+
+NexaWattAutotuneAbortReason NexaWatt_DigitalController_Autotune_Get_Abort_Reason(const NexaWattAutotune* const autotune)
+{
+    NexaWattAutotuneAbortReason retReason = NW_AUTOTUNE_ABORT_NONE;
+
+    if (autotune != NULL)
+    {
+        retReason = autotune->abortReason;
+    }
+
+    return retReason;
+}
+
+NW_LOCAL_INLINE nw_bool NexaWatt_DigitalController_Autotune_Validate_Config(const NexaWattAutotuneConfig* const autotuneConfig)
+{
+    nw_bool validationRes = nwTrue;
+
+    if (autotuneConfig == NULL)
+    {
+        // Tuning configuration is not provided by the user
+        validationRes = nwFalse;
+    }
+    else if ((autotuneConfig->setpoint <= autotuneConfig->measMin) ||
+             (autotuneConfig->setpoint >= autotuneConfig->measMax))
+    {
+        // The setpoint must be inside of the safety window
+        validationRes = nwFalse;
+    }
+    else if ((autotuneConfig->relayAmplitude <= 0) ||
+             (autotuneConfig->hysteresis < 0) ||
+             ((autotuneConfig->outputBias - autotuneConfig->relayAmplitude) < NW_Q15_MIN) ||
+             ((autotuneConfig->outputBias + autotuneConfig->relayAmplitude) > NW_Q15_MAX))
+    {
+        // The relay output must be a valid Q15 value
+        validationRes = nwFalse;
+    }
+    else if ((autotuneConfig->measureCycles == 0u) ||
+             (autotuneConfig->timeoutSamples == 0u) ||
+             (autotuneConfig->rule >= NW_AUTOTUNE_RULE_INVALID))
+    {
+        // Invalid experiment duration or tuning rule
+        validationRes = nwFalse;
+    }
+
+    return validationRes;
+}
+
+NW_LOCAL_INLINE void NexaWatt_DigitalController_Autotune_Complete_Cycle(NexaWattAutotune* const autotune, const NwQ15 filteredMeas)
+{
+    if (autotune->cycleStarted == nwTrue)
+    {
+        autotune->cycleCnt++;
+
+        // The first cycles are discarded, as the limit cycle needs time to settle
+        if (autotune->cycleCnt > autotune->config.settleCycles)
+        {
+            autotune->periodSum += autotune->sampleCnt - autotune->lastSwitchSample;
+            autotune->amplitudeSum += (uint32)((autotune->cycleMax - autotune->cycleMin) / 2);
+            autotune->measuredCycles++;
+
+            if (autotune->measuredCycles >= autotune->config.measureCycles)
+            {
+                autotune->state = NW_AUTOTUNE_MEASURED;
+            }
+        }
+    }
+
+    autotune->cycleStarted = nwTrue;
+    autotune->lastSwitchSample = autotune->sampleCnt;
+    autotune->cycleMax = filteredMeas;
+    autotune->cycleMin = filteredMeas;
+}
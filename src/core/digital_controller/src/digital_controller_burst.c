@@ -0,0 +1,76 @@
+/*******************************************************************************
+* File Name:   digital_controller_burst.c
+*
+* Description: This is the source file containing definitions,
+* related to the light-load burst mode of the NexaWatt-IV.DC framework.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "digital_controller_burst.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattControllerStatusResult NexaWatt_DigitalController_Burst_Init(NexaWattBurst* const burst, const NexaWattBurstConfig* const burstConfig, NexaWattPidController* const pid,
+                                                                    const NwQ15 initLoadCurrent)
+{
+    NexaWattControllerStatusResult retRes = NW_CONTROLLER_BAD_PARAM;
+    NexaWattFilterStatusResult filterInitRes = NW_FILTER_BAD_PARAM;
+
+    if ((burst != NULL) &&
+        (burstConfig != NULL) &&
+        (burstConfig->bandLow >= 0) &&
+        (burstConfig->bandHigh >= 0) &&
+        (burstConfig->exitUndershoot > burstConfig->bandLow) &&
+        (burstConfig->burstDutyBoost >= 0) &&
+        (burstConfig->entryCurrent < burstConfig->exitCurrent))
+    {
+        filterInitRes = NexaWatt_Filtering_Iir1_Init(&burst->loadCurrentFilter, burstConfig->loadCurrentAlpha, initLoadCurrent);
+        if (filterInitRes == NW_FILTER_SUCCESS)
+        {
+            burst->config = *burstConfig;
+            burst->pid = pid;
+            burst->burstCnt = 0u;
+            NexaWatt_DigitalController_Burst_Force_Continuous(burst);
+
+            retRes = NW_CONTROLLER_SUCCESS;
+        }
+    }
+
+    return retRes;
+}
+
+void NexaWatt_DigitalController_Burst_Force_Continuous(NexaWattBurst* const burst)
+{
+    if (burst != NULL)
+    {
+        burst->mode = NW_BURST_MODE_CONTINUOUS;
+        burst->switchingEnabled = nwTrue;
+        burst->dwellCnt = 0u;
+        if (burst->pid != NULL)
+        {
+            NexaWatt_DigitalController_Pid_Freeze_Integrator(burst->pid, nwFalse);
+        }
+    }
+}
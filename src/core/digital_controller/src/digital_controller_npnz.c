@@ -0,0 +1,107 @@
+/*******************************************************************************
+* File Name:   digital_controller_npnz.c
+*
+* Description: This is the source file containing definitions,
+* related to the N-Pole N-Zero (NPNZ) compensator of the NexaWatt-IV.DC framework.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "digital_controller_npnz.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Order of the compensator, equivalent to the discrete PID controller.
+ */
+#define NW_NPNZ_PID_EQUIVALENT_ORDER    (2u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattControllerStatusResult NexaWatt_DigitalController_Npnz_Init(NexaWattNpnzController* const npnz, const NexaWattNpnzConfig* const npnzConfig)
+{
+    NexaWattControllerStatusResult retRes = NW_CONTROLLER_BAD_PARAM;
+    uint8 coeffIdx = 0u;
+
+    if ((npnz != NULL) &&
+        (npnzConfig != NULL) &&
+        (npnzConfig->order > 0u) &&
+        (npnzConfig->order <= NW_NPNZ_MAX_ORDER) &&
+        (npnzConfig->outMin < npnzConfig->outMax))
+    {
+        npnz->order = npnzConfig->order;
+        npnz->outMin = npnzConfig->outMin;
+        npnz->outMax = npnzConfig->outMax;
+
+        for (coeffIdx = 0u; coeffIdx <= NW_NPNZ_MAX_ORDER; coeffIdx++)
+        {
+            // Coefficients above the configured order are zeroed, so the constant-time step ignores them
+            npnz->bCoeffs[coeffIdx] = (coeffIdx <= npnzConfig->order) ? npnzConfig->bCoeffs[coeffIdx] : 0;
+            npnz->aCoeffs[coeffIdx] = ((coeffIdx > 0u) && (coeffIdx <= npnzConfig->order)) ? npnzConfig->aCoeffs[coeffIdx] : 0;
+        }
+
+        NexaWatt_DigitalController_Npnz_Reset(npnz, 0);
+
+        retRes = NW_CONTROLLER_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattControllerStatusResult NexaWatt_DigitalController_Npnz_From_Pid(const NexaWattPidGains* const gains, NexaWattNpnzConfig* const npnzConfig)
+{
+    NexaWattControllerStatusResult retRes = NW_CONTROLLER_BAD_PARAM;
+    uint8 coeffIdx = 0u;
+
+    if ((gains != NULL) &&
+        (npnzConfig != NULL))
+    {
+        for (coeffIdx = 0u; coeffIdx <= NW_NPNZ_MAX_ORDER; coeffIdx++)
+        {
+            npnzConfig->bCoeffs[coeffIdx] = 0;
+            npnzConfig->aCoeffs[coeffIdx] = 0;
+        }
+
+        npnzConfig->order = NW_NPNZ_PID_EQUIVALENT_ORDER;
+        npnzConfig->bCoeffs[0u] = NexaWatt_FixedPoint_Saturate_I64((int64)gains->kp + (int64)gains->ki + (int64)gains->kd);
+        npnzConfig->bCoeffs[1u] = NexaWatt_FixedPoint_Saturate_I64(-((int64)gains->kp + (2 * (int64)gains->kd)));
+        npnzConfig->bCoeffs[2u] = gains->kd;
+        npnzConfig->aCoeffs[1u] = NW_Q16_ONE;
+
+        retRes = NW_CONTROLLER_SUCCESS;
+    }
+
+    return retRes;
+}
+
+void NexaWatt_DigitalController_Npnz_Reset(NexaWattNpnzController* const npnz, const NwQ15 outputVal)
+{
+    uint8 histIdx = 0u;
+
+    if (npnz != NULL)
+    {
+        for (histIdx = 0u; histIdx <= NW_NPNZ_MAX_ORDER; histIdx++)
+        {
+            npnz->errorHistory[histIdx] = 0;
+            npnz->outputHistory[histIdx] = NexaWatt_FixedPoint_Saturate(outputVal, npnz->outMin, npnz->outMax);
+        }
+    }
+}
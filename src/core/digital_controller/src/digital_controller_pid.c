@@ -0,0 +1,78 @@
+/*******************************************************************************
+* File Name:   digital_controller_pid.c
+*
+* Description: This is the source file containing definitions,
+* related to the discrete PID controller of the NexaWatt-IV.DC framework.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "digital_controller_pid.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattControllerStatusResult NexaWatt_DigitalController_Pid_Init(NexaWattPidController* const pid, const NexaWattPidConfig* const pidConfig)
+{
+    NexaWattControllerStatusResult retRes = NW_CONTROLLER_BAD_PARAM;
+
+    if ((pid != NULL) &&
+        (pidConfig != NULL) &&
+        (pidConfig->outMin < pidConfig->outMax))
+    {
+        pid->gains = pidConfig->gains;
+        pid->outMin = pidConfig->outMin;
+        pid->outMax = pidConfig->outMax;
+        pid->integratorFrozen = nwFalse;
+
+        NexaWatt_DigitalController_Pid_Reset(pid, 0);
+
+        retRes = NW_CONTROLLER_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattControllerStatusResult NexaWatt_DigitalController_Pid_Set_Gains(NexaWattPidController* const pid, const NexaWattPidGains* const gains)
+{
+    NexaWattControllerStatusResult retRes = NW_CONTROLLER_BAD_PARAM;
+
+    if ((pid != NULL) &&
+        (gains != NULL))
+    {
+        pid->gains = *gains;
+
+        retRes = NW_CONTROLLER_SUCCESS;
+    }
+
+    return retRes;
+}
+
+void NexaWatt_DigitalController_Pid_Reset(NexaWattPidController* const pid, const NwQ15 integratorVal)
+{
+    if (pid != NULL)
+    {
+        pid->integrator = NexaWatt_FixedPoint_Saturate(integratorVal, pid->outMin, pid->outMax);
+        pid->prevError = 0;
+    }
+}
@@ -0,0 +1,200 @@
+/*******************************************************************************
+* File Name:   digital_controller_pipeline.c
+*
+* Description: This is the source file containing definitions,
+* related to the control pipeline of the NexaWatt-IV.DC framework.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "digital_controller_pipeline.h"
+#include "platform_cycle_counter.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that records a new execution time in the timing statistics.
+ * \param timing - A pointer to the timing statistics.
+ * \param elapsedCycles - The execution time in CPU cycles.
+ */
+NW_LOCAL_INLINE void NexaWatt_DigitalController_Pipeline_Update_Timing(NexaWattPipelineTiming* timing, uint32 elapsedCycles);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattControllerStatusResult NexaWatt_DigitalController_Pipeline_Init(NexaWattControlPipeline* const pipeline, const uint32 cycleBudget)
+{
+    NexaWattControllerStatusResult retRes = NW_CONTROLLER_BAD_PARAM;
+    uint8 signalIdx = 0u;
+
+    if ((pipeline != NULL) &&
+        (cycleBudget > 0u))
+    {
+        pipeline->stageCnt = 0u;
+        pipeline->isSealed = nwFalse;
+        pipeline->cycleBudget = cycleBudget;
+        pipeline->signals.samples = NULL;
+        pipeline->signals.sampleCnt = 0u;
+
+        for (signalIdx = 0u; signalIdx < NW_PIPELINE_MAX_SIGNALS; signalIdx++)
+        {
+            pipeline->signals.measurements[signalIdx] = 0;
+        }
+
+        for (signalIdx = 0u; signalIdx < NW_PIPELINE_MAX_OUTPUTS; signalIdx++)
+        {
+            pipeline->signals.outputs[signalIdx] = 0;
+        }
+
+        NexaWatt_DigitalController_Pipeline_Reset_Timing(pipeline);
+
+        retRes = NW_CONTROLLER_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattControllerStatusResult NexaWatt_DigitalController_Pipeline_Register_Stage(NexaWattControlPipeline* const pipeline, const NexaWattPipelineStageType stageType,
+                                                                                  const NwPipelineStageFnc stageFnc, void* const stageContext)
+{
+    NexaWattControllerStatusResult retRes = NW_CONTROLLER_BAD_PARAM;
+    NexaWattPipelineStage* stage = NULL;
+
+    if ((pipeline != NULL) &&
+        (stageFnc != NULL) &&
+        (stageType <= NW_PIPELINE_STAGE_ACTUATE) &&
+        (pipeline->isSealed == nwFalse) &&
+        (pipeline->stageCnt < NW_PIPELINE_MAX_STAGES))
+    {
+        // The stages must follow the sample to actuation order
+        if ((pipeline->stageCnt == 0u) ||
+            (stageType >= pipeline->stages[pipeline->stageCnt - 1u].stageType))
+        {
+            stage = &pipeline->stages[pipeline->stageCnt];
+            stage->stageFnc = stageFnc;
+            stage->stageContext = stageContext;
+            stage->stageType = stageType;
+            stage->timing.lastCycles = 0u;
+            stage->timing.maxCycles = 0u;
+            pipeline->stageCnt++;
+
+            retRes = NW_CONTROLLER_SUCCESS;
+        }
+    }
+
+    return retRes;
+}
+
+NexaWattControllerStatusResult NexaWatt_DigitalController_Pipeline_Seal(NexaWattControlPipeline* const pipeline)
+{
+    NexaWattControllerStatusResult retRes = NW_CONTROLLER_BAD_PARAM;
+
+    // The chain must end with the PWM update, so its execution time covers the whole sample to actuation path
+    if ((pipeline != NULL) &&
+        (pipeline->stageCnt > 0u) &&
+        (pipeline->stages[pipeline->stageCnt - 1u].stageType == NW_PIPELINE_STAGE_ACTUATE))
+    {
+        pipeline->isSealed = nwTrue;
+
+        retRes = NW_CONTROLLER_SUCCESS;
+    }
+
+    return retRes;
+}
+
+nw_bool NexaWatt_DigitalController_Pipeline_Execute(NexaWattControlPipeline* const pipeline, const NwAdcSample* const samples, const uint8 sampleCnt)
+{
+    nw_bool continueChain = pipeline->isSealed;
+    NexaWattPipelineStage* stage = &pipeline->stages[0u];
+    NexaWattPipelineStage* const stagesEnd = &pipeline->stages[pipeline->stageCnt];
+    uint32 startCycles = NexaWatt_Platform_Cycle_Counter_Get();
+    uint32 stageStartCycles = startCycles;
+    uint32 stageEndCycles = 0u;
+
+    pipeline->signals.samples = samples;
+    pipeline->signals.sampleCnt = sampleCnt;
+
+    // The end of a stage is the start of the next one, so a single counter read is spent per stage
+    while ((continueChain == nwTrue) && (stage < stagesEnd))
+    {
+        continueChain = stage->stageFnc(stage->stageContext, &pipeline->signals);
+        stageEndCycles = NexaWatt_Platform_Cycle_Counter_Get();
+        NexaWatt_DigitalController_Pipeline_Update_Timing(&stage->timing, stageEndCycles - stageStartCycles);
+        stageStartCycles = stageEndCycles;
+        stage++;
+    }
+
+    NexaWatt_DigitalController_Pipeline_Update_Timing(&pipeline->totalTiming, stageStartCycles - startCycles);
+    pipeline->executionCnt++;
+    if (pipeline->totalTiming.lastCycles > pipeline->cycleBudget)
+    {
+        pipeline->overrunCnt++;
+    }
+
+    if (continueChain == nwFalse)
+    {
+        pipeline->abortCnt++;
+    }
+
+    return continueChain;
+}
+
+void NexaWatt_DigitalController_Pipeline_Reset_Timing(NexaWattControlPipeline* const pipeline)
+{
+    uint8 stageIdx = 0u;
+
+    for (stageIdx = 0u; stageIdx < pipeline->stageCnt; stageIdx++)
+    {
+        pipeline->stages[stageIdx].timing.lastCycles = 0u;
+        pipeline->stages[stageIdx].timing.maxCycles = 0u;
+    }
+
+    pipeline->totalTiming.lastCycles = 0u;
+    pipeline->totalTiming.maxCycles = 0u;
+    pipeline->executionCnt = 0u;
+    pipeline->overrunCnt = 0u;
+    pipeline->abortCnt = 0u;
+}
+
+nw_bool NexaWatt_DigitalController_Pipeline_Pid_Stage(void* const stageContext, NexaWattPipelineSignals* const signals)
+{
+    NexaWattPipelinePidStage* const pidStage = (NexaWattPipelinePidStage*)stageContext;
+    const NwQ15 output = NexaWatt_DigitalController_Pid_Step(pidStage->pid, pidStage->reference, signals->measurements[pidStage->measurementIdx]);
+
+    signals->outputs[pidStage->outputIdx] = NexaWatt_Topology_Clamp_Duty(output);
+
+    return nwTrue;
+}
+
+nw_bool NexaWatt_DigitalController_Pipeline_Npnz_Stage(void* const stageContext, NexaWattPipelineSignals* const signals)
+{
+    NexaWattPipelineNpnzStage* const npnzStage = (NexaWattPipelineNpnzStage*)stageContext;
+    const NwQ15 output = NexaWatt_DigitalController_Npnz_Step(npnzStage->npnz, npnzStage->reference, signals->measurements[npnzStage->measurementIdx]);
+
+    signals->outputs[npnzStage->outputIdx] = NexaWatt_Topology_Clamp_Duty(output);
+
+    return nwTrue;
+}
+
+NW_LOCAL_INLINE void NexaWatt_DigitalController_Pipeline_Update_Timing(NexaWattPipelineTiming* const timing, const uint32 elapsedCycles)
+{
+    timing->lastCycles = elapsedCycles;
+    timing->maxCycles = (elapsedCycles > timing->maxCycles) ? elapsedCycles : timing->maxCycles;
+}
@@ -0,0 +1,280 @@
+/*******************************************************************************
+* File Name:   digital_controller_reference.c
+*
+* Description: This is the source file containing definitions,
+* related to the reference trajectory generator of the NexaWatt-IV.DC framework.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "digital_controller_reference.h"
+#include "platform_critical_section.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Macro converting a Q15 value to the internal reference with the additional fractional bits.
+ */
+#define NW_REFERENCE_TO_POSITION(value) \
+    ((int32)(value) * ((int32)1 << NW_REFERENCE_EXT_BITS))
+
+/**
+ * \brief Fractional bits of the normalized time and of the smoothstep of the S-curve, chosen so the
+ * products of the polynomial evaluation fit into 64 bits.
+ */
+#define NW_REFERENCE_CURVE_BITS             (28u)
+
+/**
+ * \brief Fractional bits of the smoothing factor of the exponential profile.
+ */
+#define NW_REFERENCE_ALPHA_BITS             (30u)
+
+/**
+ * \brief Ratio of the peak rate to the mean rate of the quintic smoothstep (15/8).
+ */
+#define NW_REFERENCE_S_CURVE_PEAK_NUM       (15)
+#define NW_REFERENCE_S_CURVE_PEAK_DEN       (8)
+
+#define NW_REFERENCE_US_PER_SECOND          (1000000u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that evaluates the quintic smoothstep 6t^5 - 15t^4 + 10t^3 of the S-curve.
+ * \param phase - The normalized time of the move, the full range of uint32 corresponding to [0, 1).
+ * \return The progress of the move in [0, 1], with NW_REFERENCE_CURVE_BITS fractional bits.
+ */
+static int64 NexaWatt_DigitalController_Reference_Smoothstep(uint32 phase);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattControllerStatusResult NexaWatt_DigitalController_Reference_Init(NexaWattReference* const reference, const NexaWattReferenceConfig* const referenceConfig, const NwQ15 initValue)
+{
+    NexaWattControllerStatusResult retRes = NW_CONTROLLER_BAD_PARAM;
+    int64 slewStep = 0;
+    int64 expAlpha = 0;
+    nw_bool isValid = nwFalse;
+
+    if ((reference != NULL) &&
+        (referenceConfig != NULL) &&
+        (referenceConfig->sampleFreqHz > 0u) &&
+        (initValue >= NW_Q15_MIN) &&
+        (initValue <= NW_Q15_MAX))
+    {
+        if ((referenceConfig->profile == NW_REFERENCE_PROFILE_SLEW) ||
+            (referenceConfig->profile == NW_REFERENCE_PROFILE_S_CURVE))
+        {
+            // A rate below the internal resolution would never move, a rate above the full scale per sample is a step
+            slewStep = ((int64)referenceConfig->maxRate * ((int64)1 << NW_REFERENCE_EXT_BITS)) / (int64)referenceConfig->sampleFreqHz;
+            isValid = ((slewStep >= 1) && (slewStep <= (int64)NW_REFERENCE_TO_POSITION(NW_Q15_ONE))) ? nwTrue : nwFalse;
+        }
+        else if ((referenceConfig->profile == NW_REFERENCE_PROFILE_EXPONENTIAL) &&
+                 (referenceConfig->timeConstantUs > 0u))
+        {
+            // alpha = 1 - exp(-Ts / tau), approximated by 2 / (2 tau / Ts + 1), which is exact up to (Ts / tau)^3
+            expAlpha = ((int64)2 * ((int64)1 << NW_REFERENCE_ALPHA_BITS) * (int64)NW_REFERENCE_US_PER_SECOND) /
+                       (((int64)2 * (int64)referenceConfig->sampleFreqHz * (int64)referenceConfig->timeConstantUs) + (int64)NW_REFERENCE_US_PER_SECOND);
+            isValid = ((expAlpha >= 1) && (expAlpha < ((int64)1 << NW_REFERENCE_ALPHA_BITS))) ? nwTrue : nwFalse;
+        }
+
+        if (isValid == nwTrue)
+        {
+            reference->profile = referenceConfig->profile;
+            reference->slewStep = (int32)slewStep;
+            reference->expAlpha = (int32)expAlpha;
+            reference->doneHandler = referenceConfig->doneHandler;
+            reference->doneContext = referenceConfig->doneContext;
+
+            retRes = NexaWatt_DigitalController_Reference_Reset(reference, initValue);
+        }
+    }
+
+    return retRes;
+}
+
+NexaWattControllerStatusResult NexaWatt_DigitalController_Reference_Set_Target(NexaWattReference* const reference, const NwQ15 target)
+{
+    NexaWattControllerStatusResult retRes = NW_CONTROLLER_BAD_PARAM;
+    NwCriticalSectionState criticalSectionState = 0u;
+    int32 moveSpan = 0;
+    int64 moveCnt = 0;
+    int64 peakStep = 0;
+
+    if ((reference != NULL) &&
+        (target >= NW_Q15_MIN) &&
+        (target <= NW_Q15_MAX))
+    {
+        criticalSectionState = NexaWatt_Platform_Critical_Section_Enter();
+
+        reference->target = target;
+        reference->targetPosition = NW_REFERENCE_TO_POSITION(target);
+
+        if (reference->profile == NW_REFERENCE_PROFILE_S_CURVE)
+        {
+            // The number of samples is rounded up, so the peak rate stays within the rate limit
+            moveSpan = reference->targetPosition - reference->position;
+            peakStep = (int64)NW_REFERENCE_S_CURVE_PEAK_DEN * reference->slewStep;
+            moveCnt = (((int64)NW_REFERENCE_S_CURVE_PEAK_NUM * ((moveSpan < 0) ? -(int64)moveSpan : (int64)moveSpan)) + peakStep - 1) / peakStep;
+            moveCnt = (moveCnt < 1) ? 1 : moveCnt;
+
+            reference->startPosition = reference->position;
+            reference->moveSpan = moveSpan;
+            reference->phase = 0u;
+            reference->phaseStep = (moveCnt > 1) ? (uint32)(((uint64)1 << 32u) / (uint64)moveCnt) : 0u;
+            reference->remainingCnt = (uint32)moveCnt;
+        }
+
+        // The completion is detected and posted by the next step, also for a target equal to the reference
+        reference->isDone = nwFalse;
+
+        NexaWatt_Platform_Critical_Section_Exit(criticalSectionState);
+
+        retRes = NW_CONTROLLER_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattControllerStatusResult NexaWatt_DigitalController_Reference_Reset(NexaWattReference* const reference, const NwQ15 value)
+{
+    NexaWattControllerStatusResult retRes = NW_CONTROLLER_BAD_PARAM;
+    NwCriticalSectionState criticalSectionState = 0u;
+
+    if ((reference != NULL) &&
+        (value >= NW_Q15_MIN) &&
+        (value <= NW_Q15_MAX))
+    {
+        criticalSectionState = NexaWatt_Platform_Critical_Section_Enter();
+
+        reference->target = value;
+        reference->targetPosition = NW_REFERENCE_TO_POSITION(value);
+        reference->position = reference->targetPosition;
+        reference->startPosition = reference->targetPosition;
+        reference->moveSpan = 0;
+        reference->phase = 0u;
+        reference->phaseStep = 0u;
+        reference->remainingCnt = 0u;
+        reference->isDone = nwTrue;
+
+        NexaWatt_Platform_Critical_Section_Exit(criticalSectionState);
+
+        retRes = NW_CONTROLLER_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NwQ15 NexaWatt_DigitalController_Reference_Step(NexaWattReference* const reference)
+{
+    int32 position = reference->position;
+    int32 curvePosition = 0;
+    int32 error = 0;
+    int32 delta = 0;
+
+    if (reference->isDone == nwFalse)
+    {
+        error = reference->targetPosition - position;
+
+        switch (reference->profile)
+        {
+            case NW_REFERENCE_PROFILE_SLEW:
+                if (error > reference->slewStep)
+                {
+                    position += reference->slewStep;
+                }
+                else if (error < -reference->slewStep)
+                {
+                    position -= reference->slewStep;
+                }
+                else
+                {
+                    position = reference->targetPosition;
+                }
+                break;
+
+            case NW_REFERENCE_PROFILE_S_CURVE:
+                reference->remainingCnt--;
+                if (reference->remainingCnt == 0u)
+                {
+                    position = reference->targetPosition;
+                }
+                else
+                {
+                    reference->phase += reference->phaseStep;
+                    curvePosition = reference->startPosition +
+                                    (int32)(((int64)reference->moveSpan * NexaWatt_DigitalController_Reference_Smoothstep(reference->phase)) >> NW_REFERENCE_CURVE_BITS);
+
+                    // The rounding of the polynomial must not move the reference backwards
+                    if (((reference->moveSpan > 0) && (curvePosition > position)) ||
+                        ((reference->moveSpan < 0) && (curvePosition < position)))
+                    {
+                        position = curvePosition;
+                    }
+                }
+                break;
+
+            case NW_REFERENCE_PROFILE_EXPONENTIAL:
+                if ((error < ((int32)1 << NW_REFERENCE_EXT_BITS)) &&
+                    (error > -((int32)1 << NW_REFERENCE_EXT_BITS)))
+                {
+                    // The last Q15 step is taken at once, so the approach ends in a finite time
+                    position = reference->targetPosition;
+                }
+                else
+                {
+                    // The shift rounds toward minus infinity, so only a positive error can stall on a small alpha
+                    delta = (int32)(((int64)error * reference->expAlpha) >> NW_REFERENCE_ALPHA_BITS);
+                    position += (delta != 0) ? delta : 1;
+                }
+                break;
+
+            default:
+                position = reference->targetPosition;
+                break;
+        }
+
+        reference->position = position;
+
+        if (position == reference->targetPosition)
+        {
+            reference->isDone = nwTrue;
+            if (reference->doneHandler != NULL)
+            {
+                (void)NexaWatt_MiniOs_Event_Post(reference->doneHandler, reference->doneContext, (uint32)reference->target);
+            }
+        }
+    }
+
+    return (NwQ15)(position >> NW_REFERENCE_EXT_BITS);
+}
+
+static int64 NexaWatt_DigitalController_Reference_Smoothstep(const uint32 phase)
+{
+    const int64 one = (int64)1 << NW_REFERENCE_CURVE_BITS;
+    const int64 time = (int64)(phase >> (32u - NW_REFERENCE_CURVE_BITS));
+    int64 progress = 0;
+
+    // Horner scheme of t^3 (10 + t (6t - 15)); the intermediate values stay below 16 in magnitude
+    progress = (6 * time) - (15 * one);
+    progress = ((progress * time) >> NW_REFERENCE_CURVE_BITS) + (10 * one);
+    progress = (progress * time) >> NW_REFERENCE_CURVE_BITS;
+    progress = (progress * time) >> NW_REFERENCE_CURVE_BITS;
+    progress = (progress * time) >> NW_REFERENCE_CURVE_BITS;
+
+    return progress;
+}
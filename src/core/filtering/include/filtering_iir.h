@@ -0,0 +1,121 @@
+/*******************************************************************************
+* File Name:   filtering_iir.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the IIR filters of the NexaWatt-IV.DC framework. The filters are
+* executed in fixed point and are intended to be used in the control path,
+* hence the step functions are provided as inline functions.
+* A filter is registered as a filter stage of the control pipeline through its adapter:
+* NexaWatt_DigitalController_Pipeline_Register_Stage(&pipeline, NW_PIPELINE_STAGE_FILTER, NexaWatt_Filtering_Iir1_Pipeline_Stage, &filterStage);
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_FILTERING_IIR_H
+#define NEXAWATT_IV_DC_FILTERING_IIR_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+#include "platform_fixed_point.h"
+#include "digital_controller_pipeline.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+typedef enum eNexaWattFilterStatusResult
+{
+    NW_FILTER_SUCCESS   = 0u,
+    NW_FILTER_BAD_PARAM = 1u,
+} NexaWattFilterStatusResult;
+
+/**
+ * \brief First order low-pass IIR filter: y[n] = y[n-1] + alpha * (x[n] - y[n-1]).
+ * The filter state is kept in Q31 (Q15 signal shifted by 16 bits) to avoid
+ * the truncation dead-band of small smoothing factors.
+ */
+typedef struct sNexaWattFilterIir1
+{
+    NwQ16 alpha;
+    int64 state;
+} NexaWattFilterIir1;
+
+/**
+ * \brief Context of a filter stage: the filter replaces a measurement of the pipeline by its filtered value.
+ */
+typedef struct sNexaWattFilterIir1Stage
+{
+    NexaWattFilterIir1* filter;
+    uint8 measurementIdx;
+} NexaWattFilterIir1Stage;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Function used to initialize a first order low-pass IIR filter.
+ * The smoothing factor can be calculated as alpha = Ts / (tau + Ts), where Ts is the sample period
+ * and tau the desired time constant of the filter.
+ * \param filter - A pointer to the filter instance to be initialized.
+ * \param alpha - The smoothing factor of the filter in Q16.16 format. Must be in the range (0, 1].
+ * \param initVal - The initial output value of the filter, in Q15 format.
+ * \return NW_FILTER_BAD_PARAM - The filter pointer is NULL or the smoothing factor is out of range.
+ * \return NW_FILTER_SUCCESS - The filter is initialized and ready for use.
+ */
+NexaWattFilterStatusResult NexaWatt_Filtering_Iir1_Init(NexaWattFilterIir1* filter, NwQ16 alpha, NwQ15 initVal);
+
+/**
+ * \brief Function used to reset the output of an already initialized first order low-pass IIR filter.
+ * \param filter - A pointer to the filter instance.
+ * \param resetVal - The new output value of the filter, in Q15 format.
+ */
+void NexaWatt_Filtering_Iir1_Reset(NexaWattFilterIir1* filter, NwQ15 resetVal);
+
+/**
+ * \brief Filter stage of the control pipeline, filtering a measurement in place. The index is not validated.
+ * \param stageContext - A pointer to the filter stage context.
+ * \param signals - The signals of the pipeline.
+ * \return nwTrue - Always, the chain continues.
+ */
+nw_bool NexaWatt_Filtering_Iir1_Pipeline_Stage(void* stageContext, NexaWattPipelineSignals* signals);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/**
+ * \brief Executes a single step of the first order low-pass IIR filter.
+ * The function performs no validation and is intended to be executed in the control ISR.
+ * \param filter - A pointer to an initialized filter instance.
+ * \param input - The new input sample in Q15 format.
+ * \return The filtered output in Q15 format.
+ */
+NW_LOCAL_INLINE NwQ15 NexaWatt_Filtering_Iir1_Step(NexaWattFilterIir1* const filter, const NwQ15 input)
+{
+    int64 inputScaled = ((int64)input) << NW_Q16_FRAC_BITS;
+
+    filter->state += ((inputScaled - filter->state) * (int64)filter->alpha) >> NW_Q16_FRAC_BITS;
+
+    return (NwQ15)(filter->state >> NW_Q16_FRAC_BITS);
+}
+
+/**
+ * \brief Returns the last output of the first order low-pass IIR filter, without executing a step.
+ * \param filter - A pointer to an initialized filter instance.
+ * \return The last filtered output in Q15 format.
+ */
+NW_LOCAL_INLINE NwQ15 NexaWatt_Filtering_Iir1_Get_Output(const NexaWattFilterIir1* const filter)
+{
+    return (NwQ15)(filter->state >> NW_Q16_FRAC_BITS);
+}
+
+#endif
@@ -0,0 +1,68 @@
+/*******************************************************************************
+* File Name:   filtering_iir.c
+*
+* Description: This is the source file containing definitions,
+* related to the IIR filters of the NexaWatt-IV.DC framework.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "filtering_iir.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattFilterStatusResult NexaWatt_Filtering_Iir1_Init(NexaWattFilterIir1* const filter, const NwQ16 alpha, const NwQ15 initVal)
+{
+    NexaWattFilterStatusResult retRes = NW_FILTER_BAD_PARAM;
+
+    if ((filter != NULL) &&
+        (alpha > 0) &&
+        (alpha <= NW_Q16_ONE))
+    {
+        filter->alpha = alpha;
+        filter->state = ((int64)initVal) << NW_Q16_FRAC_BITS;
+
+        retRes = NW_FILTER_SUCCESS;
+    }
+
+    return retRes;
+}
+
+void NexaWatt_Filtering_Iir1_Reset(NexaWattFilterIir1* const filter, const NwQ15 resetVal)
+{
+    if (filter != NULL)
+    {
+        filter->state = ((int64)resetVal) << NW_Q16_FRAC_BITS;
+    }
+}
+
+nw_bool NexaWatt_Filtering_Iir1_Pipeline_Stage(void* const stageContext, NexaWattPipelineSignals* const signals)
+{
+    NexaWattFilterIir1Stage* const filterStage = (NexaWattFilterIir1Stage*)stageContext;
+
+    signals->measurements[filterStage->measurementIdx] =
+            NexaWatt_Filtering_Iir1_Step(filterStage->filter, signals->measurements[filterStage->measurementIdx]);
+
+    return nwTrue;
+}
@@ -0,0 +1,177 @@
+/*******************************************************************************
+* File Name:   hal_manager.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the HAL Manager of the NexaWatt-IV.DC framework. The HAL Manager
+* brings up a board from a single constant board description: the HAL Context
+* bindings, the GPIO pins, the EXTIs, the PWM channels and the ADC sequence.
+* The whole description is validated once, before any peripheral is touched,
+* and the pins are applied grouped per port, so every GPIO port register is
+* written once. On failure the report identifies the section and the index of
+* the offending entry.
+* Typical usage at the start of main():
+* NexaWatt_HalManager_Apply_Board(&boardDescription, &boardReport);
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_HAL_MANAGER_H
+#define NEXAWATT_IV_DC_HAL_MANAGER_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+#include "hal_context.h"
+#include "hal_wrapper_adc.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Entry index reported, when the failure is not related to a single entry.
+ */
+#define NW_HAL_MANAGER_NO_ENTRY         (0xFFu)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+/**
+ * \brief HAL Context binding of the board description. The function type is a
+ * NexaWattHalContextInitFunctionTypes value for init functions and a NexaWattHalContextFunctionTypes value otherwise.
+ */
+typedef struct sNexaWattBoardBinding
+{
+    nw_bool isInitFunction;
+    uint8 functionType;
+    NexaWattHalContextFunction function;
+} NexaWattBoardBinding;
+
+typedef struct sNexaWattBoardPin
+{
+    uint8 portNum;
+    uint8 pinNum;
+    NexaWattGPIOPinConfig pinConfig;
+} NexaWattBoardPin;
+
+/**
+ * \brief EXTI of the board description. The pin must be listed as input in the pins of the description.
+ */
+typedef struct sNexaWattBoardExti
+{
+    uint8 portNum;
+    uint8 pinNum;
+    NexaWattGPIOExtIRQConfig extiConfig;
+} NexaWattBoardExti;
+
+typedef struct sNexaWattBoardPwmChannel
+{
+    uint8 channel;
+    NexaWattPWMChannelConfig channelConfig;
+} NexaWattBoardPwmChannel;
+
+/**
+ * \brief ADC sequence of the board description. A PWM trigger channel must be listed in the PWM channels of the description.
+ */
+typedef struct sNexaWattBoardAdcSequence
+{
+    NexaWattADCSequenceConfig sequenceConfig;
+    NwAdcFrameCallback frameCallback;
+} NexaWattBoardAdcSequence;
+
+/**
+ * \brief Board description. Every section is an array with its number of entries; unused sections are NULL with 0 entries.
+ */
+typedef struct sNexaWattBoardDescription
+{
+    const NexaWattBoardBinding* bindings;
+    uint8 bindingCnt;
+    const NexaWattBoardPin* pins;
+    uint8 pinCnt;
+    const NexaWattBoardExti* extis;
+    uint8 extiCnt;
+    const NexaWattBoardPwmChannel* pwmChannels;
+    uint8 pwmChannelCnt;
+    const NexaWattBoardAdcSequence* adcSequence;
+} NexaWattBoardDescription;
+
+typedef enum eNexaWattBoardSection
+{
+    NW_BOARD_SECTION_NONE       = 0x00u,
+    NW_BOARD_SECTION_BINDINGS   = 0x01u,
+    NW_BOARD_SECTION_PINS       = 0x02u,
+    NW_BOARD_SECTION_EXTIS      = 0x03u,
+    NW_BOARD_SECTION_PWM        = 0x04u,
+    NW_BOARD_SECTION_ADC        = 0x05u,
+} NexaWattBoardSection;
+
+typedef enum eNexaWattBoardFailureReason
+{
+    NW_BOARD_FAILURE_NONE               = 0x00u,
+    NW_BOARD_FAILURE_INVALID_PARAM      = 0x01u,
+    NW_BOARD_FAILURE_DUPLICATE          = 0x02u,
+    NW_BOARD_FAILURE_MISSING_BINDING    = 0x03u,
+    NW_BOARD_FAILURE_MISSING_PIN        = 0x04u,
+    NW_BOARD_FAILURE_MISSING_PWM        = 0x05u,
+    NW_BOARD_FAILURE_HAL_ERROR          = 0x06u,
+    NW_BOARD_FAILURE_RESOURCE_CONFLICT  = 0x07u,
+} NexaWattBoardFailureReason;
+
+/**
+ * \brief Report of the board validation and application. On failure, the section, the index of the entry
+ * within the section and the reason identify the offending entry; for HAL errors the status returned by the HAL is kept.
+ * Resources already claimed in the resource registry (e.g. by a module initialized before the board) are reported as conflicts.
+ * The applyCycles contain the CPU cycles spent by the application of the board, for the boot time measurements.
+ */
+typedef struct sNexaWattBoardReport
+{
+    NexaWattBoardSection section;
+    uint8 entryIdx;
+    NexaWattBoardFailureReason reason;
+    NwGenericReturnType halStatus;
+    uint32 applyCycles;
+} NexaWattBoardReport;
+
+typedef enum eNexaWattHalManagerStatusResult
+{
+    NW_HAL_MANAGER_SUCCESS          = 0u,
+    NW_HAL_MANAGER_INVALID_ENTRY    = 1u,
+    NW_HAL_MANAGER_APPLY_FAILED     = 2u,
+} NexaWattHalManagerStatusResult;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Function used to validate a board description without touching the HAL Context or the peripherals.
+ * The entries are checked for valid values, duplicates, references to pins and PWM channels of the description,
+ * and for the bindings needed by the used sections.
+ * \param board - A pointer to the board description.
+ * \param report - A pointer to the report, populated by the function.
+ * \return NW_HAL_MANAGER_INVALID_ENTRY - An entry of the description is invalid. See the report.
+ * \return NW_HAL_MANAGER_SUCCESS - The board description is valid.
+ */
+NexaWattHalManagerStatusResult NexaWatt_HalManager_Validate_Board(const NexaWattBoardDescription* board, NexaWattBoardReport* report);
+
+/**
+ * \brief Function used to validate and apply a board description. The HAL Context is initialized and bound,
+ * then the pins are initialized per port, followed by the EXTIs, the PWM channels and the ADC sequence.
+ * Nothing is applied, if the validation fails. The application stops at the first failing entry.
+ * \param board - A pointer to the board description.
+ * \param report - A pointer to the report, populated by the function.
+ * \return NW_HAL_MANAGER_INVALID_ENTRY - An entry of the description is invalid. Nothing is applied. See the report.
+ * \return NW_HAL_MANAGER_APPLY_FAILED - The HAL Context or the HAL rejected an entry. See the report.
+ * \return NW_HAL_MANAGER_SUCCESS - The board is applied.
+ */
+NexaWattHalManagerStatusResult NexaWatt_HalManager_Apply_Board(const NexaWattBoardDescription* board, NexaWattBoardReport* report);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+#endif
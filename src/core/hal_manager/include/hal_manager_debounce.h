@@ -0,0 +1,169 @@
+/*******************************************************************************
+* File Name:   hal_manager_debounce.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the input debounce of the HAL Manager. The debounce filters the
+* contact bounce and the glitches of the digital inputs (buttons, enable and
+* fault inputs) and reports the changes of their stable state.
+* The pins of a port are debounced together by a vertical counter: every pin has
+* a 2-bit counter, whose bits are stored in two bytes per port, so a single pass
+* of a few bitwise operations updates all pins of the port. A pin changes its
+* stable state, when it is sampled NW_DEBOUNCE_SAMPLE_CNT times in a row at the
+* new level; a shorter pulse resets its counter.
+* The ports are sampled by NexaWatt_HalManager_Debounce_Process(), periodically
+* called from the main loop, once per sample period of the mini OS time base.
+* A port registered with the EXTI edges is sampled only after an edge notified by
+* its EXTI ISR and until its counters settle, so idle inputs cost no port reads.
+* The changes of the stable state are posted as deferred events (see nexa_mini_os_event.h).
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_HAL_MANAGER_DEBOUNCE_H
+#define NEXAWATT_IV_DC_HAL_MANAGER_DEBOUNCE_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+#include "nexa_mini_os_event.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Maximum number of debounced ports.
+ */
+#define NW_DEBOUNCE_MAX_PORTS               (4u)
+
+/**
+ * \brief Number of consecutive samples at the new level, required to change the stable state of a pin.
+ * Given by the 2-bit vertical counter. The debounce time is NW_DEBOUNCE_SAMPLE_CNT sample periods.
+ */
+#define NW_DEBOUNCE_SAMPLE_CNT              (4u)
+
+/**
+ * \brief Macros packing and unpacking the argument of the state change events:
+ * the port number, the mask of the changed pins and the new stable state of the port.
+ */
+#define NW_DEBOUNCE_EVENT_ARG(portNum, changedMask, stableState) \
+    ((((uint32)(portNum)) << 16u) | (((uint32)(changedMask)) << 8u) | ((uint32)(stableState)))
+#define NW_DEBOUNCE_EVENT_GET_PORT(eventArg) \
+    ((uint8)((eventArg) >> 16u))
+#define NW_DEBOUNCE_EVENT_GET_CHANGED(eventArg) \
+    ((uint8)((eventArg) >> 8u))
+#define NW_DEBOUNCE_EVENT_GET_STATE(eventArg) \
+    ((uint8)(eventArg))
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+typedef enum eNexaWattDebounceStatusResult
+{
+    NW_DEBOUNCE_SUCCESS     = 0u,
+    NW_DEBOUNCE_BAD_PARAM   = 1u,
+    NW_DEBOUNCE_FULL        = 2u,
+} NexaWattDebounceStatusResult;
+
+/**
+ * \brief Vertical counter of a port. Bit n of the counter bytes is the counter of pin n.
+ * A counter at rest (no change in progress) has both bits set.
+ */
+typedef struct sNexaWattDebounceCounter
+{
+    uint8 pinMask;
+    uint8 stableState;
+    uint8 counterBit0;
+    uint8 counterBit1;
+} NexaWattDebounceCounter;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Function used to initialize the debounce. All ports are removed.
+ * \param samplePeriodUs - The sample period in microseconds of the mini OS time base.
+ * \return NW_DEBOUNCE_BAD_PARAM - The sample period is 0.
+ * \return NW_DEBOUNCE_SUCCESS - The debounce is initialized.
+ */
+NexaWattDebounceStatusResult NexaWatt_HalManager_Debounce_Init(uint32 samplePeriodUs);
+
+/**
+ * \brief Function used to add the pins of a port to the debounce. The pins must be configured as inputs.
+ * The current levels of the pins are taken as their stable state.
+ * \param portNum - The number of the GPIO port.
+ * \param pinMask - The mask of the debounced pins.
+ * \param useExtiEdges - nwTrue, if the EXTI ISR of the port notifies the edges of all debounced pins (both edges must be enabled).
+ * nwFalse to sample the port every sample period.
+ * \param changeHandler - The handler of the state change events. Can be NULL, if the state is polled.
+ * \param changeContext - The context passed to the handler.
+ * \return NW_DEBOUNCE_BAD_PARAM - The port number or the pin mask is invalid, or the port is already added.
+ * \return NW_DEBOUNCE_FULL - NW_DEBOUNCE_MAX_PORTS ports are already added.
+ * \return NW_DEBOUNCE_SUCCESS - The pins are debounced.
+ */
+NexaWattDebounceStatusResult NexaWatt_HalManager_Debounce_Add_Port(uint8 portNum, uint8 pinMask, nw_bool useExtiEdges,
+                                                                   NwMiniOsEventHandler changeHandler, void* changeContext);
+
+/**
+ * \brief Function used by the EXTI ISR to notify an edge on a debounced pin. The port is sampled from the next sample period on.
+ * The function performs no validation of the pin and can be used in interrupt context.
+ * \param portNum - The number of the GPIO port.
+ * \param pinNum - The number of the GPIO pin.
+ */
+void NexaWatt_HalManager_Debounce_Notify_Edge(uint8 portNum, uint8 pinNum);
+
+/**
+ * \brief Function executing the periodic pass of the debounce. To be called from the main loop, at least once per sample period.
+ * The ports are sampled, if the sample period elapsed since the last pass, and the state changes are posted as events.
+ * \return The number of posted state change events.
+ */
+uint32 NexaWatt_HalManager_Debounce_Process(void);
+
+/**
+ * \brief Function used to obtain the stable state of the debounced pins of a port.
+ * \param portNum - The number of the GPIO port.
+ * \return The stable state, bit n corresponding to pin n. 0 for a port, which is not debounced.
+ */
+uint8 NexaWatt_HalManager_Debounce_Get_State(uint8 portNum);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/**
+ * \brief Executes a single pass of the vertical counter of a port.
+ * The counters of the pins at their stable level are reset; the others are decremented and, on the
+ * NW_DEBOUNCE_SAMPLE_CNT-th sample in a row, the stable state of the pin is toggled.
+ * \param counter - A pointer to the vertical counter of the port.
+ * \param portLevels - The sampled levels of the port pins.
+ * \return The mask of the pins, whose stable state changed.
+ */
+NW_LOCAL_INLINE uint8 NexaWatt_HalManager_Debounce_Step(NexaWattDebounceCounter* const counter, const uint8 portLevels)
+{
+    uint8 deltaMask = (uint8)((portLevels ^ counter->stableState) & counter->pinMask);
+    uint8 changedMask = 0u;
+
+    counter->counterBit0 = (uint8)~(counter->counterBit0 & deltaMask);
+    counter->counterBit1 = (uint8)(counter->counterBit0 ^ (counter->counterBit1 & deltaMask));
+    changedMask = (uint8)(deltaMask & counter->counterBit0 & counter->counterBit1);
+    counter->stableState ^= changedMask;
+
+    return changedMask;
+}
+
+/**
+ * \brief Checks whether the counters of all pins of a port are at rest, i.e. no change is in progress.
+ * \param counter - A pointer to the vertical counter of the port.
+ * \return nwTrue - All counters are at rest.
+ * \return nwFalse - A change of at least one pin is in progress.
+ */
+NW_LOCAL_INLINE nw_bool NexaWatt_HalManager_Debounce_Is_Settled(const NexaWattDebounceCounter* const counter)
+{
+    return ((counter->counterBit0 & counter->counterBit1 & counter->pinMask) == counter->pinMask);
+}
+
+#endif
@@ -0,0 +1,151 @@
+/*******************************************************************************
+* File Name:   hal_manager_resources.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the resource registry of the HAL Manager. The registry keeps track
+* of the GPIO pins, the EXTIs and the System Interrupt sources claimed by the
+* framework, so a resource cannot be configured twice. The claims are stored
+* in bitmaps (one byte per port for the pins and the EXTIs, one bit per interrupt
+* source), so every claim, release and query is a single bitmap operation.
+* The GPIO HAL Wrapper claims the pins and the EXTIs, the System Interrupt HAL
+* implementations claim the interrupt sources. The registry can be queried at runtime,
+* e.g. by the debug interface.
+* Note: The registry is not reentrant. Claims and releases are intended for the
+* initialization and de-initialization, not for the interrupt context.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_HAL_MANAGER_RESOURCES_H
+#define NEXAWATT_IV_DC_HAL_MANAGER_RESOURCES_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Maximum number of GPIO ports tracked by the registry.
+ */
+#define NW_RESOURCE_MAX_PORTS               (16u)
+
+/**
+ * \brief Maximum number of System Interrupt sources tracked by the registry.
+ */
+#define NW_RESOURCE_MAX_IRQ_SOURCES         (256u)
+
+/**
+ * \brief Macro returning the pin mask corresponding to a GPIO port pin. Non-existing pins result in an empty mask.
+ */
+#define NW_RESOURCE_PIN_MASK(pinNum) \
+    ((uint8)(0x01u << (pinNum)))
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+typedef enum eNexaWattResourceStatusResult
+{
+    NW_RESOURCE_SUCCESS     = 0u,
+    NW_RESOURCE_BAD_PARAM   = 1u,
+    NW_RESOURCE_CONFLICT    = 2u,
+} NexaWattResourceStatusResult;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Function used to release all resources. The registry is empty at startup, so the function is only
+ * needed for a repeated bring-up of the board.
+ */
+void NexaWatt_HalManager_Resources_Reset(void);
+
+/**
+ * \brief Function used to claim GPIO pins. Either all pins of the mask are claimed or none.
+ * \param portNum - The number of the GPIO port.
+ * \param pinMask - The mask of the claimed pins (bit n selects pin n).
+ * \return NW_RESOURCE_BAD_PARAM - The port number is out of range or the mask is empty.
+ * \return NW_RESOURCE_CONFLICT - At least one of the pins is already claimed. Nothing is claimed.
+ * \return NW_RESOURCE_SUCCESS - The pins are claimed.
+ */
+NexaWattResourceStatusResult NexaWatt_HalManager_Resources_Claim_Pins(uint8 portNum, uint8 pinMask);
+
+/**
+ * \brief Function used to release GPIO pins. Releasing pins, which are not claimed, has no effect.
+ * \param portNum - The number of the GPIO port.
+ * \param pinMask - The mask of the released pins (bit n selects pin n).
+ * \return NW_RESOURCE_BAD_PARAM - The port number is out of range.
+ * \return NW_RESOURCE_SUCCESS - The pins are released.
+ */
+NexaWattResourceStatusResult NexaWatt_HalManager_Resources_Release_Pins(uint8 portNum, uint8 pinMask);
+
+/**
+ * \brief Function used to claim the EXTIs of GPIO pins. Either all EXTIs of the mask are claimed or none.
+ * \param portNum - The number of the GPIO port.
+ * \param pinMask - The mask of the pins, whose EXTIs are claimed.
+ * \return NW_RESOURCE_BAD_PARAM - The port number is out of range or the mask is empty.
+ * \return NW_RESOURCE_CONFLICT - At least one of the EXTIs is already claimed. Nothing is claimed.
+ * \return NW_RESOURCE_SUCCESS - The EXTIs are claimed.
+ */
+NexaWattResourceStatusResult NexaWatt_HalManager_Resources_Claim_Extis(uint8 portNum, uint8 pinMask);
+
+/**
+ * \brief Function used to release the EXTIs of GPIO pins.
+ * \param portNum - The number of the GPIO port.
+ * \param pinMask - The mask of the pins, whose EXTIs are released.
+ * \return NW_RESOURCE_BAD_PARAM - The port number is out of range.
+ * \return NW_RESOURCE_SUCCESS - The EXTIs are released.
+ */
+NexaWattResourceStatusResult NexaWatt_HalManager_Resources_Release_Extis(uint8 portNum, uint8 pinMask);
+
+/**
+ * \brief Function used to claim a System Interrupt source.
+ * \param intrSource - The number of the System Interrupt source.
+ * \return NW_RESOURCE_BAD_PARAM - The interrupt source is out of range.
+ * \return NW_RESOURCE_CONFLICT - The interrupt source is already claimed.
+ * \return NW_RESOURCE_SUCCESS - The interrupt source is claimed.
+ */
+NexaWattResourceStatusResult NexaWatt_HalManager_Resources_Claim_Irq(uint32 intrSource);
+
+/**
+ * \brief Function used to release a System Interrupt source.
+ * \param intrSource - The number of the System Interrupt source.
+ * \return NW_RESOURCE_BAD_PARAM - The interrupt source is out of range.
+ * \return NW_RESOURCE_SUCCESS - The interrupt source is released.
+ */
+NexaWattResourceStatusResult NexaWatt_HalManager_Resources_Release_Irq(uint32 intrSource);
+
+/**
+ * \brief Returns the mask of the claimed pins of a GPIO port.
+ * \param portNum - The number of the GPIO port.
+ * \return The mask of the claimed pins. 0 for ports out of range.
+ */
+uint8 NexaWatt_HalManager_Resources_Get_Claimed_Pins(uint8 portNum);
+
+/**
+ * \brief Returns the mask of the pins of a GPIO port, whose EXTIs are claimed.
+ * \param portNum - The number of the GPIO port.
+ * \return The mask of the claimed EXTIs. 0 for ports out of range.
+ */
+uint8 NexaWatt_HalManager_Resources_Get_Claimed_Extis(uint8 portNum);
+
+/**
+ * \brief Returns whether a System Interrupt source is claimed.
+ * \param intrSource - The number of the System Interrupt source.
+ * \return nwTrue - The interrupt source is claimed.
+ * \return nwFalse - The interrupt source is free or out of range.
+ */
+nw_bool NexaWatt_HalManager_Resources_Is_Irq_Claimed(uint32 intrSource);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+#endif
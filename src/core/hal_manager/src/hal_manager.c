@@ -0,0 +1,489 @@
+/*******************************************************************************
+* File Name:   hal_manager.c
+*
+* Description: This is the source file containing definitions,
+* related to the HAL Manager of the NexaWatt-IV.DC framework.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "hal_manager.h"
+#include "hal_context_bind.h"
+#include "hal_wrapper_gpio.h"
+#include "hal_wrapper_pwm.h"
+#include "platform_cycle_counter.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that records the outcome in the report.
+ * \param report - A pointer to the report.
+ * \param section - The section of the entry.
+ * \param entryIdx - The index of the entry within the section.
+ * \param reason - The reason of the failure.
+ * \param halStatus - The status returned by the HAL Context or the HAL Wrapper.
+ */
+NW_LOCAL_INLINE void NexaWatt_HalManager_Set_Report(NexaWattBoardReport* report, NexaWattBoardSection section, uint8 entryIdx,
+                                                    NexaWattBoardFailureReason reason, NwGenericReturnType halStatus);
+
+/**
+ * \brief Simple helper function that checks whether a HAL function type is bound by the board description.
+ * \param board - A pointer to the board description.
+ * \param isInitFunction - nwTrue for the HAL Init function types.
+ * \param functionType - The HAL function type.
+ * \return nwTrue - The function type is bound.
+ * \return nwFalse - The function type is not bound.
+ */
+static nw_bool NexaWatt_HalManager_Is_Bound(const NexaWattBoardDescription* board, nw_bool isInitFunction, uint8 functionType);
+
+/**
+ * \brief Simple helper function that searches a pin in the first entries of the pin section.
+ * \param board - A pointer to the board description.
+ * \param portNum - The number of the GPIO port.
+ * \param pinNum - The number of the GPIO port pin.
+ * \param searchCnt - The number of entries to be searched.
+ * \return The index of the pin entry or NW_HAL_MANAGER_NO_ENTRY, if the pin is not found.
+ */
+static uint8 NexaWatt_HalManager_Find_Pin(const NexaWattBoardDescription* board, uint8 portNum, uint8 pinNum, uint8 searchCnt);
+
+/**
+ * \brief Simple helper functions that validate a section of the board description.
+ * \param board - A pointer to the board description.
+ * \param report - A pointer to the report, populated on failure.
+ * \return nwTrue - The section is valid.
+ * \return nwFalse - The section contains an invalid entry.
+ */
+static nw_bool NexaWatt_HalManager_Validate_Bindings(const NexaWattBoardDescription* board, NexaWattBoardReport* report);
+static nw_bool NexaWatt_HalManager_Validate_Pins(const NexaWattBoardDescription* board, NexaWattBoardReport* report);
+static nw_bool NexaWatt_HalManager_Validate_Extis(const NexaWattBoardDescription* board, NexaWattBoardReport* report);
+static nw_bool NexaWatt_HalManager_Validate_Pwm_Channels(const NexaWattBoardDescription* board, NexaWattBoardReport* report);
+static nw_bool NexaWatt_HalManager_Validate_Adc_Sequence(const NexaWattBoardDescription* board, NexaWattBoardReport* report);
+
+/**
+ * \brief Simple helper function that initializes the pins of the board description, grouped per port.
+ * The ports are initialized in the order of their first appearance in the pin section.
+ * \param board - A pointer to a validated board description.
+ * \param report - A pointer to the report, populated on failure with the first pin entry of the failing port.
+ * \return nwTrue - All pins are initialized.
+ * \return nwFalse - The initialization of a port failed.
+ */
+static nw_bool NexaWatt_HalManager_Apply_Pins(const NexaWattBoardDescription* board, NexaWattBoardReport* report);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattHalManagerStatusResult NexaWatt_HalManager_Validate_Board(const NexaWattBoardDescription* const board, NexaWattBoardReport* const report)
+{
+    NexaWattHalManagerStatusResult retRes = NW_HAL_MANAGER_INVALID_ENTRY;
+
+    if (report != NULL)
+    {
+        NexaWatt_HalManager_Set_Report(report, NW_BOARD_SECTION_NONE, NW_HAL_MANAGER_NO_ENTRY, NW_BOARD_FAILURE_INVALID_PARAM, 0u);
+        report->applyCycles = 0u;
+
+        // The sections are validated in the order of their application, so the first invalid entry is reported
+        if ((board != NULL) &&
+            (NexaWatt_HalManager_Validate_Bindings(board, report) == nwTrue) &&
+            (NexaWatt_HalManager_Validate_Pins(board, report) == nwTrue) &&
+            (NexaWatt_HalManager_Validate_Extis(board, report) == nwTrue) &&
+            (NexaWatt_HalManager_Validate_Pwm_Channels(board, report) == nwTrue) &&
+            (NexaWatt_HalManager_Validate_Adc_Sequence(board, report) == nwTrue))
+        {
+            NexaWatt_HalManager_Set_Report(report, NW_BOARD_SECTION_NONE, NW_HAL_MANAGER_NO_ENTRY, NW_BOARD_FAILURE_NONE, 0u);
+
+            retRes = NW_HAL_MANAGER_SUCCESS;
+        }
+    }
+
+    return retRes;
+}
+
+NexaWattHalManagerStatusResult NexaWatt_HalManager_Apply_Board(const NexaWattBoardDescription* const board, NexaWattBoardReport* const report)
+{
+    NexaWattHalManagerStatusResult retRes = NexaWatt_HalManager_Validate_Board(board, report);
+    NwGenericReturnType halStatus = 0u;
+    nw_bool applyRes = nwTrue;
+    uint32 startCycles = 0u;
+    uint8 entryIdx = 0u;
+
+    if (retRes == NW_HAL_MANAGER_SUCCESS)
+    {
+        startCycles = NexaWatt_Platform_Cycle_Counter_Get();
+
+        NexaWatt_HalContext_Init();
+
+        for (entryIdx = 0u; (entryIdx < board->bindingCnt) && (applyRes == nwTrue); entryIdx++)
+        {
+            const NexaWattBoardBinding* const binding = &board->bindings[entryIdx];
+            halStatus = (binding->isInitFunction == nwTrue) ?
+                        NexaWatt_HalContext_Bind_Init_Function((NexaWattHalContextInitFunctionTypes)binding->functionType, &binding->function) :
+                        NexaWatt_HalContext_Bind_Function((NexaWattHalContextFunctionTypes)binding->functionType, &binding->function);
+            if (halStatus != NW_HAL_CONTEXT_OK)
+            {
+                NexaWatt_HalManager_Set_Report(report, NW_BOARD_SECTION_BINDINGS, entryIdx, NW_BOARD_FAILURE_HAL_ERROR, halStatus);
+                applyRes = nwFalse;
+            }
+        }
+
+        if (applyRes == nwTrue)
+        {
+            applyRes = NexaWatt_HalManager_Apply_Pins(board, report);
+        }
+
+        for (entryIdx = 0u; (entryIdx < board->extiCnt) && (applyRes == nwTrue); entryIdx++)
+        {
+            const NexaWattBoardExti* const exti = &board->extis[entryIdx];
+            halStatus = NexaWatt_HalWrapperGpio_Register_EXTI(exti->portNum, exti->pinNum, &exti->extiConfig);
+            if (halStatus != NW_GPIO_SUCCESS)
+            {
+                NexaWatt_HalManager_Set_Report(report, NW_BOARD_SECTION_EXTIS, entryIdx,
+                                               (halStatus == NW_GPIO_RESOURCE_CONFLICT) ? NW_BOARD_FAILURE_RESOURCE_CONFLICT : NW_BOARD_FAILURE_HAL_ERROR,
+                                               halStatus);
+                applyRes = nwFalse;
+            }
+        }
+
+        for (entryIdx = 0u; (entryIdx < board->pwmChannelCnt) && (applyRes == nwTrue); entryIdx++)
+        {
+            const NexaWattBoardPwmChannel* const pwmChannel = &board->pwmChannels[entryIdx];
+            halStatus = NexaWatt_HalWrapperPwm_Init_Channel(pwmChannel->channel, &pwmChannel->channelConfig);
+            if (halStatus != NW_PWM_SUCCESS)
+            {
+                NexaWatt_HalManager_Set_Report(report, NW_BOARD_SECTION_PWM, entryIdx, NW_BOARD_FAILURE_HAL_ERROR, halStatus);
+                applyRes = nwFalse;
+            }
+        }
+
+        if ((applyRes == nwTrue) && (board->adcSequence != NULL))
+        {
+            halStatus = NexaWatt_HalWrapperAdc_Init_Sequence(&board->adcSequence->sequenceConfig, board->adcSequence->frameCallback);
+            if (halStatus != NW_ADC_SUCCESS)
+            {
+                NexaWatt_HalManager_Set_Report(report, NW_BOARD_SECTION_ADC, 0u, NW_BOARD_FAILURE_HAL_ERROR, halStatus);
+                applyRes = nwFalse;
+            }
+        }
+
+        report->applyCycles = NexaWatt_Platform_Cycle_Counter_Get() - startCycles;
+        retRes = (applyRes == nwTrue) ? NW_HAL_MANAGER_SUCCESS : NW_HAL_MANAGER_APPLY_FAILED;
+    }
+
+    return retRes;
+}
+
+NW_LOCAL_INLINE void NexaWatt_HalManager_Set_Report(NexaWattBoardReport* const report, const NexaWattBoardSection section, const uint8 entryIdx,
+                                                    const NexaWattBoardFailureReason reason, const NwGenericReturnType halStatus)
+{
+    report->section = section;
+    report->entryIdx = entryIdx;
+    report->reason = reason;
+    report->halStatus = halStatus;
+}
+
+static nw_bool NexaWatt_HalManager_Is_Bound(const NexaWattBoardDescription* const board, const nw_bool isInitFunction, const uint8 functionType)
+{
+    nw_bool retRes = nwFalse;
+    uint8 entryIdx = 0u;
+
+    for (entryIdx = 0u; (entryIdx < board->bindingCnt) && (retRes == nwFalse); entryIdx++)
+    {
+        retRes = ((board->bindings[entryIdx].isInitFunction == isInitFunction) &&
+                  (board->bindings[entryIdx].functionType == functionType));
+    }
+
+    return retRes;
+}
+
+static uint8 NexaWatt_HalManager_Find_Pin(const NexaWattBoardDescription* const board, const uint8 portNum, const uint8 pinNum, const uint8 searchCnt)
+{
+    uint8 retRes = NW_HAL_MANAGER_NO_ENTRY;
+    uint8 entryIdx = 0u;
+
+    for (entryIdx = 0u; (entryIdx < searchCnt) && (retRes == NW_HAL_MANAGER_NO_ENTRY); entryIdx++)
+    {
+        if ((board->pins[entryIdx].portNum == portNum) &&
+            (board->pins[entryIdx].pinNum == pinNum))
+        {
+            retRes = entryIdx;
+        }
+    }
+
+    return retRes;
+}
+
+static nw_bool NexaWatt_HalManager_Validate_Bindings(const NexaWattBoardDescription* const board, NexaWattBoardReport* const report)
+{
+    nw_bool retRes = ((board->bindings != NULL) || (board->bindingCnt == 0u));
+    uint8 entryIdx = 0u;
+    uint8 prevIdx = 0u;
+
+    if (retRes == nwFalse)
+    {
+        NexaWatt_HalManager_Set_Report(report, NW_BOARD_SECTION_BINDINGS, NW_HAL_MANAGER_NO_ENTRY, NW_BOARD_FAILURE_INVALID_PARAM, 0u);
+    }
+
+    for (entryIdx = 0u; (entryIdx < board->bindingCnt) && (retRes == nwTrue); entryIdx++)
+    {
+        const NexaWattBoardBinding* const binding = &board->bindings[entryIdx];
+
+        if ((binding->function.fncPtr == NULL) ||
+            ((binding->isInitFunction == nwTrue) && (binding->functionType >= NW_HAL_CONTEXT_MAX_INIT_FUNCTIONS)) ||
+            ((binding->isInitFunction == nwFalse) && (binding->functionType >= NW_HAL_CONTEXT_MAX_FUNCTIONS)))
+        {
+            NexaWatt_HalManager_Set_Report(report, NW_BOARD_SECTION_BINDINGS, entryIdx, NW_BOARD_FAILURE_INVALID_PARAM, 0u);
+            retRes = nwFalse;
+        }
+
+        // A second binding of the same type would silently replace the first one
+        for (prevIdx = 0u; (prevIdx < entryIdx) && (retRes == nwTrue); prevIdx++)
+        {
+            if ((board->bindings[prevIdx].isInitFunction == binding->isInitFunction) &&
+                (board->bindings[prevIdx].functionType == binding->functionType))
+            {
+                NexaWatt_HalManager_Set_Report(report, NW_BOARD_SECTION_BINDINGS, entryIdx, NW_BOARD_FAILURE_DUPLICATE, 0u);
+                retRes = nwFalse;
+            }
+        }
+    }
+
+    return retRes;
+}
+
+static nw_bool NexaWatt_HalManager_Validate_Pins(const NexaWattBoardDescription* const board, NexaWattBoardReport* const report)
+{
+    nw_bool retRes = ((board->pins != NULL) || (board->pinCnt == 0u));
+    uint8 entryIdx = 0u;
+
+    if (retRes == nwFalse)
+    {
+        NexaWatt_HalManager_Set_Report(report, NW_BOARD_SECTION_PINS, NW_HAL_MANAGER_NO_ENTRY, NW_BOARD_FAILURE_INVALID_PARAM, 0u);
+    }
+    else if ((board->pinCnt > 0u) &&
+             (NexaWatt_HalManager_Is_Bound(board, nwTrue, NW_HAL_GPIO_PORT_INIT) == nwFalse))
+    {
+        NexaWatt_HalManager_Set_Report(report, NW_BOARD_SECTION_PINS, 0u, NW_BOARD_FAILURE_MISSING_BINDING, 0u);
+        retRes = nwFalse;
+    }
+
+    for (entryIdx = 0u; (entryIdx < board->pinCnt) && (retRes == nwTrue); entryIdx++)
+    {
+        const NexaWattBoardPin* const pin = &board->pins[entryIdx];
+        const NexaWattGPIOPinConfig* const pinConfig = &pin->pinConfig;
+
+        if ((pin->pinNum >= NW_GPIO_PORT_PIN_CNT) ||
+            ((pinConfig->direction != NW_GPIO_INPUT) && (pinConfig->direction != NW_GPIO_OUTPUT)) ||
+            (pinConfig->driveMode > NW_GPIO_DM_ANALOG) ||
+            (pinConfig->driveSpeed > NW_GPIO_DS_SLOW) ||
+            (pinConfig->driveStrength > NW_GPIO_DSTR_QUARTER) ||
+            ((pinConfig->direction == NW_GPIO_OUTPUT) && (pinConfig->driveMode == NW_GPIO_DM_ANALOG)))
+        {
+            NexaWatt_HalManager_Set_Report(report, NW_BOARD_SECTION_PINS, entryIdx, NW_BOARD_FAILURE_INVALID_PARAM, 0u);
+            retRes = nwFalse;
+        }
+        else if (NexaWatt_HalManager_Find_Pin(board, pin->portNum, pin->pinNum, entryIdx) != NW_HAL_MANAGER_NO_ENTRY)
+        {
+            NexaWatt_HalManager_Set_Report(report, NW_BOARD_SECTION_PINS, entryIdx, NW_BOARD_FAILURE_DUPLICATE, 0u);
+            retRes = nwFalse;
+        }
+    }
+
+    return retRes;
+}
+
+static nw_bool NexaWatt_HalManager_Validate_Extis(const NexaWattBoardDescription* const board, NexaWattBoardReport* const report)
+{
+    nw_bool retRes = ((board->extis != NULL) || (board->extiCnt == 0u));
+    uint8 entryIdx = 0u;
+    uint8 prevIdx = 0u;
+    uint8 pinIdx = 0u;
+
+    if (retRes == nwFalse)
+    {
+        NexaWatt_HalManager_Set_Report(report, NW_BOARD_SECTION_EXTIS, NW_HAL_MANAGER_NO_ENTRY, NW_BOARD_FAILURE_INVALID_PARAM, 0u);
+    }
+    else if ((board->extiCnt > 0u) &&
+             (NexaWatt_HalManager_Is_Bound(board, nwFalse, NW_HAL_GPIO_REGISTER_EXTI) == nwFalse))
+    {
+        NexaWatt_HalManager_Set_Report(report, NW_BOARD_SECTION_EXTIS, 0u, NW_BOARD_FAILURE_MISSING_BINDING, 0u);
+        retRes = nwFalse;
+    }
+
+    for (entryIdx = 0u; (entryIdx < board->extiCnt) && (retRes == nwTrue); entryIdx++)
+    {
+        const NexaWattBoardExti* const exti = &board->extis[entryIdx];
+        pinIdx = NexaWatt_HalManager_Find_Pin(board, exti->portNum, exti->pinNum, board->pinCnt);
+
+        if ((exti->extiConfig.isrHandlerPtr == NULL) ||
+            (exti->extiConfig.intrEdge == NW_EXTI_DISABLE) ||
+            (exti->extiConfig.intrEdge > NW_EXTI_BOTH_EDGES))
+        {
+            NexaWatt_HalManager_Set_Report(report, NW_BOARD_SECTION_EXTIS, entryIdx, NW_BOARD_FAILURE_INVALID_PARAM, 0u);
+            retRes = nwFalse;
+        }
+        else if ((pinIdx == NW_HAL_MANAGER_NO_ENTRY) ||
+                 (board->pins[pinIdx].pinConfig.direction != NW_GPIO_INPUT))
+        {
+            NexaWatt_HalManager_Set_Report(report, NW_BOARD_SECTION_EXTIS, entryIdx, NW_BOARD_FAILURE_MISSING_PIN, 0u);
+            retRes = nwFalse;
+        }
+
+        for (prevIdx = 0u; (prevIdx < entryIdx) && (retRes == nwTrue); prevIdx++)
+        {
+            if ((board->extis[prevIdx].portNum == exti->portNum) &&
+                (board->extis[prevIdx].pinNum == exti->pinNum))
+            {
+                NexaWatt_HalManager_Set_Report(report, NW_BOARD_SECTION_EXTIS, entryIdx, NW_BOARD_FAILURE_DUPLICATE, 0u);
+                retRes = nwFalse;
+            }
+        }
+    }
+
+    return retRes;
+}
+
+static nw_bool NexaWatt_HalManager_Validate_Pwm_Channels(const NexaWattBoardDescription* const board, NexaWattBoardReport* const report)
+{
+    nw_bool retRes = ((board->pwmChannels != NULL) || (board->pwmChannelCnt == 0u));
+    uint8 entryIdx = 0u;
+    uint8 prevIdx = 0u;
+
+    if (retRes == nwFalse)
+    {
+        NexaWatt_HalManager_Set_Report(report, NW_BOARD_SECTION_PWM, NW_HAL_MANAGER_NO_ENTRY, NW_BOARD_FAILURE_INVALID_PARAM, 0u);
+    }
+    else if ((board->pwmChannelCnt > 0u) &&
+             (NexaWatt_HalManager_Is_Bound(board, nwTrue, NW_HAL_PWM_CHANNEL_INIT) == nwFalse))
+    {
+        NexaWatt_HalManager_Set_Report(report, NW_BOARD_SECTION_PWM, 0u, NW_BOARD_FAILURE_MISSING_BINDING, 0u);
+        retRes = nwFalse;
+    }
+
+    for (entryIdx = 0u; (entryIdx < board->pwmChannelCnt) && (retRes == nwTrue); entryIdx++)
+    {
+        const NexaWattBoardPwmChannel* const pwmChannel = &board->pwmChannels[entryIdx];
+
+        if ((pwmChannel->channel >= NW_PWM_MAX_CHANNELS) ||
+            (pwmChannel->channelConfig.periodTicks == 0u) ||
+            (pwmChannel->channelConfig.alignment > NW_PWM_ALIGN_CENTER))
+        {
+            NexaWatt_HalManager_Set_Report(report, NW_BOARD_SECTION_PWM, entryIdx, NW_BOARD_FAILURE_INVALID_PARAM, 0u);
+            retRes = nwFalse;
+        }
+
+        for (prevIdx = 0u; (prevIdx < entryIdx) && (retRes == nwTrue); prevIdx++)
+        {
+            if (board->pwmChannels[prevIdx].channel == pwmChannel->channel)
+            {
+                NexaWatt_HalManager_Set_Report(report, NW_BOARD_SECTION_PWM, entryIdx, NW_BOARD_FAILURE_DUPLICATE, 0u);
+                retRes = nwFalse;
+            }
+        }
+    }
+
+    return retRes;
+}
+
+static nw_bool NexaWatt_HalManager_Validate_Adc_Sequence(const NexaWattBoardDescription* const board, NexaWattBoardReport* const report)
+{
+    nw_bool retRes = nwTrue;
+    nw_bool isTriggerListed = nwFalse;
+    const NexaWattBoardAdcSequence* const adcSequence = board->adcSequence;
+    uint8 entryIdx = 0u;
+
+    if (adcSequence != NULL)
+    {
+        if (NexaWatt_HalManager_Is_Bound(board, nwTrue, NW_HAL_ADC_SEQUENCE_INIT) == nwFalse)
+        {
+            NexaWatt_HalManager_Set_Report(report, NW_BOARD_SECTION_ADC, 0u, NW_BOARD_FAILURE_MISSING_BINDING, 0u);
+            retRes = nwFalse;
+        }
+        else if ((adcSequence->frameCallback == NULL) ||
+                 (adcSequence->sequenceConfig.channelList == NULL) ||
+                 (adcSequence->sequenceConfig.channelCnt == 0u) ||
+                 (adcSequence->sequenceConfig.channelCnt > NW_ADC_MAX_SEQUENCE_LEN) ||
+                 (adcSequence->sequenceConfig.triggerSource > NW_ADC_TRIGGER_PWM))
+        {
+            NexaWatt_HalManager_Set_Report(report, NW_BOARD_SECTION_ADC, 0u, NW_BOARD_FAILURE_INVALID_PARAM, 0u);
+            retRes = nwFalse;
+        }
+        else if (adcSequence->sequenceConfig.triggerSource == NW_ADC_TRIGGER_PWM)
+        {
+            for (entryIdx = 0u; entryIdx < board->pwmChannelCnt; entryIdx++)
+            {
+                isTriggerListed |= (board->pwmChannels[entryIdx].channel == adcSequence->sequenceConfig.triggerPwmChannel);
+            }
+
+            if (isTriggerListed == nwFalse)
+            {
+                NexaWatt_HalManager_Set_Report(report, NW_BOARD_SECTION_ADC, 0u, NW_BOARD_FAILURE_MISSING_PWM, 0u);
+                retRes = nwFalse;
+            }
+        }
+    }
+
+    return retRes;
+}
+
+static nw_bool NexaWatt_HalManager_Apply_Pins(const NexaWattBoardDescription* const board, NexaWattBoardReport* const report)
+{
+    nw_bool retRes = nwTrue;
+    NexaWattGPIOPinConfig portPinConfigs[NW_GPIO_PORT_PIN_CNT];
+    NexaWattGPIOStatusResult gpioStatus;
+    uint8 pinMask = 0u;
+    uint8 entryIdx = 0u;
+    uint8 portEntryIdx = 0u;
+
+    for (entryIdx = 0u; (entryIdx < board->pinCnt) && (retRes == nwTrue); entryIdx++)
+    {
+        const uint8 portNum = board->pins[entryIdx].portNum;
+        nw_bool isPortApplied = nwFalse;
+
+        // A port is applied at its first entry, together with all of its pins
+        for (portEntryIdx = 0u; portEntryIdx < entryIdx; portEntryIdx++)
+        {
+            isPortApplied |= (board->pins[portEntryIdx].portNum == portNum);
+        }
+
+        if (isPortApplied == nwFalse)
+        {
+            pinMask = 0u;
+            for (portEntryIdx = entryIdx; portEntryIdx < board->pinCnt; portEntryIdx++)
+            {
+                const NexaWattBoardPin* const pin = &board->pins[portEntryIdx];
+                if (pin->portNum == portNum)
+                {
+                    portPinConfigs[pin->pinNum] = pin->pinConfig;
+                    pinMask |= (uint8)(0x01u << pin->pinNum);
+                }
+            }
+
+            gpioStatus = NexaWatt_HalWrapperGpio_Init_Port(portNum, pinMask, portPinConfigs);
+            if (gpioStatus != NW_GPIO_SUCCESS)
+            {
+                NexaWatt_HalManager_Set_Report(report, NW_BOARD_SECTION_PINS, entryIdx,
+                                               (gpioStatus == NW_GPIO_RESOURCE_CONFLICT) ? NW_BOARD_FAILURE_RESOURCE_CONFLICT : NW_BOARD_FAILURE_HAL_ERROR,
+                                               gpioStatus);
+                retRes = nwFalse;
+            }
+        }
+    }
+
+    return retRes;
+}
@@ -0,0 +1,199 @@
+/*******************************************************************************
+* File Name:   hal_manager_debounce.c
+*
+* Description: This is the source file containing definitions,
+* related to the input debounce of the HAL Manager.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "hal_manager_debounce.h"
+#include "hal_manager_resources.h"
+#include "hal_wrapper_gpio.h"
+#include "nexa_mini_os_time.h"
+#include "platform_critical_section.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Value of the port index map for a port, which is not debounced.
+ */
+#define NW_DEBOUNCE_NO_PORT                 (0xFFu)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+/**
+ * \brief State of a debounced port. The edge mask is set by the EXTI ISR and cleared by the sampling.
+ */
+typedef struct sNexaWattDebouncePort
+{
+    uint8 portNum;
+    nw_bool useExtiEdges;
+    volatile uint8 edgeMask;
+    NexaWattDebounceCounter counter;
+    NwMiniOsEventHandler changeHandler;
+    void* changeContext;
+} NexaWattDebouncePort;
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+static NexaWattDebouncePort debouncePorts[NW_DEBOUNCE_MAX_PORTS];
+static uint8 debouncePortIdxMap[NW_RESOURCE_MAX_PORTS];
+static uint8 debouncePortCnt;
+static uint32 debounceSamplePeriodUs;
+static uint64 debounceLastSampleUs;
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that samples a port and executes its vertical counter.
+ * \param debouncePort - A pointer to the debounced port.
+ * \return The mask of the pins, whose stable state changed.
+ */
+static uint8 NexaWatt_HalManager_Debounce_Sample_Port(NexaWattDebouncePort* debouncePort);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattDebounceStatusResult NexaWatt_HalManager_Debounce_Init(const uint32 samplePeriodUs)
+{
+    NexaWattDebounceStatusResult retRes = NW_DEBOUNCE_BAD_PARAM;
+    uint8 portNum = 0u;
+
+    if (samplePeriodUs > 0u)
+    {
+        for (portNum = 0u; portNum < NW_RESOURCE_MAX_PORTS; portNum++)
+        {
+            debouncePortIdxMap[portNum] = NW_DEBOUNCE_NO_PORT;
+        }
+
+        debouncePortCnt = 0u;
+        debounceSamplePeriodUs = samplePeriodUs;
+        debounceLastSampleUs = NexaWatt_MiniOs_Time_Get_Us();
+
+        retRes = NW_DEBOUNCE_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattDebounceStatusResult NexaWatt_HalManager_Debounce_Add_Port(const uint8 portNum, const uint8 pinMask, const nw_bool useExtiEdges,
+                                                                   const NwMiniOsEventHandler changeHandler, void* const changeContext)
+{
+    NexaWattDebounceStatusResult retRes = NW_DEBOUNCE_BAD_PARAM;
+    NexaWattDebouncePort* debouncePort = NULL;
+
+    if ((debounceSamplePeriodUs > 0u) &&
+        (portNum < NW_RESOURCE_MAX_PORTS) &&
+        (pinMask != 0u) &&
+        (debouncePortIdxMap[portNum] == NW_DEBOUNCE_NO_PORT))
+    {
+        if (debouncePortCnt < NW_DEBOUNCE_MAX_PORTS)
+        {
+            debouncePort = &debouncePorts[debouncePortCnt];
+            debouncePort->portNum = portNum;
+            debouncePort->useExtiEdges = useExtiEdges;
+            debouncePort->edgeMask = 0u;
+            debouncePort->changeHandler = changeHandler;
+            debouncePort->changeContext = changeContext;
+
+            debouncePort->counter.pinMask = pinMask;
+            debouncePort->counter.stableState = (uint8)(NexaWatt_HalWrapperGpio_Port_Read(portNum) & pinMask);
+            debouncePort->counter.counterBit0 = 0xFFu;
+            debouncePort->counter.counterBit1 = 0xFFu;
+
+            // The port is published to the EXTI ISR last, when its state is complete
+            debouncePortIdxMap[portNum] = debouncePortCnt;
+            debouncePortCnt++;
+
+            retRes = NW_DEBOUNCE_SUCCESS;
+        }
+        else
+        {
+            retRes = NW_DEBOUNCE_FULL;
+        }
+    }
+
+    return retRes;
+}
+
+void NexaWatt_HalManager_Debounce_Notify_Edge(const uint8 portNum, const uint8 pinNum)
+{
+    uint8 portIdx = (portNum < NW_RESOURCE_MAX_PORTS) ? debouncePortIdxMap[portNum] : NW_DEBOUNCE_NO_PORT;
+
+    if (portIdx != NW_DEBOUNCE_NO_PORT)
+    {
+        debouncePorts[portIdx].edgeMask |= NW_RESOURCE_PIN_MASK(pinNum);
+    }
+}
+
+uint32 NexaWatt_HalManager_Debounce_Process(void)
+{
+    uint32 postedCnt = 0u;
+    uint64 nowUs = NexaWatt_MiniOs_Time_Get_Us();
+    NexaWattDebouncePort* debouncePort = NULL;
+    uint8 changedMask = 0u;
+    uint8 portIdx = 0u;
+
+    if ((debounceSamplePeriodUs > 0u) &&
+        ((nowUs - debounceLastSampleUs) >= debounceSamplePeriodUs))
+    {
+        debounceLastSampleUs = nowUs;
+
+        for (portIdx = 0u; portIdx < debouncePortCnt; portIdx++)
+        {
+            debouncePort = &debouncePorts[portIdx];
+
+            changedMask = NexaWatt_HalManager_Debounce_Sample_Port(debouncePort);
+            if ((changedMask != 0u) &&
+                (debouncePort->changeHandler != NULL) &&
+                (NexaWatt_MiniOs_Event_Post(debouncePort->changeHandler, debouncePort->changeContext,
+                                            NW_DEBOUNCE_EVENT_ARG(debouncePort->portNum, changedMask, debouncePort->counter.stableState)) == NW_MINI_OS_SUCCESS))
+            {
+                postedCnt++;
+            }
+        }
+    }
+
+    return postedCnt;
+}
+
+uint8 NexaWatt_HalManager_Debounce_Get_State(const uint8 portNum)
+{
+    uint8 portIdx = (portNum < NW_RESOURCE_MAX_PORTS) ? debouncePortIdxMap[portNum] : NW_DEBOUNCE_NO_PORT;
+
+    return (portIdx != NW_DEBOUNCE_NO_PORT) ? debouncePorts[portIdx].counter.stableState : 0u;
+}
+
+static uint8 NexaWatt_HalManager_Debounce_Sample_Port(NexaWattDebouncePort* const debouncePort)
+{
+    uint8 changedMask = 0u;
+    uint8 edgeMask = 0u;
+    NwCriticalSectionState criticalSectionState = 0u;
+
+    if (debouncePort->useExtiEdges == nwTrue)
+    {
+        criticalSectionState = NexaWatt_Platform_Critical_Section_Enter();
+        edgeMask = debouncePort->edgeMask;
+        debouncePort->edgeMask = 0u;
+        NexaWatt_Platform_Critical_Section_Exit(criticalSectionState);
+    }
+
+    // An idle port (no edge, no change in progress) keeps its state without being read
+    if ((debouncePort->useExtiEdges == nwFalse) ||
+        (edgeMask != 0u) ||
+        (NexaWatt_HalManager_Debounce_Is_Settled(&debouncePort->counter) == nwFalse))
+    {
+        changedMask = NexaWatt_HalManager_Debounce_Step(&debouncePort->counter, NexaWatt_HalWrapperGpio_Port_Read(debouncePort->portNum));
+    }
+
+    return changedMask;
+}
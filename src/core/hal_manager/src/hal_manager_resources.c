@@ -0,0 +1,184 @@
+/*******************************************************************************
+* File Name:   hal_manager_resources.c
+*
+* Description: This is the source file containing definitions,
+* related to the resource registry of the HAL Manager.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "hal_manager_resources.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Number of interrupt sources tracked by a single word of the interrupt bitmap.
+ */
+#define NW_RESOURCE_IRQ_BITS_PER_WORD       (32u)
+
+/**
+ * \brief Macros returning the word and the bit of the interrupt bitmap corresponding to an interrupt source.
+ */
+#define NW_RESOURCE_IRQ_WORD(intrSource) \
+    ((intrSource) / NW_RESOURCE_IRQ_BITS_PER_WORD)
+#define NW_RESOURCE_IRQ_BIT(intrSource) \
+    ((uint32)0x01u << ((intrSource) % NW_RESOURCE_IRQ_BITS_PER_WORD))
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+static uint8 claimedPins[NW_RESOURCE_MAX_PORTS];
+static uint8 claimedExtis[NW_RESOURCE_MAX_PORTS];
+static uint32 claimedIrqs[NW_RESOURCE_MAX_IRQ_SOURCES / NW_RESOURCE_IRQ_BITS_PER_WORD];
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that claims bits of a port bitmap, if none of them is claimed.
+ * \param portBitmap - A pointer to the port bitmap.
+ * \param portNum - The number of the GPIO port.
+ * \param pinMask - The mask of the claimed bits.
+ * \return The status of the claim.
+ */
+NW_LOCAL_INLINE NexaWattResourceStatusResult NexaWatt_HalManager_Resources_Claim_Port_Bits(uint8* portBitmap, uint8 portNum, uint8 pinMask);
+
+/**
+ * \brief Simple helper function that releases bits of a port bitmap.
+ * \param portBitmap - A pointer to the port bitmap.
+ * \param portNum - The number of the GPIO port.
+ * \param pinMask - The mask of the released bits.
+ * \return The status of the release.
+ */
+NW_LOCAL_INLINE NexaWattResourceStatusResult NexaWatt_HalManager_Resources_Release_Port_Bits(uint8* portBitmap, uint8 portNum, uint8 pinMask);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+void NexaWatt_HalManager_Resources_Reset(void)
+{
+    uint32 resourceIdx = 0u;
+
+    for (resourceIdx = 0u; resourceIdx < NW_RESOURCE_MAX_PORTS; resourceIdx++)
+    {
+        claimedPins[resourceIdx] = 0u;
+        claimedExtis[resourceIdx] = 0u;
+    }
+
+    for (resourceIdx = 0u; resourceIdx < (NW_RESOURCE_MAX_IRQ_SOURCES / NW_RESOURCE_IRQ_BITS_PER_WORD); resourceIdx++)
+    {
+        claimedIrqs[resourceIdx] = 0u;
+    }
+}
+
+NexaWattResourceStatusResult NexaWatt_HalManager_Resources_Claim_Pins(const uint8 portNum, const uint8 pinMask)
+{
+    return NexaWatt_HalManager_Resources_Claim_Port_Bits(claimedPins, portNum, pinMask);
+}
+
+NexaWattResourceStatusResult NexaWatt_HalManager_Resources_Release_Pins(const uint8 portNum, const uint8 pinMask)
+{
+    return NexaWatt_HalManager_Resources_Release_Port_Bits(claimedPins, portNum, pinMask);
+}
+
+NexaWattResourceStatusResult NexaWatt_HalManager_Resources_Claim_Extis(const uint8 portNum, const uint8 pinMask)
+{
+    return NexaWatt_HalManager_Resources_Claim_Port_Bits(claimedExtis, portNum, pinMask);
+}
+
+NexaWattResourceStatusResult NexaWatt_HalManager_Resources_Release_Extis(const uint8 portNum, const uint8 pinMask)
+{
+    return NexaWatt_HalManager_Resources_Release_Port_Bits(claimedExtis, portNum, pinMask);
+}
+
+NexaWattResourceStatusResult NexaWatt_HalManager_Resources_Claim_Irq(const uint32 intrSource)
+{
+    NexaWattResourceStatusResult retRes = NW_RESOURCE_BAD_PARAM;
+
+    if (intrSource < NW_RESOURCE_MAX_IRQ_SOURCES)
+    {
+        if ((claimedIrqs[NW_RESOURCE_IRQ_WORD(intrSource)] & NW_RESOURCE_IRQ_BIT(intrSource)) != 0u)
+        {
+            retRes = NW_RESOURCE_CONFLICT;
+        }
+        else
+        {
+            claimedIrqs[NW_RESOURCE_IRQ_WORD(intrSource)] |= NW_RESOURCE_IRQ_BIT(intrSource);
+            retRes = NW_RESOURCE_SUCCESS;
+        }
+    }
+
+    return retRes;
+}
+
+NexaWattResourceStatusResult NexaWatt_HalManager_Resources_Release_Irq(const uint32 intrSource)
+{
+    NexaWattResourceStatusResult retRes = NW_RESOURCE_BAD_PARAM;
+
+    if (intrSource < NW_RESOURCE_MAX_IRQ_SOURCES)
+    {
+        claimedIrqs[NW_RESOURCE_IRQ_WORD(intrSource)] &= ~NW_RESOURCE_IRQ_BIT(intrSource);
+        retRes = NW_RESOURCE_SUCCESS;
+    }
+
+    return retRes;
+}
+
+uint8 NexaWatt_HalManager_Resources_Get_Claimed_Pins(const uint8 portNum)
+{
+    return (portNum < NW_RESOURCE_MAX_PORTS) ? claimedPins[portNum] : 0u;
+}
+
+uint8 NexaWatt_HalManager_Resources_Get_Claimed_Extis(const uint8 portNum)
+{
+    return (portNum < NW_RESOURCE_MAX_PORTS) ? claimedExtis[portNum] : 0u;
+}
+
+nw_bool NexaWatt_HalManager_Resources_Is_Irq_Claimed(const uint32 intrSource)
+{
+    return (intrSource < NW_RESOURCE_MAX_IRQ_SOURCES) &&
+           ((claimedIrqs[NW_RESOURCE_IRQ_WORD(intrSource)] & NW_RESOURCE_IRQ_BIT(intrSource)) != 0u);
+}
+
+NW_LOCAL_INLINE NexaWattResourceStatusResult NexaWatt_HalManager_Resources_Claim_Port_Bits(uint8* const portBitmap, const uint8 portNum, const uint8 pinMask)
+{
+    NexaWattResourceStatusResult retRes = NW_RESOURCE_BAD_PARAM;
+
+    if ((portNum < NW_RESOURCE_MAX_PORTS) &&
+        (pinMask != 0u))
+    {
+        if ((portBitmap[portNum] & pinMask) != 0u)
+        {
+            retRes = NW_RESOURCE_CONFLICT;
+        }
+        else
+        {
+            portBitmap[portNum] |= pinMask;
+            retRes = NW_RESOURCE_SUCCESS;
+        }
+    }
+
+    return retRes;
+}
+
+NW_LOCAL_INLINE NexaWattResourceStatusResult NexaWatt_HalManager_Resources_Release_Port_Bits(uint8* const portBitmap, const uint8 portNum, const uint8 pinMask)
+{
+    NexaWattResourceStatusResult retRes = NW_RESOURCE_BAD_PARAM;
+
+    if (portNum < NW_RESOURCE_MAX_PORTS)
+    {
+        portBitmap[portNum] &= (uint8)~pinMask;
+        retRes = NW_RESOURCE_SUCCESS;
+    }
+
+    return retRes;
+}
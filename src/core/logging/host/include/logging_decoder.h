@@ -0,0 +1,121 @@
+/*******************************************************************************
+* File Name:   logging_decoder.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the host decoder of the binary logger of the NexaWatt-IV.DC framework.
+* The decoder is intended for the host and is excluded from the target build (see .cyignore).
+* It consumes the byte stream produced by NexaWatt_Logging_Drain() in chunks of any size
+* (e.g. as received from a serial port), rebuilds the records and prints one readable line
+* per record, using the format strings of the message catalogue (logging_messages.h).
+* The 32-bit cycle time stamps are extended to 64 bits and converted to seconds with the
+* CPU frequency, relative to the first decoded record. A stream, which does not start
+* at a record boundary or contains corrupted bytes, is resynchronized on the
+* synchronization byte of the record headers.
+* The decoder must be built with the message catalogue of the firmware, which recorded the stream.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_LOGGING_DECODER_H
+#define NEXAWATT_IV_DC_LOGGING_DECODER_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include "platform_types.h"
+#include "logging.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Maximum length of a decoded line, without the time stamp and the channel.
+ */
+#define NW_LOG_DECODER_MAX_TEXT_LEN         (256u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+typedef enum eNexaWattLogDecoderStatusResult
+{
+    NW_LOG_DECODER_SUCCESS      = 0u,
+    NW_LOG_DECODER_BAD_PARAM    = 1u,
+} NexaWattLogDecoderStatusResult;
+
+/**
+ * \brief Statistics of a decoder. The unknown records carry a message missing in the catalogue,
+ * the skipped bytes were discarded while resynchronizing.
+ */
+typedef struct sNexaWattLogDecoderStats
+{
+    uint32 recordCnt;
+    uint32 unknownCnt;
+    uint32 droppedCnt;
+    uint32 skippedByteCnt;
+} NexaWattLogDecoderStats;
+
+typedef struct sNexaWattLogDecoder
+{
+    FILE* output;
+    uint32 cpuFreqHz;
+    uint8 pendingBytes[NW_LOG_MAX_RECORD_WORDS * sizeof(uint32)];
+    uint32 pendingLen;
+    int64 timeCycles;
+    uint32 lastTimestamp;
+    nw_bool hasTimestamp;
+    NexaWattLogDecoderStats stats;
+} NexaWattLogDecoder;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Function used to initialize a decoder.
+ * \param decoder - A pointer to the decoder to be initialized.
+ * \param cpuFreqHz - The CPU frequency of the target, i.e. the rate of the time stamps.
+ * \param output - The file, where the decoded lines are printed.
+ * \return NW_LOG_DECODER_BAD_PARAM - A pointer is NULL or the frequency is 0.
+ * \return NW_LOG_DECODER_SUCCESS - The decoder is initialized.
+ */
+NexaWattLogDecoderStatusResult NexaWatt_Logging_Decoder_Init(NexaWattLogDecoder* decoder, uint32 cpuFreqHz, FILE* output);
+
+/**
+ * \brief Function used to decode a chunk of the stream. An incomplete record at the end of the chunk is kept for the next chunk.
+ * \param decoder - A pointer to an initialized decoder.
+ * \param stream - The chunk of the stream.
+ * \param streamLen - The length of the chunk in bytes.
+ * \return NW_LOG_DECODER_BAD_PARAM - A pointer is NULL.
+ * \return NW_LOG_DECODER_SUCCESS - The chunk is consumed.
+ */
+NexaWattLogDecoderStatusResult NexaWatt_Logging_Decoder_Feed(NexaWattLogDecoder* decoder, const uint8* stream, uint32 streamLen);
+
+/**
+ * \brief Function used to format the text of a single record.
+ * \param msgId - The message of the record.
+ * \param args - The arguments of the record.
+ * \param argCnt - The number of arguments.
+ * \param text - The buffer receiving the text.
+ * \param textLen - The length of the buffer in bytes.
+ * \return nwTrue - The message is part of the catalogue.
+ * \return nwFalse - The message is unknown; the text contains its identifier and the raw arguments.
+ */
+nw_bool NexaWatt_Logging_Decoder_Format(uint16 msgId, const uint32* args, uint8 argCnt, char* text, uint32 textLen);
+
+/**
+ * \brief Function used to obtain the statistics of a decoder.
+ * \param decoder - A pointer to an initialized decoder.
+ * \param decoderStats - A pointer to the structure, where the statistics are copied.
+ */
+void NexaWatt_Logging_Decoder_Get_Stats(const NexaWattLogDecoder* decoder, NexaWattLogDecoderStats* decoderStats);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+#endif
@@ -0,0 +1,312 @@
+/*******************************************************************************
+* File Name:   logging_decoder.c
+*
+* Description: This is the source file containing definitions,
+* related to the host decoder of the binary logger of the NexaWatt-IV.DC framework.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "logging_decoder.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Expansion of a table entry to its format string.
+ */
+#define NW_LOG_DECODER_FORMAT(identifier, format)   format,
+
+/**
+ * \brief Maximum length of a single conversion specification, e.g. "%-08x".
+ */
+#define NW_LOG_DECODER_MAX_SPEC_LEN         (16u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+/**
+ * \brief Array containing mapping between the message (index) and its format string.
+ */
+static const char* const decoderFormats[] =
+{
+    NW_LOG_MESSAGE_TABLE(NW_LOG_DECODER_FORMAT)
+};
+
+NW_STATIC_ASSERT((sizeof(decoderFormats) / sizeof(decoderFormats[0u])) == NW_LOG_MSG_CNT, decoder_formats_size);
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that reads a little-endian word.
+ * \param bytes - The bytes of the word.
+ * \return The word.
+ */
+static uint32 NexaWatt_Logging_Decoder_Get_Word(const uint8* bytes);
+
+/**
+ * \brief Simple helper function that decodes and prints a complete record.
+ * \param decoder - A pointer to the decoder.
+ */
+static void NexaWatt_Logging_Decoder_Emit_Record(NexaWattLogDecoder* decoder);
+
+/**
+ * \brief Simple helper function that formats a single argument according to a conversion specification.
+ * \param spec - The conversion specification, starting with '%' and ending with the conversion character.
+ * \param specLen - The length of the specification.
+ * \param arg - The raw argument.
+ * \param text - The buffer receiving the text.
+ * \param textLen - The length of the buffer in bytes.
+ * \return The number of characters written, without the terminating null character.
+ */
+static uint32 NexaWatt_Logging_Decoder_Format_Arg(const char* spec, uint32 specLen, uint32 arg, char* text, uint32 textLen);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattLogDecoderStatusResult NexaWatt_Logging_Decoder_Init(NexaWattLogDecoder* const decoder, const uint32 cpuFreqHz, FILE* const output)
+{
+    NexaWattLogDecoderStatusResult retRes = NW_LOG_DECODER_BAD_PARAM;
+
+    if ((decoder != NULL) &&
+        (cpuFreqHz > 0u) &&
+        (output != NULL))
+    {
+        decoder->output = output;
+        decoder->cpuFreqHz = cpuFreqHz;
+        decoder->pendingLen = 0u;
+        decoder->timeCycles = 0u;
+        decoder->lastTimestamp = 0u;
+        decoder->hasTimestamp = nwFalse;
+        decoder->stats.recordCnt = 0u;
+        decoder->stats.unknownCnt = 0u;
+        decoder->stats.droppedCnt = 0u;
+        decoder->stats.skippedByteCnt = 0u;
+
+        retRes = NW_LOG_DECODER_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattLogDecoderStatusResult NexaWatt_Logging_Decoder_Feed(NexaWattLogDecoder* const decoder, const uint8* const stream, const uint32 streamLen)
+{
+    NexaWattLogDecoderStatusResult retRes = NW_LOG_DECODER_BAD_PARAM;
+    uint32 byteIdx = 0u;
+    uint32 header = 0u;
+
+    if ((decoder != NULL) &&
+        (stream != NULL))
+    {
+        for (byteIdx = 0u; byteIdx < streamLen; byteIdx++)
+        {
+            decoder->pendingBytes[decoder->pendingLen] = stream[byteIdx];
+            decoder->pendingLen++;
+
+            if (decoder->pendingLen >= sizeof(uint32))
+            {
+                header = NexaWatt_Logging_Decoder_Get_Word(decoder->pendingBytes);
+                if ((NW_LOG_HEADER_GET_SYNC(header) != NW_LOG_HEADER_SYNC) ||
+                    (NW_LOG_HEADER_GET_ARG_CNT(header) > NW_LOG_MAX_ARGS))
+                {
+                    // Not a record header: the first byte is skipped and the header is searched at the next byte
+                    (void)memmove(decoder->pendingBytes, &decoder->pendingBytes[1u], decoder->pendingLen - 1u);
+                    decoder->pendingLen--;
+                    decoder->stats.skippedByteCnt++;
+                }
+                else if (decoder->pendingLen == (NW_LOG_RECORD_WORDS(NW_LOG_HEADER_GET_ARG_CNT(header)) * sizeof(uint32)))
+                {
+                    NexaWatt_Logging_Decoder_Emit_Record(decoder);
+                    decoder->pendingLen = 0u;
+                }
+            }
+        }
+
+        retRes = NW_LOG_DECODER_SUCCESS;
+    }
+
+    return retRes;
+}
+
+nw_bool NexaWatt_Logging_Decoder_Format(const uint16 msgId, const uint32* const args, const uint8 argCnt, char* const text, const uint32 textLen)
+{
+    nw_bool retRes = nwFalse;
+    const char* format = NULL;
+    uint32 textIdx = 0u;
+    uint32 specLen = 0u;
+    uint8 argIdx = 0u;
+
+    if ((text != NULL) &&
+        (textLen > 0u))
+    {
+        text[0u] = '\0';
+
+        if (msgId < NW_LOG_MSG_CNT)
+        {
+            format = decoderFormats[msgId];
+            while ((*format != '\0') && (textIdx < (textLen - 1u)))
+            {
+                if ((format[0u] == '%') && (format[1u] == '%'))
+                {
+                    text[textIdx] = '%';
+                    textIdx++;
+                    format = &format[2u];
+                }
+                else if (format[0u] == '%')
+                {
+                    // The specification spans the flags, the width and the precision up to the conversion character
+                    specLen = 1u;
+                    while ((format[specLen] != '\0') && (strchr("-+ #0123456789.", format[specLen]) != NULL) && (specLen < (NW_LOG_DECODER_MAX_SPEC_LEN - 4u)))
+                    {
+                        specLen++;
+                    }
+                    if (format[specLen] != '\0')
+                    {
+                        specLen++;
+                    }
+
+                    if (argIdx < argCnt)
+                    {
+                        textIdx += NexaWatt_Logging_Decoder_Format_Arg(format, specLen, args[argIdx], &text[textIdx], textLen - textIdx);
+                        argIdx++;
+                    }
+                    else
+                    {
+                        textIdx += (uint32)snprintf(&text[textIdx], textLen - textIdx, "<missing>");
+                    }
+                    textIdx = (textIdx < textLen) ? textIdx : (textLen - 1u);
+                    format = &format[specLen];
+                }
+                else
+                {
+                    text[textIdx] = *format;
+                    textIdx++;
+                    format = &format[1u];
+                }
+            }
+            text[textIdx] = '\0';
+
+            retRes = nwTrue;
+        }
+        else
+        {
+            textIdx = (uint32)snprintf(text, textLen, "unknown message %u:", (unsigned int)msgId);
+            for (argIdx = 0u; (argIdx < argCnt) && (textIdx < textLen); argIdx++)
+            {
+                textIdx += (uint32)snprintf(&text[textIdx], textLen - textIdx, " 0x%08x", (unsigned int)args[argIdx]);
+            }
+        }
+    }
+
+    return retRes;
+}
+
+void NexaWatt_Logging_Decoder_Get_Stats(const NexaWattLogDecoder* const decoder, NexaWattLogDecoderStats* const decoderStats)
+{
+    if ((decoder != NULL) &&
+        (decoderStats != NULL))
+    {
+        *decoderStats = decoder->stats;
+    }
+}
+
+static uint32 NexaWatt_Logging_Decoder_Get_Word(const uint8* const bytes)
+{
+    return (uint32)bytes[0u] | ((uint32)bytes[1u] << 8u) | ((uint32)bytes[2u] << 16u) | ((uint32)bytes[3u] << 24u);
+}
+
+static void NexaWatt_Logging_Decoder_Emit_Record(NexaWattLogDecoder* const decoder)
+{
+    const uint32 header = NexaWatt_Logging_Decoder_Get_Word(decoder->pendingBytes);
+    const uint32 timestamp = NexaWatt_Logging_Decoder_Get_Word(&decoder->pendingBytes[4u]);
+    const uint8 argCnt = NW_LOG_HEADER_GET_ARG_CNT(header);
+    uint32 args[NW_LOG_MAX_ARGS];
+    char text[NW_LOG_DECODER_MAX_TEXT_LEN];
+    uint8 argIdx = 0u;
+
+    for (argIdx = 0u; argIdx < argCnt; argIdx++)
+    {
+        args[argIdx] = NexaWatt_Logging_Decoder_Get_Word(&decoder->pendingBytes[8u + (argIdx * sizeof(uint32))]);
+    }
+
+    // The time stamps of the merged channels may step back slightly, so the difference is signed
+    if (decoder->hasTimestamp == nwTrue)
+    {
+        decoder->timeCycles += (int32)(timestamp - decoder->lastTimestamp);
+    }
+    decoder->lastTimestamp = timestamp;
+    decoder->hasTimestamp = nwTrue;
+
+    if (NexaWatt_Logging_Decoder_Format(NW_LOG_HEADER_GET_MSG(header), args, argCnt, text, sizeof(text)) == nwFalse)
+    {
+        decoder->stats.unknownCnt++;
+    }
+    if ((NW_LOG_HEADER_GET_MSG(header) == NW_LOG_MSG_DROPPED) && (argCnt >= 2u))
+    {
+        decoder->stats.droppedCnt += args[1u];
+    }
+    decoder->stats.recordCnt++;
+
+    (void)fprintf(decoder->output, "[%14.6f] ch%u %s\n", (double)decoder->timeCycles / (double)decoder->cpuFreqHz,
+                  (unsigned int)NW_LOG_HEADER_GET_CHANNEL(header), text);
+}
+
+static uint32 NexaWatt_Logging_Decoder_Format_Arg(const char* const spec, const uint32 specLen, const uint32 arg, char* const text, const uint32 textLen)
+{
+    char argSpec[NW_LOG_DECODER_MAX_SPEC_LEN];
+    const char conversion = spec[specLen - 1u];
+    int printedLen = 0;
+
+    (void)memcpy(argSpec, spec, specLen);
+    argSpec[specLen] = '\0';
+
+    switch (conversion)
+    {
+        case 'd':
+        case 'i':
+            printedLen = snprintf(text, textLen, argSpec, (int)(int32)arg);
+            break;
+
+        case 'u':
+        case 'x':
+        case 'X':
+            printedLen = snprintf(text, textLen, argSpec, (unsigned int)arg);
+            break;
+
+        case 'c':
+            printedLen = snprintf(text, textLen, argSpec, (int)(uint8)arg);
+            break;
+
+        case 'q':
+            // Q15 argument, printed as a fraction with five decimals unless a precision is given
+            if (memchr(argSpec, '.', specLen) == NULL)
+            {
+                argSpec[specLen - 1u] = '.';
+                argSpec[specLen] = '5';
+                argSpec[specLen + 1u] = 'f';
+                argSpec[specLen + 2u] = '\0';
+            }
+            else
+            {
+                argSpec[specLen - 1u] = 'f';
+            }
+            printedLen = snprintf(text, textLen, argSpec, (double)(int32)arg / 32768.0);
+            break;
+
+        default:
+            printedLen = snprintf(text, textLen, "<%.*s?>", (int)specLen, spec);
+            break;
+    }
+
+    return (printedLen > 0) ? (uint32)printedLen : 0u;
+}
@@ -0,0 +1,264 @@
+/*******************************************************************************
+* File Name:   logging.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the binary deferred logger of the NexaWatt-IV.DC framework.
+* A log call stores a record of raw 32-bit words: the header (the message identifier
+* of logging_messages.h, the number of arguments and the channel), the cycle counter
+* as the time stamp and the arguments. Nothing is formatted on the target.
+* Every channel is a lock-free single-producer single-consumer ring buffer, written
+* by a single interrupt priority (e.g. the control ISR, the other ISRs and the main
+* loop, which never preempt themselves) and read by the drain. The writer publishes
+* a record by advancing the head index after the record is written, the drain frees
+* it by advancing the tail index, so neither side masks the interrupts. A record, which
+* does not fit, is dropped and counted; the drain reports the drops with NW_LOG_MSG_DROPPED.
+* The drain runs in the idle context, merges the channels in the order of the time stamps
+* and copies whole records to a byte stream (little-endian words), e.g. for a serial
+* port. The stream is decoded on the host (see core/logging/host).
+* Typical usage:
+* (void)NexaWatt_Logging_Log_2(&logger, NW_LOG_CHANNEL_CONTROL, NW_LOG_MSG_CONTROL_TIMING, execCycles, maxCycles);
+* and in the idle loop:
+* streamLen = NexaWatt_Logging_Drain(&logger, streamBuffer, sizeof(streamBuffer));
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_LOGGING_H
+#define NEXAWATT_IV_DC_LOGGING_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+#include "platform_critical_section.h"
+#include "platform_cycle_counter.h"
+#include "logging_messages.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Number of 32-bit words of the ring buffer of a channel. Must be a power of two.
+ */
+#define NW_LOG_RING_WORDS                   (256u)
+
+/**
+ * \brief Maximum number of arguments of a record.
+ */
+#define NW_LOG_MAX_ARGS                     (4u)
+
+/**
+ * \brief Number of words of a record: the header, the time stamp and the arguments.
+ */
+#define NW_LOG_RECORD_WORDS(argCnt)         (2u + (uint32)(argCnt))
+#define NW_LOG_MAX_RECORD_WORDS             (NW_LOG_RECORD_WORDS(NW_LOG_MAX_ARGS))
+
+/**
+ * \brief Layout of the record header: the message in bits 0..15, the argument count in bits 16..18,
+ * the channel in bits 20..22 and the synchronization byte in bits 24..31, used by the decoder to detect a corrupted stream.
+ */
+#define NW_LOG_HEADER_SYNC                  (0xA5u)
+#define NW_LOG_HEADER(msgId, argCnt, channel) \
+    (((uint32)NW_LOG_HEADER_SYNC << 24u) | (((uint32)(channel) & 0x07u) << 20u) | (((uint32)(argCnt) & 0x07u) << 16u) | ((uint32)(msgId) & 0xFFFFu))
+#define NW_LOG_HEADER_GET_SYNC(header)      ((uint8)((header) >> 24u))
+#define NW_LOG_HEADER_GET_CHANNEL(header)   ((uint8)(((header) >> 20u) & 0x07u))
+#define NW_LOG_HEADER_GET_ARG_CNT(header)   ((uint8)(((header) >> 16u) & 0x07u))
+#define NW_LOG_HEADER_GET_MSG(header)       ((uint16)((header) & 0xFFFFu))
+
+/**
+ * \brief Number of calls of every measurement of the benchmark.
+ */
+#define NW_LOG_BENCHMARK_CALLS              (16u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+typedef enum eNexaWattLogStatusResult
+{
+    NW_LOG_SUCCESS      = 0u,
+    NW_LOG_BAD_PARAM    = 1u,
+} NexaWattLogStatusResult;
+
+/**
+ * \brief Channels of the logger. A channel must be written from a single interrupt priority only.
+ */
+typedef enum eNexaWattLogChannel
+{
+    NW_LOG_CHANNEL_CONTROL  = 0u,
+    NW_LOG_CHANNEL_ISR      = 1u,
+    NW_LOG_CHANNEL_MAIN     = 2u,
+    NW_LOG_CHANNEL_CNT      = 3u,
+} NexaWattLogChannel;
+
+/**
+ * \brief Ring buffer of a channel. The indices are free-running word indices; their difference is the number of pending words.
+ * The head index and the drop counter are written by the producer only, the tail index by the drain only.
+ */
+typedef struct sNexaWattLogRing
+{
+    uint32 words[NW_LOG_RING_WORDS];
+    volatile uint32 headIdx;
+    volatile uint32 tailIdx;
+    volatile uint32 droppedCnt;
+    uint32 reportedDropCnt;
+    uint32 drainedCnt;
+    uint32 maxPendingWords;
+} NexaWattLogRing;
+
+typedef struct sNexaWattLogger
+{
+    NexaWattLogRing rings[NW_LOG_CHANNEL_CNT];
+} NexaWattLogger;
+
+/**
+ * \brief Statistics of a channel. The drained records include the drop reports; the pending words are observed by the drain.
+ */
+typedef struct sNexaWattLogStats
+{
+    uint32 droppedCnt;
+    uint32 drainedCnt;
+    uint32 maxPendingWords;
+} NexaWattLogStats;
+
+/**
+ * \brief Result of the benchmark: the average cycles of a log call without and with NW_LOG_MAX_ARGS arguments,
+ * and of a record drop on a full channel. The cost of the cycle counter readings is subtracted.
+ */
+typedef struct sNexaWattLogBenchmark
+{
+    uint32 log0Cycles;
+    uint32 log4Cycles;
+    uint32 dropCycles;
+} NexaWattLogBenchmark;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Function used to initialize a logger. All channels are empty.
+ * \param logger - A pointer to the logger to be initialized.
+ * \return NW_LOG_BAD_PARAM - The pointer is NULL.
+ * \return NW_LOG_SUCCESS - The logger is initialized.
+ */
+NexaWattLogStatusResult NexaWatt_Logging_Init(NexaWattLogger* logger);
+
+/**
+ * \brief Function used to drain the pending records into a byte stream, merging the channels in the order of their time stamps.
+ * Only whole records are copied. Must be called from a single context with the lowest priority of the writers (e.g. idle).
+ * \param logger - A pointer to an initialized logger.
+ * \param stream - The buffer receiving the records as little-endian words.
+ * \param streamLen - The length of the buffer in bytes.
+ * \return The number of bytes written to the buffer.
+ */
+uint32 NexaWatt_Logging_Drain(NexaWattLogger* logger, uint8* stream, uint32 streamLen);
+
+/**
+ * \brief Function used to obtain the statistics of a channel.
+ * \param logger - A pointer to an initialized logger.
+ * \param channel - The channel.
+ * \param logStats - A pointer to the structure, where the statistics are copied.
+ * \return NW_LOG_BAD_PARAM - A pointer is NULL or the channel does not exist.
+ * \return NW_LOG_SUCCESS - The statistics are copied.
+ */
+NexaWattLogStatusResult NexaWatt_Logging_Get_Stats(const NexaWattLogger* logger, NexaWattLogChannel channel, NexaWattLogStats* logStats);
+
+/**
+ * \brief Function used to measure the cost of the log calls on a scratch logger, e.g. during the start-up.
+ * The interrupts are masked during the measurement. The scratch logger is left initialized and empty.
+ * \param scratchLogger - A pointer to a logger, which is not in use.
+ * \param logBenchmark - A pointer to the structure, where the results are stored.
+ * \return NW_LOG_BAD_PARAM - A pointer is NULL.
+ * \return NW_LOG_SUCCESS - The results are stored.
+ */
+NexaWattLogStatusResult NexaWatt_Logging_Benchmark(NexaWattLogger* scratchLogger, NexaWattLogBenchmark* logBenchmark);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/**
+ * \brief Stores a record in a channel. The function performs no validation and is intended to be inlined,
+ * so the constant argument counts of the wrappers below unroll the copy of the arguments.
+ * \param logger - A pointer to an initialized logger.
+ * \param channel - The channel of the interrupt priority of the caller.
+ * \param msgId - The message.
+ * \param args - The arguments.
+ * \param argCnt - The number of arguments, at most NW_LOG_MAX_ARGS.
+ * \return nwTrue - The record is stored. nwFalse - The channel is full and the record is dropped.
+ */
+NW_LOCAL_INLINE nw_bool NexaWatt_Logging_Write(NexaWattLogger* const logger, const NexaWattLogChannel channel, const NexaWattLogMessage msgId,
+                                               const uint32* const args, const uint8 argCnt)
+{
+    NexaWattLogRing* const ring = &logger->rings[channel];
+    const uint32 headIdx = ring->headIdx;
+    nw_bool retRes = nwFalse;
+    uint8 argIdx = 0u;
+
+    if ((headIdx - ring->tailIdx) <= (NW_LOG_RING_WORDS - NW_LOG_RECORD_WORDS(argCnt)))
+    {
+        ring->words[headIdx & (NW_LOG_RING_WORDS - 1u)] = NW_LOG_HEADER(msgId, argCnt, channel);
+        ring->words[(headIdx + 1u) & (NW_LOG_RING_WORDS - 1u)] = NexaWatt_Platform_Cycle_Counter_Get();
+        for (argIdx = 0u; argIdx < argCnt; argIdx++)
+        {
+            ring->words[(headIdx + 2u + argIdx) & (NW_LOG_RING_WORDS - 1u)] = args[argIdx];
+        }
+
+        // The record must be complete in memory, before the drain can see it
+        NexaWatt_Platform_Compiler_Barrier();
+        ring->headIdx = headIdx + NW_LOG_RECORD_WORDS(argCnt);
+
+        retRes = nwTrue;
+    }
+    else
+    {
+        ring->droppedCnt++;
+    }
+
+    return retRes;
+}
+
+/**
+ * \brief Log calls with zero to four arguments. See NexaWatt_Logging_Write().
+ */
+NW_LOCAL_INLINE nw_bool NexaWatt_Logging_Log_0(NexaWattLogger* const logger, const NexaWattLogChannel channel, const NexaWattLogMessage msgId)
+{
+    return NexaWatt_Logging_Write(logger, channel, msgId, NULL, 0u);
+}
+
+NW_LOCAL_INLINE nw_bool NexaWatt_Logging_Log_1(NexaWattLogger* const logger, const NexaWattLogChannel channel, const NexaWattLogMessage msgId,
+                                               const uint32 arg0)
+{
+    const uint32 args[1u] = { arg0 };
+
+    return NexaWatt_Logging_Write(logger, channel, msgId, args, 1u);
+}
+
+NW_LOCAL_INLINE nw_bool NexaWatt_Logging_Log_2(NexaWattLogger* const logger, const NexaWattLogChannel channel, const NexaWattLogMessage msgId,
+                                               const uint32 arg0, const uint32 arg1)
+{
+    const uint32 args[2u] = { arg0, arg1 };
+
+    return NexaWatt_Logging_Write(logger, channel, msgId, args, 2u);
+}
+
+NW_LOCAL_INLINE nw_bool NexaWatt_Logging_Log_3(NexaWattLogger* const logger, const NexaWattLogChannel channel, const NexaWattLogMessage msgId,
+                                               const uint32 arg0, const uint32 arg1, const uint32 arg2)
+{
+    const uint32 args[3u] = { arg0, arg1, arg2 };
+
+    return NexaWatt_Logging_Write(logger, channel, msgId, args, 3u);
+}
+
+NW_LOCAL_INLINE nw_bool NexaWatt_Logging_Log_4(NexaWattLogger* const logger, const NexaWattLogChannel channel, const NexaWattLogMessage msgId,
+                                               const uint32 arg0, const uint32 arg1, const uint32 arg2, const uint32 arg3)
+{
+    const uint32 args[4u] = { arg0, arg1, arg2, arg3 };
+
+    return NexaWatt_Logging_Write(logger, channel, msgId, args, 4u);
+}
+
+#endif
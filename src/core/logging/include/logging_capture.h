@@ -0,0 +1,227 @@
+/*******************************************************************************
+* File Name:   logging_capture.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the triggered variable capture of the NexaWatt-IV.DC framework.
+* The capture works like a digital oscilloscope: every decimation periods of the
+* control ISR it copies the selected 32-bit variables to a preallocated circular
+* buffer. The variables are selected by their address or by the identifier of a
+* signal registered with NexaWatt_Logging_Capture_Register_Signal(); the identifiers
+* are resolved when the capture is initialized, so the step only walks an array of
+* addresses in one tight copy loop.
+* An armed capture records continuously. Once the pre-trigger history is filled, the
+* trigger is evaluated on every recorded sample: a level of a variable, an edge of a
+* variable, a fault of the safety checker or a manual request. After the trigger the
+* remaining part of the buffer is filled and the capture freezes, so the buffer holds
+* the pre-trigger samples, the trigger sample and the post-trigger samples. A frozen
+* buffer is not modified until the capture is armed again, so it can be read over the
+* debug interface (the buffer and the readout fields of the capture) or with
+* NexaWatt_Logging_Capture_Read_Sample().
+* Typical usage at the end of the control ISR:
+* NexaWatt_Logging_Capture_Step(&capture);
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_LOGGING_CAPTURE_H
+#define NEXAWATT_IV_DC_LOGGING_CAPTURE_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+#include "safety_checker.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Maximum number of captured variables.
+ */
+#define NW_CAPTURE_MAX_VARIABLES            (8u)
+
+/**
+ * \brief Maximum number of registered signals. The identifiers range from 0 to NW_CAPTURE_MAX_SIGNALS - 1.
+ */
+#define NW_CAPTURE_MAX_SIGNALS              (32u)
+
+/**
+ * \brief Identifier of a variable selected by its address.
+ */
+#define NW_CAPTURE_SIGNAL_NONE              (0xFFFFu)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+typedef enum eNexaWattCaptureStatusResult
+{
+    NW_CAPTURE_SUCCESS      = 0u,
+    NW_CAPTURE_BAD_PARAM    = 1u,
+    NW_CAPTURE_BUSY         = 2u,
+} NexaWattCaptureStatusResult;
+
+typedef enum eNexaWattCaptureState
+{
+    NW_CAPTURE_STATE_IDLE       = 0x00u,
+    NW_CAPTURE_STATE_ARMED      = 0x01u,
+    NW_CAPTURE_STATE_TRIGGERED  = 0x02u,
+    NW_CAPTURE_STATE_FROZEN     = 0x03u,
+} NexaWattCaptureState;
+
+/**
+ * \brief Trigger conditions. The level and edge triggers compare the trigger variable as a signed value with the level.
+ * A level trigger fires on the first sample beyond the level, an edge trigger on the first sample beyond the level
+ * following a sample not beyond it. The fault trigger fires when a fault of the mask is latched in the safety checker.
+ * Every trigger also fires on a manual request.
+ */
+typedef enum eNexaWattCaptureTrigger
+{
+    NW_CAPTURE_TRIGGER_MANUAL       = 0x00u,
+    NW_CAPTURE_TRIGGER_LEVEL_ABOVE  = 0x01u,
+    NW_CAPTURE_TRIGGER_LEVEL_BELOW  = 0x02u,
+    NW_CAPTURE_TRIGGER_EDGE_RISING  = 0x03u,
+    NW_CAPTURE_TRIGGER_EDGE_FALLING = 0x04u,
+    NW_CAPTURE_TRIGGER_FAULT        = 0x05u,
+} NexaWattCaptureTrigger;
+
+/**
+ * \brief Selection of a variable: the registered signal, or NW_CAPTURE_SIGNAL_NONE and the address of the variable.
+ */
+typedef struct sNexaWattCaptureVariable
+{
+    uint16 signalId;
+    const volatile uint32* address;
+} NexaWattCaptureVariable;
+
+/**
+ * \brief Configuration of the capture. The buffer holds bufferLen / variableCnt samples, of which preTriggerCnt precede the trigger sample.
+ * The trigger variable is an index of the variables. The safety checker is required by the fault trigger only.
+ */
+typedef struct sNexaWattCaptureConfig
+{
+    NexaWattCaptureVariable variables[NW_CAPTURE_MAX_VARIABLES];
+    uint8 variableCnt;
+    uint16 decimation;
+    uint32* buffer;
+    uint32 bufferLen;
+    uint32 preTriggerCnt;
+    NexaWattCaptureTrigger trigger;
+    uint8 triggerVariable;
+    int32 triggerLevel;
+    const NexaWattSafetyChecker* safetyChecker;
+    uint32 faultMask;
+} NexaWattCaptureConfig;
+
+typedef struct sNexaWattCapture
+{
+    const volatile uint32* addresses[NW_CAPTURE_MAX_VARIABLES];
+    uint8 variableCnt;
+    uint16 decimation;
+    uint16 decimationCnt;
+    uint32* buffer;
+    uint32 bufferEnd;
+    uint32 writeIdx;
+    NexaWattCaptureTrigger trigger;
+    uint8 triggerVariable;
+    int32 triggerLevel;
+    const NexaWattSafetyChecker* safetyChecker;
+    uint32 faultMask;
+    nw_bool wasBeyondLevel;
+    volatile nw_bool isTriggerRequested;
+    uint32 preTriggerCnt;
+    uint32 recordedCnt;
+    uint32 remainingCnt;
+    volatile NexaWattCaptureState state;
+    // Readout of a frozen capture, the indices are samples of the buffer
+    uint32 sampleCnt;
+    uint32 firstSampleIdx;
+    uint32 triggerSampleIdx;
+} NexaWattCapture;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Function used to register a signal, which can then be captured by its identifier.
+ * A registered signal can be registered again with a new address.
+ * \param signalId - The identifier of the signal.
+ * \param address - The address of the 32-bit variable.
+ * \return NW_CAPTURE_BAD_PARAM - The identifier is out of range or the address is NULL.
+ * \return NW_CAPTURE_SUCCESS - The signal is registered.
+ */
+NexaWattCaptureStatusResult NexaWatt_Logging_Capture_Register_Signal(uint16 signalId, const volatile uint32* address);
+
+/**
+ * \brief Function used to initialize a capture. The capture is idle until it is armed.
+ * \param capture - A pointer to the capture to be initialized.
+ * \param captureConfig - A pointer to the configuration.
+ * \return NW_CAPTURE_BAD_PARAM - A pointer is NULL, a count is out of range, a signal is not registered, the buffer holds
+ * less than two samples, the pre-trigger history does not leave room for the trigger sample, the trigger variable does not exist
+ * or the fault trigger has no safety checker or fault mask.
+ * \return NW_CAPTURE_SUCCESS - The capture is initialized.
+ */
+NexaWattCaptureStatusResult NexaWatt_Logging_Capture_Init(NexaWattCapture* capture, const NexaWattCaptureConfig* captureConfig);
+
+/**
+ * \brief Function used to arm a capture, discarding the content of the buffer.
+ * \param capture - A pointer to an initialized capture.
+ * \return NW_CAPTURE_BAD_PARAM - The pointer is NULL.
+ * \return NW_CAPTURE_SUCCESS - The capture is armed.
+ */
+NexaWattCaptureStatusResult NexaWatt_Logging_Capture_Arm(NexaWattCapture* capture);
+
+/**
+ * \brief Function used to request a trigger, regardless of the trigger condition. The request is taken by the next recorded
+ * sample with a complete pre-trigger history.
+ * \param capture - A pointer to an initialized capture.
+ * \return NW_CAPTURE_BAD_PARAM - The pointer is NULL.
+ * \return NW_CAPTURE_BUSY - The capture is not armed.
+ * \return NW_CAPTURE_SUCCESS - The trigger is requested.
+ */
+NexaWattCaptureStatusResult NexaWatt_Logging_Capture_Force_Trigger(NexaWattCapture* capture);
+
+/**
+ * \brief Function used to stop a capture. An armed or triggered capture becomes idle, a frozen capture keeps its buffer.
+ * \param capture - A pointer to an initialized capture.
+ * \return NW_CAPTURE_BAD_PARAM - The pointer is NULL.
+ * \return NW_CAPTURE_SUCCESS - The capture is stopped.
+ */
+NexaWattCaptureStatusResult NexaWatt_Logging_Capture_Stop(NexaWattCapture* capture);
+
+/**
+ * \brief Executes a single period of the capture: records a sample every decimation periods and evaluates the trigger.
+ * The function performs no validation and is intended to be executed in the control ISR.
+ * \param capture - A pointer to an initialized capture.
+ */
+void NexaWatt_Logging_Capture_Step(NexaWattCapture* capture);
+
+/**
+ * \brief Function used to read a sample of a frozen capture in chronological order.
+ * \param capture - A pointer to a frozen capture.
+ * \param sampleIdx - The index of the sample, 0 for the oldest one. The trigger sample has the index of the pre-trigger count.
+ * \param values - The array receiving the values of the variables.
+ * \return NW_CAPTURE_BAD_PARAM - A pointer is NULL or the sample does not exist.
+ * \return NW_CAPTURE_BUSY - The capture is not frozen.
+ * \return NW_CAPTURE_SUCCESS - The values are copied.
+ */
+NexaWattCaptureStatusResult NexaWatt_Logging_Capture_Read_Sample(const NexaWattCapture* capture, uint32 sampleIdx, uint32* values);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/**
+ * \brief Returns the state of a capture.
+ * \param capture - A pointer to an initialized capture.
+ * \return The state of the capture.
+ */
+NW_LOCAL_INLINE NexaWattCaptureState NexaWatt_Logging_Capture_Get_State(const NexaWattCapture* const capture)
+{
+    return capture->state;
+}
+
+#endif
@@ -0,0 +1,74 @@
+/*******************************************************************************
+* File Name:   logging_messages.h
+*
+* Description: This is the header file containing the message catalogue of the
+* binary logger of the NexaWatt-IV.DC framework. Every message is declared once
+* with its identifier and its format string. The target build expands only the
+* identifiers, so the format strings never reach the target flash; the host decoder
+* expands the format strings and rebuilds the readable messages from the identifiers.
+* The format strings accept the conversions %d, %i, %u, %x, %X and %c with the usual
+* flags and width, and %q, which prints a Q15 argument as a decimal fraction.
+* The arguments are raw 32-bit words, so a message has at most NW_LOG_MAX_ARGS of them.
+* New messages are appended at the end of the table, so the identifiers of the logs
+* recorded by older firmware keep their meaning.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_LOGGING_MESSAGES_H
+#define NEXAWATT_IV_DC_LOGGING_MESSAGES_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Message table. NW_LOG_MESSAGE(identifier, format) is defined by the user of the table.
+ * The first message is reserved for the drop reports of the drain.
+ */
+#define NW_LOG_MESSAGE_TABLE(NW_LOG_MESSAGE) \
+    NW_LOG_MESSAGE(NW_LOG_MSG_DROPPED,              "channel %u dropped %u records") \
+    NW_LOG_MESSAGE(NW_LOG_MSG_BENCHMARK,            "benchmark %u %u %u %u") \
+    NW_LOG_MESSAGE(NW_LOG_MSG_BOOT,                 "boot, reset reason 0x%08x") \
+    NW_LOG_MESSAGE(NW_LOG_MSG_STATE_TRANSITION,     "state %u -> %u on event %u") \
+    NW_LOG_MESSAGE(NW_LOG_MSG_SAFETY_TRIP,          "safety trip, faults 0x%08x") \
+    NW_LOG_MESSAGE(NW_LOG_MSG_SAFETY_CLEAR,         "safety faults cleared") \
+    NW_LOG_MESSAGE(NW_LOG_MSG_WATCHDOG_LEVEL,       "timing watchdog level %u, violations 0x%02x") \
+    NW_LOG_MESSAGE(NW_LOG_MSG_REDUNDANCY,           "redundancy event 0x%06x") \
+    NW_LOG_MESSAGE(NW_LOG_MSG_REFERENCE_TARGET,     "reference target %q") \
+    NW_LOG_MESSAGE(NW_LOG_MSG_REFERENCE_DONE,       "reference reached %q") \
+    NW_LOG_MESSAGE(NW_LOG_MSG_CONTROL_TIMING,       "control exec %u cycles, max %u cycles") \
+    NW_LOG_MESSAGE(NW_LOG_MSG_SIGNAL,               "signal %u = %q") \
+    NW_LOG_MESSAGE(NW_LOG_MSG_VALUE,                "value %d")
+
+/**
+ * \brief Expansion of a table entry to its identifier.
+ */
+#define NW_LOG_MESSAGE_ID(identifier, format)   identifier,
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+typedef enum eNexaWattLogMessage
+{
+    NW_LOG_MESSAGE_TABLE(NW_LOG_MESSAGE_ID)
+    NW_LOG_MSG_CNT
+} NexaWattLogMessage;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+#endif
@@ -0,0 +1,302 @@
+/*******************************************************************************
+* File Name:   logging.c
+*
+* Description: This is the source file containing definitions,
+* related to the binary deferred logger of the NexaWatt-IV.DC framework.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "logging.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Macro returning the ring slot corresponding to a free-running word index.
+ */
+#define NW_LOG_RING_SLOT(wordIdx) \
+    ((wordIdx) & (NW_LOG_RING_WORDS - 1u))
+
+/**
+ * \brief Marker of a drain without a pending record.
+ */
+#define NW_LOG_CHANNEL_NONE                 (0xFFu)
+
+NW_STATIC_ASSERT((NW_LOG_RING_WORDS & (NW_LOG_RING_WORDS - 1u)) == 0u, log_ring_words_power_of_two);
+NW_STATIC_ASSERT(NW_LOG_MAX_ARGS <= 0x07u, log_max_args_fit_header);
+NW_STATIC_ASSERT(NW_LOG_CHANNEL_CNT <= 0x08u, log_channel_cnt_fit_header);
+NW_STATIC_ASSERT(NW_LOG_MSG_CNT <= 0x10000u, log_msg_cnt_fit_header);
+NW_STATIC_ASSERT(NW_LOG_RING_WORDS >= (8u * NW_LOG_MAX_RECORD_WORDS), log_ring_words_benchmark);
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that stores a word in the stream in little-endian order.
+ * \param stream - The stream.
+ * \param word - The word.
+ */
+static void NexaWatt_Logging_Put_Word(uint8* stream, uint32 word);
+
+/**
+ * \brief Simple helper function that appends the drop reports of all channels with new drops to the stream.
+ * \param logger - A pointer to the logger.
+ * \param stream - The stream.
+ * \param streamLen - The length of the stream in bytes.
+ * \param writtenLen - The number of bytes already written.
+ * \return The number of bytes written, including the already written ones.
+ */
+static uint32 NexaWatt_Logging_Report_Drops(NexaWattLogger* logger, uint8* stream, uint32 streamLen, uint32 writtenLen);
+
+/**
+ * \brief Simple helper function that selects the channel with the oldest pending record.
+ * A channel with a corrupted record is emptied.
+ * \param logger - A pointer to the logger.
+ * \return The channel, or NW_LOG_CHANNEL_NONE if no record is pending.
+ */
+static uint8 NexaWatt_Logging_Select_Oldest(NexaWattLogger* logger);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattLogStatusResult NexaWatt_Logging_Init(NexaWattLogger* const logger)
+{
+    NexaWattLogStatusResult retRes = NW_LOG_BAD_PARAM;
+    NexaWattLogRing* ring = NULL;
+    uint8 channel = 0u;
+
+    if (logger != NULL)
+    {
+        for (channel = 0u; channel < NW_LOG_CHANNEL_CNT; channel++)
+        {
+            ring = &logger->rings[channel];
+            ring->headIdx = 0u;
+            ring->tailIdx = 0u;
+            ring->droppedCnt = 0u;
+            ring->reportedDropCnt = 0u;
+            ring->drainedCnt = 0u;
+            ring->maxPendingWords = 0u;
+        }
+
+        retRes = NW_LOG_SUCCESS;
+    }
+
+    return retRes;
+}
+
+uint32 NexaWatt_Logging_Drain(NexaWattLogger* const logger, uint8* const stream, const uint32 streamLen)
+{
+    uint32 writtenLen = 0u;
+    NexaWattLogRing* ring = NULL;
+    uint8 channel = 0u;
+    uint32 pendingWords = 0u;
+    uint32 recordWords = 0u;
+    uint32 wordIdx = 0u;
+    nw_bool isStopped = nwFalse;
+
+    if ((logger != NULL) &&
+        (stream != NULL))
+    {
+        for (channel = 0u; channel < NW_LOG_CHANNEL_CNT; channel++)
+        {
+            ring = &logger->rings[channel];
+            pendingWords = ring->headIdx - ring->tailIdx;
+            ring->maxPendingWords = (pendingWords > ring->maxPendingWords) ? pendingWords : ring->maxPendingWords;
+        }
+
+        while (isStopped == nwFalse)
+        {
+            channel = NexaWatt_Logging_Select_Oldest(logger);
+            if (channel == NW_LOG_CHANNEL_NONE)
+            {
+                isStopped = nwTrue;
+            }
+            else
+            {
+                ring = &logger->rings[channel];
+                recordWords = NW_LOG_RECORD_WORDS(NW_LOG_HEADER_GET_ARG_CNT(ring->words[NW_LOG_RING_SLOT(ring->tailIdx)]));
+                if ((streamLen - writtenLen) < (recordWords * sizeof(uint32)))
+                {
+                    isStopped = nwTrue;
+                }
+                else
+                {
+                    for (wordIdx = 0u; wordIdx < recordWords; wordIdx++)
+                    {
+                        NexaWatt_Logging_Put_Word(&stream[writtenLen], ring->words[NW_LOG_RING_SLOT(ring->tailIdx + wordIdx)]);
+                        writtenLen += sizeof(uint32);
+                    }
+
+                    // The words are copied, before the slots are released to the producer
+                    NexaWatt_Platform_Compiler_Barrier();
+                    ring->tailIdx += recordWords;
+                    ring->drainedCnt++;
+                }
+            }
+        }
+
+        // The drops are reported after the drained records, which were all stored before the drops
+        writtenLen = NexaWatt_Logging_Report_Drops(logger, stream, streamLen, writtenLen);
+    }
+
+    return writtenLen;
+}
+
+NexaWattLogStatusResult NexaWatt_Logging_Get_Stats(const NexaWattLogger* const logger, const NexaWattLogChannel channel, NexaWattLogStats* const logStats)
+{
+    NexaWattLogStatusResult retRes = NW_LOG_BAD_PARAM;
+    const NexaWattLogRing* ring = NULL;
+
+    if ((logger != NULL) &&
+        (channel < NW_LOG_CHANNEL_CNT) &&
+        (logStats != NULL))
+    {
+        ring = &logger->rings[channel];
+        logStats->droppedCnt = ring->droppedCnt;
+        logStats->drainedCnt = ring->drainedCnt;
+        logStats->maxPendingWords = ring->maxPendingWords;
+
+        retRes = NW_LOG_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattLogStatusResult NexaWatt_Logging_Benchmark(NexaWattLogger* const scratchLogger, NexaWattLogBenchmark* const logBenchmark)
+{
+    NexaWattLogStatusResult retRes = NW_LOG_BAD_PARAM;
+    NwCriticalSectionState criticalSectionState = 0u;
+    uint32 startCycles = 0u;
+    uint32 overheadCycles = 0u;
+    uint32 callCycles = 0u;
+    uint32 callIdx = 0u;
+
+    if ((scratchLogger != NULL) &&
+        (logBenchmark != NULL) &&
+        (NexaWatt_Logging_Init(scratchLogger) == NW_LOG_SUCCESS))
+    {
+        criticalSectionState = NexaWatt_Platform_Critical_Section_Enter();
+
+        startCycles = NexaWatt_Platform_Cycle_Counter_Get();
+        overheadCycles = NexaWatt_Platform_Cycle_Counter_Get() - startCycles;
+
+        startCycles = NexaWatt_Platform_Cycle_Counter_Get();
+        for (callIdx = 0u; callIdx < NW_LOG_BENCHMARK_CALLS; callIdx++)
+        {
+            (void)NexaWatt_Logging_Log_0(scratchLogger, NW_LOG_CHANNEL_MAIN, NW_LOG_MSG_BENCHMARK);
+        }
+        callCycles = (NexaWatt_Platform_Cycle_Counter_Get() - startCycles) - overheadCycles;
+        logBenchmark->log0Cycles = callCycles / NW_LOG_BENCHMARK_CALLS;
+
+        startCycles = NexaWatt_Platform_Cycle_Counter_Get();
+        for (callIdx = 0u; callIdx < NW_LOG_BENCHMARK_CALLS; callIdx++)
+        {
+            (void)NexaWatt_Logging_Log_4(scratchLogger, NW_LOG_CHANNEL_MAIN, NW_LOG_MSG_BENCHMARK, callIdx, startCycles, overheadCycles, callCycles);
+        }
+        callCycles = (NexaWatt_Platform_Cycle_Counter_Get() - startCycles) - overheadCycles;
+        logBenchmark->log4Cycles = callCycles / NW_LOG_BENCHMARK_CALLS;
+
+        // The channel is filled up, so the measured calls take the drop path
+        while (NexaWatt_Logging_Log_4(scratchLogger, NW_LOG_CHANNEL_MAIN, NW_LOG_MSG_BENCHMARK, 0u, 0u, 0u, 0u) == nwTrue)
+        {
+        }
+        startCycles = NexaWatt_Platform_Cycle_Counter_Get();
+        for (callIdx = 0u; callIdx < NW_LOG_BENCHMARK_CALLS; callIdx++)
+        {
+            (void)NexaWatt_Logging_Log_4(scratchLogger, NW_LOG_CHANNEL_MAIN, NW_LOG_MSG_BENCHMARK, callIdx, startCycles, overheadCycles, callCycles);
+        }
+        callCycles = (NexaWatt_Platform_Cycle_Counter_Get() - startCycles) - overheadCycles;
+        logBenchmark->dropCycles = callCycles / NW_LOG_BENCHMARK_CALLS;
+
+        NexaWatt_Platform_Critical_Section_Exit(criticalSectionState);
+
+        retRes = NexaWatt_Logging_Init(scratchLogger);
+    }
+
+    return retRes;
+}
+
+static void NexaWatt_Logging_Put_Word(uint8* const stream, const uint32 word)
+{
+    stream[0u] = (uint8)word;
+    stream[1u] = (uint8)(word >> 8u);
+    stream[2u] = (uint8)(word >> 16u);
+    stream[3u] = (uint8)(word >> 24u);
+}
+
+static uint32 NexaWatt_Logging_Report_Drops(NexaWattLogger* const logger, uint8* const stream, const uint32 streamLen, const uint32 writtenLen)
+{
+    uint32 reportLen = writtenLen;
+    NexaWattLogRing* ring = NULL;
+    uint8 channel = 0u;
+    uint32 droppedCnt = 0u;
+
+    for (channel = 0u; channel < NW_LOG_CHANNEL_CNT; channel++)
+    {
+        ring = &logger->rings[channel];
+        droppedCnt = ring->droppedCnt;
+        if ((droppedCnt != ring->reportedDropCnt) &&
+            ((streamLen - reportLen) >= (NW_LOG_RECORD_WORDS(2u) * sizeof(uint32))))
+        {
+            NexaWatt_Logging_Put_Word(&stream[reportLen], NW_LOG_HEADER(NW_LOG_MSG_DROPPED, 2u, channel));
+            NexaWatt_Logging_Put_Word(&stream[reportLen + 4u], NexaWatt_Platform_Cycle_Counter_Get());
+            NexaWatt_Logging_Put_Word(&stream[reportLen + 8u], channel);
+            NexaWatt_Logging_Put_Word(&stream[reportLen + 12u], droppedCnt - ring->reportedDropCnt);
+            reportLen += NW_LOG_RECORD_WORDS(2u) * sizeof(uint32);
+
+            ring->reportedDropCnt = droppedCnt;
+            ring->drainedCnt++;
+        }
+    }
+
+    return reportLen;
+}
+
+static uint8 NexaWatt_Logging_Select_Oldest(NexaWattLogger* const logger)
+{
+    uint8 oldestChannel = NW_LOG_CHANNEL_NONE;
+    uint32 oldestTimestamp = 0u;
+    NexaWattLogRing* ring = NULL;
+    uint8 channel = 0u;
+    uint32 header = 0u;
+    uint32 timestamp = 0u;
+
+    for (channel = 0u; channel < NW_LOG_CHANNEL_CNT; channel++)
+    {
+        ring = &logger->rings[channel];
+        if (ring->headIdx != ring->tailIdx)
+        {
+            header = ring->words[NW_LOG_RING_SLOT(ring->tailIdx)];
+            timestamp = ring->words[NW_LOG_RING_SLOT(ring->tailIdx + 1u)];
+
+            if ((NW_LOG_HEADER_GET_SYNC(header) != NW_LOG_HEADER_SYNC) ||
+                (NW_LOG_HEADER_GET_ARG_CNT(header) > NW_LOG_MAX_ARGS))
+            {
+                // The record boundaries are lost, so the pending records of the channel are discarded
+                ring->tailIdx = ring->headIdx;
+            }
+            else if ((oldestChannel == NW_LOG_CHANNEL_NONE) ||
+                     ((int32)(timestamp - oldestTimestamp) < 0))
+            {
+                // The time stamps wrap around, so they are compared by their signed difference
+                oldestChannel = channel;
+                oldestTimestamp = timestamp;
+            }
+        }
+    }
+
+    return oldestChannel;
+}
@@ -0,0 +1,350 @@
+/*******************************************************************************
+* File Name:   logging_capture.c
+*
+* Description: This is the source file containing definitions,
+* related to the triggered variable capture of the NexaWatt-IV.DC framework.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "logging_capture.h"
+#include "platform_critical_section.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+NW_STATIC_ASSERT(NW_CAPTURE_MAX_SIGNALS < NW_CAPTURE_SIGNAL_NONE, capture_max_signals_fit_id);
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+/**
+ * \brief Array containing mapping between the registered signal (index) and its address.
+ */
+static const volatile uint32* captureSignals[NW_CAPTURE_MAX_SIGNALS];
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that evaluates the trigger condition on the recorded sample.
+ * \param capture - A pointer to the capture.
+ * \param sample - The recorded sample.
+ * \return nwTrue - The trigger condition is met. nwFalse - Otherwise.
+ */
+static nw_bool NexaWatt_Logging_Capture_Is_Triggered(NexaWattCapture* capture, const uint32* sample);
+
+/**
+ * \brief Simple helper function that freezes a capture, after its last sample is recorded.
+ * \param capture - A pointer to the capture.
+ */
+static void NexaWatt_Logging_Capture_Freeze(NexaWattCapture* capture);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattCaptureStatusResult NexaWatt_Logging_Capture_Register_Signal(const uint16 signalId, const volatile uint32* const address)
+{
+    NexaWattCaptureStatusResult retRes = NW_CAPTURE_BAD_PARAM;
+
+    if ((signalId < NW_CAPTURE_MAX_SIGNALS) &&
+        (address != NULL))
+    {
+        captureSignals[signalId] = address;
+
+        retRes = NW_CAPTURE_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattCaptureStatusResult NexaWatt_Logging_Capture_Init(NexaWattCapture* const capture, const NexaWattCaptureConfig* const captureConfig)
+{
+    NexaWattCaptureStatusResult retRes = NW_CAPTURE_BAD_PARAM;
+    const volatile uint32* address = NULL;
+    uint32 sampleCnt = 0u;
+    uint8 variableIdx = 0u;
+
+    if ((capture != NULL) &&
+        (captureConfig != NULL) &&
+        (captureConfig->variableCnt > 0u) &&
+        (captureConfig->variableCnt <= NW_CAPTURE_MAX_VARIABLES) &&
+        (captureConfig->decimation > 0u) &&
+        (captureConfig->buffer != NULL) &&
+        (captureConfig->triggerVariable < captureConfig->variableCnt) &&
+        (captureConfig->trigger <= NW_CAPTURE_TRIGGER_FAULT) &&
+        ((captureConfig->trigger != NW_CAPTURE_TRIGGER_FAULT) || ((captureConfig->safetyChecker != NULL) && (captureConfig->faultMask != 0u))))
+    {
+        sampleCnt = captureConfig->bufferLen / captureConfig->variableCnt;
+        retRes = ((sampleCnt >= 2u) && (captureConfig->preTriggerCnt < sampleCnt)) ? NW_CAPTURE_SUCCESS : NW_CAPTURE_BAD_PARAM;
+
+        // The signal identifiers are resolved once, so the step copies through the addresses only
+        for (variableIdx = 0u; (variableIdx < captureConfig->variableCnt) && (retRes == NW_CAPTURE_SUCCESS); variableIdx++)
+        {
+            if (captureConfig->variables[variableIdx].signalId == NW_CAPTURE_SIGNAL_NONE)
+            {
+                address = captureConfig->variables[variableIdx].address;
+            }
+            else if (captureConfig->variables[variableIdx].signalId < NW_CAPTURE_MAX_SIGNALS)
+            {
+                address = captureSignals[captureConfig->variables[variableIdx].signalId];
+            }
+            else
+            {
+                address = NULL;
+            }
+
+            if (address != NULL)
+            {
+                capture->addresses[variableIdx] = address;
+            }
+            else
+            {
+                retRes = NW_CAPTURE_BAD_PARAM;
+            }
+        }
+
+        if (retRes == NW_CAPTURE_SUCCESS)
+        {
+            capture->variableCnt = captureConfig->variableCnt;
+            capture->decimation = captureConfig->decimation;
+            capture->decimationCnt = 0u;
+            capture->buffer = captureConfig->buffer;
+            capture->bufferEnd = sampleCnt * captureConfig->variableCnt;
+            capture->writeIdx = 0u;
+            capture->trigger = captureConfig->trigger;
+            capture->triggerVariable = captureConfig->triggerVariable;
+            capture->triggerLevel = captureConfig->triggerLevel;
+            capture->safetyChecker = captureConfig->safetyChecker;
+            capture->faultMask = captureConfig->faultMask;
+            capture->wasBeyondLevel = nwTrue;
+            capture->isTriggerRequested = nwFalse;
+            capture->preTriggerCnt = captureConfig->preTriggerCnt;
+            capture->recordedCnt = 0u;
+            capture->remainingCnt = 0u;
+            capture->state = NW_CAPTURE_STATE_IDLE;
+            capture->sampleCnt = sampleCnt;
+            capture->firstSampleIdx = 0u;
+            capture->triggerSampleIdx = 0u;
+        }
+    }
+
+    return retRes;
+}
+
+NexaWattCaptureStatusResult NexaWatt_Logging_Capture_Arm(NexaWattCapture* const capture)
+{
+    NexaWattCaptureStatusResult retRes = NW_CAPTURE_BAD_PARAM;
+    NwCriticalSectionState criticalState;
+
+    if (capture != NULL)
+    {
+        criticalState = NexaWatt_Platform_Critical_Section_Enter();
+        capture->decimationCnt = 0u;
+        capture->writeIdx = 0u;
+        // A level already beyond at the arming is not an edge
+        capture->wasBeyondLevel = nwTrue;
+        capture->isTriggerRequested = nwFalse;
+        capture->recordedCnt = 0u;
+        capture->remainingCnt = 0u;
+        capture->state = NW_CAPTURE_STATE_ARMED;
+        NexaWatt_Platform_Critical_Section_Exit(criticalState);
+
+        retRes = NW_CAPTURE_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattCaptureStatusResult NexaWatt_Logging_Capture_Force_Trigger(NexaWattCapture* const capture)
+{
+    NexaWattCaptureStatusResult retRes = NW_CAPTURE_BAD_PARAM;
+
+    if (capture != NULL)
+    {
+        if (capture->state == NW_CAPTURE_STATE_ARMED)
+        {
+            capture->isTriggerRequested = nwTrue;
+
+            retRes = NW_CAPTURE_SUCCESS;
+        }
+        else
+        {
+            retRes = NW_CAPTURE_BUSY;
+        }
+    }
+
+    return retRes;
+}
+
+NexaWattCaptureStatusResult NexaWatt_Logging_Capture_Stop(NexaWattCapture* const capture)
+{
+    NexaWattCaptureStatusResult retRes = NW_CAPTURE_BAD_PARAM;
+    NwCriticalSectionState criticalState;
+
+    if (capture != NULL)
+    {
+        criticalState = NexaWatt_Platform_Critical_Section_Enter();
+        if (capture->state != NW_CAPTURE_STATE_FROZEN)
+        {
+            capture->isTriggerRequested = nwFalse;
+            capture->state = NW_CAPTURE_STATE_IDLE;
+        }
+        NexaWatt_Platform_Critical_Section_Exit(criticalState);
+
+        retRes = NW_CAPTURE_SUCCESS;
+    }
+
+    return retRes;
+}
+
+void NexaWatt_Logging_Capture_Step(NexaWattCapture* const capture)
+{
+    const NexaWattCaptureState state = capture->state;
+    uint32* sample = NULL;
+    uint8 variableIdx = 0u;
+
+    if ((state == NW_CAPTURE_STATE_ARMED) ||
+        (state == NW_CAPTURE_STATE_TRIGGERED))
+    {
+        capture->decimationCnt++;
+        if (capture->decimationCnt >= capture->decimation)
+        {
+            capture->decimationCnt = 0u;
+
+            sample = &capture->buffer[capture->writeIdx];
+            for (variableIdx = 0u; variableIdx < capture->variableCnt; variableIdx++)
+            {
+                sample[variableIdx] = *capture->addresses[variableIdx];
+            }
+
+            if (state == NW_CAPTURE_STATE_ARMED)
+            {
+                // The trigger is accepted only with a complete pre-trigger history before the recorded sample
+                if (capture->recordedCnt < capture->preTriggerCnt)
+                {
+                    capture->recordedCnt++;
+                    (void)NexaWatt_Logging_Capture_Is_Triggered(capture, sample);
+                }
+                else if (NexaWatt_Logging_Capture_Is_Triggered(capture, sample) == nwTrue)
+                {
+                    // Division by the variable count, executed once per capture
+                    capture->triggerSampleIdx = capture->writeIdx / capture->variableCnt;
+                    capture->remainingCnt = capture->sampleCnt - capture->preTriggerCnt - 1u;
+                    capture->isTriggerRequested = nwFalse;
+                    capture->state = NW_CAPTURE_STATE_TRIGGERED;
+                }
+            }
+            else
+            {
+                capture->remainingCnt--;
+            }
+
+            capture->writeIdx += capture->variableCnt;
+            if (capture->writeIdx >= capture->bufferEnd)
+            {
+                capture->writeIdx = 0u;
+            }
+
+            if ((capture->state == NW_CAPTURE_STATE_TRIGGERED) &&
+                (capture->remainingCnt == 0u))
+            {
+                NexaWatt_Logging_Capture_Freeze(capture);
+            }
+        }
+    }
+}
+
+NexaWattCaptureStatusResult NexaWatt_Logging_Capture_Read_Sample(const NexaWattCapture* const capture, const uint32 sampleIdx, uint32* const values)
+{
+    NexaWattCaptureStatusResult retRes = NW_CAPTURE_BAD_PARAM;
+    uint32 bufferSampleIdx = 0u;
+    const uint32* sample = NULL;
+    uint8 variableIdx = 0u;
+
+    if ((capture != NULL) &&
+        (values != NULL))
+    {
+        if (capture->state != NW_CAPTURE_STATE_FROZEN)
+        {
+            retRes = NW_CAPTURE_BUSY;
+        }
+        else if (sampleIdx < capture->sampleCnt)
+        {
+            bufferSampleIdx = capture->firstSampleIdx + sampleIdx;
+            if (bufferSampleIdx >= capture->sampleCnt)
+            {
+                bufferSampleIdx -= capture->sampleCnt;
+            }
+
+            sample = &capture->buffer[bufferSampleIdx * capture->variableCnt];
+            for (variableIdx = 0u; variableIdx < capture->variableCnt; variableIdx++)
+            {
+                values[variableIdx] = sample[variableIdx];
+            }
+
+            retRes = NW_CAPTURE_SUCCESS;
+        }
+        else
+        {
+            // The sample does not exist
+        }
+    }
+
+    return retRes;
+}
+
+static nw_bool NexaWatt_Logging_Capture_Is_Triggered(NexaWattCapture* const capture, const uint32* const sample)
+{
+    const int32 value = (int32)sample[capture->triggerVariable];
+    nw_bool retRes = capture->isTriggerRequested;
+    nw_bool isBeyondLevel = nwFalse;
+
+    switch (capture->trigger)
+    {
+        case NW_CAPTURE_TRIGGER_LEVEL_ABOVE:
+            retRes = ((retRes == nwTrue) || (value > capture->triggerLevel)) ? nwTrue : nwFalse;
+            break;
+
+        case NW_CAPTURE_TRIGGER_LEVEL_BELOW:
+            retRes = ((retRes == nwTrue) || (value < capture->triggerLevel)) ? nwTrue : nwFalse;
+            break;
+
+        case NW_CAPTURE_TRIGGER_EDGE_RISING:
+        case NW_CAPTURE_TRIGGER_EDGE_FALLING:
+            // The previous sample is tracked also while the pre-trigger history fills, so the first accepted sample may be an edge
+            isBeyondLevel = (capture->trigger == NW_CAPTURE_TRIGGER_EDGE_RISING) ? ((value > capture->triggerLevel) ? nwTrue : nwFalse)
+                                                                                  : ((value < capture->triggerLevel) ? nwTrue : nwFalse);
+            retRes = ((retRes == nwTrue) || ((isBeyondLevel == nwTrue) && (capture->wasBeyondLevel == nwFalse))) ? nwTrue : nwFalse;
+            capture->wasBeyondLevel = isBeyondLevel;
+            break;
+
+        case NW_CAPTURE_TRIGGER_FAULT:
+            retRes = ((retRes == nwTrue) || ((NexaWatt_SafetyChecker_Get_Faults(capture->safetyChecker) & capture->faultMask) != 0u)) ? nwTrue : nwFalse;
+            break;
+
+        case NW_CAPTURE_TRIGGER_MANUAL:
+        default:
+            break;
+    }
+
+    return retRes;
+}
+
+static void NexaWatt_Logging_Capture_Freeze(NexaWattCapture* const capture)
+{
+    capture->firstSampleIdx = (capture->triggerSampleIdx >= capture->preTriggerCnt) ? (capture->triggerSampleIdx - capture->preTriggerCnt)
+                                                                                     : (capture->triggerSampleIdx + capture->sampleCnt - capture->preTriggerCnt);
+
+    // The readout fields must be complete in memory, before the debugger or the readout can see the frozen state
+    NexaWatt_Platform_Compiler_Barrier();
+    capture->state = NW_CAPTURE_STATE_FROZEN;
+}
@@ -0,0 +1,277 @@
+/*******************************************************************************
+* File Name:   safety_checker.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the safety checker (fault protection) of the NexaWatt-IV.DC framework.
+* The checker compares the raw ADC samples of the monitored channels against
+* their instantaneous limits (over- and under-voltage, over-current) and integrates
+* the squared samples of the current channels against their I2t limits, every
+* control cycle. The faults are latched; on the first fault the gate disable pins
+* are driven to their safe level by a single port-masked GPIO write.
+*
+* The instantaneous comparison is executed on packed limits: two 16-bit channels
+* share a 32-bit word and are compared by one subtraction (SIMD within a register).
+* The bit 15 of each half-word is a guard bit, which absorbs the borrow of the lower
+* channel, so the limits must not exceed NW_SAFETY_MAX_LEVEL (15 bits). A sample above it
+* (e.g. a corrupted DMA word) is limited to NW_SAFETY_MAX_LEVEL, so it violates every upper
+* limit below the maximum level and its square cannot overflow the I2t integration.
+* The limits of the sensing points can be derived from the operating limits of the selected
+* topology at compile time (see NW_SAFETY_TOPOLOGY_VOUT_LIMITS).
+* The comparison and the I2t integration contain no data-dependent branch, so their execution
+* time does not depend on the samples. The first fault adds the trip path (one HAL Context export
+* and the gate disable write), so the worst case is the check pass plus the trip path, which is
+* measured by maxTripCycles.
+*
+* Trip latency: the worst case, counted from the end of the ADC sequence, is the
+* ADC frame latency (see hal_wrapper_adc.h) plus the pipeline stages preceding the
+* protection stage, plus the complete check pass, plus the gate disable write.
+* The check pass costs roughly 14 instructions per channel pair and 10 per I2t channel,
+* and the gate write one HAL Context export and one register write. For the maximum
+* configuration (16 channels, 4 I2t channels) the pass is about 180 instructions including
+* the entry and the statistics, i.e. about 1 us at 180 MHz (PSC3). The last and the
+* worst pass durations and the worst trip duration (check start to gate write completed)
+* are measured with the cycle counter and reported by the checker, to be verified on the target.
+* Typical usage as the protection stage of the control pipeline:
+* NexaWatt_DigitalController_Pipeline_Register_Stage(&pipeline, NW_PIPELINE_STAGE_PROTECT, NexaWatt_SafetyChecker_Pipeline_Stage, &checker);
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_SAFETY_CHECKER_H
+#define NEXAWATT_IV_DC_SAFETY_CHECKER_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+#include "digital_controller_pipeline.h"
+#include "topology_descriptor.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Maximum number of channels with instantaneous limits.
+ */
+#define NW_SAFETY_MAX_CHANNELS              (16u)
+
+/**
+ * \brief Maximum number of channels with I2t limits.
+ */
+#define NW_SAFETY_MAX_I2T_CHANNELS          (4u)
+
+/**
+ * \brief Maximum level of the samples and the limits, given by the guard bit of the packed comparison.
+ */
+#define NW_SAFETY_MAX_LEVEL                 (0x7FFFu)
+
+/**
+ * \brief Resolution of the ADC samples, whose full scale corresponds to the voltage and current base of the topology.
+ */
+#ifndef NW_SAFETY_ADC_RESOLUTION_BITS
+#define NW_SAFETY_ADC_RESOLUTION_BITS       (12u)
+#endif
+
+/**
+ * \brief Macro converting a non-negative Q15 value, normalized to the base, to the ADC code of a unipolar sensing chain.
+ */
+#define NW_SAFETY_Q15_TO_LEVEL(value) \
+    ((NwAdcSample)((uint32)(value) >> (NW_Q15_FRAC_BITS - NW_SAFETY_ADC_RESOLUTION_BITS)))
+
+/**
+ * \brief Instantaneous limits of the sensing points, derived at compile time from the operating limits of the
+ * selected topology (see topology_config.h). Intended as the entries of the channel limits table, e.g.
+ * static const NexaWattSafetyChannelLimits channelLimits[] = { NW_SAFETY_TOPOLOGY_VIN_LIMITS, NW_SAFETY_TOPOLOGY_VOUT_LIMITS };
+ */
+#define NW_SAFETY_TOPOLOGY_VIN_LIMITS \
+    { NW_SAFETY_Q15_TO_LEVEL(NW_TOPOLOGY_VIN_MIN), NW_SAFETY_Q15_TO_LEVEL(NW_TOPOLOGY_VIN_MAX) }
+#define NW_SAFETY_TOPOLOGY_VOUT_LIMITS \
+    { 0u, NW_SAFETY_Q15_TO_LEVEL(NW_TOPOLOGY_VOUT_MAX) }
+#define NW_SAFETY_TOPOLOGY_CURRENT_LIMITS \
+    { 0u, NW_SAFETY_Q15_TO_LEVEL(NW_TOPOLOGY_CURRENT_MAX) }
+
+#if (NW_SAFETY_ADC_RESOLUTION_BITS > NW_Q15_FRAC_BITS)
+#error "The ADC resolution exceeds the maximum level of the safety checker"
+#endif
+
+/**
+ * \brief Maximum trip energy of an I2t limit. Leaves headroom for one cycle at the maximum level above the trip energy.
+ */
+#define NW_SAFETY_MAX_I2T_ENERGY            (0x7FFFFFFFu - (NW_SAFETY_MAX_LEVEL * NW_SAFETY_MAX_LEVEL))
+
+/**
+ * \brief Fault mask bits: bit n for the instantaneous limits of channel n, followed by the I2t limits.
+ */
+#define NW_SAFETY_FAULT_CHANNEL(channel) \
+    ((uint32)0x01u << (channel))
+#define NW_SAFETY_FAULT_I2T(i2tIdx) \
+    ((uint32)0x01u << (NW_SAFETY_MAX_CHANNELS + (i2tIdx)))
+
+/**
+ * \brief Fault mask bit of the control-loop timing, forced by the timing watchdog (see safety_checker_watchdog.h).
+ */
+#define NW_SAFETY_FAULT_TIMING              ((uint32)0x01u << 31u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+typedef enum eNexaWattSafetyStatusResult
+{
+    NW_SAFETY_SUCCESS       = 0u,
+    NW_SAFETY_BAD_PARAM     = 1u,
+    NW_SAFETY_FAULT_ACTIVE  = 2u,
+} NexaWattSafetyStatusResult;
+
+/**
+ * \brief Instantaneous limits of a channel in ADC codes. A sample outside [lowerLimit, upperLimit] is a fault.
+ * A channel without limits uses [0, NW_SAFETY_MAX_LEVEL].
+ */
+typedef struct sNexaWattSafetyChannelLimits
+{
+    NwAdcSample lowerLimit;
+    NwAdcSample upperLimit;
+} NexaWattSafetyChannelLimits;
+
+/**
+ * \brief I2t limit of a current channel. Every cycle, the energy is increased by sample^2 - ratedLevel^2
+ * and limited to 0 from below, so the energy only builds up above the rated level and is released below it.
+ * The channel trips when the energy exceeds the trip energy, e.g. for a constant sample I after
+ * tripEnergy / (I^2 - ratedLevel^2) cycles.
+ */
+typedef struct sNexaWattSafetyI2tLimit
+{
+    uint8 channel;
+    NwAdcSample ratedLevel;
+    uint32 tripEnergy;
+} NexaWattSafetyI2tLimit;
+
+typedef struct sNexaWattSafetyConfig
+{
+    const NexaWattSafetyChannelLimits* channelLimits;
+    uint8 channelCnt;
+    const NexaWattSafetyI2tLimit* i2tLimits;
+    uint8 i2tCnt;
+    uint8 gateDisablePort;
+    uint8 gateDisablePinMask;
+    nw_bool gateDisableLevel;
+} NexaWattSafetyConfig;
+
+typedef struct sNexaWattSafetyI2tChannel
+{
+    uint8 channel;
+    int32 ratedSquare;
+    int32 tripEnergy;
+    int32 energy;
+} NexaWattSafetyI2tChannel;
+
+/**
+ * \brief State of the safety checker. The latched faults are kept until cleared; the active faults are the ones of the last pass.
+ */
+typedef struct sNexaWattSafetyChecker
+{
+    uint32 upperLimitsPacked[NW_SAFETY_MAX_CHANNELS / 2u];
+    uint32 lowerLimitsPacked[NW_SAFETY_MAX_CHANNELS / 2u];
+    uint8 channelCnt;
+    NexaWattSafetyI2tChannel i2tChannels[NW_SAFETY_MAX_I2T_CHANNELS];
+    uint8 i2tCnt;
+    uint8 gateDisablePort;
+    uint8 gateDisablePinMask;
+    nw_bool gateDisableLevel;
+    nw_bool isTripped;
+    volatile uint32 latchedFaults;
+    uint32 activeFaults;
+    volatile uint32 forcedFaults;
+    uint32 tripCnt;
+    uint32 lastCheckCycles;
+    uint32 maxCheckCycles;
+    uint32 maxTripCycles;
+} NexaWattSafetyChecker;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Function used to initialize a safety checker. The limits are packed and the statistics cleared.
+ * The gate disable pins must be configured as outputs; they are not written by the initialization.
+ * \param checker - A pointer to the checker to be initialized.
+ * \param safetyConfig - A pointer to the configuration of the checker.
+ * \return NW_SAFETY_BAD_PARAM - A pointer is NULL, a count exceeds its maximum, a limit exceeds NW_SAFETY_MAX_LEVEL,
+ * a lower limit exceeds its upper limit, an I2t channel is not one of the checked channels or its trip energy exceeds NW_SAFETY_MAX_I2T_ENERGY.
+ * \return NW_SAFETY_SUCCESS - The checker is ready.
+ */
+NexaWattSafetyStatusResult NexaWatt_SafetyChecker_Init(NexaWattSafetyChecker* checker, const NexaWattSafetyConfig* safetyConfig);
+
+/**
+ * \brief Executes a check pass on an ADC frame. On the first fault the gate disable pins are written and the fault latched.
+ * The function performs no validation of the pointers and is intended to be executed in the control ISR.
+ * \param checker - A pointer to an initialized checker.
+ * \param samples - The samples of the ADC frame, sample n belonging to channel n. Must contain at least the configured channels.
+ * \return nwTrue - No fault is latched, the gates are enabled.
+ * \return nwFalse - A fault is latched, the gates are disabled.
+ */
+nw_bool NexaWatt_SafetyChecker_Check(NexaWattSafetyChecker* checker, const NwAdcSample* samples);
+
+/**
+ * \brief Protection stage of the control pipeline, executing a check pass on the samples of the pipeline.
+ * \param stageContext - A pointer to an initialized checker.
+ * \param signals - The signals of the pipeline.
+ * \return nwTrue - No fault is latched, the chain continues.
+ * \return nwFalse - A fault is latched and the gates are disabled, the chain ends.
+ */
+nw_bool NexaWatt_SafetyChecker_Pipeline_Stage(void* stageContext, NexaWattPipelineSignals* signals);
+
+/**
+ * \brief Function used by another monitor (e.g. the timing watchdog) to trip the checker: the faults are latched and,
+ * if the checker is not tripped yet, the gate disable pins are written. The faults stay active until released by the monitor.
+ * Can be used from any context.
+ * \param checker - A pointer to an initialized checker.
+ * \param faultMask - The forced faults. Must not contain the bits of the checked channels.
+ * \return NW_SAFETY_BAD_PARAM - The pointer is NULL or the mask is invalid.
+ * \return NW_SAFETY_SUCCESS - The faults are latched and the gates are disabled.
+ */
+NexaWattSafetyStatusResult NexaWatt_SafetyChecker_Force_Trip(NexaWattSafetyChecker* checker, uint32 faultMask);
+
+/**
+ * \brief Function used by a monitor to release its forced faults, once their cause is removed. The faults stay latched until cleared.
+ * \param checker - A pointer to an initialized checker.
+ * \param faultMask - The released faults.
+ * \return NW_SAFETY_BAD_PARAM - The pointer is NULL.
+ * \return NW_SAFETY_SUCCESS - The faults are released.
+ */
+NexaWattSafetyStatusResult NexaWatt_SafetyChecker_Release_Forced_Faults(NexaWattSafetyChecker* checker, uint32 faultMask);
+
+/**
+ * \brief Function used to clear the latched faults, once none of them is active anymore. The gates are not enabled
+ * by the checker; this is left to the state handling of the application. The I2t energies are kept.
+ * \param checker - A pointer to an initialized checker.
+ * \return NW_SAFETY_BAD_PARAM - The pointer is NULL.
+ * \return NW_SAFETY_FAULT_ACTIVE - A fault was active in the last pass or a forced fault is not released. The faults stay latched.
+ * \return NW_SAFETY_SUCCESS - The faults are cleared.
+ */
+NexaWattSafetyStatusResult NexaWatt_SafetyChecker_Clear_Faults(NexaWattSafetyChecker* checker);
+
+/**
+ * \brief Function used to reset the execution time statistics of a checker.
+ * \param checker - A pointer to an initialized checker.
+ */
+void NexaWatt_SafetyChecker_Reset_Timing(NexaWattSafetyChecker* checker);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/**
+ * \brief Returns the latched faults of a checker.
+ * \param checker - A pointer to an initialized checker.
+ * \return The latched fault mask (see NW_SAFETY_FAULT_CHANNEL() and NW_SAFETY_FAULT_I2T()).
+ */
+NW_LOCAL_INLINE uint32 NexaWatt_SafetyChecker_Get_Faults(const NexaWattSafetyChecker* const checker)
+{
+    return checker->latchedFaults;
+}
+
+#endif
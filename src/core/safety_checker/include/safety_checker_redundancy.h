@@ -0,0 +1,199 @@
+/*******************************************************************************
+* File Name:   safety_checker_redundancy.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the redundancy plausibility checks of the safety checker. A redundancy
+* group declares two or three measurements of the same quantity, e.g. the output
+* current measured by a shunt and by a Hall sensor, or the input voltage measured
+* directly and derived from other signals. The members are measurements of the
+* control pipeline, so they are scaled to the same Q15 unit by the scaling stages.
+* The control ISR only accumulates the members over a window of 2^windowShift periods
+* (sum, minimum and maximum), which costs a few operations per member. At the end of
+* a window the accumulators are copied, and the groups are evaluated one per period
+* during the next window, so the checks run at a rate far below the control rate
+* and never evaluate more than one group in a period.
+* An evaluation compares the window average of every member with the group reference
+* (the mean of two, the median of three members) within a tolerance window of an absolute
+* and a relative part, which catches the drift of a sensor. A member, whose window span
+* stays below the stuck span while another member shows at least the activity span, is
+* stuck. A group fails only after faultDebounceCnt failing windows in a row and heals after
+* healDebounceCnt passing windows in a row. The changes are posted as deferred events and,
+* if configured, a failed group trips the safety checker with NW_SAFETY_FAULT_REDUNDANCY().
+* Typical usage as a protection stage of the control pipeline:
+* NexaWatt_DigitalController_Pipeline_Register_Stage(&pipeline, NW_PIPELINE_STAGE_PROTECT, NexaWatt_SafetyChecker_Redundancy_Pipeline_Stage, &redundancy);
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_SAFETY_CHECKER_REDUNDANCY_H
+#define NEXAWATT_IV_DC_SAFETY_CHECKER_REDUNDANCY_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+#include "platform_fixed_point.h"
+#include "safety_checker.h"
+#include "digital_controller_pipeline.h"
+#include "nexa_mini_os_event.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Maximum number of redundancy groups and of members of a group.
+ */
+#define NW_SAFETY_RED_MAX_GROUPS            (4u)
+#define NW_SAFETY_RED_MAX_MEMBERS           (3u)
+
+/**
+ * \brief Maximum window length, as the power of two of the control periods.
+ */
+#define NW_SAFETY_RED_MAX_WINDOW_SHIFT      (10u)
+
+/**
+ * \brief Fault mask bit of a redundancy group, forced in the safety checker by a failed group.
+ */
+#define NW_SAFETY_FAULT_REDUNDANCY(groupIdx) \
+    ((uint32)0x01u << (NW_SAFETY_MAX_CHANNELS + NW_SAFETY_MAX_I2T_CHANNELS + (groupIdx)))
+
+/**
+ * \brief Macros used to build and decode the argument of the group events: the group, the mask
+ * of the suspected members (bit n for member n) and the new state of the group.
+ */
+#define NW_SAFETY_RED_EVENT_ARG(groupIdx, memberMask, isFaulty) \
+    (((uint32)(groupIdx) << 8u) | (uint32)(memberMask) | ((uint32)(isFaulty) << 16u))
+#define NW_SAFETY_RED_EVENT_GET_GROUP(eventArg) \
+    ((uint8)((eventArg) >> 8u))
+#define NW_SAFETY_RED_EVENT_GET_MEMBERS(eventArg) \
+    ((uint8)(eventArg))
+#define NW_SAFETY_RED_EVENT_GET_FAULTY(eventArg) \
+    ((nw_bool)(((eventArg) >> 16u) & 0x01u))
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+/**
+ * \brief Configuration of a redundancy group. The members are indices of the pipeline measurements.
+ * The relative tolerance is a Q15 fraction of the reference. An activity span of 0 disables the stuck detection.
+ */
+typedef struct sNexaWattSafetyRedundancyGroupConfig
+{
+    uint8 memberSignals[NW_SAFETY_RED_MAX_MEMBERS];
+    uint8 memberCnt;
+    NwQ15 absTolerance;
+    NwQ15 relTolerance;
+    NwQ15 stuckSpan;
+    NwQ15 activitySpan;
+    uint8 faultDebounceCnt;
+    uint8 healDebounceCnt;
+    nw_bool tripOnFault;
+} NexaWattSafetyRedundancyGroupConfig;
+
+/**
+ * \brief Configuration of the redundancy checks. The window must hold at least one period per group.
+ * The safety checker is required only by the groups tripping on a fault, the notification handler is optional.
+ */
+typedef struct sNexaWattSafetyRedundancyConfig
+{
+    const NexaWattSafetyRedundancyGroupConfig* groups;
+    uint8 groupCnt;
+    uint8 windowShift;
+    NexaWattSafetyChecker* safetyChecker;
+    NwMiniOsEventHandler notifyHandler;
+    void* notifyContext;
+} NexaWattSafetyRedundancyConfig;
+
+typedef struct sNexaWattSafetyRedundancyWindow
+{
+    int32 sum;
+    NwQ15 minValue;
+    NwQ15 maxValue;
+} NexaWattSafetyRedundancyWindow;
+
+/**
+ * \brief Statistics of a redundancy group: the evaluated windows and the windows failing the tolerance or the stuck test.
+ */
+typedef struct sNexaWattSafetyRedundancyStats
+{
+    uint32 evaluationCnt;
+    uint32 mismatchCnt;
+    uint32 stuckCnt;
+    NwQ15 maxDeviation;
+} NexaWattSafetyRedundancyStats;
+
+typedef struct sNexaWattSafetyRedundancyGroup
+{
+    NexaWattSafetyRedundancyGroupConfig config;
+    NexaWattSafetyRedundancyWindow accumulators[NW_SAFETY_RED_MAX_MEMBERS];
+    NexaWattSafetyRedundancyWindow snapshots[NW_SAFETY_RED_MAX_MEMBERS];
+    uint8 debounceCnt;
+    uint8 suspectMembers;
+    volatile nw_bool isFaulty;
+    NexaWattSafetyRedundancyStats stats;
+} NexaWattSafetyRedundancyGroup;
+
+typedef struct sNexaWattSafetyRedundancy
+{
+    NexaWattSafetyRedundancyGroup groups[NW_SAFETY_RED_MAX_GROUPS];
+    uint8 groupCnt;
+    uint8 windowShift;
+    uint16 periodIdx;
+    nw_bool hasSnapshots;
+    NexaWattSafetyChecker* safetyChecker;
+    NwMiniOsEventHandler notifyHandler;
+    void* notifyContext;
+} NexaWattSafetyRedundancy;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Function used to initialize the redundancy checks. The first evaluation follows the first complete window.
+ * \param redundancy - A pointer to the redundancy checks to be initialized.
+ * \param redundancyConfig - A pointer to the configuration.
+ * \return NW_SAFETY_BAD_PARAM - A pointer is NULL, a count exceeds its maximum, a member is not a pipeline measurement,
+ * a tolerance or a debounce count is invalid, the window is too short or a tripping group has no safety checker.
+ * \return NW_SAFETY_SUCCESS - The redundancy checks are ready.
+ */
+NexaWattSafetyStatusResult NexaWatt_SafetyChecker_Redundancy_Init(NexaWattSafetyRedundancy* redundancy, const NexaWattSafetyRedundancyConfig* redundancyConfig);
+
+/**
+ * \brief Protection stage of the control pipeline, accumulating the members and evaluating at most one group.
+ * \param stageContext - A pointer to the initialized redundancy checks.
+ * \param signals - The signals of the pipeline, containing the scaled measurements.
+ * \return nwTrue - No tripping group is failed, the chain continues.
+ * \return nwFalse - A tripping group is failed and the gates are disabled, the chain ends.
+ */
+nw_bool NexaWatt_SafetyChecker_Redundancy_Pipeline_Stage(void* stageContext, NexaWattPipelineSignals* signals);
+
+/**
+ * \brief Function used to obtain the statistics of a redundancy group.
+ * \param redundancy - A pointer to the initialized redundancy checks.
+ * \param groupIdx - The index of the group.
+ * \param redundancyStats - A pointer to the structure, where the statistics are copied.
+ * \return NW_SAFETY_BAD_PARAM - A pointer is NULL or the group does not exist.
+ * \return NW_SAFETY_SUCCESS - The statistics are copied.
+ */
+NexaWattSafetyStatusResult NexaWatt_SafetyChecker_Redundancy_Get_Stats(const NexaWattSafetyRedundancy* redundancy, uint8 groupIdx, NexaWattSafetyRedundancyStats* redundancyStats);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/**
+ * \brief Returns the failed state of a redundancy group.
+ * \param redundancy - A pointer to the initialized redundancy checks.
+ * \param groupIdx - The index of an existing group.
+ * \return nwTrue - The group is failed. nwFalse - The group is healthy.
+ */
+NW_LOCAL_INLINE nw_bool NexaWatt_SafetyChecker_Redundancy_Is_Faulty(const NexaWattSafetyRedundancy* const redundancy, const uint8 groupIdx)
+{
+    return redundancy->groups[groupIdx].isFaulty;
+}
+
+#endif
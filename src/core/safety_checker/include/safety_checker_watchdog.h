@@ -0,0 +1,232 @@
+/*******************************************************************************
+* File Name:   safety_checker_watchdog.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the timing watchdog of the safety checker. The watchdog supervises
+* the control interrupt: every period must start within a window around its nominal
+* start (period +/- tolerances) and its execution must finish within the budget.
+* An early or late start, a missed period and an overrun are violations; they are
+* counted, together with the start jitter and the execution time.
+* The violations escalate through the configured levels, e.g. a notification of the
+* application, then the safe shutdown (the safety checker is tripped and the gates
+* are disabled) and finally a reset by the hardware watchdog. A violated period raises
+* the violation score by NW_SAFETY_WDG_VIOLATION_WEIGHT, a clean period lowers it by one,
+* so sporadic violations fade out, while violations in more than a third of the periods
+* escalate. The level is kept until the watchdog is reset.
+* The hardware watchdog is kicked from the control interrupt, every kick divider periods,
+* provided the main loop polled the watchdog since the last kick. It therefore resets
+* the device, when either the control interrupt or the main loop stops. A control interrupt,
+* which stops without a reset (e.g. a stopped timer), is detected by the poll of the main loop.
+* The time base is the CPU cycle counter (see platform_cycle_counter.h).
+* Typical usage in the control ISR:
+* NexaWatt_SafetyChecker_Watchdog_Period_Start(&watchdog);
+* (void)NexaWatt_DigitalController_Pipeline_Execute(&pipeline, samples, sampleCnt);
+* NexaWatt_SafetyChecker_Watchdog_Period_End(&watchdog);
+* and in the main loop:
+* NexaWatt_SafetyChecker_Watchdog_Poll(&watchdog);
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_SAFETY_CHECKER_WATCHDOG_H
+#define NEXAWATT_IV_DC_SAFETY_CHECKER_WATCHDOG_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+#include "safety_checker.h"
+#include "nexa_mini_os_event.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Maximum number of escalation levels.
+ */
+#define NW_SAFETY_WDG_MAX_LEVELS            (4u)
+
+/**
+ * \brief Increase of the violation score on a violated period. A clean period decreases the score by one.
+ */
+#define NW_SAFETY_WDG_VIOLATION_WEIGHT      (2u)
+
+/**
+ * \brief Violation flags of a period.
+ */
+#define NW_SAFETY_WDG_VIOLATION_EARLY       (0x01u)
+#define NW_SAFETY_WDG_VIOLATION_LATE        (0x02u)
+#define NW_SAFETY_WDG_VIOLATION_OVERRUN     (0x04u)
+#define NW_SAFETY_WDG_VIOLATION_STALL       (0x08u)
+
+/**
+ * \brief Macros used to build and decode the argument of the notification event:
+ * the reached level (1 for the first configured level) and the violation flags of the escalating period.
+ */
+#define NW_SAFETY_WDG_EVENT_ARG(level, violationFlags) \
+    (((uint32)(level) << 8u) | (uint32)(violationFlags))
+#define NW_SAFETY_WDG_EVENT_GET_LEVEL(eventArg) \
+    ((uint8)((eventArg) >> 8u))
+#define NW_SAFETY_WDG_EVENT_GET_VIOLATIONS(eventArg) \
+    ((uint8)(eventArg))
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+typedef enum eNexaWattSafetyWatchdogAction
+{
+    NW_SAFETY_WDG_ACTION_NOTIFY         = 0x00u,
+    NW_SAFETY_WDG_ACTION_SAFE_SHUTDOWN  = 0x01u,
+    NW_SAFETY_WDG_ACTION_RESET          = 0x02u,
+} NexaWattSafetyWatchdogAction;
+
+/**
+ * \brief Escalation level. The level is reached after violationCnt violated periods in a row.
+ * NOTIFY posts the notification event, SAFE_SHUTDOWN trips the safety checker with NW_SAFETY_FAULT_TIMING,
+ * RESET trips the safety checker and stops kicking the hardware watchdog.
+ */
+typedef struct sNexaWattSafetyWatchdogLevel
+{
+    uint16 violationCnt;
+    NexaWattSafetyWatchdogAction action;
+} NexaWattSafetyWatchdogLevel;
+
+/**
+ * \brief Configuration of the timing watchdog. The times are in CPU cycles.
+ * The levels must be ordered by their violation count and the last one must be SAFE_SHUTDOWN or RESET.
+ * A hardware timeout of 0 leaves the hardware watchdog unused, which excludes the RESET action.
+ * The hardware timeout must cover the kick divider periods and the longest iteration of the main loop.
+ */
+typedef struct sNexaWattSafetyWatchdogConfig
+{
+    uint32 periodCycles;
+    uint32 earlyToleranceCycles;
+    uint32 lateToleranceCycles;
+    uint32 budgetCycles;
+    uint32 stallCycles;
+    const NexaWattSafetyWatchdogLevel* levels;
+    uint8 levelCnt;
+    NexaWattSafetyChecker* safetyChecker;
+    NwMiniOsEventHandler notifyHandler;
+    void* notifyContext;
+    uint32 hardwareTimeoutUs;
+    uint16 kickDivider;
+} NexaWattSafetyWatchdogConfig;
+
+/**
+ * \brief Statistics of the timing watchdog. The jitter is the deviation of the start interval from the period.
+ */
+typedef struct sNexaWattSafetyWatchdogStats
+{
+    uint32 periodCnt;
+    uint32 earlyStartCnt;
+    uint32 lateStartCnt;
+    uint32 missedPeriodCnt;
+    uint32 overrunCnt;
+    uint32 stallCnt;
+    uint32 lastJitterCycles;
+    uint32 maxJitterCycles;
+    uint32 lastExecCycles;
+    uint32 maxExecCycles;
+} NexaWattSafetyWatchdogStats;
+
+typedef struct sNexaWattSafetyWatchdog
+{
+    uint32 periodCycles;
+    uint32 minIntervalCycles;
+    uint32 maxIntervalCycles;
+    uint32 budgetCycles;
+    uint32 stallCycles;
+    NexaWattSafetyWatchdogLevel levels[NW_SAFETY_WDG_MAX_LEVELS];
+    uint8 levelCnt;
+    NexaWattSafetyChecker* safetyChecker;
+    NwMiniOsEventHandler notifyHandler;
+    void* notifyContext;
+    nw_bool useHardwareWdt;
+    uint16 kickDivider;
+    uint16 kickCnt;
+    volatile nw_bool isMainLoopAlive;
+    volatile nw_bool hasStarted;
+    volatile uint32 lastStartCycles;
+    uint8 periodViolations;
+    uint32 violationScore;
+    uint32 maxViolationScore;
+    volatile uint8 level;
+    volatile nw_bool isShutdown;
+    volatile nw_bool isKickStopped;
+    NexaWattSafetyWatchdogStats stats;
+} NexaWattSafetyWatchdog;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Function used to initialize a timing watchdog. The hardware watchdog is started, if configured.
+ * The supervision starts with the first period.
+ * \param watchdog - A pointer to the watchdog to be initialized.
+ * \param watchdogConfig - A pointer to the configuration of the watchdog.
+ * \return NW_SAFETY_BAD_PARAM - A pointer is NULL, the period or the budget is 0, the tolerances exceed the period,
+ * the levels are invalid or the hardware watchdog failed to start.
+ * \return NW_SAFETY_SUCCESS - The watchdog is ready.
+ */
+NexaWattSafetyStatusResult NexaWatt_SafetyChecker_Watchdog_Init(NexaWattSafetyWatchdog* watchdog, const NexaWattSafetyWatchdogConfig* watchdogConfig);
+
+/**
+ * \brief Marks the start of a control period. Must be the first call of the control ISR.
+ * The function performs no validation of the pointer.
+ * \param watchdog - A pointer to an initialized watchdog.
+ */
+void NexaWatt_SafetyChecker_Watchdog_Period_Start(NexaWattSafetyWatchdog* watchdog);
+
+/**
+ * \brief Marks the end of a control period. Must be the last call of the control ISR. Evaluates the period,
+ * escalates and kicks the hardware watchdog. The function performs no validation of the pointer.
+ * \param watchdog - A pointer to an initialized watchdog.
+ * \return nwTrue - The watchdog did not reach a shutdown level.
+ * \return nwFalse - The safe shutdown is active.
+ */
+nw_bool NexaWatt_SafetyChecker_Watchdog_Period_End(NexaWattSafetyWatchdog* watchdog);
+
+/**
+ * \brief Function periodically called by the main loop. Confirms the main loop to the kick of the hardware watchdog
+ * and shuts down, when the control interrupt did not start for the stall time.
+ * \param watchdog - A pointer to an initialized watchdog.
+ */
+void NexaWatt_SafetyChecker_Watchdog_Poll(NexaWattSafetyWatchdog* watchdog);
+
+/**
+ * \brief Function used to return the watchdog to the level 0, e.g. after the cause of the violations is removed.
+ * The forced timing fault of the safety checker is released; the latched faults must be cleared by the application.
+ * The statistics are kept and the supervision restarts with the next period.
+ * \param watchdog - A pointer to an initialized watchdog.
+ * \return NW_SAFETY_BAD_PARAM - The pointer is NULL.
+ * \return NW_SAFETY_SUCCESS - The watchdog is reset.
+ */
+NexaWattSafetyStatusResult NexaWatt_SafetyChecker_Watchdog_Reset(NexaWattSafetyWatchdog* watchdog);
+
+/**
+ * \brief Function used to obtain the statistics of a watchdog.
+ * \param watchdog - A pointer to an initialized watchdog.
+ * \param watchdogStats - A pointer to the structure, where the statistics are copied.
+ */
+void NexaWatt_SafetyChecker_Watchdog_Get_Stats(const NexaWattSafetyWatchdog* watchdog, NexaWattSafetyWatchdogStats* watchdogStats);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/**
+ * \brief Returns the escalation level of a watchdog.
+ * \param watchdog - A pointer to an initialized watchdog.
+ * \return 0 - No level is reached. n - The configured level n-1 is reached.
+ */
+NW_LOCAL_INLINE uint8 NexaWatt_SafetyChecker_Watchdog_Get_Level(const NexaWattSafetyWatchdog* const watchdog)
+{
+    return watchdog->level;
+}
+
+#endif
@@ -0,0 +1,358 @@
+/*******************************************************************************
+* File Name:   safety_checker.c
+*
+* Description: This is the source file containing definitions,
+* related to the safety checker (fault protection) of the NexaWatt-IV.DC framework.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "safety_checker.h"
+#include "hal_wrapper_gpio.h"
+#include "platform_critical_section.h"
+#include "platform_cycle_counter.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Guard bits of the packed comparison, the bit 15 of both half-words.
+ */
+#define NW_SAFETY_GUARD_MSK                 (0x80008000u)
+
+/**
+ * \brief Macro packing two 16-bit values into a word, the first one in the lower half-word.
+ */
+#define NW_SAFETY_PACK(lowValue, highValue) \
+    ((uint32)(lowValue) | ((uint32)(highValue) << 16u))
+
+NW_STATIC_ASSERT((NW_SAFETY_MAX_CHANNELS + NW_SAFETY_MAX_I2T_CHANNELS) <= 32u, safety_fault_mask_width);
+NW_STATIC_ASSERT((NW_SAFETY_MAX_CHANNELS + NW_SAFETY_MAX_I2T_CHANNELS) < 31u, safety_fault_mask_timing_bit);
+NW_STATIC_ASSERT((NW_SAFETY_MAX_CHANNELS & 0x01u) == 0u, safety_channels_even);
+
+/**
+ * \brief Fault mask bits, which are set by the check pass and cannot be forced.
+ */
+#define NW_SAFETY_CHECKED_FAULTS_MSK \
+    (NW_SAFETY_FAULT_I2T(NW_SAFETY_MAX_I2T_CHANNELS) - 1u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that compares a packed pair of samples against the packed limits.
+ * \param samplesPacked - The packed samples.
+ * \param lowerPacked - The packed lower limits.
+ * \param upperPacked - The packed upper limits.
+ * \return The violating channels of the pair in bits 0 and 1.
+ */
+NW_LOCAL_INLINE uint32 NexaWatt_SafetyChecker_Compare_Pair(uint32 samplesPacked, uint32 lowerPacked, uint32 upperPacked);
+
+/**
+ * \brief Simple helper function that limits a sample to NW_SAFETY_MAX_LEVEL without a branch.
+ * \param sample - The raw sample.
+ * \return The limited sample.
+ */
+NW_LOCAL_INLINE uint32 NexaWatt_SafetyChecker_Limit_Sample(NwAdcSample sample);
+
+/**
+ * \brief Simple helper function that validates the configuration of a checker.
+ * \param safetyConfig - A pointer to the configuration.
+ * \return nwTrue - The configuration is valid.
+ * \return nwFalse - The configuration is invalid.
+ */
+static nw_bool NexaWatt_SafetyChecker_Validate_Config(const NexaWattSafetyConfig* safetyConfig);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattSafetyStatusResult NexaWatt_SafetyChecker_Init(NexaWattSafetyChecker* const checker, const NexaWattSafetyConfig* const safetyConfig)
+{
+    NexaWattSafetyStatusResult retRes = NW_SAFETY_BAD_PARAM;
+    const NexaWattSafetyChannelLimits* lowLimits = NULL;
+    const NexaWattSafetyChannelLimits* highLimits = NULL;
+    uint8 pairIdx = 0u;
+    uint8 i2tIdx = 0u;
+
+    if ((checker != NULL) &&
+        (NexaWatt_SafetyChecker_Validate_Config(safetyConfig) == nwTrue))
+    {
+        // The unused channels of the pairs get the widest limits, so they never report a fault
+        for (pairIdx = 0u; pairIdx < (NW_SAFETY_MAX_CHANNELS / 2u); pairIdx++)
+        {
+            checker->lowerLimitsPacked[pairIdx] = NW_SAFETY_PACK(0u, 0u);
+            checker->upperLimitsPacked[pairIdx] = NW_SAFETY_PACK(NW_SAFETY_MAX_LEVEL, NW_SAFETY_MAX_LEVEL);
+        }
+
+        for (pairIdx = 0u; (2u * pairIdx) < safetyConfig->channelCnt; pairIdx++)
+        {
+            lowLimits = &safetyConfig->channelLimits[2u * pairIdx];
+            if (((2u * pairIdx) + 1u) < safetyConfig->channelCnt)
+            {
+                highLimits = &safetyConfig->channelLimits[(2u * pairIdx) + 1u];
+                checker->lowerLimitsPacked[pairIdx] = NW_SAFETY_PACK(lowLimits->lowerLimit, highLimits->lowerLimit);
+                checker->upperLimitsPacked[pairIdx] = NW_SAFETY_PACK(lowLimits->upperLimit, highLimits->upperLimit);
+            }
+            else
+            {
+                checker->lowerLimitsPacked[pairIdx] = NW_SAFETY_PACK(lowLimits->lowerLimit, 0u);
+                checker->upperLimitsPacked[pairIdx] = NW_SAFETY_PACK(lowLimits->upperLimit, NW_SAFETY_MAX_LEVEL);
+            }
+        }
+        checker->channelCnt = safetyConfig->channelCnt;
+
+        for (i2tIdx = 0u; i2tIdx < safetyConfig->i2tCnt; i2tIdx++)
+        {
+            checker->i2tChannels[i2tIdx].channel = safetyConfig->i2tLimits[i2tIdx].channel;
+            checker->i2tChannels[i2tIdx].ratedSquare = (int32)safetyConfig->i2tLimits[i2tIdx].ratedLevel * (int32)safetyConfig->i2tLimits[i2tIdx].ratedLevel;
+            checker->i2tChannels[i2tIdx].tripEnergy = (int32)safetyConfig->i2tLimits[i2tIdx].tripEnergy;
+            checker->i2tChannels[i2tIdx].energy = 0;
+        }
+        checker->i2tCnt = safetyConfig->i2tCnt;
+
+        checker->gateDisablePort = safetyConfig->gateDisablePort;
+        checker->gateDisablePinMask = safetyConfig->gateDisablePinMask;
+        checker->gateDisableLevel = safetyConfig->gateDisableLevel;
+        checker->isTripped = nwFalse;
+        checker->latchedFaults = 0u;
+        checker->activeFaults = 0u;
+        checker->forcedFaults = 0u;
+        checker->tripCnt = 0u;
+
+        NexaWatt_SafetyChecker_Reset_Timing(checker);
+
+        retRes = NW_SAFETY_SUCCESS;
+    }
+
+    return retRes;
+}
+
+nw_bool NexaWatt_SafetyChecker_Check(NexaWattSafetyChecker* const checker, const NwAdcSample* const samples)
+{
+    uint32 startCycles = NexaWatt_Platform_Cycle_Counter_Get();
+    uint32 endCycles = 0u;
+    uint32 faults = 0u;
+    uint32 samplesPacked = 0u;
+    uint32 tripBit = 0u;
+    uint8 fullPairCnt = checker->channelCnt / 2u;
+    uint8 pairIdx = 0u;
+    uint8 i2tIdx = 0u;
+    NexaWattSafetyI2tChannel* i2tChannel = NULL;
+    int32 sample = 0;
+    int32 energy = 0;
+
+    // Constant-time pass: the loops depend on the configuration only, never on the samples
+    for (pairIdx = 0u; pairIdx < fullPairCnt; pairIdx++)
+    {
+        samplesPacked = NW_SAFETY_PACK(NexaWatt_SafetyChecker_Limit_Sample(samples[2u * pairIdx]),
+                                       NexaWatt_SafetyChecker_Limit_Sample(samples[(2u * pairIdx) + 1u]));
+        faults |= NexaWatt_SafetyChecker_Compare_Pair(samplesPacked, checker->lowerLimitsPacked[pairIdx], checker->upperLimitsPacked[pairIdx]) << (2u * pairIdx);
+    }
+
+    // An odd last channel is paired with a zero sample, which always passes its padding limits
+    if ((checker->channelCnt & 0x01u) != 0u)
+    {
+        samplesPacked = NW_SAFETY_PACK(NexaWatt_SafetyChecker_Limit_Sample(samples[2u * fullPairCnt]), 0u);
+        faults |= NexaWatt_SafetyChecker_Compare_Pair(samplesPacked, checker->lowerLimitsPacked[fullPairCnt], checker->upperLimitsPacked[fullPairCnt]) << (2u * fullPairCnt);
+    }
+
+    for (i2tIdx = 0u; i2tIdx < checker->i2tCnt; i2tIdx++)
+    {
+        i2tChannel = &checker->i2tChannels[i2tIdx];
+        // The limited sample keeps the square within 30 bits
+        sample = (int32)NexaWatt_SafetyChecker_Limit_Sample(samples[i2tChannel->channel]);
+
+        // The energy is limited to [0, tripEnergy] after the trip test, so the sum of the next cycle cannot overflow
+        energy = i2tChannel->energy + ((sample * sample) - i2tChannel->ratedSquare);
+        energy &= (int32)(((uint32)energy >> 31u) - 1u);
+        tripBit = (uint32)(i2tChannel->tripEnergy - energy) >> 31u;
+        energy -= (energy - i2tChannel->tripEnergy) & (int32)(0u - tripBit);
+        i2tChannel->energy = energy;
+
+        faults |= tripBit << (NW_SAFETY_MAX_CHANNELS + i2tIdx);
+    }
+
+    checker->activeFaults = faults;
+
+    // Sample-dependent trip path: its worst case, the check pass plus the gate write, is measured by maxTripCycles
+    if ((faults != 0u) &&
+        (checker->isTripped == nwFalse))
+    {
+        (void)NexaWatt_HalWrapperGpio_Port_Write(checker->gateDisablePort, checker->gateDisablePinMask, checker->gateDisableLevel);
+        checker->isTripped = nwTrue;
+        checker->tripCnt++;
+
+        endCycles = NexaWatt_Platform_Cycle_Counter_Get();
+        checker->maxTripCycles = ((endCycles - startCycles) > checker->maxTripCycles) ? (endCycles - startCycles) : checker->maxTripCycles;
+    }
+
+    checker->latchedFaults |= faults;
+
+    endCycles = NexaWatt_Platform_Cycle_Counter_Get();
+    checker->lastCheckCycles = endCycles - startCycles;
+    checker->maxCheckCycles = (checker->lastCheckCycles > checker->maxCheckCycles) ? checker->lastCheckCycles : checker->maxCheckCycles;
+
+    return (checker->isTripped == nwFalse) ? nwTrue : nwFalse;
+}
+
+nw_bool NexaWatt_SafetyChecker_Pipeline_Stage(void* const stageContext, NexaWattPipelineSignals* const signals)
+{
+    NexaWattSafetyChecker* const checker = (NexaWattSafetyChecker*)stageContext;
+
+    NW_RUNTIME_ASSERT(signals->sampleCnt >= checker->channelCnt);
+
+    return NexaWatt_SafetyChecker_Check(checker, signals->samples);
+}
+
+NexaWattSafetyStatusResult NexaWatt_SafetyChecker_Force_Trip(NexaWattSafetyChecker* const checker, const uint32 faultMask)
+{
+    NexaWattSafetyStatusResult retRes = NW_SAFETY_BAD_PARAM;
+    NwCriticalSectionState criticalSectionState = 0u;
+
+    if ((checker != NULL) &&
+        (faultMask != 0u) &&
+        ((faultMask & NW_SAFETY_CHECKED_FAULTS_MSK) == 0u))
+    {
+        // The trip must not interleave with the trip of a check pass, executed by the control interrupt
+        criticalSectionState = NexaWatt_Platform_Critical_Section_Enter();
+
+        if (checker->isTripped == nwFalse)
+        {
+            (void)NexaWatt_HalWrapperGpio_Port_Write(checker->gateDisablePort, checker->gateDisablePinMask, checker->gateDisableLevel);
+            checker->isTripped = nwTrue;
+            checker->tripCnt++;
+        }
+
+        checker->forcedFaults |= faultMask;
+        checker->latchedFaults |= faultMask;
+
+        NexaWatt_Platform_Critical_Section_Exit(criticalSectionState);
+
+        retRes = NW_SAFETY_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattSafetyStatusResult NexaWatt_SafetyChecker_Release_Forced_Faults(NexaWattSafetyChecker* const checker, const uint32 faultMask)
+{
+    NexaWattSafetyStatusResult retRes = NW_SAFETY_BAD_PARAM;
+    NwCriticalSectionState criticalSectionState = 0u;
+
+    if (checker != NULL)
+    {
+        criticalSectionState = NexaWatt_Platform_Critical_Section_Enter();
+        checker->forcedFaults &= ~faultMask;
+        NexaWatt_Platform_Critical_Section_Exit(criticalSectionState);
+
+        retRes = NW_SAFETY_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattSafetyStatusResult NexaWatt_SafetyChecker_Clear_Faults(NexaWattSafetyChecker* const checker)
+{
+    NexaWattSafetyStatusResult retRes = NW_SAFETY_BAD_PARAM;
+    NwCriticalSectionState criticalSectionState = 0u;
+
+    if (checker != NULL)
+    {
+        // The check pass runs in the control interrupt, so the test and the clearing must not be split by it
+        criticalSectionState = NexaWatt_Platform_Critical_Section_Enter();
+
+        if ((checker->activeFaults | checker->forcedFaults) == 0u)
+        {
+            checker->latchedFaults = 0u;
+            checker->isTripped = nwFalse;
+
+            retRes = NW_SAFETY_SUCCESS;
+        }
+        else
+        {
+            retRes = NW_SAFETY_FAULT_ACTIVE;
+        }
+
+        NexaWatt_Platform_Critical_Section_Exit(criticalSectionState);
+    }
+
+    return retRes;
+}
+
+void NexaWatt_SafetyChecker_Reset_Timing(NexaWattSafetyChecker* const checker)
+{
+    checker->lastCheckCycles = 0u;
+    checker->maxCheckCycles = 0u;
+    checker->maxTripCycles = 0u;
+}
+
+NW_LOCAL_INLINE uint32 NexaWatt_SafetyChecker_Compare_Pair(const uint32 samplesPacked, const uint32 lowerPacked, const uint32 upperPacked)
+{
+    uint32 withinUpper = 0u;
+    uint32 withinLower = 0u;
+    uint32 violation = 0u;
+
+    // The guard bit of a half-word survives the subtraction only if the minuend is not below the subtrahend
+    withinUpper = ((upperPacked | NW_SAFETY_GUARD_MSK) - samplesPacked) & NW_SAFETY_GUARD_MSK;
+    withinLower = ((samplesPacked | NW_SAFETY_GUARD_MSK) - lowerPacked) & NW_SAFETY_GUARD_MSK;
+    violation = (withinUpper & withinLower) ^ NW_SAFETY_GUARD_MSK;
+
+    return ((violation >> 15u) & 0x01u) | (violation >> 30u);
+}
+
+NW_LOCAL_INLINE uint32 NexaWatt_SafetyChecker_Limit_Sample(const NwAdcSample sample)
+{
+    // A sample with the bit 15 set would overwrite the guard bit, so all its lower bits are set instead
+    return ((uint32)sample | (0u - ((uint32)sample >> 15u))) & NW_SAFETY_MAX_LEVEL;
+}
+
+static nw_bool NexaWatt_SafetyChecker_Validate_Config(const NexaWattSafetyConfig* const safetyConfig)
+{
+    nw_bool retRes = nwFalse;
+    uint8 channelIdx = 0u;
+    uint8 i2tIdx = 0u;
+
+    if ((safetyConfig != NULL) &&
+        (safetyConfig->channelCnt <= NW_SAFETY_MAX_CHANNELS) &&
+        (safetyConfig->i2tCnt <= NW_SAFETY_MAX_I2T_CHANNELS) &&
+        ((safetyConfig->channelCnt == 0u) || (safetyConfig->channelLimits != NULL)) &&
+        ((safetyConfig->i2tCnt == 0u) || (safetyConfig->i2tLimits != NULL)) &&
+        (safetyConfig->gateDisablePinMask != 0u))
+    {
+        retRes = nwTrue;
+
+        for (channelIdx = 0u; channelIdx < safetyConfig->channelCnt; channelIdx++)
+        {
+            if ((safetyConfig->channelLimits[channelIdx].upperLimit > NW_SAFETY_MAX_LEVEL) ||
+                (safetyConfig->channelLimits[channelIdx].lowerLimit > safetyConfig->channelLimits[channelIdx].upperLimit))
+            {
+                retRes = nwFalse;
+            }
+        }
+
+        // The I2t channels must be part of the checked frame; a channel without instantaneous limits uses the widest ones
+        for (i2tIdx = 0u; i2tIdx < safetyConfig->i2tCnt; i2tIdx++)
+        {
+            if ((safetyConfig->i2tLimits[i2tIdx].channel >= safetyConfig->channelCnt) ||
+                (safetyConfig->i2tLimits[i2tIdx].ratedLevel > NW_SAFETY_MAX_LEVEL) ||
+                (safetyConfig->i2tLimits[i2tIdx].tripEnergy > NW_SAFETY_MAX_I2T_ENERGY))
+            {
+                retRes = nwFalse;
+            }
+        }
+    }
+
+    return retRes;
+}
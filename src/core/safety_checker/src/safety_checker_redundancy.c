@@ -0,0 +1,344 @@
+/*******************************************************************************
+* File Name:   safety_checker_redundancy.c
+*
+* Description: This is the source file containing definitions,
+* related to the redundancy plausibility checks of the safety checker.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "safety_checker_redundancy.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+NW_STATIC_ASSERT((NW_SAFETY_MAX_CHANNELS + NW_SAFETY_MAX_I2T_CHANNELS + NW_SAFETY_RED_MAX_GROUPS) < 31u, safety_fault_mask_redundancy_bits);
+NW_STATIC_ASSERT((0x01u << NW_SAFETY_RED_MAX_WINDOW_SHIFT) <= 0xFFFFu, safety_red_window_period_idx);
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that restarts the accumulation of a member.
+ * \param window - A pointer to the accumulator of the member.
+ */
+NW_LOCAL_INLINE void NexaWatt_SafetyChecker_Redundancy_Reset_Window(NexaWattSafetyRedundancyWindow* window);
+
+/**
+ * \brief Simple helper function that evaluates the last complete window of a group and debounces the result.
+ * \param redundancy - A pointer to the redundancy checks.
+ * \param groupIdx - The index of the evaluated group.
+ */
+static void NexaWatt_SafetyChecker_Redundancy_Evaluate(NexaWattSafetyRedundancy* redundancy, uint8 groupIdx);
+
+/**
+ * \brief Simple helper function that validates the configuration of the redundancy checks.
+ * \param redundancyConfig - A pointer to the configuration.
+ * \return nwTrue - The configuration is valid.
+ * \return nwFalse - The configuration is invalid.
+ */
+static nw_bool NexaWatt_SafetyChecker_Redundancy_Validate_Config(const NexaWattSafetyRedundancyConfig* redundancyConfig);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattSafetyStatusResult NexaWatt_SafetyChecker_Redundancy_Init(NexaWattSafetyRedundancy* const redundancy, const NexaWattSafetyRedundancyConfig* const redundancyConfig)
+{
+    NexaWattSafetyStatusResult retRes = NW_SAFETY_BAD_PARAM;
+    NexaWattSafetyRedundancyGroup* group = NULL;
+    uint8 groupIdx = 0u;
+    uint8 memberIdx = 0u;
+
+    if ((redundancy != NULL) &&
+        (NexaWatt_SafetyChecker_Redundancy_Validate_Config(redundancyConfig) == nwTrue))
+    {
+        for (groupIdx = 0u; groupIdx < redundancyConfig->groupCnt; groupIdx++)
+        {
+            group = &redundancy->groups[groupIdx];
+            group->config = redundancyConfig->groups[groupIdx];
+
+            for (memberIdx = 0u; memberIdx < NW_SAFETY_RED_MAX_MEMBERS; memberIdx++)
+            {
+                NexaWatt_SafetyChecker_Redundancy_Reset_Window(&group->accumulators[memberIdx]);
+                NexaWatt_SafetyChecker_Redundancy_Reset_Window(&group->snapshots[memberIdx]);
+            }
+
+            group->debounceCnt = 0u;
+            group->suspectMembers = 0u;
+            group->isFaulty = nwFalse;
+            group->stats.evaluationCnt = 0u;
+            group->stats.mismatchCnt = 0u;
+            group->stats.stuckCnt = 0u;
+            group->stats.maxDeviation = 0;
+        }
+
+        redundancy->groupCnt = redundancyConfig->groupCnt;
+        redundancy->windowShift = redundancyConfig->windowShift;
+        redundancy->periodIdx = 0u;
+        redundancy->hasSnapshots = nwFalse;
+        redundancy->safetyChecker = redundancyConfig->safetyChecker;
+        redundancy->notifyHandler = redundancyConfig->notifyHandler;
+        redundancy->notifyContext = redundancyConfig->notifyContext;
+
+        retRes = NW_SAFETY_SUCCESS;
+    }
+
+    return retRes;
+}
+
+nw_bool NexaWatt_SafetyChecker_Redundancy_Pipeline_Stage(void* const stageContext, NexaWattPipelineSignals* const signals)
+{
+    NexaWattSafetyRedundancy* const redundancy = (NexaWattSafetyRedundancy*)stageContext;
+    NexaWattSafetyRedundancyGroup* group = NULL;
+    NexaWattSafetyRedundancyWindow* window = NULL;
+    nw_bool continueChain = nwTrue;
+    uint8 groupIdx = 0u;
+    uint8 memberIdx = 0u;
+    NwQ15 value = 0;
+
+    for (groupIdx = 0u; groupIdx < redundancy->groupCnt; groupIdx++)
+    {
+        group = &redundancy->groups[groupIdx];
+        for (memberIdx = 0u; memberIdx < group->config.memberCnt; memberIdx++)
+        {
+            window = &group->accumulators[memberIdx];
+            value = signals->measurements[group->config.memberSignals[memberIdx]];
+            window->sum += value;
+            window->minValue = (value < window->minValue) ? value : window->minValue;
+            window->maxValue = (value > window->maxValue) ? value : window->maxValue;
+        }
+
+        if ((group->isFaulty == nwTrue) &&
+            (group->config.tripOnFault == nwTrue))
+        {
+            continueChain = nwFalse;
+        }
+    }
+
+    // The evaluation of the previous window is spread over the first periods of the current one
+    if ((redundancy->hasSnapshots == nwTrue) &&
+        (redundancy->periodIdx < redundancy->groupCnt))
+    {
+        NexaWatt_SafetyChecker_Redundancy_Evaluate(redundancy, (uint8)redundancy->periodIdx);
+    }
+
+    redundancy->periodIdx++;
+    if (redundancy->periodIdx >= ((uint16)0x01u << redundancy->windowShift))
+    {
+        for (groupIdx = 0u; groupIdx < redundancy->groupCnt; groupIdx++)
+        {
+            group = &redundancy->groups[groupIdx];
+            for (memberIdx = 0u; memberIdx < group->config.memberCnt; memberIdx++)
+            {
+                group->snapshots[memberIdx] = group->accumulators[memberIdx];
+                NexaWatt_SafetyChecker_Redundancy_Reset_Window(&group->accumulators[memberIdx]);
+            }
+        }
+
+        redundancy->periodIdx = 0u;
+        redundancy->hasSnapshots = nwTrue;
+    }
+
+    return continueChain;
+}
+
+NexaWattSafetyStatusResult NexaWatt_SafetyChecker_Redundancy_Get_Stats(const NexaWattSafetyRedundancy* const redundancy, const uint8 groupIdx,
+                                                                       NexaWattSafetyRedundancyStats* const redundancyStats)
+{
+    NexaWattSafetyStatusResult retRes = NW_SAFETY_BAD_PARAM;
+
+    if ((redundancy != NULL) &&
+        (groupIdx < redundancy->groupCnt) &&
+        (redundancyStats != NULL))
+    {
+        *redundancyStats = redundancy->groups[groupIdx].stats;
+
+        retRes = NW_SAFETY_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NW_LOCAL_INLINE void NexaWatt_SafetyChecker_Redundancy_Reset_Window(NexaWattSafetyRedundancyWindow* const window)
+{
+    window->sum = 0;
+    window->minValue = (NwQ15)0x7FFFFFFF;
+    window->maxValue = (NwQ15)(-0x7FFFFFFF - 1);
+}
+
+static void NexaWatt_SafetyChecker_Redundancy_Evaluate(NexaWattSafetyRedundancy* const redundancy, const uint8 groupIdx)
+{
+    NexaWattSafetyRedundancyGroup* const group = &redundancy->groups[groupIdx];
+    const NexaWattSafetyRedundancyGroupConfig* const config = &group->config;
+    const int32 windowLen = (int32)((uint32)0x01u << redundancy->windowShift);
+    NwQ15 averages[NW_SAFETY_RED_MAX_MEMBERS] = { 0 };
+    NwQ15 spans[NW_SAFETY_RED_MAX_MEMBERS] = { 0 };
+    NwQ15 reference = 0;
+    NwQ15 tolerance = 0;
+    NwQ15 deviation = 0;
+    NwQ15 otherSpan = 0;
+    NwQ15 lowPair = 0;
+    NwQ15 highPair = 0;
+    uint8 mismatchMembers = 0u;
+    uint8 stuckMembers = 0u;
+    uint8 memberIdx = 0u;
+    uint8 otherIdx = 0u;
+    nw_bool isChanged = nwFalse;
+
+    for (memberIdx = 0u; memberIdx < config->memberCnt; memberIdx++)
+    {
+        averages[memberIdx] = group->snapshots[memberIdx].sum / windowLen;
+        spans[memberIdx] = group->snapshots[memberIdx].maxValue - group->snapshots[memberIdx].minValue;
+    }
+
+    // The median of three outvotes a single faulty member; two members can only be compared against their mean
+    if (config->memberCnt == 3u)
+    {
+        lowPair = (averages[0u] < averages[1u]) ? averages[0u] : averages[1u];
+        highPair = (averages[0u] < averages[1u]) ? averages[1u] : averages[0u];
+        reference = (averages[2u] < highPair) ? averages[2u] : highPair;
+        reference = (reference > lowPair) ? reference : lowPair;
+    }
+    else
+    {
+        reference = (averages[0u] + averages[1u]) / 2;
+    }
+
+    tolerance = config->absTolerance + NexaWatt_FixedPoint_Mul_Q15((reference < 0) ? -reference : reference, config->relTolerance);
+
+    for (memberIdx = 0u; memberIdx < config->memberCnt; memberIdx++)
+    {
+        deviation = averages[memberIdx] - reference;
+        deviation = (deviation < 0) ? -deviation : deviation;
+        group->stats.maxDeviation = (deviation > group->stats.maxDeviation) ? deviation : group->stats.maxDeviation;
+        if (deviation > tolerance)
+        {
+            mismatchMembers |= (uint8)(0x01u << memberIdx);
+        }
+
+        if (config->activitySpan > 0)
+        {
+            otherSpan = 0;
+            for (otherIdx = 0u; otherIdx < config->memberCnt; otherIdx++)
+            {
+                if ((otherIdx != memberIdx) &&
+                    (spans[otherIdx] > otherSpan))
+                {
+                    otherSpan = spans[otherIdx];
+                }
+            }
+
+            // A frozen member is suspicious only while the others show that the quantity moves
+            if ((spans[memberIdx] <= config->stuckSpan) &&
+                (otherSpan >= config->activitySpan))
+            {
+                stuckMembers |= (uint8)(0x01u << memberIdx);
+            }
+        }
+    }
+
+    group->stats.evaluationCnt++;
+    group->stats.mismatchCnt += (mismatchMembers != 0u) ? 1u : 0u;
+    group->stats.stuckCnt += (stuckMembers != 0u) ? 1u : 0u;
+
+    // The debounce counts the windows in a row, which disagree with the current state of the group
+    if ((mismatchMembers | stuckMembers) != 0u)
+    {
+        group->suspectMembers = mismatchMembers | stuckMembers;
+        group->debounceCnt = (group->isFaulty == nwFalse) ? (uint8)(group->debounceCnt + 1u) : 0u;
+        if ((group->isFaulty == nwFalse) &&
+            (group->debounceCnt >= config->faultDebounceCnt))
+        {
+            group->isFaulty = nwTrue;
+            group->debounceCnt = 0u;
+            isChanged = nwTrue;
+
+            if (config->tripOnFault == nwTrue)
+            {
+                (void)NexaWatt_SafetyChecker_Force_Trip(redundancy->safetyChecker, NW_SAFETY_FAULT_REDUNDANCY(groupIdx));
+            }
+        }
+    }
+    else
+    {
+        group->debounceCnt = (group->isFaulty == nwTrue) ? (uint8)(group->debounceCnt + 1u) : 0u;
+        if ((group->isFaulty == nwTrue) &&
+            (group->debounceCnt >= config->healDebounceCnt))
+        {
+            group->isFaulty = nwFalse;
+            group->debounceCnt = 0u;
+            isChanged = nwTrue;
+
+            if (config->tripOnFault == nwTrue)
+            {
+                (void)NexaWatt_SafetyChecker_Release_Forced_Faults(redundancy->safetyChecker, NW_SAFETY_FAULT_REDUNDANCY(groupIdx));
+            }
+        }
+    }
+
+    if ((isChanged == nwTrue) &&
+        (redundancy->notifyHandler != NULL))
+    {
+        (void)NexaWatt_MiniOs_Event_Post(redundancy->notifyHandler, redundancy->notifyContext,
+                                         NW_SAFETY_RED_EVENT_ARG(groupIdx, group->suspectMembers, group->isFaulty));
+    }
+}
+
+static nw_bool NexaWatt_SafetyChecker_Redundancy_Validate_Config(const NexaWattSafetyRedundancyConfig* const redundancyConfig)
+{
+    nw_bool retRes = nwFalse;
+    const NexaWattSafetyRedundancyGroupConfig* group = NULL;
+    uint8 groupIdx = 0u;
+    uint8 memberIdx = 0u;
+
+    if ((redundancyConfig != NULL) &&
+        (redundancyConfig->groups != NULL) &&
+        (redundancyConfig->groupCnt > 0u) &&
+        (redundancyConfig->groupCnt <= NW_SAFETY_RED_MAX_GROUPS) &&
+        (redundancyConfig->windowShift <= NW_SAFETY_RED_MAX_WINDOW_SHIFT) &&
+        (((uint32)0x01u << redundancyConfig->windowShift) >= redundancyConfig->groupCnt))
+    {
+        retRes = nwTrue;
+
+        for (groupIdx = 0u; groupIdx < redundancyConfig->groupCnt; groupIdx++)
+        {
+            group = &redundancyConfig->groups[groupIdx];
+            if ((group->memberCnt < 2u) ||
+                (group->memberCnt > NW_SAFETY_RED_MAX_MEMBERS) ||
+                (group->absTolerance < 0) ||
+                (group->relTolerance < 0) ||
+                (group->relTolerance > NW_Q15_ONE) ||
+                (group->stuckSpan < 0) ||
+                (group->activitySpan < 0) ||
+                (group->faultDebounceCnt == 0u) ||
+                (group->healDebounceCnt == 0u) ||
+                ((group->tripOnFault == nwTrue) && (redundancyConfig->safetyChecker == NULL)))
+            {
+                retRes = nwFalse;
+            }
+
+            for (memberIdx = 0u; memberIdx < group->memberCnt; memberIdx++)
+            {
+                if ((memberIdx < NW_SAFETY_RED_MAX_MEMBERS) &&
+                    (group->memberSignals[memberIdx] >= NW_PIPELINE_MAX_SIGNALS))
+                {
+                    retRes = nwFalse;
+                }
+            }
+        }
+    }
+
+    return retRes;
+}
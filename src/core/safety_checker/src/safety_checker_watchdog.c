@@ -0,0 +1,335 @@
+/*******************************************************************************
+* File Name:   safety_checker_watchdog.c
+*
+* Description: This is the source file containing definitions,
+* related to the timing watchdog of the safety checker.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "safety_checker_watchdog.h"
+#include "hal_wrapper_wdt.h"
+#include "platform_critical_section.h"
+#include "platform_cycle_counter.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that validates the configuration of a watchdog.
+ * \param watchdogConfig - A pointer to the configuration.
+ * \return nwTrue - The configuration is valid.
+ * \return nwFalse - The configuration is invalid.
+ */
+static nw_bool NexaWatt_SafetyChecker_Watchdog_Validate_Config(const NexaWattSafetyWatchdogConfig* watchdogConfig);
+
+/**
+ * \brief Simple helper function that executes the actions of all levels reached by the violation score.
+ * \param watchdog - A pointer to the watchdog.
+ * \param violations - The violation flags of the escalating period, reported by the notification.
+ */
+static void NexaWatt_SafetyChecker_Watchdog_Escalate(NexaWattSafetyWatchdog* watchdog, uint8 violations);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattSafetyStatusResult NexaWatt_SafetyChecker_Watchdog_Init(NexaWattSafetyWatchdog* const watchdog, const NexaWattSafetyWatchdogConfig* const watchdogConfig)
+{
+    NexaWattSafetyStatusResult retRes = NW_SAFETY_BAD_PARAM;
+    NexaWattWdtConfig wdtConfig;
+    NexaWattWdtStatusResult wdtInitRes = NW_WDT_SUCCESS;
+    NexaWattSafetyWatchdogStats* const stats = (watchdog != NULL) ? &watchdog->stats : NULL;
+    uint8 levelIdx = 0u;
+
+    if ((watchdog != NULL) &&
+        (NexaWatt_SafetyChecker_Watchdog_Validate_Config(watchdogConfig) == nwTrue))
+    {
+        watchdog->periodCycles = watchdogConfig->periodCycles;
+        watchdog->minIntervalCycles = watchdogConfig->periodCycles - watchdogConfig->earlyToleranceCycles;
+        watchdog->maxIntervalCycles = watchdogConfig->periodCycles + watchdogConfig->lateToleranceCycles;
+        watchdog->budgetCycles = watchdogConfig->budgetCycles;
+        watchdog->stallCycles = watchdogConfig->stallCycles;
+
+        for (levelIdx = 0u; levelIdx < watchdogConfig->levelCnt; levelIdx++)
+        {
+            watchdog->levels[levelIdx] = watchdogConfig->levels[levelIdx];
+        }
+        watchdog->levelCnt = watchdogConfig->levelCnt;
+        watchdog->maxViolationScore = (uint32)watchdogConfig->levels[watchdogConfig->levelCnt - 1u].violationCnt * NW_SAFETY_WDG_VIOLATION_WEIGHT;
+
+        watchdog->safetyChecker = watchdogConfig->safetyChecker;
+        watchdog->notifyHandler = watchdogConfig->notifyHandler;
+        watchdog->notifyContext = watchdogConfig->notifyContext;
+        watchdog->useHardwareWdt = (watchdogConfig->hardwareTimeoutUs > 0u) ? nwTrue : nwFalse;
+        watchdog->kickDivider = watchdogConfig->kickDivider;
+        watchdog->kickCnt = 0u;
+        watchdog->isMainLoopAlive = nwFalse;
+        watchdog->hasStarted = nwFalse;
+        watchdog->lastStartCycles = 0u;
+        watchdog->periodViolations = 0u;
+        watchdog->violationScore = 0u;
+        watchdog->level = 0u;
+        watchdog->isShutdown = nwFalse;
+        watchdog->isKickStopped = nwFalse;
+
+        stats->periodCnt = 0u;
+        stats->earlyStartCnt = 0u;
+        stats->lateStartCnt = 0u;
+        stats->missedPeriodCnt = 0u;
+        stats->overrunCnt = 0u;
+        stats->stallCnt = 0u;
+        stats->lastJitterCycles = 0u;
+        stats->maxJitterCycles = 0u;
+        stats->lastExecCycles = 0u;
+        stats->maxExecCycles = 0u;
+
+        if (watchdog->useHardwareWdt == nwTrue)
+        {
+            wdtConfig.timeoutUs = watchdogConfig->hardwareTimeoutUs;
+            wdtInitRes = NexaWatt_HalWrapperWdt_Init(&wdtConfig);
+        }
+
+        if (wdtInitRes == NW_WDT_SUCCESS)
+        {
+            retRes = NW_SAFETY_SUCCESS;
+        }
+    }
+
+    return retRes;
+}
+
+void NexaWatt_SafetyChecker_Watchdog_Period_Start(NexaWattSafetyWatchdog* const watchdog)
+{
+    uint32 startCycles = NexaWatt_Platform_Cycle_Counter_Get();
+    uint32 intervalCycles = 0u;
+    uint32 jitterCycles = 0u;
+    uint8 violations = 0u;
+
+    if (watchdog->hasStarted == nwTrue)
+    {
+        intervalCycles = startCycles - watchdog->lastStartCycles;
+        jitterCycles = (intervalCycles > watchdog->periodCycles) ? (intervalCycles - watchdog->periodCycles) : (watchdog->periodCycles - intervalCycles);
+        watchdog->stats.lastJitterCycles = jitterCycles;
+        watchdog->stats.maxJitterCycles = (jitterCycles > watchdog->stats.maxJitterCycles) ? jitterCycles : watchdog->stats.maxJitterCycles;
+
+        if (intervalCycles < watchdog->minIntervalCycles)
+        {
+            violations |= NW_SAFETY_WDG_VIOLATION_EARLY;
+            watchdog->stats.earlyStartCnt++;
+        }
+        else if (intervalCycles > watchdog->maxIntervalCycles)
+        {
+            // The periods skipped in between are counted as missed, rounding to the nearest period
+            violations |= NW_SAFETY_WDG_VIOLATION_LATE;
+            watchdog->stats.lateStartCnt++;
+            watchdog->stats.missedPeriodCnt += (jitterCycles + (watchdog->periodCycles / 2u)) / watchdog->periodCycles;
+        }
+        else
+        {
+            // The start is within the window
+        }
+    }
+
+    watchdog->lastStartCycles = startCycles;
+    watchdog->hasStarted = nwTrue;
+    watchdog->periodViolations = violations;
+}
+
+nw_bool NexaWatt_SafetyChecker_Watchdog_Period_End(NexaWattSafetyWatchdog* const watchdog)
+{
+    uint32 execCycles = NexaWatt_Platform_Cycle_Counter_Get() - watchdog->lastStartCycles;
+
+    watchdog->stats.periodCnt++;
+    watchdog->stats.lastExecCycles = execCycles;
+    watchdog->stats.maxExecCycles = (execCycles > watchdog->stats.maxExecCycles) ? execCycles : watchdog->stats.maxExecCycles;
+
+    if (execCycles > watchdog->budgetCycles)
+    {
+        watchdog->periodViolations |= NW_SAFETY_WDG_VIOLATION_OVERRUN;
+        watchdog->stats.overrunCnt++;
+    }
+
+    if (watchdog->periodViolations != 0u)
+    {
+        watchdog->violationScore += NW_SAFETY_WDG_VIOLATION_WEIGHT;
+        watchdog->violationScore = (watchdog->violationScore > watchdog->maxViolationScore) ? watchdog->maxViolationScore : watchdog->violationScore;
+        NexaWatt_SafetyChecker_Watchdog_Escalate(watchdog, watchdog->periodViolations);
+    }
+    else if (watchdog->violationScore > 0u)
+    {
+        watchdog->violationScore--;
+    }
+    else
+    {
+        // No violation pending
+    }
+
+    // The hardware watchdog is kicked only while both the control interrupt and the main loop are running
+    if ((watchdog->useHardwareWdt == nwTrue) &&
+        (watchdog->isKickStopped == nwFalse))
+    {
+        if (watchdog->kickCnt < watchdog->kickDivider)
+        {
+            watchdog->kickCnt++;
+        }
+
+        if ((watchdog->kickCnt >= watchdog->kickDivider) &&
+            (watchdog->isMainLoopAlive == nwTrue))
+        {
+            NexaWatt_HalWrapperWdt_Kick();
+            watchdog->kickCnt = 0u;
+            watchdog->isMainLoopAlive = nwFalse;
+        }
+    }
+
+    return (watchdog->isShutdown == nwFalse) ? nwTrue : nwFalse;
+}
+
+void NexaWatt_SafetyChecker_Watchdog_Poll(NexaWattSafetyWatchdog* const watchdog)
+{
+    NwCriticalSectionState criticalSectionState = 0u;
+
+    if (watchdog != NULL)
+    {
+        watchdog->isMainLoopAlive = nwTrue;
+
+        // The start of a period must not be recorded between the read of the counter and the test
+        criticalSectionState = NexaWatt_Platform_Critical_Section_Enter();
+
+        if ((watchdog->stallCycles > 0u) &&
+            (watchdog->hasStarted == nwTrue) &&
+            (watchdog->isShutdown == nwFalse) &&
+            ((NexaWatt_Platform_Cycle_Counter_Get() - watchdog->lastStartCycles) > watchdog->stallCycles))
+        {
+            // The stopped interrupt cannot escalate by itself, so all levels are executed at once
+            watchdog->stats.stallCnt++;
+            watchdog->violationScore = watchdog->maxViolationScore;
+            NexaWatt_SafetyChecker_Watchdog_Escalate(watchdog, NW_SAFETY_WDG_VIOLATION_STALL);
+        }
+
+        NexaWatt_Platform_Critical_Section_Exit(criticalSectionState);
+    }
+}
+
+NexaWattSafetyStatusResult NexaWatt_SafetyChecker_Watchdog_Reset(NexaWattSafetyWatchdog* const watchdog)
+{
+    NexaWattSafetyStatusResult retRes = NW_SAFETY_BAD_PARAM;
+    NwCriticalSectionState criticalSectionState = 0u;
+
+    if (watchdog != NULL)
+    {
+        criticalSectionState = NexaWatt_Platform_Critical_Section_Enter();
+
+        watchdog->hasStarted = nwFalse;
+        watchdog->periodViolations = 0u;
+        watchdog->violationScore = 0u;
+        watchdog->level = 0u;
+        watchdog->isShutdown = nwFalse;
+        watchdog->isKickStopped = nwFalse;
+        watchdog->kickCnt = 0u;
+
+        NexaWatt_Platform_Critical_Section_Exit(criticalSectionState);
+
+        retRes = NexaWatt_SafetyChecker_Release_Forced_Faults(watchdog->safetyChecker, NW_SAFETY_FAULT_TIMING);
+    }
+
+    return retRes;
+}
+
+void NexaWatt_SafetyChecker_Watchdog_Get_Stats(const NexaWattSafetyWatchdog* const watchdog, NexaWattSafetyWatchdogStats* const watchdogStats)
+{
+    NwCriticalSectionState criticalSectionState = 0u;
+
+    if ((watchdog != NULL) &&
+        (watchdogStats != NULL))
+    {
+        criticalSectionState = NexaWatt_Platform_Critical_Section_Enter();
+        *watchdogStats = watchdog->stats;
+        NexaWatt_Platform_Critical_Section_Exit(criticalSectionState);
+    }
+}
+
+static void NexaWatt_SafetyChecker_Watchdog_Escalate(NexaWattSafetyWatchdog* const watchdog, const uint8 violations)
+{
+    const NexaWattSafetyWatchdogLevel* level = NULL;
+
+    // Levels passed within a single period are executed in their order, so no notification is skipped
+    while ((watchdog->level < watchdog->levelCnt) &&
+           (watchdog->violationScore >= ((uint32)watchdog->levels[watchdog->level].violationCnt * NW_SAFETY_WDG_VIOLATION_WEIGHT)))
+    {
+        level = &watchdog->levels[watchdog->level];
+        watchdog->level++;
+
+        switch (level->action)
+        {
+            case NW_SAFETY_WDG_ACTION_NOTIFY:
+                (void)NexaWatt_MiniOs_Event_Post(watchdog->notifyHandler, watchdog->notifyContext, NW_SAFETY_WDG_EVENT_ARG(watchdog->level, violations));
+                break;
+
+            case NW_SAFETY_WDG_ACTION_RESET:
+                watchdog->isKickStopped = nwTrue;
+                (void)NexaWatt_SafetyChecker_Force_Trip(watchdog->safetyChecker, NW_SAFETY_FAULT_TIMING);
+                watchdog->isShutdown = nwTrue;
+                break;
+
+            case NW_SAFETY_WDG_ACTION_SAFE_SHUTDOWN:
+            default:
+                (void)NexaWatt_SafetyChecker_Force_Trip(watchdog->safetyChecker, NW_SAFETY_FAULT_TIMING);
+                watchdog->isShutdown = nwTrue;
+                break;
+        }
+    }
+}
+
+static nw_bool NexaWatt_SafetyChecker_Watchdog_Validate_Config(const NexaWattSafetyWatchdogConfig* const watchdogConfig)
+{
+    nw_bool retRes = nwFalse;
+    uint8 levelIdx = 0u;
+    const NexaWattSafetyWatchdogLevel* level = NULL;
+
+    if ((watchdogConfig != NULL) &&
+        (watchdogConfig->periodCycles > 0u) &&
+        (watchdogConfig->earlyToleranceCycles < watchdogConfig->periodCycles) &&
+        (watchdogConfig->lateToleranceCycles < watchdogConfig->periodCycles) &&
+        (watchdogConfig->budgetCycles > 0u) &&
+        (watchdogConfig->levels != NULL) &&
+        (watchdogConfig->levelCnt > 0u) &&
+        (watchdogConfig->levelCnt <= NW_SAFETY_WDG_MAX_LEVELS) &&
+        (watchdogConfig->safetyChecker != NULL) &&
+        ((watchdogConfig->hardwareTimeoutUs == 0u) || (watchdogConfig->kickDivider > 0u)))
+    {
+        // The escalation must end in the shutdown
+        retRes = (watchdogConfig->levels[watchdogConfig->levelCnt - 1u].action != NW_SAFETY_WDG_ACTION_NOTIFY) ? nwTrue : nwFalse;
+
+        for (levelIdx = 0u; levelIdx < watchdogConfig->levelCnt; levelIdx++)
+        {
+            level = &watchdogConfig->levels[levelIdx];
+            if ((level->violationCnt == 0u) ||
+                ((levelIdx > 0u) && (level->violationCnt <= watchdogConfig->levels[levelIdx - 1u].violationCnt)) ||
+                (level->action > NW_SAFETY_WDG_ACTION_RESET) ||
+                ((level->action == NW_SAFETY_WDG_ACTION_NOTIFY) && (watchdogConfig->notifyHandler == NULL)) ||
+                ((level->action == NW_SAFETY_WDG_ACTION_RESET) && (watchdogConfig->hardwareTimeoutUs == 0u)))
+            {
+                retRes = nwFalse;
+            }
+        }
+    }
+
+    return retRes;
+}
@@ -0,0 +1,236 @@
+/*******************************************************************************
+* File Name:   state_manager.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the hierarchical state machine engine of the NexaWatt-IV.DC framework.
+* A state machine is described by constant tables, placed in flash:
+* - the state table, giving the parent, the initial child (composite states) and
+*   the entry and exit actions of every state;
+* - the transition list, giving the target, the guard and the action of every transition;
+* - the dispatch table, a state x event matrix of indices into the transition list.
+* An event is looked up in the row of the active leaf state and, if not handled there
+* (no entry or a rejecting guard), in the rows of its ancestors. The lookup is therefore
+* one table access per hierarchy level, bounded by NW_STATE_MAX_DEPTH and independent of
+* the number of states, events and transitions.
+* A transition exits the states up to the least common ancestor of the source and the
+* target, executes its action, enters the states down to the target and follows the
+* initial children of the composite target. A transition without a target is internal:
+* only its action is executed.
+* The events are posted to a fixed-size FIFO queue from any context (e.g. an ISR) and
+* processed run-to-completion by a single context (the main loop). The execution time
+* of every processed event is measured with the cycle counter.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_STATE_MANAGER_H
+#define NEXAWATT_IV_DC_STATE_MANAGER_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Maximum number of states of a state machine.
+ */
+#define NW_STATE_MAX_STATES                 (32u)
+
+/**
+ * \brief Maximum number of hierarchy levels, including the top state (depth 0).
+ */
+#define NW_STATE_MAX_DEPTH                  (4u)
+
+/**
+ * \brief Number of events the queue of a state machine can hold. Must be a power of two.
+ */
+#define NW_STATE_EVENT_QUEUE_LEN            (16u)
+
+/**
+ * \brief Marker of a missing state (the parent of the top state, the initial child of a leaf state,
+ * the target of an internal transition) and of a missing entry of the dispatch table.
+ */
+#define NW_STATE_NONE                       (0xFFu)
+#define NW_STATE_TRANSITION_NONE            (0xFFu)
+
+/**
+ * \brief Event limit of a processing call, which processes all pending events.
+ */
+#define NW_STATE_PROCESS_ALL                (0xFFFFFFFFu)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+typedef enum eNexaWattStateManagerStatusResult
+{
+    NW_STATE_MANAGER_SUCCESS    = 0u,
+    NW_STATE_MANAGER_BAD_PARAM  = 1u,
+    NW_STATE_MANAGER_QUEUE_FULL = 2u,
+} NexaWattStateManagerStatusResult;
+
+/**
+ * \brief Entry, exit or transition action. The context is the one of the state machine, the argument the one of the processed event.
+ */
+typedef void(*NwStateAction)(void* context, uint32 eventArg);
+
+/**
+ * \brief Guard of a transition. A transition is taken only if its guard returns nwTrue.
+ */
+typedef nw_bool(*NwStateGuard)(void* context, uint32 eventArg);
+
+/**
+ * \brief Description of a state. The actions are optional (NULL).
+ */
+typedef struct sNexaWattStateDescriptor
+{
+    uint8 parentState;
+    uint8 initialChild;
+    NwStateAction entryAction;
+    NwStateAction exitAction;
+} NexaWattStateDescriptor;
+
+/**
+ * \brief Description of a transition. The guard and the action are optional (NULL).
+ */
+typedef struct sNexaWattStateTransition
+{
+    uint8 targetState;
+    NwStateGuard guard;
+    NwStateAction action;
+} NexaWattStateTransition;
+
+/**
+ * \brief Description of a state machine. The dispatch table has stateCnt rows of eventCnt entries.
+ */
+typedef struct sNexaWattStateMachineConfig
+{
+    const NexaWattStateDescriptor* states;
+    uint8 stateCnt;
+    const NexaWattStateTransition* transitions;
+    uint8 transitionCnt;
+    const uint8* dispatchTable;
+    uint8 eventCnt;
+    uint8 topState;
+    void* context;
+} NexaWattStateMachineConfig;
+
+typedef struct sNexaWattStateEvent
+{
+    uint8 eventId;
+    uint32 eventArg;
+} NexaWattStateEvent;
+
+/**
+ * \brief Statistics of a state machine. The dropped events were posted while the queue was full,
+ * the unhandled ones found no transition. The cycles are the processing time of a single event.
+ */
+typedef struct sNexaWattStateMachineStats
+{
+    uint32 processedCnt;
+    uint32 transitionCnt;
+    uint32 unhandledCnt;
+    uint32 droppedCnt;
+    uint32 maxPendingCnt;
+    uint32 lastProcessCycles;
+    uint32 maxProcessCycles;
+} NexaWattStateMachineStats;
+
+typedef struct sNexaWattStateMachine
+{
+    const NexaWattStateDescriptor* states;
+    const NexaWattStateTransition* transitions;
+    const uint8* dispatchTable;
+    uint8 stateCnt;
+    uint8 eventCnt;
+    uint8 topState;
+    void* context;
+    uint8 depths[NW_STATE_MAX_STATES];
+    volatile uint8 currentState;
+    nw_bool isStarted;
+    NexaWattStateEvent events[NW_STATE_EVENT_QUEUE_LEN];
+    volatile uint32 headIdx;
+    volatile uint32 tailIdx;
+    NexaWattStateMachineStats stats;
+} NexaWattStateMachine;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Function used to initialize a state machine. The tables are validated and the depths of the states computed.
+ * The machine is not started; the posted events wait in the queue until the start.
+ * \param machine - A pointer to the state machine to be initialized.
+ * \param machineConfig - A pointer to the description of the state machine.
+ * \return NW_STATE_MANAGER_BAD_PARAM - A pointer is NULL, a count exceeds its maximum, the hierarchy is invalid or too deep,
+ * an initial child is not a child of its state, or a table references a missing state or transition.
+ * \return NW_STATE_MANAGER_SUCCESS - The state machine is initialized.
+ */
+NexaWattStateManagerStatusResult NexaWatt_StateManager_Init(NexaWattStateMachine* machine, const NexaWattStateMachineConfig* machineConfig);
+
+/**
+ * \brief Function used to start a state machine: the top state is entered and the initial children are followed down to a leaf state.
+ * Must be called from the processing context.
+ * \param machine - A pointer to an initialized state machine.
+ * \return NW_STATE_MANAGER_BAD_PARAM - The pointer is NULL or the machine is already started.
+ * \return NW_STATE_MANAGER_SUCCESS - The machine is in its initial leaf state.
+ */
+NexaWattStateManagerStatusResult NexaWatt_StateManager_Start(NexaWattStateMachine* machine);
+
+/**
+ * \brief Function used to post an event. Can be used from any context, including the ISRs and the actions.
+ * \param machine - A pointer to an initialized state machine.
+ * \param eventId - The event.
+ * \param eventArg - The argument passed to the guards and actions.
+ * \return NW_STATE_MANAGER_BAD_PARAM - The pointer is NULL or the event does not exist.
+ * \return NW_STATE_MANAGER_QUEUE_FULL - The queue is full. The event is dropped and counted in the statistics.
+ * \return NW_STATE_MANAGER_SUCCESS - The event is queued.
+ */
+NexaWattStateManagerStatusResult NexaWatt_StateManager_Post(NexaWattStateMachine* machine, uint8 eventId, uint32 eventArg);
+
+/**
+ * \brief Function used to process the pending events in the order of their posting, each one run-to-completion.
+ * Must be called from a single context. Events posted by the executed actions are processed within the same call, up to the provided limit.
+ * \param machine - A pointer to a started state machine.
+ * \param maxEventCnt - The maximum number of processed events. NW_STATE_PROCESS_ALL processes all pending events.
+ * \return The number of processed events.
+ */
+uint32 NexaWatt_StateManager_Process(NexaWattStateMachine* machine, uint32 maxEventCnt);
+
+/**
+ * \brief Checks whether a state is active, i.e. it is the active leaf state or one of its ancestors.
+ * \param machine - A pointer to a started state machine.
+ * \param state - The state.
+ * \return nwTrue - The state is active.
+ * \return nwFalse - The state is not active or does not exist.
+ */
+nw_bool NexaWatt_StateManager_Is_In_State(const NexaWattStateMachine* machine, uint8 state);
+
+/**
+ * \brief Function used to obtain the statistics of a state machine.
+ * \param machine - A pointer to an initialized state machine.
+ * \param machineStats - A pointer to the structure, where the statistics are copied.
+ */
+void NexaWatt_StateManager_Get_Stats(const NexaWattStateMachine* machine, NexaWattStateMachineStats* machineStats);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/**
+ * \brief Returns the active leaf state of a state machine.
+ * \param machine - A pointer to a started state machine.
+ * \return The active leaf state.
+ */
+NW_LOCAL_INLINE uint8 NexaWatt_StateManager_Get_State(const NexaWattStateMachine* const machine)
+{
+    return machine->currentState;
+}
+
+#endif
@@ -0,0 +1,119 @@
+/*******************************************************************************
+* File Name:   state_manager_converter.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the operating state machine of a converter, built on the state machine
+* engine of the state manager. The hierarchy of the states is:
+* TOP
+* +- INIT          initialization of the peripherals and the control
+* +- SHUTDOWN      gates disabled, waiting for a start
+* +- ACTIVE        power stage energized, left by STOP
+* |  +- PRECHARGE  charging of the DC link
+* |  +- SOFTSTART  ramp of the reference
+* |  +- POWER
+* |     +- RUN     nominal operation
+* |     +- DERATE  operation with a reduced power limit
+* +- FAULT         gates disabled, waiting for a fault clearance
+* The FAULT event is handled by TOP, so it is accepted in every state; a repeated FAULT
+* event in FAULT is ignored. START and FAULT_CLEAR are guarded by the application.
+* The tables are constant and the application hooks are called through the converter
+* state machine, so the hooks are provided at run time. Every hook is optional, except the
+* fault clearance guard: a fault is only cleared, when the application confirms it.
+* Typical usage: the protections post NW_CONVERTER_EVENT_FAULT from the control ISR, the
+* main loop calls NexaWatt_StateManager_Process(&converter.machine, NW_STATE_PROCESS_ALL).
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_STATE_MANAGER_CONVERTER_H
+#define NEXAWATT_IV_DC_STATE_MANAGER_CONVERTER_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+#include "state_manager.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+typedef enum eNexaWattConverterState
+{
+    NW_CONVERTER_STATE_TOP          = 0u,
+    NW_CONVERTER_STATE_INIT         = 1u,
+    NW_CONVERTER_STATE_SHUTDOWN     = 2u,
+    NW_CONVERTER_STATE_ACTIVE       = 3u,
+    NW_CONVERTER_STATE_PRECHARGE    = 4u,
+    NW_CONVERTER_STATE_SOFTSTART    = 5u,
+    NW_CONVERTER_STATE_POWER        = 6u,
+    NW_CONVERTER_STATE_RUN          = 7u,
+    NW_CONVERTER_STATE_DERATE       = 8u,
+    NW_CONVERTER_STATE_FAULT        = 9u,
+    NW_CONVERTER_STATE_CNT          = 10u,
+} NexaWattConverterState;
+
+typedef enum eNexaWattConverterEvent
+{
+    NW_CONVERTER_EVENT_INIT_DONE        = 0u,
+    NW_CONVERTER_EVENT_START            = 1u,
+    NW_CONVERTER_EVENT_PRECHARGE_DONE   = 2u,
+    NW_CONVERTER_EVENT_SOFTSTART_DONE   = 3u,
+    NW_CONVERTER_EVENT_DERATE           = 4u,
+    NW_CONVERTER_EVENT_DERATE_CLEAR     = 5u,
+    NW_CONVERTER_EVENT_STOP             = 6u,
+    NW_CONVERTER_EVENT_FAULT            = 7u,
+    NW_CONVERTER_EVENT_FAULT_CLEAR      = 8u,
+    NW_CONVERTER_EVENT_CNT              = 9u,
+} NexaWattConverterEvent;
+
+/**
+ * \brief Application hooks of the converter state machine. The hooks receive the application context and the argument of the event,
+ * e.g. the fault mask of a FAULT event. The exit of ACTIVE is the single point, where the power stage is left by every path.
+ */
+typedef struct sNexaWattConverterStateHooks
+{
+    NwStateAction onInitEnter;
+    NwStateAction onShutdownEnter;
+    NwStateAction onPrechargeEnter;
+    NwStateAction onSoftstartEnter;
+    NwStateAction onRunEnter;
+    NwStateAction onDerateEnter;
+    NwStateAction onFaultEnter;
+    NwStateAction onActiveExit;
+    NwStateGuard canStart;
+    NwStateGuard canClearFault;
+    void* appContext;
+} NexaWattConverterStateHooks;
+
+typedef struct sNexaWattConverterStateMachine
+{
+    NexaWattStateMachine machine;
+    NexaWattConverterStateHooks hooks;
+} NexaWattConverterStateMachine;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Function used to initialize a converter state machine. The machine is not started.
+ * \param converter - A pointer to the converter state machine to be initialized.
+ * \param converterHooks - A pointer to the application hooks.
+ * \return NW_STATE_MANAGER_BAD_PARAM - A pointer is NULL or the canClearFault hook is missing.
+ * \return NW_STATE_MANAGER_SUCCESS - The converter state machine is initialized.
+ */
+NexaWattStateManagerStatusResult NexaWatt_StateManager_Converter_Init(NexaWattConverterStateMachine* converter, const NexaWattConverterStateHooks* converterHooks);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+#endif
@@ -0,0 +1,457 @@
+/*******************************************************************************
+* File Name:   state_manager.c
+*
+* Description: This is the source file containing definitions,
+* related to the hierarchical state machine engine of the NexaWatt-IV.DC framework.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "state_manager.h"
+#include "platform_critical_section.h"
+#include "platform_cycle_counter.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Macro returning the queue slot corresponding to a free-running queue index.
+ */
+#define NW_STATE_EVENT_SLOT(queueIdx) \
+    ((queueIdx) & (NW_STATE_EVENT_QUEUE_LEN - 1u))
+
+NW_STATIC_ASSERT((NW_STATE_EVENT_QUEUE_LEN & (NW_STATE_EVENT_QUEUE_LEN - 1u)) == 0u, state_event_queue_len_power_of_two);
+NW_STATIC_ASSERT(NW_STATE_MAX_STATES < NW_STATE_NONE, state_max_states_below_none);
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that validates the description of a state machine and computes the depths of its states.
+ * \param machineConfig - A pointer to the description.
+ * \param depths - The array, where the depths of the states are stored.
+ * \return nwTrue - The description is valid.
+ * \return nwFalse - The description is invalid.
+ */
+static nw_bool NexaWatt_StateManager_Validate_Config(const NexaWattStateMachineConfig* machineConfig, uint8* depths);
+
+/**
+ * \brief Simple helper function that follows the initial children of a state down to a leaf state, entering every child.
+ * \param machine - A pointer to the state machine.
+ * \param state - The entered state.
+ * \param eventArg - The argument of the processed event.
+ * \return The reached leaf state.
+ */
+static uint8 NexaWatt_StateManager_Drill_Down(NexaWattStateMachine* machine, uint8 state, uint32 eventArg);
+
+/**
+ * \brief Simple helper function that executes a transition, which is handled by the source state (the active leaf state or one of its ancestors).
+ * \param machine - A pointer to the state machine.
+ * \param sourceState - The state handling the event.
+ * \param transition - A pointer to the transition.
+ * \param eventArg - The argument of the processed event.
+ */
+static void NexaWatt_StateManager_Execute_Transition(NexaWattStateMachine* machine, uint8 sourceState, const NexaWattStateTransition* transition, uint32 eventArg);
+
+/**
+ * \brief Simple helper function that dispatches an event to the active leaf state and its ancestors.
+ * \param machine - A pointer to the state machine.
+ * \param event - A pointer to the event.
+ * \return nwTrue - A transition was executed.
+ * \return nwFalse - The event is unhandled.
+ */
+static nw_bool NexaWatt_StateManager_Dispatch(NexaWattStateMachine* machine, const NexaWattStateEvent* event);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattStateManagerStatusResult NexaWatt_StateManager_Init(NexaWattStateMachine* const machine, const NexaWattStateMachineConfig* const machineConfig)
+{
+    NexaWattStateManagerStatusResult retRes = NW_STATE_MANAGER_BAD_PARAM;
+
+    if ((machine != NULL) &&
+        (NexaWatt_StateManager_Validate_Config(machineConfig, machine->depths) == nwTrue))
+    {
+        machine->states = machineConfig->states;
+        machine->transitions = machineConfig->transitions;
+        machine->dispatchTable = machineConfig->dispatchTable;
+        machine->stateCnt = machineConfig->stateCnt;
+        machine->eventCnt = machineConfig->eventCnt;
+        machine->topState = machineConfig->topState;
+        machine->context = machineConfig->context;
+        machine->currentState = machineConfig->topState;
+        machine->isStarted = nwFalse;
+        machine->headIdx = 0u;
+        machine->tailIdx = 0u;
+
+        machine->stats.processedCnt = 0u;
+        machine->stats.transitionCnt = 0u;
+        machine->stats.unhandledCnt = 0u;
+        machine->stats.droppedCnt = 0u;
+        machine->stats.maxPendingCnt = 0u;
+        machine->stats.lastProcessCycles = 0u;
+        machine->stats.maxProcessCycles = 0u;
+
+        retRes = NW_STATE_MANAGER_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattStateManagerStatusResult NexaWatt_StateManager_Start(NexaWattStateMachine* const machine)
+{
+    NexaWattStateManagerStatusResult retRes = NW_STATE_MANAGER_BAD_PARAM;
+    NwStateAction entryAction = NULL;
+
+    if ((machine != NULL) &&
+        (machine->isStarted == nwFalse))
+    {
+        entryAction = machine->states[machine->topState].entryAction;
+        if (entryAction != NULL)
+        {
+            entryAction(machine->context, 0u);
+        }
+
+        machine->currentState = NexaWatt_StateManager_Drill_Down(machine, machine->topState, 0u);
+        machine->isStarted = nwTrue;
+
+        retRes = NW_STATE_MANAGER_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattStateManagerStatusResult NexaWatt_StateManager_Post(NexaWattStateMachine* const machine, const uint8 eventId, const uint32 eventArg)
+{
+    NexaWattStateManagerStatusResult retRes = NW_STATE_MANAGER_BAD_PARAM;
+    NwCriticalSectionState criticalSectionState = 0u;
+    NexaWattStateEvent* event = NULL;
+    uint32 pendingCnt = 0u;
+
+    if ((machine != NULL) &&
+        (eventId < machine->eventCnt))
+    {
+        criticalSectionState = NexaWatt_Platform_Critical_Section_Enter();
+
+        pendingCnt = machine->headIdx - machine->tailIdx;
+        if (pendingCnt < NW_STATE_EVENT_QUEUE_LEN)
+        {
+            event = &machine->events[NW_STATE_EVENT_SLOT(machine->headIdx)];
+            event->eventId = eventId;
+            event->eventArg = eventArg;
+            machine->headIdx++;
+
+            pendingCnt++;
+            machine->stats.maxPendingCnt = (pendingCnt > machine->stats.maxPendingCnt) ? pendingCnt : machine->stats.maxPendingCnt;
+
+            retRes = NW_STATE_MANAGER_SUCCESS;
+        }
+        else
+        {
+            machine->stats.droppedCnt++;
+
+            retRes = NW_STATE_MANAGER_QUEUE_FULL;
+        }
+
+        NexaWatt_Platform_Critical_Section_Exit(criticalSectionState);
+    }
+
+    return retRes;
+}
+
+uint32 NexaWatt_StateManager_Process(NexaWattStateMachine* const machine, const uint32 maxEventCnt)
+{
+    uint32 processedCnt = 0u;
+    NwCriticalSectionState criticalSectionState = 0u;
+    NexaWattStateEvent event;
+    uint32 startCycles = 0u;
+    uint32 processCycles = 0u;
+    nw_bool isHandled = nwFalse;
+
+    if ((machine != NULL) &&
+        (machine->isStarted == nwTrue))
+    {
+        while ((processedCnt < maxEventCnt) &&
+               (machine->tailIdx != machine->headIdx))
+        {
+            // The event is copied out, so its slot can be reused by a posting from an action
+            criticalSectionState = NexaWatt_Platform_Critical_Section_Enter();
+            event = machine->events[NW_STATE_EVENT_SLOT(machine->tailIdx)];
+            machine->tailIdx++;
+            NexaWatt_Platform_Critical_Section_Exit(criticalSectionState);
+
+            startCycles = NexaWatt_Platform_Cycle_Counter_Get();
+            isHandled = NexaWatt_StateManager_Dispatch(machine, &event);
+            processCycles = NexaWatt_Platform_Cycle_Counter_Get() - startCycles;
+
+            machine->stats.processedCnt++;
+            if (isHandled == nwTrue)
+            {
+                machine->stats.transitionCnt++;
+            }
+            else
+            {
+                machine->stats.unhandledCnt++;
+            }
+            machine->stats.lastProcessCycles = processCycles;
+            machine->stats.maxProcessCycles = (processCycles > machine->stats.maxProcessCycles) ? processCycles : machine->stats.maxProcessCycles;
+
+            processedCnt++;
+        }
+    }
+
+    return processedCnt;
+}
+
+nw_bool NexaWatt_StateManager_Is_In_State(const NexaWattStateMachine* const machine, const uint8 state)
+{
+    nw_bool retRes = nwFalse;
+    uint8 activeState = NW_STATE_NONE;
+
+    if ((machine != NULL) &&
+        (state < machine->stateCnt))
+    {
+        activeState = machine->currentState;
+        while ((activeState != NW_STATE_NONE) &&
+               (retRes == nwFalse))
+        {
+            retRes = (activeState == state) ? nwTrue : nwFalse;
+            activeState = machine->states[activeState].parentState;
+        }
+    }
+
+    return retRes;
+}
+
+void NexaWatt_StateManager_Get_Stats(const NexaWattStateMachine* const machine, NexaWattStateMachineStats* const machineStats)
+{
+    NwCriticalSectionState criticalSectionState = 0u;
+
+    if ((machine != NULL) &&
+        (machineStats != NULL))
+    {
+        criticalSectionState = NexaWatt_Platform_Critical_Section_Enter();
+        *machineStats = machine->stats;
+        NexaWatt_Platform_Critical_Section_Exit(criticalSectionState);
+    }
+}
+
+static nw_bool NexaWatt_StateManager_Validate_Config(const NexaWattStateMachineConfig* const machineConfig, uint8* const depths)
+{
+    nw_bool retRes = nwFalse;
+    const NexaWattStateDescriptor* descriptor = NULL;
+    uint8 state = 0u;
+    uint8 ancestor = 0u;
+    uint8 depth = 0u;
+    uint8 child = 0u;
+    uint8 transitionIdx = 0u;
+    uint32 entryIdx = 0u;
+    uint32 entryCnt = 0u;
+
+    if ((machineConfig != NULL) &&
+        (machineConfig->states != NULL) &&
+        (machineConfig->transitions != NULL) &&
+        (machineConfig->dispatchTable != NULL) &&
+        (machineConfig->stateCnt > 0u) &&
+        (machineConfig->stateCnt <= NW_STATE_MAX_STATES) &&
+        (machineConfig->transitionCnt > 0u) &&
+        (machineConfig->transitionCnt < NW_STATE_TRANSITION_NONE) &&
+        (machineConfig->eventCnt > 0u) &&
+        (machineConfig->topState < machineConfig->stateCnt) &&
+        (machineConfig->states[machineConfig->topState].parentState == NW_STATE_NONE))
+    {
+        retRes = nwTrue;
+
+        // The walk to the top state is bounded, so a cycle of parents fails as a too deep hierarchy
+        for (state = 0u; (state < machineConfig->stateCnt) && (retRes == nwTrue); state++)
+        {
+            ancestor = state;
+            depth = 0u;
+            while ((ancestor != machineConfig->topState) &&
+                   (ancestor < machineConfig->stateCnt) &&
+                   (depth < NW_STATE_MAX_DEPTH))
+            {
+                ancestor = machineConfig->states[ancestor].parentState;
+                depth++;
+            }
+
+            if ((ancestor == machineConfig->topState) &&
+                (depth < NW_STATE_MAX_DEPTH))
+            {
+                depths[state] = depth;
+            }
+            else
+            {
+                retRes = nwFalse;
+            }
+        }
+
+        for (state = 0u; (state < machineConfig->stateCnt) && (retRes == nwTrue); state++)
+        {
+            descriptor = &machineConfig->states[state];
+            child = descriptor->initialChild;
+            if ((child != NW_STATE_NONE) &&
+                ((child >= machineConfig->stateCnt) || (machineConfig->states[child].parentState != state)))
+            {
+                retRes = nwFalse;
+            }
+        }
+
+        for (transitionIdx = 0u; (transitionIdx < machineConfig->transitionCnt) && (retRes == nwTrue); transitionIdx++)
+        {
+            state = machineConfig->transitions[transitionIdx].targetState;
+            if ((state != NW_STATE_NONE) &&
+                (state >= machineConfig->stateCnt))
+            {
+                retRes = nwFalse;
+            }
+        }
+
+        entryCnt = (uint32)machineConfig->stateCnt * machineConfig->eventCnt;
+        for (entryIdx = 0u; (entryIdx < entryCnt) && (retRes == nwTrue); entryIdx++)
+        {
+            if ((machineConfig->dispatchTable[entryIdx] != NW_STATE_TRANSITION_NONE) &&
+                (machineConfig->dispatchTable[entryIdx] >= machineConfig->transitionCnt))
+            {
+                retRes = nwFalse;
+            }
+        }
+    }
+
+    return retRes;
+}
+
+static uint8 NexaWatt_StateManager_Drill_Down(NexaWattStateMachine* const machine, const uint8 state, const uint32 eventArg)
+{
+    uint8 leafState = state;
+    NwStateAction entryAction = NULL;
+
+    while (machine->states[leafState].initialChild != NW_STATE_NONE)
+    {
+        leafState = machine->states[leafState].initialChild;
+        entryAction = machine->states[leafState].entryAction;
+        if (entryAction != NULL)
+        {
+            entryAction(machine->context, eventArg);
+        }
+    }
+
+    return leafState;
+}
+
+static void NexaWatt_StateManager_Execute_Transition(NexaWattStateMachine* const machine, const uint8 sourceState, const NexaWattStateTransition* const transition, const uint32 eventArg)
+{
+    const NexaWattStateDescriptor* const states = machine->states;
+    uint8 enterPath[NW_STATE_MAX_DEPTH];
+    uint8 enterCnt = 0u;
+    uint8 sourceAncestor = sourceState;
+    uint8 targetAncestor = transition->targetState;
+    uint8 domainState = NW_STATE_NONE;
+    uint8 state = NW_STATE_NONE;
+    NwStateAction stateAction = NULL;
+
+    if (transition->targetState == NW_STATE_NONE)
+    {
+        // Internal transition: the active states are kept
+        if (transition->action != NULL)
+        {
+            transition->action(machine->context, eventArg);
+        }
+    }
+    else
+    {
+        // The domain of the transition is the least common ancestor of the source and the target;
+        // the target itself is always exited and entered again, a source containing the target is kept
+        while (machine->depths[sourceAncestor] > machine->depths[targetAncestor])
+        {
+            sourceAncestor = states[sourceAncestor].parentState;
+        }
+        while (machine->depths[targetAncestor] > machine->depths[sourceAncestor])
+        {
+            targetAncestor = states[targetAncestor].parentState;
+        }
+        while (sourceAncestor != targetAncestor)
+        {
+            sourceAncestor = states[sourceAncestor].parentState;
+            targetAncestor = states[targetAncestor].parentState;
+        }
+        domainState = (sourceAncestor == transition->targetState) ? states[sourceAncestor].parentState : sourceAncestor;
+
+        state = machine->currentState;
+        while (state != domainState)
+        {
+            stateAction = states[state].exitAction;
+            if (stateAction != NULL)
+            {
+                stateAction(machine->context, eventArg);
+            }
+            state = states[state].parentState;
+        }
+
+        if (transition->action != NULL)
+        {
+            transition->action(machine->context, eventArg);
+        }
+
+        state = transition->targetState;
+        while (state != domainState)
+        {
+            enterPath[enterCnt] = state;
+            enterCnt++;
+            state = states[state].parentState;
+        }
+        while (enterCnt > 0u)
+        {
+            enterCnt--;
+            stateAction = states[enterPath[enterCnt]].entryAction;
+            if (stateAction != NULL)
+            {
+                stateAction(machine->context, eventArg);
+            }
+        }
+
+        machine->currentState = NexaWatt_StateManager_Drill_Down(machine, transition->targetState, eventArg);
+    }
+}
+
+static nw_bool NexaWatt_StateManager_Dispatch(NexaWattStateMachine* const machine, const NexaWattStateEvent* const event)
+{
+    nw_bool retRes = nwFalse;
+    const NexaWattStateTransition* transition = NULL;
+    uint8 state = machine->currentState;
+    uint8 transitionIdx = NW_STATE_TRANSITION_NONE;
+
+    // One table lookup per hierarchy level: a state, which has no entry for the event or whose guard
+    // rejects it, passes the event to its parent
+    while ((state != NW_STATE_NONE) &&
+           (retRes == nwFalse))
+    {
+        transitionIdx = machine->dispatchTable[((uint32)state * machine->eventCnt) + event->eventId];
+        if (transitionIdx != NW_STATE_TRANSITION_NONE)
+        {
+            transition = &machine->transitions[transitionIdx];
+            if ((transition->guard == NULL) ||
+                (transition->guard(machine->context, event->eventArg) == nwTrue))
+            {
+                NexaWatt_StateManager_Execute_Transition(machine, state, transition, event->eventArg);
+                retRes = nwTrue;
+            }
+        }
+
+        state = machine->states[state].parentState;
+    }
+
+    return retRes;
+}
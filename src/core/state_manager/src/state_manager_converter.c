@@ -0,0 +1,284 @@
+/*******************************************************************************
+* File Name:   state_manager_converter.c
+*
+* Description: This is the source file containing definitions,
+* related to the operating state machine of a converter.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "state_manager_converter.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define NW_CONVERTER_TR_NONE                (NW_STATE_TRANSITION_NONE)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+/**
+ * \brief Indices of the transition list.
+ */
+typedef enum eNexaWattConverterTransition
+{
+    NW_CONVERTER_TR_INIT_DONE       = 0u,
+    NW_CONVERTER_TR_START           = 1u,
+    NW_CONVERTER_TR_PRECHARGE_DONE  = 2u,
+    NW_CONVERTER_TR_SOFTSTART_DONE  = 3u,
+    NW_CONVERTER_TR_DERATE          = 4u,
+    NW_CONVERTER_TR_DERATE_CLEAR    = 5u,
+    NW_CONVERTER_TR_STOP            = 6u,
+    NW_CONVERTER_TR_FAULT           = 7u,
+    NW_CONVERTER_TR_FAULT_REPEATED  = 8u,
+    NW_CONVERTER_TR_FAULT_CLEAR     = 9u,
+    NW_CONVERTER_TR_CNT             = 10u,
+} NexaWattConverterTransition;
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that calls an optional application hook.
+ * \param hook - The hook, NULL if not provided.
+ * \param converter - A pointer to the converter state machine.
+ * \param eventArg - The argument of the processed event.
+ */
+static void NexaWatt_StateManager_Converter_Call_Hook(NwStateAction hook, const NexaWattConverterStateMachine* converter, uint32 eventArg);
+
+/**
+ * \brief Entry and exit actions of the state table, forwarding to the application hooks.
+ * \param context - A pointer to the converter state machine.
+ * \param eventArg - The argument of the processed event.
+ */
+static void NexaWatt_StateManager_Converter_Init_Enter(void* context, uint32 eventArg);
+static void NexaWatt_StateManager_Converter_Shutdown_Enter(void* context, uint32 eventArg);
+static void NexaWatt_StateManager_Converter_Precharge_Enter(void* context, uint32 eventArg);
+static void NexaWatt_StateManager_Converter_Softstart_Enter(void* context, uint32 eventArg);
+static void NexaWatt_StateManager_Converter_Run_Enter(void* context, uint32 eventArg);
+static void NexaWatt_StateManager_Converter_Derate_Enter(void* context, uint32 eventArg);
+static void NexaWatt_StateManager_Converter_Fault_Enter(void* context, uint32 eventArg);
+static void NexaWatt_StateManager_Converter_Active_Exit(void* context, uint32 eventArg);
+
+/**
+ * \brief Guards of the transition list, forwarding to the application hooks. A missing hook accepts the transition.
+ * \param context - A pointer to the converter state machine.
+ * \param eventArg - The argument of the processed event.
+ * \return nwTrue - The transition is taken. nwFalse - The transition is rejected.
+ */
+static nw_bool NexaWatt_StateManager_Converter_Can_Start(void* context, uint32 eventArg);
+static nw_bool NexaWatt_StateManager_Converter_Can_Clear_Fault(void* context, uint32 eventArg);
+
+/**
+ * \brief State table, indexed by NexaWattConverterState: the parent, the initial child, the entry and the exit action.
+ */
+static const NexaWattStateDescriptor converterStates[] =
+{
+    // TOP
+    { NW_STATE_NONE,               NW_CONVERTER_STATE_INIT,      NULL,                                              NULL },
+    // INIT
+    { NW_CONVERTER_STATE_TOP,      NW_STATE_NONE,                NexaWatt_StateManager_Converter_Init_Enter,        NULL },
+    // SHUTDOWN
+    { NW_CONVERTER_STATE_TOP,      NW_STATE_NONE,                NexaWatt_StateManager_Converter_Shutdown_Enter,    NULL },
+    // ACTIVE
+    { NW_CONVERTER_STATE_TOP,      NW_CONVERTER_STATE_PRECHARGE, NULL,                                              NexaWatt_StateManager_Converter_Active_Exit },
+    // PRECHARGE
+    { NW_CONVERTER_STATE_ACTIVE,   NW_STATE_NONE,                NexaWatt_StateManager_Converter_Precharge_Enter,   NULL },
+    // SOFTSTART
+    { NW_CONVERTER_STATE_ACTIVE,   NW_STATE_NONE,                NexaWatt_StateManager_Converter_Softstart_Enter,   NULL },
+    // POWER
+    { NW_CONVERTER_STATE_ACTIVE,   NW_CONVERTER_STATE_RUN,       NULL,                                              NULL },
+    // RUN
+    { NW_CONVERTER_STATE_POWER,    NW_STATE_NONE,                NexaWatt_StateManager_Converter_Run_Enter,         NULL },
+    // DERATE
+    { NW_CONVERTER_STATE_POWER,    NW_STATE_NONE,                NexaWatt_StateManager_Converter_Derate_Enter,      NULL },
+    // FAULT
+    { NW_CONVERTER_STATE_TOP,      NW_STATE_NONE,                NexaWatt_StateManager_Converter_Fault_Enter,       NULL },
+};
+
+/**
+ * \brief Transition list, indexed by NexaWattConverterTransition: the target, the guard and the action.
+ */
+static const NexaWattStateTransition converterTransitions[] =
+{
+    // INIT_DONE
+    { NW_CONVERTER_STATE_SHUTDOWN,   NULL,                                           NULL },
+    // START
+    { NW_CONVERTER_STATE_ACTIVE,     NexaWatt_StateManager_Converter_Can_Start,      NULL },
+    // PRECHARGE_DONE
+    { NW_CONVERTER_STATE_SOFTSTART,  NULL,                                           NULL },
+    // SOFTSTART_DONE
+    { NW_CONVERTER_STATE_POWER,      NULL,                                           NULL },
+    // DERATE
+    { NW_CONVERTER_STATE_DERATE,     NULL,                                           NULL },
+    // DERATE_CLEAR
+    { NW_CONVERTER_STATE_RUN,        NULL,                                           NULL },
+    // STOP
+    { NW_CONVERTER_STATE_SHUTDOWN,   NULL,                                           NULL },
+    // FAULT
+    { NW_CONVERTER_STATE_FAULT,      NULL,                                           NULL },
+    // FAULT_REPEATED
+    { NW_STATE_NONE,                 NULL,                                           NULL },
+    // FAULT_CLEAR
+    { NW_CONVERTER_STATE_SHUTDOWN,   NexaWatt_StateManager_Converter_Can_Clear_Fault, NULL },
+};
+
+/**
+ * \brief Dispatch table, a row of transitions per state. The columns are the events in the order of NexaWattConverterEvent:
+ * INIT_DONE, START, PRECHARGE_DONE, SOFTSTART_DONE, DERATE, DERATE_CLEAR, STOP, FAULT, FAULT_CLEAR.
+ */
+static const uint8 converterDispatchTable[][NW_CONVERTER_EVENT_CNT] =
+{
+    // TOP
+    { NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_FAULT, NW_CONVERTER_TR_NONE },
+    // INIT
+    { NW_CONVERTER_TR_INIT_DONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE },
+    // SHUTDOWN
+    { NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_START, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE },
+    // ACTIVE
+    { NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_STOP, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE },
+    // PRECHARGE
+    { NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_PRECHARGE_DONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE },
+    // SOFTSTART
+    { NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_SOFTSTART_DONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE },
+    // POWER
+    { NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE },
+    // RUN
+    { NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_DERATE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE },
+    // DERATE
+    { NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_DERATE_CLEAR, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE },
+    // FAULT
+    { NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_NONE, NW_CONVERTER_TR_FAULT_REPEATED, NW_CONVERTER_TR_FAULT_CLEAR },
+};
+
+NW_STATIC_ASSERT((sizeof(converterStates) / sizeof(converterStates[0u])) == NW_CONVERTER_STATE_CNT, converter_states_size);
+NW_STATIC_ASSERT((sizeof(converterTransitions) / sizeof(converterTransitions[0u])) == NW_CONVERTER_TR_CNT, converter_transitions_size);
+NW_STATIC_ASSERT((sizeof(converterDispatchTable) / sizeof(converterDispatchTable[0u])) == NW_CONVERTER_STATE_CNT, converter_dispatch_table_size);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattStateManagerStatusResult NexaWatt_StateManager_Converter_Init(NexaWattConverterStateMachine* const converter, const NexaWattConverterStateHooks* const converterHooks)
+{
+    NexaWattStateManagerStatusResult retRes = NW_STATE_MANAGER_BAD_PARAM;
+    NexaWattStateMachineConfig machineConfig;
+
+    // A fault must never be cleared without the decision of the application, so the fault clearance guard is mandatory
+    if ((converter != NULL) &&
+        (converterHooks != NULL) &&
+        (converterHooks->canClearFault != NULL))
+    {
+        converter->hooks = *converterHooks;
+
+        machineConfig.states = converterStates;
+        machineConfig.stateCnt = (uint8)NW_CONVERTER_STATE_CNT;
+        machineConfig.transitions = converterTransitions;
+        machineConfig.transitionCnt = (uint8)NW_CONVERTER_TR_CNT;
+        machineConfig.dispatchTable = &converterDispatchTable[0][0];
+        machineConfig.eventCnt = (uint8)NW_CONVERTER_EVENT_CNT;
+        machineConfig.topState = (uint8)NW_CONVERTER_STATE_TOP;
+        machineConfig.context = converter;
+
+        retRes = NexaWatt_StateManager_Init(&converter->machine, &machineConfig);
+    }
+
+    return retRes;
+}
+
+static void NexaWatt_StateManager_Converter_Call_Hook(const NwStateAction hook, const NexaWattConverterStateMachine* const converter, const uint32 eventArg)
+{
+    if (hook != NULL)
+    {
+        hook(converter->hooks.appContext, eventArg);
+    }
+}
+
+static void NexaWatt_StateManager_Converter_Init_Enter(void* const context, const uint32 eventArg)
+{
+    const NexaWattConverterStateMachine* const converter = (const NexaWattConverterStateMachine*)context;
+
+    NexaWatt_StateManager_Converter_Call_Hook(converter->hooks.onInitEnter, converter, eventArg);
+}
+
+static void NexaWatt_StateManager_Converter_Shutdown_Enter(void* const context, const uint32 eventArg)
+{
+    const NexaWattConverterStateMachine* const converter = (const NexaWattConverterStateMachine*)context;
+
+    NexaWatt_StateManager_Converter_Call_Hook(converter->hooks.onShutdownEnter, converter, eventArg);
+}
+
+static void NexaWatt_StateManager_Converter_Precharge_Enter(void* const context, const uint32 eventArg)
+{
+    const NexaWattConverterStateMachine* const converter = (const NexaWattConverterStateMachine*)context;
+
+    NexaWatt_StateManager_Converter_Call_Hook(converter->hooks.onPrechargeEnter, converter, eventArg);
+}
+
+static void NexaWatt_StateManager_Converter_Softstart_Enter(void* const context, const uint32 eventArg)
+{
+    const NexaWattConverterStateMachine* const converter = (const NexaWattConverterStateMachine*)context;
+
+    NexaWatt_StateManager_Converter_Call_Hook(converter->hooks.onSoftstartEnter, converter, eventArg);
+}
+
+static void NexaWatt_StateManager_Converter_Run_Enter(void* const context, const uint32 eventArg)
+{
+    const NexaWattConverterStateMachine* const converter = (const NexaWattConverterStateMachine*)context;
+
+    NexaWatt_StateManager_Converter_Call_Hook(converter->hooks.onRunEnter, converter, eventArg);
+}
+
+static void NexaWatt_StateManager_Converter_Derate_Enter(void* const context, const uint32 eventArg)
+{
+    const NexaWattConverterStateMachine* const converter = (const NexaWattConverterStateMachine*)context;
+
+    NexaWatt_StateManager_Converter_Call_Hook(converter->hooks.onDerateEnter, converter, eventArg);
+}
+
+static void NexaWatt_StateManager_Converter_Fault_Enter(void* const context, const uint32 eventArg)
+{
+    const NexaWattConverterStateMachine* const converter = (const NexaWattConverterStateMachine*)context;
+
+    NexaWatt_StateManager_Converter_Call_Hook(converter->hooks.onFaultEnter, converter, eventArg);
+}
+
+static void NexaWatt_StateManager_Converter_Active_Exit(void* const context, const uint32 eventArg)
+{
+    const NexaWattConverterStateMachine* const converter = (const NexaWattConverterStateMachine*)context;
+
+    NexaWatt_StateManager_Converter_Call_Hook(converter->hooks.onActiveExit, converter, eventArg);
+}
+
+static nw_bool NexaWatt_StateManager_Converter_Can_Start(void* const context, const uint32 eventArg)
+{
+    const NexaWattConverterStateMachine* const converter = (const NexaWattConverterStateMachine*)context;
+    nw_bool retRes = nwTrue;
+
+    if (converter->hooks.canStart != NULL)
+    {
+        retRes = converter->hooks.canStart(converter->hooks.appContext, eventArg);
+    }
+
+    return retRes;
+}
+
+static nw_bool NexaWatt_StateManager_Converter_Can_Clear_Fault(void* const context, const uint32 eventArg)
+{
+    const NexaWattConverterStateMachine* const converter = (const NexaWattConverterStateMachine*)context;
+    nw_bool retRes = nwFalse;
+
+    if (converter->hooks.canClearFault != NULL)
+    {
+        retRes = converter->hooks.canClearFault(converter->hooks.appContext, eventArg);
+    }
+
+    return retRes;
+}
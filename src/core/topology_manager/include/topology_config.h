@@ -0,0 +1,118 @@
+/*******************************************************************************
+* File Name:   topology_config.h
+*
+* Description: This is the header file containing the user configuration of the
+* power converter topology for the NexaWatt-IV.DC framework. The topology and its
+* parameters are selected at compile time. Every setting can also be overridden
+* from the DEFINES variable of the application Makefile.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_TOPOLOGY_CONFIG_H
+#define NEXAWATT_IV_DC_TOPOLOGY_CONFIG_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "topology_types.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief The topology of the controlled power converter. Use one of the NW_TOPOLOGY_ID_* values.
+ */
+#ifndef NW_TOPOLOGY_SELECTED
+#define NW_TOPOLOGY_SELECTED                NW_TOPOLOGY_ID_BUCK_SYNC
+#endif
+
+/**
+ * \brief PWM channels driving the converter legs. The second channel is used
+ * only by the phase-shifted full bridge (lagging leg).
+ */
+#ifndef NW_TOPOLOGY_LEG_A_PWM_CHANNEL
+#define NW_TOPOLOGY_LEG_A_PWM_CHANNEL       (0u)
+#endif
+
+#ifndef NW_TOPOLOGY_LEG_B_PWM_CHANNEL
+#define NW_TOPOLOGY_LEG_B_PWM_CHANNEL       (1u)
+#endif
+
+/**
+ * \brief Maximum number of interleaved phases of the power stage. Every phase is a
+ * separate leg of the selected topology with its own PWM channel and current sensing.
+ */
+#ifndef NW_TOPOLOGY_PHASE_CNT_MAX
+#define NW_TOPOLOGY_PHASE_CNT_MAX           (4u)
+#endif
+
+/**
+ * \brief PWM channel of the first interleaved phase. The phases use consecutive PWM channels.
+ */
+#ifndef NW_TOPOLOGY_PHASE_FIRST_PWM_CHANNEL
+#define NW_TOPOLOGY_PHASE_FIRST_PWM_CHANNEL (0u)
+#endif
+
+/**
+ * \brief Secondary to primary turns ratio of the transformer (Q16.16). Used only by isolated topologies.
+ */
+#ifndef NW_TOPOLOGY_TRANSFORMER_RATIO
+#define NW_TOPOLOGY_TRANSFORMER_RATIO       NW_Q16_CONST(0.5)
+#endif
+
+/**
+ * \brief Operating limits of the power stage, normalized to the voltage and current base (Q15).
+ */
+#ifndef NW_TOPOLOGY_VIN_MIN
+#define NW_TOPOLOGY_VIN_MIN                 NW_Q15_CONST(0.1)
+#endif
+
+#ifndef NW_TOPOLOGY_VIN_MAX
+#define NW_TOPOLOGY_VIN_MAX                 NW_Q15_CONST(0.9)
+#endif
+
+#ifndef NW_TOPOLOGY_VOUT_MAX
+#define NW_TOPOLOGY_VOUT_MAX                NW_Q15_CONST(0.9)
+#endif
+
+#ifndef NW_TOPOLOGY_CURRENT_MAX
+#define NW_TOPOLOGY_CURRENT_MAX             NW_Q15_CONST(0.8)
+#endif
+
+/**
+ * \brief Duty cycle (or phase shift ratio) limits of the modulator (Q15).
+ * The default maximum is reduced for the boost-derived topologies to keep the gain bounded.
+ */
+#ifndef NW_TOPOLOGY_DUTY_MIN
+#define NW_TOPOLOGY_DUTY_MIN                NW_Q15_CONST(0.02)
+#endif
+
+#ifndef NW_TOPOLOGY_DUTY_MAX
+#if (NW_TOPOLOGY_SELECTED == NW_TOPOLOGY_ID_BUCK) || \
+    (NW_TOPOLOGY_SELECTED == NW_TOPOLOGY_ID_BUCK_SYNC) || \
+    (NW_TOPOLOGY_SELECTED == NW_TOPOLOGY_ID_PSFB)
+#define NW_TOPOLOGY_DUTY_MAX                NW_Q15_CONST(0.95)
+#else
+#define NW_TOPOLOGY_DUTY_MAX                NW_Q15_CONST(0.85)
+#endif
+#endif
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+#endif
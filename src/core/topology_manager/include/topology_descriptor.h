@@ -0,0 +1,201 @@
+/*******************************************************************************
+* File Name:   topology_descriptor.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the Topology Descriptor of the NexaWatt-IV.DC framework.
+* The descriptor translates the compile-time topology selection of topology_config.h
+* into constants and inline functions. The control and safety components use them,
+* so no runtime branching on the topology is performed in the control ISR.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_TOPOLOGY_DESCRIPTOR_H
+#define NEXAWATT_IV_DC_TOPOLOGY_DESCRIPTOR_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+#include "platform_fixed_point.h"
+#include "topology_types.h"
+#include "topology_config.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#if (NW_TOPOLOGY_SELECTED == NW_TOPOLOGY_ID_BUCK)
+#define NW_TOPOLOGY_MODULATION              NW_TOPOLOGY_MOD_DUTY
+#define NW_TOPOLOGY_SWITCH_CNT              (1u)
+#define NW_TOPOLOGY_LEG_CNT                 (1u)
+#define NW_TOPOLOGY_IS_SYNCHRONOUS          (0u)
+#define NW_TOPOLOGY_IS_INVERTING            (0u)
+#define NW_TOPOLOGY_IS_ISOLATED             (0u)
+#define NW_TOPOLOGY_SENSE_MASK              (NW_TOPOLOGY_SENSE_VIN | NW_TOPOLOGY_SENSE_VOUT | NW_TOPOLOGY_SENSE_IL)
+
+#elif (NW_TOPOLOGY_SELECTED == NW_TOPOLOGY_ID_BUCK_SYNC)
+#define NW_TOPOLOGY_MODULATION              NW_TOPOLOGY_MOD_DUTY
+#define NW_TOPOLOGY_SWITCH_CNT              (2u)
+#define NW_TOPOLOGY_LEG_CNT                 (1u)
+#define NW_TOPOLOGY_IS_SYNCHRONOUS          (1u)
+#define NW_TOPOLOGY_IS_INVERTING            (0u)
+#define NW_TOPOLOGY_IS_ISOLATED             (0u)
+#define NW_TOPOLOGY_SENSE_MASK              (NW_TOPOLOGY_SENSE_VIN | NW_TOPOLOGY_SENSE_VOUT | NW_TOPOLOGY_SENSE_IL)
+
+#elif (NW_TOPOLOGY_SELECTED == NW_TOPOLOGY_ID_BOOST)
+#define NW_TOPOLOGY_MODULATION              NW_TOPOLOGY_MOD_DUTY
+#define NW_TOPOLOGY_SWITCH_CNT              (1u)
+#define NW_TOPOLOGY_LEG_CNT                 (1u)
+#define NW_TOPOLOGY_IS_SYNCHRONOUS          (0u)
+#define NW_TOPOLOGY_IS_INVERTING            (0u)
+#define NW_TOPOLOGY_IS_ISOLATED             (0u)
+#define NW_TOPOLOGY_SENSE_MASK              (NW_TOPOLOGY_SENSE_VIN | NW_TOPOLOGY_SENSE_VOUT | NW_TOPOLOGY_SENSE_IL)
+
+#elif (NW_TOPOLOGY_SELECTED == NW_TOPOLOGY_ID_BOOST_SYNC)
+#define NW_TOPOLOGY_MODULATION              NW_TOPOLOGY_MOD_DUTY
+#define NW_TOPOLOGY_SWITCH_CNT              (2u)
+#define NW_TOPOLOGY_LEG_CNT                 (1u)
+#define NW_TOPOLOGY_IS_SYNCHRONOUS          (1u)
+#define NW_TOPOLOGY_IS_INVERTING            (0u)
+#define NW_TOPOLOGY_IS_ISOLATED             (0u)
+#define NW_TOPOLOGY_SENSE_MASK              (NW_TOPOLOGY_SENSE_VIN | NW_TOPOLOGY_SENSE_VOUT | NW_TOPOLOGY_SENSE_IL)
+
+#elif (NW_TOPOLOGY_SELECTED == NW_TOPOLOGY_ID_BUCK_BOOST)
+#define NW_TOPOLOGY_MODULATION              NW_TOPOLOGY_MOD_DUTY
+#define NW_TOPOLOGY_SWITCH_CNT              (1u)
+#define NW_TOPOLOGY_LEG_CNT                 (1u)
+#define NW_TOPOLOGY_IS_SYNCHRONOUS          (0u)
+#define NW_TOPOLOGY_IS_INVERTING            (1u)
+#define NW_TOPOLOGY_IS_ISOLATED             (0u)
+#define NW_TOPOLOGY_SENSE_MASK              (NW_TOPOLOGY_SENSE_VIN | NW_TOPOLOGY_SENSE_VOUT | NW_TOPOLOGY_SENSE_IL)
+
+#elif (NW_TOPOLOGY_SELECTED == NW_TOPOLOGY_ID_BUCK_BOOST_SYNC)
+#define NW_TOPOLOGY_MODULATION              NW_TOPOLOGY_MOD_DUTY
+#define NW_TOPOLOGY_SWITCH_CNT              (2u)
+#define NW_TOPOLOGY_LEG_CNT                 (1u)
+#define NW_TOPOLOGY_IS_SYNCHRONOUS          (1u)
+#define NW_TOPOLOGY_IS_INVERTING            (1u)
+#define NW_TOPOLOGY_IS_ISOLATED             (0u)
+#define NW_TOPOLOGY_SENSE_MASK              (NW_TOPOLOGY_SENSE_VIN | NW_TOPOLOGY_SENSE_VOUT | NW_TOPOLOGY_SENSE_IL)
+
+#elif (NW_TOPOLOGY_SELECTED == NW_TOPOLOGY_ID_PSFB)
+#define NW_TOPOLOGY_MODULATION              NW_TOPOLOGY_MOD_PHASE_SHIFT
+#define NW_TOPOLOGY_SWITCH_CNT              (4u)
+#define NW_TOPOLOGY_LEG_CNT                 (2u)
+#define NW_TOPOLOGY_IS_SYNCHRONOUS          (0u)
+#define NW_TOPOLOGY_IS_INVERTING            (0u)
+#define NW_TOPOLOGY_IS_ISOLATED             (1u)
+#define NW_TOPOLOGY_SENSE_MASK              (NW_TOPOLOGY_SENSE_VIN | NW_TOPOLOGY_SENSE_VOUT | NW_TOPOLOGY_SENSE_IPRI | NW_TOPOLOGY_SENSE_IOUT)
+
+#else
+#error "NW_TOPOLOGY_SELECTED does not contain a topology supported by the NexaWatt-IV.DC framework"
+#endif
+
+#if (NW_TOPOLOGY_LEG_CNT > NW_TOPOLOGY_MAX_PWM_CHANNELS)
+#error "The selected topology requires more PWM channels than supported by the framework"
+#endif
+
+/**
+ * \brief Complementary output usage of the leg PWM channels. All legs of the full bridge
+ * drive both switches, the single leg topologies use it only when synchronous.
+ */
+#if (NW_TOPOLOGY_SWITCH_CNT > NW_TOPOLOGY_LEG_CNT)
+#define NW_TOPOLOGY_COMPLEMENTARY_USED      (nwTrue)
+#else
+#define NW_TOPOLOGY_COMPLEMENTARY_USED      (nwFalse)
+#endif
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Function used to obtain the flash-resident descriptor of the selected topology.
+ * The descriptor is intended for initialization, diagnostics and the debug interfaces.
+ * The time-critical components should use the compile-time macros instead.
+ * \return A pointer to the constant topology descriptor. The pointer is never NULL.
+ */
+const NexaWattTopologyDescriptor* NexaWatt_Topology_Get_Descriptor(void);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/**
+ * \brief Clamps a duty cycle (or phase shift ratio) command to the limits of the selected topology.
+ * \param duty - The duty cycle command in Q15 format.
+ * \return The clamped duty cycle command in Q15 format.
+ */
+NW_LOCAL_INLINE NwQ15 NexaWatt_Topology_Clamp_Duty(const NwQ15 duty)
+{
+    return NexaWatt_FixedPoint_Saturate(duty, NW_TOPOLOGY_DUTY_MIN, NW_TOPOLOGY_DUTY_MAX);
+}
+
+/**
+ * \brief Calculates the ideal steady-state (CCM) voltage gain M = Vout / Vin of the selected topology
+ * for the provided duty cycle. The gain of inverting topologies is returned as magnitude.
+ * \param duty - The duty cycle (or phase shift ratio) in Q15 format.
+ * \return The voltage gain in Q15 format. Gains above 1.0 are representable, as the Q15 container is 32-bit.
+ */
+NW_LOCAL_INLINE NwQ15 NexaWatt_Topology_Duty_To_Gain(const NwQ15 duty)
+{
+    NwQ15 clampedDuty = NexaWatt_Topology_Clamp_Duty(duty);
+
+#if (NW_TOPOLOGY_SELECTED == NW_TOPOLOGY_ID_BUCK) || (NW_TOPOLOGY_SELECTED == NW_TOPOLOGY_ID_BUCK_SYNC)
+    // M = D
+    return clampedDuty;
+#elif (NW_TOPOLOGY_SELECTED == NW_TOPOLOGY_ID_BOOST) || (NW_TOPOLOGY_SELECTED == NW_TOPOLOGY_ID_BOOST_SYNC)
+    // M = 1 / (1 - D)
+    return (NwQ15)((((int64)NW_Q15_ONE) << NW_Q15_FRAC_BITS) / (int64)(NW_Q15_ONE - clampedDuty));
+#elif (NW_TOPOLOGY_SELECTED == NW_TOPOLOGY_ID_BUCK_BOOST) || (NW_TOPOLOGY_SELECTED == NW_TOPOLOGY_ID_BUCK_BOOST_SYNC)
+    // |M| = D / (1 - D)
+    return (NwQ15)((((int64)clampedDuty) << NW_Q15_FRAC_BITS) / (int64)(NW_Q15_ONE - clampedDuty));
+#elif (NW_TOPOLOGY_SELECTED == NW_TOPOLOGY_ID_PSFB)
+    // M = n * D
+    return NexaWatt_FixedPoint_Mul_Q16(clampedDuty, NW_TOPOLOGY_TRANSFORMER_RATIO);
+#endif
+}
+
+/**
+ * \brief Calculates the ideal steady-state (CCM) duty cycle of the selected topology for the provided
+ * input and output voltage. The result is used as feedforward term of the voltage controller.
+ * The function contains a single hardware division and no branches on the topology.
+ * \param vin - The input voltage in Q15 format, normalized to the voltage base.
+ * \param vout - The magnitude of the output voltage in Q15 format, normalized to the voltage base.
+ * \return The feedforward duty cycle in Q15 format, clamped to the topology limits.
+ * The minimum duty cycle is returned if the input voltage is not positive.
+ */
+NW_LOCAL_INLINE NwQ15 NexaWatt_Topology_Duty_Feedforward(const NwQ15 vin, const NwQ15 vout)
+{
+    NwQ15 duty = NW_TOPOLOGY_DUTY_MIN;
+
+    if ((vin > 0) && (vout >= 0))
+    {
+#if (NW_TOPOLOGY_SELECTED == NW_TOPOLOGY_ID_BUCK) || (NW_TOPOLOGY_SELECTED == NW_TOPOLOGY_ID_BUCK_SYNC)
+        // D = Vout / Vin
+        duty = (NwQ15)((((int64)vout) << NW_Q15_FRAC_BITS) / (int64)vin);
+#elif (NW_TOPOLOGY_SELECTED == NW_TOPOLOGY_ID_BOOST) || (NW_TOPOLOGY_SELECTED == NW_TOPOLOGY_ID_BOOST_SYNC)
+        // D = 1 - Vin / Vout
+        duty = (vout > vin) ?
+               (NW_Q15_ONE - (NwQ15)((((int64)vin) << NW_Q15_FRAC_BITS) / (int64)vout)) : NW_TOPOLOGY_DUTY_MIN;
+#elif (NW_TOPOLOGY_SELECTED == NW_TOPOLOGY_ID_BUCK_BOOST) || (NW_TOPOLOGY_SELECTED == NW_TOPOLOGY_ID_BUCK_BOOST_SYNC)
+        // D = |Vout| / (Vin + |Vout|)
+        duty = (NwQ15)((((int64)vout) << NW_Q15_FRAC_BITS) / ((int64)vin + (int64)vout));
+#elif (NW_TOPOLOGY_SELECTED == NW_TOPOLOGY_ID_PSFB)
+        // D = Vout / (n * Vin)
+        duty = (NwQ15)((((int64)vout) << (NW_Q15_FRAC_BITS + NW_Q16_FRAC_BITS)) /
+                       ((int64)vin * (int64)NW_TOPOLOGY_TRANSFORMER_RATIO));
+#endif
+    }
+
+    return NexaWatt_Topology_Clamp_Duty(duty);
+}
+
+#endif
@@ -0,0 +1,143 @@
+/*******************************************************************************
+* File Name:   topology_multiphase.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the interleaved multiphase operation of the Topology Manager of the
+* NexaWatt-IV.DC framework. The component balances the phase currents, assigns the
+* phase shifts of the active phases and adds or sheds phases depending on the load.
+* The per-phase data is stored as structure of arrays, so the per-phase loop of the
+* balancing step contains no branches and can be vectorised by the compiler.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_TOPOLOGY_MULTIPHASE_H
+#define NEXAWATT_IV_DC_TOPOLOGY_MULTIPHASE_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+#include "platform_fixed_point.h"
+#include "topology_descriptor.h"
+#include "filtering_iir.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Maximum number of interleaved phases supported by the multiphase operation.
+ */
+#define NW_MULTIPHASE_SUPPORTED_PHASE_CNT   (8u)
+
+#if (NW_TOPOLOGY_PHASE_CNT_MAX > NW_MULTIPHASE_SUPPORTED_PHASE_CNT)
+#error "NW_TOPOLOGY_PHASE_CNT_MAX exceeds the number of phases supported by the multiphase operation"
+#endif
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+typedef enum eNexaWattMultiphaseStatusResult
+{
+    NW_MULTIPHASE_SUCCESS   = 0u,
+    NW_MULTIPHASE_BAD_PARAM = 1u,
+} NexaWattMultiphaseStatusResult;
+
+/**
+ * \brief Configuration of the multiphase operation. The phase adding and shedding thresholds are
+ * relative to the nominal current of a single phase: a phase is added when the average current of the
+ * active phases exceeds addLevel and shed when the average current of the remaining phases would
+ * stay below shedLevel. shedLevel must be lower than addLevel to provide hysteresis.
+ */
+typedef struct sNexaWattMultiphaseConfig
+{
+    uint8 phaseCnt;
+    uint8 minActivePhases;
+    NwQ15 phaseCurrentNominal;
+    NwQ16 addLevel;
+    NwQ16 shedLevel;
+    uint16 dwellSamples;
+    NwQ16 balanceKp;
+    NwQ16 balanceKi;
+    NwQ15 trimLimit;
+    NwQ16 totalCurrentAlpha;
+} NexaWattMultiphaseConfig;
+
+/**
+ * \brief Runtime data of the multiphase operation, stored as structure of arrays.
+ * phaseEnableMask contains -1 (all bits set) for active phases and 0 for shed phases,
+ * so it can be used as bitwise mask of the duty cycle commands.
+ * phaseShift contains the phase delay of each phase as fraction of the switching period (Q16.16).
+ */
+typedef struct sNexaWattMultiphase
+{
+    NexaWattMultiphaseConfig config;
+    NwQ15 phaseDuty[NW_TOPOLOGY_PHASE_CNT_MAX];
+    NwQ15 balanceIntegrator[NW_TOPOLOGY_PHASE_CNT_MAX];
+    int32 phaseEnableMask[NW_TOPOLOGY_PHASE_CNT_MAX];
+    NwQ16 phaseShift[NW_TOPOLOGY_PHASE_CNT_MAX];
+    uint8 activePhaseCnt;
+    NwQ16 activePhaseReciprocal;
+    NexaWattFilterIir1 totalCurrentFilter;
+    int8 pendingTransition;
+    uint16 dwellCnt;
+    volatile nw_bool phaseConfigChanged;
+    uint32 phaseTransitionCnt;
+} NexaWattMultiphase;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Function used to initialize the multiphase operation. All configured phases are activated initially.
+ * \param multiphase - A pointer to the multiphase instance to be initialized.
+ * \param multiphaseConfig - A pointer, containing the multiphase configuration.
+ * \return NW_MULTIPHASE_BAD_PARAM - One of the pointers is NULL, the phase count exceeds NW_TOPOLOGY_PHASE_CNT_MAX or the shedding thresholds provide no hysteresis.
+ * \return NW_MULTIPHASE_SUCCESS - The multiphase operation is initialized.
+ */
+NexaWattMultiphaseStatusResult NexaWatt_Topology_Multiphase_Init(NexaWattMultiphase* multiphase, const NexaWattMultiphaseConfig* multiphaseConfig);
+
+/**
+ * \brief Executes a single step of the multiphase operation in the control ISR. The phase currents are balanced
+ * around their average by trimming the per-phase duty cycle, and the phase adding and shedding decision is evaluated.
+ * The function contains no divisions, the phase shifts are recalculated only on phase transitions.
+ * \param multiphase - A pointer to an initialized multiphase instance.
+ * \param dutyCommand - The duty cycle command of the outer voltage loop in Q15 format.
+ * \param phaseCurrents - The measured phase currents in Q15 format, one per configured phase.
+ * \return A pointer to the per-phase duty cycles. Shed phases have duty cycle of 0.
+ */
+const NwQ15* NexaWatt_Topology_Multiphase_Step(NexaWattMultiphase* multiphase, NwQ15 dutyCommand, const NwQ15* phaseCurrents);
+
+/**
+ * \brief Function used to obtain the phase shifts of the phases. The phase shifts are changed only on phase transitions.
+ * \param multiphase - A pointer to an initialized multiphase instance.
+ * \return A pointer to the per-phase shifts as fraction of the switching period (Q16.16).
+ */
+const NwQ16* NexaWatt_Topology_Multiphase_Get_Phase_Shifts(const NexaWattMultiphase* multiphase);
+
+/**
+ * \brief Function used to check and acknowledge a phase transition. The PWM layer should update the phase shift
+ * registers only when the function returns nwTrue.
+ * \param multiphase - A pointer to an initialized multiphase instance.
+ * \return nwTrue - The active phases changed since the last call.
+ * \return nwFalse - No phase transition occurred.
+ */
+nw_bool NexaWatt_Topology_Multiphase_Ack_Phase_Change(NexaWattMultiphase* multiphase);
+
+/**
+ * \brief Function used to obtain the number of active phases.
+ * \param multiphase - A pointer to an initialized multiphase instance.
+ * \return The number of active phases.
+ */
+uint8 NexaWatt_Topology_Multiphase_Get_Active_Phase_Cnt(const NexaWattMultiphase* multiphase);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+#endif
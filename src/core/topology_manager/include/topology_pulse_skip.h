@@ -0,0 +1,112 @@
+/*******************************************************************************
+* File Name:   topology_pulse_skip.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the pulse skipping modulation of the Topology Manager of the
+* NexaWatt-IV.DC framework. Duty cycle commands below the minimum on-time of the
+* power stage are accumulated and issued as single minimum width pulses, so the
+* average duty cycle follows the controller output while pulses are skipped.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_TOPOLOGY_PULSE_SKIP_H
+#define NEXAWATT_IV_DC_TOPOLOGY_PULSE_SKIP_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+#include "platform_fixed_point.h"
+#include "topology_descriptor.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+typedef enum eNexaWattPulseSkipStatusResult
+{
+    NW_PULSE_SKIP_SUCCESS   = 0u,
+    NW_PULSE_SKIP_BAD_PARAM = 1u,
+} NexaWattPulseSkipStatusResult;
+
+/**
+ * \brief Runtime data of the pulse skipping modulation. The residual contains the part of the
+ * duty cycle commands, which was not issued yet.
+ */
+typedef struct sNexaWattPulseSkip
+{
+    NwQ15 minDuty;
+    NwQ15 residual;
+    uint32 skippedPulseCnt;
+} NexaWattPulseSkip;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Function used to initialize the pulse skipping modulation.
+ * The minimum duty cycle can be calculated as minDuty = tOnMin * fSw.
+ * \param pulseSkip - A pointer to the pulse skipping instance to be initialized.
+ * \param minDuty - The duty cycle of the shortest pulse of the power stage in Q15 format.
+ * Must be in the range [NW_TOPOLOGY_DUTY_MIN, NW_TOPOLOGY_DUTY_MAX].
+ * \return NW_PULSE_SKIP_BAD_PARAM - The pointer is NULL or the minimum duty cycle is out of range.
+ * \return NW_PULSE_SKIP_SUCCESS - The pulse skipping modulation is initialized.
+ */
+NexaWattPulseSkipStatusResult NexaWatt_Topology_Pulse_Skip_Init(NexaWattPulseSkip* pulseSkip, NwQ15 minDuty);
+
+/**
+ * \brief Function used to clear the residual and the statistics of the pulse skipping modulation.
+ * \param pulseSkip - A pointer to an initialized pulse skipping instance.
+ */
+void NexaWatt_Topology_Pulse_Skip_Reset(NexaWattPulseSkip* pulseSkip);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/**
+ * \brief Executes a single step of the pulse skipping modulation. Commands above the minimum duty cycle
+ * pass through unchanged (limited to NW_TOPOLOGY_DUTY_MAX). Lower commands are accumulated and a pulse with
+ * the minimum duty cycle is issued, once the accumulated commands reach it. The transition between both
+ * regions is seamless, as the average delivered duty cycle equals the command in both of them.
+ * The function must be applied to the raw controller output instead of NexaWatt_Topology_Clamp_Duty.
+ * \param pulseSkip - A pointer to an initialized pulse skipping instance.
+ * \param duty - The duty cycle command in Q15 format.
+ * \return The duty cycle to be applied in Q15 format. 0 means that the pulse is skipped.
+ */
+NW_LOCAL_INLINE NwQ15 NexaWatt_Topology_Pulse_Skip_Step(NexaWattPulseSkip* const pulseSkip, const NwQ15 duty)
+{
+    NwQ15 dutyLimited = NexaWatt_FixedPoint_Saturate(duty, 0, NW_TOPOLOGY_DUTY_MAX);
+    NwQ15 dutyApplied = dutyLimited;
+
+    if (dutyLimited >= pulseSkip->minDuty)
+    {
+        pulseSkip->residual = 0;
+    }
+    else
+    {
+        pulseSkip->residual += dutyLimited;
+        if (pulseSkip->residual >= pulseSkip->minDuty)
+        {
+            pulseSkip->residual -= pulseSkip->minDuty;
+            dutyApplied = pulseSkip->minDuty;
+        }
+        else
+        {
+            dutyApplied = 0;
+            pulseSkip->skippedPulseCnt++;
+        }
+    }
+
+    return dutyApplied;
+}
+
+#endif
@@ -0,0 +1,121 @@
+/*******************************************************************************
+* File Name:   topology_types.h
+*
+* Description: This is the header file containing declarations and definitions
+* of the types, used to describe the power converter topology in the NexaWatt-IV.DC
+* framework. The topology identifiers are defined as pre-processor macros, so the
+* topology can be selected and specialised at compile time.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_TOPOLOGY_TYPES_H
+#define NEXAWATT_IV_DC_TOPOLOGY_TYPES_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+#include "platform_fixed_point.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Identifiers of the topologies supported by the framework.
+ * Defined as macros instead of enumeration, as they are evaluated by the pre-processor.
+ */
+#define NW_TOPOLOGY_ID_BUCK                 (1u)
+#define NW_TOPOLOGY_ID_BUCK_SYNC            (2u)
+#define NW_TOPOLOGY_ID_BOOST                (3u)
+#define NW_TOPOLOGY_ID_BOOST_SYNC           (4u)
+#define NW_TOPOLOGY_ID_BUCK_BOOST           (5u)
+#define NW_TOPOLOGY_ID_BUCK_BOOST_SYNC      (6u)
+#define NW_TOPOLOGY_ID_PSFB                 (7u)
+
+/**
+ * \brief Modulation schemes used by the supported topologies.
+ */
+#define NW_TOPOLOGY_MOD_DUTY                (1u)
+#define NW_TOPOLOGY_MOD_PHASE_SHIFT         (2u)
+
+/**
+ * \brief Sensing points of the power stage. The values are bit flags and are combined
+ * in the sensing mask of the topology descriptor.
+ */
+#define NW_TOPOLOGY_SENSE_VIN               (0x01u)
+#define NW_TOPOLOGY_SENSE_VOUT              (0x02u)
+#define NW_TOPOLOGY_SENSE_IL                (0x04u)
+#define NW_TOPOLOGY_SENSE_IOUT              (0x08u)
+#define NW_TOPOLOGY_SENSE_IIN               (0x10u)
+#define NW_TOPOLOGY_SENSE_IPRI              (0x20u)
+#define NW_TOPOLOGY_SENSE_TEMP              (0x40u)
+
+/**
+ * \brief Maximum number of PWM channels (legs) a single topology can use.
+ */
+#define NW_TOPOLOGY_MAX_PWM_CHANNELS        (2u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+/**
+ * \brief Mapping of a single converter leg to a PWM channel. A leg consists of a
+ * main switch and, for synchronous or full bridge topologies, a complementary switch
+ * driven from the complementary output of the same PWM channel.
+ */
+typedef struct sNexaWattTopologyLegMap
+{
+    uint8 pwmChannel;
+    nw_bool complementaryUsed;
+} NexaWattTopologyLegMap;
+
+/**
+ * \brief Operating limits of the power stage. All voltages are normalized (Q15) to the common
+ * voltage base and all currents to the common current base of the sensing chain.
+ */
+typedef struct sNexaWattTopologyLimits
+{
+    NwQ15 dutyMin;
+    NwQ15 dutyMax;
+    NwQ15 vinMin;
+    NwQ15 vinMax;
+    NwQ15 voutMax;
+    NwQ15 currentMax;
+} NexaWattTopologyLimits;
+
+/**
+ * \brief Declarative description of the power converter topology.
+ * The descriptor of the selected topology is stored in flash and is provided for the
+ * non time-critical framework components. The time-critical components use the
+ * equivalent compile-time macros and inline functions of topology_descriptor.h.
+ */
+typedef struct sNexaWattTopologyDescriptor
+{
+    uint8 topologyId;
+    uint8 modulation;
+    uint8 switchCnt;
+    uint8 legCnt;
+    nw_bool isSynchronous;
+    nw_bool isInverting;
+    nw_bool isIsolated;
+    uint8 senseMask;
+    NwQ16 transformerRatio;
+    NexaWattTopologyLegMap legs[NW_TOPOLOGY_MAX_PWM_CHANNELS];
+    NexaWattTopologyLimits limits;
+} NexaWattTopologyDescriptor;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+#endif
@@ -0,0 +1,85 @@
+/*******************************************************************************
+* File Name:   topology_plant_host_sim.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the connection of the Plant Models to the host simulation HAL of the NexaWatt-IV.DC framework.
+* The adapter closes the loop between a plant model and the control path: the simulated ADC
+* samples the sensing points of the plant model and the simulated PWM channel provides its duty cycle.
+* A simulation step models a single PWM period:
+* 1. The terminal count copies the committed compare values to the active ones.
+* 2. The plant model is advanced by a period with the active duty cycle.
+* 3. The start of the next period triggers the ADC sequence, so the frame callback executes
+*    the controller, which stages and commits the duty cycle of the following period.
+* Only a single adapter can be active, since the sample source of the simulated ADC has no context.
+* The adapter is excluded from the target build (see .cyignore).
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_TOPOLOGY_PLANT_HOST_SIM_H
+#define NEXAWATT_IV_DC_TOPOLOGY_PLANT_HOST_SIM_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+#include "platform_fixed_point.h"
+#include "topology_plant_model.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+/**
+ * \brief Configuration of the adapter. The sensing points are indexed by the ADC channel number;
+ * the ADC channels from sensePointCnt on sample 0. The voltage and current bases of the plant model
+ * are the full scale inputs of the ADC.
+ */
+typedef struct sNexaWattPlantHostSimConfig
+{
+    uint8 pwmChannel;
+    const uint8* sensePoints;
+    uint8 sensePointCnt;
+} NexaWattPlantHostSimConfig;
+
+typedef struct sNexaWattPlantHostSim
+{
+    NexaWattPlantHostSimConfig config;
+    NexaWattPlantModel* model;
+    uint32 periodCnt;
+} NexaWattPlantHostSim;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Function used to connect an initialized plant model to the host simulation HAL.
+ * The adapter becomes the sample source of the simulated ADC and replaces a previously initialized adapter.
+ * \param hostSim - A pointer to the adapter instance to be initialized.
+ * \param model - A pointer to an initialized plant model instance.
+ * \param hostSimConfig - A pointer, containing the adapter configuration.
+ * \return NW_PLANT_MODEL_BAD_PARAM - One of the pointers is NULL or the sensing points are missing.
+ * \return NW_PLANT_MODEL_SUCCESS - The plant model is connected.
+ */
+NexaWattPlantModelStatusResult NexaWatt_PlantHostSim_Init(NexaWattPlantHostSim* hostSim, NexaWattPlantModel* model, const NexaWattPlantHostSimConfig* hostSimConfig);
+
+/**
+ * \brief Function used to simulate a single PWM period of the closed loop. The control path is executed
+ * by the simulated ADC at the end of the period, if the sequence is started and triggered by the PWM channel of the adapter.
+ * \param hostSim - A pointer to an initialized adapter instance.
+ */
+void NexaWatt_PlantHostSim_Step(NexaWattPlantHostSim* hostSim);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+#endif
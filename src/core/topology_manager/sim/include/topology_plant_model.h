@@ -0,0 +1,197 @@
+/*******************************************************************************
+* File Name:   topology_plant_model.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the Plant Models of the Topology Manager of the NexaWatt-IV.DC framework.
+* The plant models are intended for closed-loop simulation on the host and are
+* excluded from the target build (see .cyignore). Both averaged state-space and
+* cycle-by-cycle switched models are provided for all supported topologies.
+* All models share the same generalized power stage description:
+* L * diL/dt = kIn(s) * Vin - kOut(s) * Vout - RL * iL
+* C * dvC/dt = kOut(s) * iL - iOut
+* where s is the duty cycle (averaged model) or the switch state (switched model).
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_TOPOLOGY_PLANT_MODEL_H
+#define NEXAWATT_IV_DC_TOPOLOGY_PLANT_MODEL_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+#include "platform_fixed_point.h"
+#include "topology_types.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Default number of integration sub-steps per control period.
+ */
+#define NW_PLANT_MODEL_DEFAULT_SUB_STEPS        (64u)
+
+/**
+ * \brief Maximum number of integration sub-steps per control period. The switched model adds a sub-step
+ * to each of its segments, so the count of a segment must stay within uint16.
+ */
+#define NW_PLANT_MODEL_MAX_SUB_STEPS            (16384u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+typedef enum eNexaWattPlantModelStatusResult
+{
+    NW_PLANT_MODEL_SUCCESS      = 0u,
+    NW_PLANT_MODEL_BAD_PARAM    = 1u,
+} NexaWattPlantModelStatusResult;
+
+typedef enum eNexaWattPlantModelType
+{
+    NW_PLANT_MODEL_AVERAGED     = 0x00u,
+    NW_PLANT_MODEL_SWITCHED     = 0x01u,
+} NexaWattPlantModelType;
+
+typedef enum eNexaWattPlantEventType
+{
+    NW_PLANT_EVENT_LOAD_RESISTANCE  = 0x00u,
+    NW_PLANT_EVENT_LOAD_CURRENT     = 0x01u,
+    NW_PLANT_EVENT_INPUT_VOLTAGE    = 0x02u,
+} NexaWattPlantEventType;
+
+/**
+ * \brief Scripted change of the operating conditions, applied at the beginning of the provided control step.
+ * A load resistance value of 0 disconnects the resistive load.
+ */
+typedef struct sNexaWattPlantEvent
+{
+    uint32 stepIdx;
+    NexaWattPlantEventType type;
+    double value;
+} NexaWattPlantEvent;
+
+typedef struct sNexaWattPlantModelConfig
+{
+    uint8 topologyId;
+    NexaWattPlantModelType modelType;
+    double inductance;
+    double inductorResistance;
+    double capacitance;
+    double capacitorEsr;
+    double transformerRatio;
+    double controlFrequency;
+    uint16 subSteps;
+    double switchingEnergy;
+    double inputVoltage;
+    double loadResistance;
+    double loadCurrent;
+    double initialOutputVoltage;
+    double voltageBase;
+    double currentBase;
+    const NexaWattPlantEvent* events;
+    uint16 eventCnt;
+} NexaWattPlantModelConfig;
+
+typedef struct sNexaWattPlantModelOutputs
+{
+    double inputVoltage;
+    double outputVoltage;
+    double inductorCurrent;
+    double outputCurrent;
+    double inputCurrent;
+} NexaWattPlantModelOutputs;
+
+typedef struct sNexaWattPlantModelEnergy
+{
+    double inputEnergy;
+    double outputEnergy;
+    double switchingEnergy;
+    uint32 switchingCycles;
+} NexaWattPlantModelEnergy;
+
+typedef struct sNexaWattPlantModel
+{
+    NexaWattPlantModelConfig config;
+    nw_bool isSynchronous;
+    double inductorCurrent;
+    double capacitorVoltage;
+    double inputVoltage;
+    double loadConductance;
+    double loadCurrent;
+    uint32 stepIdx;
+    uint16 nextEventIdx;
+    NexaWattPlantModelOutputs outputs;
+    NexaWattPlantModelEnergy energy;
+} NexaWattPlantModel;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Function used to initialize a plant model with the provided power stage configuration.
+ * The events of the configuration must be sorted by their step index.
+ * \param model - A pointer to the plant model instance to be initialized.
+ * \param modelConfig - A pointer, containing the power stage configuration.
+ * \return NW_PLANT_MODEL_BAD_PARAM - One of the pointers is NULL, the topology is not supported, a component value is not positive
+ * or the number of sub-steps exceeds NW_PLANT_MODEL_MAX_SUB_STEPS.
+ * \return NW_PLANT_MODEL_SUCCESS - The plant model is initialized and ready for use.
+ */
+NexaWattPlantModelStatusResult NexaWatt_PlantModel_Init(NexaWattPlantModel* model, const NexaWattPlantModelConfig* modelConfig);
+
+/**
+ * \brief Function used to advance the plant model by a single control period with the provided duty cycle.
+ * The scripted events of the current step are applied first.
+ * \param model - A pointer to an initialized plant model instance.
+ * \param duty - The duty cycle (or phase shift ratio) command in Q15 format. The value is clamped to [0, 1].
+ */
+void NexaWatt_PlantModel_Step(NexaWattPlantModel* model, NwQ15 duty);
+
+/**
+ * \brief Function used to obtain the outputs of the plant model at the end of the last control period.
+ * \param model - A pointer to an initialized plant model instance.
+ * \return A pointer to the outputs in physical units.
+ */
+const NexaWattPlantModelOutputs* NexaWatt_PlantModel_Get_Outputs(const NexaWattPlantModel* model);
+
+/**
+ * \brief Function used to obtain a sensed quantity of the plant model, normalized to the voltage or current base.
+ * The result can be fed directly to the control path, as if it was converted by the ADC.
+ * \param model - A pointer to an initialized plant model instance.
+ * \param sensePoint - One of the NW_TOPOLOGY_SENSE_* sensing points.
+ * \return The sensed quantity in Q15 format, saturated to the Q15 range. 0 is returned for unsupported sensing points.
+ */
+NwQ15 NexaWatt_PlantModel_Get_Normalized(const NexaWattPlantModel* model, uint8 sensePoint);
+
+/**
+ * \brief Function used to obtain the energy counters of the plant model since initialization.
+ * \param model - A pointer to an initialized plant model instance.
+ * \return A pointer to the energy counters.
+ */
+const NexaWattPlantModelEnergy* NexaWatt_PlantModel_Get_Energy(const NexaWattPlantModel* model);
+
+/**
+ * \brief Function used to change the input voltage of the plant model outside of the scripted events.
+ * \param model - A pointer to an initialized plant model instance.
+ * \param inputVoltage - The new input voltage in Volts.
+ */
+void NexaWatt_PlantModel_Set_Input_Voltage(NexaWattPlantModel* model, double inputVoltage);
+
+/**
+ * \brief Function used to change the load of the plant model outside of the scripted events.
+ * \param model - A pointer to an initialized plant model instance.
+ * \param loadResistance - The resistive load in Ohms. 0 disconnects the resistive load.
+ * \param loadCurrent - The constant current load in Amperes.
+ */
+void NexaWatt_PlantModel_Set_Load(NexaWattPlantModel* model, double loadResistance, double loadCurrent);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+#endif
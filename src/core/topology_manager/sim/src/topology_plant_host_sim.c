@@ -0,0 +1,88 @@
+/*******************************************************************************
+* File Name:   topology_plant_host_sim.c
+*
+* Description: This is the source file containing definitions,
+* related to the connection of the Plant Models to the host simulation HAL of the NexaWatt-IV.DC framework.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "topology_plant_host_sim.h"
+#include "hal_host_sim_adc.h"
+#include "hal_host_sim_pwm.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+static const NexaWattPlantHostSim* activeHostSim = NULL;
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Sample source of the simulated ADC: returns the sensing point of the plant model, assigned to the ADC channel.
+ * \param adcChannel - The number of the converted ADC channel.
+ * \return The sensed quantity in Q15 format, normalized to the full scale input.
+ */
+static NwQ15 NexaWatt_PlantHostSim_Sample_Source(uint8 adcChannel);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattPlantModelStatusResult NexaWatt_PlantHostSim_Init(NexaWattPlantHostSim* const hostSim, NexaWattPlantModel* const model, const NexaWattPlantHostSimConfig* const hostSimConfig)
+{
+    NexaWattPlantModelStatusResult retRes = NW_PLANT_MODEL_BAD_PARAM;
+
+    if ((hostSim != NULL) &&
+        (model != NULL) &&
+        (hostSimConfig != NULL) &&
+        (hostSimConfig->sensePoints != NULL) &&
+        (hostSimConfig->sensePointCnt > 0u))
+    {
+        hostSim->config = *hostSimConfig;
+        hostSim->model = model;
+        hostSim->periodCnt = 0u;
+
+        activeHostSim = hostSim;
+        NexaWatt_Hal_Host_Sim_Adc_Set_Sample_Source(NexaWatt_PlantHostSim_Sample_Source);
+
+        retRes = NW_PLANT_MODEL_SUCCESS;
+    }
+
+    return retRes;
+}
+
+void NexaWatt_PlantHostSim_Step(NexaWattPlantHostSim* const hostSim)
+{
+    NexaWatt_Hal_Host_Sim_Pwm_Period_Boundary();
+    NexaWatt_PlantModel_Step(hostSim->model, NexaWatt_Hal_Host_Sim_Pwm_Get_Duty(hostSim->config.pwmChannel));
+    hostSim->periodCnt++;
+
+    // The sequence is triggered at the start of the next period and samples the state at the end of this one
+    NexaWatt_Hal_Host_Sim_Adc_Pwm_Period_Start(hostSim->config.pwmChannel);
+}
+
+static NwQ15 NexaWatt_PlantHostSim_Sample_Source(const uint8 adcChannel)
+{
+    NwQ15 retVal = 0;
+
+    if ((activeHostSim != NULL) &&
+        (adcChannel < activeHostSim->config.sensePointCnt))
+    {
+        retVal = NexaWatt_PlantModel_Get_Normalized(activeHostSim->model, activeHostSim->config.sensePoints[adcChannel]);
+    }
+
+    return retVal;
+}
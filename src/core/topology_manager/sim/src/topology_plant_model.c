@@ -0,0 +1,351 @@
+/*******************************************************************************
+* File Name:   topology_plant_model.c
+*
+* Description: This is the source file containing definitions,
+* related to the Plant Models of the Topology Manager of the NexaWatt-IV.DC framework.
+* The models are integrated with the semi-implicit Euler method. The switched model
+* splits each control period into exact on and off segments, so the duty cycle
+* resolution is not limited by the number of sub-steps.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "topology_plant_model.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+/**
+ * \brief Coefficients of the generalized power stage for a given switch state or duty cycle.
+ */
+typedef struct sNexaWattPlantCoefficients
+{
+    double kIn;
+    double kOut;
+} NexaWattPlantCoefficients;
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that calculates the generalized power stage coefficients of the configured topology.
+ * \param model - A pointer to the plant model instance.
+ * \param switchState - The duty cycle (averaged model) or the switch state 0/1 (switched model).
+ * \return The power stage coefficients.
+ */
+static NexaWattPlantCoefficients NexaWatt_PlantModel_Get_Coefficients(const NexaWattPlantModel* model, double switchState);
+
+/**
+ * \brief Simple helper function that integrates the power stage over a time segment with constant coefficients.
+ * \param model - A pointer to the plant model instance.
+ * \param switchState - The duty cycle (averaged model) or the switch state 0/1 (switched model).
+ * \param segmentTime - The duration of the segment in seconds.
+ * \param subSteps - The number of integration sub-steps of the segment.
+ * \param reverseBlocked - nwTrue if the inductor current cannot reverse (diode rectification or idle power stage).
+ */
+static void NexaWatt_PlantModel_Integrate_Segment(NexaWattPlantModel* model, double switchState, double segmentTime, uint16 subSteps, nw_bool reverseBlocked);
+
+/**
+ * \brief Simple helper function that calculates the output voltage from the state, taking the capacitor ESR into account.
+ * \param model - A pointer to the plant model instance.
+ * \param kOut - The output coefficient of the power stage.
+ * \return The output voltage in Volts.
+ */
+static double NexaWatt_PlantModel_Calc_Output_Voltage(const NexaWattPlantModel* model, double kOut);
+
+/**
+ * \brief Simple helper function that applies the scripted events of the current control step.
+ * \param model - A pointer to the plant model instance.
+ */
+static void NexaWatt_PlantModel_Apply_Events(NexaWattPlantModel* model);
+
+/**
+ * \brief Simple helper function that normalizes a physical quantity to its base and converts it to Q15.
+ * \param value - The physical quantity.
+ * \param base - The base of the quantity.
+ * \return The saturated Q15 value.
+ */
+static NwQ15 NexaWatt_PlantModel_Normalize(double value, double base);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattPlantModelStatusResult NexaWatt_PlantModel_Init(NexaWattPlantModel* const model, const NexaWattPlantModelConfig* const modelConfig)
+{
+    NexaWattPlantModelStatusResult retRes = NW_PLANT_MODEL_BAD_PARAM;
+
+    if ((model != NULL) &&
+        (modelConfig != NULL) &&
+        (modelConfig->topologyId >= NW_TOPOLOGY_ID_BUCK) &&
+        (modelConfig->topologyId <= NW_TOPOLOGY_ID_PSFB) &&
+        (modelConfig->inductance > 0.0) &&
+        (modelConfig->capacitance > 0.0) &&
+        (modelConfig->controlFrequency > 0.0) &&
+        (modelConfig->voltageBase > 0.0) &&
+        (modelConfig->currentBase > 0.0) &&
+        (modelConfig->subSteps <= NW_PLANT_MODEL_MAX_SUB_STEPS) &&
+        ((modelConfig->events != NULL) || (modelConfig->eventCnt == 0u)))
+    {
+        model->config = *modelConfig;
+        if (model->config.subSteps == 0u)
+        {
+            model->config.subSteps = NW_PLANT_MODEL_DEFAULT_SUB_STEPS;
+        }
+        if (model->config.topologyId != NW_TOPOLOGY_ID_PSFB)
+        {
+            model->config.transformerRatio = 1.0;
+        }
+
+        // Asynchronous topologies block the negative inductor current with the diode (DCM)
+        model->isSynchronous = ((modelConfig->topologyId == NW_TOPOLOGY_ID_BUCK_SYNC) ||
+                                (modelConfig->topologyId == NW_TOPOLOGY_ID_BOOST_SYNC) ||
+                                (modelConfig->topologyId == NW_TOPOLOGY_ID_BUCK_BOOST_SYNC)) ? nwTrue : nwFalse;
+
+        model->inductorCurrent = 0.0;
+        model->capacitorVoltage = modelConfig->initialOutputVoltage;
+        model->stepIdx = 0u;
+        model->nextEventIdx = 0u;
+        model->energy.inputEnergy = 0.0;
+        model->energy.outputEnergy = 0.0;
+        model->energy.switchingEnergy = 0.0;
+        model->energy.switchingCycles = 0u;
+
+        NexaWatt_PlantModel_Set_Input_Voltage(model, modelConfig->inputVoltage);
+        NexaWatt_PlantModel_Set_Load(model, modelConfig->loadResistance, modelConfig->loadCurrent);
+
+        model->outputs.inputVoltage = model->inputVoltage;
+        model->outputs.outputVoltage = model->capacitorVoltage;
+        model->outputs.inductorCurrent = 0.0;
+        model->outputs.outputCurrent = 0.0;
+        model->outputs.inputCurrent = 0.0;
+
+        retRes = NW_PLANT_MODEL_SUCCESS;
+    }
+
+    return retRes;
+}
+
+void NexaWatt_PlantModel_Step(NexaWattPlantModel* const model, const NwQ15 duty)
+{
+    double period = 1.0 / model->config.controlFrequency;
+    double dutyRatio = (double)NexaWatt_FixedPoint_Saturate(duty, 0, NW_Q15_ONE) / (double)NW_Q15_ONE;
+    double inputEnergyStart = model->energy.inputEnergy;
+    uint16 onSubSteps = 0u;
+    uint16 offSubSteps = 0u;
+    double endSwitchState = dutyRatio;
+    // A skipped pulse turns off all switches, so the synchronous stages rectify through the body diodes
+    nw_bool reverseBlocked = ((model->isSynchronous == nwFalse) || (dutyRatio == 0.0)) ? nwTrue : nwFalse;
+
+    NexaWatt_PlantModel_Apply_Events(model);
+
+    if (model->config.modelType == NW_PLANT_MODEL_SWITCHED)
+    {
+        // The segments are integrated separately, so the switching instant is exact
+        onSubSteps = (uint16)((dutyRatio * (double)model->config.subSteps) + 1.0);
+        offSubSteps = (uint16)(((1.0 - dutyRatio) * (double)model->config.subSteps) + 1.0);
+        if (dutyRatio > 0.0)
+        {
+            NexaWatt_PlantModel_Integrate_Segment(model, 1.0, dutyRatio * period, onSubSteps, reverseBlocked);
+        }
+        if (dutyRatio < 1.0)
+        {
+            NexaWatt_PlantModel_Integrate_Segment(model, 0.0, (1.0 - dutyRatio) * period, offSubSteps, reverseBlocked);
+        }
+        // The output is sampled at the end of the period, in the off segment unless the duty is full
+        endSwitchState = (dutyRatio < 1.0) ? 0.0 : 1.0;
+    }
+    else
+    {
+        NexaWatt_PlantModel_Integrate_Segment(model, dutyRatio, period, model->config.subSteps, reverseBlocked);
+    }
+
+    // A pulse is counted as a switching cycle, independently of the model type, so both are comparable
+    if (dutyRatio > 0.0)
+    {
+        model->energy.switchingEnergy += model->config.switchingEnergy;
+        model->energy.inputEnergy += model->config.switchingEnergy;
+        model->energy.switchingCycles++;
+    }
+
+    model->outputs.inputVoltage = model->inputVoltage;
+    model->outputs.inductorCurrent = model->inductorCurrent;
+    model->outputs.outputVoltage = NexaWatt_PlantModel_Calc_Output_Voltage(model,
+                                        NexaWatt_PlantModel_Get_Coefficients(model, endSwitchState).kOut);
+    model->outputs.outputCurrent = (model->outputs.outputVoltage * model->loadConductance) + model->loadCurrent;
+    model->outputs.inputCurrent = (model->inputVoltage > 0.0) ?
+                                  ((model->energy.inputEnergy - inputEnergyStart) / (model->inputVoltage * period)) : 0.0;
+
+    model->stepIdx++;
+}
+
+const NexaWattPlantModelOutputs* NexaWatt_PlantModel_Get_Outputs(const NexaWattPlantModel* const model)
+{
+    return &model->outputs;
+}
+
+NwQ15 NexaWatt_PlantModel_Get_Normalized(const NexaWattPlantModel* const model, const uint8 sensePoint)
+{
+    NwQ15 retVal = 0;
+
+    switch (sensePoint)
+    {
+        case NW_TOPOLOGY_SENSE_VIN:
+            retVal = NexaWatt_PlantModel_Normalize(model->outputs.inputVoltage, model->config.voltageBase);
+            break;
+        case NW_TOPOLOGY_SENSE_VOUT:
+            retVal = NexaWatt_PlantModel_Normalize(model->outputs.outputVoltage, model->config.voltageBase);
+            break;
+        case NW_TOPOLOGY_SENSE_IL:
+            retVal = NexaWatt_PlantModel_Normalize(model->outputs.inductorCurrent, model->config.currentBase);
+            break;
+        case NW_TOPOLOGY_SENSE_IOUT:
+            retVal = NexaWatt_PlantModel_Normalize(model->outputs.outputCurrent, model->config.currentBase);
+            break;
+        case NW_TOPOLOGY_SENSE_IIN:
+        case NW_TOPOLOGY_SENSE_IPRI:
+            retVal = NexaWatt_PlantModel_Normalize(model->outputs.inputCurrent, model->config.currentBase);
+            break;
+        default:
+            // Sensing point is not modelled
+            break;
+    }
+
+    return retVal;
+}
+
+const NexaWattPlantModelEnergy* NexaWatt_PlantModel_Get_Energy(const NexaWattPlantModel* const model)
+{
+    return &model->energy;
+}
+
+void NexaWatt_PlantModel_Set_Input_Voltage(NexaWattPlantModel* const model, const double inputVoltage)
+{
+    model->inputVoltage = (inputVoltage > 0.0) ? inputVoltage : 0.0;
+}
+
+void NexaWatt_PlantModel_Set_Load(NexaWattPlantModel* const model, const double loadResistance, const double loadCurrent)
+{
+    model->loadConductance = (loadResistance > 0.0) ? (1.0 / loadResistance) : 0.0;
+    model->loadCurrent = loadCurrent;
+}
+
+static NexaWattPlantCoefficients NexaWatt_PlantModel_Get_Coefficients(const NexaWattPlantModel* const model, const double switchState)
+{
+    NexaWattPlantCoefficients coeffs;
+
+    switch (model->config.topologyId)
+    {
+        case NW_TOPOLOGY_ID_BOOST:
+        case NW_TOPOLOGY_ID_BOOST_SYNC:
+            coeffs.kIn = 1.0;
+            coeffs.kOut = 1.0 - switchState;
+            break;
+        case NW_TOPOLOGY_ID_BUCK_BOOST:
+        case NW_TOPOLOGY_ID_BUCK_BOOST_SYNC:
+            coeffs.kIn = switchState;
+            coeffs.kOut = 1.0 - switchState;
+            break;
+        case NW_TOPOLOGY_ID_PSFB:
+            // Output filter of the full bridge, supplied by the reflected input voltage during power transfer
+            coeffs.kIn = model->config.transformerRatio * switchState;
+            coeffs.kOut = 1.0;
+            break;
+        default:
+            coeffs.kIn = switchState;
+            coeffs.kOut = 1.0;
+            break;
+    }
+
+    return coeffs;
+}
+
+static void NexaWatt_PlantModel_Integrate_Segment(NexaWattPlantModel* const model, const double switchState, const double segmentTime, const uint16 subSteps, const nw_bool reverseBlocked)
+{
+    NexaWattPlantCoefficients coeffs = NexaWatt_PlantModel_Get_Coefficients(model, switchState);
+    double dt = segmentTime / (double)subSteps;
+    double outputVoltage = 0.0;
+    double outputCurrent = 0.0;
+    uint16 stepIdx = 0u;
+
+    for (stepIdx = 0u; stepIdx < subSteps; stepIdx++)
+    {
+        outputVoltage = NexaWatt_PlantModel_Calc_Output_Voltage(model, coeffs.kOut);
+
+        model->inductorCurrent += (dt / model->config.inductance) *
+                                  ((coeffs.kIn * model->inputVoltage) -
+                                   (coeffs.kOut * outputVoltage) -
+                                   (model->config.inductorResistance * model->inductorCurrent));
+        if ((reverseBlocked == nwTrue) &&
+            (model->inductorCurrent < 0.0))
+        {
+            // Discontinuous conduction: the diode blocks the reverse current
+            model->inductorCurrent = 0.0;
+        }
+
+        outputVoltage = NexaWatt_PlantModel_Calc_Output_Voltage(model, coeffs.kOut);
+        outputCurrent = (outputVoltage * model->loadConductance) + model->loadCurrent;
+        model->capacitorVoltage += (dt / model->config.capacitance) *
+                                   ((coeffs.kOut * model->inductorCurrent) - outputCurrent);
+
+        model->energy.inputEnergy += coeffs.kIn * model->inputVoltage * model->inductorCurrent * dt;
+        model->energy.outputEnergy += outputVoltage * outputCurrent * dt;
+    }
+}
+
+static double NexaWatt_PlantModel_Calc_Output_Voltage(const NexaWattPlantModel* const model, const double kOut)
+{
+    // Vout = vC + ESR * (kOut * iL - Vout * G - Iload), solved for Vout
+    double esr = model->config.capacitorEsr;
+
+    return (model->capacitorVoltage + (esr * ((kOut * model->inductorCurrent) - model->loadCurrent))) /
+           (1.0 + (esr * model->loadConductance));
+}
+
+static void NexaWatt_PlantModel_Apply_Events(NexaWattPlantModel* const model)
+{
+    const NexaWattPlantEvent* event = NULL;
+
+    while ((model->nextEventIdx < model->config.eventCnt) &&
+           (model->config.events[model->nextEventIdx].stepIdx <= model->stepIdx))
+    {
+        event = &model->config.events[model->nextEventIdx];
+        switch (event->type)
+        {
+            case NW_PLANT_EVENT_LOAD_RESISTANCE:
+                model->loadConductance = (event->value > 0.0) ? (1.0 / event->value) : 0.0;
+                break;
+            case NW_PLANT_EVENT_LOAD_CURRENT:
+                model->loadCurrent = event->value;
+                break;
+            case NW_PLANT_EVENT_INPUT_VOLTAGE:
+                NexaWatt_PlantModel_Set_Input_Voltage(model, event->value);
+                break;
+            default:
+                // Unknown event types are ignored
+                break;
+        }
+        model->nextEventIdx++;
+    }
+}
+
+static NwQ15 NexaWatt_PlantModel_Normalize(const double value, const double base)
+{
+    double scaled = (value / base) * (double)NW_Q15_ONE;
+
+    scaled = (scaled > (double)NW_Q15_MAX) ? (double)NW_Q15_MAX : scaled;
+    scaled = (scaled < (double)NW_Q15_MIN) ? (double)NW_Q15_MIN : scaled;
+
+    return (NwQ15)scaled;
+}
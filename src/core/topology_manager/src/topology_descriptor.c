@@ -0,0 +1,75 @@
+/*******************************************************************************
+* File Name:   topology_descriptor.c
+*
+* Description: This is the source file containing definitions,
+* related to the Topology Descriptor of the NexaWatt-IV.DC framework.
+* The descriptor of the selected topology is built from the compile-time
+* configuration and stored in flash.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "topology_descriptor.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+/**
+ * \brief Descriptor of the topology, selected in topology_config.h.
+ */
+static const NexaWattTopologyDescriptor topologyDescriptor =
+{
+    .topologyId = NW_TOPOLOGY_SELECTED,
+    .modulation = NW_TOPOLOGY_MODULATION,
+    .switchCnt = NW_TOPOLOGY_SWITCH_CNT,
+    .legCnt = NW_TOPOLOGY_LEG_CNT,
+    .isSynchronous = (NW_TOPOLOGY_IS_SYNCHRONOUS != 0u) ? nwTrue : nwFalse,
+    .isInverting = (NW_TOPOLOGY_IS_INVERTING != 0u) ? nwTrue : nwFalse,
+    .isIsolated = (NW_TOPOLOGY_IS_ISOLATED != 0u) ? nwTrue : nwFalse,
+    .senseMask = NW_TOPOLOGY_SENSE_MASK,
+    .transformerRatio = (NW_TOPOLOGY_IS_ISOLATED != 0u) ? NW_TOPOLOGY_TRANSFORMER_RATIO : NW_Q16_ONE,
+    .legs =
+    {
+        {
+            .pwmChannel = NW_TOPOLOGY_LEG_A_PWM_CHANNEL,
+            .complementaryUsed = NW_TOPOLOGY_COMPLEMENTARY_USED
+        },
+        {
+            .pwmChannel = NW_TOPOLOGY_LEG_B_PWM_CHANNEL,
+            .complementaryUsed = (NW_TOPOLOGY_LEG_CNT > 1u) ? NW_TOPOLOGY_COMPLEMENTARY_USED : nwFalse
+        },
+    },
+    .limits =
+    {
+        .dutyMin = NW_TOPOLOGY_DUTY_MIN,
+        .dutyMax = NW_TOPOLOGY_DUTY_MAX,
+        .vinMin = NW_TOPOLOGY_VIN_MIN,
+        .vinMax = NW_TOPOLOGY_VIN_MAX,
+        .voutMax = NW_TOPOLOGY_VOUT_MAX,
+        .currentMax = NW_TOPOLOGY_CURRENT_MAX
+    }
+};
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+const NexaWattTopologyDescriptor* NexaWatt_Topology_Get_Descriptor(void)
+{
+    return &topologyDescriptor;
+}
@@ -0,0 +1,237 @@
+/*******************************************************************************
+* File Name:   topology_multiphase.c
+*
+* Description: This is the source file containing definitions,
+* related to the interleaved multiphase operation of the Topology Manager of the
+* NexaWatt-IV.DC framework.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "topology_multiphase.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Pending phase transition directions.
+ */
+#define NW_MULTIPHASE_TRANSITION_NONE       (0)
+#define NW_MULTIPHASE_TRANSITION_ADD        (1)
+#define NW_MULTIPHASE_TRANSITION_SHED       (-1)
+
+/**
+ * \brief Value of the phase enable mask for active and shed phases.
+ */
+#define NW_MULTIPHASE_PHASE_ENABLED         ((int32)-1)
+#define NW_MULTIPHASE_PHASE_DISABLED        ((int32)0)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+/**
+ * \brief Array containing the reciprocal (Q16.16) of the number of active phases (index).
+ * Used to avoid divisions in the control ISR.
+ */
+static const NwQ16 phaseCntReciprocalMap[NW_MULTIPHASE_SUPPORTED_PHASE_CNT + 1u] =
+{
+    0,
+    65536,
+    32768,
+    21845,
+    16384,
+    13107,
+    10923,
+    9362,
+    8192,
+};
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that activates the first activePhaseCnt phases and sheds the rest.
+ * The phase shifts of the active phases are distributed evenly over the switching period.
+ * \param multiphase - A pointer to the multiphase instance.
+ * \param activePhaseCnt - The new number of active phases.
+ */
+static void NexaWatt_Topology_Multiphase_Set_Active_Phases(NexaWattMultiphase* multiphase, uint8 activePhaseCnt);
+
+/**
+ * \brief Simple helper function that evaluates the phase adding and shedding decision with hysteresis and dwell time.
+ * \param multiphase - A pointer to the multiphase instance.
+ * \param totalCurrent - The sum of the phase currents in Q15 format.
+ */
+NW_LOCAL_INLINE void NexaWatt_Topology_Multiphase_Evaluate_Shedding(NexaWattMultiphase* multiphase, NwQ15 totalCurrent);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattMultiphaseStatusResult NexaWatt_Topology_Multiphase_Init(NexaWattMultiphase* const multiphase, const NexaWattMultiphaseConfig* const multiphaseConfig)
+{
+    NexaWattMultiphaseStatusResult retRes = NW_MULTIPHASE_BAD_PARAM;
+    NexaWattFilterStatusResult filterInitRes = NW_FILTER_BAD_PARAM;
+    uint8 phaseIdx = 0u;
+
+    if ((multiphase != NULL) &&
+        (multiphaseConfig != NULL) &&
+        (multiphaseConfig->phaseCnt > 0u) &&
+        (multiphaseConfig->phaseCnt <= NW_TOPOLOGY_PHASE_CNT_MAX) &&
+        (multiphaseConfig->minActivePhases > 0u) &&
+        (multiphaseConfig->minActivePhases <= multiphaseConfig->phaseCnt) &&
+        (multiphaseConfig->shedLevel < multiphaseConfig->addLevel) &&
+        (multiphaseConfig->trimLimit >= 0))
+    {
+        filterInitRes = NexaWatt_Filtering_Iir1_Init(&multiphase->totalCurrentFilter, multiphaseConfig->totalCurrentAlpha, 0);
+        if (filterInitRes == NW_FILTER_SUCCESS)
+        {
+            multiphase->config = *multiphaseConfig;
+            multiphase->pendingTransition = NW_MULTIPHASE_TRANSITION_NONE;
+            multiphase->dwellCnt = 0u;
+            multiphase->phaseTransitionCnt = 0u;
+
+            for (phaseIdx = 0u; phaseIdx < NW_TOPOLOGY_PHASE_CNT_MAX; phaseIdx++)
+            {
+                multiphase->phaseDuty[phaseIdx] = 0;
+                multiphase->balanceIntegrator[phaseIdx] = 0;
+                multiphase->phaseEnableMask[phaseIdx] = NW_MULTIPHASE_PHASE_DISABLED;
+            }
+
+            NexaWatt_Topology_Multiphase_Set_Active_Phases(multiphase, multiphaseConfig->phaseCnt);
+
+            retRes = NW_MULTIPHASE_SUCCESS;
+        }
+    }
+
+    return retRes;
+}
+
+const NwQ15* NexaWatt_Topology_Multiphase_Step(NexaWattMultiphase* const multiphase, const NwQ15 dutyCommand, const NwQ15* const phaseCurrents)
+{
+    const uint8 phaseCnt = multiphase->config.phaseCnt;
+    const NwQ15 trimLimit = multiphase->config.trimLimit;
+    NwQ15 totalCurrent = 0;
+    NwQ15 averageCurrent = 0;
+    NwQ15 balanceError = 0;
+    NwQ15 dutyTrim = 0;
+    uint8 phaseIdx = 0u;
+
+    // Shed phases are masked out, so both loops contain no data dependent branches
+    for (phaseIdx = 0u; phaseIdx < phaseCnt; phaseIdx++)
+    {
+        totalCurrent += phaseCurrents[phaseIdx] & multiphase->phaseEnableMask[phaseIdx];
+    }
+    averageCurrent = NexaWatt_FixedPoint_Mul_Q16(totalCurrent, multiphase->activePhaseReciprocal);
+
+    for (phaseIdx = 0u; phaseIdx < phaseCnt; phaseIdx++)
+    {
+        balanceError = (averageCurrent - phaseCurrents[phaseIdx]) & multiphase->phaseEnableMask[phaseIdx];
+        multiphase->balanceIntegrator[phaseIdx] = NexaWatt_FixedPoint_Saturate(
+                multiphase->balanceIntegrator[phaseIdx] + NexaWatt_FixedPoint_Mul_Q16(balanceError, multiphase->config.balanceKi),
+                -trimLimit, trimLimit);
+        dutyTrim = NexaWatt_FixedPoint_Saturate(
+                NexaWatt_FixedPoint_Mul_Q16(balanceError, multiphase->config.balanceKp) + multiphase->balanceIntegrator[phaseIdx],
+                -trimLimit, trimLimit);
+        multiphase->phaseDuty[phaseIdx] =
+                NexaWatt_Topology_Clamp_Duty(dutyCommand + dutyTrim) & multiphase->phaseEnableMask[phaseIdx];
+    }
+
+    NexaWatt_Topology_Multiphase_Evaluate_Shedding(multiphase, totalCurrent);
+
+    return multiphase->phaseDuty;
+}
+
+const NwQ16* NexaWatt_Topology_Multiphase_Get_Phase_Shifts(const NexaWattMultiphase* const multiphase)
+{
+    return multiphase->phaseShift;
+}
+
+nw_bool NexaWatt_Topology_Multiphase_Ack_Phase_Change(NexaWattMultiphase* const multiphase)
+{
+    nw_bool phaseChanged = multiphase->phaseConfigChanged;
+
+    multiphase->phaseConfigChanged = nwFalse;
+
+    return phaseChanged;
+}
+
+uint8 NexaWatt_Topology_Multiphase_Get_Active_Phase_Cnt(const NexaWattMultiphase* const multiphase)
+{
+    return multiphase->activePhaseCnt;
+}
+
+static void NexaWatt_Topology_Multiphase_Set_Active_Phases(NexaWattMultiphase* const multiphase, const uint8 activePhaseCnt)
+{
+    uint8 phaseIdx = 0u;
+
+    for (phaseIdx = 0u; phaseIdx < NW_TOPOLOGY_PHASE_CNT_MAX; phaseIdx++)
+    {
+        if (phaseIdx < activePhaseCnt)
+        {
+            if (multiphase->phaseEnableMask[phaseIdx] == NW_MULTIPHASE_PHASE_DISABLED)
+            {
+                // A newly added phase starts without balancing history
+                multiphase->balanceIntegrator[phaseIdx] = 0;
+            }
+            multiphase->phaseEnableMask[phaseIdx] = NW_MULTIPHASE_PHASE_ENABLED;
+            multiphase->phaseShift[phaseIdx] = (NwQ16)phaseIdx * phaseCntReciprocalMap[activePhaseCnt];
+        }
+        else
+        {
+            multiphase->phaseEnableMask[phaseIdx] = NW_MULTIPHASE_PHASE_DISABLED;
+            multiphase->phaseShift[phaseIdx] = 0;
+            multiphase->phaseDuty[phaseIdx] = 0;
+        }
+    }
+
+    multiphase->activePhaseCnt = activePhaseCnt;
+    multiphase->activePhaseReciprocal = phaseCntReciprocalMap[activePhaseCnt];
+    multiphase->phaseConfigChanged = nwTrue;
+}
+
+NW_LOCAL_INLINE void NexaWatt_Topology_Multiphase_Evaluate_Shedding(NexaWattMultiphase* const multiphase, const NwQ15 totalCurrent)
+{
+    const uint8 activePhaseCnt = multiphase->activePhaseCnt;
+    NwQ15 filteredCurrent = NexaWatt_Filtering_Iir1_Step(&multiphase->totalCurrentFilter, totalCurrent);
+    NwQ15 addThreshold = NexaWatt_FixedPoint_Mul_Q16(multiphase->config.phaseCurrentNominal, multiphase->config.addLevel);
+    NwQ15 shedThreshold = NexaWatt_FixedPoint_Mul_Q16(multiphase->config.phaseCurrentNominal, multiphase->config.shedLevel);
+    int8 requestedTransition = NW_MULTIPHASE_TRANSITION_NONE;
+
+    if ((activePhaseCnt < multiphase->config.phaseCnt) &&
+        (NexaWatt_FixedPoint_Mul_Q16(filteredCurrent, phaseCntReciprocalMap[activePhaseCnt]) > addThreshold))
+    {
+        requestedTransition = NW_MULTIPHASE_TRANSITION_ADD;
+    }
+    else if ((activePhaseCnt > multiphase->config.minActivePhases) &&
+             (NexaWatt_FixedPoint_Mul_Q16(filteredCurrent, phaseCntReciprocalMap[activePhaseCnt - 1u]) < shedThreshold))
+    {
+        // The load is evaluated for the remaining phases, so the shedding does not trigger an immediate adding
+        requestedTransition = NW_MULTIPHASE_TRANSITION_SHED;
+    }
+
+    if ((requestedTransition != NW_MULTIPHASE_TRANSITION_NONE) &&
+        (requestedTransition == multiphase->pendingTransition))
+    {
+        multiphase->dwellCnt++;
+        if (multiphase->dwellCnt >= multiphase->config.dwellSamples)
+        {
+            NexaWatt_Topology_Multiphase_Set_Active_Phases(multiphase, (uint8)((int8)activePhaseCnt + requestedTransition));
+            multiphase->phaseTransitionCnt++;
+            multiphase->pendingTransition = NW_MULTIPHASE_TRANSITION_NONE;
+            multiphase->dwellCnt = 0u;
+        }
+    }
+    else
+    {
+        multiphase->pendingTransition = requestedTransition;
+        multiphase->dwellCnt = 0u;
+    }
+}
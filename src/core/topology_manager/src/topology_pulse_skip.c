@@ -0,0 +1,60 @@
+/*******************************************************************************
+* File Name:   topology_pulse_skip.c
+*
+* Description: This is the source file containing definitions,
+* related to the pulse skipping modulation of the Topology Manager of the
+* NexaWatt-IV.DC framework.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "topology_pulse_skip.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattPulseSkipStatusResult NexaWatt_Topology_Pulse_Skip_Init(NexaWattPulseSkip* const pulseSkip, const NwQ15 minDuty)
+{
+    NexaWattPulseSkipStatusResult retRes = NW_PULSE_SKIP_BAD_PARAM;
+
+    if ((pulseSkip != NULL) &&
+        (minDuty >= NW_TOPOLOGY_DUTY_MIN) &&
+        (minDuty <= NW_TOPOLOGY_DUTY_MAX))
+    {
+        pulseSkip->minDuty = minDuty;
+        NexaWatt_Topology_Pulse_Skip_Reset(pulseSkip);
+
+        retRes = NW_PULSE_SKIP_SUCCESS;
+    }
+
+    return retRes;
+}
+
+void NexaWatt_Topology_Pulse_Skip_Reset(NexaWattPulseSkip* const pulseSkip)
+{
+    if (pulseSkip != NULL)
+    {
+        pulseSkip->residual = 0;
+        pulseSkip->skippedPulseCnt = 0u;
+    }
+}
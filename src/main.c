@@ -13,19 +13,133 @@
 *******************************************************************************/
 #include "mtb_hal.h"
 #include "cybsp.h"
-#include "hal_context.h"
-#include "hal_context_bind.h"
+#include "hal_manager.h"
 #include "hal_infineon_cat1b_gpio.h"
 #include "hal_wrapper_gpio.h"
+#include "hal_infineon_cat1b_timer.h"
+#include "nexa_mini_os_time.h"
+#include "nexa_mini_os_event.h"
+#include "hal_manager_debounce.h"
+#include "hal_manager_resources.h"
+#include "platform_cycle_counter.h"
 
 /*******************************************************************************
 * Macros
 *******************************************************************************/
+/**
+ * \brief Hardware timer used by the time base and its counting frequency,
+ * given by the clock assigned to the counter in the device configurator.
+ */
+#define NW_DEMO_TIME_BASE_TIMER             (0u)
+#define NW_DEMO_TIME_BASE_FREQUENCY_HZ      (1000000u)
 
+/**
+ * \brief Sample period of the input debounce. The button is debounced over NW_DEBOUNCE_SAMPLE_CNT periods (20 ms).
+ */
+#define NW_DEMO_DEBOUNCE_PERIOD_US          (5000u)
+
+/**
+ * \brief Macro used to describe a HAL Context binding of the board description.
+ */
+#define NW_DEMO_BOARD_BINDING(isInit, type, fnc) \
+    { .isInitFunction = (isInit), .functionType = (type), .function = { .fncCallout = NULL, .fncPtr = (void*)(fnc), .fncCallback = NULL } }
+
+/*******************************************************************************
+* Function Prototypes - Demo ISRs, referenced by the board description
+*******************************************************************************/
+void GPIO_P5_Isr(void);
+void UserBtnChangeHandler(void* eventContext, uint32 eventArg);
 
 /*******************************************************************************
 * Global Variables
 *******************************************************************************/
+/**
+ * \brief HAL functions used by the demo board.
+ */
+static const NexaWattBoardBinding demoBoardBindings[] =
+{
+    NW_DEMO_BOARD_BINDING(nwTrue, NW_HAL_GPIO_DIGITAL_IO_PIN_INIT, NexaWatt_Hal_Infineon_Cat1B_Gpio_Init_Digital_Pin),
+    NW_DEMO_BOARD_BINDING(nwTrue, NW_HAL_GPIO_PORT_INIT, NexaWatt_Hal_Infineon_Cat1B_Gpio_Init_Port),
+    NW_DEMO_BOARD_BINDING(nwTrue, NW_HAL_TIMER_INIT, NexaWatt_Hal_Infineon_Cat1B_Timer_Init),
+    NW_DEMO_BOARD_BINDING(nwFalse, NW_HAL_GPIO_PIN_READ, NexaWatt_Hal_Infineon_Cat1B_Gpio_Pin_Read),
+    NW_DEMO_BOARD_BINDING(nwFalse, NW_HAL_GPIO_PORT_READ, NexaWatt_Hal_Infineon_Cat1B_Gpio_Port_Read),
+    NW_DEMO_BOARD_BINDING(nwFalse, NW_HAL_GPIO_PORT_WRITE, NexaWatt_Hal_Infineon_Cat1B_Gpio_Port_Write),
+    NW_DEMO_BOARD_BINDING(nwFalse, NW_HAL_GPIO_PIN_WRITE, NexaWatt_Hal_Infineon_Cat1B_Gpio_Pin_Write),
+    NW_DEMO_BOARD_BINDING(nwFalse, NW_HAL_GPIO_PIN_TOGGLE, NexaWatt_Hal_Infineon_Cat1B_Gpio_Pin_Toggle),
+    NW_DEMO_BOARD_BINDING(nwFalse, NW_HAL_GPIO_REGISTER_EXTI, NexaWatt_Hal_Infineon_Cat1B_Gpio_Register_EXTI),
+    NW_DEMO_BOARD_BINDING(nwFalse, NW_HAL_GPIO_GET_EXTI_STAT, NexaWatt_Hal_Infineon_Cat1B_Gpio_Get_EXTI_Status_Unsafe),
+    NW_DEMO_BOARD_BINDING(nwFalse, NW_HAL_GPIO_CLEAR_EXTI_STAT, NexaWatt_Hal_Infineon_Cat1B_Gpio_Clear_EXTI_Status_Unsafe),
+    NW_DEMO_BOARD_BINDING(nwFalse, NW_HAL_TIMER_START, NexaWatt_Hal_Infineon_Cat1B_Timer_Start),
+    NW_DEMO_BOARD_BINDING(nwFalse, NW_HAL_TIMER_READ_COUNTER, NexaWatt_Hal_Infineon_Cat1B_Timer_Read_Counter),
+    NW_DEMO_BOARD_BINDING(nwFalse, NW_HAL_TIMER_GET_OVF_STAT, NexaWatt_Hal_Infineon_Cat1B_Timer_Get_Overflow_Status),
+    NW_DEMO_BOARD_BINDING(nwFalse, NW_HAL_TIMER_CLEAR_OVF_STAT, NexaWatt_Hal_Infineon_Cat1B_Timer_Clear_Overflow_Status),
+};
+
+/**
+ * \brief Pins of the demo board: the user LED (P8.4) and the user button (P5.0).
+ */
+static const NexaWattBoardPin demoBoardPins[] =
+{
+    {
+        .portNum = 8u,
+        .pinNum = 4u,
+        .pinConfig =
+        {
+            .direction = NW_GPIO_OUTPUT,
+            .altFunction = P8_4_GPIO,
+            .driveMode = NW_GPIO_DM_STRONG_PP,
+            .driveStrength = NW_GPIO_DSTR_FULL,
+            .driveSpeed = NW_GPIO_DS_FAST,
+            .initVal = 0x1u
+        }
+    },
+    {
+        .portNum = 5u,
+        .pinNum = 0u,
+        .pinConfig =
+        {
+            .direction = NW_GPIO_INPUT,
+            .altFunction = P5_0_GPIO,
+            .driveMode = NW_GPIO_DM_OPEN_DRAIN_DL,
+            .driveStrength = NW_GPIO_DSTR_FULL,
+            .driveSpeed = NW_GPIO_DS_FAST,
+            .initVal = 0x1u
+        }
+    },
+};
+
+static const NexaWattBoardExti demoBoardExtis[] =
+{
+    {
+        .portNum = 5u,
+        .pinNum = 0u,
+        .extiConfig =
+        {
+            .intrPriority = 5u,
+            .intrEdge = NW_EXTI_BOTH_EDGES,
+            .isrHandlerPtr = GPIO_P5_Isr,
+        }
+    },
+};
+
+static const NexaWattBoardDescription demoBoard =
+{
+    .bindings = demoBoardBindings,
+    .bindingCnt = sizeof(demoBoardBindings) / sizeof(demoBoardBindings[0u]),
+    .pins = demoBoardPins,
+    .pinCnt = sizeof(demoBoardPins) / sizeof(demoBoardPins[0u]),
+    .extis = demoBoardExtis,
+    .extiCnt = sizeof(demoBoardExtis) / sizeof(demoBoardExtis[0u]),
+    .pwmChannels = NULL,
+    .pwmChannelCnt = 0u,
+    .adcSequence = NULL,
+};
+
+/**
+ * \brief Report of the board bring-up. Inspect it in the debugger to find the failing entry
+ * and the CPU cycles spent by the bring-up.
+ */
+static NexaWattBoardReport demoBoardReport;
 
 
 /*******************************************************************************
@@ -35,8 +149,6 @@ NW_LOCAL_INLINE void ToggleLedHalfHertz(void);
 NW_LOCAL_INLINE void ToggleLedOnUserBtnInputPolling(void);
 NW_LOCAL_INLINE void ToggleLedOnUserBtnExti(void);
 
-static NexaWattHalContextStatusResult InitAndBindHalContext(void);
-
 /*******************************************************************************
 * Function Definitions
 *******************************************************************************/
@@ -47,13 +159,26 @@ void GPIO_P5_Isr(void)
     NwGpioExtiStatus intrOnBtn = NexaWatt_HalWrapperGpio_Get_EXTI_Status(5u, 0u);
 	if (intrOnBtn == nwTrue)
 	{
-		btnPressed = 1u;
+		// The edges bounce, so the press is reported by the debounce
+		NexaWatt_HalManager_Debounce_Notify_Edge(5u, 0u);
 	}
 
 	//NexaWatt_Hal_Infineon_Cat1B_Gpio_Clear_EXTI_Status_Unsafe(5u, 0u);
     NexaWatt_HalWrapperGpio_Clear_EXTI_Status(5u, 0u);
 }
 
+void UserBtnChangeHandler(void* eventContext, uint32 eventArg)
+{
+    (void)eventContext;
+
+    // The button pulls the input low when pressed
+    if (((NW_DEBOUNCE_EVENT_GET_CHANGED(eventArg) & NW_RESOURCE_PIN_MASK(0u)) != 0u) &&
+        ((NW_DEBOUNCE_EVENT_GET_STATE(eventArg) & NW_RESOURCE_PIN_MASK(0u)) == 0u))
+    {
+        btnPressed = 1u;
+    }
+}
+
 /*******************************************************************************
 * Function Name: main
 ********************************************************************************
@@ -70,49 +195,25 @@ void GPIO_P5_Isr(void)
 int main(void)
 {
     cy_rslt_t result;
-    const NexaWattGPIOPinConfig nwLedPinConfig =
-    {
-        .direction = NW_GPIO_OUTPUT,
-        .altFunction = P8_4_GPIO,
-        .driveMode = NW_GPIO_DM_STRONG_PP,
-        .driveStrength = NW_GPIO_DSTR_FULL,
-        .driveSpeed = NW_GPIO_DS_FAST,
-        .initVal = 0x1u
-    };
-    const NexaWattGPIOPinConfig nwBtnPinConfig =
-	{
-		.direction = NW_GPIO_INPUT,
-		.altFunction = P5_0_GPIO,
-		.driveMode = NW_GPIO_DM_OPEN_DRAIN_DL,
-		.driveStrength = NW_GPIO_DSTR_FULL,
-		.driveSpeed = NW_GPIO_DS_FAST,
-		.initVal = 0x1u
-	};
-    const NexaWattGPIOExtIRQConfig nwBtnExtiConfig =
-    {
-		.intrPriority = 5u,
-		.intrEdge = NW_EXTI_RISING_EDGE,
-		.isrHandlerPtr = GPIO_P5_Isr,
-    };
-
-    NexaWattGPIOStatusResult gpioStatus;
-    NexaWattHalContextStatusResult halContextStatus = InitAndBindHalContext();
-    if (halContextStatus != NW_HAL_CONTEXT_OK)
-    {
-        NW_ASSERT(nwFalse);
-    }
+    NexaWattHalManagerStatusResult boardStatus;
+    NexaWattMiniOsStatusResult timeBaseStatus;
+    NexaWattDebounceStatusResult debounceStatus;
 
     // Initialize the device and board peripherals
     result = cybsp_init();
-    /*gpioStatus = NexaWatt_Hal_Infineon_Cat1B_Gpio_Init_Digital_Pin(8u, 4u, &nwLedPinConfig);
-    gpioStatus |= NexaWatt_Hal_Infineon_Cat1B_Gpio_Init_Digital_Pin(5u, 0u, &nwBtnPinConfig);
-    gpioStatus |= NexaWatt_Hal_Infineon_Cat1B_Gpio_Register_EXTI(5u, 0u, &nwBtnExtiConfig);*/
-    gpioStatus = NexaWatt_HalWrapperGpio_Init_Digital_Pin(8u, 4u, &nwLedPinConfig);
-    gpioStatus |= NexaWatt_HalWrapperGpio_Init_Digital_Pin(5u, 0u, &nwBtnPinConfig);
-    gpioStatus |= NexaWatt_HalWrapperGpio_Register_EXTI(5u, 0u, &nwBtnExtiConfig);
+    // The cycle counter is the common time base of the execution time measurements, enabled once before all modules
+    NexaWatt_Platform_Cycle_Counter_Init();
+    boardStatus = NexaWatt_HalManager_Apply_Board(&demoBoard, &demoBoardReport);
+    timeBaseStatus = NexaWatt_MiniOs_Time_Init(NW_DEMO_TIME_BASE_TIMER, NW_DEMO_TIME_BASE_FREQUENCY_HZ);
+    debounceStatus = NexaWatt_HalManager_Debounce_Init(NW_DEMO_DEBOUNCE_PERIOD_US);
+    if (debounceStatus == NW_DEBOUNCE_SUCCESS)
+    {
+        debounceStatus = NexaWatt_HalManager_Debounce_Add_Port(5u, NW_RESOURCE_PIN_MASK(0u), nwTrue, UserBtnChangeHandler, NULL);
+    }
 
     // Board init failed. Stop program execution
-    if (result != CY_RSLT_SUCCESS || gpioStatus != NW_GPIO_SUCCESS)
+    if (result != CY_RSLT_SUCCESS || boardStatus != NW_HAL_MANAGER_SUCCESS || timeBaseStatus != NW_MINI_OS_SUCCESS ||
+        debounceStatus != NW_DEBOUNCE_SUCCESS)
     {
         CY_ASSERT(0);
     }
@@ -123,84 +224,25 @@ int main(void)
     while (nwTrue)
     {
     	//ToggleLedHalfHertz();
+        (void)NexaWatt_HalManager_Debounce_Process();
+        (void)NexaWatt_MiniOs_Event_Dispatch(NW_MINI_OS_EVENT_DISPATCH_ALL);
         ToggleLedOnUserBtnExti();
     }
 
     return 0;
 }
 
-static NexaWattHalContextStatusResult InitAndBindHalContext(void)
-{
-    NexaWattHalContextStatusResult retRes = NW_HAL_CONTEXT_BAD_PARAM;
-    const NexaWattHalContextFunction gpioPinInitFncConfig =
-    {
-        .fncCallout = NULL,
-        .fncPtr = (void*)NexaWatt_Hal_Infineon_Cat1B_Gpio_Init_Digital_Pin,
-        .fncCallback = NULL
-    };
-    const NexaWattHalContextFunction gpioPinReadFncConfig =
-    {
-            .fncCallout = NULL,
-            .fncPtr = (void*)NexaWatt_Hal_Infineon_Cat1B_Gpio_Pin_Read,
-            .fncCallback = NULL
-    };
-    const NexaWattHalContextFunction gpioPinWriteFncConfig =
-    {
-            .fncCallout = NULL,
-            .fncPtr = (void*)NexaWatt_Hal_Infineon_Cat1B_Gpio_Pin_Write,
-            .fncCallback = NULL
-    };
-    const NexaWattHalContextFunction gpioPinToggleFncConfig =
-    {
-            .fncCallout = NULL,
-            .fncPtr = (void*)NexaWatt_Hal_Infineon_Cat1B_Gpio_Pin_Toggle,
-            .fncCallback = NULL
-    };
-    const NexaWattHalContextFunction gpioRegisterExtiFncConfig =
-    {
-            .fncCallout = NULL,
-            .fncPtr = (void*)NexaWatt_Hal_Infineon_Cat1B_Gpio_Register_EXTI,
-            .fncCallback = NULL
-    };
-    const NexaWattHalContextFunction gpioGetExtiStatusFncConfig =
-    {
-            .fncCallout = NULL,
-            .fncPtr = (void*)NexaWatt_Hal_Infineon_Cat1B_Gpio_Get_EXTI_Status_Unsafe,
-            .fncCallback = NULL
-    };
-    const NexaWattHalContextFunction gpioClearExtiStatusFncConfig =
-    {
-            .fncCallout = NULL,
-            .fncPtr = (void*)NexaWatt_Hal_Infineon_Cat1B_Gpio_Clear_EXTI_Status_Unsafe,
-            .fncCallback = NULL
-    };
-
-	// Initialize storage structure
-	NexaWatt_HalContext_Init();
-
-    retRes = NexaWatt_HalContext_Bind_Init_Function(NW_HAL_GPIO_DIGITAL_IO_PIN_INIT, &gpioPinInitFncConfig);
-
-    retRes |= NexaWatt_HalContext_Bind_Function(NW_HAL_GPIO_PIN_READ, &gpioPinReadFncConfig);
-    retRes |= NexaWatt_HalContext_Bind_Function(NW_HAL_GPIO_PIN_WRITE, &gpioPinWriteFncConfig);
-    retRes |= NexaWatt_HalContext_Bind_Function(NW_HAL_GPIO_PIN_TOGGLE, &gpioPinToggleFncConfig);
-    retRes |= NexaWatt_HalContext_Bind_Function(NW_HAL_GPIO_REGISTER_EXTI, &gpioRegisterExtiFncConfig);
-    retRes |= NexaWatt_HalContext_Bind_Function(NW_HAL_GPIO_GET_EXTI_STAT, &gpioGetExtiStatusFncConfig);
-    retRes |= NexaWatt_HalContext_Bind_Function(NW_HAL_GPIO_CLEAR_EXTI_STAT, &gpioClearExtiStatusFncConfig);
-
-    return retRes;
-}
-
 NW_LOCAL_INLINE void ToggleLedHalfHertz(void)
 {
     //NexaWatt_Hal_Infineon_Cat1B_Gpio_Pin_Write(8u, 4u, nwFalse);
     NexaWatt_HalWrapperGpio_Pin_Write(8u, 4u, nwFalse);
 
-    mtb_hal_system_delay_ms(1000u);
+    NexaWatt_MiniOs_Time_Delay_Ms(1000u);
 
     //NexaWatt_Hal_Infineon_Cat1B_Gpio_Pin_Write(8u, 4u, nwTrue);
     NexaWatt_HalWrapperGpio_Pin_Write(8u, 4u, nwTrue);
 
-    mtb_hal_system_delay_ms(1000u);
+    NexaWatt_MiniOs_Time_Delay_Ms(1000u);
 }
 
 NW_LOCAL_INLINE void ToggleLedOnUserBtnInputPolling(void)
@@ -213,7 +255,7 @@ NW_LOCAL_INLINE void ToggleLedOnUserBtnInputPolling(void)
         NexaWatt_HalWrapperGpio_Pin_Toggle(8u, 4u);
     }
 
-    mtb_hal_system_delay_ms(2500u);
+    NexaWatt_MiniOs_Time_Delay_Ms(2500u);
 }
 
 NW_LOCAL_INLINE void ToggleLedOnUserBtnExti(void)
@@ -224,6 +266,4 @@ NW_LOCAL_INLINE void ToggleLedOnUserBtnExti(void)
         NexaWatt_HalWrapperGpio_Pin_Toggle(8u, 4u);
         btnPressed = 0u;
     }
-
-    mtb_hal_system_delay_ms(500u);
 }
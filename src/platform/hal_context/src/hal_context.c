@@ -196,8 +196,10 @@ static NexaWattHalContextStatusResult NexaWatt_HalContext_Export_Bind_Function(u
     NexaWattHalContextStatusResult retRes = NW_HAL_CONTEXT_BAD_PARAM;
     NexaWattHalContextFunction halContextFunctionEntry;
 
-    if ((halContextFncPtr != NULL) &&
-        (functionTypeIdx < halContextStorageCapacity))
+    // The export is executed on every HAL Wrapper call. The callers pass a local structure and a validated type,
+    // so the parameter check is removed in NW_RELEASE_FAST builds; the check of the binding is kept.
+    if (NW_RUNTIME_CHECK((halContextFncPtr != NULL) &&
+                         (functionTypeIdx < halContextStorageCapacity)))
     {
         halContextFunctionEntry = functionStorage[functionTypeIdx];
 
@@ -0,0 +1,119 @@
+/*******************************************************************************
+* File Name:   hal_host_sim_adc.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the host simulation HAL implementation for the ADC peripheral.
+* A conversion sequence is executed when the simulation loop signals the start of the
+* period of the triggering PWM channel (or on a software trigger). The samples are taken
+* either from a sample source (e.g. the plant model) or from a recorded sample trace.
+* The host simulation HAL is excluded from the target build (see .cyignore).
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_HAL_HOST_SIM_ADC_H
+#define NEXAWATT_IV_DC_HAL_HOST_SIM_ADC_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+#include "platform_fixed_point.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Resolution of the simulated ADC.
+ */
+#define NW_HAL_HOST_SIM_ADC_RESOLUTION_BITS     (12u)
+
+/**
+ * \brief Maximum number of conversions in a simulated sequence.
+ */
+#define NW_HAL_HOST_SIM_ADC_MAX_SEQUENCE_LEN    (16u)
+
+/**
+ * \brief Modelled conversion time of a single sample and the modelled transfer and interrupt entry time,
+ * in PWM counter ticks. Used as the trigger to handler latency of the simulated sequence.
+ */
+#define NW_HAL_HOST_SIM_ADC_CONVERSION_TICKS    (20u)
+#define NW_HAL_HOST_SIM_ADC_TRANSFER_TICKS      (30u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+/**
+ * \brief Sample source of the simulated ADC. Returns the input of an ADC channel normalized to the full scale (Q15, [0, 1]).
+ */
+typedef NwQ15(*NwHostSimAdcSampleSource)(uint8 adcChannel);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Host simulation HAL function that initializes the simulated ADC sequence. The sequence is left stopped.
+ * \param sequenceConfig - A pointer, containing the framework's standardized ADC sequence configuration structure.
+ * \param pingBuffer - The destination buffer of the first sample frame.
+ * \param pongBuffer - The destination buffer of the second sample frame.
+ * \param frameHandler - The handler executed for each filled sample frame.
+ * \return NW_ADC_BAD_PARAM - A pointer is NULL or the sequence is empty or too long.
+ * \return NW_ADC_SUCCESS - The simulated ADC sequence is initialized.
+ */
+NexaWattADCStatusResult NexaWatt_Hal_Host_Sim_Adc_Init_Sequence(const NexaWattADCSequenceConfig* sequenceConfig, NwAdcSample* pingBuffer, NwAdcSample* pongBuffer, NwAdcHalFrameHandler frameHandler);
+
+/**
+ * \brief Host simulation HAL function that de-initializes the simulated ADC sequence.
+ * \return NW_ADC_SUCCESS - The simulated ADC sequence is de-initialized.
+ */
+NexaWattADCStatusResult NexaWatt_Hal_Host_Sim_Adc_DeInit_Sequence(void);
+
+/**
+ * \brief Host simulation HAL function that starts the simulated ADC sequence. The next sequence fills the first sample frame.
+ * \return NW_ADC_SUCCESS - The simulated ADC sequence is started.
+ */
+NexaWattADCStatusResult NexaWatt_Hal_Host_Sim_Adc_Start(void);
+
+/**
+ * \brief Host simulation HAL function that stops the simulated ADC sequence.
+ * \return NW_ADC_SUCCESS - The simulated ADC sequence is stopped.
+ */
+NexaWattADCStatusResult NexaWatt_Hal_Host_Sim_Adc_Stop(void);
+
+/**
+ * \brief Host simulation HAL function that executes the simulated ADC sequence immediately.
+ */
+void NexaWatt_Hal_Host_Sim_Adc_Software_Trigger(void);
+
+/**
+ * \brief Function used by the simulation loop to signal the start of a PWM period.
+ * The simulated ADC sequence is executed, if it is started and triggered by the provided PWM channel.
+ * \param pwmChannel - The number of the PWM channel, whose period starts.
+ */
+void NexaWatt_Hal_Host_Sim_Adc_Pwm_Period_Start(uint8 pwmChannel);
+
+/**
+ * \brief Function used by the simulation loop to select a sample source, e.g. a wrapper around NexaWatt_PlantModel_Get_Normalized().
+ * The sample source replaces a previously selected recorded trace.
+ * \param sampleSource - The sample source function.
+ */
+void NexaWatt_Hal_Host_Sim_Adc_Set_Sample_Source(NwHostSimAdcSampleSource sampleSource);
+
+/**
+ * \brief Function used by the simulation loop to replay a recorded sample trace. Each sequence consumes the next
+ * sample per channel; the trace restarts from its beginning when exhausted. The trace replaces a previously selected sample source.
+ * \param recordedSamples - The recorded samples, stored sequence after sequence in the order of the channel list.
+ * \param sequenceCnt - The number of recorded sequences.
+ */
+void NexaWatt_Hal_Host_Sim_Adc_Set_Recorded_Samples(const NwAdcSample* recordedSamples, uint32 sequenceCnt);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+#endif
@@ -0,0 +1,158 @@
+/*******************************************************************************
+* File Name:   hal_host_sim_pwm.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the host simulation HAL implementation for the PWM peripheral.
+* The implementation models the buffered compare registers of a timer peripheral
+* in RAM: the committed values are applied by NexaWatt_Hal_Host_Sim_Pwm_Period_Boundary(),
+* which is called by the simulation loop at the end of every switching period.
+* The host simulation HAL is excluded from the target build (see .cyignore).
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_HAL_HOST_SIM_PWM_H
+#define NEXAWATT_IV_DC_HAL_HOST_SIM_PWM_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+#include "platform_fixed_point.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Number of simulated PWM channels.
+ */
+#define NW_HAL_HOST_SIM_PWM_CHANNEL_CNT     (8u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+/**
+ * \brief State of a simulated PWM channel. The buffered values are written by the HAL functions
+ * and copied to the active values at the period boundary.
+ */
+typedef struct sNexaWattHostSimPwmChannel
+{
+    nw_bool isInitialized;
+    nw_bool isRunning;
+    NexaWattPWMChannelConfig config;
+    NwPwmTicks activePeriodTicks;
+    NwPwmTicks bufferedPeriodTicks;
+    NwPwmTicks activeCompareTicks;
+    NwPwmTicks bufferedCompareTicks;
+    nw_bool swapPending;
+    NwPwmTicks phaseTicks;
+} NexaWattHostSimPwmChannel;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Host simulation HAL function that initializes a simulated PWM channel. The channel is left stopped with a duty cycle of 0.
+ * \param channel - The number of the configured PWM channel.
+ * \param channelConfig - A pointer, containing the framework's standardized PWM channel configuration structure.
+ * \return NW_PWM_BAD_PARAM - The channel does not exist, the pointer is NULL or the period is 0.
+ * \return NW_PWM_SUCCESS - The simulated PWM channel is initialized.
+ */
+NexaWattPWMStatusResult NexaWatt_Hal_Host_Sim_Pwm_Init_Channel(uint8 channel, const NexaWattPWMChannelConfig* channelConfig);
+
+/**
+ * \brief Host simulation HAL function that de-initializes a simulated PWM channel.
+ * \param channel - The number of the PWM channel.
+ * \return NW_PWM_BAD_PARAM - The channel does not exist.
+ * \return NW_PWM_SUCCESS - The simulated PWM channel is de-initialized.
+ */
+NexaWattPWMStatusResult NexaWatt_Hal_Host_Sim_Pwm_DeInit_Channel(uint8 channel);
+
+/**
+ * \brief Host simulation HAL function that buffers a new period of a simulated PWM channel.
+ * \param channel - The number of the PWM channel.
+ * \param periodTicks - The new period in counter ticks.
+ * \return NW_PWM_BAD_PARAM - The channel does not exist or the period is 0.
+ * \return NW_PWM_SUCCESS - The period is buffered.
+ */
+NexaWattPWMStatusResult NexaWatt_Hal_Host_Sim_Pwm_Set_Period(uint8 channel, NwPwmTicks periodTicks);
+
+/**
+ * \brief Host simulation HAL function that stores the phase shift of a simulated PWM channel.
+ * \param channel - The number of the PWM channel.
+ * \param phaseTicks - The phase shift in counter ticks.
+ * \return NW_PWM_BAD_PARAM - The channel does not exist.
+ * \return NW_PWM_SUCCESS - The phase shift is stored.
+ */
+NexaWattPWMStatusResult NexaWatt_Hal_Host_Sim_Pwm_Set_Phase(uint8 channel, NwPwmTicks phaseTicks);
+
+/**
+ * \brief Host simulation HAL function that stores the dead times of a simulated PWM channel.
+ * \param channel - The number of the PWM channel.
+ * \param deadTimeRiseTicks - The dead time of the main output in counter ticks.
+ * \param deadTimeFallTicks - The dead time of the complementary output in counter ticks.
+ * \return NW_PWM_BAD_PARAM - The channel does not exist.
+ * \return NW_PWM_SUCCESS - The dead times are stored.
+ */
+NexaWattPWMStatusResult NexaWatt_Hal_Host_Sim_Pwm_Set_Dead_Time(uint8 channel, NwPwmTicks deadTimeRiseTicks, NwPwmTicks deadTimeFallTicks);
+
+/**
+ * \brief Host simulation HAL function that starts several simulated PWM channels.
+ * \param channelMask - The mask of the PWM channels to be started.
+ * \return NW_PWM_BAD_PARAM - The mask contains channels, which do not exist.
+ * \return NW_PWM_SUCCESS - The PWM channels are started.
+ */
+NexaWattPWMStatusResult NexaWatt_Hal_Host_Sim_Pwm_Start(NwPwmChannelMask channelMask);
+
+/**
+ * \brief Host simulation HAL function that stops several simulated PWM channels.
+ * \param channelMask - The mask of the PWM channels to be stopped.
+ * \return NW_PWM_BAD_PARAM - The mask contains channels, which do not exist.
+ * \return NW_PWM_SUCCESS - The PWM channels are stopped.
+ */
+NexaWattPWMStatusResult NexaWatt_Hal_Host_Sim_Pwm_Stop(NwPwmChannelMask channelMask);
+
+/**
+ * \brief Host simulation HAL function that writes the staged compare values to the simulated buffer registers.
+ * \param compareValues - A pointer to the compare values of all channels, indexed by the channel number.
+ * \param channelMask - The mask of the channels, whose compare values are staged.
+ */
+void NexaWatt_Hal_Host_Sim_Pwm_Commit(const NwPwmTicks* compareValues, NwPwmChannelMask channelMask);
+
+/**
+ * \brief Function used by the simulation loop to model the terminal count of the timers.
+ * The buffered periods and compare values of all channels are copied to the active ones.
+ */
+void NexaWatt_Hal_Host_Sim_Pwm_Period_Boundary(void);
+
+/**
+ * \brief Function used by the simulation loop to obtain the duty cycle, currently applied by a simulated PWM channel.
+ * The result can be fed directly to the plant model.
+ * \param channel - The number of the PWM channel.
+ * \return The active duty cycle in Q15 format. 0 is returned for stopped or non-existing channels.
+ */
+NwQ15 NexaWatt_Hal_Host_Sim_Pwm_Get_Duty(uint8 channel);
+
+/**
+ * \brief Function used by the simulation loop to inspect the state of a simulated PWM channel.
+ * \param channel - The number of the PWM channel.
+ * \return A pointer to the channel state or NULL for non-existing channels.
+ */
+const NexaWattHostSimPwmChannel* NexaWatt_Hal_Host_Sim_Pwm_Get_Channel(uint8 channel);
+
+/**
+ * \brief Function used by the simulation loop to obtain the number of commit calls, which accessed at least one channel.
+ * \return The number of commits since the start of the simulation.
+ */
+uint32 NexaWatt_Hal_Host_Sim_Pwm_Get_Commit_Cnt(void);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+#endif
@@ -0,0 +1,102 @@
+/*******************************************************************************
+* File Name:   hal_host_sim_serial.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the host simulation HAL implementation for the serial buses (SPI and I2C).
+* A started transfer stays pending until the simulation loop completes it, as the
+* DMA would in the background. By default the bus is a loopback: the received bytes
+* are the transmitted ones, followed by 0xFF. A device model can be attached to a bus
+* to emulate the addressed gate drivers or sensors instead.
+* The transfer handler is executed synchronously, from the completing call.
+* The host simulation HAL is excluded from the target build (see .cyignore).
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_HAL_HOST_SIM_SERIAL_H
+#define NEXAWATT_IV_DC_HAL_HOST_SIM_SERIAL_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Number of simulated serial buses.
+ */
+#define NW_HAL_HOST_SIM_SERIAL_BUS_CNT      (4u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+/**
+ * \brief Device model of a simulated bus. The model performs the transfer (fills the receive buffer) and returns its status,
+ * e.g. NW_SERIAL_BUS_ERR for an I2C address, which is not acknowledged.
+ */
+typedef NexaWattSerialStatusResult(*NwSerialHostSimDeviceModel)(uint8 bus, const NexaWattSerialTransfer* transfer);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Host simulation HAL function that initializes a simulated serial bus.
+ * \param bus - The number of the configured bus.
+ * \param busConfig - A pointer, containing the framework's standardized serial bus configuration structure.
+ * \param transferHandler - The handler executed on the completion of a transfer.
+ * \return NW_SERIAL_BAD_PARAM - The validation of the provided parameters failed.
+ * \return NW_SERIAL_SUCCESS - The simulated bus is initialized.
+ */
+NexaWattSerialStatusResult NexaWatt_Hal_Host_Sim_Serial_Init_Bus(uint8 bus, const NexaWattSerialBusConfig* busConfig, NwSerialHalTransferHandler transferHandler);
+
+/**
+ * \brief Host simulation HAL function that de-initializes a simulated serial bus. A pending transfer is dropped.
+ * \param bus - The number of the bus.
+ * \return NW_SERIAL_BAD_PARAM - The provided bus number does not exist.
+ * \return NW_SERIAL_SUCCESS - The simulated bus is de-initialized.
+ */
+NexaWattSerialStatusResult NexaWatt_Hal_Host_Sim_Serial_DeInit_Bus(uint8 bus);
+
+/**
+ * \brief Host simulation HAL function that starts a transfer. The transfer is completed by NexaWatt_Hal_Host_Sim_Serial_Complete_Transfers().
+ * \param bus - The number of the bus.
+ * \param transfer - A pointer to the transfer. The transfer and its buffers must stay valid until its completion.
+ * \return NW_SERIAL_BAD_PARAM - The bus is not initialized or the transfer is empty.
+ * \return NW_SERIAL_BUSY - A transfer is already pending on the bus.
+ * \return NW_SERIAL_SUCCESS - The transfer is pending.
+ */
+NexaWattSerialStatusResult NexaWatt_Hal_Host_Sim_Serial_Start_Transfer(uint8 bus, const NexaWattSerialTransfer* transfer);
+
+/**
+ * \brief Host simulation HAL function that drops the pending transfer of a bus, without executing the transfer handler.
+ * \param bus - The number of the bus.
+ */
+void NexaWatt_Hal_Host_Sim_Serial_Abort(uint8 bus);
+
+/**
+ * \brief Host simulation function that attaches a device model to a simulated bus.
+ * \param bus - The number of the bus.
+ * \param deviceModel - The device model. NULL restores the loopback.
+ */
+void NexaWatt_Hal_Host_Sim_Serial_Set_Device_Model(uint8 bus, NwSerialHostSimDeviceModel deviceModel);
+
+/**
+ * \brief Host simulation function that completes the pending transfers of all buses and executes their transfer handlers.
+ * Transfers started by the handlers (the next transfers of a batch) stay pending until the next call, so a batch
+ * of N transfers takes N calls, as it takes N transfer times on the target.
+ * \return The number of completed transfers.
+ */
+uint32 NexaWatt_Hal_Host_Sim_Serial_Complete_Transfers(void);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+#endif
@@ -0,0 +1,115 @@
+/*******************************************************************************
+* File Name:   hal_host_sim_timer.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the host simulation HAL implementation for the hardware timers.
+* The simulated counters do not follow the host clock; they are advanced by the
+* simulation loop, so the simulated time is deterministic and independent of the host load.
+* The overflow ISR is executed synchronously, from the advancing call.
+* The host simulation HAL is excluded from the target build (see .cyignore).
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_HAL_HOST_SIM_TIMER_H
+#define NEXAWATT_IV_DC_HAL_HOST_SIM_TIMER_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Number of simulated timers.
+ */
+#define NW_HAL_HOST_SIM_TIMER_CNT       (4u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Host simulation HAL function that initializes a simulated timer. The timer is left stopped, with its counter cleared.
+ * \param timer - The number of the configured timer.
+ * \param timerConfig - A pointer, containing the framework's standardized timer configuration structure.
+ * \return NW_TIMER_BAD_PARAM - The timer does not exist, the pointer is NULL or the period or the frequency is 0.
+ * \return NW_TIMER_SUCCESS - The simulated timer is initialized.
+ */
+NexaWattTimerStatusResult NexaWatt_Hal_Host_Sim_Timer_Init(uint8 timer, const NexaWattTimerConfig* timerConfig);
+
+/**
+ * \brief Host simulation HAL function that de-initializes a simulated timer.
+ * \param timer - The number of the timer.
+ * \return NW_TIMER_BAD_PARAM - The timer does not exist.
+ * \return NW_TIMER_SUCCESS - The simulated timer is de-initialized.
+ */
+NexaWattTimerStatusResult NexaWatt_Hal_Host_Sim_Timer_DeInit(uint8 timer);
+
+/**
+ * \brief Host simulation HAL function that starts a simulated timer.
+ * \param timer - The number of the timer.
+ * \return NW_TIMER_BAD_PARAM - The timer does not exist.
+ * \return NW_TIMER_SUCCESS - The simulated timer is started.
+ */
+NexaWattTimerStatusResult NexaWatt_Hal_Host_Sim_Timer_Start(uint8 timer);
+
+/**
+ * \brief Host simulation HAL function that stops a simulated timer.
+ * \param timer - The number of the timer.
+ * \return NW_TIMER_BAD_PARAM - The timer does not exist.
+ * \return NW_TIMER_SUCCESS - The simulated timer is stopped.
+ */
+NexaWattTimerStatusResult NexaWatt_Hal_Host_Sim_Timer_Stop(uint8 timer);
+
+/**
+ * \brief Host simulation HAL function that reads the counter of a simulated timer.
+ * \param timer - The number of the timer.
+ * \return The current counter value.
+ */
+NwTimerTicks NexaWatt_Hal_Host_Sim_Timer_Read_Counter(uint8 timer);
+
+/**
+ * \brief Host simulation HAL function that reads the overflow status of a simulated timer.
+ * \param timer - The number of the timer.
+ * \return nwTrue - The counter wrapped around since the last clear.
+ * \return nwFalse - No wrap around since the last clear.
+ */
+nw_bool NexaWatt_Hal_Host_Sim_Timer_Get_Overflow_Status(uint8 timer);
+
+/**
+ * \brief Host simulation HAL function that clears the overflow status of a simulated timer.
+ * \param timer - The number of the timer.
+ */
+void NexaWatt_Hal_Host_Sim_Timer_Clear_Overflow_Status(uint8 timer);
+
+/**
+ * \brief Function used by the simulation loop to advance the simulated time of all running timers.
+ * The overflow ISR of a timer is executed after each wrap around of its counter.
+ * \param ticks - The number of ticks to advance the running timers by.
+ */
+void NexaWatt_Hal_Host_Sim_Timer_Advance(NwTimerTicks ticks);
+
+/**
+ * \brief Function used by the simulation loop to wrap the counter of a simulated timer without executing its ISR.
+ * Models an overflow that is pending, e.g. while the interrupts are masked.
+ * \param timer - The number of the timer.
+ * \param ticks - The number of ticks to advance the timer by.
+ */
+void NexaWatt_Hal_Host_Sim_Timer_Advance_Masked(uint8 timer, NwTimerTicks ticks);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+#endif
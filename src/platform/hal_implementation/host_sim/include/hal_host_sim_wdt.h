@@ -0,0 +1,82 @@
+/*******************************************************************************
+* File Name:   hal_host_sim_wdt.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the host simulation HAL implementation for the hardware watchdog.
+* As the simulated timers, the simulated watchdog does not follow the host clock;
+* its time is advanced by the simulation loop. On the expiry, the reset handler
+* of the simulation is executed synchronously, from the advancing call, and the
+* reset status is set, so the simulation can model the restart of the firmware.
+* The host simulation HAL is excluded from the target build (see .cyignore).
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_HAL_HOST_SIM_WDT_H
+#define NEXAWATT_IV_DC_HAL_HOST_SIM_WDT_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Host simulation HAL function that initializes and starts the simulated watchdog.
+ * \param wdtConfig - A pointer, containing the framework's standardized watchdog configuration structure.
+ * \return NW_WDT_BAD_PARAM - The pointer is NULL or the timeout is 0.
+ * \return NW_WDT_SUCCESS - The simulated watchdog is running.
+ */
+NexaWattWdtStatusResult NexaWatt_Hal_Host_Sim_Wdt_Init(const NexaWattWdtConfig* wdtConfig);
+
+/**
+ * \brief Host simulation HAL function that kicks the simulated watchdog.
+ */
+void NexaWatt_Hal_Host_Sim_Wdt_Kick(void);
+
+/**
+ * \brief Host simulation HAL function that reads the simulated reset status.
+ * \return nwTrue - The simulated watchdog expired since the start of the simulation.
+ * \return nwFalse - The simulated watchdog did not expire.
+ */
+nw_bool NexaWatt_Hal_Host_Sim_Wdt_Get_Reset_Status(void);
+
+/**
+ * \brief Function used by the simulation to register the handler executed on the expiry of the simulated watchdog.
+ * \param resetHandlerPtr - The handler, modelling the reset of the device. NULL only records the expiry.
+ */
+void NexaWatt_Hal_Host_Sim_Wdt_Set_Reset_Handler(NwIsrPointerType resetHandlerPtr);
+
+/**
+ * \brief Function used by the simulation loop to advance the simulated time of the watchdog.
+ * On the expiry, the watchdog is stopped, as the device would be reset, and the reset handler is executed.
+ * \param elapsedUs - The simulated time in microseconds.
+ */
+void NexaWatt_Hal_Host_Sim_Wdt_Advance(uint32 elapsedUs);
+
+/**
+ * \brief Function used by the simulation to read the number of expiries of the simulated watchdog.
+ * \return The number of expiries since the start of the simulation.
+ */
+uint32 NexaWatt_Hal_Host_Sim_Wdt_Get_Expiry_Cnt(void);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+#endif
@@ -0,0 +1,191 @@
+/*******************************************************************************
+* File Name:   hal_host_sim_adc.c
+*
+* Description: This is the source file containing definitions,
+* related to the host simulation HAL implementation for the ADC peripheral.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "hal_host_sim_adc.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Number of bits dropped when a normalized Q15 input is quantized to the simulated ADC resolution.
+ */
+#define NW_HAL_HOST_SIM_ADC_QUANTIZATION_SHIFT  (NW_Q15_FRAC_BITS - NW_HAL_HOST_SIM_ADC_RESOLUTION_BITS)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+/**
+ * \brief State of the simulated ADC sequence.
+ */
+typedef struct sNexaWattHostSimAdcSequence
+{
+    nw_bool isInitialized;
+    nw_bool isStarted;
+    uint8 channelList[NW_HAL_HOST_SIM_ADC_MAX_SEQUENCE_LEN];
+    uint8 channelCnt;
+    NexaWattADCTriggerSource triggerSource;
+    uint8 triggerPwmChannel;
+    NwAdcSample* frameBuffers[2u];
+    uint8 activeBufferIdx;
+    NwAdcHalFrameHandler frameHandler;
+    NwHostSimAdcSampleSource sampleSource;
+    const NwAdcSample* recordedSamples;
+    uint32 recordedSequenceCnt;
+    uint32 recordedSequenceIdx;
+} NexaWattHostSimAdcSequence;
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+static NexaWattHostSimAdcSequence simAdcSequence;
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that executes the simulated sequence: fills the active sample frame,
+ * switches to the other frame and executes the frame handler.
+ */
+static void NexaWatt_Hal_Host_Sim_Adc_Convert_Sequence(void);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattADCStatusResult NexaWatt_Hal_Host_Sim_Adc_Init_Sequence(const NexaWattADCSequenceConfig* const sequenceConfig, NwAdcSample* const pingBuffer,
+                                                                NwAdcSample* const pongBuffer, const NwAdcHalFrameHandler frameHandler)
+{
+    NexaWattADCStatusResult retRes = NW_ADC_BAD_PARAM;
+    uint8 channelIdx = 0u;
+
+    if ((sequenceConfig != NULL) &&
+        (sequenceConfig->channelList != NULL) &&
+        (sequenceConfig->channelCnt > 0u) &&
+        (sequenceConfig->channelCnt <= NW_HAL_HOST_SIM_ADC_MAX_SEQUENCE_LEN) &&
+        (pingBuffer != NULL) &&
+        (pongBuffer != NULL) &&
+        (frameHandler != NULL))
+    {
+        for (channelIdx = 0u; channelIdx < sequenceConfig->channelCnt; channelIdx++)
+        {
+            simAdcSequence.channelList[channelIdx] = sequenceConfig->channelList[channelIdx];
+        }
+
+        simAdcSequence.channelCnt = sequenceConfig->channelCnt;
+        simAdcSequence.triggerSource = sequenceConfig->triggerSource;
+        simAdcSequence.triggerPwmChannel = sequenceConfig->triggerPwmChannel;
+        simAdcSequence.frameBuffers[0u] = pingBuffer;
+        simAdcSequence.frameBuffers[1u] = pongBuffer;
+        simAdcSequence.activeBufferIdx = 0u;
+        simAdcSequence.frameHandler = frameHandler;
+        simAdcSequence.isStarted = nwFalse;
+        simAdcSequence.isInitialized = nwTrue;
+
+        retRes = NW_ADC_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattADCStatusResult NexaWatt_Hal_Host_Sim_Adc_DeInit_Sequence(void)
+{
+    simAdcSequence.isStarted = nwFalse;
+    simAdcSequence.isInitialized = nwFalse;
+    simAdcSequence.frameHandler = NULL;
+
+    return NW_ADC_SUCCESS;
+}
+
+NexaWattADCStatusResult NexaWatt_Hal_Host_Sim_Adc_Start(void)
+{
+    simAdcSequence.activeBufferIdx = 0u;
+    simAdcSequence.isStarted = simAdcSequence.isInitialized;
+
+    return NW_ADC_SUCCESS;
+}
+
+NexaWattADCStatusResult NexaWatt_Hal_Host_Sim_Adc_Stop(void)
+{
+    simAdcSequence.isStarted = nwFalse;
+
+    return NW_ADC_SUCCESS;
+}
+
+void NexaWatt_Hal_Host_Sim_Adc_Software_Trigger(void)
+{
+    if (simAdcSequence.isStarted == nwTrue)
+    {
+        NexaWatt_Hal_Host_Sim_Adc_Convert_Sequence();
+    }
+}
+
+void NexaWatt_Hal_Host_Sim_Adc_Pwm_Period_Start(const uint8 pwmChannel)
+{
+    if ((simAdcSequence.isStarted == nwTrue) &&
+        (simAdcSequence.triggerSource == NW_ADC_TRIGGER_PWM) &&
+        (simAdcSequence.triggerPwmChannel == pwmChannel))
+    {
+        NexaWatt_Hal_Host_Sim_Adc_Convert_Sequence();
+    }
+}
+
+void NexaWatt_Hal_Host_Sim_Adc_Set_Sample_Source(const NwHostSimAdcSampleSource sampleSource)
+{
+    simAdcSequence.sampleSource = sampleSource;
+    simAdcSequence.recordedSamples = NULL;
+    simAdcSequence.recordedSequenceCnt = 0u;
+    simAdcSequence.recordedSequenceIdx = 0u;
+}
+
+void NexaWatt_Hal_Host_Sim_Adc_Set_Recorded_Samples(const NwAdcSample* const recordedSamples, const uint32 sequenceCnt)
+{
+    simAdcSequence.sampleSource = NULL;
+    simAdcSequence.recordedSamples = recordedSamples;
+    simAdcSequence.recordedSequenceCnt = (recordedSamples != NULL) ? sequenceCnt : 0u;
+    simAdcSequence.recordedSequenceIdx = 0u;
+}
+
+static void NexaWatt_Hal_Host_Sim_Adc_Convert_Sequence(void)
+{
+    NwAdcSample* const frameBuffer = simAdcSequence.frameBuffers[simAdcSequence.activeBufferIdx];
+    const uint8 filledBufferIdx = simAdcSequence.activeBufferIdx;
+    uint8 channelIdx = 0u;
+    NwQ15 normalizedInput = 0;
+
+    for (channelIdx = 0u; channelIdx < simAdcSequence.channelCnt; channelIdx++)
+    {
+        if (simAdcSequence.recordedSequenceCnt > 0u)
+        {
+            frameBuffer[channelIdx] =
+                    simAdcSequence.recordedSamples[(simAdcSequence.recordedSequenceIdx * simAdcSequence.channelCnt) + channelIdx];
+        }
+        else if (simAdcSequence.sampleSource != NULL)
+        {
+            // The full scale input (1.0) saturates to the maximum result
+            normalizedInput = NexaWatt_FixedPoint_Saturate(simAdcSequence.sampleSource(simAdcSequence.channelList[channelIdx]), 0, NW_Q15_ONE - 1);
+            frameBuffer[channelIdx] = (NwAdcSample)((uint32)normalizedInput >> NW_HAL_HOST_SIM_ADC_QUANTIZATION_SHIFT);
+        }
+        else
+        {
+            frameBuffer[channelIdx] = 0u;
+        }
+    }
+
+    if (simAdcSequence.recordedSequenceCnt > 0u)
+    {
+        simAdcSequence.recordedSequenceIdx = (simAdcSequence.recordedSequenceIdx + 1u) % simAdcSequence.recordedSequenceCnt;
+    }
+
+    simAdcSequence.activeBufferIdx = filledBufferIdx ^ 0x01u;
+    simAdcSequence.frameHandler(filledBufferIdx,
+                                (simAdcSequence.channelCnt * NW_HAL_HOST_SIM_ADC_CONVERSION_TICKS) + NW_HAL_HOST_SIM_ADC_TRANSFER_TICKS);
+}
@@ -0,0 +1,225 @@
+/*******************************************************************************
+* File Name:   hal_host_sim_pwm.c
+*
+* Description: This is the source file containing definitions,
+* related to the host simulation HAL implementation for the PWM peripheral.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "hal_host_sim_pwm.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Mask containing all simulated PWM channels.
+ */
+#define NW_HAL_HOST_SIM_PWM_CHANNEL_VALID_MASK  ((0x01u << NW_HAL_HOST_SIM_PWM_CHANNEL_CNT) - 1u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+static NexaWattHostSimPwmChannel simPwmChannels[NW_HAL_HOST_SIM_PWM_CHANNEL_CNT];
+static uint32 simPwmCommitCnt = 0u;
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that sets the running state of the channels in the provided mask.
+ * \param channelMask - The mask of the PWM channels.
+ * \param isRunning - The new running state of the channels.
+ * \return NW_PWM_BAD_PARAM - The mask contains channels, which do not exist.
+ * \return NW_PWM_SUCCESS - The running state is set.
+ */
+static NexaWattPWMStatusResult NexaWatt_Hal_Host_Sim_Pwm_Set_Running(NwPwmChannelMask channelMask, nw_bool isRunning);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattPWMStatusResult NexaWatt_Hal_Host_Sim_Pwm_Init_Channel(const uint8 channel, const NexaWattPWMChannelConfig* const channelConfig)
+{
+    NexaWattPWMStatusResult retRes = NW_PWM_BAD_PARAM;
+
+    if ((channel < NW_HAL_HOST_SIM_PWM_CHANNEL_CNT) &&
+        (channelConfig != NULL) &&
+        (channelConfig->periodTicks > 0u))
+    {
+        simPwmChannels[channel].isInitialized = nwTrue;
+        simPwmChannels[channel].isRunning = nwFalse;
+        simPwmChannels[channel].config = *channelConfig;
+        simPwmChannels[channel].activePeriodTicks = channelConfig->periodTicks;
+        simPwmChannels[channel].bufferedPeriodTicks = channelConfig->periodTicks;
+        simPwmChannels[channel].activeCompareTicks = 0u;
+        simPwmChannels[channel].bufferedCompareTicks = 0u;
+        simPwmChannels[channel].swapPending = nwFalse;
+        simPwmChannels[channel].phaseTicks = 0u;
+
+        retRes = NW_PWM_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattPWMStatusResult NexaWatt_Hal_Host_Sim_Pwm_DeInit_Channel(const uint8 channel)
+{
+    NexaWattPWMStatusResult retRes = NW_PWM_BAD_PARAM;
+
+    if (channel < NW_HAL_HOST_SIM_PWM_CHANNEL_CNT)
+    {
+        simPwmChannels[channel].isInitialized = nwFalse;
+        simPwmChannels[channel].isRunning = nwFalse;
+        simPwmChannels[channel].activeCompareTicks = 0u;
+        simPwmChannels[channel].bufferedCompareTicks = 0u;
+        simPwmChannels[channel].swapPending = nwFalse;
+
+        retRes = NW_PWM_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattPWMStatusResult NexaWatt_Hal_Host_Sim_Pwm_Set_Period(const uint8 channel, const NwPwmTicks periodTicks)
+{
+    NexaWattPWMStatusResult retRes = NW_PWM_BAD_PARAM;
+
+    if ((channel < NW_HAL_HOST_SIM_PWM_CHANNEL_CNT) &&
+        (periodTicks > 0u))
+    {
+        simPwmChannels[channel].bufferedPeriodTicks = periodTicks;
+        simPwmChannels[channel].swapPending = nwTrue;
+
+        retRes = NW_PWM_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattPWMStatusResult NexaWatt_Hal_Host_Sim_Pwm_Set_Phase(const uint8 channel, const NwPwmTicks phaseTicks)
+{
+    NexaWattPWMStatusResult retRes = NW_PWM_BAD_PARAM;
+
+    if (channel < NW_HAL_HOST_SIM_PWM_CHANNEL_CNT)
+    {
+        simPwmChannels[channel].phaseTicks = phaseTicks;
+
+        retRes = NW_PWM_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattPWMStatusResult NexaWatt_Hal_Host_Sim_Pwm_Set_Dead_Time(const uint8 channel, const NwPwmTicks deadTimeRiseTicks, const NwPwmTicks deadTimeFallTicks)
+{
+    NexaWattPWMStatusResult retRes = NW_PWM_BAD_PARAM;
+
+    if (channel < NW_HAL_HOST_SIM_PWM_CHANNEL_CNT)
+    {
+        simPwmChannels[channel].config.deadTimeRiseTicks = deadTimeRiseTicks;
+        simPwmChannels[channel].config.deadTimeFallTicks = deadTimeFallTicks;
+
+        retRes = NW_PWM_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattPWMStatusResult NexaWatt_Hal_Host_Sim_Pwm_Start(const NwPwmChannelMask channelMask)
+{
+    return NexaWatt_Hal_Host_Sim_Pwm_Set_Running(channelMask, nwTrue);
+}
+
+NexaWattPWMStatusResult NexaWatt_Hal_Host_Sim_Pwm_Stop(const NwPwmChannelMask channelMask)
+{
+    return NexaWatt_Hal_Host_Sim_Pwm_Set_Running(channelMask, nwFalse);
+}
+
+void NexaWatt_Hal_Host_Sim_Pwm_Commit(const NwPwmTicks* const compareValues, const NwPwmChannelMask channelMask)
+{
+    uint8 channel = 0u;
+
+    for (channel = 0u; channel < NW_HAL_HOST_SIM_PWM_CHANNEL_CNT; channel++)
+    {
+        if ((channelMask & (0x01u << channel)) != 0u)
+        {
+            simPwmChannels[channel].bufferedCompareTicks = compareValues[channel];
+            simPwmChannels[channel].swapPending = nwTrue;
+        }
+    }
+
+    if ((channelMask & NW_HAL_HOST_SIM_PWM_CHANNEL_VALID_MASK) != 0u)
+    {
+        simPwmCommitCnt++;
+    }
+}
+
+void NexaWatt_Hal_Host_Sim_Pwm_Period_Boundary(void)
+{
+    uint8 channel = 0u;
+
+    for (channel = 0u; channel < NW_HAL_HOST_SIM_PWM_CHANNEL_CNT; channel++)
+    {
+        if (simPwmChannels[channel].swapPending == nwTrue)
+        {
+            simPwmChannels[channel].activePeriodTicks = simPwmChannels[channel].bufferedPeriodTicks;
+            simPwmChannels[channel].activeCompareTicks = simPwmChannels[channel].bufferedCompareTicks;
+            simPwmChannels[channel].swapPending = nwFalse;
+        }
+    }
+}
+
+NwQ15 NexaWatt_Hal_Host_Sim_Pwm_Get_Duty(const uint8 channel)
+{
+    NwQ15 retVal = 0;
+
+    if ((channel < NW_HAL_HOST_SIM_PWM_CHANNEL_CNT) &&
+        (simPwmChannels[channel].isRunning == nwTrue) &&
+        (simPwmChannels[channel].activePeriodTicks > 0u))
+    {
+        retVal = (NwQ15)((((uint64)simPwmChannels[channel].activeCompareTicks) << NW_Q15_FRAC_BITS) /
+                         (uint64)simPwmChannels[channel].activePeriodTicks);
+        retVal = NexaWatt_FixedPoint_Saturate(retVal, 0, NW_Q15_ONE);
+    }
+
+    return retVal;
+}
+
+const NexaWattHostSimPwmChannel* NexaWatt_Hal_Host_Sim_Pwm_Get_Channel(const uint8 channel)
+{
+    return (channel < NW_HAL_HOST_SIM_PWM_CHANNEL_CNT) ? &simPwmChannels[channel] : NULL;
+}
+
+uint32 NexaWatt_Hal_Host_Sim_Pwm_Get_Commit_Cnt(void)
+{
+    return simPwmCommitCnt;
+}
+
+static NexaWattPWMStatusResult NexaWatt_Hal_Host_Sim_Pwm_Set_Running(const NwPwmChannelMask channelMask, const nw_bool isRunning)
+{
+    NexaWattPWMStatusResult retRes = NW_PWM_BAD_PARAM;
+    uint8 channel = 0u;
+
+    if ((channelMask & ~NW_HAL_HOST_SIM_PWM_CHANNEL_VALID_MASK) == 0u)
+    {
+        for (channel = 0u; channel < NW_HAL_HOST_SIM_PWM_CHANNEL_CNT; channel++)
+        {
+            if ((channelMask & (0x01u << channel)) != 0u)
+            {
+                simPwmChannels[channel].isRunning = isRunning;
+            }
+        }
+
+        retRes = NW_PWM_SUCCESS;
+    }
+
+    return retRes;
+}
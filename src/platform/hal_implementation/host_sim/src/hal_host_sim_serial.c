@@ -0,0 +1,176 @@
+/*******************************************************************************
+* File Name:   hal_host_sim_serial.c
+*
+* Description: This is the source file containing definitions,
+* related to the host simulation HAL implementation for the serial buses.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "hal_host_sim_serial.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Byte received by the loopback after the transmitted bytes, as from an idle MISO/SDA line.
+ */
+#define NW_HAL_HOST_SIM_SERIAL_IDLE_BYTE    (0xFFu)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+/**
+ * \brief State of a simulated serial bus.
+ */
+typedef struct sNexaWattHostSimSerialBus
+{
+    nw_bool isInitialized;
+    const NexaWattSerialTransfer* pendingTransfer;
+    NwSerialHalTransferHandler transferHandler;
+    NwSerialHostSimDeviceModel deviceModel;
+} NexaWattHostSimSerialBus;
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+static NexaWattHostSimSerialBus simSerialBuses[NW_HAL_HOST_SIM_SERIAL_BUS_CNT];
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Default device model of the simulated buses, returning the transmitted bytes.
+ * \param bus - The number of the bus.
+ * \param transfer - A pointer to the transfer.
+ * \return NW_SERIAL_SUCCESS - The loopback always succeeds.
+ */
+static NexaWattSerialStatusResult NexaWatt_Hal_Host_Sim_Serial_Loopback(uint8 bus, const NexaWattSerialTransfer* transfer);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattSerialStatusResult NexaWatt_Hal_Host_Sim_Serial_Init_Bus(const uint8 bus, const NexaWattSerialBusConfig* const busConfig,
+                                                                 const NwSerialHalTransferHandler transferHandler)
+{
+    NexaWattSerialStatusResult retRes = NW_SERIAL_BAD_PARAM;
+
+    if ((bus < NW_HAL_HOST_SIM_SERIAL_BUS_CNT) &&
+        (busConfig != NULL) &&
+        (transferHandler != NULL))
+    {
+        simSerialBuses[bus].isInitialized = nwTrue;
+        simSerialBuses[bus].pendingTransfer = NULL;
+        simSerialBuses[bus].transferHandler = transferHandler;
+
+        retRes = NW_SERIAL_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattSerialStatusResult NexaWatt_Hal_Host_Sim_Serial_DeInit_Bus(const uint8 bus)
+{
+    NexaWattSerialStatusResult retRes = NW_SERIAL_BAD_PARAM;
+
+    if (bus < NW_HAL_HOST_SIM_SERIAL_BUS_CNT)
+    {
+        simSerialBuses[bus].isInitialized = nwFalse;
+        simSerialBuses[bus].pendingTransfer = NULL;
+        simSerialBuses[bus].transferHandler = NULL;
+
+        retRes = NW_SERIAL_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattSerialStatusResult NexaWatt_Hal_Host_Sim_Serial_Start_Transfer(const uint8 bus, const NexaWattSerialTransfer* const transfer)
+{
+    NexaWattSerialStatusResult retRes = NW_SERIAL_BAD_PARAM;
+
+    if ((bus < NW_HAL_HOST_SIM_SERIAL_BUS_CNT) &&
+        (simSerialBuses[bus].isInitialized == nwTrue) &&
+        (transfer != NULL) &&
+        ((transfer->txLen > 0u) || (transfer->rxLen > 0u)))
+    {
+        if (simSerialBuses[bus].pendingTransfer == NULL)
+        {
+            simSerialBuses[bus].pendingTransfer = transfer;
+
+            retRes = NW_SERIAL_SUCCESS;
+        }
+        else
+        {
+            retRes = NW_SERIAL_BUSY;
+        }
+    }
+
+    return retRes;
+}
+
+void NexaWatt_Hal_Host_Sim_Serial_Abort(const uint8 bus)
+{
+    if (bus < NW_HAL_HOST_SIM_SERIAL_BUS_CNT)
+    {
+        simSerialBuses[bus].pendingTransfer = NULL;
+    }
+}
+
+void NexaWatt_Hal_Host_Sim_Serial_Set_Device_Model(const uint8 bus, const NwSerialHostSimDeviceModel deviceModel)
+{
+    if (bus < NW_HAL_HOST_SIM_SERIAL_BUS_CNT)
+    {
+        simSerialBuses[bus].deviceModel = deviceModel;
+    }
+}
+
+uint32 NexaWatt_Hal_Host_Sim_Serial_Complete_Transfers(void)
+{
+    uint32 completedCnt = 0u;
+    uint8 bus = 0u;
+    const NexaWattSerialTransfer* transfer = NULL;
+    NwSerialHostSimDeviceModel deviceModel = NULL;
+    NexaWattSerialStatusResult transferStatus = NW_SERIAL_SUCCESS;
+
+    for (bus = 0u; bus < NW_HAL_HOST_SIM_SERIAL_BUS_CNT; bus++)
+    {
+        transfer = simSerialBuses[bus].pendingTransfer;
+        if (transfer != NULL)
+        {
+            // The transfer is released first, so the handler can start the next one
+            simSerialBuses[bus].pendingTransfer = NULL;
+
+            deviceModel = (simSerialBuses[bus].deviceModel != NULL) ?
+                    simSerialBuses[bus].deviceModel : NexaWatt_Hal_Host_Sim_Serial_Loopback;
+            transferStatus = deviceModel(bus, transfer);
+
+            simSerialBuses[bus].transferHandler(bus, transferStatus);
+            completedCnt++;
+        }
+    }
+
+    return completedCnt;
+}
+
+static NexaWattSerialStatusResult NexaWatt_Hal_Host_Sim_Serial_Loopback(const uint8 bus, const NexaWattSerialTransfer* const transfer)
+{
+    NwSerialLength byteIdx = 0u;
+
+    (void)bus;
+
+    if (transfer->rxData != NULL)
+    {
+        for (byteIdx = 0u; byteIdx < transfer->rxLen; byteIdx++)
+        {
+            transfer->rxData[byteIdx] = ((transfer->txData != NULL) && (byteIdx < transfer->txLen)) ?
+                    transfer->txData[byteIdx] : NW_HAL_HOST_SIM_SERIAL_IDLE_BYTE;
+        }
+    }
+
+    return NW_SERIAL_SUCCESS;
+}
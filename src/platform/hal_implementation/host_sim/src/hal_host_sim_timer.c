@@ -0,0 +1,177 @@
+/*******************************************************************************
+* File Name:   hal_host_sim_timer.c
+*
+* Description: This is the source file containing definitions,
+* related to the host simulation HAL implementation for the hardware timers.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "hal_host_sim_timer.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+/**
+ * \brief State of a simulated timer. The counter counts from 0 to the period (inclusive), as the TCPWM counters do.
+ */
+typedef struct sNexaWattHostSimTimer
+{
+    nw_bool isInitialized;
+    nw_bool isRunning;
+    nw_bool overflowStatus;
+    NwTimerTicks counter;
+    NwTimerTicks periodTicks;
+    NwIsrPointerType overflowIsrPtr;
+} NexaWattHostSimTimer;
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+static NexaWattHostSimTimer simTimers[NW_HAL_HOST_SIM_TIMER_CNT];
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that advances the counter of a simulated timer.
+ * \param simTimer - A pointer to the simulated timer.
+ * \param ticks - The number of ticks to advance the timer by.
+ * \param executeIsr - nwTrue to execute the overflow ISR after each wrap around.
+ */
+static void NexaWatt_Hal_Host_Sim_Timer_Advance_Single(NexaWattHostSimTimer* simTimer, NwTimerTicks ticks, nw_bool executeIsr);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattTimerStatusResult NexaWatt_Hal_Host_Sim_Timer_Init(const uint8 timer, const NexaWattTimerConfig* const timerConfig)
+{
+    NexaWattTimerStatusResult retRes = NW_TIMER_BAD_PARAM;
+
+    if ((timer < NW_HAL_HOST_SIM_TIMER_CNT) &&
+        (timerConfig != NULL) &&
+        (timerConfig->periodTicks > 0u) &&
+        (timerConfig->frequencyHz > 0u))
+    {
+        simTimers[timer].isInitialized = nwTrue;
+        simTimers[timer].isRunning = nwFalse;
+        simTimers[timer].overflowStatus = nwFalse;
+        simTimers[timer].counter = 0u;
+        simTimers[timer].periodTicks = timerConfig->periodTicks;
+        simTimers[timer].overflowIsrPtr = timerConfig->overflowIsrPtr;
+
+        retRes = NW_TIMER_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattTimerStatusResult NexaWatt_Hal_Host_Sim_Timer_DeInit(const uint8 timer)
+{
+    NexaWattTimerStatusResult retRes = NW_TIMER_BAD_PARAM;
+
+    if (timer < NW_HAL_HOST_SIM_TIMER_CNT)
+    {
+        simTimers[timer].isInitialized = nwFalse;
+        simTimers[timer].isRunning = nwFalse;
+        simTimers[timer].overflowIsrPtr = NULL;
+
+        retRes = NW_TIMER_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattTimerStatusResult NexaWatt_Hal_Host_Sim_Timer_Start(const uint8 timer)
+{
+    NexaWattTimerStatusResult retRes = NW_TIMER_BAD_PARAM;
+
+    if (timer < NW_HAL_HOST_SIM_TIMER_CNT)
+    {
+        simTimers[timer].isRunning = simTimers[timer].isInitialized;
+
+        retRes = NW_TIMER_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattTimerStatusResult NexaWatt_Hal_Host_Sim_Timer_Stop(const uint8 timer)
+{
+    NexaWattTimerStatusResult retRes = NW_TIMER_BAD_PARAM;
+
+    if (timer < NW_HAL_HOST_SIM_TIMER_CNT)
+    {
+        simTimers[timer].isRunning = nwFalse;
+
+        retRes = NW_TIMER_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NwTimerTicks NexaWatt_Hal_Host_Sim_Timer_Read_Counter(const uint8 timer)
+{
+    return simTimers[timer].counter;
+}
+
+nw_bool NexaWatt_Hal_Host_Sim_Timer_Get_Overflow_Status(const uint8 timer)
+{
+    return simTimers[timer].overflowStatus;
+}
+
+void NexaWatt_Hal_Host_Sim_Timer_Clear_Overflow_Status(const uint8 timer)
+{
+    simTimers[timer].overflowStatus = nwFalse;
+}
+
+void NexaWatt_Hal_Host_Sim_Timer_Advance(const NwTimerTicks ticks)
+{
+    uint8 timer = 0u;
+
+    for (timer = 0u; timer < NW_HAL_HOST_SIM_TIMER_CNT; timer++)
+    {
+        if (simTimers[timer].isRunning == nwTrue)
+        {
+            NexaWatt_Hal_Host_Sim_Timer_Advance_Single(&simTimers[timer], ticks, nwTrue);
+        }
+    }
+}
+
+void NexaWatt_Hal_Host_Sim_Timer_Advance_Masked(const uint8 timer, const NwTimerTicks ticks)
+{
+    if ((timer < NW_HAL_HOST_SIM_TIMER_CNT) &&
+        (simTimers[timer].isRunning == nwTrue))
+    {
+        NexaWatt_Hal_Host_Sim_Timer_Advance_Single(&simTimers[timer], ticks, nwFalse);
+    }
+}
+
+static void NexaWatt_Hal_Host_Sim_Timer_Advance_Single(NexaWattHostSimTimer* const simTimer, const NwTimerTicks ticks, const nw_bool executeIsr)
+{
+    const uint64 counterModulo = (uint64)simTimer->periodTicks + 1u;
+    uint64 counter = (uint64)simTimer->counter + (uint64)ticks;
+
+    while (counter >= counterModulo)
+    {
+        counter -= counterModulo;
+        simTimer->counter = (NwTimerTicks)counter;
+        simTimer->overflowStatus = nwTrue;
+
+        if ((executeIsr == nwTrue) &&
+            (simTimer->overflowIsrPtr != NULL))
+        {
+            simTimer->overflowIsrPtr();
+        }
+    }
+
+    simTimer->counter = (NwTimerTicks)counter;
+}
@@ -0,0 +1,103 @@
+/*******************************************************************************
+* File Name:   hal_host_sim_wdt.c
+*
+* Description: This is the source file containing definitions,
+* related to the host simulation HAL implementation for the hardware watchdog.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "hal_host_sim_wdt.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+/**
+ * \brief State of the simulated watchdog. The elapsed time is counted from the last kick.
+ */
+typedef struct sNexaWattHostSimWdt
+{
+    nw_bool isRunning;
+    nw_bool resetStatus;
+    uint32 timeoutUs;
+    uint64 elapsedUs;
+    uint32 expiryCnt;
+    NwIsrPointerType resetHandlerPtr;
+} NexaWattHostSimWdt;
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+static NexaWattHostSimWdt simWdt;
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattWdtStatusResult NexaWatt_Hal_Host_Sim_Wdt_Init(const NexaWattWdtConfig* const wdtConfig)
+{
+    NexaWattWdtStatusResult retRes = NW_WDT_BAD_PARAM;
+
+    if ((wdtConfig != NULL) &&
+        (wdtConfig->timeoutUs > 0u))
+    {
+        simWdt.timeoutUs = wdtConfig->timeoutUs;
+        simWdt.elapsedUs = 0u;
+        simWdt.isRunning = nwTrue;
+
+        retRes = NW_WDT_SUCCESS;
+    }
+
+    return retRes;
+}
+
+void NexaWatt_Hal_Host_Sim_Wdt_Kick(void)
+{
+    simWdt.elapsedUs = 0u;
+}
+
+nw_bool NexaWatt_Hal_Host_Sim_Wdt_Get_Reset_Status(void)
+{
+    return simWdt.resetStatus;
+}
+
+void NexaWatt_Hal_Host_Sim_Wdt_Set_Reset_Handler(const NwIsrPointerType resetHandlerPtr)
+{
+    simWdt.resetHandlerPtr = resetHandlerPtr;
+}
+
+void NexaWatt_Hal_Host_Sim_Wdt_Advance(const uint32 elapsedUs)
+{
+    if (simWdt.isRunning == nwTrue)
+    {
+        simWdt.elapsedUs += elapsedUs;
+        if (simWdt.elapsedUs >= simWdt.timeoutUs)
+        {
+            // The reset stops the watchdog; the restarted firmware initializes it again
+            simWdt.isRunning = nwFalse;
+            simWdt.resetStatus = nwTrue;
+            simWdt.expiryCnt++;
+
+            if (simWdt.resetHandlerPtr != NULL)
+            {
+                simWdt.resetHandlerPtr();
+            }
+        }
+    }
+}
+
+uint32 NexaWatt_Hal_Host_Sim_Wdt_Get_Expiry_Cnt(void)
+{
+    return simWdt.expiryCnt;
+}
@@ -0,0 +1,94 @@
+/*******************************************************************************
+* File Name:   hal_infineon_cat1b_adc.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the HAL implementation for the ADC peripheral of the Infineon CAT1B devices.
+* The NexaWatt-IV.DC framework offers custom implemented HAL for several Infineon devices.
+* The implementation of the current HAL is dependent on the PDL, provided by Infineon Technologies.
+* The conversion sequence is executed by a sequencer group of the HPPASS SAR ADC, which writes its
+* results to a FIFO. A DataWire channel, triggered by the FIFO level, moves each completed sequence
+* into one of two sample frames using two chained descriptors (ping-pong).
+* The initialization programs the HPPASS sequencer group with the samplers of the channel list, connects the
+* first output trigger (terminal count) of the triggering PWM channel to the HPPASS trigger input and the FIFO level
+* trigger to the DataWire through the trigger multiplexer, and starts the HPPASS. The channel list must be ascending,
+* as the group converts its samplers in ascending order, and can contain one input of each multiplexed sampler.
+* The latency of a frame is the time elapsed in the period of the triggering PWM channel, when the frame is handed over.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_HAL_INFINEON_CAT1B_ADC_H
+#define NEXAWATT_IV_DC_HAL_INFINEON_CAT1B_ADC_H
+
+// TODO: Uncomment the pre-processor defence after development
+// Prevents the compilation of the HAL Implementation in case of missing PDL
+//#ifdef CY_HPPASS_H
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief HAL function that provides ADC sequence initialization using the framework standardized
+ * configuration structures and types. The function performs validation of the provided sequence configuration,
+ * initializes the two chained DataWire descriptors (one per sample frame), programs and starts the HPPASS,
+ * connects the trigger routes and initializes the DataWire channel interrupt. The DataWire channel is left disabled.
+ * \param sequenceConfig - A pointer, containing the framework's standardized ADC sequence configuration structure.
+ * \param pingBuffer - The destination buffer of the first sample frame. Must hold sequenceConfig->channelCnt samples.
+ * \param pongBuffer - The destination buffer of the second sample frame. Must hold sequenceConfig->channelCnt samples.
+ * \param frameHandler - The handler executed in the DataWire interrupt for each filled sample frame.
+ * \return NW_ADC_BAD_PARAM - The validation of the provided sequence configuration failed.
+ * Please make sure that the channels and the triggering PWM channel exist for the Infineon CAT1B device, the channels are
+ * in ascending order and at most one input of each multiplexed sampler is used.
+ * \return NW_ADC_FATAL_ERR - The initialization of the DataWire, of the HPPASS, of a trigger route or of the interrupt failed.
+ * \return NW_ADC_SUCCESS - The ADC sequence is configured and ready to be started.
+ */
+NexaWattADCStatusResult NexaWatt_Hal_Infineon_Cat1B_Adc_Init_Sequence(const NexaWattADCSequenceConfig* sequenceConfig, NwAdcSample* pingBuffer, NwAdcSample* pongBuffer, NwAdcHalFrameHandler frameHandler);
+
+/**
+ * \brief HAL function that de-initializes the ADC sequence. The DataWire channel and its interrupt are disabled and the HPPASS is de-initialized.
+ * \return NW_ADC_SUCCESS - The ADC sequence is de-initialized.
+ */
+NexaWattADCStatusResult NexaWatt_Hal_Infineon_Cat1B_Adc_DeInit_Sequence(void);
+
+/**
+ * \brief HAL function that starts the ADC sequence. The DataWire channel is restarted from the first descriptor,
+ * so the first completed sequence is always transferred into the first sample frame.
+ * \return NW_ADC_SUCCESS - The ADC sequence is started.
+ */
+NexaWattADCStatusResult NexaWatt_Hal_Infineon_Cat1B_Adc_Start(void);
+
+/**
+ * \brief HAL function that stops the ADC sequence. The DataWire channel is disabled, so the results of further triggers are not transferred.
+ * \return NW_ADC_SUCCESS - The ADC sequence is stopped.
+ */
+NexaWattADCStatusResult NexaWatt_Hal_Infineon_Cat1B_Adc_Stop(void);
+
+/**
+ * \brief HAL function that triggers the HPPASS sequencer group by firmware.
+ * The function performs no validation and can be used in interrupt context.
+ */
+void NexaWatt_Hal_Infineon_Cat1B_Adc_Software_Trigger(void);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+//#endif
+#endif
@@ -51,6 +51,19 @@
  */
 NexaWattGPIOStatusResult NexaWatt_Hal_Infineon_Cat1B_Gpio_Init_Digital_Pin(uint8 portNum, uint8 pinNum, const NexaWattGPIOPinConfig* pinConfig);
 
+/**
+ * \brief HAL function that provides initialization of several pins of a GPIO port at once. The configurations
+ * of all selected pins are validated first and merged into an image of the port registers, which is then written by a
+ * single Cy_GPIO_Port_Init() call. Each port register is therefore written once, regardless of the number of selected pins.
+ * The configuration of the pins, which are not selected, is read back and preserved.
+ * \param portNum - The number of the configured GPIO port.
+ * \param pinMask - The mask of the configured pins (bit n selects pin n).
+ * \param pinConfigs - An array of NW_HAL_INFINEON_CAT1B_GPIO_PORT_PIN_CNT pin configurations, indexed by the pin number.
+ * \return NW_GPIO_BAD_PARAM - The validation of one of the selected pin configurations failed. The port is not modified.
+ * \return NW_GPIO_SUCCESS - The selected pins are configured and ready for use.
+ */
+NexaWattGPIOStatusResult NexaWatt_Hal_Infineon_Cat1B_Gpio_Init_Port(uint8 portNum, uint8 pinMask, const NexaWattGPIOPinConfig* pinConfigs);
+
 /**
  * \brief HAL function that can be used to set/change the alternate function of an already configured GPIO pin.
  * Please note that the passed GPIO Alternate Function value is not validated! The function will assert in case of
@@ -85,6 +98,16 @@ NexaWattGPIOStatusResult NexaWatt_Hal_Infineon_Cat1B_Gpio_DeInit_Port(uint8 port
  */
 NwGpioPinResult NexaWatt_Hal_Infineon_Cat1B_Gpio_Pin_Read(uint8 portNum, uint8 pinNum);
 
+/**
+ * \brief HAL function that can be used to read the digital values of all pins of a GPIO port at once.
+ * The function performs a validation for the existence of the provided GPIO port for Infineon CAT1B devices.
+ * The input register of the GPIO port is read by a single access, so the values of all pins are sampled at the same time.
+ * \param portNum - The number of the desired GPIO port for the read.
+ * \return The values in the input register of the port, bit n corresponding to pin n.
+ * Note that 0 is returned in case of non-existing port number.
+ */
+uint8 NexaWatt_Hal_Infineon_Cat1B_Gpio_Port_Read(uint8 portNum);
+
 /**
  * \brief HAL function that can be used to write a digital value (true or false) to already configured
  * GPIO pin. The function performs a validation for the existence of the provided combination of GPIO port and pin numbers for Infineon CAT1B devices.
@@ -97,6 +120,19 @@ NwGpioPinResult NexaWatt_Hal_Infineon_Cat1B_Gpio_Pin_Read(uint8 portNum, uint8 p
  */
 NexaWattGPIOStatusResult NexaWatt_Hal_Infineon_Cat1B_Gpio_Pin_Write(uint8 portNum, uint8 pinNum, nw_bool value);
 
+/**
+ * \brief HAL function that can be used to write a digital value (true or false) to several already configured
+ * GPIO pins of a port at once. The function performs a validation for the existence of the provided GPIO port for Infineon CAT1B devices.
+ * The pins are written by a single access to the OUT_SET or OUT_CLR register of the port, so they change at the same time
+ * and the other pins of the port are not affected.
+ * \param portNum - The number of the desired GPIO port for the write.
+ * \param pinMask - The mask of the written pins, bit n corresponding to pin n.
+ * \param value - The value to be written to the pins.
+ * \return NW_GPIO_BAD_PARAM - The provided port number does not exist for the Infineon CAT1B device.
+ * \return NW_GPIO_SUCCESS - The GPIO pin outputs are written.
+ */
+NexaWattGPIOStatusResult NexaWatt_Hal_Infineon_Cat1B_Gpio_Port_Write(uint8 portNum, uint8 pinMask, nw_bool value);
+
 /**
  * \brief HAL function that can be used to toggle an already configured
  * GPIO pin. The function performs a validation for the existence of the provided combination of GPIO port and pin numbers for Infineon CAT1B devices.
@@ -118,6 +154,8 @@ NexaWattGPIOStatusResult NexaWatt_Hal_Infineon_Cat1B_Gpio_Pin_Toggle(uint8 portN
  * \param extiConfig - A pointer, containing the framework's standardized GPIO External Interrupt Request configuration.
  * \return NW_GPIO_BAD_PARAM - The validation of the provided configuration failed. Please make sure that the combination of the port and pin number represents existing pin of the Infineon CAT1B devices.
  * Validate that the provided GPIO External Interrupt Request configuration is valid.
+ * \return NW_GPIO_RESOURCE_CONFLICT - The interrupt source of the GPIO port is already claimed, e.g. by the EXTI of another pin of the port.
+ * All pins of a port share a single interrupt source and ISR. The port registers are not modified.
  * \return NW_GPIO_SUCCESS - The provided External Interrupt Request source is initialized and enabled.
  */
 NexaWattGPIOStatusResult NexaWatt_Hal_Infineon_Cat1B_Gpio_Register_EXTI(uint8 portNum, uint8 pinNum, const NexaWattGPIOExtIRQConfig* extiConfig);
@@ -0,0 +1,156 @@
+/*******************************************************************************
+* File Name:   hal_infineon_cat1b_gpio_reg.h
+*
+* Description: This is the header file containing the register level implementation
+* of the GPIO pin access for the Infineon CAT1B devices. The functions access the
+* OUT_SET, OUT_CLR, OUT_INV, IN and INTR registers of the GPIO port directly and
+* are inlined at the call site, without the call layers of the PDL.
+* The functions perform no validation of the provided parameters.
+* The backend is used by the CAT1B GPIO HAL implementation, when the project is built
+* with NW_HAL_INFINEON_CAT1B_GPIO_REG_ACCESS defined (e.g. DEFINES+=NW_HAL_INFINEON_CAT1B_GPIO_REG_ACCESS
+* in the application Makefile), and can be included directly by time critical code.
+* The port base address is obtained by NW_HAL_INFINEON_CAT1B_GPIO_REG_PORT_BASE(), which can be
+* defined before the inclusion of this header to redirect the accesses, e.g. to a fake register block on the host.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_HAL_INFINEON_CAT1B_GPIO_REG_H
+#define NEXAWATT_IV_DC_HAL_INFINEON_CAT1B_GPIO_REG_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+
+#ifndef NW_HAL_INFINEON_CAT1B_GPIO_REG_PORT_BASE
+#include "cy_device_headers.h"
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#ifndef NW_HAL_INFINEON_CAT1B_GPIO_REG_PORT_BASE
+/**
+ * \brief Macro returning the base of a GPIO port. The ports are placed consecutively in the GPIO peripheral address space.
+ */
+#define NW_HAL_INFINEON_CAT1B_GPIO_REG_PORT_BASE(portNum) \
+    ((GPIO_PRT_Type*)(GPIO_BASE + ((uint32)(portNum) * GPIO_PRT_SECTION_SIZE)))
+#endif
+
+/**
+ * \brief Macro returning the register mask of a GPIO pin.
+ */
+#define NW_HAL_INFINEON_CAT1B_GPIO_REG_PIN_MASK(pinNum) \
+    ((uint32)0x01u << (pinNum))
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/**
+ * \brief Reads the input level of a GPIO pin from the IN register of the port.
+ * \param portNum - The number of the GPIO port.
+ * \param pinNum - The number of the GPIO port pin.
+ * \return nwTrue - The pin input is high.
+ * \return nwFalse - The pin input is low.
+ */
+NW_LOCAL_INLINE NwGpioPinResult NexaWatt_Hal_Infineon_Cat1B_Gpio_Reg_Pin_Read(const uint8 portNum, const uint8 pinNum)
+{
+    return (NwGpioPinResult)((NW_HAL_INFINEON_CAT1B_GPIO_REG_PORT_BASE(portNum)->IN >> pinNum) & 0x01u);
+}
+
+/**
+ * \brief Reads the input levels of all pins of a GPIO port from the IN register of the port.
+ * \param portNum - The number of the GPIO port.
+ * \return The input levels of the port pins, bit n corresponding to pin n.
+ */
+NW_LOCAL_INLINE uint8 NexaWatt_Hal_Infineon_Cat1B_Gpio_Reg_Port_Read(const uint8 portNum)
+{
+    return (uint8)(NW_HAL_INFINEON_CAT1B_GPIO_REG_PORT_BASE(portNum)->IN);
+}
+
+/**
+ * \brief Writes the output level of several pins of a GPIO port by a single write to the OUT_SET or OUT_CLR register of the port.
+ * \param portNum - The number of the GPIO port.
+ * \param pinMask - The mask of the written pins.
+ * \param value - The output level of the written pins.
+ */
+NW_LOCAL_INLINE void NexaWatt_Hal_Infineon_Cat1B_Gpio_Reg_Port_Write(const uint8 portNum, const uint8 pinMask, const nw_bool value)
+{
+    if (value != nwFalse)
+    {
+        NW_HAL_INFINEON_CAT1B_GPIO_REG_PORT_BASE(portNum)->OUT_SET = pinMask;
+    }
+    else
+    {
+        NW_HAL_INFINEON_CAT1B_GPIO_REG_PORT_BASE(portNum)->OUT_CLR = pinMask;
+    }
+}
+
+/**
+ * \brief Writes the output level of a GPIO pin by a single write to the OUT_SET or OUT_CLR register of the port.
+ * The other pins of the port are not affected, so no read-modify-write is needed.
+ * \param portNum - The number of the GPIO port.
+ * \param pinNum - The number of the GPIO port pin.
+ * \param value - The output level.
+ */
+NW_LOCAL_INLINE void NexaWatt_Hal_Infineon_Cat1B_Gpio_Reg_Pin_Write(const uint8 portNum, const uint8 pinNum, const nw_bool value)
+{
+    if (value != nwFalse)
+    {
+        NW_HAL_INFINEON_CAT1B_GPIO_REG_PORT_BASE(portNum)->OUT_SET = NW_HAL_INFINEON_CAT1B_GPIO_REG_PIN_MASK(pinNum);
+    }
+    else
+    {
+        NW_HAL_INFINEON_CAT1B_GPIO_REG_PORT_BASE(portNum)->OUT_CLR = NW_HAL_INFINEON_CAT1B_GPIO_REG_PIN_MASK(pinNum);
+    }
+}
+
+/**
+ * \brief Inverts the output level of a GPIO pin by a single write to the OUT_INV register of the port.
+ * \param portNum - The number of the GPIO port.
+ * \param pinNum - The number of the GPIO port pin.
+ */
+NW_LOCAL_INLINE void NexaWatt_Hal_Infineon_Cat1B_Gpio_Reg_Pin_Toggle(const uint8 portNum, const uint8 pinNum)
+{
+    NW_HAL_INFINEON_CAT1B_GPIO_REG_PORT_BASE(portNum)->OUT_INV = NW_HAL_INFINEON_CAT1B_GPIO_REG_PIN_MASK(pinNum);
+}
+
+/**
+ * \brief Reads the interrupt status of a GPIO pin from the INTR register of the port.
+ * \param portNum - The number of the GPIO port.
+ * \param pinNum - The number of the GPIO port pin.
+ * \return nwTrue - An interrupt is pending on the pin.
+ * \return nwFalse - No interrupt is pending on the pin.
+ */
+NW_LOCAL_INLINE NwGpioExtiStatus NexaWatt_Hal_Infineon_Cat1B_Gpio_Reg_Get_EXTI_Status(const uint8 portNum, const uint8 pinNum)
+{
+    return (NwGpioExtiStatus)((NW_HAL_INFINEON_CAT1B_GPIO_REG_PORT_BASE(portNum)->INTR >> pinNum) & 0x01u);
+}
+
+/**
+ * \brief Clears the interrupt of a GPIO pin by writing 1 to its bit of the INTR register of the port.
+ * The register is read back, so the clear is completed before the return from the ISR.
+ * \param portNum - The number of the GPIO port.
+ * \param pinNum - The number of the GPIO port pin.
+ */
+NW_LOCAL_INLINE void NexaWatt_Hal_Infineon_Cat1B_Gpio_Reg_Clear_EXTI_Status(const uint8 portNum, const uint8 pinNum)
+{
+    NW_HAL_INFINEON_CAT1B_GPIO_REG_PORT_BASE(portNum)->INTR = NW_HAL_INFINEON_CAT1B_GPIO_REG_PIN_MASK(pinNum);
+    (void)NW_HAL_INFINEON_CAT1B_GPIO_REG_PORT_BASE(portNum)->INTR;
+}
+
+#endif
@@ -36,6 +36,7 @@ typedef enum eNexaWattIntrInitStatus
 {
     NW_HAL_INTR_INIT_SUCCESS = 0x00u,
     NW_HAL_INTR_INIT_FAILED = 0x01u,
+    NW_HAL_INTR_INIT_CONFLICT = 0x02u,
 } NexaWattIntrInitStatus;
 
 typedef struct sNexaWattIntrInitConfig
@@ -59,10 +60,12 @@ typedef struct sNexaWattIntrInitConfig
  * configuration structures and types. The function performs validation of the provided System Interrupt configuration
  * and initializes the System Interrupt according to the provided configuration, if validated successfully.
  * Keep in mind that the System Interrupt is initialized, but not enabled after the successful function execution!
+ * The Interrupt Source is claimed in the resource registry, so a second initialization of the same source is rejected.
  * \param intrConfig - A pointer, containing the framework's standardized System Interrupt configuration structure.
  * \return NW_HAL_INTR_INIT_FAILED - The initialization of the provided System Interrupt configuration failed.
  * Please make sure that the provided System Interrupt configuration contains both valid ISR pointer and Interrupt Source Number/Priority,
  * according to the defined limits for Infineon CAT1B devices (Armv8-M).
+ * \return NW_HAL_INTR_INIT_CONFLICT - The Interrupt Source is already claimed in the resource registry by another initialization.
  * \return NW_HAL_INTR_INIT_SUCCESS - The provided System Interrupt initialization was successful. The System Interrupt can now safely be
  * enabled either using the CMSIS or the HAL enable functions.
  */
@@ -84,6 +87,7 @@ void NexaWatt_Hal_Infineon_Cat1B_Intr_Enable(const NexaWattIntrInitConfig* intrC
  * and disables the System Interrupt, if validated successfully.
  * Keep in mind that the System Interrupt must be initialized and enabled before its disabling! If the System Interrupt is not initialized properly,
  * the function will silently disable the System Interrupt Source.
+ * The Interrupt Source is released in the resource registry and can be initialized again.
  * \param intrConfig - A pointer, containing the framework's standardized System Interrupt configuration structure.
  */
 void NexaWatt_Hal_Infineon_Cat1B_Intr_Disable(const NexaWattIntrInitConfig* intrConfig);
@@ -0,0 +1,137 @@
+/*******************************************************************************
+* File Name:   hal_infineon_cat1b_pwm.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the HAL implementation for the PWM peripheral of the Infineon CAT1B devices.
+* The NexaWatt-IV.DC framework offers custom implemented HAL for several Infineon devices.
+* The implementation of the current HAL is dependent on the PDL, provided by Infineon Technologies.
+* The PWM channels are mapped to the counters of the TCPWM peripheral.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_HAL_INFINEON_CAT1B_PWM_H
+#define NEXAWATT_IV_DC_HAL_INFINEON_CAT1B_PWM_H
+
+// TODO: Uncomment the pre-processor defence after development
+// Prevents the compilation of the HAL Implementation in case of missing PDL
+//#ifdef CY_TCPWM_PWM_H
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief HAL function that provides PWM channel initialization using the framework standardized
+ * configuration structures and types. The function performs validation of the provided channel configuration
+ * and initializes the TCPWM counter in PWM (or dead time) mode. The compare values are buffered and swapped
+ * at the terminal count, so the updates are applied at the period boundary. The counter is left stopped.
+ * \param channel - The number of the configured PWM channel.
+ * \param channelConfig - A pointer, containing the framework's standardized PWM channel configuration structure.
+ * \return NW_PWM_BAD_PARAM - The validation of the provided channel configuration failed.
+ * Please make sure that the period and dead times fit the counters of the Infineon CAT1B devices.
+ * \return NW_PWM_FATAL_ERR - The TCPWM counter initialization failed.
+ * \return NW_PWM_SUCCESS - The PWM channel is configured and ready to be started.
+ */
+NexaWattPWMStatusResult NexaWatt_Hal_Infineon_Cat1B_Pwm_Init_Channel(uint8 channel, const NexaWattPWMChannelConfig* channelConfig);
+
+/**
+ * \brief HAL function that can be used to de-initialize an already configured PWM channel.
+ * The TCPWM counter is disabled and its registers are reset to their default values.
+ * \param channel - The number of the PWM channel to be de-initialized.
+ * \return NW_PWM_BAD_PARAM - The provided channel number does not exist for the Infineon CAT1B device.
+ * \return NW_PWM_SUCCESS - The PWM channel is de-initialized.
+ */
+NexaWattPWMStatusResult NexaWatt_Hal_Infineon_Cat1B_Pwm_DeInit_Channel(uint8 channel);
+
+/**
+ * \brief HAL function that can be used to change the period of a PWM channel. The period is written to
+ * the buffer register and applied at the terminal count.
+ * \param channel - The number of the PWM channel.
+ * \param periodTicks - The new period in counter ticks.
+ * \return NW_PWM_BAD_PARAM - The provided channel number or period is invalid for the Infineon CAT1B device.
+ * \return NW_PWM_SUCCESS - The period is set.
+ */
+NexaWattPWMStatusResult NexaWatt_Hal_Infineon_Cat1B_Pwm_Set_Period(uint8 channel, NwPwmTicks periodTicks);
+
+/**
+ * \brief HAL function that can be used to set the phase shift of a stopped PWM channel by preloading its counter.
+ * \param channel - The number of the PWM channel.
+ * \param phaseTicks - The phase shift in counter ticks. Must be lower than the period.
+ * \return NW_PWM_BAD_PARAM - The provided channel number does not exist for the Infineon CAT1B device.
+ * \return NW_PWM_SUCCESS - The counter is preloaded.
+ */
+NexaWattPWMStatusResult NexaWatt_Hal_Infineon_Cat1B_Pwm_Set_Phase(uint8 channel, NwPwmTicks phaseTicks);
+
+/**
+ * \brief HAL function that can be used to set the dead times of the main and complementary PWM outputs.
+ * \param channel - The number of the PWM channel.
+ * \param deadTimeRiseTicks - The dead time of the main output in counter ticks.
+ * \param deadTimeFallTicks - The dead time of the complementary output in counter ticks.
+ * \return NW_PWM_BAD_PARAM - The provided channel number or dead time is invalid for the Infineon CAT1B device.
+ * \return NW_PWM_SUCCESS - The dead times are set.
+ */
+NexaWattPWMStatusResult NexaWatt_Hal_Infineon_Cat1B_Pwm_Set_Dead_Time(uint8 channel, NwPwmTicks deadTimeRiseTicks, NwPwmTicks deadTimeFallTicks);
+
+/**
+ * \brief HAL function that can be used to start several PWM channels. The channels are started by a single
+ * masked start trigger, so the channels with the same period are synchronized.
+ * \param channelMask - The mask of the PWM channels to be started.
+ * \return NW_PWM_BAD_PARAM - The mask contains channels, which do not exist for the Infineon CAT1B device.
+ * \return NW_PWM_SUCCESS - The PWM channels are started.
+ */
+NexaWattPWMStatusResult NexaWatt_Hal_Infineon_Cat1B_Pwm_Start(NwPwmChannelMask channelMask);
+
+/**
+ * \brief HAL function that can be used to stop several PWM channels.
+ * \param channelMask - The mask of the PWM channels to be stopped.
+ * \return NW_PWM_BAD_PARAM - The mask contains channels, which do not exist for the Infineon CAT1B device.
+ * \return NW_PWM_SUCCESS - The PWM channels are stopped.
+ */
+NexaWattPWMStatusResult NexaWatt_Hal_Infineon_Cat1B_Pwm_Stop(NwPwmChannelMask channelMask);
+
+/**
+ * \brief HAL function that transfers the staged compare values to the buffered compare registers and
+ * requests the compare swap of the staged channels. Only the staged channels are accessed: the write
+ * cost is a single buffer write per changed channel and one masked swap trigger for all of them, issued
+ * after the last buffer write, so all staged channels take their new compare values in the same period.
+ * The function performs no validation of the provided parameters and can be used in the control ISR.
+ * \param compareValues - A pointer to the compare values of all channels, indexed by the channel number.
+ * \param channelMask - The mask of the channels, whose compare values are staged.
+ */
+void NexaWatt_Hal_Infineon_Cat1B_Pwm_Commit(const NwPwmTicks* compareValues, NwPwmChannelMask channelMask);
+
+/**
+ * \brief HAL function that returns the time elapsed since the start of the current period of a PWM channel,
+ * i.e. since its terminal count, which is signalled on the first output trigger of the counter.
+ * Used by the other CAT1B HAL implementations to measure latencies against the PWM period.
+ * A left-aligned counter counts up, so the elapsed time is the counter value. A center-aligned counter
+ * counts down in the second half of the period, so the elapsed time is twice the period minus the counter value.
+ * The function performs no validation of the provided parameters and can be used in interrupt context.
+ * \param channel - The number of the PWM channel.
+ * \return The elapsed time in counter ticks.
+ */
+NwPwmTicks NexaWatt_Hal_Infineon_Cat1B_Pwm_Get_Elapsed_Ticks(uint8 channel);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+//#endif
+#endif
@@ -0,0 +1,89 @@
+/*******************************************************************************
+* File Name:   hal_infineon_cat1b_serial.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the HAL implementation for the serial buses (SPI and I2C) of the Infineon CAT1B devices.
+* The NexaWatt-IV.DC framework offers custom implemented HAL for several Infineon devices.
+* The implementation of the current HAL is dependent on the PDL, provided by Infineon Technologies.
+* The buses are mapped to SCB blocks. SPI transfers are moved between the memory and the SCB FIFOs
+* by two DataWire channels per bus, so a transfer costs a single interrupt, on the completion of the
+* receive channel. I2C transfers use the interrupt-driven master of the PDL, since the I2C protocol
+* (address phase, acknowledge, repeated start) requires the SCB state machine of the PDL.
+* The SCB clocks, the pins and the routing of the SCB FIFO triggers to the DataWire channels are assigned
+* with the device configurator, as part of the BSP initialization.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_HAL_INFINEON_CAT1B_SERIAL_H
+#define NEXAWATT_IV_DC_HAL_INFINEON_CAT1B_SERIAL_H
+
+// TODO: Uncomment the pre-processor defence after development
+// Prevents the compilation of the HAL Implementation in case of missing PDL
+//#ifdef CY_SCB_COMMON_H
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief HAL function that provides serial bus initialization using the framework standardized
+ * configuration structures and types. The function performs validation of the provided bus configuration
+ * and initializes the SCB block as SPI or I2C master, its DataWire channels (SPI) and its interrupts.
+ * \param bus - The number of the configured serial bus.
+ * \param busConfig - A pointer, containing the framework's standardized serial bus configuration structure.
+ * \param transferHandler - The handler executed in the interrupt context on the completion of a transfer.
+ * \return NW_SERIAL_BAD_PARAM - The validation of the provided bus configuration failed (e.g. bit rate not achievable with the SCB clock).
+ * \return NW_SERIAL_FATAL_ERR - The SCB, DataWire or interrupt initialization failed.
+ * \return NW_SERIAL_SUCCESS - The bus is configured and ready for transfers.
+ */
+NexaWattSerialStatusResult NexaWatt_Hal_Infineon_Cat1B_Serial_Init_Bus(uint8 bus, const NexaWattSerialBusConfig* busConfig, NwSerialHalTransferHandler transferHandler);
+
+/**
+ * \brief HAL function that de-initializes a serial bus. The SCB block and its DataWire channels are disabled and the interrupts released.
+ * \param bus - The number of the bus.
+ * \return NW_SERIAL_BAD_PARAM - The provided bus number does not exist for the Infineon CAT1B device.
+ * \return NW_SERIAL_SUCCESS - The bus is de-initialized.
+ */
+NexaWattSerialStatusResult NexaWatt_Hal_Infineon_Cat1B_Serial_DeInit_Bus(uint8 bus);
+
+/**
+ * \brief HAL function that starts a transfer and returns without waiting for it.
+ * The transfer handler is executed on its completion. Can be used in interrupt context.
+ * \param bus - The number of the bus.
+ * \param transfer - A pointer to the transfer. The transfer and its buffers must stay valid until its completion.
+ * \return NW_SERIAL_BAD_PARAM - The bus is not initialized, the transfer is empty or too long for the DataWire descriptors.
+ * \return NW_SERIAL_BUSY - A transfer is already active on the bus.
+ * \return NW_SERIAL_BUS_ERR - The SCB rejected the start of the transfer.
+ * \return NW_SERIAL_SUCCESS - The transfer is started.
+ */
+NexaWattSerialStatusResult NexaWatt_Hal_Infineon_Cat1B_Serial_Start_Transfer(uint8 bus, const NexaWattSerialTransfer* transfer);
+
+/**
+ * \brief HAL function that aborts the active transfer of a bus. The transfer handler is not executed for the aborted transfer.
+ * \param bus - The number of the bus.
+ */
+void NexaWatt_Hal_Infineon_Cat1B_Serial_Abort(uint8 bus);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+//#endif
+#endif
@@ -0,0 +1,108 @@
+/*******************************************************************************
+* File Name:   hal_infineon_cat1b_timer.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the HAL implementation for the hardware timers of the Infineon CAT1B devices.
+* The NexaWatt-IV.DC framework offers custom implemented HAL for several Infineon devices.
+* The implementation of the current HAL is dependent on the PDL, provided by Infineon Technologies.
+* The timers are mapped to the 32-bit counters of the TCPWM group 1, running in counter mode.
+* The counter clock is assigned with the device configurator, as part of the BSP initialization,
+* and the timer frequency is derived from it by the prescaler of the counter.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_HAL_INFINEON_CAT1B_TIMER_H
+#define NEXAWATT_IV_DC_HAL_INFINEON_CAT1B_TIMER_H
+
+// TODO: Uncomment the pre-processor defence after development
+// Prevents the compilation of the HAL Implementation in case of missing PDL
+//#ifdef CY_TCPWM_COUNTER_H
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief HAL function that provides timer initialization using the framework standardized
+ * configuration structures and types. The function performs validation of the provided timer configuration
+ * and initializes the TCPWM counter as a continuous up-counter with the terminal count interrupt.
+ * The frequency of the configuration must be the counter clock, divided by a power of two up to 128. The counter is left stopped.
+ * \param timer - The number of the configured timer.
+ * \param timerConfig - A pointer, containing the framework's standardized timer configuration structure.
+ * \return NW_TIMER_BAD_PARAM - The validation of the provided timer configuration failed or the frequency cannot be derived from the counter clock.
+ * \return NW_TIMER_FATAL_ERR - The TCPWM counter or interrupt initialization failed.
+ * \return NW_TIMER_SUCCESS - The timer is configured and ready to be started.
+ */
+NexaWattTimerStatusResult NexaWatt_Hal_Infineon_Cat1B_Timer_Init(uint8 timer, const NexaWattTimerConfig* timerConfig);
+
+/**
+ * \brief HAL function that de-initializes a timer. The TCPWM counter is disabled and its interrupt disabled.
+ * \param timer - The number of the timer.
+ * \return NW_TIMER_BAD_PARAM - The provided timer number does not exist for the Infineon CAT1B device.
+ * \return NW_TIMER_SUCCESS - The timer is de-initialized.
+ */
+NexaWattTimerStatusResult NexaWatt_Hal_Infineon_Cat1B_Timer_DeInit(uint8 timer);
+
+/**
+ * \brief HAL function that starts a timer.
+ * \param timer - The number of the timer.
+ * \return NW_TIMER_BAD_PARAM - The provided timer number does not exist for the Infineon CAT1B device.
+ * \return NW_TIMER_SUCCESS - The timer is started.
+ */
+NexaWattTimerStatusResult NexaWatt_Hal_Infineon_Cat1B_Timer_Start(uint8 timer);
+
+/**
+ * \brief HAL function that stops a timer.
+ * \param timer - The number of the timer.
+ * \return NW_TIMER_BAD_PARAM - The provided timer number does not exist for the Infineon CAT1B device.
+ * \return NW_TIMER_SUCCESS - The timer is stopped.
+ */
+NexaWattTimerStatusResult NexaWatt_Hal_Infineon_Cat1B_Timer_Stop(uint8 timer);
+
+/**
+ * \brief HAL function that reads the counter of a timer.
+ * The function performs no validation of the provided parameters and can be used in interrupt context.
+ * \param timer - The number of the timer.
+ * \return The current counter value.
+ */
+NwTimerTicks NexaWatt_Hal_Infineon_Cat1B_Timer_Read_Counter(uint8 timer);
+
+/**
+ * \brief HAL function that reads the terminal count status of a timer.
+ * The function performs no validation of the provided parameters and can be used in interrupt context.
+ * \param timer - The number of the timer.
+ * \return nwTrue - The terminal count was reached since the last clear.
+ * \return nwFalse - The terminal count was not reached since the last clear.
+ */
+nw_bool NexaWatt_Hal_Infineon_Cat1B_Timer_Get_Overflow_Status(uint8 timer);
+
+/**
+ * \brief HAL function that clears the terminal count status of a timer.
+ * The function performs no validation of the provided parameters and can be used in interrupt context.
+ * \param timer - The number of the timer.
+ */
+void NexaWatt_Hal_Infineon_Cat1B_Timer_Clear_Overflow_Status(uint8 timer);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+//#endif
+#endif
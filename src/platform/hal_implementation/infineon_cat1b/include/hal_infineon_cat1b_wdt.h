@@ -0,0 +1,70 @@
+/*******************************************************************************
+* File Name:   hal_infineon_cat1b_wdt.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the HAL implementation for the hardware watchdog of the Infineon CAT1B devices.
+* The NexaWatt-IV.DC framework offers custom implemented HAL for several Infineon devices.
+* The implementation of the current HAL is dependent on the PDL, provided by Infineon Technologies.
+* The watchdog is the free-running WDT of the SRSS, clocked by the ILO. The device is
+* reset after several unserviced matches of the counter, so the match period is a
+* fraction of the configured timeout.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_HAL_INFINEON_CAT1B_WDT_H
+#define NEXAWATT_IV_DC_HAL_INFINEON_CAT1B_WDT_H
+
+// TODO: Uncomment the pre-processor defence after development
+// Prevents the compilation of the HAL Implementation in case of missing PDL
+//#ifdef CY_WDT_H
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief HAL function that provides watchdog initialization using the framework standardized
+ * configuration structures and types. The function converts the timeout into the match period of the WDT,
+ * enables the WDT and locks its configuration.
+ * \param wdtConfig - A pointer, containing the framework's standardized watchdog configuration structure.
+ * \return NW_WDT_BAD_PARAM - The pointer is NULL or the timeout cannot be reached with the WDT counter.
+ * \return NW_WDT_FATAL_ERR - The WDT did not start.
+ * \return NW_WDT_SUCCESS - The WDT is running.
+ */
+NexaWattWdtStatusResult NexaWatt_Hal_Infineon_Cat1B_Wdt_Init(const NexaWattWdtConfig* wdtConfig);
+
+/**
+ * \brief HAL function that kicks the WDT. Can be used in interrupt context.
+ */
+void NexaWatt_Hal_Infineon_Cat1B_Wdt_Kick(void);
+
+/**
+ * \brief HAL function that checks whether the last reset of the device was caused by the WDT.
+ * \return nwTrue - The reset reason of the device contains the WDT reset.
+ * \return nwFalse - The last reset had another cause.
+ */
+nw_bool NexaWatt_Hal_Infineon_Cat1B_Wdt_Get_Reset_Status(void);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+//#endif
+#endif
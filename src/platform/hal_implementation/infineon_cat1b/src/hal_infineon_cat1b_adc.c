@@ -0,0 +1,449 @@
+/*******************************************************************************
+* File Name:   hal_infineon_cat1b_adc.c
+*
+* Description: This is the source file containing definitions,
+* related to the HAL implementation for the ADC peripheral of the Infineon CAT1B devices.
+* The NexaWatt-IV.DC framework offers custom implemented HAL for several Infineon devices.
+* The implementation of the current HAL is dependent on the PDL, provided by Infineon Technologies.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+// TODO: Uncomment the pre-processor defence after development
+// Prevents the compilation of the HAL Implementation in case of missing PDL
+//#ifdef CY_HPPASS_H
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "hal_infineon_cat1b_adc.h"
+#include "hal_infineon_cat1b_intr.h"
+#include "hal_infineon_cat1b_pwm.h"
+#include "cy_hppass.h"
+#include "cy_dma.h"
+#include "cy_trigmux.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Number of SAR ADC channels (direct and multiplexed) of the HPPASS for Infineon CAT1B devices.
+ */
+#define NW_HAL_INFINEON_CAT1B_ADC_SAR_CHANNEL_CNT       (28u)
+
+/**
+ * \brief Samplers of the SAR ADC. The channels 0 to 11 are sampled by their direct samplers; the channels 12 to 27
+ * are the inputs of the four multiplexed samplers, four consecutive channels per sampler.
+ */
+#define NW_HAL_INFINEON_CAT1B_ADC_DIR_SAMP_CNT          (12u)
+#define NW_HAL_INFINEON_CAT1B_ADC_MUX_SAMP_CNT          (4u)
+#define NW_HAL_INFINEON_CAT1B_ADC_MUX_INPUT_CNT         (4u)
+
+NW_STATIC_ASSERT((NW_HAL_INFINEON_CAT1B_ADC_DIR_SAMP_CNT + (NW_HAL_INFINEON_CAT1B_ADC_MUX_SAMP_CNT * NW_HAL_INFINEON_CAT1B_ADC_MUX_INPUT_CNT)) ==
+                 NW_HAL_INFINEON_CAT1B_ADC_SAR_CHANNEL_CNT, adc_sar_channel_cnt);
+
+/**
+ * \brief Macros returning the multiplexed sampler of a channel and its input of the sampler.
+ */
+#define NW_HAL_INFINEON_CAT1B_ADC_GET_MUX_SAMP(channel) \
+    (((channel) - NW_HAL_INFINEON_CAT1B_ADC_DIR_SAMP_CNT) / NW_HAL_INFINEON_CAT1B_ADC_MUX_INPUT_CNT)
+#define NW_HAL_INFINEON_CAT1B_ADC_GET_MUX_INPUT(channel) \
+    (((channel) - NW_HAL_INFINEON_CAT1B_ADC_DIR_SAMP_CNT) % NW_HAL_INFINEON_CAT1B_ADC_MUX_INPUT_CNT)
+
+/**
+ * \brief HPPASS SAR sequencer group executing the sequence.
+ */
+#define NW_HAL_INFINEON_CAT1B_ADC_GROUP_IDX             (0u)
+
+/**
+ * \brief Timeout of the HPPASS startup, executed by its autonomous controller.
+ */
+#define NW_HAL_INFINEON_CAT1B_ADC_STARTUP_TIMEOUT_US    (1000u)
+
+/**
+ * \brief Depth of the HPPASS result FIFO, limiting the number of conversions in a sequence.
+ */
+#define NW_HAL_INFINEON_CAT1B_ADC_FIFO_DEPTH            (16u)
+
+/**
+ * \brief Number of PWM channels, which can trigger the sequence.
+ */
+#define NW_HAL_INFINEON_CAT1B_ADC_PWM_CHANNEL_CNT       (8u)
+
+/**
+ * \brief HPPASS result FIFO, the sequencer group writes to.
+ */
+#define NW_HAL_INFINEON_CAT1B_ADC_FIFO_IDX              (0u)
+
+/**
+ * \brief HPPASS trigger of the sequencer group. The trigger is set by firmware or by the hardware trigger input,
+ * which is connected to the first output trigger of the selected PWM channel.
+ */
+#define NW_HAL_INFINEON_CAT1B_ADC_GROUP_TRIGGER         (CY_HPPASS_SAR_TRIG_0)
+#define NW_HAL_INFINEON_CAT1B_ADC_FW_TRIGGER_MASK       (CY_HPPASS_TRIG_0_MSK)
+#define NW_HAL_INFINEON_CAT1B_ADC_HW_TRIGGER_IDX        (0u)
+
+/**
+ * \brief Trigger multiplexer lines: the HPPASS trigger input 0, and the FIFO level trigger and the DataWire trigger input.
+ */
+#define NW_HAL_INFINEON_CAT1B_ADC_TRIG_OUT_HPPASS       (TRIG_OUT_MUX_8_HPPASS_TR_ADC_IN0)
+#define NW_HAL_INFINEON_CAT1B_ADC_TRIG_IN_FIFO_LEVEL    (TRIG_IN_MUX_0_HPPASS_TR_FIFO_LEVEL0)
+#define NW_HAL_INFINEON_CAT1B_ADC_TRIG_OUT_DMA          (TRIG_OUT_MUX_0_PDMA0_TR_IN0)
+
+/**
+ * \brief DataWire instance and channel, moving the FIFO content into the sample frames.
+ */
+#define NW_HAL_INFINEON_CAT1B_ADC_DMA_BASE              (DW0)
+#define NW_HAL_INFINEON_CAT1B_ADC_DMA_CHANNEL           (0u)
+#define NW_HAL_INFINEON_CAT1B_ADC_DMA_INTR_SRC          (cpuss_interrupts_dw0_0_IRQn)
+
+/**
+ * \brief Address of the FIFO read register. Every read pops one result of the sequence.
+ */
+#define NW_HAL_INFINEON_CAT1B_ADC_FIFO_RD_ADDR \
+    ((const void*)&HPPASS_SAR_FIFO_RD_DATA(HPPASS_BASE, NW_HAL_INFINEON_CAT1B_ADC_FIFO_IDX))
+
+/**
+ * \brief Number of descriptors (sample frames) used by the DataWire channel.
+ */
+#define NW_HAL_INFINEON_CAT1B_ADC_DESCRIPTOR_CNT        (2u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+/**
+ * \brief State of the ADC sequence, required by the DataWire interrupt.
+ */
+typedef struct sNexaWattCat1BAdcSequence
+{
+    NwAdcHalFrameHandler frameHandler;
+    NexaWattADCTriggerSource triggerSource;
+    uint8 triggerPwmChannel;
+    uint8 activeBufferIdx;
+    NexaWattIntrInitConfig intrConfig;
+} NexaWattCat1BAdcSequence;
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+static cy_stc_dma_descriptor_t adcDmaDescriptors[NW_HAL_INFINEON_CAT1B_ADC_DESCRIPTOR_CNT];
+static NexaWattCat1BAdcSequence adcSequence;
+
+/**
+ * \brief Array containing mapping between the PWM channel number (index) and the trigger multiplexer input
+ * of the first output trigger of its TCPWM counter (see the PWM channel mapping in hal_infineon_cat1b_pwm.c).
+ */
+static const uint32 adcPwmTriggerInMap[] =
+{
+    TRIG_IN_MUX_8_TCPWM_0_TR_OUT00,
+    TRIG_IN_MUX_8_TCPWM_0_TR_OUT01,
+    TRIG_IN_MUX_8_TCPWM_0_TR_OUT02,
+    TRIG_IN_MUX_8_TCPWM_0_TR_OUT03,
+    TRIG_IN_MUX_8_TCPWM_0_TR_OUT04,
+    TRIG_IN_MUX_8_TCPWM_0_TR_OUT05,
+    TRIG_IN_MUX_8_TCPWM_0_TR_OUT06,
+    TRIG_IN_MUX_8_TCPWM_0_TR_OUT07,
+};
+
+NW_STATIC_ASSERT((sizeof(adcPwmTriggerInMap) / sizeof(adcPwmTriggerInMap[0u])) == NW_HAL_INFINEON_CAT1B_ADC_PWM_CHANNEL_CNT, adc_pwm_trigger_map_size);
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function, performing validation of the provided sequence configuration.
+ * \param sequenceConfig - A pointer, containing the framework's standardized ADC sequence configuration structure.
+ * \return nwTrue - The provided sequence configuration is valid.
+ * \return nwFalse - The provided sequence configuration is invalid.
+ */
+NW_LOCAL_INLINE nw_bool NexaWatt_Hal_Infineon_Cat1B_Adc_Validate_User_Sequence_Config(const NexaWattADCSequenceConfig* sequenceConfig);
+
+/**
+ * \brief Simple helper function that programs the HPPASS for the sequence: the SAR sequencer group with the samplers
+ * of the channel list, its trigger and the FIFO level, which triggers the DataWire once per sequence.
+ * The trigger multiplexer routes are connected and the HPPASS is started.
+ * \param sequenceConfig - A pointer to the validated sequence configuration.
+ * \return nwTrue - The HPPASS is running and waits for the trigger of the sequence.
+ * \return nwFalse - The initialization or the startup of the HPPASS or a trigger route failed.
+ */
+static nw_bool NexaWatt_Hal_Infineon_Cat1B_Adc_Init_Hppass(const NexaWattADCSequenceConfig* sequenceConfig);
+
+/**
+ * \brief Interrupt handler of the DataWire channel, executed when a descriptor (sample frame) is completed.
+ * The handler reads the time elapsed in the period of the triggering PWM channel, which equals the trigger
+ * to handler latency, since the sequence is triggered at the start of the PWM period.
+ */
+static void NexaWatt_Hal_Infineon_Cat1B_Adc_Dma_Isr(void);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattADCStatusResult NexaWatt_Hal_Infineon_Cat1B_Adc_Init_Sequence(const NexaWattADCSequenceConfig* const sequenceConfig, NwAdcSample* const pingBuffer,
+                                                                      NwAdcSample* const pongBuffer, const NwAdcHalFrameHandler frameHandler)
+{
+    NexaWattADCStatusResult retRes = NW_ADC_BAD_PARAM;
+    cy_stc_dma_descriptor_config_t descriptorConfig;
+    cy_stc_dma_channel_config_t channelConfig;
+    NwAdcSample* const frameBuffers[NW_HAL_INFINEON_CAT1B_ADC_DESCRIPTOR_CNT] = { pingBuffer, pongBuffer };
+    cy_en_dma_status_t dmaStatus = CY_DMA_SUCCESS;
+    NexaWattIntrInitStatus intrInitStatus = NW_HAL_INTR_INIT_FAILED;
+    uint8 descriptorIdx = 0u;
+
+    nw_bool validationRes =
+            NexaWatt_Hal_Infineon_Cat1B_Adc_Validate_User_Sequence_Config(sequenceConfig);
+    if ((validationRes == nwTrue) &&
+        (pingBuffer != NULL) &&
+        (pongBuffer != NULL) &&
+        (frameHandler != NULL))
+    {
+        retRes = NW_ADC_FATAL_ERR;
+
+        // Each descriptor moves a complete sequence from the FIFO into its frame and chains to the other one
+        descriptorConfig.retrigger = CY_DMA_RETRIG_IM;
+        descriptorConfig.interruptType = CY_DMA_DESCR;
+        descriptorConfig.triggerOutType = CY_DMA_DESCR;
+        descriptorConfig.channelState = CY_DMA_CHANNEL_ENABLED;
+        descriptorConfig.triggerInType = CY_DMA_DESCR;
+        descriptorConfig.dataSize = CY_DMA_HALFWORD;
+        descriptorConfig.srcTransferSize = CY_DMA_TRANSFER_SIZE_WORD;
+        descriptorConfig.dstTransferSize = CY_DMA_TRANSFER_SIZE_DATA;
+        descriptorConfig.descriptorType = CY_DMA_1D_TRANSFER;
+        descriptorConfig.srcAddress = (void*)NW_HAL_INFINEON_CAT1B_ADC_FIFO_RD_ADDR;
+        descriptorConfig.srcXincrement = 0;
+        descriptorConfig.dstXincrement = 1;
+        descriptorConfig.xCount = sequenceConfig->channelCnt;
+        descriptorConfig.srcYincrement = 0;
+        descriptorConfig.dstYincrement = 0;
+        descriptorConfig.yCount = 1u;
+
+        for (descriptorIdx = 0u; (descriptorIdx < NW_HAL_INFINEON_CAT1B_ADC_DESCRIPTOR_CNT) && (dmaStatus == CY_DMA_SUCCESS); descriptorIdx++)
+        {
+            descriptorConfig.dstAddress = (void*)frameBuffers[descriptorIdx];
+            descriptorConfig.nextDescriptor = &adcDmaDescriptors[(descriptorIdx + 1u) % NW_HAL_INFINEON_CAT1B_ADC_DESCRIPTOR_CNT];
+            dmaStatus = Cy_DMA_Descriptor_Init(&adcDmaDescriptors[descriptorIdx], &descriptorConfig);
+        }
+
+        if (dmaStatus == CY_DMA_SUCCESS)
+        {
+            channelConfig.descriptor = &adcDmaDescriptors[0u];
+            channelConfig.preemptable = false;
+            channelConfig.priority = 0u;
+            channelConfig.enable = false;
+            channelConfig.bufferable = false;
+            dmaStatus = Cy_DMA_Channel_Init(NW_HAL_INFINEON_CAT1B_ADC_DMA_BASE, NW_HAL_INFINEON_CAT1B_ADC_DMA_CHANNEL, &channelConfig);
+        }
+
+        if ((dmaStatus == CY_DMA_SUCCESS) &&
+            (NexaWatt_Hal_Infineon_Cat1B_Adc_Init_Hppass(sequenceConfig) == nwTrue))
+        {
+            adcSequence.frameHandler = frameHandler;
+            adcSequence.triggerSource = sequenceConfig->triggerSource;
+            adcSequence.triggerPwmChannel = sequenceConfig->triggerPwmChannel;
+            adcSequence.activeBufferIdx = 0u;
+
+            adcSequence.intrConfig.intrSource = NW_HAL_INFINEON_CAT1B_ADC_DMA_INTR_SRC;
+            adcSequence.intrConfig.intrPriority = sequenceConfig->intrPriority;
+            adcSequence.intrConfig.intrHandlerPtr = NexaWatt_Hal_Infineon_Cat1B_Adc_Dma_Isr;
+
+            intrInitStatus =
+                    NexaWatt_Hal_Infineon_Cat1B_Intr_Init(&adcSequence.intrConfig);
+        }
+
+        if (intrInitStatus == NW_HAL_INTR_INIT_SUCCESS)
+        {
+            Cy_DMA_Channel_SetInterruptMask(NW_HAL_INFINEON_CAT1B_ADC_DMA_BASE, NW_HAL_INFINEON_CAT1B_ADC_DMA_CHANNEL, CY_DMA_INTR_MASK);
+            NexaWatt_Hal_Infineon_Cat1B_Intr_Enable(&adcSequence.intrConfig);
+            Cy_DMA_Enable(NW_HAL_INFINEON_CAT1B_ADC_DMA_BASE);
+
+            retRes = NW_ADC_SUCCESS;
+        }
+    }
+
+    return retRes;
+}
+
+NexaWattADCStatusResult NexaWatt_Hal_Infineon_Cat1B_Adc_DeInit_Sequence(void)
+{
+    Cy_DMA_Channel_Disable(NW_HAL_INFINEON_CAT1B_ADC_DMA_BASE, NW_HAL_INFINEON_CAT1B_ADC_DMA_CHANNEL);
+    Cy_DMA_Channel_SetInterruptMask(NW_HAL_INFINEON_CAT1B_ADC_DMA_BASE, NW_HAL_INFINEON_CAT1B_ADC_DMA_CHANNEL, 0u);
+    Cy_DMA_Channel_ClearInterrupt(NW_HAL_INFINEON_CAT1B_ADC_DMA_BASE, NW_HAL_INFINEON_CAT1B_ADC_DMA_CHANNEL);
+    NexaWatt_Hal_Infineon_Cat1B_Intr_Disable(&adcSequence.intrConfig);
+    Cy_DMA_Channel_DeInit(NW_HAL_INFINEON_CAT1B_ADC_DMA_BASE, NW_HAL_INFINEON_CAT1B_ADC_DMA_CHANNEL);
+    Cy_HPPASS_DeInit();
+
+    adcSequence.frameHandler = NULL;
+
+    return NW_ADC_SUCCESS;
+}
+
+NexaWattADCStatusResult NexaWatt_Hal_Infineon_Cat1B_Adc_Start(void)
+{
+    // Stale results would shift the sequence in the frames, so the FIFO is emptied before the channel is restarted
+    Cy_HPPASS_FIFO_Clear(NW_HAL_INFINEON_CAT1B_ADC_FIFO_IDX);
+
+    adcSequence.activeBufferIdx = 0u;
+    Cy_DMA_Channel_SetDescriptor(NW_HAL_INFINEON_CAT1B_ADC_DMA_BASE, NW_HAL_INFINEON_CAT1B_ADC_DMA_CHANNEL, &adcDmaDescriptors[0u]);
+    Cy_DMA_Channel_Enable(NW_HAL_INFINEON_CAT1B_ADC_DMA_BASE, NW_HAL_INFINEON_CAT1B_ADC_DMA_CHANNEL);
+
+    return NW_ADC_SUCCESS;
+}
+
+NexaWattADCStatusResult NexaWatt_Hal_Infineon_Cat1B_Adc_Stop(void)
+{
+    Cy_DMA_Channel_Disable(NW_HAL_INFINEON_CAT1B_ADC_DMA_BASE, NW_HAL_INFINEON_CAT1B_ADC_DMA_CHANNEL);
+    Cy_DMA_Channel_ClearInterrupt(NW_HAL_INFINEON_CAT1B_ADC_DMA_BASE, NW_HAL_INFINEON_CAT1B_ADC_DMA_CHANNEL);
+
+    return NW_ADC_SUCCESS;
+}
+
+void NexaWatt_Hal_Infineon_Cat1B_Adc_Software_Trigger(void)
+{
+    Cy_HPPASS_SetFwTrigger(NW_HAL_INFINEON_CAT1B_ADC_FW_TRIGGER_MASK);
+}
+
+static nw_bool NexaWatt_Hal_Infineon_Cat1B_Adc_Init_Hppass(const NexaWattADCSequenceConfig* const sequenceConfig)
+{
+    // The remaining fields of the HPPASS configuration (CSG, limits, FIR filters, other groups) are not used
+    cy_stc_hppass_sar_grp_t groupConfig = { 0 };
+    cy_stc_hppass_fifo_t fifoConfig = { 0 };
+    cy_stc_hppass_sar_t sarConfig = { 0 };
+    cy_stc_hppass_base_t baseConfig = { 0 };
+    cy_stc_hppass_cfg_t hppassConfig = { 0 };
+    cy_en_hppass_status_t hppassStatus = CY_HPPASS_BAD_PARAM;
+    cy_en_trigmux_status_t trigMuxStatus = CY_TRIGMUX_SUCCESS;
+    uint8 channelIdx = 0u;
+    uint8 channel = 0u;
+
+    // The group converts its direct samplers followed by its multiplexed samplers, both in ascending order,
+    // so the ascending channel list (see the validation) is also the order of the results in the FIFO
+    for (channelIdx = 0u; channelIdx < sequenceConfig->channelCnt; channelIdx++)
+    {
+        channel = sequenceConfig->channelList[channelIdx];
+        if (channel < NW_HAL_INFINEON_CAT1B_ADC_DIR_SAMP_CNT)
+        {
+            groupConfig.dirSampMsk |= (uint16)(0x01u << channel);
+        }
+        else
+        {
+            groupConfig.muxSampMsk |= (uint8)(0x01u << NW_HAL_INFINEON_CAT1B_ADC_GET_MUX_SAMP(channel));
+            groupConfig.muxChanIdx[NW_HAL_INFINEON_CAT1B_ADC_GET_MUX_SAMP(channel)] = (uint8)NW_HAL_INFINEON_CAT1B_ADC_GET_MUX_INPUT(channel);
+        }
+    }
+    groupConfig.trig = NW_HAL_INFINEON_CAT1B_ADC_GROUP_TRIGGER;
+    groupConfig.sampTime = CY_HPPASS_SAR_SAMP_TIME_0;
+
+    // The level event is raised when the FIFO holds more results than the level, i.e. once the sequence is complete
+    fifoConfig.config = CY_HPPASS_FIFO_1_32;
+    fifoConfig.level[NW_HAL_INFINEON_CAT1B_ADC_FIFO_IDX] = (uint8)(sequenceConfig->channelCnt - 1u);
+    fifoConfig.trigMsk = (uint8)(0x01u << NW_HAL_INFINEON_CAT1B_ADC_FIFO_IDX);
+
+    sarConfig.grp[NW_HAL_INFINEON_CAT1B_ADC_GROUP_IDX] = &groupConfig;
+    sarConfig.fifo = &fifoConfig;
+
+    // A PWM-triggered sequence is started by the rising edge of the routed terminal count
+    baseConfig.trigIn[NW_HAL_INFINEON_CAT1B_ADC_HW_TRIGGER_IDX] =
+            (sequenceConfig->triggerSource == NW_ADC_TRIGGER_PWM) ? CY_HPPASS_TR_HW_A : CY_HPPASS_TR_DISABLED;
+
+    hppassConfig.base = &baseConfig;
+    hppassConfig.sar = &sarConfig;
+
+    hppassStatus = Cy_HPPASS_Init(&hppassConfig);
+
+    if ((hppassStatus == CY_HPPASS_SUCCESS) &&
+        (sequenceConfig->triggerSource == NW_ADC_TRIGGER_PWM))
+    {
+        trigMuxStatus = Cy_TrigMux_Connect(adcPwmTriggerInMap[sequenceConfig->triggerPwmChannel], NW_HAL_INFINEON_CAT1B_ADC_TRIG_OUT_HPPASS,
+                                           false, TRIGGER_TYPE_EDGE);
+    }
+
+    if ((hppassStatus == CY_HPPASS_SUCCESS) &&
+        (trigMuxStatus == CY_TRIGMUX_SUCCESS))
+    {
+        trigMuxStatus = Cy_TrigMux_Connect(NW_HAL_INFINEON_CAT1B_ADC_TRIG_IN_FIFO_LEVEL, NW_HAL_INFINEON_CAT1B_ADC_TRIG_OUT_DMA,
+                                           false, TRIGGER_TYPE_LEVEL);
+    }
+
+    if ((hppassStatus == CY_HPPASS_SUCCESS) &&
+        (trigMuxStatus == CY_TRIGMUX_SUCCESS))
+    {
+        hppassStatus = Cy_HPPASS_AC_Start(0u, NW_HAL_INFINEON_CAT1B_ADC_STARTUP_TIMEOUT_US);
+    }
+
+    return ((hppassStatus == CY_HPPASS_SUCCESS) && (trigMuxStatus == CY_TRIGMUX_SUCCESS)) ? nwTrue : nwFalse;
+}
+
+static void NexaWatt_Hal_Infineon_Cat1B_Adc_Dma_Isr(void)
+{
+    // The counter is read first, so the measured latency does not include the frame handler
+    uint32 latencyTicks = (adcSequence.triggerSource == NW_ADC_TRIGGER_PWM) ?
+            NexaWatt_Hal_Infineon_Cat1B_Pwm_Get_Elapsed_Ticks(adcSequence.triggerPwmChannel) : 0u;
+    uint8 filledBufferIdx = adcSequence.activeBufferIdx;
+
+    Cy_DMA_Channel_ClearInterrupt(NW_HAL_INFINEON_CAT1B_ADC_DMA_BASE, NW_HAL_INFINEON_CAT1B_ADC_DMA_CHANNEL);
+    adcSequence.activeBufferIdx = filledBufferIdx ^ 0x01u;
+
+    if (adcSequence.frameHandler != NULL)
+    {
+        adcSequence.frameHandler(filledBufferIdx, latencyTicks);
+    }
+}
+
+NW_LOCAL_INLINE nw_bool NexaWatt_Hal_Infineon_Cat1B_Adc_Validate_User_Sequence_Config(const NexaWattADCSequenceConfig* const sequenceConfig)
+{
+    // The validation is performed in several logical branches to increase the code readability
+    // The compiler will optimize the below code
+    nw_bool validationRes = nwTrue;
+    uint32 usedMuxSampMsk = 0u;
+    uint8 channelIdx = 0u;
+    uint8 channel = 0u;
+
+    if ((sequenceConfig == NULL) ||
+        (sequenceConfig->channelList == NULL))
+    {
+        // Sequence configuration is not provided by the user
+        validationRes = nwFalse;
+    }
+    else if ((sequenceConfig->channelCnt == 0u) ||
+             (sequenceConfig->channelCnt > NW_HAL_INFINEON_CAT1B_ADC_FIFO_DEPTH))
+    {
+        // The sequence does not fit the result FIFO
+        validationRes = nwFalse;
+    }
+    else if ((sequenceConfig->triggerSource > NW_ADC_TRIGGER_PWM) ||
+             ((sequenceConfig->triggerSource == NW_ADC_TRIGGER_PWM) &&
+              (sequenceConfig->triggerPwmChannel >= NW_HAL_INFINEON_CAT1B_ADC_PWM_CHANNEL_CNT)))
+    {
+        // Invalid trigger source is provided
+        validationRes = nwFalse;
+    }
+    else
+    {
+        for (channelIdx = 0u; channelIdx < sequenceConfig->channelCnt; channelIdx++)
+        {
+            channel = sequenceConfig->channelList[channelIdx];
+            if (channel >= NW_HAL_INFINEON_CAT1B_ADC_SAR_CHANNEL_CNT)
+            {
+                // The channel does not exist for the SAR ADC
+                validationRes = nwFalse;
+            }
+            else if ((channelIdx > 0u) &&
+                     (channel <= sequenceConfig->channelList[channelIdx - 1u]))
+            {
+                // The results are written in the conversion order of the sequencer group, which is ascending
+                validationRes = nwFalse;
+            }
+            else if (channel >= NW_HAL_INFINEON_CAT1B_ADC_DIR_SAMP_CNT)
+            {
+                // A multiplexed sampler converts a single one of its inputs per sequence
+                if ((usedMuxSampMsk & (0x01u << NW_HAL_INFINEON_CAT1B_ADC_GET_MUX_SAMP(channel))) != 0u)
+                {
+                    validationRes = nwFalse;
+                }
+                usedMuxSampMsk |= (0x01u << NW_HAL_INFINEON_CAT1B_ADC_GET_MUX_SAMP(channel));
+            }
+        }
+    }
+
+    return validationRes;
+}
+//#endif
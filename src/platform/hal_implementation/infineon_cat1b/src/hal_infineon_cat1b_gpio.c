@@ -19,6 +19,10 @@
 #include "hal_infineon_cat1b_gpio.h"
 #include "hal_infineon_cat1b_intr.h"
 #include "cy_gpio.h"
+#include "hal_manager_resources.h"
+#ifdef NW_HAL_INFINEON_CAT1B_GPIO_REG_ACCESS
+#include "hal_infineon_cat1b_gpio_reg.h"
+#endif
 
 /*******************************************************************************
 * Macros
@@ -48,6 +52,31 @@
  */
 #define NW_HAL_INFINEON_CAT1B_GPIO_INTR_ENABLED_MASK   (0x01u)
 
+/**
+ * \brief Width and mask of the per-pin drive mode field of the GPIO port CFG register.
+ */
+#define NW_HAL_INFINEON_CAT1B_GPIO_CFG_FIELD_WIDTH      (4u)
+#define NW_HAL_INFINEON_CAT1B_GPIO_CFG_FIELD_MASK       (0x0Fu)
+
+/**
+ * \brief Width and mask of the per-pin edge field of the GPIO port INTR_CFG register.
+ */
+#define NW_HAL_INFINEON_CAT1B_GPIO_INTR_CFG_FIELD_WIDTH (2u)
+#define NW_HAL_INFINEON_CAT1B_GPIO_INTR_CFG_FIELD_MASK  (0x03u)
+
+/**
+ * \brief Position, width and mask of the per-pin drive select field of the GPIO port CFG_OUT register.
+ */
+#define NW_HAL_INFINEON_CAT1B_GPIO_DRIVE_SEL_POS        (16u)
+#define NW_HAL_INFINEON_CAT1B_GPIO_DRIVE_SEL_WIDTH      (2u)
+#define NW_HAL_INFINEON_CAT1B_GPIO_DRIVE_SEL_MASK       (0x03u)
+
+/**
+ * \brief Width of the per-pin field and number of pins of the HSIOM port select registers.
+ */
+#define NW_HAL_INFINEON_CAT1B_GPIO_HSIOM_FIELD_WIDTH    (8u)
+#define NW_HAL_INFINEON_CAT1B_GPIO_HSIOM_PINS_PER_REG   (4u)
+
 /**
  * \brief Macro returning the corresponding GPIO port base to a provided GPIO port number.
  */
@@ -66,6 +95,53 @@
 #define NW_HAL_INFINEON_CAT1B_GPIO_GET_PORT_INTR_SRC(portNum) \
     (interruptSourcesGpioMap[portNum])
 
+/**
+ * \brief Macros selecting the backend of the pin access functions. With NW_HAL_INFINEON_CAT1B_GPIO_REG_ACCESS defined,
+ * the registers of the GPIO port are accessed directly by the inline functions of hal_infineon_cat1b_gpio_reg.h,
+ * otherwise the PDL functions are called.
+ */
+#ifdef NW_HAL_INFINEON_CAT1B_GPIO_REG_ACCESS
+#define NW_HAL_INFINEON_CAT1B_GPIO_READ(portNum, pinNum) \
+    ((uint32)NexaWatt_Hal_Infineon_Cat1B_Gpio_Reg_Pin_Read(portNum, pinNum))
+#define NW_HAL_INFINEON_CAT1B_GPIO_READ_PORT(portNum) \
+    NexaWatt_Hal_Infineon_Cat1B_Gpio_Reg_Port_Read(portNum)
+#define NW_HAL_INFINEON_CAT1B_GPIO_WRITE_PORT(portNum, pinMask, value) \
+    NexaWatt_Hal_Infineon_Cat1B_Gpio_Reg_Port_Write(portNum, pinMask, value)
+#define NW_HAL_INFINEON_CAT1B_GPIO_WRITE(portNum, pinNum, value) \
+    NexaWatt_Hal_Infineon_Cat1B_Gpio_Reg_Pin_Write(portNum, pinNum, value)
+#define NW_HAL_INFINEON_CAT1B_GPIO_INV(portNum, pinNum) \
+    NexaWatt_Hal_Infineon_Cat1B_Gpio_Reg_Pin_Toggle(portNum, pinNum)
+#define NW_HAL_INFINEON_CAT1B_GPIO_GET_INTR_STATUS(portNum, pinNum) \
+    ((uint32)NexaWatt_Hal_Infineon_Cat1B_Gpio_Reg_Get_EXTI_Status(portNum, pinNum))
+#define NW_HAL_INFINEON_CAT1B_GPIO_CLEAR_INTR(portNum, pinNum) \
+    NexaWatt_Hal_Infineon_Cat1B_Gpio_Reg_Clear_EXTI_Status(portNum, pinNum)
+#else
+#define NW_HAL_INFINEON_CAT1B_GPIO_READ(portNum, pinNum) \
+    Cy_GPIO_Read(NW_HAL_INFINEON_CAT1B_GPIO_GET_PORT_BASE(portNum), pinNum)
+#define NW_HAL_INFINEON_CAT1B_GPIO_READ_PORT(portNum) \
+    ((uint8)GPIO_PRT_IN(NW_HAL_INFINEON_CAT1B_GPIO_GET_PORT_BASE(portNum)))
+#define NW_HAL_INFINEON_CAT1B_GPIO_WRITE_PORT(portNum, pinMask, value) \
+    do \
+    { \
+        if ((value) != nwFalse) \
+        { \
+            GPIO_PRT_OUT_SET(NW_HAL_INFINEON_CAT1B_GPIO_GET_PORT_BASE(portNum)) = (uint32)(pinMask); \
+        } \
+        else \
+        { \
+            GPIO_PRT_OUT_CLR(NW_HAL_INFINEON_CAT1B_GPIO_GET_PORT_BASE(portNum)) = (uint32)(pinMask); \
+        } \
+    } while (0)
+#define NW_HAL_INFINEON_CAT1B_GPIO_WRITE(portNum, pinNum, value) \
+    Cy_GPIO_Write(NW_HAL_INFINEON_CAT1B_GPIO_GET_PORT_BASE(portNum), pinNum, ((uint32)(value)))
+#define NW_HAL_INFINEON_CAT1B_GPIO_INV(portNum, pinNum) \
+    Cy_GPIO_Inv(NW_HAL_INFINEON_CAT1B_GPIO_GET_PORT_BASE(portNum), pinNum)
+#define NW_HAL_INFINEON_CAT1B_GPIO_GET_INTR_STATUS(portNum, pinNum) \
+    Cy_GPIO_GetInterruptStatus(NW_HAL_INFINEON_CAT1B_GPIO_GET_PORT_BASE(portNum), pinNum)
+#define NW_HAL_INFINEON_CAT1B_GPIO_CLEAR_INTR(portNum, pinNum) \
+    Cy_GPIO_ClearInterrupt(NW_HAL_INFINEON_CAT1B_GPIO_GET_PORT_BASE(portNum), pinNum)
+#endif
+
 /*******************************************************************************
 * Type definitions
 *******************************************************************************/
@@ -142,6 +218,14 @@ static uint32 interruptSourcesGpioMap[] =
     ioss_interrupts_sec_gpio_9_IRQn,
 };
 
+/**
+ * \brief The mapping tables are indexed by the validated port number; in NW_RELEASE_FAST builds the runtime
+ * functions rely on the callers, so the sizes of the tables and of the resource registry are checked at build time.
+ */
+NW_STATIC_ASSERT((sizeof(gpioPortBases) / sizeof(gpioPortBases[0u])) == NW_HAL_INFINEON_CAT1B_GPIO_PORT_CNT, gpio_port_bases_size);
+NW_STATIC_ASSERT((sizeof(interruptSourcesGpioMap) / sizeof(interruptSourcesGpioMap[0u])) == NW_HAL_INFINEON_CAT1B_GPIO_PORT_CNT, gpio_intr_sources_size);
+NW_STATIC_ASSERT(NW_HAL_INFINEON_CAT1B_GPIO_PORT_CNT <= NW_RESOURCE_MAX_PORTS, gpio_resource_ports);
+
 /*******************************************************************************
 * Local Function Prototypes
 *******************************************************************************/
@@ -218,12 +302,106 @@ NexaWattGPIOStatusResult NexaWatt_Hal_Infineon_Cat1B_Gpio_Init_Digital_Pin(const
     return retRes;
 }
 
+NexaWattGPIOStatusResult NexaWatt_Hal_Infineon_Cat1B_Gpio_Init_Port(const uint8 portNum, const uint8 pinMask, const NexaWattGPIOPinConfig* const pinConfigs)
+{
+    // Variables are declared in the beginning of the function to ensure constant memory usage
+    NexaWattGPIOStatusResult retRes = NW_GPIO_BAD_PARAM;
+    cy_stc_gpio_prt_config_t portConfig = { 0 };
+    GPIO_PRT_Type* portBase;
+    const NexaWattGPIOPinConfig* pinConfig;
+    nw_bool isUserConfigValid = nwTrue;
+    uint32 pinBit;
+    uint32 driveMode;
+    uint32 hsiom;
+    uint32 hsiomShift;
+    uint32 hsiomSel[2u] = {0x00u, 0x00u};
+    uint8 pinNum;
+
+    if ((pinConfigs == NULL) || (pinMask == 0u) ||
+        (NexaWatt_Hal_Infineon_Cat1B_Gpio_Validate_Port_And_Pin(portNum, 0u) == nwFalse))
+    {
+        isUserConfigValid = nwFalse;
+    }
+
+    // All selected pins are validated before the port is touched, so a bad entry leaves the port unmodified
+    for (pinNum = 0u; (pinNum < NW_HAL_INFINEON_CAT1B_GPIO_PORT_PIN_CNT) && (isUserConfigValid == nwTrue); pinNum++)
+    {
+        if ((pinMask & (0x01u << pinNum)) != 0u)
+        {
+            isUserConfigValid =
+                    NexaWatt_Hal_Infineon_Cat1B_Gpio_Validate_User_Pin_Config(portNum, pinNum, &pinConfigs[pinNum]);
+        }
+    }
+
+    if (isUserConfigValid == nwTrue)
+    {
+        portBase = NW_HAL_INFINEON_CAT1B_GPIO_GET_PORT_BASE(portNum);
+
+        // The current register image is the starting point, so the not selected pins keep their configuration
+        portConfig.out = GPIO_PRT_OUT(portBase);
+        portConfig.intrMask = GPIO_PRT_INTR_MASK(portBase);
+        portConfig.intrCfg = GPIO_PRT_INTR_CFG(portBase);
+        portConfig.cfg = GPIO_PRT_CFG(portBase);
+        portConfig.cfgIn = GPIO_PRT_CFG_IN(portBase);
+        portConfig.cfgOut = GPIO_PRT_CFG_OUT(portBase);
+        portConfig.cfgSIO = GPIO_PRT_CFG_SIO(portBase);
+
+        for (pinNum = 0u; pinNum < NW_HAL_INFINEON_CAT1B_GPIO_PORT_PIN_CNT; pinNum++)
+        {
+            pinBit = (0x01u << pinNum);
+            hsiomShift = (pinNum % NW_HAL_INFINEON_CAT1B_GPIO_HSIOM_PINS_PER_REG) * NW_HAL_INFINEON_CAT1B_GPIO_HSIOM_FIELD_WIDTH;
+
+            if ((pinMask & pinBit) != 0u)
+            {
+                pinConfig = &pinConfigs[pinNum];
+                driveMode = (pinConfig->direction == NW_GPIO_INPUT) ?
+                            inputDriveModesMap[pinConfig->driveMode] : outputDriveModesMap[pinConfig->driveMode];
+                hsiom = pinConfig->altFunction;
+
+                portConfig.out = (pinConfig->initVal == nwFalse) ?
+                                 (portConfig.out & ~pinBit) : (portConfig.out | pinBit);
+                portConfig.intrMask &= ~pinBit;
+                portConfig.intrCfg &= ~(NW_HAL_INFINEON_CAT1B_GPIO_INTR_CFG_FIELD_MASK <<
+                                        (pinNum * NW_HAL_INFINEON_CAT1B_GPIO_INTR_CFG_FIELD_WIDTH));
+                portConfig.cfg &= ~(NW_HAL_INFINEON_CAT1B_GPIO_CFG_FIELD_MASK <<
+                                    (pinNum * NW_HAL_INFINEON_CAT1B_GPIO_CFG_FIELD_WIDTH));
+                portConfig.cfg |= ((driveMode & NW_HAL_INFINEON_CAT1B_GPIO_CFG_FIELD_MASK) <<
+                                   (pinNum * NW_HAL_INFINEON_CAT1B_GPIO_CFG_FIELD_WIDTH));
+                // CMOS input threshold
+                portConfig.cfgIn &= ~pinBit;
+                portConfig.cfgOut = ((uint32)pinConfig->driveSpeed == 0u) ?
+                                    (portConfig.cfgOut & ~pinBit) : (portConfig.cfgOut | pinBit);
+                portConfig.cfgOut &= ~(NW_HAL_INFINEON_CAT1B_GPIO_DRIVE_SEL_MASK <<
+                                       (NW_HAL_INFINEON_CAT1B_GPIO_DRIVE_SEL_POS + (pinNum * NW_HAL_INFINEON_CAT1B_GPIO_DRIVE_SEL_WIDTH)));
+                portConfig.cfgOut |= (((uint32)pinConfig->driveStrength & NW_HAL_INFINEON_CAT1B_GPIO_DRIVE_SEL_MASK) <<
+                                      (NW_HAL_INFINEON_CAT1B_GPIO_DRIVE_SEL_POS + (pinNum * NW_HAL_INFINEON_CAT1B_GPIO_DRIVE_SEL_WIDTH)));
+            }
+            else
+            {
+                hsiom = Cy_GPIO_GetHSIOM(portBase, pinNum);
+            }
+
+            hsiomSel[pinNum / NW_HAL_INFINEON_CAT1B_GPIO_HSIOM_PINS_PER_REG] |= (hsiom << hsiomShift);
+        }
+
+        portConfig.sel0Active = hsiomSel[0u];
+        portConfig.sel1Active = hsiomSel[1u];
+
+        if (Cy_GPIO_Port_Init(portBase, &portConfig) == CY_GPIO_SUCCESS)
+        {
+            retRes = NW_GPIO_SUCCESS;
+        }
+    }
+
+    return retRes;
+}
+
 NexaWattGPIOStatusResult NexaWatt_Hal_Infineon_Cat1B_Gpio_Set_Pin_Alt_Functions(const uint8 portNum, const uint8 pinNum, const NwGpioPinAltFunction altFunction)
 {
     NexaWattGPIOStatusResult retRes = NW_GPIO_BAD_PARAM;
 
     nw_bool gpioPinExists =
-            NexaWatt_Hal_Infineon_Cat1B_Gpio_Validate_Port_And_Pin(portNum, pinNum);
+            NW_RUNTIME_CHECK(NexaWatt_Hal_Infineon_Cat1B_Gpio_Validate_Port_And_Pin(portNum, pinNum));
     if (gpioPinExists == nwTrue)
     {
         Cy_GPIO_SetHSIOM(NW_HAL_INFINEON_CAT1B_GPIO_GET_PORT_BASE(portNum), pinNum, altFunction);
@@ -256,11 +434,11 @@ NwGpioPinResult NexaWatt_Hal_Infineon_Cat1B_Gpio_Pin_Read(const uint8 portNum, c
     uint32 gpioPinRegRes = 0u;
 
     nw_bool gpioPinExists =
-            NexaWatt_Hal_Infineon_Cat1B_Gpio_Validate_Port_And_Pin(portNum, pinNum);
+            NW_RUNTIME_CHECK(NexaWatt_Hal_Infineon_Cat1B_Gpio_Validate_Port_And_Pin(portNum, pinNum));
     if (gpioPinExists == nwTrue)
     {
         // Defensive programming in case the PDL returns unexpected value that can't be safely cast
-        gpioPinRegRes = Cy_GPIO_Read(NW_HAL_INFINEON_CAT1B_GPIO_GET_PORT_BASE(portNum), pinNum);
+        gpioPinRegRes = NW_HAL_INFINEON_CAT1B_GPIO_READ(portNum, pinNum);
         if (gpioPinRegRes == 1)
         {
             pinRes = nwTrue;
@@ -270,15 +448,45 @@ NwGpioPinResult NexaWatt_Hal_Infineon_Cat1B_Gpio_Pin_Read(const uint8 portNum, c
     return pinRes;
 }
 
+uint8 NexaWatt_Hal_Infineon_Cat1B_Gpio_Port_Read(const uint8 portNum)
+{
+    uint8 portRes = 0u;
+
+    nw_bool gpioPortExists =
+            NW_RUNTIME_CHECK(NexaWatt_Hal_Infineon_Cat1B_Gpio_Validate_Port_And_Pin(portNum, 0u));
+    if (gpioPortExists == nwTrue)
+    {
+        portRes = NW_HAL_INFINEON_CAT1B_GPIO_READ_PORT(portNum);
+    }
+
+    return portRes;
+}
+
+NexaWattGPIOStatusResult NexaWatt_Hal_Infineon_Cat1B_Gpio_Port_Write(const uint8 portNum, const uint8 pinMask, const nw_bool value)
+{
+    NexaWattGPIOStatusResult retRes = NW_GPIO_BAD_PARAM;
+
+    nw_bool gpioPortExists =
+            NW_RUNTIME_CHECK(NexaWatt_Hal_Infineon_Cat1B_Gpio_Validate_Port_And_Pin(portNum, 0u));
+    if (gpioPortExists == nwTrue)
+    {
+        NW_HAL_INFINEON_CAT1B_GPIO_WRITE_PORT(portNum, pinMask, value);
+
+        retRes = NW_GPIO_SUCCESS;
+    }
+
+    return retRes;
+}
+
 NexaWattGPIOStatusResult NexaWatt_Hal_Infineon_Cat1B_Gpio_Pin_Write(const uint8 portNum, const uint8 pinNum, const nw_bool value)
 {
     NexaWattGPIOStatusResult retRes = NW_GPIO_BAD_PARAM;
 
     nw_bool gpioPinExists =
-            NexaWatt_Hal_Infineon_Cat1B_Gpio_Validate_Port_And_Pin(portNum, pinNum);
+            NW_RUNTIME_CHECK(NexaWatt_Hal_Infineon_Cat1B_Gpio_Validate_Port_And_Pin(portNum, pinNum));
     if (gpioPinExists == nwTrue)
     {
-        Cy_GPIO_Write(NW_HAL_INFINEON_CAT1B_GPIO_GET_PORT_BASE(portNum), pinNum, ((uint32)value));
+        NW_HAL_INFINEON_CAT1B_GPIO_WRITE(portNum, pinNum, value);
 
         retRes = NW_GPIO_SUCCESS;
     }
@@ -291,10 +499,10 @@ NexaWattGPIOStatusResult NexaWatt_Hal_Infineon_Cat1B_Gpio_Pin_Toggle(const uint8
     NexaWattGPIOStatusResult retRes = NW_GPIO_BAD_PARAM;
 
     nw_bool gpioPinExists =
-            NexaWatt_Hal_Infineon_Cat1B_Gpio_Validate_Port_And_Pin(portNum, pinNum);
+            NW_RUNTIME_CHECK(NexaWatt_Hal_Infineon_Cat1B_Gpio_Validate_Port_And_Pin(portNum, pinNum));
     if (gpioPinExists == nwTrue)
     {
-        Cy_GPIO_Inv(NW_HAL_INFINEON_CAT1B_GPIO_GET_PORT_BASE(portNum), pinNum);
+        NW_HAL_INFINEON_CAT1B_GPIO_INV(portNum, pinNum);
 
         retRes = NW_GPIO_SUCCESS;
     }
@@ -313,8 +521,17 @@ NexaWattGPIOStatusResult NexaWatt_Hal_Infineon_Cat1B_Gpio_Register_EXTI(const ui
             NexaWatt_Hal_Infineon_Cat1B_Gpio_Validate_Port_And_Pin(portNum, pinNum);
     if ((gpioPinExists == nwTrue) &&
         (extiConfig != NULL) &&
-        (extiConfig->intrEdge <= NW_EXTI_BOTH_EDGES) &&
-        (extiConfig->isrHandlerPtr != NULL))
+        (extiConfig->intrEdge != NW_EXTI_DISABLE) &&
+        (NexaWatt_HalManager_Resources_Is_Irq_Claimed(NW_HAL_INFINEON_CAT1B_GPIO_GET_PORT_INTR_SRC(portNum)) == nwTrue))
+    {
+        // All pins of a port share a single interrupt source, hence a single ISR.
+        // The port registers are not touched, so the EXTI of the other pin stays intact.
+        retRes = NW_GPIO_RESOURCE_CONFLICT;
+    }
+    else if ((gpioPinExists == nwTrue) &&
+             (extiConfig != NULL) &&
+             (extiConfig->intrEdge <= NW_EXTI_BOTH_EDGES) &&
+             (extiConfig->isrHandlerPtr != NULL))
     {
         intrEdgeConfig = interruptEdgeMap[extiConfig->intrEdge];
         Cy_GPIO_SetInterruptEdge(NW_HAL_INFINEON_CAT1B_GPIO_GET_PORT_BASE(portNum), pinNum, intrEdgeConfig);
@@ -372,11 +589,11 @@ NW_INLINE NwGpioExtiStatus NexaWatt_Hal_Infineon_Cat1B_Gpio_Get_EXTI_Status(cons
     uint32 intrStatusGpio = NW_HAL_INFINEON_CAT1B_GPIO_INTR_DISABLED_MASK;
 
     nw_bool gpioPinExists =
-            NexaWatt_Hal_Infineon_Cat1B_Gpio_Validate_Port_And_Pin(portNum, pinNum);
+            NW_RUNTIME_CHECK(NexaWatt_Hal_Infineon_Cat1B_Gpio_Validate_Port_And_Pin(portNum, pinNum));
     if (gpioPinExists == nwTrue)
     {
         intrStatusGpio =
-                Cy_GPIO_GetInterruptStatus(NW_HAL_INFINEON_CAT1B_GPIO_GET_PORT_BASE(portNum), pinNum);
+                NW_HAL_INFINEON_CAT1B_GPIO_GET_INTR_STATUS(portNum, pinNum);
         extiStatus = (intrStatusGpio == NW_HAL_INFINEON_CAT1B_GPIO_INTR_ENABLED_MASK) ?
                 nwTrue : nwFalse;
     }
@@ -386,7 +603,7 @@ NW_INLINE NwGpioExtiStatus NexaWatt_Hal_Infineon_Cat1B_Gpio_Get_EXTI_Status(cons
 
 NW_INLINE NwGpioExtiStatus NexaWatt_Hal_Infineon_Cat1B_Gpio_Get_EXTI_Status_Unsafe(const uint8 portNum, const uint8 pinNum)
 {
-    return (NwGpioExtiStatus)Cy_GPIO_GetInterruptStatus(NW_HAL_INFINEON_CAT1B_GPIO_GET_PORT_BASE(portNum), pinNum);
+    return (NwGpioExtiStatus)NW_HAL_INFINEON_CAT1B_GPIO_GET_INTR_STATUS(portNum, pinNum);
 }
 
 NW_INLINE NexaWattGPIOStatusResult NexaWatt_Hal_Infineon_Cat1B_Gpio_Clear_EXTI_Status(const uint8 portNum, const uint8 pinNum)
@@ -394,10 +611,10 @@ NW_INLINE NexaWattGPIOStatusResult NexaWatt_Hal_Infineon_Cat1B_Gpio_Clear_EXTI_S
     NexaWattGPIOStatusResult retRes = NW_GPIO_BAD_PARAM;
 
     nw_bool gpioPinExists =
-            NexaWatt_Hal_Infineon_Cat1B_Gpio_Validate_Port_And_Pin(portNum, pinNum);
+            NW_RUNTIME_CHECK(NexaWatt_Hal_Infineon_Cat1B_Gpio_Validate_Port_And_Pin(portNum, pinNum));
     if (gpioPinExists == nwTrue)
     {
-        Cy_GPIO_ClearInterrupt(NW_HAL_INFINEON_CAT1B_GPIO_GET_PORT_BASE(portNum), pinNum);
+        NW_HAL_INFINEON_CAT1B_GPIO_CLEAR_INTR(portNum, pinNum);
 
         retRes = NW_GPIO_SUCCESS;
     }
@@ -407,7 +624,7 @@ NW_INLINE NexaWattGPIOStatusResult NexaWatt_Hal_Infineon_Cat1B_Gpio_Clear_EXTI_S
 
 NW_INLINE void NexaWatt_Hal_Infineon_Cat1B_Gpio_Clear_EXTI_Status_Unsafe(const uint8 portNum, const uint8 pinNum)
 {
-    Cy_GPIO_ClearInterrupt(NW_HAL_INFINEON_CAT1B_GPIO_GET_PORT_BASE(portNum), pinNum);
+    NW_HAL_INFINEON_CAT1B_GPIO_CLEAR_INTR(portNum, pinNum);
 }
 
 NexaWattGPIOStatusResult NexaWatt_Hal_Infineon_Cat1B_Gpio_Trigger_Sw_EXTI(const uint8 portNum, const uint8 pinNum)
@@ -416,7 +633,7 @@ NexaWattGPIOStatusResult NexaWatt_Hal_Infineon_Cat1B_Gpio_Trigger_Sw_EXTI(const
     NwInterruptMask gpioPortIntrMask = NW_HAL_INFINEON_CAT1B_GPIO_INTR_DISABLED_MASK;
 
     nw_bool gpioPinExists =
-            NexaWatt_Hal_Infineon_Cat1B_Gpio_Validate_Port_And_Pin(portNum, pinNum);
+            NW_RUNTIME_CHECK(NexaWatt_Hal_Infineon_Cat1B_Gpio_Validate_Port_And_Pin(portNum, pinNum));
     if (gpioPinExists == nwTrue)
     {
         gpioPortIntrMask = Cy_GPIO_GetInterruptMask(NW_HAL_INFINEON_CAT1B_GPIO_GET_PORT_BASE(portNum), pinNum);
@@ -18,6 +18,7 @@
 *******************************************************************************/
 #include "hal_infineon_cat1b_intr.h"
 #include "cy_sysint.h"
+#include "hal_manager_resources.h"
 
 /*******************************************************************************
 * Macros
@@ -85,11 +86,23 @@ NexaWattIntrInitStatus NexaWatt_Hal_Infineon_Cat1B_Intr_Init(const NexaWattIntrI
         userIntrConfig.intrSrc = intrConfig->intrSource;
         userIntrConfig.intrPriority = (uint32)intrConfig->intrPriority;
 
-        intrInitResult = Cy_SysInt_Init(&userIntrConfig, intrConfig->intrHandlerPtr);
-        if (intrInitResult == CY_SYSINT_SUCCESS)
+        // A second initialization would silently replace the ISR of the first owner of the source
+        if ((intrConfig->intrSource != NW_HAL_INFINEON_CAT1B_INTR_UNCONNECTED) &&
+            (NexaWatt_HalManager_Resources_Claim_Irq(intrConfig->intrSource) != NW_RESOURCE_SUCCESS))
         {
-            if (intrConfig->intrSource)
-            retRes = NW_HAL_INTR_INIT_SUCCESS;
+            retRes = NW_HAL_INTR_INIT_CONFLICT;
+        }
+        else
+        {
+            intrInitResult = Cy_SysInt_Init(&userIntrConfig, intrConfig->intrHandlerPtr);
+            if (intrInitResult == CY_SYSINT_SUCCESS)
+            {
+                retRes = NW_HAL_INTR_INIT_SUCCESS;
+            }
+            else
+            {
+                (void)NexaWatt_HalManager_Resources_Release_Irq(intrConfig->intrSource);
+            }
         }
     }
 
@@ -98,7 +111,7 @@ NexaWattIntrInitStatus NexaWatt_Hal_Infineon_Cat1B_Intr_Init(const NexaWattIntrI
 
 void NexaWatt_Hal_Infineon_Cat1B_Intr_Enable(const NexaWattIntrInitConfig* const intrConfig)
 {
-    nw_bool intrConfigValidationResult = ValidateInterruptConfiguration(intrConfig);
+    nw_bool intrConfigValidationResult = NW_RUNTIME_CHECK(ValidateInterruptConfiguration(intrConfig));
     if (intrConfigValidationResult == nwTrue)
     {
         NVIC_EnableIRQ(intrConfig->intrSource);
@@ -111,6 +124,7 @@ void NexaWatt_Hal_Infineon_Cat1B_Intr_Disable(const NexaWattIntrInitConfig* cons
     if (intrConfigValidationResult == nwTrue)
     {
         NVIC_DisableIRQ(intrConfig->intrSource);
+        (void)NexaWatt_HalManager_Resources_Release_Irq(intrConfig->intrSource);
     }
 }
 
@@ -0,0 +1,359 @@
+/*******************************************************************************
+* File Name:   hal_infineon_cat1b_pwm.c
+*
+* Description: This is the source file containing definitions,
+* related to the HAL implementation for the PWM peripheral of the Infineon CAT1B devices.
+* The NexaWatt-IV.DC framework offers custom implemented HAL for several Infineon devices.
+* The implementation of the current HAL is dependent on the PDL, provided by Infineon Technologies.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+// TODO: Uncomment the pre-processor defence after development
+// Prevents the compilation of the HAL Implementation in case of missing PDL
+//#ifdef CY_TCPWM_PWM_H
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "hal_infineon_cat1b_pwm.h"
+#include "cy_tcpwm_pwm.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Number of TCPWM counters used as PWM channels for Infineon CAT1B devices.
+ */
+#define NW_HAL_INFINEON_CAT1B_PWM_CHANNEL_CNT          (8u)
+
+/**
+ * \brief Mask containing all existing PWM channels.
+ */
+#define NW_HAL_INFINEON_CAT1B_PWM_CHANNEL_VALID_MASK   ((0x01u << NW_HAL_INFINEON_CAT1B_PWM_CHANNEL_CNT) - 1u)
+
+/**
+ * \brief Maximum period of the 16-bit TCPWM counters.
+ */
+#define NW_HAL_INFINEON_CAT1B_PWM_PERIOD_MAX           (0xFFFFu)
+
+/**
+ * \brief Maximum dead time of the TCPWM dead time generator.
+ */
+#define NW_HAL_INFINEON_CAT1B_PWM_DEAD_TIME_MAX        (0xFFu)
+
+/**
+ * \brief TCPWM peripheral instance, containing the counters used as PWM channels.
+ */
+#define NW_HAL_INFINEON_CAT1B_PWM_BASE                 (TCPWM0)
+
+/**
+ * \brief Macro returning the TCPWM counter number corresponding to a provided PWM channel.
+ */
+#define NW_HAL_INFINEON_CAT1B_PWM_GET_CNT_NUM(channel) \
+    (pwmCounterNumMap[channel])
+
+/**
+ * \brief Macro returning the bit of a provided PWM channel in the counter mask of the TCPWM triggers.
+ * The masked triggers address the counters 0 to 31 of the group 0, so the mapped counters must be among them.
+ */
+#define NW_HAL_INFINEON_CAT1B_PWM_GET_CNT_MSK(channel) \
+    ((uint32)0x01u << pwmCounterNumMap[channel])
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+/**
+ * \brief Array containing mapping between the PWM channel number (index) and the
+ * counter number of the TCPWM peripheral.
+ */
+static const uint32 pwmCounterNumMap[] =
+{
+    0u,
+    1u,
+    2u,
+    3u,
+    4u,
+    5u,
+    6u,
+    7u,
+};
+
+/**
+ * \brief Array containing mapping between the framework standardized NexaWattPWMAlignment
+ * and the PWM alignments of the TCPWM peripheral.
+ */
+static const uint32 pwmAlignmentMap[] =
+{
+    CY_TCPWM_PWM_LEFT_ALIGN,
+    CY_TCPWM_PWM_CENTER_ALIGN,
+};
+
+NW_STATIC_ASSERT((sizeof(pwmCounterNumMap) / sizeof(pwmCounterNumMap[0u])) == NW_HAL_INFINEON_CAT1B_PWM_CHANNEL_CNT, pwm_counter_map_size);
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that validates the provided NexaWattPWMChannelConfig channel configuration
+ * by the HAL user, according to the Infineon CAT1B devices data.
+ * \param channel - The number of the configured PWM channel.
+ * \param channelConfig - A pointer, containing the framework's standardized PWM channel configuration structure.
+ * \return nwTrue - Validation is performed and the configuration is correct.
+ * \return nwFalse - Validation is performed, but the configuration contains incorrect data.
+ */
+NW_LOCAL_INLINE nw_bool NexaWatt_Hal_Infineon_Cat1B_Pwm_Validate_User_Channel_Config(uint8 channel, const NexaWattPWMChannelConfig* channelConfig);
+
+/**
+ * \brief Simple helper function that converts a mask of PWM channels to the counter mask of the TCPWM triggers.
+ * \param channelMask - The mask of the PWM channels.
+ * \return The mask of the corresponding TCPWM counters.
+ */
+NW_LOCAL_INLINE uint32 NexaWatt_Hal_Infineon_Cat1B_Pwm_Get_Counter_Mask(NwPwmChannelMask channelMask);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattPWMStatusResult NexaWatt_Hal_Infineon_Cat1B_Pwm_Init_Channel(const uint8 channel, const NexaWattPWMChannelConfig* const channelConfig)
+{
+    // Variables are declared in the beginning of the function to ensure constant memory usage
+    NexaWattPWMStatusResult retRes = NW_PWM_BAD_PARAM;
+    // The remaining fields of the TCPWM configuration (additional compare channels, the second output trigger) are not used
+    cy_stc_tcpwm_pwm_config_t userPwmConfig = { 0 };
+    cy_en_tcpwm_status_t pwmInitRes;
+    nw_bool deadTimeUsed = nwFalse;
+
+    nw_bool isUserConfigValid =
+            NexaWatt_Hal_Infineon_Cat1B_Pwm_Validate_User_Channel_Config(channel, channelConfig);
+
+    if (isUserConfigValid == nwTrue)
+    {
+        deadTimeUsed = ((channelConfig->complementaryOutput == nwTrue) ||
+                        (channelConfig->deadTimeRiseTicks > 0u) ||
+                        (channelConfig->deadTimeFallTicks > 0u)) ? nwTrue : nwFalse;
+
+        userPwmConfig.pwmMode = (deadTimeUsed == nwTrue) ? CY_TCPWM_PWM_MODE_DEADTIME : CY_TCPWM_PWM_MODE_PWM;
+        userPwmConfig.clockPrescaler = CY_TCPWM_PWM_PRESCALER_DIVBY_1;
+        userPwmConfig.pwmAlignment = pwmAlignmentMap[channelConfig->alignment];
+        userPwmConfig.deadTimeClocks = channelConfig->deadTimeRiseTicks;
+        userPwmConfig.deadTimeClocks_linecompl_out = channelConfig->deadTimeFallTicks;
+        userPwmConfig.runMode = CY_TCPWM_PWM_CONTINUOUS;
+        userPwmConfig.period0 = channelConfig->periodTicks;
+        userPwmConfig.period1 = channelConfig->periodTicks;
+        userPwmConfig.enablePeriodSwap = true;
+        // The compare values are written to the buffer registers and swapped at the terminal count
+        userPwmConfig.compare0 = 0u;
+        userPwmConfig.compare1 = 0u;
+        userPwmConfig.enableCompareSwap = true;
+        userPwmConfig.interruptSources = CY_TCPWM_INT_NONE;
+        // The first output trigger marks the start of the period (the terminal count), e.g. for the ADC sequence
+        userPwmConfig.trigger0Event = CY_TCPWM_CNT_TRIGGER_ON_TC;
+        userPwmConfig.trigger1Event = CY_TCPWM_CNT_TRIGGER_ON_DISABLED;
+        userPwmConfig.invertPWMOut = (channelConfig->invertOutput == nwTrue) ? CY_TCPWM_PWM_INVERT_ENABLE : CY_TCPWM_PWM_INVERT_DISABLE;
+        userPwmConfig.invertPWMOutN = (channelConfig->invertOutput == nwTrue) ? CY_TCPWM_PWM_INVERT_ENABLE : CY_TCPWM_PWM_INVERT_DISABLE;
+        userPwmConfig.killMode = CY_TCPWM_PWM_STOP_ON_KILL;
+        userPwmConfig.swapInputMode = CY_TCPWM_INPUT_RISINGEDGE;
+        userPwmConfig.swapInput = CY_TCPWM_INPUT_0;
+        userPwmConfig.reloadInputMode = CY_TCPWM_INPUT_RISINGEDGE;
+        userPwmConfig.reloadInput = CY_TCPWM_INPUT_0;
+        userPwmConfig.startInputMode = CY_TCPWM_INPUT_RISINGEDGE;
+        userPwmConfig.startInput = CY_TCPWM_INPUT_0;
+        userPwmConfig.killInputMode = CY_TCPWM_INPUT_RISINGEDGE;
+        userPwmConfig.killInput = CY_TCPWM_INPUT_0;
+        userPwmConfig.countInputMode = CY_TCPWM_INPUT_LEVEL;
+        userPwmConfig.countInput = CY_TCPWM_INPUT_1;
+        userPwmConfig.pwmOnDisable = CY_TCPWM_PWM_OUTPUT_LOW;
+        userPwmConfig.line_out_sel = CY_TCPWM_OUTPUT_PWM_SIGNAL;
+        userPwmConfig.linecompl_out_sel = (channelConfig->complementaryOutput == nwTrue) ?
+                                          CY_TCPWM_OUTPUT_INVERTED_PWM_SIGNAL : CY_TCPWM_OUTPUT_CONSTANT_0;
+
+        pwmInitRes = Cy_TCPWM_PWM_Init(NW_HAL_INFINEON_CAT1B_PWM_BASE, NW_HAL_INFINEON_CAT1B_PWM_GET_CNT_NUM(channel), &userPwmConfig);
+        if (pwmInitRes == CY_TCPWM_SUCCESS)
+        {
+            Cy_TCPWM_PWM_Enable(NW_HAL_INFINEON_CAT1B_PWM_BASE, NW_HAL_INFINEON_CAT1B_PWM_GET_CNT_NUM(channel));
+
+            retRes = NW_PWM_SUCCESS;
+        }
+        else
+        {
+            retRes = NW_PWM_FATAL_ERR;
+        }
+    }
+
+    return retRes;
+}
+
+NexaWattPWMStatusResult NexaWatt_Hal_Infineon_Cat1B_Pwm_DeInit_Channel(const uint8 channel)
+{
+    NexaWattPWMStatusResult retRes = NW_PWM_BAD_PARAM;
+
+    if (channel < NW_HAL_INFINEON_CAT1B_PWM_CHANNEL_CNT)
+    {
+        Cy_TCPWM_TriggerStopOrKill_Single(NW_HAL_INFINEON_CAT1B_PWM_BASE, NW_HAL_INFINEON_CAT1B_PWM_GET_CNT_NUM(channel));
+        Cy_TCPWM_PWM_Disable(NW_HAL_INFINEON_CAT1B_PWM_BASE, NW_HAL_INFINEON_CAT1B_PWM_GET_CNT_NUM(channel));
+        Cy_TCPWM_PWM_DeInit(NW_HAL_INFINEON_CAT1B_PWM_BASE, NW_HAL_INFINEON_CAT1B_PWM_GET_CNT_NUM(channel), NULL);
+
+        retRes = NW_PWM_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattPWMStatusResult NexaWatt_Hal_Infineon_Cat1B_Pwm_Set_Period(const uint8 channel, const NwPwmTicks periodTicks)
+{
+    NexaWattPWMStatusResult retRes = NW_PWM_BAD_PARAM;
+
+    if (NW_RUNTIME_CHECK((channel < NW_HAL_INFINEON_CAT1B_PWM_CHANNEL_CNT) &&
+                         (periodTicks > 0u) &&
+                         (periodTicks <= NW_HAL_INFINEON_CAT1B_PWM_PERIOD_MAX)))
+    {
+        Cy_TCPWM_PWM_SetPeriod1(NW_HAL_INFINEON_CAT1B_PWM_BASE, NW_HAL_INFINEON_CAT1B_PWM_GET_CNT_NUM(channel), periodTicks);
+
+        retRes = NW_PWM_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattPWMStatusResult NexaWatt_Hal_Infineon_Cat1B_Pwm_Set_Phase(const uint8 channel, const NwPwmTicks phaseTicks)
+{
+    NexaWattPWMStatusResult retRes = NW_PWM_BAD_PARAM;
+
+    if (NW_RUNTIME_CHECK((channel < NW_HAL_INFINEON_CAT1B_PWM_CHANNEL_CNT) &&
+                         (phaseTicks <= NW_HAL_INFINEON_CAT1B_PWM_PERIOD_MAX)))
+    {
+        Cy_TCPWM_PWM_SetCounter(NW_HAL_INFINEON_CAT1B_PWM_BASE, NW_HAL_INFINEON_CAT1B_PWM_GET_CNT_NUM(channel), phaseTicks);
+
+        retRes = NW_PWM_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattPWMStatusResult NexaWatt_Hal_Infineon_Cat1B_Pwm_Set_Dead_Time(const uint8 channel, const NwPwmTicks deadTimeRiseTicks, const NwPwmTicks deadTimeFallTicks)
+{
+    NexaWattPWMStatusResult retRes = NW_PWM_BAD_PARAM;
+
+    if (NW_RUNTIME_CHECK((channel < NW_HAL_INFINEON_CAT1B_PWM_CHANNEL_CNT) &&
+                         (deadTimeRiseTicks <= NW_HAL_INFINEON_CAT1B_PWM_DEAD_TIME_MAX) &&
+                         (deadTimeFallTicks <= NW_HAL_INFINEON_CAT1B_PWM_DEAD_TIME_MAX)))
+    {
+        Cy_TCPWM_PWM_PWMDeadTime(NW_HAL_INFINEON_CAT1B_PWM_BASE, NW_HAL_INFINEON_CAT1B_PWM_GET_CNT_NUM(channel), deadTimeRiseTicks);
+        Cy_TCPWM_PWM_PWMDeadTimeN(NW_HAL_INFINEON_CAT1B_PWM_BASE, NW_HAL_INFINEON_CAT1B_PWM_GET_CNT_NUM(channel), deadTimeFallTicks);
+
+        retRes = NW_PWM_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattPWMStatusResult NexaWatt_Hal_Infineon_Cat1B_Pwm_Start(const NwPwmChannelMask channelMask)
+{
+    NexaWattPWMStatusResult retRes = NW_PWM_BAD_PARAM;
+
+    if (NW_RUNTIME_CHECK((channelMask & ~NW_HAL_INFINEON_CAT1B_PWM_CHANNEL_VALID_MASK) == 0u))
+    {
+        // A single command register write starts all selected counters in the same clock cycle
+        Cy_TCPWM_TriggerStart(NW_HAL_INFINEON_CAT1B_PWM_BASE, NexaWatt_Hal_Infineon_Cat1B_Pwm_Get_Counter_Mask(channelMask));
+
+        retRes = NW_PWM_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattPWMStatusResult NexaWatt_Hal_Infineon_Cat1B_Pwm_Stop(const NwPwmChannelMask channelMask)
+{
+    NexaWattPWMStatusResult retRes = NW_PWM_BAD_PARAM;
+
+    if (NW_RUNTIME_CHECK((channelMask & ~NW_HAL_INFINEON_CAT1B_PWM_CHANNEL_VALID_MASK) == 0u))
+    {
+        Cy_TCPWM_TriggerStopOrKill(NW_HAL_INFINEON_CAT1B_PWM_BASE, NexaWatt_Hal_Infineon_Cat1B_Pwm_Get_Counter_Mask(channelMask));
+
+        retRes = NW_PWM_SUCCESS;
+    }
+
+    return retRes;
+}
+
+void NexaWatt_Hal_Infineon_Cat1B_Pwm_Commit(const NwPwmTicks* const compareValues, const NwPwmChannelMask channelMask)
+{
+    NwPwmChannelMask pendingMask = channelMask & NW_HAL_INFINEON_CAT1B_PWM_CHANNEL_VALID_MASK;
+    uint32 counterMask = 0u;
+    uint32 channel = 0u;
+
+    // Only the staged channels are visited: the lowest set bit is located by bit reversal and leading zeros count
+    while (pendingMask != 0u)
+    {
+        channel = __CLZ(__RBIT(pendingMask));
+        Cy_TCPWM_PWM_SetCompare0BufVal(NW_HAL_INFINEON_CAT1B_PWM_BASE, NW_HAL_INFINEON_CAT1B_PWM_GET_CNT_NUM(channel), compareValues[channel]);
+        counterMask |= NW_HAL_INFINEON_CAT1B_PWM_GET_CNT_MSK(channel);
+        pendingMask &= (pendingMask - 1u);
+    }
+
+    // All buffers are written before the single swap trigger, so no channel can take its new compare value a period before the others
+    Cy_TCPWM_TriggerCaptureOrSwap(NW_HAL_INFINEON_CAT1B_PWM_BASE, counterMask);
+}
+
+NwPwmTicks NexaWatt_Hal_Infineon_Cat1B_Pwm_Get_Elapsed_Ticks(const uint8 channel)
+{
+    // The direction is read before the counter, so a reading at the turning point is at most one tick off
+    const uint32 pwmStatus = Cy_TCPWM_PWM_GetStatus(NW_HAL_INFINEON_CAT1B_PWM_BASE, NW_HAL_INFINEON_CAT1B_PWM_GET_CNT_NUM(channel));
+    NwPwmTicks elapsedTicks = (NwPwmTicks)Cy_TCPWM_PWM_GetCounter(NW_HAL_INFINEON_CAT1B_PWM_BASE, NW_HAL_INFINEON_CAT1B_PWM_GET_CNT_NUM(channel));
+
+    // A center-aligned counter counts up to the period in the first half and back down to 0 in the second half
+    if ((pwmStatus & CY_TCPWM_PWM_STATUS_DOWN_COUNTING) != 0u)
+    {
+        elapsedTicks = (2u * (NwPwmTicks)Cy_TCPWM_PWM_GetPeriod0(NW_HAL_INFINEON_CAT1B_PWM_BASE, NW_HAL_INFINEON_CAT1B_PWM_GET_CNT_NUM(channel))) - elapsedTicks;
+    }
+
+    return elapsedTicks;
+}
+
+NW_LOCAL_INLINE uint32 NexaWatt_Hal_Infineon_Cat1B_Pwm_Get_Counter_Mask(const NwPwmChannelMask channelMask)
+{
+    uint32 counterMask = 0u;
+    uint8 channel = 0u;
+
+    for (channel = 0u; channel < NW_HAL_INFINEON_CAT1B_PWM_CHANNEL_CNT; channel++)
+    {
+        if ((channelMask & (0x01u << channel)) != 0u)
+        {
+            counterMask |= NW_HAL_INFINEON_CAT1B_PWM_GET_CNT_MSK(channel);
+        }
+    }
+
+    return counterMask;
+}
+
+NW_LOCAL_INLINE nw_bool NexaWatt_Hal_Infineon_Cat1B_Pwm_Validate_User_Channel_Config(const uint8 channel, const NexaWattPWMChannelConfig* const channelConfig)
+{
+    // The validation is performed in several logical branches to increase the code readability
+    // The compiler will optimize the below code
+    nw_bool validationRes = (channel < NW_HAL_INFINEON_CAT1B_PWM_CHANNEL_CNT) ? nwTrue : nwFalse;
+    if (channelConfig == NULL)
+    {
+        // Channel configuration is not provided by the user
+        validationRes = nwFalse;
+    }
+    else if ((channelConfig->alignment > NW_PWM_ALIGN_CENTER) ||
+             (channelConfig->periodTicks == 0u) ||
+             (channelConfig->periodTicks > NW_HAL_INFINEON_CAT1B_PWM_PERIOD_MAX))
+    {
+        // Invalid values for the channel configuration are provided
+        validationRes = nwFalse;
+    }
+    else if ((channelConfig->deadTimeRiseTicks > NW_HAL_INFINEON_CAT1B_PWM_DEAD_TIME_MAX) ||
+             (channelConfig->deadTimeFallTicks > NW_HAL_INFINEON_CAT1B_PWM_DEAD_TIME_MAX))
+    {
+        // The dead times exceed the dead time generator of the TCPWM counter
+        validationRes = nwFalse;
+    }
+
+    return validationRes;
+}
+//#endif
@@ -0,0 +1,724 @@
+/*******************************************************************************
+* File Name:   hal_infineon_cat1b_serial.c
+*
+* Description: This is the source file containing definitions,
+* related to the HAL implementation for the serial buses (SPI and I2C) of the Infineon CAT1B devices.
+* The NexaWatt-IV.DC framework offers custom implemented HAL for several Infineon devices.
+* The implementation of the current HAL is dependent on the PDL, provided by Infineon Technologies.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+// TODO: Uncomment the pre-processor defence after development
+// Prevents the compilation of the HAL Implementation in case of missing PDL
+//#ifdef CY_SCB_COMMON_H
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "hal_infineon_cat1b_serial.h"
+#include "hal_infineon_cat1b_intr.h"
+#include "cy_scb_spi.h"
+#include "cy_scb_i2c.h"
+#include "cy_dma.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Number of SCB blocks used as serial buses for Infineon CAT1B devices.
+ */
+#define NW_HAL_INFINEON_CAT1B_SERIAL_BUS_CNT            (2u)
+
+/**
+ * \brief Frequency of the SCB clocks. Must match the clocks, assigned with the device configurator.
+ */
+#define NW_HAL_INFINEON_CAT1B_SERIAL_SCB_CLK_HZ         (48000000u)
+
+/**
+ * \brief Limits of the SPI master oversampling (SCB clocks per SPI bit).
+ */
+#define NW_HAL_INFINEON_CAT1B_SERIAL_SPI_OVS_MIN        (4u)
+#define NW_HAL_INFINEON_CAT1B_SERIAL_SPI_OVS_MAX        (16u)
+
+/**
+ * \brief DataWire instance, moving the SPI frames between the memory and the SCB FIFOs.
+ */
+#define NW_HAL_INFINEON_CAT1B_SERIAL_DMA_BASE           (DW0)
+
+/**
+ * \brief Maximum number of elements of a 1D DataWire descriptor, limiting the length of a SPI transfer.
+ */
+#define NW_HAL_INFINEON_CAT1B_SERIAL_DMA_MAX_LEN        (256u)
+
+/**
+ * \brief Number of descriptors per DataWire channel: the data and the padding (dummy bytes) of the frame.
+ */
+#define NW_HAL_INFINEON_CAT1B_SERIAL_DESCRIPTOR_CNT     (2u)
+
+/**
+ * \brief Byte sent by the SPI master after the transmitted data.
+ */
+#define NW_HAL_INFINEON_CAT1B_SERIAL_DUMMY_BYTE         (0xFFu)
+
+/**
+ * \brief Macro returning the SCB block corresponding to a provided bus.
+ */
+#define NW_HAL_INFINEON_CAT1B_SERIAL_GET_SCB(bus) \
+    (serialScbBaseMap[bus])
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+/**
+ * \brief State of a serial bus, required by its interrupts.
+ */
+typedef struct sNexaWattCat1BSerialBus
+{
+    nw_bool isInitialized;
+    NexaWattSerialBusType busType;
+    NwSerialHalTransferHandler transferHandler;
+    const NexaWattSerialTransfer* volatile activeTransfer;
+    cy_stc_scb_i2c_context_t i2cContext;
+    cy_stc_scb_i2c_master_xfer_config_t i2cXferConfig;
+    cy_stc_dma_descriptor_t txDescriptors[NW_HAL_INFINEON_CAT1B_SERIAL_DESCRIPTOR_CNT];
+    cy_stc_dma_descriptor_t rxDescriptors[NW_HAL_INFINEON_CAT1B_SERIAL_DESCRIPTOR_CNT];
+    NexaWattIntrInitConfig intrConfig;
+} NexaWattCat1BSerialBus;
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+/**
+ * \brief Array containing mapping between the bus number (index) and the SCB block.
+ */
+static CySCB_Type* const serialScbBaseMap[] =
+{
+    SCB0,
+    SCB1,
+};
+
+/**
+ * \brief Array containing mapping between the bus number (index) and the interrupt source of the SCB block (I2C).
+ */
+static const uint32 serialScbIntrSourcesMap[] =
+{
+    scb_0_interrupt_IRQn,
+    scb_1_interrupt_IRQn,
+};
+
+/**
+ * \brief Arrays containing mapping between the bus number (index) and the DataWire channels (SPI).
+ * The TX channel is triggered by the SCB TX FIFO level and the RX channel by the SCB RX FIFO level.
+ */
+static const uint32 serialDmaTxChannelMap[] =
+{
+    2u,
+    4u,
+};
+
+static const uint32 serialDmaRxChannelMap[] =
+{
+    3u,
+    5u,
+};
+
+/**
+ * \brief Array containing mapping between the bus number (index) and the interrupt source of the RX DataWire channel (SPI).
+ */
+static const uint32 serialDmaIntrSourcesMap[] =
+{
+    cpuss_interrupts_dw0_3_IRQn,
+    cpuss_interrupts_dw0_5_IRQn,
+};
+
+/**
+ * \brief Array containing mapping between the framework's SPI modes (index) and the SCB clock modes.
+ */
+static const cy_en_scb_spi_sclk_mode_t serialSpiSclkModeMap[] =
+{
+    CY_SCB_SPI_CPHA0_CPOL0,
+    CY_SCB_SPI_CPHA1_CPOL0,
+    CY_SCB_SPI_CPHA0_CPOL1,
+    CY_SCB_SPI_CPHA1_CPOL1,
+};
+
+NW_STATIC_ASSERT((sizeof(serialScbBaseMap) / sizeof(serialScbBaseMap[0u])) == NW_HAL_INFINEON_CAT1B_SERIAL_BUS_CNT, serial_scb_map_size);
+NW_STATIC_ASSERT((sizeof(serialScbIntrSourcesMap) / sizeof(serialScbIntrSourcesMap[0u])) == NW_HAL_INFINEON_CAT1B_SERIAL_BUS_CNT, serial_scb_intr_map_size);
+NW_STATIC_ASSERT((sizeof(serialDmaTxChannelMap) / sizeof(serialDmaTxChannelMap[0u])) == NW_HAL_INFINEON_CAT1B_SERIAL_BUS_CNT, serial_dma_tx_map_size);
+NW_STATIC_ASSERT((sizeof(serialDmaRxChannelMap) / sizeof(serialDmaRxChannelMap[0u])) == NW_HAL_INFINEON_CAT1B_SERIAL_BUS_CNT, serial_dma_rx_map_size);
+NW_STATIC_ASSERT((sizeof(serialDmaIntrSourcesMap) / sizeof(serialDmaIntrSourcesMap[0u])) == NW_HAL_INFINEON_CAT1B_SERIAL_BUS_CNT, serial_dma_intr_map_size);
+NW_STATIC_ASSERT((sizeof(serialSpiSclkModeMap) / sizeof(serialSpiSclkModeMap[0u])) == (NW_SERIAL_SPI_MODE_3 + 1u), serial_spi_mode_map_size);
+
+/**
+ * \brief Source of the SPI dummy bytes and sink of the discarded SPI bytes.
+ */
+static const uint8 serialDummyTxByte = NW_HAL_INFINEON_CAT1B_SERIAL_DUMMY_BYTE;
+static uint8 serialDummyRxByte;
+
+static NexaWattCat1BSerialBus serialBuses[NW_HAL_INFINEON_CAT1B_SERIAL_BUS_CNT];
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper functions initializing the SCB block of a bus as SPI or I2C master.
+ * \param bus - The number of the bus.
+ * \param busConfig - A pointer, containing the framework's standardized serial bus configuration structure.
+ * \return NW_SERIAL_BAD_PARAM - The bit rate is not achievable with the SCB clock.
+ * \return NW_SERIAL_FATAL_ERR - The SCB, DataWire or interrupt initialization failed.
+ * \return NW_SERIAL_SUCCESS - The SCB block is initialized and enabled.
+ */
+static NexaWattSerialStatusResult NexaWatt_Hal_Infineon_Cat1B_Serial_Init_Spi(uint8 bus, const NexaWattSerialBusConfig* busConfig);
+static NexaWattSerialStatusResult NexaWatt_Hal_Infineon_Cat1B_Serial_Init_I2c(uint8 bus, const NexaWattSerialBusConfig* busConfig);
+
+/**
+ * \brief Simple helper functions starting a transfer on a SPI or I2C bus.
+ * \param bus - The number of the bus.
+ * \param transfer - A pointer to the transfer.
+ * \return The status of the start of the transfer.
+ */
+static NexaWattSerialStatusResult NexaWatt_Hal_Infineon_Cat1B_Serial_Start_Spi(uint8 bus, const NexaWattSerialTransfer* transfer);
+static NexaWattSerialStatusResult NexaWatt_Hal_Infineon_Cat1B_Serial_Start_I2c(uint8 bus, const NexaWattSerialTransfer* transfer);
+
+/**
+ * \brief Simple helper function that initializes the descriptor chain of a SPI DataWire channel.
+ * The first descriptor moves the data and the second one the padding of the frame; empty descriptors are skipped.
+ * \param descriptors - The descriptors of the channel.
+ * \param isTx - nwTrue for the TX channel (memory to FIFO), nwFalse for the RX channel (FIFO to memory).
+ * \param fifoAddr - The address of the SCB FIFO register.
+ * \param dataAddr - The address of the data buffer.
+ * \param dataLen - The number of data bytes.
+ * \param frameLen - The number of bytes of the frame.
+ * \return A pointer to the first descriptor of the chain, or NULL in case the initialization failed.
+ */
+static cy_stc_dma_descriptor_t* NexaWatt_Hal_Infineon_Cat1B_Serial_Init_Dma_Chain(cy_stc_dma_descriptor_t* descriptors, nw_bool isTx, void* fifoAddr,
+                                                                                   void* dataAddr, NwSerialLength dataLen, NwSerialLength frameLen);
+
+/**
+ * \brief Simple helper function that ends the active transfer and executes the transfer handler.
+ * \param bus - The number of the bus.
+ * \param transferStatus - The status of the transfer.
+ */
+static void NexaWatt_Hal_Infineon_Cat1B_Serial_Complete_Transfer(uint8 bus, NexaWattSerialStatusResult transferStatus);
+
+/**
+ * \brief Interrupt handling of a bus: the completion of the RX DataWire channel (SPI) or the SCB interrupt (I2C).
+ * \param bus - The number of the bus.
+ */
+static void NexaWatt_Hal_Infineon_Cat1B_Serial_Handle_Isr(uint8 bus);
+
+/**
+ * \brief Handling of the events of the PDL I2C master.
+ * \param bus - The number of the bus.
+ * \param i2cEvent - The events reported by the PDL.
+ */
+static void NexaWatt_Hal_Infineon_Cat1B_Serial_Handle_I2c_Event(uint8 bus, uint32 i2cEvent);
+
+/**
+ * \brief Interrupt handlers and PDL I2C event callbacks of the buses, forwarding to the common handling.
+ */
+static void NexaWatt_Hal_Infineon_Cat1B_Serial_Bus_0_Isr(void);
+static void NexaWatt_Hal_Infineon_Cat1B_Serial_Bus_1_Isr(void);
+static void NexaWatt_Hal_Infineon_Cat1B_Serial_Bus_0_I2c_Event(uint32_t i2cEvent);
+static void NexaWatt_Hal_Infineon_Cat1B_Serial_Bus_1_I2c_Event(uint32_t i2cEvent);
+
+/**
+ * \brief Arrays containing mapping between the bus number (index) and its interrupt handler and I2C event callback.
+ */
+static const NwIsrPointerType serialIsrMap[] =
+{
+    NexaWatt_Hal_Infineon_Cat1B_Serial_Bus_0_Isr,
+    NexaWatt_Hal_Infineon_Cat1B_Serial_Bus_1_Isr,
+};
+
+static const cy_cb_scb_i2c_handle_events_t serialI2cEventMap[] =
+{
+    NexaWatt_Hal_Infineon_Cat1B_Serial_Bus_0_I2c_Event,
+    NexaWatt_Hal_Infineon_Cat1B_Serial_Bus_1_I2c_Event,
+};
+
+NW_STATIC_ASSERT((sizeof(serialIsrMap) / sizeof(serialIsrMap[0u])) == NW_HAL_INFINEON_CAT1B_SERIAL_BUS_CNT, serial_isr_map_size);
+NW_STATIC_ASSERT((sizeof(serialI2cEventMap) / sizeof(serialI2cEventMap[0u])) == NW_HAL_INFINEON_CAT1B_SERIAL_BUS_CNT, serial_i2c_event_map_size);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattSerialStatusResult NexaWatt_Hal_Infineon_Cat1B_Serial_Init_Bus(const uint8 bus, const NexaWattSerialBusConfig* const busConfig,
+                                                                       const NwSerialHalTransferHandler transferHandler)
+{
+    NexaWattSerialStatusResult retRes = NW_SERIAL_BAD_PARAM;
+
+    if ((bus < NW_HAL_INFINEON_CAT1B_SERIAL_BUS_CNT) &&
+        (busConfig != NULL) &&
+        (busConfig->bitRateHz > 0u) &&
+        (busConfig->spiMode <= NW_SERIAL_SPI_MODE_3) &&
+        (transferHandler != NULL) &&
+        (serialBuses[bus].isInitialized == nwFalse))
+    {
+        serialBuses[bus].busType = busConfig->busType;
+        serialBuses[bus].transferHandler = transferHandler;
+        serialBuses[bus].activeTransfer = NULL;
+
+        if (busConfig->busType == NW_SERIAL_BUS_SPI)
+        {
+            retRes = NexaWatt_Hal_Infineon_Cat1B_Serial_Init_Spi(bus, busConfig);
+        }
+        else if (busConfig->busType == NW_SERIAL_BUS_I2C)
+        {
+            retRes = NexaWatt_Hal_Infineon_Cat1B_Serial_Init_I2c(bus, busConfig);
+        }
+        else
+        {
+            // Unsupported bus type
+        }
+
+        serialBuses[bus].isInitialized = (retRes == NW_SERIAL_SUCCESS) ? nwTrue : nwFalse;
+    }
+
+    return retRes;
+}
+
+NexaWattSerialStatusResult NexaWatt_Hal_Infineon_Cat1B_Serial_DeInit_Bus(const uint8 bus)
+{
+    NexaWattSerialStatusResult retRes = NW_SERIAL_BAD_PARAM;
+    CySCB_Type* scbBase = NULL;
+
+    if (bus < NW_HAL_INFINEON_CAT1B_SERIAL_BUS_CNT)
+    {
+        if (serialBuses[bus].isInitialized == nwTrue)
+        {
+            NexaWatt_Hal_Infineon_Cat1B_Serial_Abort(bus);
+            NexaWatt_Hal_Infineon_Cat1B_Intr_Disable(&serialBuses[bus].intrConfig);
+
+            scbBase = NW_HAL_INFINEON_CAT1B_SERIAL_GET_SCB(bus);
+            if (serialBuses[bus].busType == NW_SERIAL_BUS_SPI)
+            {
+                Cy_SCB_SPI_Disable(scbBase, NULL);
+                Cy_SCB_SPI_DeInit(scbBase);
+                Cy_DMA_Channel_SetInterruptMask(NW_HAL_INFINEON_CAT1B_SERIAL_DMA_BASE, serialDmaRxChannelMap[bus], 0u);
+                Cy_DMA_Channel_DeInit(NW_HAL_INFINEON_CAT1B_SERIAL_DMA_BASE, serialDmaTxChannelMap[bus]);
+                Cy_DMA_Channel_DeInit(NW_HAL_INFINEON_CAT1B_SERIAL_DMA_BASE, serialDmaRxChannelMap[bus]);
+            }
+            else
+            {
+                Cy_SCB_I2C_Disable(scbBase, &serialBuses[bus].i2cContext);
+                Cy_SCB_I2C_DeInit(scbBase);
+            }
+        }
+
+        serialBuses[bus].isInitialized = nwFalse;
+        serialBuses[bus].transferHandler = NULL;
+
+        retRes = NW_SERIAL_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattSerialStatusResult NexaWatt_Hal_Infineon_Cat1B_Serial_Start_Transfer(const uint8 bus, const NexaWattSerialTransfer* const transfer)
+{
+    NexaWattSerialStatusResult retRes = NW_SERIAL_BAD_PARAM;
+
+    if (NW_RUNTIME_CHECK((bus < NW_HAL_INFINEON_CAT1B_SERIAL_BUS_CNT) &&
+                         (serialBuses[bus].isInitialized == nwTrue) &&
+                         (transfer != NULL) &&
+                         ((transfer->txLen > 0u) || (transfer->rxLen > 0u))))
+    {
+        if (serialBuses[bus].activeTransfer != NULL)
+        {
+            retRes = NW_SERIAL_BUSY;
+        }
+        else if (serialBuses[bus].busType == NW_SERIAL_BUS_SPI)
+        {
+            retRes = NexaWatt_Hal_Infineon_Cat1B_Serial_Start_Spi(bus, transfer);
+        }
+        else
+        {
+            retRes = NexaWatt_Hal_Infineon_Cat1B_Serial_Start_I2c(bus, transfer);
+        }
+    }
+
+    return retRes;
+}
+
+void NexaWatt_Hal_Infineon_Cat1B_Serial_Abort(const uint8 bus)
+{
+    CySCB_Type* scbBase = NULL;
+    uint32 i2cStatus = 0u;
+
+    if ((bus < NW_HAL_INFINEON_CAT1B_SERIAL_BUS_CNT) &&
+        (serialBuses[bus].isInitialized == nwTrue))
+    {
+        // The transfer is released first, so the interrupts raised by the abort are ignored
+        serialBuses[bus].activeTransfer = NULL;
+        scbBase = NW_HAL_INFINEON_CAT1B_SERIAL_GET_SCB(bus);
+
+        if (serialBuses[bus].busType == NW_SERIAL_BUS_SPI)
+        {
+            Cy_DMA_Channel_Disable(NW_HAL_INFINEON_CAT1B_SERIAL_DMA_BASE, serialDmaTxChannelMap[bus]);
+            Cy_DMA_Channel_Disable(NW_HAL_INFINEON_CAT1B_SERIAL_DMA_BASE, serialDmaRxChannelMap[bus]);
+            Cy_DMA_Channel_ClearInterrupt(NW_HAL_INFINEON_CAT1B_SERIAL_DMA_BASE, serialDmaRxChannelMap[bus]);
+            Cy_SCB_ClearTxFifo(scbBase);
+            Cy_SCB_ClearRxFifo(scbBase);
+        }
+        else
+        {
+            i2cStatus = Cy_SCB_I2C_MasterGetStatus(scbBase, &serialBuses[bus].i2cContext);
+            if ((i2cStatus & CY_SCB_I2C_MASTER_WR) != 0u)
+            {
+                Cy_SCB_I2C_MasterAbortWrite(scbBase, &serialBuses[bus].i2cContext);
+            }
+            else if ((i2cStatus & CY_SCB_I2C_MASTER_RD) != 0u)
+            {
+                Cy_SCB_I2C_MasterAbortRead(scbBase, &serialBuses[bus].i2cContext);
+            }
+            else
+            {
+                // No transfer is active
+            }
+        }
+    }
+}
+
+static NexaWattSerialStatusResult NexaWatt_Hal_Infineon_Cat1B_Serial_Init_Spi(const uint8 bus, const NexaWattSerialBusConfig* const busConfig)
+{
+    NexaWattSerialStatusResult retRes = NW_SERIAL_BAD_PARAM;
+    CySCB_Type* const scbBase = NW_HAL_INFINEON_CAT1B_SERIAL_GET_SCB(bus);
+    cy_stc_scb_spi_config_t spiConfig = { 0 };
+    cy_stc_dma_channel_config_t channelConfig;
+    cy_en_scb_spi_status_t spiInitRes = CY_SCB_SPI_BAD_PARAM;
+    cy_en_dma_status_t dmaStatus = CY_DMA_SUCCESS;
+    NexaWattIntrInitStatus intrInitStatus = NW_HAL_INTR_INIT_FAILED;
+    uint32 oversample = NW_HAL_INFINEON_CAT1B_SERIAL_SCB_CLK_HZ / busConfig->bitRateHz;
+
+    if ((oversample >= NW_HAL_INFINEON_CAT1B_SERIAL_SPI_OVS_MIN) &&
+        (oversample <= NW_HAL_INFINEON_CAT1B_SERIAL_SPI_OVS_MAX))
+    {
+        retRes = NW_SERIAL_FATAL_ERR;
+
+        // The FIFO levels generate the DataWire triggers: RX while not empty, TX while not full
+        spiConfig.spiMode = CY_SCB_SPI_MASTER;
+        spiConfig.subMode = CY_SCB_SPI_MOTOROLA;
+        spiConfig.sclkMode = serialSpiSclkModeMap[busConfig->spiMode];
+        spiConfig.oversample = oversample;
+        spiConfig.rxDataWidth = 8u;
+        spiConfig.txDataWidth = 8u;
+        spiConfig.enableMsbFirst = true;
+        spiConfig.enableMisoLateSample = true;
+        spiConfig.ssPolarity = CY_SCB_SPI_ACTIVE_LOW;
+        spiConfig.rxFifoTriggerLevel = 0u;
+        spiConfig.txFifoTriggerLevel = Cy_SCB_GetFifoSize(scbBase) - 1u;
+
+        spiInitRes = Cy_SCB_SPI_Init(scbBase, &spiConfig, NULL);
+        if (spiInitRes == CY_SCB_SPI_SUCCESS)
+        {
+            channelConfig.descriptor = &serialBuses[bus].txDescriptors[0u];
+            channelConfig.preemptable = false;
+            channelConfig.priority = 1u;
+            channelConfig.enable = false;
+            channelConfig.bufferable = false;
+            dmaStatus = Cy_DMA_Channel_Init(NW_HAL_INFINEON_CAT1B_SERIAL_DMA_BASE, serialDmaTxChannelMap[bus], &channelConfig);
+
+            // The RX channel has the higher priority, so the RX FIFO is emptied before it overflows
+            channelConfig.descriptor = &serialBuses[bus].rxDescriptors[0u];
+            channelConfig.priority = 0u;
+            dmaStatus = (dmaStatus == CY_DMA_SUCCESS) ?
+                    Cy_DMA_Channel_Init(NW_HAL_INFINEON_CAT1B_SERIAL_DMA_BASE, serialDmaRxChannelMap[bus], &channelConfig) : dmaStatus;
+        }
+
+        if ((spiInitRes == CY_SCB_SPI_SUCCESS) &&
+            (dmaStatus == CY_DMA_SUCCESS))
+        {
+            serialBuses[bus].intrConfig.intrSource = serialDmaIntrSourcesMap[bus];
+            serialBuses[bus].intrConfig.intrPriority = busConfig->intrPriority;
+            serialBuses[bus].intrConfig.intrHandlerPtr = serialIsrMap[bus];
+
+            intrInitStatus =
+                    NexaWatt_Hal_Infineon_Cat1B_Intr_Init(&serialBuses[bus].intrConfig);
+        }
+
+        if (intrInitStatus == NW_HAL_INTR_INIT_SUCCESS)
+        {
+            Cy_DMA_Channel_SetInterruptMask(NW_HAL_INFINEON_CAT1B_SERIAL_DMA_BASE, serialDmaRxChannelMap[bus], CY_DMA_INTR_MASK);
+            NexaWatt_Hal_Infineon_Cat1B_Intr_Enable(&serialBuses[bus].intrConfig);
+            Cy_DMA_Enable(NW_HAL_INFINEON_CAT1B_SERIAL_DMA_BASE);
+            Cy_SCB_SPI_Enable(scbBase);
+
+            retRes = NW_SERIAL_SUCCESS;
+        }
+    }
+
+    return retRes;
+}
+
+static NexaWattSerialStatusResult NexaWatt_Hal_Infineon_Cat1B_Serial_Init_I2c(const uint8 bus, const NexaWattSerialBusConfig* const busConfig)
+{
+    NexaWattSerialStatusResult retRes = NW_SERIAL_FATAL_ERR;
+    CySCB_Type* const scbBase = NW_HAL_INFINEON_CAT1B_SERIAL_GET_SCB(bus);
+    cy_stc_scb_i2c_config_t i2cConfig = { 0 };
+    cy_en_scb_i2c_status_t i2cInitRes = CY_SCB_I2C_BAD_PARAM;
+    NexaWattIntrInitStatus intrInitStatus = NW_HAL_INTR_INIT_FAILED;
+    uint32 dataRateHz = 0u;
+    nw_bool isDataRateValid = nwFalse;
+
+    i2cConfig.i2cMode = CY_SCB_I2C_MASTER;
+    i2cConfig.useRxFifo = true;
+    i2cConfig.useTxFifo = true;
+
+    i2cInitRes = Cy_SCB_I2C_Init(scbBase, &i2cConfig, &serialBuses[bus].i2cContext);
+    if (i2cInitRes == CY_SCB_I2C_SUCCESS)
+    {
+        dataRateHz = Cy_SCB_I2C_SetDataRate(scbBase, busConfig->bitRateHz, NW_HAL_INFINEON_CAT1B_SERIAL_SCB_CLK_HZ);
+        isDataRateValid = ((dataRateHz > 0u) && (dataRateHz <= busConfig->bitRateHz)) ? nwTrue : nwFalse;
+    }
+
+    if (isDataRateValid == nwTrue)
+    {
+        Cy_SCB_I2C_RegisterEventCallback(scbBase, serialI2cEventMap[bus], &serialBuses[bus].i2cContext);
+
+        serialBuses[bus].intrConfig.intrSource = serialScbIntrSourcesMap[bus];
+        serialBuses[bus].intrConfig.intrPriority = busConfig->intrPriority;
+        serialBuses[bus].intrConfig.intrHandlerPtr = serialIsrMap[bus];
+
+        intrInitStatus =
+                NexaWatt_Hal_Infineon_Cat1B_Intr_Init(&serialBuses[bus].intrConfig);
+    }
+
+    if (intrInitStatus == NW_HAL_INTR_INIT_SUCCESS)
+    {
+        NexaWatt_Hal_Infineon_Cat1B_Intr_Enable(&serialBuses[bus].intrConfig);
+        Cy_SCB_I2C_Enable(scbBase);
+
+        retRes = NW_SERIAL_SUCCESS;
+    }
+    else if (i2cInitRes == CY_SCB_I2C_SUCCESS)
+    {
+        // The initialized SCB is returned to its reset state, so the bus can be initialized again
+        Cy_SCB_I2C_DeInit(scbBase);
+        retRes = (isDataRateValid == nwTrue) ? NW_SERIAL_FATAL_ERR : NW_SERIAL_BAD_PARAM;
+    }
+    else
+    {
+        // The SCB initialization failed, nothing to release
+    }
+
+    return retRes;
+}
+
+static NexaWattSerialStatusResult NexaWatt_Hal_Infineon_Cat1B_Serial_Start_Spi(const uint8 bus, const NexaWattSerialTransfer* const transfer)
+{
+    NexaWattSerialStatusResult retRes = NW_SERIAL_BAD_PARAM;
+    CySCB_Type* const scbBase = NW_HAL_INFINEON_CAT1B_SERIAL_GET_SCB(bus);
+    NwSerialLength frameLen = (transfer->txLen > transfer->rxLen) ? transfer->txLen : transfer->rxLen;
+    NwSerialLength txDataLen = (transfer->txData != NULL) ? transfer->txLen : 0u;
+    NwSerialLength rxDataLen = (transfer->rxData != NULL) ? transfer->rxLen : 0u;
+    cy_stc_dma_descriptor_t* txFirstDescriptor = NULL;
+    cy_stc_dma_descriptor_t* rxFirstDescriptor = NULL;
+
+    if (frameLen <= NW_HAL_INFINEON_CAT1B_SERIAL_DMA_MAX_LEN)
+    {
+        retRes = NW_SERIAL_FATAL_ERR;
+
+        txFirstDescriptor = NexaWatt_Hal_Infineon_Cat1B_Serial_Init_Dma_Chain(serialBuses[bus].txDescriptors, nwTrue, (void*)&SCB_TX_FIFO_WR(scbBase),
+                                                                              (void*)transfer->txData, txDataLen, frameLen);
+        rxFirstDescriptor = NexaWatt_Hal_Infineon_Cat1B_Serial_Init_Dma_Chain(serialBuses[bus].rxDescriptors, nwFalse, (void*)&SCB_RX_FIFO_RD(scbBase),
+                                                                              (void*)transfer->rxData, rxDataLen, frameLen);
+    }
+
+    if ((txFirstDescriptor != NULL) &&
+        (rxFirstDescriptor != NULL))
+    {
+        serialBuses[bus].activeTransfer = transfer;
+        Cy_SCB_SPI_SetActiveSlaveSelect(scbBase, (cy_en_scb_spi_slave_select_t)transfer->address);
+
+        // The RX channel is enabled first, so no received byte is missed once the TX channel fills the FIFO
+        Cy_DMA_Channel_SetDescriptor(NW_HAL_INFINEON_CAT1B_SERIAL_DMA_BASE, serialDmaRxChannelMap[bus], rxFirstDescriptor);
+        Cy_DMA_Channel_Enable(NW_HAL_INFINEON_CAT1B_SERIAL_DMA_BASE, serialDmaRxChannelMap[bus]);
+        Cy_DMA_Channel_SetDescriptor(NW_HAL_INFINEON_CAT1B_SERIAL_DMA_BASE, serialDmaTxChannelMap[bus], txFirstDescriptor);
+        Cy_DMA_Channel_Enable(NW_HAL_INFINEON_CAT1B_SERIAL_DMA_BASE, serialDmaTxChannelMap[bus]);
+
+        retRes = NW_SERIAL_SUCCESS;
+    }
+
+    return retRes;
+}
+
+static NexaWattSerialStatusResult NexaWatt_Hal_Infineon_Cat1B_Serial_Start_I2c(const uint8 bus, const NexaWattSerialTransfer* const transfer)
+{
+    NexaWattSerialStatusResult retRes = NW_SERIAL_BAD_PARAM;
+    CySCB_Type* const scbBase = NW_HAL_INFINEON_CAT1B_SERIAL_GET_SCB(bus);
+    cy_stc_scb_i2c_master_xfer_config_t* const xferConfig = &serialBuses[bus].i2cXferConfig;
+    cy_en_scb_i2c_status_t i2cXferRes = CY_SCB_I2C_BAD_PARAM;
+
+    if (((transfer->txLen == 0u) || (transfer->txData != NULL)) &&
+        ((transfer->rxLen == 0u) || (transfer->rxData != NULL)))
+    {
+        serialBuses[bus].activeTransfer = transfer;
+
+        // The read is started from the write completion event, after a repeated start
+        xferConfig->slaveAddress = transfer->address;
+        if (transfer->txLen > 0u)
+        {
+            xferConfig->buffer = (uint8*)transfer->txData;
+            xferConfig->bufferSize = transfer->txLen;
+            xferConfig->xferPending = (transfer->rxLen > 0u);
+            i2cXferRes = Cy_SCB_I2C_MasterWrite(scbBase, xferConfig, &serialBuses[bus].i2cContext);
+        }
+        else
+        {
+            xferConfig->buffer = transfer->rxData;
+            xferConfig->bufferSize = transfer->rxLen;
+            xferConfig->xferPending = false;
+            i2cXferRes = Cy_SCB_I2C_MasterRead(scbBase, xferConfig, &serialBuses[bus].i2cContext);
+        }
+
+        if (i2cXferRes == CY_SCB_I2C_SUCCESS)
+        {
+            retRes = NW_SERIAL_SUCCESS;
+        }
+        else
+        {
+            serialBuses[bus].activeTransfer = NULL;
+            retRes = NW_SERIAL_BUS_ERR;
+        }
+    }
+
+    return retRes;
+}
+
+static cy_stc_dma_descriptor_t* NexaWatt_Hal_Infineon_Cat1B_Serial_Init_Dma_Chain(cy_stc_dma_descriptor_t* const descriptors, const nw_bool isTx, void* const fifoAddr,
+                                                                                   void* const dataAddr, const NwSerialLength dataLen, const NwSerialLength frameLen)
+{
+    cy_stc_dma_descriptor_t* retDescriptor = NULL;
+    cy_stc_dma_descriptor_config_t descriptorConfig;
+    cy_en_dma_status_t dataDmaStatus = CY_DMA_SUCCESS;
+    cy_en_dma_status_t paddingDmaStatus = CY_DMA_SUCCESS;
+    void* const paddingAddr = (isTx == nwTrue) ? (void*)&serialDummyTxByte : (void*)&serialDummyRxByte;
+
+    // One byte is moved per FIFO trigger; the channel is disabled at the end of the chain
+    descriptorConfig.retrigger = CY_DMA_RETRIG_4CYC;
+    descriptorConfig.interruptType = CY_DMA_DESCR_CHAIN;
+    descriptorConfig.triggerOutType = CY_DMA_DESCR_CHAIN;
+    descriptorConfig.triggerInType = CY_DMA_1ELEMENT;
+    descriptorConfig.dataSize = CY_DMA_BYTE;
+    descriptorConfig.srcTransferSize = (isTx == nwTrue) ? CY_DMA_TRANSFER_SIZE_DATA : CY_DMA_TRANSFER_SIZE_WORD;
+    descriptorConfig.dstTransferSize = (isTx == nwTrue) ? CY_DMA_TRANSFER_SIZE_WORD : CY_DMA_TRANSFER_SIZE_DATA;
+    descriptorConfig.descriptorType = CY_DMA_1D_TRANSFER;
+    descriptorConfig.srcYincrement = 0;
+    descriptorConfig.dstYincrement = 0;
+    descriptorConfig.yCount = 1u;
+
+    if (frameLen > dataLen)
+    {
+        descriptorConfig.channelState = CY_DMA_CHANNEL_DISABLED;
+        descriptorConfig.srcAddress = (isTx == nwTrue) ? paddingAddr : fifoAddr;
+        descriptorConfig.dstAddress = (isTx == nwTrue) ? fifoAddr : paddingAddr;
+        descriptorConfig.srcXincrement = 0;
+        descriptorConfig.dstXincrement = 0;
+        descriptorConfig.xCount = (uint32)frameLen - (uint32)dataLen;
+        descriptorConfig.nextDescriptor = NULL;
+        paddingDmaStatus = Cy_DMA_Descriptor_Init(&descriptors[1u], &descriptorConfig);
+        retDescriptor = &descriptors[1u];
+    }
+
+    if (dataLen > 0u)
+    {
+        descriptorConfig.channelState = (frameLen > dataLen) ? CY_DMA_CHANNEL_ENABLED : CY_DMA_CHANNEL_DISABLED;
+        descriptorConfig.srcAddress = (isTx == nwTrue) ? dataAddr : fifoAddr;
+        descriptorConfig.dstAddress = (isTx == nwTrue) ? fifoAddr : dataAddr;
+        descriptorConfig.srcXincrement = (isTx == nwTrue) ? 1 : 0;
+        descriptorConfig.dstXincrement = (isTx == nwTrue) ? 0 : 1;
+        descriptorConfig.xCount = dataLen;
+        descriptorConfig.nextDescriptor = retDescriptor;
+        dataDmaStatus = Cy_DMA_Descriptor_Init(&descriptors[0u], &descriptorConfig);
+        retDescriptor = &descriptors[0u];
+    }
+
+    return ((dataDmaStatus == CY_DMA_SUCCESS) && (paddingDmaStatus == CY_DMA_SUCCESS)) ? retDescriptor : NULL;
+}
+
+static void NexaWatt_Hal_Infineon_Cat1B_Serial_Complete_Transfer(const uint8 bus, const NexaWattSerialStatusResult transferStatus)
+{
+    if (serialBuses[bus].activeTransfer != NULL)
+    {
+        // The transfer is released before the handler, so the handler can start the next one
+        serialBuses[bus].activeTransfer = NULL;
+        serialBuses[bus].transferHandler(bus, transferStatus);
+    }
+}
+
+static void NexaWatt_Hal_Infineon_Cat1B_Serial_Handle_Isr(const uint8 bus)
+{
+    cy_en_dma_intr_cause_t dmaIntrCause = CY_DMA_INTR_CAUSE_NO_INTR;
+
+    if (serialBuses[bus].busType == NW_SERIAL_BUS_SPI)
+    {
+        dmaIntrCause = Cy_DMA_Channel_GetStatus(NW_HAL_INFINEON_CAT1B_SERIAL_DMA_BASE, serialDmaRxChannelMap[bus]);
+        Cy_DMA_Channel_ClearInterrupt(NW_HAL_INFINEON_CAT1B_SERIAL_DMA_BASE, serialDmaRxChannelMap[bus]);
+
+        NexaWatt_Hal_Infineon_Cat1B_Serial_Complete_Transfer(bus, (dmaIntrCause == CY_DMA_INTR_CAUSE_COMPLETION) ? NW_SERIAL_SUCCESS : NW_SERIAL_BUS_ERR);
+    }
+    else
+    {
+        Cy_SCB_I2C_Interrupt(NW_HAL_INFINEON_CAT1B_SERIAL_GET_SCB(bus), &serialBuses[bus].i2cContext);
+    }
+}
+
+static void NexaWatt_Hal_Infineon_Cat1B_Serial_Handle_I2c_Event(const uint8 bus, const uint32 i2cEvent)
+{
+    const NexaWattSerialTransfer* const transfer = serialBuses[bus].activeTransfer;
+    cy_stc_scb_i2c_master_xfer_config_t* const xferConfig = &serialBuses[bus].i2cXferConfig;
+    cy_en_scb_i2c_status_t i2cXferRes = CY_SCB_I2C_SUCCESS;
+
+    if (transfer == NULL)
+    {
+        // Event of an aborted transfer
+    }
+    else if ((i2cEvent & CY_SCB_I2C_MASTER_ERR_EVENT) != 0u)
+    {
+        NexaWatt_Hal_Infineon_Cat1B_Serial_Complete_Transfer(bus, NW_SERIAL_BUS_ERR);
+    }
+    else if (((i2cEvent & CY_SCB_I2C_MASTER_WR_CMPLT_EVENT) != 0u) &&
+             (transfer->rxLen > 0u))
+    {
+        xferConfig->buffer = transfer->rxData;
+        xferConfig->bufferSize = transfer->rxLen;
+        xferConfig->xferPending = false;
+        i2cXferRes = Cy_SCB_I2C_MasterRead(NW_HAL_INFINEON_CAT1B_SERIAL_GET_SCB(bus), xferConfig, &serialBuses[bus].i2cContext);
+        if (i2cXferRes != CY_SCB_I2C_SUCCESS)
+        {
+            NexaWatt_Hal_Infineon_Cat1B_Serial_Complete_Transfer(bus, NW_SERIAL_BUS_ERR);
+        }
+    }
+    else if ((i2cEvent & (CY_SCB_I2C_MASTER_WR_CMPLT_EVENT | CY_SCB_I2C_MASTER_RD_CMPLT_EVENT)) != 0u)
+    {
+        NexaWatt_Hal_Infineon_Cat1B_Serial_Complete_Transfer(bus, NW_SERIAL_SUCCESS);
+    }
+    else
+    {
+        // Events not related to the completion of the transfer
+    }
+}
+
+static void NexaWatt_Hal_Infineon_Cat1B_Serial_Bus_0_Isr(void)
+{
+    NexaWatt_Hal_Infineon_Cat1B_Serial_Handle_Isr(0u);
+}
+
+static void NexaWatt_Hal_Infineon_Cat1B_Serial_Bus_1_Isr(void)
+{
+    NexaWatt_Hal_Infineon_Cat1B_Serial_Handle_Isr(1u);
+}
+
+static void NexaWatt_Hal_Infineon_Cat1B_Serial_Bus_0_I2c_Event(const uint32_t i2cEvent)
+{
+    NexaWatt_Hal_Infineon_Cat1B_Serial_Handle_I2c_Event(0u, i2cEvent);
+}
+
+static void NexaWatt_Hal_Infineon_Cat1B_Serial_Bus_1_I2c_Event(const uint32_t i2cEvent)
+{
+    NexaWatt_Hal_Infineon_Cat1B_Serial_Handle_I2c_Event(1u, i2cEvent);
+}
+
+//#endif
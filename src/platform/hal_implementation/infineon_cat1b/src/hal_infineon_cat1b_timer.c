@@ -0,0 +1,248 @@
+/*******************************************************************************
+* File Name:   hal_infineon_cat1b_timer.c
+*
+* Description: This is the source file containing definitions,
+* related to the HAL implementation for the hardware timers of the Infineon CAT1B devices.
+* The NexaWatt-IV.DC framework offers custom implemented HAL for several Infineon devices.
+* The implementation of the current HAL is dependent on the PDL, provided by Infineon Technologies.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+// TODO: Uncomment the pre-processor defence after development
+// Prevents the compilation of the HAL Implementation in case of missing PDL
+//#ifdef CY_TCPWM_COUNTER_H
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "hal_infineon_cat1b_timer.h"
+#include "hal_infineon_cat1b_intr.h"
+#include "cy_tcpwm_counter.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Number of TCPWM counters used as timers for Infineon CAT1B devices.
+ */
+#define NW_HAL_INFINEON_CAT1B_TIMER_CNT                 (2u)
+
+/**
+ * \brief TCPWM peripheral instance, containing the counters used as timers.
+ */
+#define NW_HAL_INFINEON_CAT1B_TIMER_BASE                (TCPWM0)
+
+/**
+ * \brief Number of the TCPWM counter group, containing the counters used as timers.
+ * The timers count the full 32-bit range, so the counters of the group must be 32 bits wide.
+ */
+#define NW_HAL_INFINEON_CAT1B_TIMER_GRP                 (1u)
+#define NW_HAL_INFINEON_CAT1B_TIMER_GRP_CNT_WIDTH       (TCPWM_GRP_NR1_CNT_GRP_CNT_WIDTH)
+
+/**
+ * \brief Frequency of the counter clock, before the prescaler of the counter. Must match the clock,
+ * assigned with the device configurator. The timer frequencies are derived by the prescaler (1 to 128).
+ */
+#define NW_HAL_INFINEON_CAT1B_TIMER_CLK_HZ              (8000000u)
+
+/**
+ * \brief Number of the largest prescaler setting (CY_TCPWM_COUNTER_PRESCALER_DIVBY_128 = division by 2^7).
+ */
+#define NW_HAL_INFINEON_CAT1B_TIMER_PRESCALER_SHIFT_MAX (7u)
+
+/**
+ * \brief Macro returning the TCPWM counter number corresponding to a provided timer.
+ */
+#define NW_HAL_INFINEON_CAT1B_TIMER_GET_CNT_NUM(timer) \
+    (timerCounterNumMap[timer])
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+/**
+ * \brief Array containing mapping between the timer number (index) and the
+ * counter number of the TCPWM peripheral (the group number is encoded in the bits 8 and above).
+ * The PWM channels use the 16-bit counters of the group 0, the timers the 32-bit counters of the group 1.
+ */
+static const uint32 timerCounterNumMap[] =
+{
+    (NW_HAL_INFINEON_CAT1B_TIMER_GRP << 8u) | 0u,
+    (NW_HAL_INFINEON_CAT1B_TIMER_GRP << 8u) | 1u,
+};
+
+/**
+ * \brief Array containing mapping between the timer number (index) and the
+ * interrupt source of the TCPWM counter.
+ */
+static const uint32 timerIntrSourcesMap[] =
+{
+    tcpwm_0_interrupts_256_IRQn,
+    tcpwm_0_interrupts_257_IRQn,
+};
+
+NW_STATIC_ASSERT((sizeof(timerCounterNumMap) / sizeof(timerCounterNumMap[0u])) == NW_HAL_INFINEON_CAT1B_TIMER_CNT, timer_counter_map_size);
+NW_STATIC_ASSERT((sizeof(timerIntrSourcesMap) / sizeof(timerIntrSourcesMap[0u])) == NW_HAL_INFINEON_CAT1B_TIMER_CNT, timer_intr_map_size);
+NW_STATIC_ASSERT(NW_HAL_INFINEON_CAT1B_TIMER_GRP_CNT_WIDTH == 32u, timer_counter_width);
+NW_STATIC_ASSERT(sizeof(NwTimerTicks) == sizeof(uint32), timer_ticks_width);
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that derives the prescaler of the counter from the timer frequency.
+ * \param frequencyHz - The requested timer frequency.
+ * \param prescaler - A pointer to the prescaler setting to be filled in.
+ * \return nwTrue - The frequency is the counter clock, divided by a power of two up to 128.
+ * \return nwFalse - The frequency cannot be derived from the counter clock.
+ */
+static nw_bool NexaWatt_Hal_Infineon_Cat1B_Timer_Get_Prescaler(uint32 frequencyHz, uint32* prescaler);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattTimerStatusResult NexaWatt_Hal_Infineon_Cat1B_Timer_Init(const uint8 timer, const NexaWattTimerConfig* const timerConfig)
+{
+    NexaWattTimerStatusResult retRes = NW_TIMER_BAD_PARAM;
+    cy_stc_tcpwm_counter_config_t userCounterConfig = { 0 };
+    cy_rslt_t counterInitRes = CY_RSLT_SUCCESS;
+    NexaWattIntrInitConfig intrInitConfig;
+    NexaWattIntrInitStatus intrInitStatus = NW_HAL_INTR_INIT_SUCCESS;
+    uint32 prescaler = CY_TCPWM_COUNTER_PRESCALER_DIVBY_1;
+
+    if ((timer < NW_HAL_INFINEON_CAT1B_TIMER_CNT) &&
+        (timerConfig != NULL) &&
+        (timerConfig->periodTicks > 0u) &&
+        (NexaWatt_Hal_Infineon_Cat1B_Timer_Get_Prescaler(timerConfig->frequencyHz, &prescaler) == nwTrue))
+    {
+        retRes = NW_TIMER_FATAL_ERR;
+
+        userCounterConfig.period = timerConfig->periodTicks;
+        userCounterConfig.clockPrescaler = prescaler;
+        userCounterConfig.runMode = CY_TCPWM_COUNTER_CONTINUOUS;
+        userCounterConfig.countDirection = CY_TCPWM_COUNTER_COUNT_UP;
+        userCounterConfig.compareOrCapture = CY_TCPWM_COUNTER_MODE_COMPARE;
+        userCounterConfig.interruptSources = (timerConfig->overflowIsrPtr != NULL) ? CY_TCPWM_INT_ON_TC : CY_TCPWM_INT_NONE;
+        userCounterConfig.countInputMode = CY_TCPWM_INPUT_LEVEL;
+        userCounterConfig.countInput = CY_TCPWM_INPUT_1;
+
+        counterInitRes = Cy_TCPWM_Counter_Init(NW_HAL_INFINEON_CAT1B_TIMER_BASE, NW_HAL_INFINEON_CAT1B_TIMER_GET_CNT_NUM(timer), &userCounterConfig);
+        if ((counterInitRes == CY_RSLT_SUCCESS) &&
+            (timerConfig->overflowIsrPtr != NULL))
+        {
+            intrInitConfig.intrSource = timerIntrSourcesMap[timer];
+            intrInitConfig.intrPriority = timerConfig->intrPriority;
+            intrInitConfig.intrHandlerPtr = timerConfig->overflowIsrPtr;
+
+            intrInitStatus =
+                    NexaWatt_Hal_Infineon_Cat1B_Intr_Init(&intrInitConfig);
+            if (intrInitStatus == NW_HAL_INTR_INIT_SUCCESS)
+            {
+                NexaWatt_Hal_Infineon_Cat1B_Intr_Enable(&intrInitConfig);
+            }
+        }
+
+        if ((counterInitRes == CY_RSLT_SUCCESS) &&
+            (intrInitStatus == NW_HAL_INTR_INIT_SUCCESS))
+        {
+            Cy_TCPWM_Counter_SetCounter(NW_HAL_INFINEON_CAT1B_TIMER_BASE, NW_HAL_INFINEON_CAT1B_TIMER_GET_CNT_NUM(timer), 0u);
+            Cy_TCPWM_Counter_Enable(NW_HAL_INFINEON_CAT1B_TIMER_BASE, NW_HAL_INFINEON_CAT1B_TIMER_GET_CNT_NUM(timer));
+
+            retRes = NW_TIMER_SUCCESS;
+        }
+    }
+
+    return retRes;
+}
+
+NexaWattTimerStatusResult NexaWatt_Hal_Infineon_Cat1B_Timer_DeInit(const uint8 timer)
+{
+    NexaWattTimerStatusResult retRes = NW_TIMER_BAD_PARAM;
+    NexaWattIntrInitConfig intrInitConfig;
+
+    if (timer < NW_HAL_INFINEON_CAT1B_TIMER_CNT)
+    {
+        Cy_TCPWM_TriggerStopOrKill_Single(NW_HAL_INFINEON_CAT1B_TIMER_BASE, NW_HAL_INFINEON_CAT1B_TIMER_GET_CNT_NUM(timer));
+        Cy_TCPWM_Counter_Disable(NW_HAL_INFINEON_CAT1B_TIMER_BASE, NW_HAL_INFINEON_CAT1B_TIMER_GET_CNT_NUM(timer));
+        Cy_TCPWM_SetInterruptMask(NW_HAL_INFINEON_CAT1B_TIMER_BASE, NW_HAL_INFINEON_CAT1B_TIMER_GET_CNT_NUM(timer), CY_TCPWM_INT_NONE);
+
+        intrInitConfig.intrSource = timerIntrSourcesMap[timer];
+        intrInitConfig.intrPriority = 0u;
+        intrInitConfig.intrHandlerPtr = NULL;
+        NexaWatt_Hal_Infineon_Cat1B_Intr_Disable(&intrInitConfig);
+
+        retRes = NW_TIMER_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattTimerStatusResult NexaWatt_Hal_Infineon_Cat1B_Timer_Start(const uint8 timer)
+{
+    NexaWattTimerStatusResult retRes = NW_TIMER_BAD_PARAM;
+
+    if (NW_RUNTIME_CHECK(timer < NW_HAL_INFINEON_CAT1B_TIMER_CNT))
+    {
+        Cy_TCPWM_TriggerStart_Single(NW_HAL_INFINEON_CAT1B_TIMER_BASE, NW_HAL_INFINEON_CAT1B_TIMER_GET_CNT_NUM(timer));
+
+        retRes = NW_TIMER_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NexaWattTimerStatusResult NexaWatt_Hal_Infineon_Cat1B_Timer_Stop(const uint8 timer)
+{
+    NexaWattTimerStatusResult retRes = NW_TIMER_BAD_PARAM;
+
+    if (NW_RUNTIME_CHECK(timer < NW_HAL_INFINEON_CAT1B_TIMER_CNT))
+    {
+        Cy_TCPWM_TriggerStopOrKill_Single(NW_HAL_INFINEON_CAT1B_TIMER_BASE, NW_HAL_INFINEON_CAT1B_TIMER_GET_CNT_NUM(timer));
+
+        retRes = NW_TIMER_SUCCESS;
+    }
+
+    return retRes;
+}
+
+NwTimerTicks NexaWatt_Hal_Infineon_Cat1B_Timer_Read_Counter(const uint8 timer)
+{
+    return (NwTimerTicks)Cy_TCPWM_Counter_GetCounter(NW_HAL_INFINEON_CAT1B_TIMER_BASE, NW_HAL_INFINEON_CAT1B_TIMER_GET_CNT_NUM(timer));
+}
+
+nw_bool NexaWatt_Hal_Infineon_Cat1B_Timer_Get_Overflow_Status(const uint8 timer)
+{
+    uint32 intrStatus = Cy_TCPWM_GetInterruptStatus(NW_HAL_INFINEON_CAT1B_TIMER_BASE, NW_HAL_INFINEON_CAT1B_TIMER_GET_CNT_NUM(timer));
+
+    return ((intrStatus & CY_TCPWM_INT_ON_TC) != 0u) ? nwTrue : nwFalse;
+}
+
+void NexaWatt_Hal_Infineon_Cat1B_Timer_Clear_Overflow_Status(const uint8 timer)
+{
+    Cy_TCPWM_ClearInterrupt(NW_HAL_INFINEON_CAT1B_TIMER_BASE, NW_HAL_INFINEON_CAT1B_TIMER_GET_CNT_NUM(timer), CY_TCPWM_INT_ON_TC);
+}
+
+static nw_bool NexaWatt_Hal_Infineon_Cat1B_Timer_Get_Prescaler(const uint32 frequencyHz, uint32* const prescaler)
+{
+    nw_bool retRes = nwFalse;
+    uint32 prescalerShift = 0u;
+
+    // The prescaler settings are numbered by the power of two they divide by
+    for (prescalerShift = 0u; prescalerShift <= NW_HAL_INFINEON_CAT1B_TIMER_PRESCALER_SHIFT_MAX; prescalerShift++)
+    {
+        if ((retRes == nwFalse) &&
+            (frequencyHz == (NW_HAL_INFINEON_CAT1B_TIMER_CLK_HZ >> prescalerShift)) &&
+            ((NW_HAL_INFINEON_CAT1B_TIMER_CLK_HZ & ((1u << prescalerShift) - 1u)) == 0u))
+        {
+            *prescaler = CY_TCPWM_COUNTER_PRESCALER_DIVBY_1 + prescalerShift;
+            retRes = nwTrue;
+        }
+    }
+
+    return retRes;
+}
+//#endif
@@ -0,0 +1,99 @@
+/*******************************************************************************
+* File Name:   hal_infineon_cat1b_wdt.c
+*
+* Description: This is the source file containing definitions,
+* related to the HAL implementation for the hardware watchdog of the Infineon CAT1B devices.
+* The NexaWatt-IV.DC framework offers custom implemented HAL for several Infineon devices.
+* The implementation of the current HAL is dependent on the PDL, provided by Infineon Technologies.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+// TODO: Uncomment the pre-processor defence after development
+// Prevents the compilation of the HAL Implementation in case of missing PDL
+//#ifdef CY_WDT_H
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "hal_infineon_cat1b_wdt.h"
+#include "cy_wdt.h"
+#include "cy_syslib.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Nominal frequency of the ILO, clocking the WDT. The ILO tolerance shortens or extends the timeout accordingly.
+ */
+#define NW_HAL_INFINEON_CAT1B_WDT_CLK_HZ                (32768u)
+
+/**
+ * \brief Number of unserviced matches of the WDT counter, after which the device is reset (see the device TRM).
+ */
+#define NW_HAL_INFINEON_CAT1B_WDT_MATCHES_TO_RESET      (3u)
+
+/**
+ * \brief Maximum match value of the WDT counter, used without ignored bits.
+ */
+#define NW_HAL_INFINEON_CAT1B_WDT_MAX_MATCH             (0xFFFFu)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattWdtStatusResult NexaWatt_Hal_Infineon_Cat1B_Wdt_Init(const NexaWattWdtConfig* const wdtConfig)
+{
+    NexaWattWdtStatusResult retRes = NW_WDT_BAD_PARAM;
+    uint64 matchTicks = 0u;
+
+    if (wdtConfig != NULL)
+    {
+        matchTicks = ((uint64)wdtConfig->timeoutUs * NW_HAL_INFINEON_CAT1B_WDT_CLK_HZ) /
+                     (1000000u * (uint64)NW_HAL_INFINEON_CAT1B_WDT_MATCHES_TO_RESET);
+    }
+
+    if ((matchTicks > 0u) &&
+        (matchTicks <= NW_HAL_INFINEON_CAT1B_WDT_MAX_MATCH))
+    {
+        retRes = NW_WDT_FATAL_ERR;
+
+        Cy_WDT_Unlock();
+        Cy_WDT_Disable();
+        Cy_WDT_Init();
+        Cy_WDT_SetIgnoreBits(0u);
+        Cy_WDT_SetMatch((uint32)matchTicks);
+        Cy_WDT_ClearWatchdog();
+        Cy_WDT_Enable();
+        Cy_WDT_Lock();
+
+        if (Cy_WDT_IsEnabled() == true)
+        {
+            retRes = NW_WDT_SUCCESS;
+        }
+    }
+
+    return retRes;
+}
+
+void NexaWatt_Hal_Infineon_Cat1B_Wdt_Kick(void)
+{
+    Cy_WDT_ClearWatchdog();
+}
+
+nw_bool NexaWatt_Hal_Infineon_Cat1B_Wdt_Get_Reset_Status(void)
+{
+    return ((Cy_SysLib_GetResetReason() & CY_SYSLIB_RESET_HWWDT) != 0u) ? nwTrue : nwFalse;
+}
+//#endif
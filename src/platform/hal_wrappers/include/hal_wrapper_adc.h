@@ -0,0 +1,135 @@
+/*******************************************************************************
+* File Name:   hal_wrapper_adc.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the HAL Wrapper for the ADC peripheral. This wrapper is directly
+* used by the NexaWatt-IV.DC framework and aims to provide maximum level of
+* abstraction on the used MCU. A conversion sequence is started by a PWM (or software)
+* trigger and its results are transferred by the DMA into one of two sample frames.
+* While the DMA fills one frame, the other one is handed to the control pipeline
+* by the end-of-sequence callback, without copying.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_HAL_WRAPPER_ADC_H
+#define NEXAWATT_IV_DC_HAL_WRAPPER_ADC_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Maximum number of conversions in a sequence (samples in a frame).
+ */
+#define NW_ADC_MAX_SEQUENCE_LEN     (16u)
+
+/**
+ * \brief Number of sample frames used by the DMA (ping-pong).
+ */
+#define NW_ADC_FRAME_CNT            (2u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+/**
+ * \brief Sample frame handed to the end-of-sequence callback. The samples are ordered as the channel list
+ * of the sequence and point directly to the DMA destination buffer.
+ */
+typedef struct sNexaWattADCFrame
+{
+    const NwAdcSample* samples;
+    uint8 sampleCnt;
+    uint32 sequenceCnt;
+    uint32 latencyTicks;
+} NexaWattADCFrame;
+
+/**
+ * \brief Trigger to callback latency statistics, expressed in the ticks of the triggering PWM counter.
+ */
+typedef struct sNexaWattADCLatencyStats
+{
+    uint32 minTicks;
+    uint32 maxTicks;
+    uint32 lastTicks;
+    uint32 frameCnt;
+} NexaWattADCLatencyStats;
+
+typedef void(*NwAdcFrameCallback)(const NexaWattADCFrame* frame);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Wrapper function used to initialize the conversion sequence and the DMA transfer into the sample frames.
+ *
+ * This function uses the HAL Context to obtain the appropriate implementation for ADC sequence initialization.
+ * The sequence is initialized stopped. The latency statistics are reset.
+ * If the selected MCU is not supported and no user-defined initialization function has been registered, the function will assert and cause a fault.
+ *
+ * \param sequenceConfig - A pointer, containing the framework's standardized ADC sequence configuration structure.
+ * \param frameCallback - The end-of-sequence callback, executed in the DMA interrupt context for each filled frame.
+ *
+ * \return NW_ADC_BAD_PARAM - The validation of the provided sequence configuration failed.
+ * \return NW_ADC_FATAL_ERR - The initialization of the ADC or the DMA failed.
+ * \return NW_ADC_SUCCESS - The sequence is configured and ready to be started.
+ */
+NexaWattADCStatusResult NexaWatt_HalWrapperAdc_Init_Sequence(const NexaWattADCSequenceConfig* sequenceConfig, NwAdcFrameCallback frameCallback);
+
+/**
+ * \brief Wrapper function used to de-initialize the conversion sequence. No callback is executed after the de-initialization.
+ *
+ * \return NW_ADC_SUCCESS - The sequence is de-initialized.
+ */
+NexaWattADCStatusResult NexaWatt_HalWrapperAdc_DeInit_Sequence(void);
+
+/**
+ * \brief Wrapper function used to start the conversion sequence. The first frame filled after the start is frame 0.
+ *
+ * \return NW_ADC_BAD_PARAM - The sequence is not initialized.
+ * \return NW_ADC_SUCCESS - The sequence is started and reacts on its trigger.
+ */
+NexaWattADCStatusResult NexaWatt_HalWrapperAdc_Start(void);
+
+/**
+ * \brief Wrapper function used to stop the conversion sequence. A conversion already in progress is discarded.
+ *
+ * \return NW_ADC_SUCCESS - The sequence is stopped.
+ */
+NexaWattADCStatusResult NexaWatt_HalWrapperAdc_Stop(void);
+
+/**
+ * \brief Wrapper function used to trigger the conversion sequence by software.
+ * Can be used with both trigger sources, e.g. for offset calibration before the PWM is started.
+ *
+ * \return NW_ADC_BAD_PARAM - The sequence is not started.
+ * \return NW_ADC_SUCCESS - The sequence is triggered.
+ */
+NexaWattADCStatusResult NexaWatt_HalWrapperAdc_Software_Trigger(void);
+
+/**
+ * \brief Wrapper function used to obtain the trigger to callback latency statistics.
+ *
+ * \param latencyStats - A pointer to the structure, where the statistics are copied.
+ */
+void NexaWatt_HalWrapperAdc_Get_Latency_Stats(NexaWattADCLatencyStats* latencyStats);
+
+/**
+ * \brief Wrapper function used to reset the trigger to callback latency statistics.
+ */
+void NexaWatt_HalWrapperAdc_Reset_Latency_Stats(void);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+#endif
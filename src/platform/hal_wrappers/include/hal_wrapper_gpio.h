@@ -21,6 +21,15 @@
 /*******************************************************************************
 * Macros
 *******************************************************************************/
+/**
+ * \brief Number of pins of a GPIO port, handled by a single port initialization.
+ */
+#define NW_GPIO_PORT_PIN_CNT        (8u)
+
+/**
+ * \brief Pin mask selecting all pins of a GPIO port.
+ */
+#define NW_GPIO_PORT_ALL_PINS_MASK  (0xFFu)
 
 /*******************************************************************************
 * Type definitions
@@ -46,10 +55,29 @@
  *
  * \return NW_GPIO_BAD_PARAM - The validation of the provided pin configuration failed.
  * Please make sure that the provided port and pin numbers are existing for the Infineon CAT1B devices and use the provided enumerated types by the framework.
+ * \return NW_GPIO_RESOURCE_CONFLICT - The pin is already claimed in the resource registry by a previous initialization. The pin is not modified.
  * \return NW_GPIO_SUCCESS - The validation of the provided pin configuration was successful. The pin is configured and ready for use.
  */
 NexaWattGPIOStatusResult NexaWatt_HalWrapperGpio_Init_Digital_Pin(uint8 portNum, uint8 pinNum, const NexaWattGPIOPinConfig* pinConfig);
 
+/**
+ * \brief Wrapper function used to initialize several pins of a GPIO port at once.
+ *
+ * This function uses the HAL Context to obtain the appropriate implementation for GPIO port initialization.
+ * The configuration of all selected pins is merged into the port registers, so each register is written once
+ * per port instead of once per pin. The pins, which are not selected, keep their configuration.
+ * If the selected MCU is not supported and no user-defined initialization function has been registered, the function will assert and cause a fault.
+ *
+ * \param portNum - The number of the configured GPIO port.
+ * \param pinMask - The mask of the configured pins (bit n selects pin n).
+ * \param pinConfigs - An array of NW_GPIO_PORT_PIN_CNT pin configurations, indexed by the pin number. Only the selected entries are used.
+ *
+ * \return NW_GPIO_BAD_PARAM - The validation of one of the selected pin configurations failed. No pin is configured.
+ * \return NW_GPIO_RESOURCE_CONFLICT - One of the selected pins is already claimed in the resource registry. No pin is configured.
+ * \return NW_GPIO_SUCCESS - The selected pins are configured and ready for use.
+ */
+NexaWattGPIOStatusResult NexaWatt_HalWrapperGpio_Init_Port(uint8 portNum, uint8 pinMask, const NexaWattGPIOPinConfig* pinConfigs);
+
 /**
  * \brief Wrapper function used to assign an alternate function to a GPIO pin.
  *
@@ -96,6 +124,20 @@ NexaWattGPIOStatusResult NexaWatt_HalWrapperGpio_DeInit_Port(uint8 portNum);
  */
 NwGpioPinResult NexaWatt_HalWrapperGpio_Pin_Read(uint8 portNum, uint8 pinNum);
 
+/**
+ * \brief Wrapper function used for reading the logical values of all pins of a GPIO port at once.
+ *
+ * This function uses the HAL Context to access the input register of the specified GPIO port.
+ * It is typically used by the framework when several inputs of a port are sampled together, e.g. by the input debounce.
+ * If the MCU does not support reading and no user-defined function has been registered, the function will assert and fault.
+ *
+ * \param portNum - The number of the desired GPIO port for the read.
+ *
+ * \return The values in the input register of the port, bit n corresponding to pin n.
+ * Note that 0 is returned in case of non-existing port number.
+ */
+uint8 NexaWatt_HalWrapperGpio_Port_Read(uint8 portNum);
+
 /**
  * \brief Wrapper function used for writing a logical value to a GPIO pin.
  *
@@ -112,6 +154,23 @@ NwGpioPinResult NexaWatt_HalWrapperGpio_Pin_Read(uint8 portNum, uint8 pinNum);
  */
 NexaWattGPIOStatusResult NexaWatt_HalWrapperGpio_Pin_Write(uint8 portNum, uint8 pinNum, nw_bool value);
 
+/**
+ * \brief Wrapper function used for writing a logical value to several GPIO pins of a port at once.
+ *
+ * This function is used by the framework when a group of GPIO pins must change their output level at the same time,
+ * e.g. the gate disable pins of the power stage. The pins are written by a single register access where the MCU supports it.
+ * It retrieves the relevant HAL implementation from the HAL Context. If the current MCU is not supported and
+ * no user-defined implementation is registered, the function will assert and lead to a system fault.
+ *
+ * \param portNum - The number of the desired GPIO port for the write.
+ * \param pinMask - The mask of the written pins, bit n corresponding to pin n.
+ * \param value - The value to be written to the pins.
+ *
+ * \return NW_GPIO_BAD_PARAM - The provided port number does not exist.
+ * \return NW_GPIO_SUCCESS - The provided value is written to the pins of the mask.
+ */
+NexaWattGPIOStatusResult NexaWatt_HalWrapperGpio_Port_Write(uint8 portNum, uint8 pinMask, nw_bool value);
+
 /**
  * \brief Wrapper function used to toggle the state of a specified GPIO pin.
  *
@@ -142,6 +201,7 @@ NexaWattGPIOStatusResult NexaWatt_HalWrapperGpio_Pin_Toggle(uint8 portNum, uint8
  *
  * \return NW_GPIO_BAD_PARAM - The validation of the provided configuration failed. Please make sure that the combination of the port and pin number represents existing pin of the Infineon CAT1B devices.
  * Validate that the provided GPIO External Interrupt Request configuration is valid.
+ * \return NW_GPIO_RESOURCE_CONFLICT - The EXTI of the pin or the interrupt source of the port is already claimed in the resource registry.
  * \return NW_GPIO_SUCCESS - The provided External Interrupt Request source is initialized and enabled.
  */
 NexaWattGPIOStatusResult NexaWatt_HalWrapperGpio_Register_EXTI(uint8 portNum, uint8 pinNum, const NexaWattGPIOExtIRQConfig* extiConfig);
@@ -0,0 +1,165 @@
+/*******************************************************************************
+* File Name:   hal_wrapper_pwm.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the HAL Wrapper for the PWM peripheral. This wrapper is directly
+* used by the NexaWatt-IV.DC framework and aims to provide maximum level of
+* abstraction on the used MCU. The duty cycle updates of all channels are staged
+* in a RAM shadow and transferred to the buffered compare registers by a single
+* commit per control cycle, so the hardware applies them together at the next
+* period boundary.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_HAL_WRAPPER_PWM_H
+#define NEXAWATT_IV_DC_HAL_WRAPPER_PWM_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+#include "platform_fixed_point.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Maximum number of PWM channels handled by the HAL Wrapper shadow.
+ */
+#define NW_PWM_MAX_CHANNELS         (8u)
+
+/**
+ * \brief Macro returning the channel mask corresponding to a PWM channel.
+ */
+#define NW_PWM_CHANNEL_MASK(channel) \
+    ((NwPwmChannelMask)0x01u << (channel))
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Wrapper function used to initialize a PWM channel with the specified configuration.
+ *
+ * This function uses the HAL Context to obtain the appropriate implementation for PWM channel initialization.
+ * The channel is initialized stopped, with a duty cycle of 0. The period of the channel is stored in the
+ * HAL Wrapper shadow and used for the conversion of the staged duty cycles.
+ * If the selected MCU is not supported and no user-defined initialization function has been registered, the function will assert and cause a fault.
+ *
+ * \param channel - The number of the configured PWM channel.
+ * \param channelConfig - A pointer, containing the framework's standardized PWM channel configuration structure.
+ *
+ * \return NW_PWM_BAD_PARAM - The validation of the provided channel configuration failed.
+ * \return NW_PWM_SUCCESS - The PWM channel is configured and ready to be started.
+ */
+NexaWattPWMStatusResult NexaWatt_HalWrapperPwm_Init_Channel(uint8 channel, const NexaWattPWMChannelConfig* channelConfig);
+
+/**
+ * \brief Wrapper function used to de-initialize a PWM channel. The channel is stopped and removed from the shadow.
+ *
+ * \param channel - The number of the PWM channel to be de-initialized.
+ *
+ * \return NW_PWM_BAD_PARAM - The provided channel number does not exist.
+ * \return NW_PWM_SUCCESS - The PWM channel is de-initialized.
+ */
+NexaWattPWMStatusResult NexaWatt_HalWrapperPwm_DeInit_Channel(uint8 channel);
+
+/**
+ * \brief Wrapper function used to change the period of a PWM channel. The new period is applied at the next period boundary.
+ * The staged duty cycle of the channel is not rescaled; it must be staged again.
+ *
+ * \param channel - The number of the PWM channel.
+ * \param periodTicks - The new period in counter ticks.
+ *
+ * \return NW_PWM_BAD_PARAM - The provided channel number or period is invalid for the used device.
+ * \return NW_PWM_SUCCESS - The period is set.
+ */
+NexaWattPWMStatusResult NexaWatt_HalWrapperPwm_Set_Period(uint8 channel, NwPwmTicks periodTicks);
+
+/**
+ * \brief Wrapper function used to set the phase shift of a stopped PWM channel. The shift is applied by
+ * preloading the counter, so it takes effect on the next synchronous start.
+ *
+ * \param channel - The number of the PWM channel.
+ * \param phaseShift - The phase shift as fraction of the period (Q16.16), in the range [0, 1).
+ *
+ * \return NW_PWM_BAD_PARAM - The provided channel number or phase shift is invalid.
+ * \return NW_PWM_SUCCESS - The phase shift is set.
+ */
+NexaWattPWMStatusResult NexaWatt_HalWrapperPwm_Set_Phase(uint8 channel, NwQ16 phaseShift);
+
+/**
+ * \brief Wrapper function used to set the dead times of a complementary PWM channel.
+ *
+ * \param channel - The number of the PWM channel.
+ * \param deadTimeRiseTicks - The dead time inserted before the rising edge of the main output, in counter ticks.
+ * \param deadTimeFallTicks - The dead time inserted before the rising edge of the complementary output, in counter ticks.
+ *
+ * \return NW_PWM_BAD_PARAM - The provided channel number or dead time is invalid for the used device.
+ * \return NW_PWM_SUCCESS - The dead times are set.
+ */
+NexaWattPWMStatusResult NexaWatt_HalWrapperPwm_Set_Dead_Time(uint8 channel, NwPwmTicks deadTimeRiseTicks, NwPwmTicks deadTimeFallTicks);
+
+/**
+ * \brief Wrapper function used to start several PWM channels synchronously.
+ *
+ * \param channelMask - The mask of the PWM channels to be started (see NW_PWM_CHANNEL_MASK()).
+ *
+ * \return NW_PWM_BAD_PARAM - The mask contains non-existing channels.
+ * \return NW_PWM_SUCCESS - The PWM channels are started.
+ */
+NexaWattPWMStatusResult NexaWatt_HalWrapperPwm_Start(NwPwmChannelMask channelMask);
+
+/**
+ * \brief Wrapper function used to stop several PWM channels. The outputs are driven to their inactive level.
+ *
+ * \param channelMask - The mask of the PWM channels to be stopped (see NW_PWM_CHANNEL_MASK()).
+ *
+ * \return NW_PWM_BAD_PARAM - The mask contains non-existing channels.
+ * \return NW_PWM_SUCCESS - The PWM channels are stopped.
+ */
+NexaWattPWMStatusResult NexaWatt_HalWrapperPwm_Stop(NwPwmChannelMask channelMask);
+
+/**
+ * \brief Wrapper function used to stage the duty cycle of a PWM channel in the RAM shadow.
+ * The function only converts the duty cycle to counter ticks and marks the channel for the next commit;
+ * no peripheral register is written. The function performs no validation and is intended to be executed in the control ISR.
+ *
+ * \param channel - The number of an initialized PWM channel.
+ * \param duty - The duty cycle in Q15 format. Saturated to [0, NW_Q15_MAX], so a negative controller output gives a 0 % duty cycle.
+ */
+void NexaWatt_HalWrapperPwm_Stage_Duty(uint8 channel, NwQ15 duty);
+
+/**
+ * \brief Wrapper function used to stage a raw compare value of a PWM channel in the RAM shadow.
+ * The function performs no validation and is intended to be executed in the control ISR.
+ *
+ * \param channel - The number of an initialized PWM channel.
+ * \param compareTicks - The compare value in counter ticks.
+ */
+void NexaWatt_HalWrapperPwm_Stage_Compare(uint8 channel, NwPwmTicks compareTicks);
+
+/**
+ * \brief Wrapper function used to transfer all staged compare values to the buffered compare registers of the PWM peripheral.
+ *
+ * The staged channels are transferred by a single HAL call and applied by the hardware at the next period boundary,
+ * so the duty cycles of all channels change in the same switching period. Channels without staged values are not accessed.
+ * The function should be executed once per control cycle, after all duty cycles are staged.
+ * If the selected MCU is not supported and no user-defined implementation has been registered, the function will assert and cause a fault.
+ */
+void NexaWatt_HalWrapperPwm_Commit(void);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+#endif
@@ -0,0 +1,166 @@
+/*******************************************************************************
+* File Name:   hal_wrapper_serial.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the HAL Wrapper for the serial buses (SPI and I2C). This wrapper is directly
+* used by the NexaWatt-IV.DC framework and aims to provide maximum level of
+* abstraction on the used MCU. The transfers are non-blocking: a transaction (a batch
+* of transfers, e.g. the readout of all sensors on a bus) is queued and executed by the
+* HAL in the background, with DMA where the MCU supports it. The next transfer of a
+* batch is started from the completion interrupt of the previous one, so a batch
+* costs the CPU one short interrupt per transfer. When the batch is completed, its
+* callback is posted as a deferred event and executed by the main loop, outside of
+* the interrupt context (see nexa_mini_os_event.h).
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_HAL_WRAPPER_SERIAL_H
+#define NEXAWATT_IV_DC_HAL_WRAPPER_SERIAL_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Maximum number of serial buses handled by the HAL Wrapper.
+ */
+#define NW_SERIAL_MAX_BUSES         (4u)
+
+/**
+ * \brief Number of transactions, which can be queued on a bus (including the active one). Must be a power of two.
+ */
+#define NW_SERIAL_QUEUE_LEN         (8u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+typedef enum eNexaWattSerialTransactionState
+{
+    NW_SERIAL_TRANSACTION_IDLE      = 0x00u,
+    NW_SERIAL_TRANSACTION_QUEUED    = 0x01u,
+    NW_SERIAL_TRANSACTION_ACTIVE    = 0x02u,
+    NW_SERIAL_TRANSACTION_DONE      = 0x03u,
+} NexaWattSerialTransactionState;
+
+struct sNexaWattSerialTransaction;
+
+/**
+ * \brief Callback of a completed transaction, executed by the dispatch of the deferred events.
+ */
+typedef void(*NwSerialTransactionCallback)(struct sNexaWattSerialTransaction* transaction, NexaWattSerialStatusResult transactionStatus);
+
+/**
+ * \brief Transaction of the serial bus: a batch of transfers, executed in order without CPU involvement between them.
+ * The transaction and its transfers are owned by the caller and are used in place, so they must stay valid until the transaction is done.
+ * A transaction, which is not queued or active, can be submitted again, e.g. every polling period.
+ * The batch stops at the first failing transfer. The state and the status can be polled instead of using the callback.
+ */
+typedef struct sNexaWattSerialTransaction
+{
+    const NexaWattSerialTransfer* transfers;
+    uint8 transferCnt;
+    NwSerialTransactionCallback callback;
+    void* context;
+    volatile NexaWattSerialTransactionState state;
+    volatile NexaWattSerialStatusResult status;
+} NexaWattSerialTransaction;
+
+/**
+ * \brief Statistics of a serial bus. The lost callbacks were not posted, because the deferred event queue was full.
+ */
+typedef struct sNexaWattSerialStats
+{
+    uint32 completedCnt;
+    uint32 failedCnt;
+    uint32 transferCnt;
+    uint32 lostCallbackCnt;
+    uint8 maxQueuedCnt;
+} NexaWattSerialStats;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Wrapper function used to initialize a serial bus with the specified configuration.
+ *
+ * This function uses the HAL Context to obtain the appropriate implementation for serial bus initialization.
+ * The queue of the bus is emptied and its statistics are reset.
+ * If the selected MCU is not supported and no user-defined initialization function has been registered, the function will assert and cause a fault.
+ *
+ * \param bus - The number of the configured serial bus.
+ * \param busConfig - A pointer, containing the framework's standardized serial bus configuration structure.
+ *
+ * \return NW_SERIAL_BAD_PARAM - The validation of the provided bus configuration failed.
+ * \return NW_SERIAL_FATAL_ERR - The initialization of the bus, its DMA or its interrupts failed.
+ * \return NW_SERIAL_SUCCESS - The bus is configured and ready for transactions.
+ */
+NexaWattSerialStatusResult NexaWatt_HalWrapperSerial_Init_Bus(uint8 bus, const NexaWattSerialBusConfig* busConfig);
+
+/**
+ * \brief Wrapper function used to de-initialize a serial bus. The pending transactions are aborted first.
+ *
+ * \param bus - The number of the serial bus.
+ *
+ * \return NW_SERIAL_BAD_PARAM - The provided bus number does not exist.
+ * \return NW_SERIAL_SUCCESS - The bus is de-initialized.
+ */
+NexaWattSerialStatusResult NexaWatt_HalWrapperSerial_DeInit_Bus(uint8 bus);
+
+/**
+ * \brief Wrapper function used to submit a transaction. The function does not wait for the transfers; the transaction
+ * is started immediately, if the bus is idle, or queued behind the pending ones. Can be used from any context,
+ * including the transaction callbacks.
+ *
+ * \param bus - The number of the serial bus.
+ * \param transaction - A pointer to the transaction. Its state and status are updated by the wrapper.
+ *
+ * \return NW_SERIAL_BAD_PARAM - The bus is not initialized, the transaction contains no transfers or is already queued or active.
+ * \return NW_SERIAL_BUSY - The queue of the bus is full. The transaction is not queued.
+ * \return NW_SERIAL_SUCCESS - The transaction is queued or started.
+ */
+NexaWattSerialStatusResult NexaWatt_HalWrapperSerial_Submit(uint8 bus, NexaWattSerialTransaction* transaction);
+
+/**
+ * \brief Wrapper function used to abort the active transfer and all queued transactions of a serial bus.
+ * The aborted transactions are completed with NW_SERIAL_ABORTED and their callbacks are posted.
+ *
+ * \param bus - The number of the serial bus.
+ *
+ * \return NW_SERIAL_BAD_PARAM - The bus is not initialized.
+ * \return NW_SERIAL_SUCCESS - The bus is idle.
+ */
+NexaWattSerialStatusResult NexaWatt_HalWrapperSerial_Abort(uint8 bus);
+
+/**
+ * \brief Wrapper function used to check whether a serial bus has no active or queued transaction.
+ *
+ * \param bus - The number of the serial bus.
+ *
+ * \return nwTrue - The bus is idle or does not exist.
+ * \return nwFalse - A transaction is active or queued.
+ */
+nw_bool NexaWatt_HalWrapperSerial_Is_Idle(uint8 bus);
+
+/**
+ * \brief Wrapper function used to obtain the statistics of a serial bus.
+ *
+ * \param bus - The number of the serial bus.
+ * \param serialStats - A pointer to the structure, where the statistics are copied.
+ */
+void NexaWatt_HalWrapperSerial_Get_Stats(uint8 bus, NexaWattSerialStats* serialStats);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+#endif
@@ -0,0 +1,121 @@
+/*******************************************************************************
+* File Name:   hal_wrapper_timer.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the HAL Wrapper for the hardware timer peripheral. This wrapper is directly
+* used by the NexaWatt-IV.DC framework and aims to provide maximum level of
+* abstraction on the used MCU. A timer is a free-running up-counter, which wraps
+* around at the end of its period and signals the wrap with the overflow status
+* and the overflow interrupt.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_HAL_WRAPPER_TIMER_H
+#define NEXAWATT_IV_DC_HAL_WRAPPER_TIMER_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Maximum number of timers handled by the HAL Wrapper.
+ */
+#define NW_TIMER_MAX_TIMERS         (4u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Wrapper function used to initialize a timer with the specified configuration.
+ *
+ * This function uses the HAL Context to obtain the appropriate implementation for timer initialization.
+ * The timer is initialized stopped, with its counter cleared. If an overflow ISR is provided, the overflow interrupt is enabled.
+ * If the selected MCU is not supported and no user-defined initialization function has been registered, the function will assert and cause a fault.
+ *
+ * \param timer - The number of the configured timer.
+ * \param timerConfig - A pointer, containing the framework's standardized timer configuration structure.
+ *
+ * \return NW_TIMER_BAD_PARAM - The validation of the provided timer configuration failed.
+ * \return NW_TIMER_FATAL_ERR - The initialization of the timer or of its interrupt failed.
+ * \return NW_TIMER_SUCCESS - The timer is configured and ready to be started.
+ */
+NexaWattTimerStatusResult NexaWatt_HalWrapperTimer_Init(uint8 timer, const NexaWattTimerConfig* timerConfig);
+
+/**
+ * \brief Wrapper function used to de-initialize a timer. The timer is stopped and its interrupt disabled.
+ *
+ * \param timer - The number of the timer to be de-initialized.
+ *
+ * \return NW_TIMER_BAD_PARAM - The provided timer number does not exist.
+ * \return NW_TIMER_SUCCESS - The timer is de-initialized.
+ */
+NexaWattTimerStatusResult NexaWatt_HalWrapperTimer_DeInit(uint8 timer);
+
+/**
+ * \brief Wrapper function used to start the counting of a timer.
+ *
+ * \param timer - The number of the timer.
+ *
+ * \return NW_TIMER_BAD_PARAM - The provided timer number does not exist.
+ * \return NW_TIMER_SUCCESS - The timer is started.
+ */
+NexaWattTimerStatusResult NexaWatt_HalWrapperTimer_Start(uint8 timer);
+
+/**
+ * \brief Wrapper function used to stop the counting of a timer. The counter keeps its value.
+ *
+ * \param timer - The number of the timer.
+ *
+ * \return NW_TIMER_BAD_PARAM - The provided timer number does not exist.
+ * \return NW_TIMER_SUCCESS - The timer is stopped.
+ */
+NexaWattTimerStatusResult NexaWatt_HalWrapperTimer_Stop(uint8 timer);
+
+/**
+ * \brief Wrapper function used to read the counter of a timer.
+ * The function performs no validation and can be used in interrupt context.
+ *
+ * \param timer - The number of an initialized timer.
+ *
+ * \return The current counter value in timer ticks.
+ */
+NwTimerTicks NexaWatt_HalWrapperTimer_Read_Counter(uint8 timer);
+
+/**
+ * \brief Wrapper function used to check whether the counter of a timer wrapped around since the last clear of the overflow status.
+ * The function performs no validation and can be used in interrupt context.
+ *
+ * \param timer - The number of an initialized timer.
+ *
+ * \return nwTrue - The counter wrapped around.
+ * \return nwFalse - No wrap around since the last clear.
+ */
+nw_bool NexaWatt_HalWrapperTimer_Get_Overflow_Status(uint8 timer);
+
+/**
+ * \brief Wrapper function used to clear the overflow status of a timer. Must be called by the overflow ISR.
+ * The function performs no validation and can be used in interrupt context.
+ *
+ * \param timer - The number of an initialized timer.
+ */
+void NexaWatt_HalWrapperTimer_Clear_Overflow_Status(uint8 timer);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+#endif
@@ -0,0 +1,69 @@
+/*******************************************************************************
+* File Name:   hal_wrapper_wdt.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the HAL Wrapper for the hardware watchdog. This wrapper is directly
+* used by the NexaWatt-IV.DC framework and aims to provide maximum level of
+* abstraction on the used MCU. Once initialized, the watchdog cannot be stopped;
+* it resets the device, when it is not kicked within its timeout.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_HAL_WRAPPER_WDT_H
+#define NEXAWATT_IV_DC_HAL_WRAPPER_WDT_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Wrapper function used to initialize and start the hardware watchdog with the specified configuration.
+ *
+ * This function uses the HAL Context to obtain the appropriate implementation for watchdog initialization.
+ * If the selected MCU is not supported and no user-defined initialization function has been registered, the function will assert and cause a fault.
+ *
+ * \param wdtConfig - A pointer, containing the framework's standardized watchdog configuration structure.
+ *
+ * \return NW_WDT_BAD_PARAM - The validation of the provided watchdog configuration failed, e.g. the timeout is out of the range of the MCU.
+ * \return NW_WDT_FATAL_ERR - The initialization of the watchdog failed.
+ * \return NW_WDT_SUCCESS - The watchdog is running.
+ */
+NexaWattWdtStatusResult NexaWatt_HalWrapperWdt_Init(const NexaWattWdtConfig* wdtConfig);
+
+/**
+ * \brief Wrapper function used to kick (service) the hardware watchdog, restarting its timeout.
+ * The function performs no validation and can be used in interrupt context.
+ */
+void NexaWatt_HalWrapperWdt_Kick(void);
+
+/**
+ * \brief Wrapper function used to check whether the last reset of the device was caused by the hardware watchdog.
+ *
+ * \return nwTrue - The last reset was caused by the watchdog.
+ * \return nwFalse - The last reset had another cause.
+ */
+nw_bool NexaWatt_HalWrapperWdt_Get_Reset_Status(void);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+#endif
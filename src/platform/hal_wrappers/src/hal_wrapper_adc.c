@@ -0,0 +1,335 @@
+/*******************************************************************************
+* File Name:   hal_wrapper_adc.c
+*
+* Description: This is the source file containing definitions,
+* related to the HAL Wrapper for the ADC peripheral. This wrapper is directly
+* used by the NexaWattIV.DC framework and aims to provide maximum level of
+* abstraction on the used MCU.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "hal_wrapper_adc.h"
+#include "hal_context_export.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+/**
+ * \brief State of the conversion sequence. The frames are pre-built at the initialization,
+ * so the end-of-sequence handler only updates the counters before executing the callback.
+ */
+typedef struct sNexaWattAdcSequence
+{
+    nw_bool isInitialized;
+    nw_bool isStarted;
+    NwAdcFrameCallback frameCallback;
+    NexaWattADCFrame frames[NW_ADC_FRAME_CNT];
+    uint32 sequenceCnt;
+    NexaWattADCLatencyStats latencyStats;
+} NexaWattAdcSequence;
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+static NwAdcSample adcSampleBuffers[NW_ADC_FRAME_CNT][NW_ADC_MAX_SEQUENCE_LEN];
+static NexaWattAdcSequence adcSequence;
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Handler executed by the HAL implementation in the DMA interrupt context, when a sample frame is filled.
+ * \param bufferIdx - The index of the filled sample frame.
+ * \param latencyTicks - The time from the trigger of the sequence to the execution of the handler, in PWM counter ticks.
+ */
+static void NexaWatt_HalWrapperAdc_Frame_Ready_Handler(uint8 bufferIdx, uint32 latencyTicks);
+
+/**
+ * \brief Simple helper function that resets the latency statistics.
+ */
+NW_LOCAL_INLINE void NexaWatt_HalWrapperAdc_Clear_Latency_Stats(void);
+
+/**
+ * \brief Simple helper function, used to reduce the code duplication across the HAL Wrapper ADC implementation.
+ * The function performs an export of the bind HAL Init Function in the HAL Context component and validates the export result.
+ * In case of successful export, the HAL Context Function Config Callout is being executed.
+ * \param initFncType - An enumeration, representing the framework's standardized HAL Initialization functions supported.
+ * \param halContextFncConfig - A pointer, containing the framework's standardized HAL Context Function configuration structure.
+ * \return NW_HAL_CONTEXT_BAD_PARAM - The validation of the provided parameters failed.
+ * \return NW_HAL_CONTEXT_NOT_FOUND - The validation of the provided parameters was successful, but such Initialization function is not bind in the HAL Context component.
+ * \return NW_HAL_CONTEXT_OK - The HAL Context Initialization function is exported. The configured callout function is executed.
+ */
+NW_LOCAL_INLINE NexaWattHalContextStatusResult NexaWatt_HalWrapperAdc_Handle_Common_Init_Fnc_Exec_Seq(NexaWattHalContextInitFunctionTypes initFncType, NexaWattHalContextFunction *halContextFncConfig);
+
+/**
+ * \brief Simple helper function, used to reduce the code duplication across the HAL Wrapper ADC implementation.
+ * The function performs an export of the bind HAL Function in the HAL Context component and validates the export result.
+ * In case of successful export, the HAL Context Function Config Callout is being executed.
+ * \param halFncType - An enumeration, representing the framework's standardized HAL Functions supported.
+ * \param halContextFncConfig - A pointer, containing the framework's standardized HAL Context Function configuration structure.
+ * \return NW_HAL_CONTEXT_BAD_PARAM - The validation of the provided parameters failed.
+ * \return NW_HAL_CONTEXT_NOT_FOUND - The validation of the provided parameters was successful, but such HAL function is not bind in the HAL Context component.
+ * \return NW_HAL_CONTEXT_OK - The HAL Context function is exported. The configured callout function is executed.
+ */
+NW_LOCAL_INLINE NexaWattHalContextStatusResult NexaWatt_HalWrapperAdc_Handle_Common_Hal_Fnc_Exec_Seq(NexaWattHalContextFunctionTypes halFncType, NexaWattHalContextFunction *halContextFncConfig);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattADCStatusResult NexaWatt_HalWrapperAdc_Init_Sequence(const NexaWattADCSequenceConfig* const sequenceConfig, const NwAdcFrameCallback frameCallback)
+{
+    NexaWattADCStatusResult retRes = NW_ADC_BAD_PARAM;
+    NexaWattHalContextFunction adcSequenceInitFncConfig;
+    NexaWattADCStatusResult (*adcSequenceInitFncPtrCasted)(const NexaWattADCSequenceConfig* const, NwAdcSample* const, NwAdcSample* const, const NwAdcHalFrameHandler);
+    NexaWattHalContextStatusResult adcSequenceInitExportRes = NW_HAL_CONTEXT_BAD_PARAM;
+    uint8 frameIdx = 0u;
+
+    if ((sequenceConfig != NULL) &&
+        (sequenceConfig->channelList != NULL) &&
+        (sequenceConfig->channelCnt > 0u) &&
+        (sequenceConfig->channelCnt <= NW_ADC_MAX_SEQUENCE_LEN) &&
+        (frameCallback != NULL))
+    {
+        adcSequenceInitExportRes =
+                NexaWatt_HalWrapperAdc_Handle_Common_Init_Fnc_Exec_Seq(NW_HAL_ADC_SEQUENCE_INIT, &adcSequenceInitFncConfig);
+    }
+
+    if (adcSequenceInitExportRes == NW_HAL_CONTEXT_OK)
+    {
+        adcSequence.isInitialized = nwFalse;
+        adcSequence.isStarted = nwFalse;
+
+        adcSequenceInitFncPtrCasted = (NexaWattADCStatusResult (*)(const NexaWattADCSequenceConfig* const, NwAdcSample* const, NwAdcSample* const, const NwAdcHalFrameHandler))adcSequenceInitFncConfig.fncPtr;
+        retRes = adcSequenceInitFncPtrCasted(sequenceConfig, adcSampleBuffers[0u], adcSampleBuffers[1u], NexaWatt_HalWrapperAdc_Frame_Ready_Handler);
+        if (retRes == NW_ADC_SUCCESS)
+        {
+            for (frameIdx = 0u; frameIdx < NW_ADC_FRAME_CNT; frameIdx++)
+            {
+                adcSequence.frames[frameIdx].samples = adcSampleBuffers[frameIdx];
+                adcSequence.frames[frameIdx].sampleCnt = sequenceConfig->channelCnt;
+                adcSequence.frames[frameIdx].sequenceCnt = 0u;
+                adcSequence.frames[frameIdx].latencyTicks = 0u;
+            }
+
+            adcSequence.frameCallback = frameCallback;
+            adcSequence.sequenceCnt = 0u;
+            NexaWatt_HalWrapperAdc_Clear_Latency_Stats();
+            adcSequence.isInitialized = nwTrue;
+        }
+
+        if (adcSequenceInitFncConfig.fncCallback != NULL)
+        {
+            adcSequenceInitFncConfig.fncCallback();
+        }
+    }
+
+    return retRes;
+}
+
+NexaWattADCStatusResult NexaWatt_HalWrapperAdc_DeInit_Sequence(void)
+{
+    NexaWattADCStatusResult retRes = NW_ADC_BAD_PARAM;
+    NexaWattHalContextFunction adcSequenceDeInitFncConfig;
+    NexaWattADCStatusResult (*adcSequenceDeInitFncPtrCasted)(void);
+
+    NexaWattHalContextStatusResult adcSequenceDeInitExportRes =
+            NexaWatt_HalWrapperAdc_Handle_Common_Init_Fnc_Exec_Seq(NW_HAL_ADC_SEQUENCE_DEINIT, &adcSequenceDeInitFncConfig);
+    if (adcSequenceDeInitExportRes == NW_HAL_CONTEXT_OK)
+    {
+        adcSequenceDeInitFncPtrCasted = (NexaWattADCStatusResult (*)(void))adcSequenceDeInitFncConfig.fncPtr;
+        retRes = adcSequenceDeInitFncPtrCasted();
+
+        adcSequence.isStarted = nwFalse;
+        adcSequence.isInitialized = nwFalse;
+        adcSequence.frameCallback = NULL;
+
+        if (adcSequenceDeInitFncConfig.fncCallback != NULL)
+        {
+            adcSequenceDeInitFncConfig.fncCallback();
+        }
+    }
+
+    return retRes;
+}
+
+NexaWattADCStatusResult NexaWatt_HalWrapperAdc_Start(void)
+{
+    NexaWattADCStatusResult retRes = NW_ADC_BAD_PARAM;
+    NexaWattHalContextFunction adcStartFncConfig;
+    NexaWattADCStatusResult (*adcStartFncPtrCasted)(void);
+    NexaWattHalContextStatusResult adcStartExportRes = NW_HAL_CONTEXT_BAD_PARAM;
+
+    if (adcSequence.isInitialized == nwTrue)
+    {
+        adcStartExportRes =
+                NexaWatt_HalWrapperAdc_Handle_Common_Hal_Fnc_Exec_Seq(NW_HAL_ADC_START, &adcStartFncConfig);
+    }
+
+    if (adcStartExportRes == NW_HAL_CONTEXT_OK)
+    {
+        adcStartFncPtrCasted = (NexaWattADCStatusResult (*)(void))adcStartFncConfig.fncPtr;
+        retRes = adcStartFncPtrCasted();
+        if (retRes == NW_ADC_SUCCESS)
+        {
+            adcSequence.isStarted = nwTrue;
+        }
+
+        if (adcStartFncConfig.fncCallback != NULL)
+        {
+            adcStartFncConfig.fncCallback();
+        }
+    }
+
+    return retRes;
+}
+
+NexaWattADCStatusResult NexaWatt_HalWrapperAdc_Stop(void)
+{
+    NexaWattADCStatusResult retRes = NW_ADC_BAD_PARAM;
+    NexaWattHalContextFunction adcStopFncConfig;
+    NexaWattADCStatusResult (*adcStopFncPtrCasted)(void);
+
+    NexaWattHalContextStatusResult adcStopExportRes =
+            NexaWatt_HalWrapperAdc_Handle_Common_Hal_Fnc_Exec_Seq(NW_HAL_ADC_STOP, &adcStopFncConfig);
+    if (adcStopExportRes == NW_HAL_CONTEXT_OK)
+    {
+        adcStopFncPtrCasted = (NexaWattADCStatusResult (*)(void))adcStopFncConfig.fncPtr;
+        retRes = adcStopFncPtrCasted();
+        adcSequence.isStarted = nwFalse;
+
+        if (adcStopFncConfig.fncCallback != NULL)
+        {
+            adcStopFncConfig.fncCallback();
+        }
+    }
+
+    return retRes;
+}
+
+NexaWattADCStatusResult NexaWatt_HalWrapperAdc_Software_Trigger(void)
+{
+    NexaWattADCStatusResult retRes = NW_ADC_BAD_PARAM;
+    NexaWattHalContextFunction adcSwTriggerFncConfig;
+    void (*adcSwTriggerFncPtrCasted)(void);
+    NexaWattHalContextStatusResult adcSwTriggerExportRes = NW_HAL_CONTEXT_BAD_PARAM;
+
+    if (adcSequence.isStarted == nwTrue)
+    {
+        adcSwTriggerExportRes =
+                NexaWatt_HalWrapperAdc_Handle_Common_Hal_Fnc_Exec_Seq(NW_HAL_ADC_SW_TRIGGER, &adcSwTriggerFncConfig);
+    }
+
+    if (adcSwTriggerExportRes == NW_HAL_CONTEXT_OK)
+    {
+        adcSwTriggerFncPtrCasted = (void (*)(void))adcSwTriggerFncConfig.fncPtr;
+        adcSwTriggerFncPtrCasted();
+        retRes = NW_ADC_SUCCESS;
+
+        if (adcSwTriggerFncConfig.fncCallback != NULL)
+        {
+            adcSwTriggerFncConfig.fncCallback();
+        }
+    }
+
+    return retRes;
+}
+
+void NexaWatt_HalWrapperAdc_Get_Latency_Stats(NexaWattADCLatencyStats* const latencyStats)
+{
+    if (latencyStats != NULL)
+    {
+        *latencyStats = adcSequence.latencyStats;
+    }
+}
+
+void NexaWatt_HalWrapperAdc_Reset_Latency_Stats(void)
+{
+    NexaWatt_HalWrapperAdc_Clear_Latency_Stats();
+}
+
+static void NexaWatt_HalWrapperAdc_Frame_Ready_Handler(const uint8 bufferIdx, const uint32 latencyTicks)
+{
+    NexaWattADCFrame* const frame = &adcSequence.frames[bufferIdx & (NW_ADC_FRAME_CNT - 1u)];
+
+    adcSequence.sequenceCnt++;
+    frame->sequenceCnt = adcSequence.sequenceCnt;
+    frame->latencyTicks = latencyTicks;
+
+    adcSequence.latencyStats.lastTicks = latencyTicks;
+    adcSequence.latencyStats.minTicks = (latencyTicks < adcSequence.latencyStats.minTicks) ? latencyTicks : adcSequence.latencyStats.minTicks;
+    adcSequence.latencyStats.maxTicks = (latencyTicks > adcSequence.latencyStats.maxTicks) ? latencyTicks : adcSequence.latencyStats.maxTicks;
+    adcSequence.latencyStats.frameCnt++;
+
+    // The frame is handed over in place; it stays valid until the DMA wraps back to it after the next sequence
+    if (adcSequence.isStarted == nwTrue)
+    {
+        adcSequence.frameCallback(frame);
+    }
+}
+
+NW_LOCAL_INLINE void NexaWatt_HalWrapperAdc_Clear_Latency_Stats(void)
+{
+    adcSequence.latencyStats.minTicks = 0xFFFFFFFFu;
+    adcSequence.latencyStats.maxTicks = 0u;
+    adcSequence.latencyStats.lastTicks = 0u;
+    adcSequence.latencyStats.frameCnt = 0u;
+}
+
+NW_LOCAL_INLINE NexaWattHalContextStatusResult NexaWatt_HalWrapperAdc_Handle_Common_Init_Fnc_Exec_Seq(
+        NexaWattHalContextInitFunctionTypes initFncType, NexaWattHalContextFunction *halContextFncConfig)
+{
+    NexaWattHalContextStatusResult retRes = NW_HAL_CONTEXT_BAD_PARAM;
+
+    // Static analysis warning: Condition is always true
+    // Justification: Defensive programming style in case of misuse by the framework user
+    if (initFncType < NW_HAL_INIT_FUNC_INVALID)
+    {
+        retRes = NexaWatt_HalContext_Export_Init_Function(initFncType, halContextFncConfig);
+        if (retRes == NW_HAL_CONTEXT_OK)
+        {
+            // Trigger fault in case the function is not bind
+            NW_ASSERT(halContextFncConfig->fncPtr != NULL);
+
+            if (halContextFncConfig->fncCallout != NULL)
+            {
+                halContextFncConfig->fncCallout();
+            }
+        }
+    }
+
+    return retRes;
+}
+
+NW_LOCAL_INLINE NexaWattHalContextStatusResult NexaWatt_HalWrapperAdc_Handle_Common_Hal_Fnc_Exec_Seq(
+        NexaWattHalContextFunctionTypes halFncType, NexaWattHalContextFunction *halContextFncConfig)
+{
+    NexaWattHalContextStatusResult retRes = NW_HAL_CONTEXT_BAD_PARAM;
+
+    // Static analysis warning: Condition is always true
+    // Justification: Defensive programming style in case of misuse by the framework user
+    if (NW_RUNTIME_CHECK(halFncType < NW_HAL_FUNC_INVALID))
+    {
+        retRes = NexaWatt_HalContext_Export_Function(halFncType, halContextFncConfig);
+        if (retRes == NW_HAL_CONTEXT_OK)
+        {
+            // Trigger fault in case the function is not bind
+            NW_RUNTIME_ASSERT(halContextFncConfig->fncPtr != NULL);
+
+            if (halContextFncConfig->fncCallout != NULL)
+            {
+                halContextFncConfig->fncCallout();
+            }
+        }
+    }
+
+    return retRes;
+}
@@ -17,6 +17,7 @@
 *******************************************************************************/
 #include "hal_wrapper_gpio.h"
 #include "hal_context_export.h"
+#include "hal_manager_resources.h"
 
 /*******************************************************************************
 * Macros
@@ -59,6 +60,15 @@ NW_LOCAL_INLINE NexaWattHalContextStatusResult NexaWatt_HalWrapperGpio_Handle_Co
  */
 NW_LOCAL_INLINE NexaWattHalContextStatusResult NexaWatt_HalWrapperGpio_Handle_Common_Hal_Fnc_Exec_Seq(NexaWattHalContextFunctionTypes halFncType, NexaWattHalContextFunction *halContextFncConfig);
 
+/**
+ * \brief Simple helper function that converts the status of a resource claim in the resource registry to a GPIO status.
+ * \param resourceStatus - The status of the resource claim.
+ * \return NW_GPIO_RESOURCE_CONFLICT - The resource is already claimed.
+ * \return NW_GPIO_BAD_PARAM - The resource does not exist.
+ * \return NW_GPIO_SUCCESS - The resource is claimed.
+ */
+NW_LOCAL_INLINE NexaWattGPIOStatusResult NexaWatt_HalWrapperGpio_Get_Claim_Status(NexaWattResourceStatusResult resourceStatus);
+
 /*******************************************************************************
 * Function Definitions
 *******************************************************************************/
@@ -74,7 +84,15 @@ NexaWattGPIOStatusResult NexaWatt_HalWrapperGpio_Init_Digital_Pin(const uint8 po
     if (gpioPinInitFcnExportRes == NW_HAL_CONTEXT_OK)
     {
         gpioPinInitFncPtrCasted = (NexaWattGPIOStatusResult (*)(const uint8, const uint8, const NexaWattGPIOPinConfig* const))gpioPinInitFncConfig.fncPtr;
-        retRes = gpioPinInitFncPtrCasted(portNum, pinNum, pinConfig);
+        retRes = NexaWatt_HalWrapperGpio_Get_Claim_Status(NexaWatt_HalManager_Resources_Claim_Pins(portNum, NW_RESOURCE_PIN_MASK(pinNum)));
+        if (retRes == NW_GPIO_SUCCESS)
+        {
+            retRes = gpioPinInitFncPtrCasted(portNum, pinNum, pinConfig);
+            if (retRes != NW_GPIO_SUCCESS)
+            {
+                (void)NexaWatt_HalManager_Resources_Release_Pins(portNum, NW_RESOURCE_PIN_MASK(pinNum));
+            }
+        }
 
         if (gpioPinInitFncConfig.fncCallback != NULL)
         {
@@ -85,6 +103,37 @@ NexaWattGPIOStatusResult NexaWatt_HalWrapperGpio_Init_Digital_Pin(const uint8 po
     return retRes;
 }
 
+NexaWattGPIOStatusResult NexaWatt_HalWrapperGpio_Init_Port(const uint8 portNum, const uint8 pinMask, const NexaWattGPIOPinConfig* const pinConfigs)
+{
+    NexaWattGPIOStatusResult retRes = NW_GPIO_BAD_PARAM;
+    NexaWattHalContextFunction gpioPortInitFncConfig;
+    NexaWattGPIOStatusResult (*gpioPortInitFncPtrCasted)(const uint8, const uint8, const NexaWattGPIOPinConfig* const);
+
+    NexaWattHalContextStatusResult gpioPortInitFcnExportRes =
+            NexaWatt_HalWrapperGpio_Handle_Common_Init_Fnc_Exec_Seq(NW_HAL_GPIO_PORT_INIT,
+                                                                    &gpioPortInitFncConfig);
+    if (gpioPortInitFcnExportRes == NW_HAL_CONTEXT_OK)
+    {
+        gpioPortInitFncPtrCasted = (NexaWattGPIOStatusResult (*)(const uint8, const uint8, const NexaWattGPIOPinConfig* const))gpioPortInitFncConfig.fncPtr;
+        retRes = NexaWatt_HalWrapperGpio_Get_Claim_Status(NexaWatt_HalManager_Resources_Claim_Pins(portNum, pinMask));
+        if (retRes == NW_GPIO_SUCCESS)
+        {
+            retRes = gpioPortInitFncPtrCasted(portNum, pinMask, pinConfigs);
+            if (retRes != NW_GPIO_SUCCESS)
+            {
+                (void)NexaWatt_HalManager_Resources_Release_Pins(portNum, pinMask);
+            }
+        }
+
+        if (gpioPortInitFncConfig.fncCallback != NULL)
+        {
+            gpioPortInitFncConfig.fncCallback();
+        }
+    }
+
+    return retRes;
+}
+
 NexaWattGPIOStatusResult NexaWatt_HalWrapperGpio_Set_Pin_Alt_Functions(const uint8 portNum, const uint8 pinNum, const NwGpioPinAltFunction altFunction)
 {
     NexaWattGPIOStatusResult retRes = NW_GPIO_BAD_PARAM;
@@ -120,6 +169,12 @@ NexaWattGPIOStatusResult NexaWatt_HalWrapperGpio_DeInit_Port(const uint8 portNum
     {
         gpioPinDeInitFncPtrCasted = (NexaWattGPIOStatusResult (*)(const uint8))gpioPinDeInitFncConfig.fncPtr;
         retRes = gpioPinDeInitFncPtrCasted(portNum);
+        if (retRes == NW_GPIO_SUCCESS)
+        {
+            // The de-initialization resets all pins of the port, including their EXTIs
+            (void)NexaWatt_HalManager_Resources_Release_Pins(portNum, NW_GPIO_PORT_ALL_PINS_MASK);
+            (void)NexaWatt_HalManager_Resources_Release_Extis(portNum, NW_GPIO_PORT_ALL_PINS_MASK);
+        }
 
         if (gpioPinDeInitFncConfig.fncCallback != NULL)
         {
@@ -152,6 +207,28 @@ NwGpioPinResult NexaWatt_HalWrapperGpio_Pin_Read(const uint8 portNum, const uint
     return retRes;
 }
 
+uint8 NexaWatt_HalWrapperGpio_Port_Read(const uint8 portNum)
+{
+    uint8 retRes = 0u;
+    NexaWattHalContextFunction gpioPortReadFncConfig;
+    uint8 (*gpioPortReadFncPtrCasted)(const uint8);
+
+    NexaWattHalContextStatusResult gpioPortReadExportRes =
+            NexaWatt_HalWrapperGpio_Handle_Common_Hal_Fnc_Exec_Seq(NW_HAL_GPIO_PORT_READ, &gpioPortReadFncConfig);
+    if (gpioPortReadExportRes == NW_HAL_CONTEXT_OK)
+    {
+        gpioPortReadFncPtrCasted = (uint8 (*)(const uint8))gpioPortReadFncConfig.fncPtr;
+        retRes = gpioPortReadFncPtrCasted(portNum);
+
+        if (gpioPortReadFncConfig.fncCallback != NULL)
+        {
+            gpioPortReadFncConfig.fncCallback();
+        }
+    }
+
+    return retRes;
+}
+
 NexaWattGPIOStatusResult NexaWatt_HalWrapperGpio_Pin_Write(const uint8 portNum, const uint8 pinNum, const nw_bool value)
 {
     NexaWattGPIOStatusResult retRes = NW_GPIO_BAD_PARAM;
@@ -174,6 +251,28 @@ NexaWattGPIOStatusResult NexaWatt_HalWrapperGpio_Pin_Write(const uint8 portNum,
     return retRes;
 }
 
+NexaWattGPIOStatusResult NexaWatt_HalWrapperGpio_Port_Write(const uint8 portNum, const uint8 pinMask, const nw_bool value)
+{
+    NexaWattGPIOStatusResult retRes = NW_GPIO_BAD_PARAM;
+    NexaWattHalContextFunction gpioPortWriteFncConfig;
+    NexaWattGPIOStatusResult (*gpioPortWriteFncPtrCasted)(const uint8, const uint8, nw_bool);
+
+    NexaWattHalContextStatusResult gpioPortWriteExportRes =
+            NexaWatt_HalWrapperGpio_Handle_Common_Hal_Fnc_Exec_Seq(NW_HAL_GPIO_PORT_WRITE, &gpioPortWriteFncConfig);
+    if (gpioPortWriteExportRes == NW_HAL_CONTEXT_OK)
+    {
+        gpioPortWriteFncPtrCasted = (NexaWattGPIOStatusResult (*)(const uint8, const uint8, nw_bool))gpioPortWriteFncConfig.fncPtr;
+        retRes = gpioPortWriteFncPtrCasted(portNum, pinMask, value);
+
+        if (gpioPortWriteFncConfig.fncCallback != NULL)
+        {
+            gpioPortWriteFncConfig.fncCallback();
+        }
+    }
+
+    return retRes;
+}
+
 NexaWattGPIOStatusResult NexaWatt_HalWrapperGpio_Pin_Toggle(const uint8 portNum, const uint8 pinNum)
 {
     NexaWattGPIOStatusResult retRes = NW_GPIO_BAD_PARAM;
@@ -207,7 +306,15 @@ NexaWattGPIOStatusResult NexaWatt_HalWrapperGpio_Register_EXTI(const uint8 portN
     if (gpioRegisterExtIrqExportRes == NW_HAL_CONTEXT_OK)
     {
         gpioRegisterExtIrqFncPtrCasted = (NexaWattGPIOStatusResult (*)(const uint8, const uint8, const NexaWattGPIOExtIRQConfig* const))gpioRegisterExtIrqFncConfig.fncPtr;
-        retRes = gpioRegisterExtIrqFncPtrCasted(portNum, pinNum, extiConfig);
+        retRes = NexaWatt_HalWrapperGpio_Get_Claim_Status(NexaWatt_HalManager_Resources_Claim_Extis(portNum, NW_RESOURCE_PIN_MASK(pinNum)));
+        if (retRes == NW_GPIO_SUCCESS)
+        {
+            retRes = gpioRegisterExtIrqFncPtrCasted(portNum, pinNum, extiConfig);
+            if (retRes != NW_GPIO_SUCCESS)
+            {
+                (void)NexaWatt_HalManager_Resources_Release_Extis(portNum, NW_RESOURCE_PIN_MASK(pinNum));
+            }
+        }
 
         if (gpioRegisterExtIrqFncConfig.fncCallback != NULL)
         {
@@ -230,6 +337,10 @@ NexaWattGPIOStatusResult NexaWatt_HalWrapperGpio_Disable_EXTI(const uint8 portNu
     {
         gpioDisableExtIrqFncPtrCasted = (NexaWattGPIOStatusResult (*)(const uint8, const uint8, const NexaWattGPIOExtIRQConfig* const))gpioDisableExtIrqFncConfig.fncPtr;
         retRes = gpioDisableExtIrqFncPtrCasted(portNum, pinNum, extiConfig);
+        if (retRes == NW_GPIO_SUCCESS)
+        {
+            (void)NexaWatt_HalManager_Resources_Release_Extis(portNum, NW_RESOURCE_PIN_MASK(pinNum));
+        }
 
         if (gpioDisableExtIrqFncConfig.fncCallback != NULL)
         {
@@ -335,13 +446,13 @@ NW_LOCAL_INLINE NexaWattHalContextStatusResult NexaWatt_HalWrapperGpio_Handle_Co
 
     // Static analysis warning: Condition is always true
     // Justification: Defensive programming style in case of misuse by the framework user
-    if (halFncType < NW_HAL_FUNC_INVALID)
+    if (NW_RUNTIME_CHECK(halFncType < NW_HAL_FUNC_INVALID))
     {
         retRes = NexaWatt_HalContext_Export_Function(halFncType, halContextFncConfig);
         if (retRes == NW_HAL_CONTEXT_OK)
         {
             // Trigger fault in case the function is not bind
-            NW_ASSERT(halContextFncConfig->fncPtr != NULL);
+            NW_RUNTIME_ASSERT(halContextFncConfig->fncPtr != NULL);
 
             if (halContextFncConfig->fncCallout != NULL)
             {
@@ -350,5 +461,21 @@ NW_LOCAL_INLINE NexaWattHalContextStatusResult NexaWatt_HalWrapperGpio_Handle_Co
         }
     }
 
+    return retRes;
+}
+
+NW_LOCAL_INLINE NexaWattGPIOStatusResult NexaWatt_HalWrapperGpio_Get_Claim_Status(const NexaWattResourceStatusResult resourceStatus)
+{
+    NexaWattGPIOStatusResult retRes = NW_GPIO_BAD_PARAM;
+
+    if (resourceStatus == NW_RESOURCE_SUCCESS)
+    {
+        retRes = NW_GPIO_SUCCESS;
+    }
+    else if (resourceStatus == NW_RESOURCE_CONFLICT)
+    {
+        retRes = NW_GPIO_RESOURCE_CONFLICT;
+    }
+
     return retRes;
 }
\ No newline at end of file
@@ -0,0 +1,352 @@
+/*******************************************************************************
+* File Name:   hal_wrapper_pwm.c
+*
+* Description: This is the source file containing definitions,
+* related to the HAL Wrapper for the PWM peripheral. This wrapper is directly
+* used by the NexaWattIV.DC framework and aims to provide maximum level of
+* abstraction on the used MCU.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "hal_wrapper_pwm.h"
+#include "hal_context_export.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+/**
+ * \brief RAM shadow of the PWM compare values. The staged mask contains the channels
+ * with compare values, which were not committed to the peripheral yet.
+ */
+typedef struct sNexaWattPwmShadow
+{
+    NwPwmTicks periodTicks[NW_PWM_MAX_CHANNELS];
+    NwPwmTicks compareTicks[NW_PWM_MAX_CHANNELS];
+    NwPwmChannelMask stagedMask;
+} NexaWattPwmShadow;
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+static NexaWattPwmShadow pwmShadow;
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function, used to reduce the code duplication across the HAL Wrapper PWM implementation.
+ * The function performs an export of the bind HAL Init Function in the HAL Context component and validates the export result.
+ * In case of successful export, the HAL Context Function Config Callout is being executed.
+ * \param initFncType - An enumeration, representing the framework's standardized HAL Initialization functions supported.
+ * \param halContextFncConfig - A pointer, containing the framework's standardized HAL Context Function configuration structure.
+ * \return NW_HAL_CONTEXT_BAD_PARAM - The validation of the provided parameters failed.
+ * \return NW_HAL_CONTEXT_NOT_FOUND - The validation of the provided parameters was successful, but such Initialization function is not bind in the HAL Context component.
+ * \return NW_HAL_CONTEXT_OK - The HAL Context Initialization function is exported. The configured callout function is executed.
+ */
+NW_LOCAL_INLINE NexaWattHalContextStatusResult NexaWatt_HalWrapperPwm_Handle_Common_Init_Fnc_Exec_Seq(NexaWattHalContextInitFunctionTypes initFncType, NexaWattHalContextFunction *halContextFncConfig);
+
+/**
+ * \brief Simple helper function, used to reduce the code duplication across the HAL Wrapper PWM implementation.
+ * The function performs an export of the bind HAL Function in the HAL Context component and validates the export result.
+ * In case of successful export, the HAL Context Function Config Callout is being executed.
+ * \param halFncType - An enumeration, representing the framework's standardized HAL Functions supported.
+ * \param halContextFncConfig - A pointer, containing the framework's standardized HAL Context Function configuration structure.
+ * \return NW_HAL_CONTEXT_BAD_PARAM - The validation of the provided parameters failed.
+ * \return NW_HAL_CONTEXT_NOT_FOUND - The validation of the provided parameters was successful, but such HAL function is not bind in the HAL Context component.
+ * \return NW_HAL_CONTEXT_OK - The HAL Context function is exported. The configured callout function is executed.
+ */
+NW_LOCAL_INLINE NexaWattHalContextStatusResult NexaWatt_HalWrapperPwm_Handle_Common_Hal_Fnc_Exec_Seq(NexaWattHalContextFunctionTypes halFncType, NexaWattHalContextFunction *halContextFncConfig);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattPWMStatusResult NexaWatt_HalWrapperPwm_Init_Channel(const uint8 channel, const NexaWattPWMChannelConfig* const channelConfig)
+{
+    NexaWattPWMStatusResult retRes = NW_PWM_BAD_PARAM;
+    NexaWattHalContextFunction pwmChannelInitFncConfig;
+    NexaWattPWMStatusResult (*pwmChannelInitFncPtrCasted)(const uint8, const NexaWattPWMChannelConfig* const);
+    NexaWattHalContextStatusResult pwmChannelInitExportRes = NW_HAL_CONTEXT_BAD_PARAM;
+
+    if ((channel < NW_PWM_MAX_CHANNELS) &&
+        (channelConfig != NULL))
+    {
+        pwmChannelInitExportRes =
+                NexaWatt_HalWrapperPwm_Handle_Common_Init_Fnc_Exec_Seq(NW_HAL_PWM_CHANNEL_INIT, &pwmChannelInitFncConfig);
+    }
+
+    if (pwmChannelInitExportRes == NW_HAL_CONTEXT_OK)
+    {
+        pwmChannelInitFncPtrCasted = (NexaWattPWMStatusResult (*)(const uint8, const NexaWattPWMChannelConfig* const))pwmChannelInitFncConfig.fncPtr;
+        retRes = pwmChannelInitFncPtrCasted(channel, channelConfig);
+        if (retRes == NW_PWM_SUCCESS)
+        {
+            pwmShadow.periodTicks[channel] = channelConfig->periodTicks;
+            pwmShadow.compareTicks[channel] = 0u;
+            pwmShadow.stagedMask &= ~NW_PWM_CHANNEL_MASK(channel);
+        }
+
+        if (pwmChannelInitFncConfig.fncCallback != NULL)
+        {
+            pwmChannelInitFncConfig.fncCallback();
+        }
+    }
+
+    return retRes;
+}
+
+NexaWattPWMStatusResult NexaWatt_HalWrapperPwm_DeInit_Channel(const uint8 channel)
+{
+    NexaWattPWMStatusResult retRes = NW_PWM_BAD_PARAM;
+    NexaWattHalContextFunction pwmChannelDeInitFncConfig;
+    NexaWattPWMStatusResult (*pwmChannelDeInitFncPtrCasted)(const uint8);
+    NexaWattHalContextStatusResult pwmChannelDeInitExportRes = NW_HAL_CONTEXT_BAD_PARAM;
+
+    if (channel < NW_PWM_MAX_CHANNELS)
+    {
+        pwmChannelDeInitExportRes =
+                NexaWatt_HalWrapperPwm_Handle_Common_Init_Fnc_Exec_Seq(NW_HAL_PWM_CHANNEL_DEINIT, &pwmChannelDeInitFncConfig);
+    }
+
+    if (pwmChannelDeInitExportRes == NW_HAL_CONTEXT_OK)
+    {
+        pwmChannelDeInitFncPtrCasted = (NexaWattPWMStatusResult (*)(const uint8))pwmChannelDeInitFncConfig.fncPtr;
+        retRes = pwmChannelDeInitFncPtrCasted(channel);
+        if (retRes == NW_PWM_SUCCESS)
+        {
+            pwmShadow.periodTicks[channel] = 0u;
+            pwmShadow.compareTicks[channel] = 0u;
+            pwmShadow.stagedMask &= ~NW_PWM_CHANNEL_MASK(channel);
+        }
+
+        if (pwmChannelDeInitFncConfig.fncCallback != NULL)
+        {
+            pwmChannelDeInitFncConfig.fncCallback();
+        }
+    }
+
+    return retRes;
+}
+
+NexaWattPWMStatusResult NexaWatt_HalWrapperPwm_Set_Period(const uint8 channel, const NwPwmTicks periodTicks)
+{
+    NexaWattPWMStatusResult retRes = NW_PWM_BAD_PARAM;
+    NexaWattHalContextFunction pwmSetPeriodFncConfig;
+    NexaWattPWMStatusResult (*pwmSetPeriodFncPtrCasted)(const uint8, const NwPwmTicks);
+    NexaWattHalContextStatusResult pwmSetPeriodExportRes = NW_HAL_CONTEXT_BAD_PARAM;
+
+    if (NW_RUNTIME_CHECK(channel < NW_PWM_MAX_CHANNELS))
+    {
+        pwmSetPeriodExportRes =
+                NexaWatt_HalWrapperPwm_Handle_Common_Hal_Fnc_Exec_Seq(NW_HAL_PWM_SET_PERIOD, &pwmSetPeriodFncConfig);
+    }
+
+    if (pwmSetPeriodExportRes == NW_HAL_CONTEXT_OK)
+    {
+        pwmSetPeriodFncPtrCasted = (NexaWattPWMStatusResult (*)(const uint8, const NwPwmTicks))pwmSetPeriodFncConfig.fncPtr;
+        retRes = pwmSetPeriodFncPtrCasted(channel, periodTicks);
+        if (retRes == NW_PWM_SUCCESS)
+        {
+            pwmShadow.periodTicks[channel] = periodTicks;
+        }
+
+        if (pwmSetPeriodFncConfig.fncCallback != NULL)
+        {
+            pwmSetPeriodFncConfig.fncCallback();
+        }
+    }
+
+    return retRes;
+}
+
+NexaWattPWMStatusResult NexaWatt_HalWrapperPwm_Set_Phase(const uint8 channel, const NwQ16 phaseShift)
+{
+    NexaWattPWMStatusResult retRes = NW_PWM_BAD_PARAM;
+    NexaWattHalContextFunction pwmSetPhaseFncConfig;
+    NexaWattPWMStatusResult (*pwmSetPhaseFncPtrCasted)(const uint8, const NwPwmTicks);
+    NexaWattHalContextStatusResult pwmSetPhaseExportRes = NW_HAL_CONTEXT_BAD_PARAM;
+    NwPwmTicks phaseTicks = 0u;
+
+    if (NW_RUNTIME_CHECK((channel < NW_PWM_MAX_CHANNELS) &&
+                         (phaseShift >= 0) &&
+                         (phaseShift < NW_Q16_ONE)))
+    {
+        pwmSetPhaseExportRes =
+                NexaWatt_HalWrapperPwm_Handle_Common_Hal_Fnc_Exec_Seq(NW_HAL_PWM_SET_PHASE, &pwmSetPhaseFncConfig);
+    }
+
+    if (pwmSetPhaseExportRes == NW_HAL_CONTEXT_OK)
+    {
+        phaseTicks = (NwPwmTicks)(((uint64)pwmShadow.periodTicks[channel] * (uint64)phaseShift) >> NW_Q16_FRAC_BITS);
+
+        pwmSetPhaseFncPtrCasted = (NexaWattPWMStatusResult (*)(const uint8, const NwPwmTicks))pwmSetPhaseFncConfig.fncPtr;
+        retRes = pwmSetPhaseFncPtrCasted(channel, phaseTicks);
+
+        if (pwmSetPhaseFncConfig.fncCallback != NULL)
+        {
+            pwmSetPhaseFncConfig.fncCallback();
+        }
+    }
+
+    return retRes;
+}
+
+NexaWattPWMStatusResult NexaWatt_HalWrapperPwm_Set_Dead_Time(const uint8 channel, const NwPwmTicks deadTimeRiseTicks, const NwPwmTicks deadTimeFallTicks)
+{
+    NexaWattPWMStatusResult retRes = NW_PWM_BAD_PARAM;
+    NexaWattHalContextFunction pwmSetDeadTimeFncConfig;
+    NexaWattPWMStatusResult (*pwmSetDeadTimeFncPtrCasted)(const uint8, const NwPwmTicks, const NwPwmTicks);
+
+    NexaWattHalContextStatusResult pwmSetDeadTimeExportRes =
+            NexaWatt_HalWrapperPwm_Handle_Common_Hal_Fnc_Exec_Seq(NW_HAL_PWM_SET_DEAD_TIME, &pwmSetDeadTimeFncConfig);
+    if (pwmSetDeadTimeExportRes == NW_HAL_CONTEXT_OK)
+    {
+        pwmSetDeadTimeFncPtrCasted = (NexaWattPWMStatusResult (*)(const uint8, const NwPwmTicks, const NwPwmTicks))pwmSetDeadTimeFncConfig.fncPtr;
+        retRes = pwmSetDeadTimeFncPtrCasted(channel, deadTimeRiseTicks, deadTimeFallTicks);
+
+        if (pwmSetDeadTimeFncConfig.fncCallback != NULL)
+        {
+            pwmSetDeadTimeFncConfig.fncCallback();
+        }
+    }
+
+    return retRes;
+}
+
+NexaWattPWMStatusResult NexaWatt_HalWrapperPwm_Start(const NwPwmChannelMask channelMask)
+{
+    NexaWattPWMStatusResult retRes = NW_PWM_BAD_PARAM;
+    NexaWattHalContextFunction pwmStartFncConfig;
+    NexaWattPWMStatusResult (*pwmStartFncPtrCasted)(const NwPwmChannelMask);
+
+    NexaWattHalContextStatusResult pwmStartExportRes =
+            NexaWatt_HalWrapperPwm_Handle_Common_Hal_Fnc_Exec_Seq(NW_HAL_PWM_START, &pwmStartFncConfig);
+    if (pwmStartExportRes == NW_HAL_CONTEXT_OK)
+    {
+        pwmStartFncPtrCasted = (NexaWattPWMStatusResult (*)(const NwPwmChannelMask))pwmStartFncConfig.fncPtr;
+        retRes = pwmStartFncPtrCasted(channelMask);
+
+        if (pwmStartFncConfig.fncCallback != NULL)
+        {
+            pwmStartFncConfig.fncCallback();
+        }
+    }
+
+    return retRes;
+}
+
+NexaWattPWMStatusResult NexaWatt_HalWrapperPwm_Stop(const NwPwmChannelMask channelMask)
+{
+    NexaWattPWMStatusResult retRes = NW_PWM_BAD_PARAM;
+    NexaWattHalContextFunction pwmStopFncConfig;
+    NexaWattPWMStatusResult (*pwmStopFncPtrCasted)(const NwPwmChannelMask);
+
+    NexaWattHalContextStatusResult pwmStopExportRes =
+            NexaWatt_HalWrapperPwm_Handle_Common_Hal_Fnc_Exec_Seq(NW_HAL_PWM_STOP, &pwmStopFncConfig);
+    if (pwmStopExportRes == NW_HAL_CONTEXT_OK)
+    {
+        pwmStopFncPtrCasted = (NexaWattPWMStatusResult (*)(const NwPwmChannelMask))pwmStopFncConfig.fncPtr;
+        retRes = pwmStopFncPtrCasted(channelMask);
+
+        if (pwmStopFncConfig.fncCallback != NULL)
+        {
+            pwmStopFncConfig.fncCallback();
+        }
+    }
+
+    return retRes;
+}
+
+void NexaWatt_HalWrapperPwm_Stage_Duty(const uint8 channel, const NwQ15 duty)
+{
+    // A negative duty would wrap to a huge compare value, so the duty is saturated before the scaling
+    const NwQ15 saturatedDuty = NexaWatt_FixedPoint_Saturate(duty, 0, NW_Q15_MAX);
+
+    // Only RAM is written; the peripheral is accessed once per control cycle by the commit
+    pwmShadow.compareTicks[channel] = (NwPwmTicks)(((uint64)pwmShadow.periodTicks[channel] * (uint64)saturatedDuty) >> NW_Q15_FRAC_BITS);
+    pwmShadow.stagedMask |= NW_PWM_CHANNEL_MASK(channel);
+}
+
+void NexaWatt_HalWrapperPwm_Stage_Compare(const uint8 channel, const NwPwmTicks compareTicks)
+{
+    pwmShadow.compareTicks[channel] = compareTicks;
+    pwmShadow.stagedMask |= NW_PWM_CHANNEL_MASK(channel);
+}
+
+void NexaWatt_HalWrapperPwm_Commit(void)
+{
+    NexaWattHalContextFunction pwmCommitFncConfig;
+    void (*pwmCommitFncPtrCasted)(const NwPwmTicks* const, const NwPwmChannelMask);
+
+    NexaWattHalContextStatusResult pwmCommitExportRes =
+            NexaWatt_HalWrapperPwm_Handle_Common_Hal_Fnc_Exec_Seq(NW_HAL_PWM_COMMIT, &pwmCommitFncConfig);
+    if (pwmCommitExportRes == NW_HAL_CONTEXT_OK)
+    {
+        pwmCommitFncPtrCasted = (void (*)(const NwPwmTicks* const, const NwPwmChannelMask))pwmCommitFncConfig.fncPtr;
+        pwmCommitFncPtrCasted(pwmShadow.compareTicks, pwmShadow.stagedMask);
+        pwmShadow.stagedMask = 0u;
+
+        if (pwmCommitFncConfig.fncCallback != NULL)
+        {
+            pwmCommitFncConfig.fncCallback();
+        }
+    }
+}
+
+NW_LOCAL_INLINE NexaWattHalContextStatusResult NexaWatt_HalWrapperPwm_Handle_Common_Init_Fnc_Exec_Seq(
+        NexaWattHalContextInitFunctionTypes initFncType, NexaWattHalContextFunction *halContextFncConfig)
+{
+    NexaWattHalContextStatusResult retRes = NW_HAL_CONTEXT_BAD_PARAM;
+
+    // Static analysis warning: Condition is always true
+    // Justification: Defensive programming style in case of misuse by the framework user
+    if (initFncType < NW_HAL_INIT_FUNC_INVALID)
+    {
+        retRes = NexaWatt_HalContext_Export_Init_Function(initFncType, halContextFncConfig);
+        if (retRes == NW_HAL_CONTEXT_OK)
+        {
+            // Trigger fault in case the function is not bind
+            NW_ASSERT(halContextFncConfig->fncPtr != NULL);
+
+            if (halContextFncConfig->fncCallout != NULL)
+            {
+                halContextFncConfig->fncCallout();
+            }
+        }
+    }
+
+    return retRes;
+}
+
+NW_LOCAL_INLINE NexaWattHalContextStatusResult NexaWatt_HalWrapperPwm_Handle_Common_Hal_Fnc_Exec_Seq(
+        NexaWattHalContextFunctionTypes halFncType, NexaWattHalContextFunction *halContextFncConfig)
+{
+    NexaWattHalContextStatusResult retRes = NW_HAL_CONTEXT_BAD_PARAM;
+
+    // Static analysis warning: Condition is always true
+    // Justification: Defensive programming style in case of misuse by the framework user
+    if (NW_RUNTIME_CHECK(halFncType < NW_HAL_FUNC_INVALID))
+    {
+        retRes = NexaWatt_HalContext_Export_Function(halFncType, halContextFncConfig);
+        if (retRes == NW_HAL_CONTEXT_OK)
+        {
+            // Trigger fault in case the function is not bind
+            NW_RUNTIME_ASSERT(halContextFncConfig->fncPtr != NULL);
+
+            if (halContextFncConfig->fncCallout != NULL)
+            {
+                halContextFncConfig->fncCallout();
+            }
+        }
+    }
+
+    return retRes;
+}
@@ -0,0 +1,473 @@
+/*******************************************************************************
+* File Name:   hal_wrapper_serial.c
+*
+* Description: This is the source file containing definitions,
+* related to the HAL Wrapper for the serial buses (SPI and I2C). This wrapper is directly
+* used by the NexaWattIV.DC framework and aims to provide maximum level of
+* abstraction on the used MCU.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "hal_wrapper_serial.h"
+#include "hal_context_export.h"
+#include "nexa_mini_os_event.h"
+#include "platform_critical_section.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Macro returning the queue slot corresponding to a free-running queue index.
+ */
+#define NW_SERIAL_QUEUE_SLOT(queueIdx) \
+    ((queueIdx) & (NW_SERIAL_QUEUE_LEN - 1u))
+
+NW_STATIC_ASSERT((NW_SERIAL_QUEUE_LEN & (NW_SERIAL_QUEUE_LEN - 1u)) == 0u, serial_queue_len_power_of_two);
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+/**
+ * \brief State of a serial bus. The transaction at the tail of the queue is the active one, whenever the queue is not empty.
+ * The indices are free-running; their difference is the number of queued transactions.
+ */
+typedef struct sNexaWattSerialBus
+{
+    nw_bool isInitialized;
+    NexaWattSerialTransaction* queue[NW_SERIAL_QUEUE_LEN];
+    volatile uint32 headIdx;
+    volatile uint32 tailIdx;
+    uint8 transferIdx;
+    NexaWattSerialStats stats;
+} NexaWattSerialBus;
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+static NexaWattSerialBus serialBuses[NW_SERIAL_MAX_BUSES];
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Handler executed by the HAL implementation in the interrupt context, when a transfer is completed.
+ * The next transfer of the active transaction is started; after the last one, the transaction is completed
+ * and the next queued transaction is started.
+ * \param bus - The number of the serial bus.
+ * \param transferStatus - The status of the completed transfer.
+ */
+static void NexaWatt_HalWrapperSerial_Transfer_Done_Handler(uint8 bus, NexaWattSerialStatusResult transferStatus);
+
+/**
+ * \brief Deferred event handler, executing the callback of a completed transaction in the main loop.
+ * \param eventContext - The completed transaction.
+ * \param eventArg - The status of the transaction.
+ */
+static void NexaWatt_HalWrapperSerial_Completion_Event_Handler(void* eventContext, uint32 eventArg);
+
+/**
+ * \brief Simple helper function that starts the first transfer of the transaction at the tail of the queue.
+ * Transactions, whose first transfer cannot be started, are completed with the returned status and the next one is tried.
+ * \param bus - The number of the serial bus.
+ */
+static void NexaWatt_HalWrapperSerial_Start_Front_Transaction(uint8 bus);
+
+/**
+ * \brief Simple helper function that removes the transaction at the tail of the queue, stores its status
+ * and posts its callback as a deferred event.
+ * \param bus - The number of the serial bus.
+ * \param transactionStatus - The status of the transaction.
+ */
+static void NexaWatt_HalWrapperSerial_Complete_Front_Transaction(uint8 bus, NexaWattSerialStatusResult transactionStatus);
+
+/**
+ * \brief Simple helper function that starts a transfer using the HAL function bound in the HAL Context.
+ * \param bus - The number of the serial bus.
+ * \param transfer - A pointer to the transfer.
+ * \return The status of the start of the transfer.
+ */
+NW_LOCAL_INLINE NexaWattSerialStatusResult NexaWatt_HalWrapperSerial_Start_Transfer(uint8 bus, const NexaWattSerialTransfer* transfer);
+
+/**
+ * \brief Simple helper function, used to reduce the code duplication across the HAL Wrapper Serial implementation.
+ * The function performs an export of the bind HAL Init Function in the HAL Context component and validates the export result.
+ * In case of successful export, the HAL Context Function Config Callout is being executed.
+ * \param initFncType - An enumeration, representing the framework's standardized HAL Initialization functions supported.
+ * \param halContextFncConfig - A pointer, containing the framework's standardized HAL Context Function configuration structure.
+ * \return NW_HAL_CONTEXT_BAD_PARAM - The validation of the provided parameters failed.
+ * \return NW_HAL_CONTEXT_NOT_FOUND - The validation of the provided parameters was successful, but such Initialization function is not bind in the HAL Context component.
+ * \return NW_HAL_CONTEXT_OK - The HAL Context Initialization function is exported. The configured callout function is executed.
+ */
+NW_LOCAL_INLINE NexaWattHalContextStatusResult NexaWatt_HalWrapperSerial_Handle_Common_Init_Fnc_Exec_Seq(NexaWattHalContextInitFunctionTypes initFncType, NexaWattHalContextFunction *halContextFncConfig);
+
+/**
+ * \brief Simple helper function, used to reduce the code duplication across the HAL Wrapper Serial implementation.
+ * The function performs an export of the bind HAL Function in the HAL Context component and validates the export result.
+ * In case of successful export, the HAL Context Function Config Callout is being executed.
+ * \param halFncType - An enumeration, representing the framework's standardized HAL Functions supported.
+ * \param halContextFncConfig - A pointer, containing the framework's standardized HAL Context Function configuration structure.
+ * \return NW_HAL_CONTEXT_BAD_PARAM - The validation of the provided parameters failed.
+ * \return NW_HAL_CONTEXT_NOT_FOUND - The validation of the provided parameters was successful, but such HAL function is not bind in the HAL Context component.
+ * \return NW_HAL_CONTEXT_OK - The HAL Context function is exported. The configured callout function is executed.
+ */
+NW_LOCAL_INLINE NexaWattHalContextStatusResult NexaWatt_HalWrapperSerial_Handle_Common_Hal_Fnc_Exec_Seq(NexaWattHalContextFunctionTypes halFncType, NexaWattHalContextFunction *halContextFncConfig);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattSerialStatusResult NexaWatt_HalWrapperSerial_Init_Bus(const uint8 bus, const NexaWattSerialBusConfig* const busConfig)
+{
+    NexaWattSerialStatusResult retRes = NW_SERIAL_BAD_PARAM;
+    NexaWattHalContextFunction serialBusInitFncConfig;
+    NexaWattSerialStatusResult (*serialBusInitFncPtrCasted)(const uint8, const NexaWattSerialBusConfig* const, const NwSerialHalTransferHandler);
+    NexaWattHalContextStatusResult serialBusInitExportRes = NW_HAL_CONTEXT_BAD_PARAM;
+    NexaWattSerialBus* serialBus = NULL;
+
+    if ((bus < NW_SERIAL_MAX_BUSES) &&
+        (busConfig != NULL) &&
+        (busConfig->busType <= NW_SERIAL_BUS_I2C) &&
+        (busConfig->bitRateHz > 0u))
+    {
+        serialBusInitExportRes =
+                NexaWatt_HalWrapperSerial_Handle_Common_Init_Fnc_Exec_Seq(NW_HAL_SERIAL_BUS_INIT, &serialBusInitFncConfig);
+    }
+
+    if (serialBusInitExportRes == NW_HAL_CONTEXT_OK)
+    {
+        serialBus = &serialBuses[bus];
+        serialBus->isInitialized = nwFalse;
+        serialBus->headIdx = 0u;
+        serialBus->tailIdx = 0u;
+        serialBus->transferIdx = 0u;
+        serialBus->stats.completedCnt = 0u;
+        serialBus->stats.failedCnt = 0u;
+        serialBus->stats.transferCnt = 0u;
+        serialBus->stats.lostCallbackCnt = 0u;
+        serialBus->stats.maxQueuedCnt = 0u;
+
+        serialBusInitFncPtrCasted = (NexaWattSerialStatusResult (*)(const uint8, const NexaWattSerialBusConfig* const, const NwSerialHalTransferHandler))serialBusInitFncConfig.fncPtr;
+        retRes = serialBusInitFncPtrCasted(bus, busConfig, NexaWatt_HalWrapperSerial_Transfer_Done_Handler);
+        if (retRes == NW_SERIAL_SUCCESS)
+        {
+            serialBus->isInitialized = nwTrue;
+        }
+
+        if (serialBusInitFncConfig.fncCallback != NULL)
+        {
+            serialBusInitFncConfig.fncCallback();
+        }
+    }
+
+    return retRes;
+}
+
+NexaWattSerialStatusResult NexaWatt_HalWrapperSerial_DeInit_Bus(const uint8 bus)
+{
+    NexaWattSerialStatusResult retRes = NW_SERIAL_BAD_PARAM;
+    NexaWattHalContextFunction serialBusDeInitFncConfig;
+    NexaWattSerialStatusResult (*serialBusDeInitFncPtrCasted)(const uint8);
+    NexaWattHalContextStatusResult serialBusDeInitExportRes = NW_HAL_CONTEXT_BAD_PARAM;
+
+    if (bus < NW_SERIAL_MAX_BUSES)
+    {
+        if (serialBuses[bus].isInitialized == nwTrue)
+        {
+            (void)NexaWatt_HalWrapperSerial_Abort(bus);
+        }
+
+        serialBusDeInitExportRes =
+                NexaWatt_HalWrapperSerial_Handle_Common_Init_Fnc_Exec_Seq(NW_HAL_SERIAL_BUS_DEINIT, &serialBusDeInitFncConfig);
+    }
+
+    if (serialBusDeInitExportRes == NW_HAL_CONTEXT_OK)
+    {
+        serialBusDeInitFncPtrCasted = (NexaWattSerialStatusResult (*)(const uint8))serialBusDeInitFncConfig.fncPtr;
+        retRes = serialBusDeInitFncPtrCasted(bus);
+        serialBuses[bus].isInitialized = nwFalse;
+
+        if (serialBusDeInitFncConfig.fncCallback != NULL)
+        {
+            serialBusDeInitFncConfig.fncCallback();
+        }
+    }
+
+    return retRes;
+}
+
+NexaWattSerialStatusResult NexaWatt_HalWrapperSerial_Submit(const uint8 bus, NexaWattSerialTransaction* const transaction)
+{
+    NexaWattSerialStatusResult retRes = NW_SERIAL_BAD_PARAM;
+    NexaWattSerialBus* serialBus = NULL;
+    NwCriticalSectionState criticalSectionState = 0u;
+    uint32 queuedCnt = 0u;
+
+    if ((bus < NW_SERIAL_MAX_BUSES) &&
+        (serialBuses[bus].isInitialized == nwTrue) &&
+        (transaction != NULL) &&
+        (transaction->transfers != NULL) &&
+        (transaction->transferCnt > 0u) &&
+        (transaction->state != NW_SERIAL_TRANSACTION_QUEUED) &&
+        (transaction->state != NW_SERIAL_TRANSACTION_ACTIVE))
+    {
+        serialBus = &serialBuses[bus];
+
+        criticalSectionState = NexaWatt_Platform_Critical_Section_Enter();
+
+        queuedCnt = serialBus->headIdx - serialBus->tailIdx;
+        if (queuedCnt < NW_SERIAL_QUEUE_LEN)
+        {
+            transaction->state = NW_SERIAL_TRANSACTION_QUEUED;
+            transaction->status = NW_SERIAL_BUSY;
+            serialBus->queue[NW_SERIAL_QUEUE_SLOT(serialBus->headIdx)] = transaction;
+            serialBus->headIdx++;
+
+            serialBus->stats.maxQueuedCnt = ((queuedCnt + 1u) > serialBus->stats.maxQueuedCnt) ?
+                    (uint8)(queuedCnt + 1u) : serialBus->stats.maxQueuedCnt;
+
+            retRes = NW_SERIAL_SUCCESS;
+        }
+        else
+        {
+            retRes = NW_SERIAL_BUSY;
+        }
+
+        NexaWatt_Platform_Critical_Section_Exit(criticalSectionState);
+
+        // An empty queue means an idle bus; otherwise the transaction is started by the completion of its predecessor
+        if ((retRes == NW_SERIAL_SUCCESS) &&
+            (queuedCnt == 0u))
+        {
+            NexaWatt_HalWrapperSerial_Start_Front_Transaction(bus);
+        }
+    }
+
+    return retRes;
+}
+
+NexaWattSerialStatusResult NexaWatt_HalWrapperSerial_Abort(const uint8 bus)
+{
+    NexaWattSerialStatusResult retRes = NW_SERIAL_BAD_PARAM;
+    NexaWattHalContextFunction serialAbortFncConfig;
+    void (*serialAbortFncPtrCasted)(const uint8);
+    NexaWattHalContextStatusResult serialAbortExportRes = NW_HAL_CONTEXT_BAD_PARAM;
+
+    if ((bus < NW_SERIAL_MAX_BUSES) &&
+        (serialBuses[bus].isInitialized == nwTrue))
+    {
+        serialAbortExportRes =
+                NexaWatt_HalWrapperSerial_Handle_Common_Hal_Fnc_Exec_Seq(NW_HAL_SERIAL_ABORT, &serialAbortFncConfig);
+    }
+
+    if (serialAbortExportRes == NW_HAL_CONTEXT_OK)
+    {
+        // The HAL does not report the aborted transfer, so the queue is emptied here
+        serialAbortFncPtrCasted = (void (*)(const uint8))serialAbortFncConfig.fncPtr;
+        serialAbortFncPtrCasted(bus);
+
+        while (serialBuses[bus].tailIdx != serialBuses[bus].headIdx)
+        {
+            NexaWatt_HalWrapperSerial_Complete_Front_Transaction(bus, NW_SERIAL_ABORTED);
+        }
+
+        retRes = NW_SERIAL_SUCCESS;
+
+        if (serialAbortFncConfig.fncCallback != NULL)
+        {
+            serialAbortFncConfig.fncCallback();
+        }
+    }
+
+    return retRes;
+}
+
+nw_bool NexaWatt_HalWrapperSerial_Is_Idle(const uint8 bus)
+{
+    return (bus >= NW_SERIAL_MAX_BUSES) ||
+           (serialBuses[bus].tailIdx == serialBuses[bus].headIdx);
+}
+
+void NexaWatt_HalWrapperSerial_Get_Stats(const uint8 bus, NexaWattSerialStats* const serialStats)
+{
+    NwCriticalSectionState criticalSectionState = 0u;
+
+    if ((bus < NW_SERIAL_MAX_BUSES) &&
+        (serialStats != NULL))
+    {
+        criticalSectionState = NexaWatt_Platform_Critical_Section_Enter();
+        *serialStats = serialBuses[bus].stats;
+        NexaWatt_Platform_Critical_Section_Exit(criticalSectionState);
+    }
+}
+
+static void NexaWatt_HalWrapperSerial_Transfer_Done_Handler(const uint8 bus, const NexaWattSerialStatusResult transferStatus)
+{
+    NexaWattSerialBus* serialBus = NULL;
+    NexaWattSerialTransaction* transaction = NULL;
+    NexaWattSerialStatusResult transactionStatus = transferStatus;
+
+    if ((bus < NW_SERIAL_MAX_BUSES) &&
+        (serialBuses[bus].tailIdx != serialBuses[bus].headIdx))
+    {
+        serialBus = &serialBuses[bus];
+        transaction = serialBus->queue[NW_SERIAL_QUEUE_SLOT(serialBus->tailIdx)];
+        serialBus->stats.transferCnt++;
+        serialBus->transferIdx++;
+
+        if ((transactionStatus == NW_SERIAL_SUCCESS) &&
+            (serialBus->transferIdx < transaction->transferCnt))
+        {
+            // The batch continues from the interrupt, without a round trip through the main loop
+            transactionStatus =
+                    NexaWatt_HalWrapperSerial_Start_Transfer(bus, &transaction->transfers[serialBus->transferIdx]);
+            if (transactionStatus != NW_SERIAL_SUCCESS)
+            {
+                NexaWatt_HalWrapperSerial_Complete_Front_Transaction(bus, transactionStatus);
+                NexaWatt_HalWrapperSerial_Start_Front_Transaction(bus);
+            }
+        }
+        else
+        {
+            NexaWatt_HalWrapperSerial_Complete_Front_Transaction(bus, transactionStatus);
+            NexaWatt_HalWrapperSerial_Start_Front_Transaction(bus);
+        }
+    }
+}
+
+static void NexaWatt_HalWrapperSerial_Completion_Event_Handler(void* const eventContext, const uint32 eventArg)
+{
+    NexaWattSerialTransaction* const transaction = (NexaWattSerialTransaction*)eventContext;
+
+    transaction->callback(transaction, (NexaWattSerialStatusResult)eventArg);
+}
+
+static void NexaWatt_HalWrapperSerial_Start_Front_Transaction(const uint8 bus)
+{
+    NexaWattSerialBus* const serialBus = &serialBuses[bus];
+    NexaWattSerialTransaction* transaction = NULL;
+    NexaWattSerialStatusResult startRes = NW_SERIAL_BUSY;
+
+    while ((startRes != NW_SERIAL_SUCCESS) &&
+           (serialBus->tailIdx != serialBus->headIdx))
+    {
+        transaction = serialBus->queue[NW_SERIAL_QUEUE_SLOT(serialBus->tailIdx)];
+        transaction->state = NW_SERIAL_TRANSACTION_ACTIVE;
+        serialBus->transferIdx = 0u;
+
+        startRes = NexaWatt_HalWrapperSerial_Start_Transfer(bus, &transaction->transfers[0u]);
+        if (startRes != NW_SERIAL_SUCCESS)
+        {
+            NexaWatt_HalWrapperSerial_Complete_Front_Transaction(bus, startRes);
+        }
+    }
+}
+
+static void NexaWatt_HalWrapperSerial_Complete_Front_Transaction(const uint8 bus, const NexaWattSerialStatusResult transactionStatus)
+{
+    NexaWattSerialBus* const serialBus = &serialBuses[bus];
+    NexaWattSerialTransaction* transaction = NULL;
+    NexaWattMiniOsStatusResult postRes = NW_MINI_OS_SUCCESS;
+    NwCriticalSectionState criticalSectionState = 0u;
+
+    criticalSectionState = NexaWatt_Platform_Critical_Section_Enter();
+    transaction = serialBus->queue[NW_SERIAL_QUEUE_SLOT(serialBus->tailIdx)];
+    serialBus->tailIdx++;
+
+    if (transactionStatus == NW_SERIAL_SUCCESS)
+    {
+        serialBus->stats.completedCnt++;
+    }
+    else
+    {
+        serialBus->stats.failedCnt++;
+    }
+    NexaWatt_Platform_Critical_Section_Exit(criticalSectionState);
+
+    transaction->status = transactionStatus;
+    transaction->state = NW_SERIAL_TRANSACTION_DONE;
+
+    if (transaction->callback != NULL)
+    {
+        postRes = NexaWatt_MiniOs_Event_Post(NexaWatt_HalWrapperSerial_Completion_Event_Handler, transaction, (uint32)transactionStatus);
+        if (postRes != NW_MINI_OS_SUCCESS)
+        {
+            serialBus->stats.lostCallbackCnt++;
+        }
+    }
+}
+
+NW_LOCAL_INLINE NexaWattSerialStatusResult NexaWatt_HalWrapperSerial_Start_Transfer(const uint8 bus, const NexaWattSerialTransfer* const transfer)
+{
+    NexaWattSerialStatusResult retRes = NW_SERIAL_FATAL_ERR;
+    NexaWattHalContextFunction serialStartXferFncConfig;
+    NexaWattSerialStatusResult (*serialStartXferFncPtrCasted)(const uint8, const NexaWattSerialTransfer* const);
+
+    NexaWattHalContextStatusResult serialStartXferExportRes =
+            NexaWatt_HalWrapperSerial_Handle_Common_Hal_Fnc_Exec_Seq(NW_HAL_SERIAL_START_XFER, &serialStartXferFncConfig);
+    if (serialStartXferExportRes == NW_HAL_CONTEXT_OK)
+    {
+        serialStartXferFncPtrCasted = (NexaWattSerialStatusResult (*)(const uint8, const NexaWattSerialTransfer* const))serialStartXferFncConfig.fncPtr;
+        retRes = serialStartXferFncPtrCasted(bus, transfer);
+
+        if (serialStartXferFncConfig.fncCallback != NULL)
+        {
+            serialStartXferFncConfig.fncCallback();
+        }
+    }
+
+    return retRes;
+}
+
+NW_LOCAL_INLINE NexaWattHalContextStatusResult NexaWatt_HalWrapperSerial_Handle_Common_Init_Fnc_Exec_Seq(
+        NexaWattHalContextInitFunctionTypes initFncType, NexaWattHalContextFunction *halContextFncConfig)
+{
+    NexaWattHalContextStatusResult retRes = NW_HAL_CONTEXT_BAD_PARAM;
+
+    // Static analysis warning: Condition is always true
+    // Justification: Defensive programming style in case of misuse by the framework user
+    if (initFncType < NW_HAL_INIT_FUNC_INVALID)
+    {
+        retRes = NexaWatt_HalContext_Export_Init_Function(initFncType, halContextFncConfig);
+        if (retRes == NW_HAL_CONTEXT_OK)
+        {
+            // Trigger fault in case the function is not bind
+            NW_ASSERT(halContextFncConfig->fncPtr != NULL);
+
+            if (halContextFncConfig->fncCallout != NULL)
+            {
+                halContextFncConfig->fncCallout();
+            }
+        }
+    }
+
+    return retRes;
+}
+
+NW_LOCAL_INLINE NexaWattHalContextStatusResult NexaWatt_HalWrapperSerial_Handle_Common_Hal_Fnc_Exec_Seq(
+        NexaWattHalContextFunctionTypes halFncType, NexaWattHalContextFunction *halContextFncConfig)
+{
+    NexaWattHalContextStatusResult retRes = NW_HAL_CONTEXT_BAD_PARAM;
+
+    // Static analysis warning: Condition is always true
+    // Justification: Defensive programming style in case of misuse by the framework user
+    if (NW_RUNTIME_CHECK(halFncType < NW_HAL_FUNC_INVALID))
+    {
+        retRes = NexaWatt_HalContext_Export_Function(halFncType, halContextFncConfig);
+        if (retRes == NW_HAL_CONTEXT_OK)
+        {
+            // Trigger fault in case the function is not bind
+            NW_RUNTIME_ASSERT(halContextFncConfig->fncPtr != NULL);
+
+            if (halContextFncConfig->fncCallout != NULL)
+            {
+                halContextFncConfig->fncCallout();
+            }
+        }
+    }
+
+    return retRes;
+}
@@ -0,0 +1,281 @@
+/*******************************************************************************
+* File Name:   hal_wrapper_timer.c
+*
+* Description: This is the source file containing definitions,
+* related to the HAL Wrapper for the hardware timer peripheral. This wrapper is directly
+* used by the NexaWattIV.DC framework and aims to provide maximum level of
+* abstraction on the used MCU.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "hal_wrapper_timer.h"
+#include "hal_context_export.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function, used to reduce the code duplication across the HAL Wrapper Timer implementation.
+ * The function performs an export of the bind HAL Init Function in the HAL Context component and validates the export result.
+ * In case of successful export, the HAL Context Function Config Callout is being executed.
+ * \param initFncType - An enumeration, representing the framework's standardized HAL Initialization functions supported.
+ * \param halContextFncConfig - A pointer, containing the framework's standardized HAL Context Function configuration structure.
+ * \return NW_HAL_CONTEXT_BAD_PARAM - The validation of the provided parameters failed.
+ * \return NW_HAL_CONTEXT_NOT_FOUND - The validation of the provided parameters was successful, but such Initialization function is not bind in the HAL Context component.
+ * \return NW_HAL_CONTEXT_OK - The HAL Context Initialization function is exported. The configured callout function is executed.
+ */
+NW_LOCAL_INLINE NexaWattHalContextStatusResult NexaWatt_HalWrapperTimer_Handle_Common_Init_Fnc_Exec_Seq(NexaWattHalContextInitFunctionTypes initFncType, NexaWattHalContextFunction *halContextFncConfig);
+
+/**
+ * \brief Simple helper function, used to reduce the code duplication across the HAL Wrapper Timer implementation.
+ * The function performs an export of the bind HAL Function in the HAL Context component and validates the export result.
+ * In case of successful export, the HAL Context Function Config Callout is being executed.
+ * \param halFncType - An enumeration, representing the framework's standardized HAL Functions supported.
+ * \param halContextFncConfig - A pointer, containing the framework's standardized HAL Context Function configuration structure.
+ * \return NW_HAL_CONTEXT_BAD_PARAM - The validation of the provided parameters failed.
+ * \return NW_HAL_CONTEXT_NOT_FOUND - The validation of the provided parameters was successful, but such HAL function is not bind in the HAL Context component.
+ * \return NW_HAL_CONTEXT_OK - The HAL Context function is exported. The configured callout function is executed.
+ */
+NW_LOCAL_INLINE NexaWattHalContextStatusResult NexaWatt_HalWrapperTimer_Handle_Common_Hal_Fnc_Exec_Seq(NexaWattHalContextFunctionTypes halFncType, NexaWattHalContextFunction *halContextFncConfig);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattTimerStatusResult NexaWatt_HalWrapperTimer_Init(const uint8 timer, const NexaWattTimerConfig* const timerConfig)
+{
+    NexaWattTimerStatusResult retRes = NW_TIMER_BAD_PARAM;
+    NexaWattHalContextFunction timerInitFncConfig;
+    NexaWattTimerStatusResult (*timerInitFncPtrCasted)(const uint8, const NexaWattTimerConfig* const);
+    NexaWattHalContextStatusResult timerInitExportRes = NW_HAL_CONTEXT_BAD_PARAM;
+
+    if ((timer < NW_TIMER_MAX_TIMERS) &&
+        (timerConfig != NULL))
+    {
+        timerInitExportRes =
+                NexaWatt_HalWrapperTimer_Handle_Common_Init_Fnc_Exec_Seq(NW_HAL_TIMER_INIT, &timerInitFncConfig);
+    }
+
+    if (timerInitExportRes == NW_HAL_CONTEXT_OK)
+    {
+        timerInitFncPtrCasted = (NexaWattTimerStatusResult (*)(const uint8, const NexaWattTimerConfig* const))timerInitFncConfig.fncPtr;
+        retRes = timerInitFncPtrCasted(timer, timerConfig);
+
+        if (timerInitFncConfig.fncCallback != NULL)
+        {
+            timerInitFncConfig.fncCallback();
+        }
+    }
+
+    return retRes;
+}
+
+NexaWattTimerStatusResult NexaWatt_HalWrapperTimer_DeInit(const uint8 timer)
+{
+    NexaWattTimerStatusResult retRes = NW_TIMER_BAD_PARAM;
+    NexaWattHalContextFunction timerDeInitFncConfig;
+    NexaWattTimerStatusResult (*timerDeInitFncPtrCasted)(const uint8);
+    NexaWattHalContextStatusResult timerDeInitExportRes = NW_HAL_CONTEXT_BAD_PARAM;
+
+    if (timer < NW_TIMER_MAX_TIMERS)
+    {
+        timerDeInitExportRes =
+                NexaWatt_HalWrapperTimer_Handle_Common_Init_Fnc_Exec_Seq(NW_HAL_TIMER_DEINIT, &timerDeInitFncConfig);
+    }
+
+    if (timerDeInitExportRes == NW_HAL_CONTEXT_OK)
+    {
+        timerDeInitFncPtrCasted = (NexaWattTimerStatusResult (*)(const uint8))timerDeInitFncConfig.fncPtr;
+        retRes = timerDeInitFncPtrCasted(timer);
+
+        if (timerDeInitFncConfig.fncCallback != NULL)
+        {
+            timerDeInitFncConfig.fncCallback();
+        }
+    }
+
+    return retRes;
+}
+
+NexaWattTimerStatusResult NexaWatt_HalWrapperTimer_Start(const uint8 timer)
+{
+    NexaWattTimerStatusResult retRes = NW_TIMER_BAD_PARAM;
+    NexaWattHalContextFunction timerStartFncConfig;
+    NexaWattTimerStatusResult (*timerStartFncPtrCasted)(const uint8);
+    NexaWattHalContextStatusResult timerStartExportRes = NW_HAL_CONTEXT_BAD_PARAM;
+
+    if (NW_RUNTIME_CHECK(timer < NW_TIMER_MAX_TIMERS))
+    {
+        timerStartExportRes =
+                NexaWatt_HalWrapperTimer_Handle_Common_Hal_Fnc_Exec_Seq(NW_HAL_TIMER_START, &timerStartFncConfig);
+    }
+
+    if (timerStartExportRes == NW_HAL_CONTEXT_OK)
+    {
+        timerStartFncPtrCasted = (NexaWattTimerStatusResult (*)(const uint8))timerStartFncConfig.fncPtr;
+        retRes = timerStartFncPtrCasted(timer);
+
+        if (timerStartFncConfig.fncCallback != NULL)
+        {
+            timerStartFncConfig.fncCallback();
+        }
+    }
+
+    return retRes;
+}
+
+NexaWattTimerStatusResult NexaWatt_HalWrapperTimer_Stop(const uint8 timer)
+{
+    NexaWattTimerStatusResult retRes = NW_TIMER_BAD_PARAM;
+    NexaWattHalContextFunction timerStopFncConfig;
+    NexaWattTimerStatusResult (*timerStopFncPtrCasted)(const uint8);
+    NexaWattHalContextStatusResult timerStopExportRes = NW_HAL_CONTEXT_BAD_PARAM;
+
+    if (NW_RUNTIME_CHECK(timer < NW_TIMER_MAX_TIMERS))
+    {
+        timerStopExportRes =
+                NexaWatt_HalWrapperTimer_Handle_Common_Hal_Fnc_Exec_Seq(NW_HAL_TIMER_STOP, &timerStopFncConfig);
+    }
+
+    if (timerStopExportRes == NW_HAL_CONTEXT_OK)
+    {
+        timerStopFncPtrCasted = (NexaWattTimerStatusResult (*)(const uint8))timerStopFncConfig.fncPtr;
+        retRes = timerStopFncPtrCasted(timer);
+
+        if (timerStopFncConfig.fncCallback != NULL)
+        {
+            timerStopFncConfig.fncCallback();
+        }
+    }
+
+    return retRes;
+}
+
+NwTimerTicks NexaWatt_HalWrapperTimer_Read_Counter(const uint8 timer)
+{
+    NwTimerTicks retVal = 0u;
+    NexaWattHalContextFunction timerReadCounterFncConfig;
+    NwTimerTicks (*timerReadCounterFncPtrCasted)(const uint8);
+
+    NexaWattHalContextStatusResult timerReadCounterExportRes =
+            NexaWatt_HalWrapperTimer_Handle_Common_Hal_Fnc_Exec_Seq(NW_HAL_TIMER_READ_COUNTER, &timerReadCounterFncConfig);
+    if (timerReadCounterExportRes == NW_HAL_CONTEXT_OK)
+    {
+        timerReadCounterFncPtrCasted = (NwTimerTicks (*)(const uint8))timerReadCounterFncConfig.fncPtr;
+        retVal = timerReadCounterFncPtrCasted(timer);
+
+        if (timerReadCounterFncConfig.fncCallback != NULL)
+        {
+            timerReadCounterFncConfig.fncCallback();
+        }
+    }
+
+    return retVal;
+}
+
+nw_bool NexaWatt_HalWrapperTimer_Get_Overflow_Status(const uint8 timer)
+{
+    nw_bool retVal = nwFalse;
+    NexaWattHalContextFunction timerGetOvfStatFncConfig;
+    nw_bool (*timerGetOvfStatFncPtrCasted)(const uint8);
+
+    NexaWattHalContextStatusResult timerGetOvfStatExportRes =
+            NexaWatt_HalWrapperTimer_Handle_Common_Hal_Fnc_Exec_Seq(NW_HAL_TIMER_GET_OVF_STAT, &timerGetOvfStatFncConfig);
+    if (timerGetOvfStatExportRes == NW_HAL_CONTEXT_OK)
+    {
+        timerGetOvfStatFncPtrCasted = (nw_bool (*)(const uint8))timerGetOvfStatFncConfig.fncPtr;
+        retVal = timerGetOvfStatFncPtrCasted(timer);
+
+        if (timerGetOvfStatFncConfig.fncCallback != NULL)
+        {
+            timerGetOvfStatFncConfig.fncCallback();
+        }
+    }
+
+    return retVal;
+}
+
+void NexaWatt_HalWrapperTimer_Clear_Overflow_Status(const uint8 timer)
+{
+    NexaWattHalContextFunction timerClearOvfStatFncConfig;
+    void (*timerClearOvfStatFncPtrCasted)(const uint8);
+
+    NexaWattHalContextStatusResult timerClearOvfStatExportRes =
+            NexaWatt_HalWrapperTimer_Handle_Common_Hal_Fnc_Exec_Seq(NW_HAL_TIMER_CLEAR_OVF_STAT, &timerClearOvfStatFncConfig);
+    if (timerClearOvfStatExportRes == NW_HAL_CONTEXT_OK)
+    {
+        timerClearOvfStatFncPtrCasted = (void (*)(const uint8))timerClearOvfStatFncConfig.fncPtr;
+        timerClearOvfStatFncPtrCasted(timer);
+
+        if (timerClearOvfStatFncConfig.fncCallback != NULL)
+        {
+            timerClearOvfStatFncConfig.fncCallback();
+        }
+    }
+}
+
+NW_LOCAL_INLINE NexaWattHalContextStatusResult NexaWatt_HalWrapperTimer_Handle_Common_Init_Fnc_Exec_Seq(
+        NexaWattHalContextInitFunctionTypes initFncType, NexaWattHalContextFunction *halContextFncConfig)
+{
+    NexaWattHalContextStatusResult retRes = NW_HAL_CONTEXT_BAD_PARAM;
+
+    // Static analysis warning: Condition is always true
+    // Justification: Defensive programming style in case of misuse by the framework user
+    if (initFncType < NW_HAL_INIT_FUNC_INVALID)
+    {
+        retRes = NexaWatt_HalContext_Export_Init_Function(initFncType, halContextFncConfig);
+        if (retRes == NW_HAL_CONTEXT_OK)
+        {
+            // Trigger fault in case the function is not bind
+            NW_ASSERT(halContextFncConfig->fncPtr != NULL);
+
+            if (halContextFncConfig->fncCallout != NULL)
+            {
+                halContextFncConfig->fncCallout();
+            }
+        }
+    }
+
+    return retRes;
+}
+
+NW_LOCAL_INLINE NexaWattHalContextStatusResult NexaWatt_HalWrapperTimer_Handle_Common_Hal_Fnc_Exec_Seq(
+        NexaWattHalContextFunctionTypes halFncType, NexaWattHalContextFunction *halContextFncConfig)
+{
+    NexaWattHalContextStatusResult retRes = NW_HAL_CONTEXT_BAD_PARAM;
+
+    // Static analysis warning: Condition is always true
+    // Justification: Defensive programming style in case of misuse by the framework user
+    if (NW_RUNTIME_CHECK(halFncType < NW_HAL_FUNC_INVALID))
+    {
+        retRes = NexaWatt_HalContext_Export_Function(halFncType, halContextFncConfig);
+        if (retRes == NW_HAL_CONTEXT_OK)
+        {
+            // Trigger fault in case the function is not bind
+            NW_RUNTIME_ASSERT(halContextFncConfig->fncPtr != NULL);
+
+            if (halContextFncConfig->fncCallout != NULL)
+            {
+                halContextFncConfig->fncCallout();
+            }
+        }
+    }
+
+    return retRes;
+}
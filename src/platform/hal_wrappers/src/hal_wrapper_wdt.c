@@ -0,0 +1,178 @@
+/*******************************************************************************
+* File Name:   hal_wrapper_wdt.c
+*
+* Description: This is the source file containing definitions,
+* related to the HAL Wrapper for the hardware watchdog. This wrapper is directly
+* used by the NexaWattIV.DC framework and aims to provide maximum level of
+* abstraction on the used MCU.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "hal_wrapper_wdt.h"
+#include "hal_context_export.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function, used to reduce the code duplication across the HAL Wrapper WDT implementation.
+ * The function performs an export of the bind HAL Init Function in the HAL Context component and validates the export result.
+ * In case of successful export, the HAL Context Function Config Callout is being executed.
+ * \param initFncType - An enumeration, representing the framework's standardized HAL Initialization functions supported.
+ * \param halContextFncConfig - A pointer, containing the framework's standardized HAL Context Function configuration structure.
+ * \return NW_HAL_CONTEXT_BAD_PARAM - The validation of the provided parameters failed.
+ * \return NW_HAL_CONTEXT_NOT_FOUND - The validation of the provided parameters was successful, but such Initialization function is not bind in the HAL Context component.
+ * \return NW_HAL_CONTEXT_OK - The HAL Context Initialization function is exported. The configured callout function is executed.
+ */
+NW_LOCAL_INLINE NexaWattHalContextStatusResult NexaWatt_HalWrapperWdt_Handle_Common_Init_Fnc_Exec_Seq(NexaWattHalContextInitFunctionTypes initFncType, NexaWattHalContextFunction *halContextFncConfig);
+
+/**
+ * \brief Simple helper function, used to reduce the code duplication across the HAL Wrapper WDT implementation.
+ * The function performs an export of the bind HAL Function in the HAL Context component and validates the export result.
+ * In case of successful export, the HAL Context Function Config Callout is being executed.
+ * \param halFncType - An enumeration, representing the framework's standardized HAL Functions supported.
+ * \param halContextFncConfig - A pointer, containing the framework's standardized HAL Context Function configuration structure.
+ * \return NW_HAL_CONTEXT_BAD_PARAM - The validation of the provided parameters failed.
+ * \return NW_HAL_CONTEXT_NOT_FOUND - The validation of the provided parameters was successful, but such HAL function is not bind in the HAL Context component.
+ * \return NW_HAL_CONTEXT_OK - The HAL Context function is exported. The configured callout function is executed.
+ */
+NW_LOCAL_INLINE NexaWattHalContextStatusResult NexaWatt_HalWrapperWdt_Handle_Common_Hal_Fnc_Exec_Seq(NexaWattHalContextFunctionTypes halFncType, NexaWattHalContextFunction *halContextFncConfig);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattWdtStatusResult NexaWatt_HalWrapperWdt_Init(const NexaWattWdtConfig* const wdtConfig)
+{
+    NexaWattWdtStatusResult retRes = NW_WDT_BAD_PARAM;
+    NexaWattHalContextFunction wdtInitFncConfig;
+    NexaWattWdtStatusResult (*wdtInitFncPtrCasted)(const NexaWattWdtConfig* const);
+    NexaWattHalContextStatusResult wdtInitExportRes = NW_HAL_CONTEXT_BAD_PARAM;
+
+    if ((wdtConfig != NULL) &&
+        (wdtConfig->timeoutUs > 0u))
+    {
+        wdtInitExportRes =
+                NexaWatt_HalWrapperWdt_Handle_Common_Init_Fnc_Exec_Seq(NW_HAL_WDT_INIT, &wdtInitFncConfig);
+    }
+
+    if (wdtInitExportRes == NW_HAL_CONTEXT_OK)
+    {
+        wdtInitFncPtrCasted = (NexaWattWdtStatusResult (*)(const NexaWattWdtConfig* const))wdtInitFncConfig.fncPtr;
+        retRes = wdtInitFncPtrCasted(wdtConfig);
+
+        if (wdtInitFncConfig.fncCallback != NULL)
+        {
+            wdtInitFncConfig.fncCallback();
+        }
+    }
+
+    return retRes;
+}
+
+void NexaWatt_HalWrapperWdt_Kick(void)
+{
+    NexaWattHalContextFunction wdtKickFncConfig;
+    void (*wdtKickFncPtrCasted)(void);
+
+    NexaWattHalContextStatusResult wdtKickExportRes =
+            NexaWatt_HalWrapperWdt_Handle_Common_Hal_Fnc_Exec_Seq(NW_HAL_WDT_KICK, &wdtKickFncConfig);
+    if (wdtKickExportRes == NW_HAL_CONTEXT_OK)
+    {
+        wdtKickFncPtrCasted = (void (*)(void))wdtKickFncConfig.fncPtr;
+        wdtKickFncPtrCasted();
+
+        if (wdtKickFncConfig.fncCallback != NULL)
+        {
+            wdtKickFncConfig.fncCallback();
+        }
+    }
+}
+
+nw_bool NexaWatt_HalWrapperWdt_Get_Reset_Status(void)
+{
+    nw_bool retVal = nwFalse;
+    NexaWattHalContextFunction wdtGetResetStatFncConfig;
+    nw_bool (*wdtGetResetStatFncPtrCasted)(void);
+
+    NexaWattHalContextStatusResult wdtGetResetStatExportRes =
+            NexaWatt_HalWrapperWdt_Handle_Common_Hal_Fnc_Exec_Seq(NW_HAL_WDT_GET_RESET_STAT, &wdtGetResetStatFncConfig);
+    if (wdtGetResetStatExportRes == NW_HAL_CONTEXT_OK)
+    {
+        wdtGetResetStatFncPtrCasted = (nw_bool (*)(void))wdtGetResetStatFncConfig.fncPtr;
+        retVal = wdtGetResetStatFncPtrCasted();
+
+        if (wdtGetResetStatFncConfig.fncCallback != NULL)
+        {
+            wdtGetResetStatFncConfig.fncCallback();
+        }
+    }
+
+    return retVal;
+}
+
+NW_LOCAL_INLINE NexaWattHalContextStatusResult NexaWatt_HalWrapperWdt_Handle_Common_Init_Fnc_Exec_Seq(
+        NexaWattHalContextInitFunctionTypes initFncType, NexaWattHalContextFunction *halContextFncConfig)
+{
+    NexaWattHalContextStatusResult retRes = NW_HAL_CONTEXT_BAD_PARAM;
+
+    // Static analysis warning: Condition is always true
+    // Justification: Defensive programming style in case of misuse by the framework user
+    if (initFncType < NW_HAL_INIT_FUNC_INVALID)
+    {
+        retRes = NexaWatt_HalContext_Export_Init_Function(initFncType, halContextFncConfig);
+        if (retRes == NW_HAL_CONTEXT_OK)
+        {
+            // Trigger fault in case the function is not bind
+            NW_ASSERT(halContextFncConfig->fncPtr != NULL);
+
+            if (halContextFncConfig->fncCallout != NULL)
+            {
+                halContextFncConfig->fncCallout();
+            }
+        }
+    }
+
+    return retRes;
+}
+
+NW_LOCAL_INLINE NexaWattHalContextStatusResult NexaWatt_HalWrapperWdt_Handle_Common_Hal_Fnc_Exec_Seq(
+        NexaWattHalContextFunctionTypes halFncType, NexaWattHalContextFunction *halContextFncConfig)
+{
+    NexaWattHalContextStatusResult retRes = NW_HAL_CONTEXT_BAD_PARAM;
+
+    // Static analysis warning: Condition is always true
+    // Justification: Defensive programming style in case of misuse by the framework user
+    if (NW_RUNTIME_CHECK(halFncType < NW_HAL_FUNC_INVALID))
+    {
+        retRes = NexaWatt_HalContext_Export_Function(halFncType, halContextFncConfig);
+        if (retRes == NW_HAL_CONTEXT_OK)
+        {
+            // Trigger fault in case the function is not bind
+            NW_RUNTIME_ASSERT(halContextFncConfig->fncPtr != NULL);
+
+            if (halContextFncConfig->fncCallout != NULL)
+            {
+                halContextFncConfig->fncCallout();
+            }
+        }
+    }
+
+    return retRes;
+}
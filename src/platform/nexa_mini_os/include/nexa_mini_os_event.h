@@ -0,0 +1,101 @@
+/*******************************************************************************
+* File Name:   nexa_mini_os_event.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the deferred events of the NexaWatt-IV.DC framework. An interrupt
+* (e.g. the completion of a DMA transfer) posts an event instead of executing its
+* follow-up work, and the work is executed later by the main loop, outside of the
+* interrupt context. The events are stored in a fixed-size FIFO queue, so they are
+* dispatched in the order of their posting. Events can be posted from any context;
+* the queue indices are updated in a short critical section. The events are
+* dispatched by a single context (the main loop).
+* Typical usage in the main loop:
+* (void)NexaWatt_MiniOs_Event_Dispatch(NW_MINI_OS_EVENT_DISPATCH_ALL);
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_NEXA_MINI_OS_EVENT_H
+#define NEXAWATT_IV_DC_NEXA_MINI_OS_EVENT_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+#include "nexa_mini_os_time.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Number of events the queue can hold. Must be a power of two.
+ */
+#define NW_MINI_OS_EVENT_QUEUE_LEN          (32u)
+
+/**
+ * \brief Event limit of a dispatch, which dispatches all pending events.
+ */
+#define NW_MINI_OS_EVENT_DISPATCH_ALL       (0xFFFFFFFFu)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+/**
+ * \brief Handler of a deferred event, executed by the dispatch. The context and the argument are the ones provided on the posting.
+ */
+typedef void(*NwMiniOsEventHandler)(void* eventContext, uint32 eventArg);
+
+/**
+ * \brief Statistics of the event queue. The dropped events were posted while the queue was full.
+ */
+typedef struct sNexaWattMiniOsEventStats
+{
+    uint32 postedCnt;
+    uint32 droppedCnt;
+    uint32 maxPendingCnt;
+} NexaWattMiniOsEventStats;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Function used to post a deferred event. Can be used from any context.
+ * \param eventHandler - The handler executed by the dispatch.
+ * \param eventContext - The context passed to the handler.
+ * \param eventArg - The argument passed to the handler.
+ * \return NW_MINI_OS_BAD_PARAM - The handler is NULL.
+ * \return NW_MINI_OS_QUEUE_FULL - The queue is full. The event is dropped and counted in the statistics.
+ * \return NW_MINI_OS_SUCCESS - The event is queued.
+ */
+NexaWattMiniOsStatusResult NexaWatt_MiniOs_Event_Post(NwMiniOsEventHandler eventHandler, void* eventContext, uint32 eventArg);
+
+/**
+ * \brief Function used to dispatch the pending events in the order of their posting. Must be called from a single context.
+ * Events posted by the executed handlers are dispatched within the same call, up to the provided limit.
+ * \param maxEventCnt - The maximum number of dispatched events. NW_MINI_OS_EVENT_DISPATCH_ALL dispatches all pending events.
+ * \return The number of dispatched events.
+ */
+uint32 NexaWatt_MiniOs_Event_Dispatch(uint32 maxEventCnt);
+
+/**
+ * \brief Returns the number of events waiting for the dispatch.
+ * \return The number of pending events.
+ */
+uint32 NexaWatt_MiniOs_Event_Get_Pending_Cnt(void);
+
+/**
+ * \brief Function used to obtain the statistics of the event queue.
+ * \param eventStats - A pointer to the structure, where the statistics are copied.
+ */
+void NexaWatt_MiniOs_Event_Get_Stats(NexaWattMiniOsEventStats* eventStats);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+#endif
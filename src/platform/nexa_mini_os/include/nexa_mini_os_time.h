@@ -0,0 +1,116 @@
+/*******************************************************************************
+* File Name:   nexa_mini_os_time.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the monotonic time base of the NexaWatt-IV.DC framework. The time base
+* extends a free-running 32-bit hardware timer to 64 bits by counting its overflows.
+* It is shared by the scheduling, logging, profiling and diagnostic components.
+* The time can be read from thread and interrupt context without locks: the overflow
+* count is read before and after the counter and the read is repeated if the overflow ISR
+* was executed in between. An overflow, which is pending because the reader masks the
+* interrupts or has a higher priority, is detected from the overflow status of the timer.
+* The overflow ISR is registered with the highest interrupt priority, so no reader can
+* observe it half-executed.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_NEXA_MINI_OS_TIME_H
+#define NEXAWATT_IV_DC_NEXA_MINI_OS_TIME_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Period of the underlying hardware timer. The full 32-bit range is used,
+ * so the overflow count forms the upper word of the time.
+ */
+#define NW_MINI_OS_TIME_PERIOD_TICKS        (0xFFFFFFFFu)
+
+/**
+ * \brief Interrupt priority of the overflow ISR (the highest one).
+ */
+#define NW_MINI_OS_TIME_INTR_PRIORITY       (0u)
+
+/**
+ * \brief Number of microseconds in a second and in a millisecond.
+ */
+#define NW_MINI_OS_TIME_US_PER_S            (1000000u)
+#define NW_MINI_OS_TIME_US_PER_MS           (1000u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+typedef enum eNexaWattMiniOsStatusResult
+{
+    NW_MINI_OS_SUCCESS      = 0u,
+    NW_MINI_OS_BAD_PARAM    = 1u,
+    NW_MINI_OS_FATAL_ERR    = 2u,
+    NW_MINI_OS_QUEUE_FULL   = 3u,
+} NexaWattMiniOsStatusResult;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Function used to initialize and start the time base on a hardware timer. The time starts at 0.
+ * \param timer - The number of the hardware timer, used by the time base. Must provide a 32-bit counter.
+ * \param frequencyHz - The counting frequency of the hardware timer.
+ * \return NW_MINI_OS_BAD_PARAM - The frequency is 0.
+ * \return NW_MINI_OS_FATAL_ERR - The initialization or the start of the hardware timer failed.
+ * \return NW_MINI_OS_SUCCESS - The time base is running.
+ */
+NexaWattMiniOsStatusResult NexaWatt_MiniOs_Time_Init(uint8 timer, uint32 frequencyHz);
+
+/**
+ * \brief Reads the monotonic time. Can be used from any context, without locks.
+ * \return The time since the initialization of the time base in timer ticks.
+ */
+uint64 NexaWatt_MiniOs_Time_Get_Ticks(void);
+
+/**
+ * \brief Reads the monotonic time in microseconds. Can be used from any context, without locks.
+ * \return The time since the initialization of the time base in microseconds.
+ */
+uint64 NexaWatt_MiniOs_Time_Get_Us(void);
+
+/**
+ * \brief Converts a duration in timer ticks to microseconds, without overflow of the intermediate result.
+ * \param ticks - The duration in timer ticks.
+ * \return The duration in microseconds, rounded down.
+ */
+uint64 NexaWatt_MiniOs_Time_Ticks_To_Us(uint64 ticks);
+
+/**
+ * \brief Returns the counting frequency of the time base.
+ * \return The frequency in Hz. 0 if the time base is not initialized.
+ */
+uint32 NexaWatt_MiniOs_Time_Get_Frequency(void);
+
+/**
+ * \brief Busy-waits for the provided duration. Replaces the blocking delays of the board support package.
+ * \param delayUs - The duration in microseconds.
+ */
+void NexaWatt_MiniOs_Time_Delay_Us(uint32 delayUs);
+
+/**
+ * \brief Busy-waits for the provided duration.
+ * \param delayMs - The duration in milliseconds.
+ */
+void NexaWatt_MiniOs_Time_Delay_Ms(uint32 delayMs);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+#endif
@@ -0,0 +1,137 @@
+/*******************************************************************************
+* File Name:   nexa_mini_os_event.c
+*
+* Description: This is the source file containing definitions,
+* related to the deferred events of the NexaWatt-IV.DC framework.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "nexa_mini_os_event.h"
+#include "platform_critical_section.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Macro returning the queue slot corresponding to a free-running queue index.
+ */
+#define NW_MINI_OS_EVENT_SLOT(queueIdx) \
+    ((queueIdx) & (NW_MINI_OS_EVENT_QUEUE_LEN - 1u))
+
+NW_STATIC_ASSERT((NW_MINI_OS_EVENT_QUEUE_LEN & (NW_MINI_OS_EVENT_QUEUE_LEN - 1u)) == 0u, event_queue_len_power_of_two);
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+typedef struct sNexaWattMiniOsEvent
+{
+    NwMiniOsEventHandler eventHandler;
+    void* eventContext;
+    uint32 eventArg;
+} NexaWattMiniOsEvent;
+
+/**
+ * \brief State of the event queue. The indices are free-running; their difference is the number of pending events.
+ */
+typedef struct sNexaWattMiniOsEventQueue
+{
+    NexaWattMiniOsEvent events[NW_MINI_OS_EVENT_QUEUE_LEN];
+    volatile uint32 headIdx;
+    volatile uint32 tailIdx;
+    NexaWattMiniOsEventStats stats;
+} NexaWattMiniOsEventQueue;
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+static NexaWattMiniOsEventQueue eventQueue;
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattMiniOsStatusResult NexaWatt_MiniOs_Event_Post(const NwMiniOsEventHandler eventHandler, void* const eventContext, const uint32 eventArg)
+{
+    NexaWattMiniOsStatusResult retRes = NW_MINI_OS_BAD_PARAM;
+    NwCriticalSectionState criticalSectionState = 0u;
+    NexaWattMiniOsEvent* event = NULL;
+    uint32 pendingCnt = 0u;
+
+    if (eventHandler != NULL)
+    {
+        criticalSectionState = NexaWatt_Platform_Critical_Section_Enter();
+
+        pendingCnt = eventQueue.headIdx - eventQueue.tailIdx;
+        if (pendingCnt < NW_MINI_OS_EVENT_QUEUE_LEN)
+        {
+            event = &eventQueue.events[NW_MINI_OS_EVENT_SLOT(eventQueue.headIdx)];
+            event->eventHandler = eventHandler;
+            event->eventContext = eventContext;
+            event->eventArg = eventArg;
+            eventQueue.headIdx++;
+
+            pendingCnt++;
+            eventQueue.stats.postedCnt++;
+            eventQueue.stats.maxPendingCnt = (pendingCnt > eventQueue.stats.maxPendingCnt) ? pendingCnt : eventQueue.stats.maxPendingCnt;
+
+            retRes = NW_MINI_OS_SUCCESS;
+        }
+        else
+        {
+            eventQueue.stats.droppedCnt++;
+
+            retRes = NW_MINI_OS_QUEUE_FULL;
+        }
+
+        NexaWatt_Platform_Critical_Section_Exit(criticalSectionState);
+    }
+
+    return retRes;
+}
+
+uint32 NexaWatt_MiniOs_Event_Dispatch(const uint32 maxEventCnt)
+{
+    uint32 dispatchedCnt = 0u;
+    NwCriticalSectionState criticalSectionState = 0u;
+    NexaWattMiniOsEvent event;
+
+    while ((dispatchedCnt < maxEventCnt) &&
+           (eventQueue.tailIdx != eventQueue.headIdx))
+    {
+        // The event is copied out, so its slot can be reused by a posting from the handler
+        criticalSectionState = NexaWatt_Platform_Critical_Section_Enter();
+        event = eventQueue.events[NW_MINI_OS_EVENT_SLOT(eventQueue.tailIdx)];
+        eventQueue.tailIdx++;
+        NexaWatt_Platform_Critical_Section_Exit(criticalSectionState);
+
+        event.eventHandler(event.eventContext, event.eventArg);
+        dispatchedCnt++;
+    }
+
+    return dispatchedCnt;
+}
+
+uint32 NexaWatt_MiniOs_Event_Get_Pending_Cnt(void)
+{
+    return eventQueue.headIdx - eventQueue.tailIdx;
+}
+
+void NexaWatt_MiniOs_Event_Get_Stats(NexaWattMiniOsEventStats* const eventStats)
+{
+    NwCriticalSectionState criticalSectionState = 0u;
+
+    if (eventStats != NULL)
+    {
+        criticalSectionState = NexaWatt_Platform_Critical_Section_Enter();
+        *eventStats = eventQueue.stats;
+        NexaWatt_Platform_Critical_Section_Exit(criticalSectionState);
+    }
+}
@@ -0,0 +1,173 @@
+/*******************************************************************************
+* File Name:   nexa_mini_os_time.c
+*
+* Description: This is the source file containing definitions,
+* related to the monotonic time base of the NexaWatt-IV.DC framework.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "nexa_mini_os_time.h"
+#include "hal_wrapper_timer.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Number of bits of the hardware timer counter (the lower word of the time).
+ */
+#define NW_MINI_OS_TIME_COUNTER_BITS        (32u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+/**
+ * \brief State of the time base. The overflow count is the only member written after the initialization.
+ */
+typedef struct sNexaWattMiniOsTimeBase
+{
+    uint8 timer;
+    uint32 frequencyHz;
+    uint32 ticksPerUs;
+    volatile uint32 overflowCnt;
+} NexaWattMiniOsTimeBase;
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+static NexaWattMiniOsTimeBase timeBase;
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Overflow ISR of the hardware timer. Accounts one wrap around of the counter.
+ */
+static void NexaWatt_MiniOs_Time_Overflow_Isr(void);
+
+/**
+ * \brief Simple helper function that busy-waits for the provided duration.
+ * \param delayUs - The duration in microseconds.
+ */
+static void NexaWatt_MiniOs_Time_Busy_Wait_Us(uint64 delayUs);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattMiniOsStatusResult NexaWatt_MiniOs_Time_Init(const uint8 timer, const uint32 frequencyHz)
+{
+    NexaWattMiniOsStatusResult retRes = NW_MINI_OS_BAD_PARAM;
+    NexaWattTimerStatusResult timerRes = NW_TIMER_BAD_PARAM;
+    const NexaWattTimerConfig timerConfig =
+    {
+        .frequencyHz = frequencyHz,
+        .periodTicks = NW_MINI_OS_TIME_PERIOD_TICKS,
+        .intrPriority = NW_MINI_OS_TIME_INTR_PRIORITY,
+        .overflowIsrPtr = NexaWatt_MiniOs_Time_Overflow_Isr,
+    };
+
+    if (frequencyHz > 0u)
+    {
+        timeBase.timer = timer;
+        timeBase.frequencyHz = frequencyHz;
+        // Frequencies in whole megahertz allow the conversion to microseconds with a single division
+        timeBase.ticksPerUs = ((frequencyHz % NW_MINI_OS_TIME_US_PER_S) == 0u) ? (frequencyHz / NW_MINI_OS_TIME_US_PER_S) : 0u;
+        timeBase.overflowCnt = 0u;
+
+        timerRes = NexaWatt_HalWrapperTimer_Init(timer, &timerConfig);
+        if (timerRes == NW_TIMER_SUCCESS)
+        {
+            timerRes = NexaWatt_HalWrapperTimer_Start(timer);
+        }
+
+        retRes = (timerRes == NW_TIMER_SUCCESS) ? NW_MINI_OS_SUCCESS : NW_MINI_OS_FATAL_ERR;
+    }
+
+    return retRes;
+}
+
+uint64 NexaWatt_MiniOs_Time_Get_Ticks(void)
+{
+    uint32 overflowCntBefore = 0u;
+    uint32 overflowCntAfter = 0u;
+    uint32 upperWord = 0u;
+    NwTimerTicks lowerWord = 0u;
+    nw_bool overflowPending = nwFalse;
+
+    do
+    {
+        overflowCntBefore = timeBase.overflowCnt;
+        lowerWord = NexaWatt_HalWrapperTimer_Read_Counter(timeBase.timer);
+        overflowPending = NexaWatt_HalWrapperTimer_Get_Overflow_Status(timeBase.timer);
+        upperWord = overflowCntBefore;
+
+        if (overflowPending == nwTrue)
+        {
+            // The wrap is not accounted by the ISR yet; the counter is read again, so it is taken after the wrap
+            lowerWord = NexaWatt_HalWrapperTimer_Read_Counter(timeBase.timer);
+            upperWord++;
+        }
+
+        overflowCntAfter = timeBase.overflowCnt;
+    } while (overflowCntBefore != overflowCntAfter);
+
+    return (((uint64)upperWord) << NW_MINI_OS_TIME_COUNTER_BITS) | (uint64)lowerWord;
+}
+
+uint64 NexaWatt_MiniOs_Time_Get_Us(void)
+{
+    return NexaWatt_MiniOs_Time_Ticks_To_Us(NexaWatt_MiniOs_Time_Get_Ticks());
+}
+
+uint64 NexaWatt_MiniOs_Time_Ticks_To_Us(const uint64 ticks)
+{
+    uint64 retVal = 0u;
+
+    if (timeBase.ticksPerUs > 0u)
+    {
+        retVal = ticks / timeBase.ticksPerUs;
+    }
+    else if (timeBase.frequencyHz > 0u)
+    {
+        // Whole seconds and the remainder are converted separately, so the product cannot overflow
+        retVal = ((ticks / timeBase.frequencyHz) * NW_MINI_OS_TIME_US_PER_S) +
+                 (((ticks % timeBase.frequencyHz) * NW_MINI_OS_TIME_US_PER_S) / timeBase.frequencyHz);
+    }
+
+    return retVal;
+}
+
+uint32 NexaWatt_MiniOs_Time_Get_Frequency(void)
+{
+    return timeBase.frequencyHz;
+}
+
+void NexaWatt_MiniOs_Time_Delay_Us(const uint32 delayUs)
+{
+    NexaWatt_MiniOs_Time_Busy_Wait_Us((uint64)delayUs);
+}
+
+void NexaWatt_MiniOs_Time_Delay_Ms(const uint32 delayMs)
+{
+    NexaWatt_MiniOs_Time_Busy_Wait_Us((uint64)delayMs * NW_MINI_OS_TIME_US_PER_MS);
+}
+
+static void NexaWatt_MiniOs_Time_Overflow_Isr(void)
+{
+    NexaWatt_HalWrapperTimer_Clear_Overflow_Status(timeBase.timer);
+    timeBase.overflowCnt++;
+}
+
+static void NexaWatt_MiniOs_Time_Busy_Wait_Us(const uint64 delayUs)
+{
+    const uint64 startUs = NexaWatt_MiniOs_Time_Get_Us();
+
+    while ((NexaWatt_MiniOs_Time_Get_Us() - startUs) < delayUs)
+    {
+        // The time base is polled until the delay elapses
+    }
+}
@@ -0,0 +1,89 @@
+/*******************************************************************************
+* File Name:   platform_critical_section.h
+*
+* Description: This is the header file containing declarations and definitions
+* of the critical sections of the framework. A critical section masks all
+* configurable interrupts and restores the previous mask on exit, so the sections
+* can be nested and used from both thread and interrupt context. The sections are
+* intended for a few instructions (e.g. the update of a queue index).
+* Lock-free single-producer single-consumer queues use the compiler barrier instead,
+* which orders the writes of the data before the write of the publishing index; a
+* single core observes its own memory accesses in program order.
+* On Armv8-M targets PRIMASK is used, so no device header is required. The host
+* simulation is single-threaded, so the sections are empty on the host.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_PLATFORM_CRITICAL_SECTION_H
+#define NEXAWATT_IV_DC_PLATFORM_CRITICAL_SECTION_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+/**
+ * \brief Interrupt mask saved on the entry of a critical section.
+ */
+typedef uint32 NwCriticalSectionState;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/**
+ * \brief Enters a critical section by masking the configurable interrupts.
+ * \return The interrupt mask before the entry, to be passed to NexaWatt_Platform_Critical_Section_Exit().
+ */
+NW_LOCAL_INLINE NwCriticalSectionState NexaWatt_Platform_Critical_Section_Enter(void)
+{
+    NwCriticalSectionState state = 0u;
+
+#if defined(__ARM_ARCH)
+    __asm volatile ("mrs %0, primask" : "=r" (state) :: "memory");
+    __asm volatile ("cpsid i" ::: "memory");
+#endif
+
+    return state;
+}
+
+/**
+ * \brief Leaves a critical section by restoring the interrupt mask saved on its entry.
+ * \param state - The interrupt mask returned by NexaWatt_Platform_Critical_Section_Enter().
+ */
+NW_LOCAL_INLINE void NexaWatt_Platform_Critical_Section_Exit(const NwCriticalSectionState state)
+{
+#if defined(__ARM_ARCH)
+    __asm volatile ("msr primask, %0" :: "r" (state) : "memory");
+#else
+    (void)state;
+#endif
+}
+
+/**
+ * \brief Prevents the compiler from moving memory accesses across the barrier.
+ */
+NW_LOCAL_INLINE void NexaWatt_Platform_Compiler_Barrier(void)
+{
+#if defined(__GNUC__)
+    __asm volatile ("" ::: "memory");
+#endif
+}
+
+#endif
@@ -0,0 +1,85 @@
+/*******************************************************************************
+* File Name:   platform_cycle_counter.h
+*
+* Description: This is the header file containing declarations and definitions
+* of the free-running CPU cycle counter, used for the execution time measurements
+* of the framework. On Armv8-M targets the DWT cycle counter is used; its registers
+* are architecturally defined, so no device header is required. On x86 hosts the time
+* stamp counter is used, so the host simulation reports the same quantities.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_PLATFORM_CYCLE_COUNTER_H
+#define NEXAWATT_IV_DC_PLATFORM_CYCLE_COUNTER_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Debug Exception and Monitor Control Register and its trace enable bit.
+ */
+#define NW_PLATFORM_DEMCR_REG           (*(volatile uint32*)0xE000EDFCu)
+#define NW_PLATFORM_DEMCR_TRCENA_MSK    (0x01000000u)
+
+/**
+ * \brief DWT control and cycle count registers and the cycle counter enable bit.
+ */
+#define NW_PLATFORM_DWT_CTRL_REG        (*(volatile uint32*)0xE0001000u)
+#define NW_PLATFORM_DWT_CYCCNT_REG      (*(volatile uint32*)0xE0001004u)
+#define NW_PLATFORM_DWT_CYCCNTENA_MSK   (0x00000001u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/**
+ * \brief Enables the cycle counter. Called once at the startup (see main.c), before the first measurement.
+ * The counter is shared by all modules as a common time base (e.g. the time stamps of the logger),
+ * so it is never reset; a repeated call leaves the running counter untouched.
+ */
+NW_LOCAL_INLINE void NexaWatt_Platform_Cycle_Counter_Init(void)
+{
+#if defined(__ARM_ARCH)
+    if ((NW_PLATFORM_DWT_CTRL_REG & NW_PLATFORM_DWT_CYCCNTENA_MSK) == 0u)
+    {
+        NW_PLATFORM_DEMCR_REG |= NW_PLATFORM_DEMCR_TRCENA_MSK;
+        NW_PLATFORM_DWT_CTRL_REG |= NW_PLATFORM_DWT_CYCCNTENA_MSK;
+    }
+#endif
+}
+
+/**
+ * \brief Reads the cycle counter. The counter wraps around, so durations must be computed
+ * as unsigned differences of two readings.
+ * \return The current value of the cycle counter. 0 on unsupported hosts.
+ */
+NW_LOCAL_INLINE uint32 NexaWatt_Platform_Cycle_Counter_Get(void)
+{
+#if defined(__ARM_ARCH)
+    return NW_PLATFORM_DWT_CYCCNT_REG;
+#elif defined(__x86_64__) || defined(__i386__)
+    return (uint32)__builtin_ia32_rdtsc();
+#else
+    return 0u;
+#endif
+}
+
+#endif
@@ -0,0 +1,168 @@
+/*******************************************************************************
+* File Name:   platform_fixed_point.h
+*
+* Description: This is the header file containing declarations and definitions
+* of the fixed point types and arithmetic helpers that will be reused among
+* the entire framework. The control path of the framework is executed in fixed
+* point, as the framework is built with software floating point support.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_PLATFORM_FIXED_POINT_H
+#define NEXAWATT_IV_DC_PLATFORM_FIXED_POINT_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "platform_types.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Number of fractional bits of the Q15 signal format.
+ */
+#define NW_Q15_FRAC_BITS        (15u)
+
+/**
+ * \brief Number of fractional bits of the Q16.16 coefficient format.
+ */
+#define NW_Q16_FRAC_BITS        (16u)
+
+/**
+ * \brief Representation of 1.0 in the Q15 signal format.
+ * The signals are stored in 32-bit containers, hence 1.0 is representable.
+ */
+#define NW_Q15_ONE              ((NwQ15)32768)
+
+/**
+ * \brief Representation of 1.0 in the Q16.16 coefficient format.
+ */
+#define NW_Q16_ONE              ((NwQ16)65536)
+
+/**
+ * \brief Saturation limits of the Q15 signal format, used by the control path.
+ */
+#define NW_Q15_MAX              ((NwQ15)32767)
+#define NW_Q15_MIN              ((NwQ15)-32768)
+
+/**
+ * \brief Compile-time conversion of a floating point constant to the Q15 signal format.
+ * Must be used only with constant expressions, so no floating point code is generated.
+ */
+#define NW_Q15_CONST(val)       ((NwQ15)((val) * 32768.0))
+
+/**
+ * \brief Compile-time conversion of a floating point constant to the Q16.16 coefficient format.
+ * Must be used only with constant expressions, so no floating point code is generated.
+ */
+#define NW_Q16_CONST(val)       ((NwQ16)((val) * 65536.0))
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+/**
+ * \brief Normalized signal in Q15 format, stored in a 32-bit container to provide headroom.
+ */
+typedef int32 NwQ15;
+
+/**
+ * \brief Coefficient or gain in Q16.16 format.
+ */
+typedef int32 NwQ16;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/**
+ * \brief Multiplies a Q15 signal by a Q16.16 coefficient. The result is in Q15 format.
+ * \param signal - The Q15 signal.
+ * \param coefficient - The Q16.16 coefficient.
+ * \return The Q15 product. The result is not saturated.
+ */
+NW_LOCAL_INLINE NwQ15 NexaWatt_FixedPoint_Mul_Q16(const NwQ15 signal, const NwQ16 coefficient)
+{
+    return (NwQ15)(((int64)signal * (int64)coefficient) >> NW_Q16_FRAC_BITS);
+}
+
+/**
+ * \brief Multiplies two Q15 signals. The result is in Q15 format.
+ * \param lhs - The first Q15 signal.
+ * \param rhs - The second Q15 signal.
+ * \return The Q15 product. The result is not saturated.
+ */
+NW_LOCAL_INLINE NwQ15 NexaWatt_FixedPoint_Mul_Q15(const NwQ15 lhs, const NwQ15 rhs)
+{
+    return (NwQ15)(((int64)lhs * (int64)rhs) >> NW_Q15_FRAC_BITS);
+}
+
+/**
+ * \brief Clamps a value to the provided inclusive range.
+ * The compiler translates the function to conditional selects without branches on Armv8-M.
+ * \param value - The value to be clamped.
+ * \param minVal - The lower limit of the range.
+ * \param maxVal - The upper limit of the range.
+ * \return The clamped value.
+ */
+NW_LOCAL_INLINE int32 NexaWatt_FixedPoint_Saturate(const int32 value, const int32 minVal, const int32 maxVal)
+{
+    int32 retVal = (value > maxVal) ? maxVal : value;
+    retVal = (retVal < minVal) ? minVal : retVal;
+
+    return retVal;
+}
+
+/**
+ * \brief Clamps a 64-bit intermediate value to the 32-bit signed range.
+ * \param value - The 64-bit value to be clamped.
+ * \return The clamped 32-bit value.
+ */
+NW_LOCAL_INLINE int32 NexaWatt_FixedPoint_Saturate_I64(const int64 value)
+{
+    int64 retVal = (value > (int64)INT32_MAX) ? (int64)INT32_MAX : value;
+    retVal = (retVal < (int64)INT32_MIN) ? (int64)INT32_MIN : retVal;
+
+    return (int32)retVal;
+}
+
+/**
+ * \brief Integer square root of a 64-bit unsigned value, using the bit-by-bit method.
+ * The execution time is constant (32 iterations), which makes the function usable in ISR context.
+ * \param value - The value whose square root will be calculated.
+ * \return The floor of the square root of the provided value.
+ */
+NW_LOCAL_INLINE uint32 NexaWatt_FixedPoint_Sqrt_U64(const uint64 value)
+{
+    uint64 remainder = value;
+    uint64 root = 0u;
+    uint64 bitPos = ((uint64)1u) << 62u;
+    uint8 iterIdx = 0u;
+
+    for (iterIdx = 0u; iterIdx < 32u; iterIdx++)
+    {
+        if (remainder >= (root + bitPos))
+        {
+            remainder -= (root + bitPos);
+            root = (root >> 1u) + bitPos;
+        }
+        else
+        {
+            root >>= 1u;
+        }
+        bitPos >>= 2u;
+    }
+
+    return (uint32)root;
+}
+
+#endif
@@ -27,6 +27,30 @@
 #define NW_ASSERT(expr)     assert(expr)
 #define NW_DUMMY()          asm("nop")
 
+/**
+ * \brief Compile-time assertion. The message must be a valid identifier, unique within the translation unit.
+ */
+#define NW_STATIC_ASSERT(expr, msg) \
+    typedef char nw_static_assert_##msg[(expr) ? 1 : -1]
+
+/**
+ * \brief Runtime parameter validation of the HAL Wrappers and the HAL implementations.
+ * The validation is performed on every call of the runtime (non-init) functions by default.
+ * When the project is built with NW_RELEASE_FAST defined (RELEASE_FAST=1 in the application Makefile,
+ * typically together with CONFIG=Release), the checks are replaced by constants and the
+ * compiler removes them together with their error paths. The validation of the init functions is kept
+ * in both modes, so a misconfiguration is still reported at startup.
+ * The checked expressions must not have side effects. They are kept as unevaluated sizeof operands,
+ * so the parameters used only by the checks do not produce warnings.
+ */
+#ifdef NW_RELEASE_FAST
+#define NW_RUNTIME_CHECK(expr)      ((void)sizeof(expr), nwTrue)
+#define NW_RUNTIME_ASSERT(expr)     ((void)sizeof(expr))
+#else
+#define NW_RUNTIME_CHECK(expr)      (expr)
+#define NW_RUNTIME_ASSERT(expr)     NW_ASSERT(expr)
+#endif
+
 #define nwFalse             (0u != 0u)
 #define nwTrue              (0u == 0u)
 
@@ -49,8 +73,14 @@ typedef nw_bool NwGpioExtiStatus;
 typedef uint32 NwInterruptMask;
 typedef uint32 NwInterruptPriority;
 typedef uint32 NwGenericReturnType;
+typedef uint32 NwPwmTicks;
+typedef uint32 NwPwmChannelMask;
+typedef uint16 NwAdcSample;
+typedef uint32 NwTimerTicks;
+typedef uint16 NwSerialLength;
 
 typedef void(*NwIsrPointerType)(void);
+typedef void(*NwAdcHalFrameHandler)(uint8 bufferIdx, uint32 latencyTicks);
 
 typedef enum eNexaWattGPIOPinDirection
 {
@@ -97,6 +127,7 @@ typedef enum eNexaWattGPIOStatusResult
     NW_GPIO_SUCCESS     = 0u,
     NW_GPIO_BAD_PARAM   = 1u,
     NW_GPIO_FATAL_ERR   = 2u,
+    NW_GPIO_RESOURCE_CONFLICT = 3u,
 } NexaWattGPIOStatusResult;
 
 typedef enum eNexaWattGPIOInterruptEdgeEXTI
@@ -114,11 +145,144 @@ typedef struct sNexaWattGPIOExtIRQConfig
     NwIsrPointerType isrHandlerPtr;
 } NexaWattGPIOExtIRQConfig;
 
+typedef enum eNexaWattPWMAlignment
+{
+    NW_PWM_ALIGN_LEFT   = 0x00u,
+    NW_PWM_ALIGN_CENTER = 0x01u,
+} NexaWattPWMAlignment;
+
+typedef struct sNexaWattPWMChannelConfig
+{
+    NwPwmTicks periodTicks;
+    NexaWattPWMAlignment alignment;
+    NwPwmTicks deadTimeRiseTicks;
+    NwPwmTicks deadTimeFallTicks;
+    nw_bool complementaryOutput;
+    nw_bool invertOutput;
+} NexaWattPWMChannelConfig;
+
+typedef enum eNexaWattPWMStatusResult
+{
+    NW_PWM_SUCCESS      = 0u,
+    NW_PWM_BAD_PARAM    = 1u,
+    NW_PWM_FATAL_ERR    = 2u,
+} NexaWattPWMStatusResult;
+
+typedef enum eNexaWattADCTriggerSource
+{
+    NW_ADC_TRIGGER_SOFTWARE = 0x00u,
+    NW_ADC_TRIGGER_PWM      = 0x01u,
+} NexaWattADCTriggerSource;
+
+typedef struct sNexaWattADCSequenceConfig
+{
+    const uint8* channelList;
+    uint8 channelCnt;
+    NexaWattADCTriggerSource triggerSource;
+    uint8 triggerPwmChannel;
+    NwInterruptPriority intrPriority;
+} NexaWattADCSequenceConfig;
+
+typedef enum eNexaWattADCStatusResult
+{
+    NW_ADC_SUCCESS      = 0u,
+    NW_ADC_BAD_PARAM    = 1u,
+    NW_ADC_FATAL_ERR    = 2u,
+} NexaWattADCStatusResult;
+
+typedef struct sNexaWattTimerConfig
+{
+    uint32 frequencyHz;
+    NwTimerTicks periodTicks;
+    NwInterruptPriority intrPriority;
+    NwIsrPointerType overflowIsrPtr;
+} NexaWattTimerConfig;
+
+typedef enum eNexaWattTimerStatusResult
+{
+    NW_TIMER_SUCCESS    = 0u,
+    NW_TIMER_BAD_PARAM  = 1u,
+    NW_TIMER_FATAL_ERR  = 2u,
+} NexaWattTimerStatusResult;
+
+typedef enum eNexaWattSerialBusType
+{
+    NW_SERIAL_BUS_SPI   = 0x00u,
+    NW_SERIAL_BUS_I2C   = 0x01u,
+} NexaWattSerialBusType;
+
+typedef enum eNexaWattSerialSpiMode
+{
+    NW_SERIAL_SPI_MODE_0    = 0x00u,
+    NW_SERIAL_SPI_MODE_1    = 0x01u,
+    NW_SERIAL_SPI_MODE_2    = 0x02u,
+    NW_SERIAL_SPI_MODE_3    = 0x03u,
+} NexaWattSerialSpiMode;
+
+typedef struct sNexaWattSerialBusConfig
+{
+    NexaWattSerialBusType busType;
+    uint32 bitRateHz;
+    NexaWattSerialSpiMode spiMode;
+    NwInterruptPriority intrPriority;
+} NexaWattSerialBusConfig;
+
+/**
+ * \brief Single transfer on a serial bus. The address selects the slave select line (SPI) or the 7-bit slave address (I2C).
+ * SPI: a full-duplex frame of max(txLen, rxLen) bytes; the bytes after txLen are sent as dummy bytes and the bytes after rxLen are discarded.
+ * I2C: txLen bytes are written, followed by a repeated start and the read of rxLen bytes. Either part can be empty.
+ */
+typedef struct sNexaWattSerialTransfer
+{
+    uint8 address;
+    const uint8* txData;
+    NwSerialLength txLen;
+    uint8* rxData;
+    NwSerialLength rxLen;
+} NexaWattSerialTransfer;
+
+typedef enum eNexaWattSerialStatusResult
+{
+    NW_SERIAL_SUCCESS   = 0u,
+    NW_SERIAL_BAD_PARAM = 1u,
+    NW_SERIAL_FATAL_ERR = 2u,
+    NW_SERIAL_BUSY      = 3u,
+    NW_SERIAL_BUS_ERR   = 4u,
+    NW_SERIAL_ABORTED   = 5u,
+} NexaWattSerialStatusResult;
+
+typedef void(*NwSerialHalTransferHandler)(uint8 bus, NexaWattSerialStatusResult transferStatus);
+
+/**
+ * \brief Configuration of the hardware watchdog. The device is reset, when the watchdog is not kicked within the timeout.
+ */
+typedef struct sNexaWattWdtConfig
+{
+    uint32 timeoutUs;
+} NexaWattWdtConfig;
+
+typedef enum eNexaWattWdtStatusResult
+{
+    NW_WDT_SUCCESS      = 0u,
+    NW_WDT_BAD_PARAM    = 1u,
+    NW_WDT_FATAL_ERR    = 2u,
+} NexaWattWdtStatusResult;
+
 typedef enum eNexaWattHalContextInitFunctionTypes
 {
     NW_HAL_BSP_INIT                     = 0u,
     NW_HAL_GPIO_DIGITAL_IO_PIN_INIT     = 1u,
     NW_HAL_GPIO_DIGITAL_IO_PIN_DEINIT   = 2u,
+    NW_HAL_PWM_CHANNEL_INIT             = 3u,
+    NW_HAL_PWM_CHANNEL_DEINIT           = 4u,
+    NW_HAL_ADC_SEQUENCE_INIT            = 5u,
+    NW_HAL_ADC_SEQUENCE_DEINIT          = 6u,
+    NW_HAL_TIMER_INIT                   = 7u,
+    NW_HAL_TIMER_DEINIT                 = 8u,
+    NW_HAL_GPIO_PORT_INIT               = 9u,
+    NW_HAL_SERIAL_BUS_INIT              = 10u,
+    NW_HAL_SERIAL_BUS_DEINIT            = 11u,
+    NW_HAL_WDT_INIT                     = 12u,
     NW_HAL_INIT_FUNC_INVALID            = 32u,
 } NexaWattHalContextInitFunctionTypes;
 
@@ -133,6 +297,26 @@ typedef enum eNexaWattHalContextFunctionTypes
     NW_HAL_GPIO_GET_EXTI_STAT   = 6u,
     NW_HAL_GPIO_CLEAR_EXTI_STAT = 7u,
     NW_HAL_GPIO_TRIGGER_SW_INTR = 8u,
+    NW_HAL_PWM_SET_PERIOD       = 9u,
+    NW_HAL_PWM_SET_PHASE        = 10u,
+    NW_HAL_PWM_SET_DEAD_TIME    = 11u,
+    NW_HAL_PWM_START            = 12u,
+    NW_HAL_PWM_STOP             = 13u,
+    NW_HAL_PWM_COMMIT           = 14u,
+    NW_HAL_ADC_START            = 15u,
+    NW_HAL_ADC_STOP             = 16u,
+    NW_HAL_ADC_SW_TRIGGER       = 17u,
+    NW_HAL_TIMER_START          = 18u,
+    NW_HAL_TIMER_STOP           = 19u,
+    NW_HAL_TIMER_READ_COUNTER   = 20u,
+    NW_HAL_TIMER_GET_OVF_STAT   = 21u,
+    NW_HAL_TIMER_CLEAR_OVF_STAT = 22u,
+    NW_HAL_SERIAL_START_XFER    = 23u,
+    NW_HAL_SERIAL_ABORT         = 24u,
+    NW_HAL_GPIO_PORT_READ       = 25u,
+    NW_HAL_GPIO_PORT_WRITE      = 26u,
+    NW_HAL_WDT_KICK             = 27u,
+    NW_HAL_WDT_GET_RESET_STAT   = 28u,
     NW_HAL_FUNC_INVALID         = 255u,
 } NexaWattHalContextFunctionTypes;
 
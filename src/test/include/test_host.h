@@ -0,0 +1,70 @@
+/*******************************************************************************
+* File Name:   test_host.h
+*
+* Description: This is the header file containing declarations and definitions,
+* related to the host tests of the NexaWatt-IV.DC framework.
+* The tests are intended for the host and are excluded from the target build (see .cyignore).
+* Every test is a separate executable, built by the Makefile of the test directory from
+* the test source, the framework sources under test and this support module.
+* An expectation, which does not hold, is reported with its source location and the test
+* continues, so a single run reports all failed expectations. The main function of a test
+* returns NexaWatt_Test_Result(), so the Makefile stops on the first failed test.
+* Typical usage:
+* NW_TEST_EXPECT(NexaWatt_SafetyChecker_Init(&checker, &safetyConfig) == NW_SAFETY_SUCCESS);
+* return NexaWatt_Test_Result("safety_checker");
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+#ifndef NEXAWATT_IV_DC_TEST_HOST_H
+#define NEXAWATT_IV_DC_TEST_HOST_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include "platform_types.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Checks an expectation of a test.
+ */
+#define NW_TEST_EXPECT(expr) \
+    NexaWatt_Test_Expect(((expr) ? nwTrue : nwFalse), #expr, __FILE__, __LINE__)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Function used to record the outcome of an expectation. Used through NW_TEST_EXPECT().
+ * \param isMet - nwTrue, if the expectation holds.
+ * \param expression - The text of the expectation.
+ * \param file - The source file of the expectation.
+ * \param line - The source line of the expectation.
+ */
+void NexaWatt_Test_Expect(nw_bool isMet, const char* expression, const char* file, int line);
+
+/**
+ * \brief Function used to print the summary of a test.
+ * \param testName - The name of the test.
+ * \return 0 - All expectations hold.
+ * \return 1 - At least one expectation failed.
+ */
+int NexaWatt_Test_Result(const char* testName);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+#endif
@@ -0,0 +1,288 @@
+/*******************************************************************************
+* File Name:   test_autotune.c
+*
+* Description: This is the source file containing the host test,
+* related to the relay-feedback automatic loop tuning of the NexaWatt-IV.DC framework.
+* The relay experiment runs against a simulated plant of two first-order lags and a
+* transport delay. The measured ultimate gain and period are compared with the critical
+* point of the plant (including the feedback filter of the experiment), calculated
+* from its frequency response. The tuned gains are checked in closed loop.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <math.h>
+#include "test_host.h"
+#include "digital_controller_autotune.h"
+#include "digital_controller_npnz.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define NW_TEST_PI                          (3.14159265358979323846)
+
+/**
+ * \brief Simulated plant: a delay of NW_TEST_PLANT_DELAY samples followed by two first-order lags
+ * x[n+1] = x[n] + k * (u - x[n]) with the coefficients 0.05 and 0.1 (poles 0.95 and 0.9).
+ */
+#define NW_TEST_PLANT_DELAY                 (3u)
+#define NW_TEST_PLANT_K1                    (0.05)
+#define NW_TEST_PLANT_K2                    (0.1)
+#define NW_TEST_FILTER_ALPHA                (0.5)
+
+#define NW_TEST_MAX_SAMPLES                 (100000u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+typedef struct sNexaWattTestPlant
+{
+    double delayLine[NW_TEST_PLANT_DELAY + 1u];
+    double lag1;
+    double lag2;
+} NexaWattTestPlant;
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+static const NexaWattAutotuneConfig nwTestAutotuneConfig =
+{
+    NW_Q15_CONST(0.5),          // setpoint
+    NW_Q15_CONST(0.5),          // outputBias
+    NW_Q15_CONST(0.1),          // relayAmplitude
+    NW_Q15_CONST(0.0005),       // hysteresis
+    NW_Q15_CONST(0.2),          // measMin
+    NW_Q15_CONST(0.8),          // measMax
+    0,                          // safeOutput
+    NW_Q16_CONST(NW_TEST_FILTER_ALPHA),
+    2u,                         // settleCycles
+    4u,                         // measureCycles
+    NW_TEST_MAX_SAMPLES,        // timeoutSamples
+    NW_AUTOTUNE_RULE_ZN_PID,
+};
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that sets the plant to a steady state.
+ * \param plant - A pointer to the plant.
+ * \param value - The steady state of the input and the output.
+ */
+static void NexaWatt_Test_Autotune_Plant_Reset(NexaWattTestPlant* plant, double value);
+
+/**
+ * \brief Simple helper function that applies an actuator command for one sample.
+ * \param plant - A pointer to the plant.
+ * \param command - The Q15 actuator command.
+ * \return The Q15 measurement of the next sample.
+ */
+static NwQ15 NexaWatt_Test_Autotune_Plant_Step(NexaWattTestPlant* plant, NwQ15 command);
+
+/**
+ * \brief Simple helper function that calculates the critical point of the plant and the feedback filter:
+ * the frequency of the phase -180 degrees, found by bisection, and the inverse of the gain at it.
+ * \param ultimateGain - A pointer to the ultimate gain.
+ * \param ultimatePeriod - A pointer to the ultimate period in samples.
+ */
+static void NexaWatt_Test_Autotune_Critical_Point(double* ultimateGain, double* ultimatePeriod);
+
+/**
+ * \brief Simple helper function that runs a relay experiment until it is no longer running.
+ * \param autotune - A pointer to the autotune instance.
+ * \param autotuneConfig - A pointer to the configuration.
+ * \param plant - A pointer to the plant.
+ * \return The number of executed samples.
+ */
+static uint32 NexaWatt_Test_Autotune_Run(NexaWattAutotune* autotune, const NexaWattAutotuneConfig* autotuneConfig, NexaWattTestPlant* plant);
+
+static void NexaWatt_Test_Autotune_Ultimate_Point(void);
+static void NexaWatt_Test_Autotune_Long_Settling(void);
+static void NexaWatt_Test_Autotune_Measurement_Limit(void);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+int main(void)
+{
+    NexaWatt_Test_Autotune_Ultimate_Point();
+    NexaWatt_Test_Autotune_Long_Settling();
+    NexaWatt_Test_Autotune_Measurement_Limit();
+
+    return NexaWatt_Test_Result("autotune");
+}
+
+static void NexaWatt_Test_Autotune_Ultimate_Point(void)
+{
+    NexaWattAutotune autotune;
+    NexaWattAutotuneResult result;
+    NexaWattTestPlant plant;
+    NexaWattNpnzConfig npnzConfig;
+    NexaWattNpnzController npnz;
+    double ultimateGain = 0.0;
+    double ultimatePeriod = 0.0;
+    double measuredGain = 0.0;
+    double output = 0.0;
+    double peak = 0.0;
+    NwQ15 measurement = 0;
+    uint32 sampleIdx = 0u;
+
+    NexaWatt_Test_Autotune_Critical_Point(&ultimateGain, &ultimatePeriod);
+
+    (void)NexaWatt_Test_Autotune_Run(&autotune, &nwTestAutotuneConfig, &plant);
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Autotune_Get_State(&autotune) == NW_AUTOTUNE_MEASURED);
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Autotune_Compute(&autotune, &result) == NW_CONTROLLER_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Autotune_Get_State(&autotune) == NW_AUTOTUNE_DONE);
+
+    // The relay and the hysteresis approximate the critical point within a few percent
+    measuredGain = (double)result.ultimateGain / (double)NW_Q16_ONE;
+    printf("autotune: Ku %.2f (plant %.2f), Tu %lu (plant %.1f) samples\n",
+           measuredGain, ultimateGain, (unsigned long)result.ultimatePeriodSamples, ultimatePeriod);
+    NW_TEST_EXPECT(fabs(measuredGain - ultimateGain) < (0.15 * ultimateGain));
+    NW_TEST_EXPECT(fabs((double)result.ultimatePeriodSamples - ultimatePeriod) < (0.1 * ultimatePeriod));
+    NW_TEST_EXPECT(result.gains.kp > 0);
+    NW_TEST_EXPECT(result.gains.ki > 0);
+    NW_TEST_EXPECT(result.gains.kd > 0);
+
+    // The tuned controller regulates a setpoint step without a steady-state error
+    npnzConfig.outMin = 0;
+    npnzConfig.outMax = NW_Q15_MAX;
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Npnz_From_Pid(&result.gains, &npnzConfig) == NW_CONTROLLER_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Npnz_Init(&npnz, &npnzConfig) == NW_CONTROLLER_SUCCESS);
+    NexaWatt_DigitalController_Npnz_Reset(&npnz, NW_Q15_CONST(0.5));
+    NexaWatt_Test_Autotune_Plant_Reset(&plant, 0.5);
+
+    measurement = NW_Q15_CONST(0.5);
+    for (sampleIdx = 0u; sampleIdx < 3000u; sampleIdx++)
+    {
+        measurement = NexaWatt_Test_Autotune_Plant_Step(&plant, NexaWatt_DigitalController_Npnz_Step(&npnz, NW_Q15_CONST(0.6), measurement));
+        output = plant.lag2;
+        peak = (output > peak) ? output : peak;
+    }
+    NW_TEST_EXPECT(fabs(output - 0.6) < 0.002);
+    NW_TEST_EXPECT(peak < 0.65);
+}
+
+static void NexaWatt_Test_Autotune_Long_Settling(void)
+{
+    NexaWattAutotune autotune;
+    NexaWattAutotuneConfig autotuneConfig = nwTestAutotuneConfig;
+    NexaWattTestPlant plant;
+
+    // More settling cycles than an 8-bit cycle counter can count past
+    autotuneConfig.settleCycles = 255u;
+    autotuneConfig.measureCycles = 2u;
+    (void)NexaWatt_Test_Autotune_Run(&autotune, &autotuneConfig, &plant);
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Autotune_Get_State(&autotune) == NW_AUTOTUNE_MEASURED);
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Autotune_Get_Abort_Reason(&autotune) == NW_AUTOTUNE_ABORT_NONE);
+}
+
+static void NexaWatt_Test_Autotune_Measurement_Limit(void)
+{
+    NexaWattAutotune autotune;
+    NexaWattAutotuneConfig autotuneConfig = nwTestAutotuneConfig;
+    NexaWattTestPlant plant;
+
+    // The limit cycle exceeds the narrow safety window: the safe output is applied from then on
+    autotuneConfig.measMin = NW_Q15_CONST(0.49);
+    autotuneConfig.measMax = NW_Q15_CONST(0.505);
+    (void)NexaWatt_Test_Autotune_Run(&autotune, &autotuneConfig, &plant);
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Autotune_Get_State(&autotune) == NW_AUTOTUNE_ABORTED);
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Autotune_Get_Abort_Reason(&autotune) == NW_AUTOTUNE_ABORT_MEAS_LIMIT);
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Autotune_Step(&autotune, NW_Q15_CONST(0.5)) == autotuneConfig.safeOutput);
+
+    // The limit cycle cannot settle before the timeout
+    autotuneConfig = nwTestAutotuneConfig;
+    autotuneConfig.timeoutSamples = 50u;
+    (void)NexaWatt_Test_Autotune_Run(&autotune, &autotuneConfig, &plant);
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Autotune_Get_Abort_Reason(&autotune) == NW_AUTOTUNE_ABORT_TIMEOUT);
+}
+
+static void NexaWatt_Test_Autotune_Plant_Reset(NexaWattTestPlant* const plant, const double value)
+{
+    uint8 delayIdx = 0u;
+
+    for (delayIdx = 0u; delayIdx <= NW_TEST_PLANT_DELAY; delayIdx++)
+    {
+        plant->delayLine[delayIdx] = value;
+    }
+    plant->lag1 = value;
+    plant->lag2 = value;
+}
+
+static NwQ15 NexaWatt_Test_Autotune_Plant_Step(NexaWattTestPlant* const plant, const NwQ15 command)
+{
+    uint8 delayIdx = 0u;
+
+    for (delayIdx = NW_TEST_PLANT_DELAY; delayIdx > 0u; delayIdx--)
+    {
+        plant->delayLine[delayIdx] = plant->delayLine[delayIdx - 1u];
+    }
+    plant->delayLine[0u] = (double)command / (double)NW_Q15_ONE;
+
+    plant->lag1 += NW_TEST_PLANT_K1 * (plant->delayLine[NW_TEST_PLANT_DELAY] - plant->lag1);
+    plant->lag2 += NW_TEST_PLANT_K2 * (plant->lag1 - plant->lag2);
+
+    return (NwQ15)(plant->lag2 * (double)NW_Q15_ONE);
+}
+
+static void NexaWatt_Test_Autotune_Critical_Point(double* const ultimateGain, double* const ultimatePeriod)
+{
+    // Poles of the lags and of the feedback filter; every factor k * z / (z - p) adds the phase w - atan2(sin w, cos w - p)
+    const double poles[3u] = { 1.0 - NW_TEST_PLANT_K1, 1.0 - NW_TEST_PLANT_K2, 1.0 - NW_TEST_FILTER_ALPHA };
+    const double gain = NW_TEST_PLANT_K1 * NW_TEST_PLANT_K2 * NW_TEST_FILTER_ALPHA;
+    double lowFreq = 0.0;
+    double highFreq = NW_TEST_PI;
+    double freq = 0.0;
+    double phase = 0.0;
+    double magnitude = 0.0;
+    uint32 iterationIdx = 0u;
+    uint8 poleIdx = 0u;
+
+    for (iterationIdx = 0u; iterationIdx < 60u; iterationIdx++)
+    {
+        freq = 0.5 * (lowFreq + highFreq);
+        // The delay z^-3 and the z of the first lag, which the state update does not contain
+        phase = -((double)NW_TEST_PLANT_DELAY + 1.0) * freq;
+        magnitude = gain;
+        for (poleIdx = 0u; poleIdx < 3u; poleIdx++)
+        {
+            phase += freq - atan2(sin(freq), cos(freq) - poles[poleIdx]);
+            magnitude /= sqrt(((cos(freq) - poles[poleIdx]) * (cos(freq) - poles[poleIdx])) + (sin(freq) * sin(freq)));
+        }
+
+        if (phase > -NW_TEST_PI)
+        {
+            lowFreq = freq;
+        }
+        else
+        {
+            highFreq = freq;
+        }
+    }
+
+    *ultimateGain = 1.0 / magnitude;
+    *ultimatePeriod = (2.0 * NW_TEST_PI) / freq;
+}
+
+static uint32 NexaWatt_Test_Autotune_Run(NexaWattAutotune* const autotune, const NexaWattAutotuneConfig* const autotuneConfig, NexaWattTestPlant* const plant)
+{
+    NwQ15 measurement = autotuneConfig->setpoint;
+    uint32 sampleIdx = 0u;
+
+    NexaWatt_Test_Autotune_Plant_Reset(plant, (double)autotuneConfig->setpoint / (double)NW_Q15_ONE);
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Autotune_Start(autotune, autotuneConfig, measurement) == NW_CONTROLLER_SUCCESS);
+
+    while ((NexaWatt_DigitalController_Autotune_Get_State(autotune) == NW_AUTOTUNE_RUNNING) &&
+           (sampleIdx < NW_TEST_MAX_SAMPLES))
+    {
+        measurement = NexaWatt_Test_Autotune_Plant_Step(plant, NexaWatt_DigitalController_Autotune_Step(autotune, measurement));
+        sampleIdx++;
+    }
+
+    return sampleIdx;
+}
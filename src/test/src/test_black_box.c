@@ -0,0 +1,294 @@
+/*******************************************************************************
+* File Name:   test_black_box.c
+*
+* Description: This is the source file containing the host test,
+* related to the fault black box of the NexaWatt-IV.DC framework.
+* The frames are stored in the file-backed storage (see diag_black_box_file_nv.h); a reset
+* of the target is simulated by closing the storage and initializing the black box again.
+* The test covers the chronological order of the wrapped history, the wrap-around of the
+* storage slots and a power loss during the write of a frame. The deferred events are
+* collected by a fake event queue and dispatched by the test.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "test_host.h"
+#include "diag_black_box.h"
+#include "diag_black_box_file_nv.h"
+#include "nexa_mini_os_event.h"
+#include "nexa_mini_os_time.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define NW_TEST_NV_PATH                     "build/test_black_box_nv.bin"
+#define NW_TEST_SLOT_CNT                    (3u)
+#define NW_TEST_SIGNAL_OFFSET               (1000u)
+#define NW_TEST_TORN_WRITE_LEN              (100u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+static volatile uint32 nwTestSignals[2u] = { 0u, 0u };
+static NexaWattSafetyChecker nwTestChecker;
+static NexaWattBlackBoxFileNv nwTestNv;
+static NexaWattBlackBox nwTestBlackBox;
+static NexaWattBlackBoxFrame nwTestFrame;
+
+static NwMiniOsEventHandler nwTestEventHandler = NULL;
+static void* nwTestEventContext = NULL;
+static nw_bool nwTestIsEventQueueFull = nwFalse;
+static uint64 nwTestTimeUs = 0u;
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that simulates a reset: the storage is reopened and the black box initialized again.
+ * \return The result of the initialization.
+ */
+static NexaWattBlackBoxStatusResult NexaWatt_Test_BlackBox_Boot(void);
+
+/**
+ * \brief Simple helper function that records samples and latches a fault at one of them.
+ * \param sampleCnt - The number of recorded samples.
+ * \param faultSampleIdx - The index of the sample, at which the fault is latched.
+ * \param faultMask - The latched fault.
+ */
+static void NexaWatt_Test_BlackBox_Record(uint32 sampleCnt, uint32 faultSampleIdx, uint32 faultMask);
+
+/**
+ * \brief Simple helper function that executes the pending deferred event and clears the latched faults.
+ */
+static void NexaWatt_Test_BlackBox_Dispatch(void);
+
+/**
+ * \brief Simple helper function that checks the sequences of the reachable frames, from the newest one.
+ * \param frameCnt - The expected number of reachable frames.
+ * \param newestSequence - The expected sequence of the newest frame.
+ */
+static void NexaWatt_Test_BlackBox_Expect_Frames(uint8 frameCnt, uint32 newestSequence);
+
+static void NexaWatt_Test_BlackBox_History(void);
+static void NexaWatt_Test_BlackBox_Slot_Wrap(void);
+static void NexaWatt_Test_BlackBox_Power_Loss(void);
+static void NexaWatt_Test_BlackBox_Lost_Frames(void);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattMiniOsStatusResult NexaWatt_MiniOs_Event_Post(const NwMiniOsEventHandler eventHandler, void* const eventContext, const uint32 eventArg)
+{
+    NexaWattMiniOsStatusResult retRes = NW_MINI_OS_QUEUE_FULL;
+
+    (void)eventArg;
+
+    if ((nwTestIsEventQueueFull == nwFalse) &&
+        (nwTestEventHandler == NULL))
+    {
+        nwTestEventHandler = eventHandler;
+        nwTestEventContext = eventContext;
+        retRes = NW_MINI_OS_SUCCESS;
+    }
+
+    return retRes;
+}
+
+uint64 NexaWatt_MiniOs_Time_Get_Us(void)
+{
+    nwTestTimeUs += 1000u;
+
+    return nwTestTimeUs;
+}
+
+int main(void)
+{
+    (void)remove(NW_TEST_NV_PATH);
+
+    // The steps build on the storage written by the previous ones
+    NexaWatt_Test_BlackBox_History();
+    NexaWatt_Test_BlackBox_Slot_Wrap();
+    NexaWatt_Test_BlackBox_Power_Loss();
+    NexaWatt_Test_BlackBox_Lost_Frames();
+
+    NexaWatt_Diag_BlackBox_FileNv_Close(&nwTestNv);
+    (void)remove(NW_TEST_NV_PATH);
+
+    return NexaWatt_Test_Result("black_box");
+}
+
+static NexaWattBlackBoxStatusResult NexaWatt_Test_BlackBox_Boot(void)
+{
+    NexaWattBlackBoxConfig blackBoxConfig;
+
+    NexaWatt_Diag_BlackBox_FileNv_Close(&nwTestNv);
+    NW_TEST_EXPECT(NexaWatt_Diag_BlackBox_FileNv_Open(&nwTestNv, NW_TEST_NV_PATH) == nwTrue);
+
+    blackBoxConfig.signals[0u] = &nwTestSignals[0u];
+    blackBoxConfig.signals[1u] = &nwTestSignals[1u];
+    blackBoxConfig.signalCnt = 2u;
+    blackBoxConfig.safetyChecker = &nwTestChecker;
+    blackBoxConfig.stateMachine = NULL;
+    blackBoxConfig.nvRead = NexaWatt_Diag_BlackBox_FileNv_Read;
+    blackBoxConfig.nvWrite = NexaWatt_Diag_BlackBox_FileNv_Write;
+    blackBoxConfig.nvContext = &nwTestNv;
+    blackBoxConfig.slotCnt = NW_TEST_SLOT_CNT;
+
+    return NexaWatt_Diag_BlackBox_Init(&nwTestBlackBox, &blackBoxConfig);
+}
+
+static void NexaWatt_Test_BlackBox_Record(const uint32 sampleCnt, const uint32 faultSampleIdx, const uint32 faultMask)
+{
+    uint32 sampleIdx = 0u;
+
+    for (sampleIdx = 0u; sampleIdx < sampleCnt; sampleIdx++)
+    {
+        nwTestSignals[0u] = sampleIdx;
+        nwTestSignals[1u] = NW_TEST_SIGNAL_OFFSET + sampleIdx;
+        if (sampleIdx == faultSampleIdx)
+        {
+            nwTestChecker.latchedFaults |= faultMask;
+        }
+        NexaWatt_Diag_BlackBox_Record(&nwTestBlackBox);
+    }
+}
+
+static void NexaWatt_Test_BlackBox_Dispatch(void)
+{
+    NwMiniOsEventHandler eventHandler = nwTestEventHandler;
+
+    nwTestEventHandler = NULL;
+    if (eventHandler != NULL)
+    {
+        eventHandler(nwTestEventContext, 0u);
+    }
+    nwTestChecker.latchedFaults = 0u;
+}
+
+static void NexaWatt_Test_BlackBox_Expect_Frames(const uint8 frameCnt, const uint32 newestSequence)
+{
+    uint8 frameAge = 0u;
+
+    NW_TEST_EXPECT(NexaWatt_Diag_BlackBox_Get_Frame_Cnt(&nwTestBlackBox) == frameCnt);
+    for (frameAge = 0u; frameAge < frameCnt; frameAge++)
+    {
+        NW_TEST_EXPECT(NexaWatt_Diag_BlackBox_Read_Frame(&nwTestBlackBox, frameAge, &nwTestFrame) == NW_BLACK_BOX_SUCCESS);
+        NW_TEST_EXPECT(nwTestFrame.sequence == (newestSequence - frameAge));
+    }
+    NW_TEST_EXPECT(NexaWatt_Diag_BlackBox_Read_Frame(&nwTestBlackBox, frameCnt, &nwTestFrame) == NW_BLACK_BOX_NOT_FOUND);
+}
+
+static void NexaWatt_Test_BlackBox_History(void)
+{
+    NW_TEST_EXPECT(NexaWatt_Test_BlackBox_Boot() == NW_BLACK_BOX_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_Diag_BlackBox_Get_Frame_Cnt(&nwTestBlackBox) == 0u);
+    NW_TEST_EXPECT(NexaWatt_Diag_BlackBox_Read_Frame(&nwTestBlackBox, 0u, &nwTestFrame) == NW_BLACK_BOX_NOT_FOUND);
+
+    // A fault before the history is full: the frame holds every sample up to the fault
+    NexaWatt_Test_BlackBox_Record(30u, 20u, 0x01u);
+    NexaWatt_Test_BlackBox_Dispatch();
+    NW_TEST_EXPECT(NexaWatt_Diag_BlackBox_Read_Frame(&nwTestBlackBox, 0u, &nwTestFrame) == NW_BLACK_BOX_SUCCESS);
+    NW_TEST_EXPECT(nwTestFrame.sequence == 0u);
+    NW_TEST_EXPECT(nwTestFrame.latchedFaults == 0x01u);
+    NW_TEST_EXPECT(nwTestFrame.newFaults == 0x01u);
+    NW_TEST_EXPECT(nwTestFrame.state == NW_STATE_NONE);
+    NW_TEST_EXPECT(nwTestFrame.signalCnt == 2u);
+    NW_TEST_EXPECT(nwTestFrame.sampleCnt == 21u);
+    NW_TEST_EXPECT(nwTestFrame.samples[0u][0u] == 0u);
+    NW_TEST_EXPECT(nwTestFrame.samples[20u][1u] == (NW_TEST_SIGNAL_OFFSET + 20u));
+
+    // A fault after the history wrapped: the frame holds the last samples in chronological order
+    NexaWatt_Test_BlackBox_Record(100u, 90u, 0x02u);
+    NexaWatt_Test_BlackBox_Dispatch();
+    NW_TEST_EXPECT(NexaWatt_Diag_BlackBox_Read_Frame(&nwTestBlackBox, 0u, &nwTestFrame) == NW_BLACK_BOX_SUCCESS);
+    NW_TEST_EXPECT(nwTestFrame.sequence == 1u);
+    NW_TEST_EXPECT(nwTestFrame.newFaults == 0x02u);
+    NW_TEST_EXPECT(nwTestFrame.sampleCnt == NW_BLACK_BOX_HISTORY_LEN);
+    NW_TEST_EXPECT(nwTestFrame.samples[0u][0u] == (91u - NW_BLACK_BOX_HISTORY_LEN));
+    NW_TEST_EXPECT(nwTestFrame.samples[NW_BLACK_BOX_HISTORY_LEN - 1u][0u] == 90u);
+    NW_TEST_EXPECT(nwTestFrame.samples[NW_BLACK_BOX_HISTORY_LEN - 1u][1u] == (NW_TEST_SIGNAL_OFFSET + 90u));
+
+    // Both frames survive a reset
+    NW_TEST_EXPECT(NexaWatt_Test_BlackBox_Boot() == NW_BLACK_BOX_SUCCESS);
+    NexaWatt_Test_BlackBox_Expect_Frames(2u, 1u);
+    NW_TEST_EXPECT(NexaWatt_Diag_BlackBox_Read_Frame(&nwTestBlackBox, 1u, &nwTestFrame) == NW_BLACK_BOX_SUCCESS);
+    NW_TEST_EXPECT(nwTestFrame.sampleCnt == 21u);
+}
+
+static void NexaWatt_Test_BlackBox_Slot_Wrap(void)
+{
+    uint32 frameIdx = 0u;
+
+    // The sequences 2 to 4 fill the last slot and overwrite the first two
+    for (frameIdx = 0u; frameIdx < 3u; frameIdx++)
+    {
+        NexaWatt_Test_BlackBox_Record(10u, 5u, 0x04u);
+        NexaWatt_Test_BlackBox_Dispatch();
+    }
+    NexaWatt_Test_BlackBox_Expect_Frames(NW_TEST_SLOT_CNT, 4u);
+
+    // The newest frame is found again after a reset, although it is not in the last slot
+    NW_TEST_EXPECT(NexaWatt_Test_BlackBox_Boot() == NW_BLACK_BOX_SUCCESS);
+    NexaWatt_Test_BlackBox_Expect_Frames(NW_TEST_SLOT_CNT, 4u);
+    NW_TEST_EXPECT(nwTestBlackBox.nextSlot == 2u);
+    NW_TEST_EXPECT(nwTestBlackBox.nextSequence == 5u);
+}
+
+static void NexaWatt_Test_BlackBox_Power_Loss(void)
+{
+    NexaWattBlackBoxStats blackBoxStats;
+
+    // The power fails during the write of the sequence 5 over the oldest frame (sequence 2)
+    NexaWatt_Diag_BlackBox_FileNv_Inject_Failure(&nwTestNv, NW_TEST_TORN_WRITE_LEN);
+    NexaWatt_Test_BlackBox_Record(10u, 5u, 0x08u);
+    NexaWatt_Test_BlackBox_Dispatch();
+    NexaWatt_Diag_BlackBox_Get_Stats(&nwTestBlackBox, &blackBoxStats);
+    NW_TEST_EXPECT(blackBoxStats.nvErrCnt == 1u);
+    NW_TEST_EXPECT(blackBoxStats.storedCnt == 0u);
+    NexaWatt_Test_BlackBox_Expect_Frames(2u, 4u);
+
+    // The torn frame fails its checksum after the reset, the older frames are kept
+    NW_TEST_EXPECT(NexaWatt_Test_BlackBox_Boot() == NW_BLACK_BOX_SUCCESS);
+    NexaWatt_Test_BlackBox_Expect_Frames(2u, 4u);
+    NW_TEST_EXPECT(nwTestBlackBox.nextSlot == 2u);
+    NW_TEST_EXPECT(nwTestBlackBox.nextSequence == 5u);
+
+    // The next frame is written over the torn one
+    NexaWatt_Test_BlackBox_Record(10u, 5u, 0x10u);
+    NexaWatt_Test_BlackBox_Dispatch();
+    NexaWatt_Test_BlackBox_Expect_Frames(NW_TEST_SLOT_CNT, 5u);
+    NW_TEST_EXPECT(NexaWatt_Test_BlackBox_Boot() == NW_BLACK_BOX_SUCCESS);
+    NexaWatt_Test_BlackBox_Expect_Frames(NW_TEST_SLOT_CNT, 5u);
+    NW_TEST_EXPECT(NexaWatt_Diag_BlackBox_Read_Frame(&nwTestBlackBox, 0u, &nwTestFrame) == NW_BLACK_BOX_SUCCESS);
+    NW_TEST_EXPECT(nwTestFrame.newFaults == 0x10u);
+}
+
+static void NexaWatt_Test_BlackBox_Lost_Frames(void)
+{
+    NexaWattBlackBoxStats blackBoxStats;
+
+    // A fault while the previous frame is pending, then a fault without a free event
+    NexaWatt_Test_BlackBox_Record(10u, 2u, 0x01u);
+    NexaWatt_Test_BlackBox_Record(10u, 2u, 0x02u);
+    NexaWatt_Test_BlackBox_Dispatch();
+    nwTestIsEventQueueFull = nwTrue;
+    NexaWatt_Test_BlackBox_Record(10u, 2u, 0x04u);
+    nwTestIsEventQueueFull = nwFalse;
+    NexaWatt_Test_BlackBox_Dispatch();
+
+    NexaWatt_Diag_BlackBox_Get_Stats(&nwTestBlackBox, &blackBoxStats);
+    NW_TEST_EXPECT(blackBoxStats.frozenCnt == 2u);
+    NW_TEST_EXPECT(blackBoxStats.storedCnt == 1u);
+    NW_TEST_EXPECT(blackBoxStats.lostCnt == 2u);
+    NexaWatt_Test_BlackBox_Expect_Frames(NW_TEST_SLOT_CNT, 6u);
+    NW_TEST_EXPECT(NexaWatt_Diag_BlackBox_Read_Frame(&nwTestBlackBox, 0u, &nwTestFrame) == NW_BLACK_BOX_SUCCESS);
+    NW_TEST_EXPECT(nwTestFrame.newFaults == 0x01u);
+}
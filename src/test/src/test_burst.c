@@ -0,0 +1,308 @@
+/*******************************************************************************
+* File Name:   test_burst.c
+*
+* Description: This is the source file containing the host test,
+* related to the light-load burst mode and the pulse skipping of the NexaWatt-IV.DC framework.
+* A synchronous buck converter (12 V to 5 V, 100 kHz, 2 uJ per switching cycle) is simulated
+* with the switched plant model. The voltage controller is followed by the burst mode and
+* the pulse skipping (light-load operation) or by the pulse skipping only (continuous operation).
+* The test checks the efficiency at light load, the output voltage ripple in the burst mode,
+* the undershoot at a load step out of the burst mode, the duty limit and the integrator freeze.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <math.h>
+#include "test_host.h"
+#include "digital_controller_burst.h"
+#include "topology_pulse_skip.h"
+#include "topology_plant_model.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Operating point of the simulated converter, full scale inputs of 20 V and 10 A.
+ */
+#define NW_TEST_INPUT_VOLTAGE               (12.0)
+#define NW_TEST_OUTPUT_VOLTAGE              (5.0)
+#define NW_TEST_VOLTAGE_BASE                (20.0)
+#define NW_TEST_CURRENT_BASE                (10.0)
+#define NW_TEST_REFERENCE                   NW_Q15_CONST(NW_TEST_OUTPUT_VOLTAGE / NW_TEST_VOLTAGE_BASE)
+
+/**
+ * \brief Periods simulated before the measurement (start-up and burst mode entry) and measured periods.
+ */
+#define NW_TEST_SETTLE_PERIODS              (20000u)
+#define NW_TEST_MEASURE_PERIODS             (20000u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+/**
+ * \brief Control path of the simulated converter. The burst mode is skipped in continuous operation.
+ */
+typedef struct sNexaWattTestConverter
+{
+    NexaWattPlantModel model;
+    NexaWattPidController pid;
+    NexaWattBurst burst;
+    NexaWattPulseSkip pulseSkip;
+    nw_bool isLightLoad;
+} NexaWattTestConverter;
+
+/**
+ * \brief Results of a measurement: the efficiency and the extreme output voltages.
+ */
+typedef struct sNexaWattTestMeasurement
+{
+    double efficiency;
+    double minOutputVoltage;
+    double maxOutputVoltage;
+} NexaWattTestMeasurement;
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+static const NexaWattBurstConfig nwTestBurstConfig =
+{
+    NW_Q15_CONST(0.05 / NW_TEST_VOLTAGE_BASE),  // bandLow
+    NW_Q15_CONST(0.05 / NW_TEST_VOLTAGE_BASE),  // bandHigh
+    NW_Q15_CONST(0.15 / NW_TEST_VOLTAGE_BASE),  // exitUndershoot
+    NW_Q15_CONST(0.3 / NW_TEST_CURRENT_BASE),   // entryCurrent
+    NW_Q15_CONST(0.6 / NW_TEST_CURRENT_BASE),   // exitCurrent
+    NW_Q15_CONST(0.05),                         // burstDutyBoost
+    NW_Q16_CONST(0.05),                         // loadCurrentAlpha
+    200u,                                       // entryDwellSamples
+};
+
+static NexaWattTestConverter nwTestConverter;
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that initializes the simulated converter in steady state at the provided load.
+ * \param converter - A pointer to the converter.
+ * \param loadResistance - The load resistance in Ohms.
+ * \param isLightLoad - nwTrue for the light-load operation with the burst mode.
+ */
+static void NexaWatt_Test_Burst_Init(NexaWattTestConverter* converter, double loadResistance, nw_bool isLightLoad);
+
+/**
+ * \brief Simple helper function that simulates a single control period of the converter.
+ * \param converter - A pointer to the converter.
+ */
+static void NexaWatt_Test_Burst_Step(NexaWattTestConverter* converter);
+
+/**
+ * \brief Simple helper function that simulates the converter and measures the efficiency and the output voltage range.
+ * \param converter - A pointer to the converter.
+ * \param periodCnt - The number of measured periods.
+ * \param measurement - A pointer to the results.
+ */
+static void NexaWatt_Test_Burst_Measure(NexaWattTestConverter* converter, uint32 periodCnt, NexaWattTestMeasurement* measurement);
+
+static void NexaWatt_Test_Burst_Efficiency(void);
+static void NexaWatt_Test_Burst_Load_Step(void);
+static void NexaWatt_Test_Burst_Heavy_Load(void);
+static void NexaWatt_Test_Burst_Duty_Limit(void);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+int main(void)
+{
+    NexaWatt_Test_Burst_Efficiency();
+    NexaWatt_Test_Burst_Load_Step();
+    NexaWatt_Test_Burst_Heavy_Load();
+    NexaWatt_Test_Burst_Duty_Limit();
+
+    return NexaWatt_Test_Result("burst");
+}
+
+static void NexaWatt_Test_Burst_Efficiency(void)
+{
+    NexaWattTestMeasurement continuous;
+    NexaWattTestMeasurement lightLoad;
+    NwQ15 frozenIntegrator = 0;
+
+    // 100 Ohm (50 mA): the switching losses dominate in continuous operation
+    NexaWatt_Test_Burst_Init(&nwTestConverter, 100.0, nwFalse);
+    NexaWatt_Test_Burst_Measure(&nwTestConverter, NW_TEST_MEASURE_PERIODS, &continuous);
+
+    NexaWatt_Test_Burst_Init(&nwTestConverter, 100.0, nwTrue);
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Burst_Is_Active(&nwTestConverter.burst) == nwTrue);
+    NW_TEST_EXPECT(nwTestConverter.pid.integratorFrozen == nwTrue);
+    frozenIntegrator = nwTestConverter.pid.integrator;
+    NexaWatt_Test_Burst_Measure(&nwTestConverter, NW_TEST_MEASURE_PERIODS, &lightLoad);
+
+    printf("burst: 100 Ohm efficiency %.1f %% continuous, %.1f %% light load, output %.3f V .. %.3f V\n",
+           continuous.efficiency * 100.0, lightLoad.efficiency * 100.0, lightLoad.minOutputVoltage, lightLoad.maxOutputVoltage);
+    NW_TEST_EXPECT(continuous.efficiency < 0.6);
+    NW_TEST_EXPECT(lightLoad.efficiency > 0.85);
+
+    // The burst mode stays active and the output voltage stays in the band, extended by the overshoot of a burst
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Burst_Is_Active(&nwTestConverter.burst) == nwTrue);
+    NW_TEST_EXPECT(nwTestConverter.burst.burstCnt > 10u);
+    NW_TEST_EXPECT(lightLoad.minOutputVoltage > (NW_TEST_OUTPUT_VOLTAGE - 0.1));
+    NW_TEST_EXPECT(lightLoad.maxOutputVoltage < (NW_TEST_OUTPUT_VOLTAGE + 0.25));
+    NW_TEST_EXPECT((lightLoad.maxOutputVoltage - lightLoad.minOutputVoltage) < 0.3);
+
+    // The integrator keeps the light-load operating point during the whole burst mode
+    NW_TEST_EXPECT(nwTestConverter.pid.integrator == frozenIntegrator);
+
+    // 25 Ohm (200 mA): still below the entry current
+    NexaWatt_Test_Burst_Init(&nwTestConverter, 25.0, nwFalse);
+    NexaWatt_Test_Burst_Measure(&nwTestConverter, NW_TEST_MEASURE_PERIODS, &continuous);
+    NexaWatt_Test_Burst_Init(&nwTestConverter, 25.0, nwTrue);
+    NexaWatt_Test_Burst_Measure(&nwTestConverter, NW_TEST_MEASURE_PERIODS, &lightLoad);
+    printf("burst: 25 Ohm efficiency %.1f %% continuous, %.1f %% light load\n", continuous.efficiency * 100.0, lightLoad.efficiency * 100.0);
+    NW_TEST_EXPECT(lightLoad.efficiency > (continuous.efficiency + 0.1));
+}
+
+static void NexaWatt_Test_Burst_Load_Step(void)
+{
+    NexaWattTestMeasurement continuous;
+    NexaWattTestMeasurement lightLoad;
+
+    // Step from 50 mA to 1 A: the burst mode is left immediately and the integrator is released
+    NexaWatt_Test_Burst_Init(&nwTestConverter, 100.0, nwFalse);
+    NexaWatt_PlantModel_Set_Load(&nwTestConverter.model, 5.0, 0.0);
+    NexaWatt_Test_Burst_Measure(&nwTestConverter, NW_TEST_MEASURE_PERIODS, &continuous);
+
+    NexaWatt_Test_Burst_Init(&nwTestConverter, 100.0, nwTrue);
+    NexaWatt_PlantModel_Set_Load(&nwTestConverter.model, 5.0, 0.0);
+    NexaWatt_Test_Burst_Measure(&nwTestConverter, NW_TEST_MEASURE_PERIODS, &lightLoad);
+
+    printf("burst: load step minimum %.3f V continuous, %.3f V light load\n", continuous.minOutputVoltage, lightLoad.minOutputVoltage);
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Burst_Is_Active(&nwTestConverter.burst) == nwFalse);
+    NW_TEST_EXPECT(nwTestConverter.pid.integratorFrozen == nwFalse);
+    NW_TEST_EXPECT(lightLoad.minOutputVoltage > (NW_TEST_OUTPUT_VOLTAGE - 0.3));
+    NW_TEST_EXPECT(lightLoad.minOutputVoltage > (continuous.minOutputVoltage - 0.05));
+    NW_TEST_EXPECT(fabs(NexaWatt_PlantModel_Get_Outputs(&nwTestConverter.model)->outputVoltage - NW_TEST_OUTPUT_VOLTAGE) < 0.05);
+}
+
+static void NexaWatt_Test_Burst_Heavy_Load(void)
+{
+    NexaWattTestMeasurement continuous;
+    NexaWattTestMeasurement lightLoad;
+
+    // 5 Ohm (1 A): the burst mode is never entered, so both operations are identical
+    NexaWatt_Test_Burst_Init(&nwTestConverter, 5.0, nwFalse);
+    NexaWatt_Test_Burst_Measure(&nwTestConverter, NW_TEST_MEASURE_PERIODS, &continuous);
+    NexaWatt_Test_Burst_Init(&nwTestConverter, 5.0, nwTrue);
+    NexaWatt_Test_Burst_Measure(&nwTestConverter, NW_TEST_MEASURE_PERIODS, &lightLoad);
+
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Burst_Get_Mode(&nwTestConverter.burst) == NW_BURST_MODE_CONTINUOUS);
+    NW_TEST_EXPECT(nwTestConverter.burst.burstCnt == 0u);
+    NW_TEST_EXPECT(fabs(lightLoad.efficiency - continuous.efficiency) < 1e-9);
+}
+
+static void NexaWatt_Test_Burst_Duty_Limit(void)
+{
+    NexaWattBurst burst;
+    NwQ15 duty = 0;
+    uint32 sampleIdx = 0u;
+
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Burst_Init(&burst, &nwTestBurstConfig, NULL, 0) == NW_CONTROLLER_SUCCESS);
+
+    // A high controller output in the burst mode is boosted up to the duty limit of the topology, not beyond it
+    for (sampleIdx = 0u; sampleIdx < nwTestBurstConfig.entryDwellSamples; sampleIdx++)
+    {
+        (void)NexaWatt_DigitalController_Burst_Step(&burst, NW_TEST_REFERENCE, NW_TEST_REFERENCE, 0, NW_TOPOLOGY_DUTY_MAX);
+    }
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Burst_Is_Active(&burst) == nwTrue);
+    duty = NexaWatt_DigitalController_Burst_Step(&burst, NW_TEST_REFERENCE, NW_TEST_REFERENCE, 0, NW_TOPOLOGY_DUTY_MAX);
+    NW_TEST_EXPECT(duty == NW_TOPOLOGY_DUTY_MAX);
+    duty = NexaWatt_DigitalController_Burst_Step(&burst, NW_TEST_REFERENCE, NW_TEST_REFERENCE, 0, NW_Q15_MAX);
+    NW_TEST_EXPECT(duty == NW_TOPOLOGY_DUTY_MAX);
+
+    // Above the upper band the switching is gated
+    duty = NexaWatt_DigitalController_Burst_Step(&burst, NW_TEST_REFERENCE, NW_TEST_REFERENCE + (2 * nwTestBurstConfig.bandHigh), 0, NW_TOPOLOGY_DUTY_MAX);
+    NW_TEST_EXPECT(duty == 0);
+}
+
+static void NexaWatt_Test_Burst_Init(NexaWattTestConverter* const converter, const double loadResistance, const nw_bool isLightLoad)
+{
+    NexaWattPlantModelConfig modelConfig;
+    NexaWattPidConfig pidConfig;
+    uint32 periodIdx = 0u;
+
+    modelConfig.topologyId = NW_TOPOLOGY_ID_BUCK_SYNC;
+    modelConfig.modelType = NW_PLANT_MODEL_SWITCHED;
+    modelConfig.inductance = 22e-6;
+    modelConfig.inductorResistance = 0.02;
+    modelConfig.capacitance = 100e-6;
+    modelConfig.capacitorEsr = 0.01;
+    modelConfig.transformerRatio = 1.0;
+    modelConfig.controlFrequency = 100000.0;
+    modelConfig.subSteps = 0u;
+    modelConfig.switchingEnergy = 2e-6;
+    modelConfig.inputVoltage = NW_TEST_INPUT_VOLTAGE;
+    modelConfig.loadResistance = loadResistance;
+    modelConfig.loadCurrent = 0.0;
+    modelConfig.initialOutputVoltage = NW_TEST_OUTPUT_VOLTAGE;
+    modelConfig.voltageBase = NW_TEST_VOLTAGE_BASE;
+    modelConfig.currentBase = NW_TEST_CURRENT_BASE;
+    modelConfig.events = NULL;
+    modelConfig.eventCnt = 0u;
+    NW_TEST_EXPECT(NexaWatt_PlantModel_Init(&converter->model, &modelConfig) == NW_PLANT_MODEL_SUCCESS);
+
+    pidConfig.gains.kp = NW_Q16_CONST(4.0);
+    pidConfig.gains.ki = NW_Q16_CONST(0.4);
+    pidConfig.gains.kd = NW_Q16_CONST(16.0);
+    pidConfig.outMin = 0;
+    pidConfig.outMax = NW_TOPOLOGY_DUTY_MAX;
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Pid_Init(&converter->pid, &pidConfig) == NW_CONTROLLER_SUCCESS);
+    NexaWatt_DigitalController_Pid_Reset(&converter->pid, NW_Q15_CONST(NW_TEST_OUTPUT_VOLTAGE / NW_TEST_INPUT_VOLTAGE));
+
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Burst_Init(&converter->burst, &nwTestBurstConfig, &converter->pid, 0) == NW_CONTROLLER_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_Topology_Pulse_Skip_Init(&converter->pulseSkip, NW_TOPOLOGY_DUTY_MIN) == NW_PULSE_SKIP_SUCCESS);
+    converter->isLightLoad = isLightLoad;
+
+    for (periodIdx = 0u; periodIdx < NW_TEST_SETTLE_PERIODS; periodIdx++)
+    {
+        NexaWatt_Test_Burst_Step(converter);
+    }
+}
+
+static void NexaWatt_Test_Burst_Step(NexaWattTestConverter* const converter)
+{
+    const NwQ15 outputVoltage = NexaWatt_PlantModel_Get_Normalized(&converter->model, NW_TOPOLOGY_SENSE_VOUT);
+    NwQ15 duty = NexaWatt_DigitalController_Pid_Step(&converter->pid, NW_TEST_REFERENCE, outputVoltage);
+
+    if (converter->isLightLoad == nwTrue)
+    {
+        duty = NexaWatt_DigitalController_Burst_Step(&converter->burst, NW_TEST_REFERENCE, outputVoltage,
+                                                     NexaWatt_PlantModel_Get_Normalized(&converter->model, NW_TOPOLOGY_SENSE_IOUT), duty);
+    }
+    duty = NexaWatt_Topology_Pulse_Skip_Step(&converter->pulseSkip, duty);
+
+    NexaWatt_PlantModel_Step(&converter->model, duty);
+}
+
+static void NexaWatt_Test_Burst_Measure(NexaWattTestConverter* const converter, const uint32 periodCnt, NexaWattTestMeasurement* const measurement)
+{
+    const NexaWattPlantModelEnergy* const energy = NexaWatt_PlantModel_Get_Energy(&converter->model);
+    const double inputEnergyStart = energy->inputEnergy;
+    const double outputEnergyStart = energy->outputEnergy;
+    double outputVoltage = 0.0;
+    uint32 periodIdx = 0u;
+
+    measurement->minOutputVoltage = NexaWatt_PlantModel_Get_Outputs(&converter->model)->outputVoltage;
+    measurement->maxOutputVoltage = measurement->minOutputVoltage;
+    for (periodIdx = 0u; periodIdx < periodCnt; periodIdx++)
+    {
+        NexaWatt_Test_Burst_Step(converter);
+        outputVoltage = NexaWatt_PlantModel_Get_Outputs(&converter->model)->outputVoltage;
+        measurement->minOutputVoltage = fmin(measurement->minOutputVoltage, outputVoltage);
+        measurement->maxOutputVoltage = fmax(measurement->maxOutputVoltage, outputVoltage);
+    }
+
+    measurement->efficiency = (energy->outputEnergy - outputEnergyStart) / (energy->inputEnergy - inputEnergyStart);
+}
@@ -0,0 +1,283 @@
+/*******************************************************************************
+* File Name:   test_debounce.c
+*
+* Description: This is the source file containing the host test,
+* related to the input debounce of the HAL Manager of the NexaWatt-IV.DC framework.
+* The vertical counter is compared pin by pin with a scalar reference counter on
+* synthetic bounce patterns. The debounce of an EXTI notified and of a polled port
+* is checked on contact bounce and glitches, including the posted state change events
+* and the port reads of an idle port.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "test_host.h"
+#include "hal_manager_debounce.h"
+#include "hal_wrapper_gpio.h"
+#include "nexa_mini_os_event.h"
+#include "nexa_mini_os_time.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define NW_TEST_SAMPLE_PERIOD_US            (5000u)
+#define NW_TEST_EXTI_PORT                   (5u)
+#define NW_TEST_EXTI_PIN                    (3u)
+#define NW_TEST_POLLED_PORT                 (2u)
+#define NW_TEST_RANDOM_SAMPLE_CNT           (100000u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+static uint8 nwTestPortLevels[NW_TEST_EXTI_PORT + 1u];
+static uint32 nwTestPortReadCnt = 0u;
+static uint64 nwTestTimeUs = 0u;
+
+static uint32 nwTestEventCnt = 0u;
+static uint32 nwTestLastEventArg = 0u;
+static uint32 nwTestRandomState = 0x2468ACEu;
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that returns the next value of a linear congruential pseudo random sequence.
+ * \return The pseudo random value.
+ */
+static uint32 NexaWatt_Test_Debounce_Random(void);
+
+/**
+ * \brief Handler of the state change events of the test: counts the events and keeps the last argument.
+ * \param eventContext - Not used.
+ * \param eventArg - The packed port, changed mask and stable state.
+ */
+static void NexaWatt_Test_Debounce_Change_Handler(void* eventContext, uint32 eventArg);
+
+/**
+ * \brief Simple helper function that applies a pattern of pin levels, one per sample period.
+ * A level change of the EXTI pin is notified as edge, as the ISR of the port would do.
+ * \param pinLevels - The levels, '0' or '1' per sample period.
+ */
+static void NexaWatt_Test_Debounce_Apply_Pattern(const char* pinLevels);
+
+static void NexaWatt_Test_Debounce_Vertical_Counter(void);
+static void NexaWatt_Test_Debounce_Exti_Port(void);
+static void NexaWatt_Test_Debounce_Polled_Port(void);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+uint8 NexaWatt_HalWrapperGpio_Port_Read(const uint8 portNum)
+{
+    nwTestPortReadCnt++;
+
+    return nwTestPortLevels[portNum];
+}
+
+NexaWattMiniOsStatusResult NexaWatt_MiniOs_Event_Post(const NwMiniOsEventHandler eventHandler, void* const eventContext, const uint32 eventArg)
+{
+    eventHandler(eventContext, eventArg);
+
+    return NW_MINI_OS_SUCCESS;
+}
+
+uint64 NexaWatt_MiniOs_Time_Get_Us(void)
+{
+    return nwTestTimeUs;
+}
+
+int main(void)
+{
+    NexaWatt_Test_Debounce_Vertical_Counter();
+    NexaWatt_Test_Debounce_Exti_Port();
+    NexaWatt_Test_Debounce_Polled_Port();
+
+    return NexaWatt_Test_Result("debounce");
+}
+
+static void NexaWatt_Test_Debounce_Vertical_Counter(void)
+{
+    NexaWattDebounceCounter counter = { 0xFFu, 0x00u, 0xFFu, 0xFFu };
+    uint8 referenceCnt[8u] = { 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u };
+    uint8 referenceState = 0x00u;
+    uint8 referenceChanged = 0u;
+    uint8 portLevels = 0x00u;
+    uint8 changedMask = 0u;
+    uint32 mismatchCnt = 0u;
+    uint32 changeCnt = 0u;
+    uint32 sampleIdx = 0u;
+    uint8 pinIdx = 0u;
+
+    // Every pin toggles its level with its own probability, from rare changes to continuous bounce
+    for (sampleIdx = 0u; sampleIdx < NW_TEST_RANDOM_SAMPLE_CNT; sampleIdx++)
+    {
+        for (pinIdx = 0u; pinIdx < 8u; pinIdx++)
+        {
+            if ((NexaWatt_Test_Debounce_Random() >> 24u) < (2u << pinIdx))
+            {
+                portLevels ^= (uint8)(1u << pinIdx);
+            }
+        }
+
+        changedMask = NexaWatt_HalManager_Debounce_Step(&counter, portLevels);
+
+        // Reference: a pin changes after NW_DEBOUNCE_SAMPLE_CNT consecutive samples at the new level
+        referenceChanged = 0u;
+        for (pinIdx = 0u; pinIdx < 8u; pinIdx++)
+        {
+            if (((portLevels ^ referenceState) & (1u << pinIdx)) == 0u)
+            {
+                referenceCnt[pinIdx] = 0u;
+            }
+            else if (++referenceCnt[pinIdx] == NW_DEBOUNCE_SAMPLE_CNT)
+            {
+                referenceCnt[pinIdx] = 0u;
+                referenceChanged |= (uint8)(1u << pinIdx);
+            }
+        }
+        referenceState ^= referenceChanged;
+
+        if ((changedMask != referenceChanged) || (counter.stableState != referenceState))
+        {
+            mismatchCnt++;
+        }
+        changeCnt += (changedMask != 0u) ? 1u : 0u;
+    }
+
+    NW_TEST_EXPECT(mismatchCnt == 0u);
+    NW_TEST_EXPECT(changeCnt > 1000u);
+
+    // Pins outside the mask keep their state
+    counter.pinMask = 0x0Fu;
+    counter.stableState = 0x00u;
+    counter.counterBit0 = 0xFFu;
+    counter.counterBit1 = 0xFFu;
+    for (sampleIdx = 0u; sampleIdx < NW_DEBOUNCE_SAMPLE_CNT; sampleIdx++)
+    {
+        changedMask = NexaWatt_HalManager_Debounce_Step(&counter, 0xFFu);
+    }
+    NW_TEST_EXPECT(changedMask == 0x0Fu);
+    NW_TEST_EXPECT(counter.stableState == 0x0Fu);
+    NW_TEST_EXPECT(NexaWatt_HalManager_Debounce_Is_Settled(&counter) == nwTrue);
+}
+
+static void NexaWatt_Test_Debounce_Exti_Port(void)
+{
+    nwTestPortLevels[NW_TEST_EXTI_PORT] = 0x81u | (1u << NW_TEST_EXTI_PIN);
+    NW_TEST_EXPECT(NexaWatt_HalManager_Debounce_Init(NW_TEST_SAMPLE_PERIOD_US) == NW_DEBOUNCE_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_HalManager_Debounce_Add_Port(NW_TEST_EXTI_PORT, 1u << NW_TEST_EXTI_PIN, nwTrue,
+                                                         NexaWatt_Test_Debounce_Change_Handler, NULL) == NW_DEBOUNCE_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_HalManager_Debounce_Get_State(NW_TEST_EXTI_PORT) == (1u << NW_TEST_EXTI_PIN));
+    NW_TEST_EXPECT(NexaWatt_HalManager_Debounce_Add_Port(NW_TEST_EXTI_PORT, 0x01u, nwTrue, NULL, NULL) == NW_DEBOUNCE_BAD_PARAM);
+
+    // An idle port is not read
+    nwTestPortReadCnt = 0u;
+    nwTestEventCnt = 0u;
+    NexaWatt_Test_Debounce_Apply_Pattern("1111111111");
+    NW_TEST_EXPECT(nwTestPortReadCnt == 0u);
+
+    // Glitches shorter than the debounce time are filtered
+    NexaWatt_Test_Debounce_Apply_Pattern("0101001000111");
+    NW_TEST_EXPECT(nwTestEventCnt == 0u);
+    NW_TEST_EXPECT(NexaWatt_HalManager_Debounce_Get_State(NW_TEST_EXTI_PORT) == (1u << NW_TEST_EXTI_PIN));
+
+    // A press with contact bounce is a single change
+    NexaWatt_Test_Debounce_Apply_Pattern("0100101000000000");
+    NW_TEST_EXPECT(nwTestEventCnt == 1u);
+    NW_TEST_EXPECT(NW_DEBOUNCE_EVENT_GET_PORT(nwTestLastEventArg) == NW_TEST_EXTI_PORT);
+    NW_TEST_EXPECT(NW_DEBOUNCE_EVENT_GET_CHANGED(nwTestLastEventArg) == (1u << NW_TEST_EXTI_PIN));
+    NW_TEST_EXPECT(NW_DEBOUNCE_EVENT_GET_STATE(nwTestLastEventArg) == 0u);
+    NW_TEST_EXPECT(NexaWatt_HalManager_Debounce_Get_State(NW_TEST_EXTI_PORT) == 0u);
+
+    // Once the counter settled, the port is not read any more
+    nwTestPortReadCnt = 0u;
+    NexaWatt_Test_Debounce_Apply_Pattern("00000");
+    NW_TEST_EXPECT(nwTestPortReadCnt == 0u);
+
+    // The release with bounce is a single change
+    NexaWatt_Test_Debounce_Apply_Pattern("1101101111111");
+    NW_TEST_EXPECT(nwTestEventCnt == 2u);
+    NW_TEST_EXPECT(NW_DEBOUNCE_EVENT_GET_STATE(nwTestLastEventArg) == (1u << NW_TEST_EXTI_PIN));
+
+    // No sampling before the sample period elapsed
+    nwTestPortLevels[NW_TEST_EXTI_PORT] = 0x00u;
+    NexaWatt_HalManager_Debounce_Notify_Edge(NW_TEST_EXTI_PORT, NW_TEST_EXTI_PIN);
+    nwTestPortReadCnt = 0u;
+    nwTestTimeUs += NW_TEST_SAMPLE_PERIOD_US - 1u;
+    NW_TEST_EXPECT(NexaWatt_HalManager_Debounce_Process() == 0u);
+    NW_TEST_EXPECT(nwTestPortReadCnt == 0u);
+}
+
+static void NexaWatt_Test_Debounce_Polled_Port(void)
+{
+    static const uint8 polledLevels[10u] = { 0xFFu, 0x0Fu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xF0u, 0xF0u, 0xF0u, 0xF0u };
+    static const uint8 expectedStates[10u] = { 0x00u, 0x00u, 0x00u, 0x0Fu, 0x0Fu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xF0u };
+    uint8 sampleIdx = 0u;
+    uint32 mismatchCnt = 0u;
+
+    nwTestPortLevels[NW_TEST_POLLED_PORT] = 0x00u;
+    NW_TEST_EXPECT(NexaWatt_HalManager_Debounce_Init(NW_TEST_SAMPLE_PERIOD_US) == NW_DEBOUNCE_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_HalManager_Debounce_Add_Port(NW_TEST_POLLED_PORT, 0xFFu, nwFalse,
+                                                         NexaWatt_Test_Debounce_Change_Handler, NULL) == NW_DEBOUNCE_SUCCESS);
+
+    // The pins are debounced independently by one pass per sample period
+    nwTestPortReadCnt = 0u;
+    nwTestEventCnt = 0u;
+    for (sampleIdx = 0u; sampleIdx < 10u; sampleIdx++)
+    {
+        nwTestPortLevels[NW_TEST_POLLED_PORT] = polledLevels[sampleIdx];
+        nwTestTimeUs += NW_TEST_SAMPLE_PERIOD_US;
+        (void)NexaWatt_HalManager_Debounce_Process();
+        if (NexaWatt_HalManager_Debounce_Get_State(NW_TEST_POLLED_PORT) != expectedStates[sampleIdx])
+        {
+            mismatchCnt++;
+        }
+    }
+    NW_TEST_EXPECT(mismatchCnt == 0u);
+    NW_TEST_EXPECT(nwTestEventCnt == 3u);
+    NW_TEST_EXPECT(nwTestPortReadCnt == 10u);
+    NW_TEST_EXPECT(NW_DEBOUNCE_EVENT_GET_CHANGED(nwTestLastEventArg) == 0x0Fu);
+}
+
+static uint32 NexaWatt_Test_Debounce_Random(void)
+{
+    nwTestRandomState = (nwTestRandomState * 1664525u) + 1013904223u;
+
+    return nwTestRandomState;
+}
+
+static void NexaWatt_Test_Debounce_Change_Handler(void* const eventContext, const uint32 eventArg)
+{
+    (void)eventContext;
+
+    nwTestEventCnt++;
+    nwTestLastEventArg = eventArg;
+}
+
+static void NexaWatt_Test_Debounce_Apply_Pattern(const char* const pinLevels)
+{
+    const uint8 pinMask = (uint8)(1u << NW_TEST_EXTI_PIN);
+    uint8 pinLevel = 0u;
+    uint32 sampleIdx = 0u;
+
+    for (sampleIdx = 0u; pinLevels[sampleIdx] != '\0'; sampleIdx++)
+    {
+        pinLevel = (pinLevels[sampleIdx] == '1') ? pinMask : 0u;
+        if ((nwTestPortLevels[NW_TEST_EXTI_PORT] & pinMask) != pinLevel)
+        {
+            nwTestPortLevels[NW_TEST_EXTI_PORT] ^= pinMask;
+            NexaWatt_HalManager_Debounce_Notify_Edge(NW_TEST_EXTI_PORT, NW_TEST_EXTI_PIN);
+        }
+
+        nwTestTimeUs += NW_TEST_SAMPLE_PERIOD_US;
+        (void)NexaWatt_HalManager_Debounce_Process();
+    }
+}
@@ -0,0 +1,293 @@
+/*******************************************************************************
+* File Name:   test_fra.c
+*
+* Description: This is the source file containing the host test,
+* related to the frequency response analyzer of the NexaWatt-IV.DC framework.
+* A sweep is executed against a simulated first-order discrete plant, in open loop
+* and as loop gain measurement of an integral controller closing the loop around
+* the plant. The measured gains and phases are compared with the analytic frequency
+* response. The deferred point calculations are executed by a minimal event queue.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <math.h>
+#include "test_host.h"
+#include "diag_fra.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define NW_TEST_PI                          (3.14159265358979323846)
+#define NW_TEST_SAMPLE_FREQ_HZ              (100000u)
+#define NW_TEST_POINT_CNT                   (9u)
+#define NW_TEST_EVENT_QUEUE_LEN             (8u)
+
+/**
+ * \brief Simulated plant y[n+1] = a * y[n] + (1 - a) * u[n], with the pole a, and the gain of the integral controller.
+ */
+#define NW_TEST_PLANT_POLE                  (0.95)
+#define NW_TEST_OPERATING_POINT             (0.3)
+#define NW_TEST_CONTROLLER_KI               (0.05)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+static const uint32 nwTestFrequenciesHz[NW_TEST_POINT_CNT] = { 50u, 100u, 200u, 500u, 1000u, 2000u, 5000u, 10000u, 20000u };
+
+static NexaWattFra nwTestFra;
+
+static NwMiniOsEventHandler nwTestEventHandlers[NW_TEST_EVENT_QUEUE_LEN];
+static void* nwTestEventContexts[NW_TEST_EVENT_QUEUE_LEN];
+static uint32 nwTestEventArgs[NW_TEST_EVENT_QUEUE_LEN];
+static uint8 nwTestEventCnt = 0u;
+
+static uint32 nwTestDoneCnt = 0u;
+static uint32 nwTestDoneArg = 0u;
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that executes the queued events, including the events posted by them.
+ */
+static void NexaWatt_Test_Fra_Dispatch(void);
+
+/**
+ * \brief Handler of the completion event of the test: counts the events and keeps the number of points.
+ * \param eventContext - Not used.
+ * \param eventArg - The number of measured points.
+ */
+static void NexaWatt_Test_Fra_Done_Handler(void* eventContext, uint32 eventArg);
+
+/**
+ * \brief Simple helper function that calculates the frequency response of the plant.
+ * \param frequencyHz - The frequency.
+ * \param gain - A pointer to the gain.
+ * \param phaseDeg - A pointer to the phase in degrees.
+ */
+static void NexaWatt_Test_Fra_Plant_Response(uint32 frequencyHz, double* gain, double* phaseDeg);
+
+/**
+ * \brief Simple helper function that compares the measured points with a response, shifted by a gain factor and a phase.
+ * The integral controller adds the gain ki / (2 * sin(w / 2)) and the phase w / 2 - 90 degrees.
+ * Outside of the band the points are only printed, since the excitation or the response is a few LSB.
+ * \param withController - nwTrue, if the response contains the integral controller.
+ * \param minFrequencyHz - The lowest compared frequency.
+ * \param maxFrequencyHz - The highest compared frequency.
+ * \param maxGainError - The largest accepted relative gain error.
+ * \param maxPhaseError - The largest accepted phase error in degrees.
+ */
+static void NexaWatt_Test_Fra_Expect_Response(nw_bool withController, uint32 minFrequencyHz, uint32 maxFrequencyHz, double maxGainError, double maxPhaseError);
+
+static void NexaWatt_Test_Fra_Open_Loop(void);
+static void NexaWatt_Test_Fra_Loop_Gain(void);
+static void NexaWatt_Test_Fra_Sweep_Control(void);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattMiniOsStatusResult NexaWatt_MiniOs_Event_Post(const NwMiniOsEventHandler eventHandler, void* const eventContext, const uint32 eventArg)
+{
+    NexaWattMiniOsStatusResult retRes = NW_MINI_OS_QUEUE_FULL;
+
+    if (nwTestEventCnt < NW_TEST_EVENT_QUEUE_LEN)
+    {
+        nwTestEventHandlers[nwTestEventCnt] = eventHandler;
+        nwTestEventContexts[nwTestEventCnt] = eventContext;
+        nwTestEventArgs[nwTestEventCnt] = eventArg;
+        nwTestEventCnt++;
+        retRes = NW_MINI_OS_SUCCESS;
+    }
+
+    return retRes;
+}
+
+int main(void)
+{
+    NexaWatt_Test_Fra_Open_Loop();
+    NexaWatt_Test_Fra_Loop_Gain();
+    NexaWatt_Test_Fra_Sweep_Control();
+
+    return NexaWatt_Test_Result("fra");
+}
+
+static void NexaWatt_Test_Fra_Open_Loop(void)
+{
+    NexaWattFraConfig fraConfig;
+    double plantOutput = NW_TEST_OPERATING_POINT;
+    double plantInput = 0.0;
+    double previousInput = NW_TEST_OPERATING_POINT;
+
+    fraConfig.sampleFreqHz = NW_TEST_SAMPLE_FREQ_HZ;
+    fraConfig.frequenciesHz = nwTestFrequenciesHz;
+    fraConfig.pointCnt = NW_TEST_POINT_CNT;
+    fraConfig.amplitude = NW_Q15_CONST(0.02);
+    fraConfig.settleCycles = 5u;
+    fraConfig.measureCycles = 10u;
+    fraConfig.injectionOutput = 0u;
+    fraConfig.doneHandler = NexaWatt_Test_Fra_Done_Handler;
+    fraConfig.doneContext = NULL;
+    NW_TEST_EXPECT(NexaWatt_Diag_Fra_Init(&nwTestFra, &fraConfig) == NW_FRA_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_Diag_Fra_Get_Perturbation(&nwTestFra) == 0);
+
+    // The perturbation is injected at the plant input, the plant output is the response
+    NW_TEST_EXPECT(NexaWatt_Diag_Fra_Start(&nwTestFra) == NW_FRA_SUCCESS);
+    while (NexaWatt_Diag_Fra_Get_State(&nwTestFra) != NW_FRA_STATE_DONE)
+    {
+        plantInput = NW_TEST_OPERATING_POINT + ((double)NexaWatt_Diag_Fra_Get_Perturbation(&nwTestFra) / (double)NW_Q15_ONE);
+        plantOutput = (NW_TEST_PLANT_POLE * plantOutput) + ((1.0 - NW_TEST_PLANT_POLE) * previousInput);
+        previousInput = plantInput;
+        NexaWatt_Diag_Fra_Step(&nwTestFra, (NwQ15)lround(plantInput * (double)NW_Q15_ONE), (NwQ15)lround(plantOutput * (double)NW_Q15_ONE));
+        NexaWatt_Test_Fra_Dispatch();
+    }
+    NexaWatt_Test_Fra_Dispatch();
+
+    NW_TEST_EXPECT(nwTestDoneCnt == 1u);
+    NW_TEST_EXPECT(nwTestDoneArg == NW_TEST_POINT_CNT);
+    // Above a twentieth of the sampling frequency the response falls to a few percent of the excitation
+    NexaWatt_Test_Fra_Expect_Response(nwFalse, 50u, 5000u, 0.005, 0.25);
+}
+
+static void NexaWatt_Test_Fra_Loop_Gain(void)
+{
+    NexaWattPipelineSignals signals;
+    double plantOutput = NW_TEST_OPERATING_POINT;
+    double previousInput = NW_TEST_OPERATING_POINT;
+    double integrator = NW_TEST_OPERATING_POINT;
+    nw_bool isChained = nwTrue;
+
+    // The analyzer is a control stage after the controller and measures the loop gain at its output
+    nwTestDoneCnt = 0u;
+    signals.samples = NULL;
+    signals.sampleCnt = 0u;
+    NW_TEST_EXPECT(NexaWatt_Diag_Fra_Start(&nwTestFra) == NW_FRA_SUCCESS);
+    while (NexaWatt_Diag_Fra_Get_State(&nwTestFra) != NW_FRA_STATE_DONE)
+    {
+        plantOutput = (NW_TEST_PLANT_POLE * plantOutput) + ((1.0 - NW_TEST_PLANT_POLE) * previousInput);
+        integrator += NW_TEST_CONTROLLER_KI * (NW_TEST_OPERATING_POINT - plantOutput);
+        signals.outputs[0u] = (NwQ15)lround(integrator * (double)NW_Q15_ONE);
+        isChained = (isChained == nwTrue) ? NexaWatt_Diag_Fra_Pipeline_Stage(&nwTestFra, &signals) : nwFalse;
+        previousInput = (double)signals.outputs[0u] / (double)NW_Q15_ONE;
+        NexaWatt_Test_Fra_Dispatch();
+    }
+    NexaWatt_Test_Fra_Dispatch();
+
+    NW_TEST_EXPECT(isChained == nwTrue);
+    NW_TEST_EXPECT(nwTestDoneCnt == 1u);
+    // The excitation is a few LSB where the loop gain is far above 1, the response where it is far below 1
+    NexaWatt_Test_Fra_Expect_Response(nwTrue, 200u, 2000u, 0.01, 0.25);
+}
+
+static void NexaWatt_Test_Fra_Sweep_Control(void)
+{
+    NexaWattFraConfig fraConfig;
+    NexaWattFraPoint point;
+    uint32 invalidFrequencies[1u] = { NW_TEST_SAMPLE_FREQ_HZ / 2u };
+
+    // A running sweep cannot be restarted and has no results
+    NW_TEST_EXPECT(NexaWatt_Diag_Fra_Start(&nwTestFra) == NW_FRA_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_Diag_Fra_Start(&nwTestFra) == NW_FRA_BUSY);
+    NexaWatt_Diag_Fra_Step(&nwTestFra, 0, 0);
+    NW_TEST_EXPECT(NexaWatt_Diag_Fra_Get_Perturbation(&nwTestFra) != 0);
+    NW_TEST_EXPECT(NexaWatt_Diag_Fra_Get_Point(&nwTestFra, 0u, &point) == NW_FRA_BUSY);
+
+    // The perturbation is removed with the stop and is not injected in the following periods
+    NW_TEST_EXPECT(NexaWatt_Diag_Fra_Stop(&nwTestFra) == NW_FRA_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_Diag_Fra_Get_Perturbation(&nwTestFra) == 0);
+    NexaWatt_Diag_Fra_Step(&nwTestFra, 0, 0);
+    NW_TEST_EXPECT(NexaWatt_Diag_Fra_Get_Perturbation(&nwTestFra) == 0);
+    NW_TEST_EXPECT(NexaWatt_Diag_Fra_Get_State(&nwTestFra) == NW_FRA_STATE_IDLE);
+    NW_TEST_EXPECT(NexaWatt_Diag_Fra_Get_Point(&nwTestFra, NW_TEST_POINT_CNT, &point) == NW_FRA_BAD_PARAM);
+
+    // Frequencies from the Nyquist frequency on cannot be measured
+    fraConfig.sampleFreqHz = NW_TEST_SAMPLE_FREQ_HZ;
+    fraConfig.frequenciesHz = invalidFrequencies;
+    fraConfig.pointCnt = 1u;
+    fraConfig.amplitude = NW_Q15_CONST(0.02);
+    fraConfig.settleCycles = 5u;
+    fraConfig.measureCycles = 10u;
+    fraConfig.injectionOutput = 0u;
+    fraConfig.doneHandler = NULL;
+    fraConfig.doneContext = NULL;
+    NW_TEST_EXPECT(NexaWatt_Diag_Fra_Init(&nwTestFra, &fraConfig) == NW_FRA_BAD_PARAM);
+    invalidFrequencies[0u] = 0u;
+    NW_TEST_EXPECT(NexaWatt_Diag_Fra_Init(&nwTestFra, &fraConfig) == NW_FRA_BAD_PARAM);
+    invalidFrequencies[0u] = 1000u;
+    fraConfig.amplitude = 0;
+    NW_TEST_EXPECT(NexaWatt_Diag_Fra_Init(&nwTestFra, &fraConfig) == NW_FRA_BAD_PARAM);
+    fraConfig.amplitude = NW_Q15_CONST(0.02);
+    NW_TEST_EXPECT(NexaWatt_Diag_Fra_Init(&nwTestFra, &fraConfig) == NW_FRA_SUCCESS);
+}
+
+static void NexaWatt_Test_Fra_Dispatch(void)
+{
+    uint8 eventIdx = 0u;
+
+    for (eventIdx = 0u; eventIdx < nwTestEventCnt; eventIdx++)
+    {
+        nwTestEventHandlers[eventIdx](nwTestEventContexts[eventIdx], nwTestEventArgs[eventIdx]);
+    }
+    nwTestEventCnt = 0u;
+}
+
+static void NexaWatt_Test_Fra_Done_Handler(void* const eventContext, const uint32 eventArg)
+{
+    (void)eventContext;
+
+    nwTestDoneCnt++;
+    nwTestDoneArg = eventArg;
+}
+
+static void NexaWatt_Test_Fra_Plant_Response(const uint32 frequencyHz, double* const gain, double* const phaseDeg)
+{
+    const double omega = (2.0 * NW_TEST_PI * (double)frequencyHz) / (double)NW_TEST_SAMPLE_FREQ_HZ;
+
+    // (1 - a) * z^-1 / (1 - a * z^-1) at z = e^(j * omega)
+    *gain = (1.0 - NW_TEST_PLANT_POLE) / sqrt(1.0 - (2.0 * NW_TEST_PLANT_POLE * cos(omega)) + (NW_TEST_PLANT_POLE * NW_TEST_PLANT_POLE));
+    *phaseDeg = (-omega - atan2(NW_TEST_PLANT_POLE * sin(omega), 1.0 - (NW_TEST_PLANT_POLE * cos(omega)))) * (180.0 / NW_TEST_PI);
+}
+
+static void NexaWatt_Test_Fra_Expect_Response(const nw_bool withController, const uint32 minFrequencyHz, const uint32 maxFrequencyHz, const double maxGainError, const double maxPhaseError)
+{
+    NexaWattFraPoint point;
+    double omega = 0.0;
+    double gain = 0.0;
+    double phaseDeg = 0.0;
+    double phaseError = 0.0;
+    uint8 pointIdx = 0u;
+
+    for (pointIdx = 0u; pointIdx < NW_TEST_POINT_CNT; pointIdx++)
+    {
+        NW_TEST_EXPECT(NexaWatt_Diag_Fra_Get_Point(&nwTestFra, pointIdx, &point) == NW_FRA_SUCCESS);
+        NW_TEST_EXPECT(point.isValid == nwTrue);
+        NW_TEST_EXPECT(point.frequencyHz == nwTestFrequenciesHz[pointIdx]);
+
+        NexaWatt_Test_Fra_Plant_Response(point.frequencyHz, &gain, &phaseDeg);
+        if (withController == nwTrue)
+        {
+            omega = (2.0 * NW_TEST_PI * (double)point.frequencyHz) / (double)NW_TEST_SAMPLE_FREQ_HZ;
+            gain *= NW_TEST_CONTROLLER_KI / (2.0 * sin(omega / 2.0));
+            phaseDeg += ((omega / 2.0) * (180.0 / NW_TEST_PI)) - 90.0;
+        }
+
+        // The phase is compared modulo a full turn
+        phaseError = fmod(((double)point.phaseCentiDeg / 100.0) - phaseDeg + 540.0, 360.0) - 180.0;
+        printf("fra: %5lu Hz gain %.5f (%.5f) phase %8.2f (%8.2f)\n", (unsigned long)point.frequencyHz,
+               (double)point.gain / (double)NW_Q16_ONE, gain, (double)point.phaseCentiDeg / 100.0, phaseDeg);
+        if ((point.frequencyHz >= minFrequencyHz) &&
+            (point.frequencyHz <= maxFrequencyHz))
+        {
+            NW_TEST_EXPECT(fabs((((double)point.gain / (double)NW_Q16_ONE) / gain) - 1.0) < maxGainError);
+            NW_TEST_EXPECT(fabs(phaseError) < maxPhaseError);
+        }
+    }
+}
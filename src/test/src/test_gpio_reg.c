@@ -0,0 +1,322 @@
+/*******************************************************************************
+* File Name:   test_gpio_reg.c
+*
+* Description: This is the source file containing the host test,
+* related to the register level GPIO backend of the Infineon CAT1B HAL implementation
+* of the NexaWatt-IV.DC framework. The backend and the PDL path of the CAT1B GPIO HAL
+* are executed side by side on two banks of fake GPIO_PRT_Type register blocks. The PDL
+* path is a transcription of the inline pin functions of cy_gpio.h, as the PDL is not
+* available on the host. Both banks are compared after every operation of a pseudo
+* random sequence, while a simple port model applies the set, clear, invert and
+* write-1-to-clear semantics of the registers.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "test_host.h"
+#include "platform_types.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define NW_TEST_PORT_CNT                    (4u)
+#define NW_TEST_PIN_CNT                     (8u)
+#define NW_TEST_OPERATION_CNT               (20000u)
+
+/**
+ * \brief Register accessors and masks of cy_gpio.h, used by the PDL path.
+ */
+#define GPIO_PRT_OUT_CLR(base)              (((GPIO_PRT_Type*)(base))->OUT_CLR)
+#define GPIO_PRT_OUT_SET(base)              (((GPIO_PRT_Type*)(base))->OUT_SET)
+#define GPIO_PRT_OUT_INV(base)              (((GPIO_PRT_Type*)(base))->OUT_INV)
+#define GPIO_PRT_IN(base)                   (((GPIO_PRT_Type*)(base))->IN)
+#define GPIO_PRT_INTR(base)                 (((GPIO_PRT_Type*)(base))->INTR)
+#define CY_GPIO_IN_MASK                     (0x01UL)
+#define CY_GPIO_OUT_MASK                    (0x01UL)
+#define CY_GPIO_INTR_STATUS_MASK            (0x01UL)
+
+/**
+ * \brief The backend accesses the fake register blocks instead of the GPIO peripheral.
+ */
+#define NW_HAL_INFINEON_CAT1B_GPIO_REG_PORT_BASE(portNum) \
+    (&nwTestRegPorts[portNum])
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+/**
+ * \brief Fake register block of a GPIO port, containing the registers used by the pin access functions.
+ */
+typedef struct
+{
+    volatile uint32 OUT;
+    volatile uint32 OUT_CLR;
+    volatile uint32 OUT_SET;
+    volatile uint32 OUT_INV;
+    volatile uint32 IN;
+    volatile uint32 INTR;
+} GPIO_PRT_Type;
+
+typedef enum eNexaWattTestGpioOperation
+{
+    NW_TEST_GPIO_PIN_READ       = 0u,
+    NW_TEST_GPIO_PORT_READ      = 1u,
+    NW_TEST_GPIO_PIN_WRITE      = 2u,
+    NW_TEST_GPIO_PORT_WRITE     = 3u,
+    NW_TEST_GPIO_PIN_TOGGLE     = 4u,
+    NW_TEST_GPIO_GET_EXTI       = 5u,
+    NW_TEST_GPIO_CLEAR_EXTI     = 6u,
+    NW_TEST_GPIO_OPERATION_CNT  = 7u,
+} NexaWattTestGpioOperation;
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+static GPIO_PRT_Type nwTestRegPorts[NW_TEST_PORT_CNT];
+static GPIO_PRT_Type nwTestPdlPorts[NW_TEST_PORT_CNT];
+static uint32 nwTestRandomState = 0x12345678u;
+
+// The backend is included after the fake register blocks, which its inline functions access
+#include "hal_infineon_cat1b_gpio_reg.h"
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief PDL path: transcriptions of Cy_GPIO_Read, Cy_GPIO_Write, Cy_GPIO_Inv, Cy_GPIO_GetInterruptStatus and Cy_GPIO_ClearInterrupt.
+ */
+static uint32 NexaWatt_Test_Gpio_Reg_Pdl_Read(GPIO_PRT_Type* base, uint32 pinNum);
+static void NexaWatt_Test_Gpio_Reg_Pdl_Write(GPIO_PRT_Type* base, uint32 pinNum, uint32 value);
+static void NexaWatt_Test_Gpio_Reg_Pdl_Inv(GPIO_PRT_Type* base, uint32 pinNum);
+static uint32 NexaWatt_Test_Gpio_Reg_Pdl_Get_Interrupt_Status(GPIO_PRT_Type* base, uint32 pinNum);
+static void NexaWatt_Test_Gpio_Reg_Pdl_Clear_Interrupt(GPIO_PRT_Type* base, uint32 pinNum);
+
+/**
+ * \brief Simple helper function that returns the next value of a linear congruential pseudo random sequence.
+ * \return The pseudo random value.
+ */
+static uint32 NexaWatt_Test_Gpio_Reg_Random(void);
+
+/**
+ * \brief Simple helper function that applies the register semantics of the port after an operation:
+ * the written OUT_SET, OUT_CLR and OUT_INV masks change OUT and the INTR write clears the written pending bits.
+ * \param port - A pointer to the fake register block.
+ * \param pendingIntr - The pending interrupts before the operation.
+ * \param intrWritten - nwTrue, if the operation wrote the INTR register.
+ */
+static void NexaWatt_Test_Gpio_Reg_Update_Port(GPIO_PRT_Type* port, uint32 pendingIntr, nw_bool intrWritten);
+
+/**
+ * \brief Simple helper function that compares the register blocks of both banks.
+ * \param portNum - The number of the compared port.
+ * \return nwTrue - The register blocks are identical.
+ */
+static nw_bool NexaWatt_Test_Gpio_Reg_Ports_Equal(uint8 portNum);
+
+static void NexaWatt_Test_Gpio_Reg_Single_Access(void);
+static void NexaWatt_Test_Gpio_Reg_Pdl_Equivalence(void);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+int main(void)
+{
+    NexaWatt_Test_Gpio_Reg_Single_Access();
+    NexaWatt_Test_Gpio_Reg_Pdl_Equivalence();
+
+    return NexaWatt_Test_Result("gpio_reg");
+}
+
+static void NexaWatt_Test_Gpio_Reg_Single_Access(void)
+{
+    GPIO_PRT_Type* port = &nwTestRegPorts[2u];
+
+    // Every operation is a single store to the set, clear or invert register, the output is never read back
+    port->OUT = 0xA5u;
+    NexaWatt_Hal_Infineon_Cat1B_Gpio_Reg_Pin_Write(2u, 6u, nwTrue);
+    NW_TEST_EXPECT((port->OUT_SET == 0x40u) && (port->OUT_CLR == 0u) && (port->OUT == 0xA5u));
+    NexaWatt_Hal_Infineon_Cat1B_Gpio_Reg_Pin_Write(2u, 0u, nwFalse);
+    NW_TEST_EXPECT((port->OUT_SET == 0x40u) && (port->OUT_CLR == 0x01u) && (port->OUT == 0xA5u));
+    NexaWatt_Hal_Infineon_Cat1B_Gpio_Reg_Pin_Toggle(2u, 7u);
+    NW_TEST_EXPECT((port->OUT_INV == 0x80u) && (port->OUT == 0xA5u));
+    NexaWatt_Hal_Infineon_Cat1B_Gpio_Reg_Port_Write(2u, 0x0Fu, nwFalse);
+    NW_TEST_EXPECT(port->OUT_CLR == 0x0Fu);
+
+    port->IN = 0x1F2u;
+    NW_TEST_EXPECT(NexaWatt_Hal_Infineon_Cat1B_Gpio_Reg_Port_Read(2u) == 0xF2u);
+    NW_TEST_EXPECT(NexaWatt_Hal_Infineon_Cat1B_Gpio_Reg_Pin_Read(2u, 1u) == nwTrue);
+    NW_TEST_EXPECT(NexaWatt_Hal_Infineon_Cat1B_Gpio_Reg_Pin_Read(2u, 2u) == nwFalse);
+
+    port->INTR = 0x24u;
+    NW_TEST_EXPECT(NexaWatt_Hal_Infineon_Cat1B_Gpio_Reg_Get_EXTI_Status(2u, 5u) == nwTrue);
+    NW_TEST_EXPECT(NexaWatt_Hal_Infineon_Cat1B_Gpio_Reg_Get_EXTI_Status(2u, 4u) == nwFalse);
+    NexaWatt_Hal_Infineon_Cat1B_Gpio_Reg_Clear_EXTI_Status(2u, 5u);
+    NW_TEST_EXPECT(port->INTR == 0x20u);
+
+    // The other ports are not accessed
+    NW_TEST_EXPECT((nwTestRegPorts[1u].OUT_SET == 0u) && (nwTestRegPorts[3u].OUT_CLR == 0u) && (nwTestRegPorts[3u].INTR == 0u));
+}
+
+static void NexaWatt_Test_Gpio_Reg_Pdl_Equivalence(void)
+{
+    NexaWattTestGpioOperation operation = NW_TEST_GPIO_PIN_READ;
+    uint32 pendingIntr[NW_TEST_PORT_CNT];
+    uint32 operationIdx = 0u;
+    uint32 mismatchCnt = 0u;
+    uint32 randomValue = 0u;
+    uint32 regResult = 0u;
+    uint32 pdlResult = 0u;
+    uint8 portNum = 0u;
+    uint8 pinNum = 0u;
+    uint8 pinMask = 0u;
+    nw_bool value = nwFalse;
+
+    for (portNum = 0u; portNum < NW_TEST_PORT_CNT; portNum++)
+    {
+        nwTestRegPorts[portNum] = nwTestPdlPorts[portNum];
+        pendingIntr[portNum] = 0u;
+    }
+
+    for (operationIdx = 0u; operationIdx < NW_TEST_OPERATION_CNT; operationIdx++)
+    {
+        randomValue = NexaWatt_Test_Gpio_Reg_Random();
+        operation = (NexaWattTestGpioOperation)((randomValue >> 8u) % (uint32)NW_TEST_GPIO_OPERATION_CNT);
+        portNum = (uint8)((randomValue >> 16u) % NW_TEST_PORT_CNT);
+        pinNum = (uint8)((randomValue >> 20u) % NW_TEST_PIN_CNT);
+        value = (((randomValue >> 24u) & 0x01u) != 0u) ? nwTrue : nwFalse;
+        pinMask = (uint8)(randomValue >> 25u);
+
+        // New input levels and interrupts arrive on both banks
+        randomValue = NexaWatt_Test_Gpio_Reg_Random();
+        pendingIntr[portNum] |= (randomValue >> 24u) & (randomValue >> 16u);
+        nwTestRegPorts[portNum].IN = randomValue >> 8u;
+        nwTestPdlPorts[portNum].IN = randomValue >> 8u;
+        nwTestRegPorts[portNum].INTR = pendingIntr[portNum];
+        nwTestPdlPorts[portNum].INTR = pendingIntr[portNum];
+        regResult = 0u;
+        pdlResult = 0u;
+
+        switch (operation)
+        {
+            case NW_TEST_GPIO_PIN_READ:
+                regResult = (uint32)NexaWatt_Hal_Infineon_Cat1B_Gpio_Reg_Pin_Read(portNum, pinNum);
+                pdlResult = NexaWatt_Test_Gpio_Reg_Pdl_Read(&nwTestPdlPorts[portNum], pinNum);
+                break;
+            case NW_TEST_GPIO_PORT_READ:
+                regResult = NexaWatt_Hal_Infineon_Cat1B_Gpio_Reg_Port_Read(portNum);
+                pdlResult = (uint8)GPIO_PRT_IN(&nwTestPdlPorts[portNum]);
+                break;
+            case NW_TEST_GPIO_PIN_WRITE:
+                NexaWatt_Hal_Infineon_Cat1B_Gpio_Reg_Pin_Write(portNum, pinNum, value);
+                NexaWatt_Test_Gpio_Reg_Pdl_Write(&nwTestPdlPorts[portNum], pinNum, (uint32)value);
+                break;
+            case NW_TEST_GPIO_PORT_WRITE:
+                NexaWatt_Hal_Infineon_Cat1B_Gpio_Reg_Port_Write(portNum, pinMask, value);
+                if (value != nwFalse)
+                {
+                    GPIO_PRT_OUT_SET(&nwTestPdlPorts[portNum]) = (uint32)pinMask;
+                }
+                else
+                {
+                    GPIO_PRT_OUT_CLR(&nwTestPdlPorts[portNum]) = (uint32)pinMask;
+                }
+                break;
+            case NW_TEST_GPIO_PIN_TOGGLE:
+                NexaWatt_Hal_Infineon_Cat1B_Gpio_Reg_Pin_Toggle(portNum, pinNum);
+                NexaWatt_Test_Gpio_Reg_Pdl_Inv(&nwTestPdlPorts[portNum], pinNum);
+                break;
+            case NW_TEST_GPIO_GET_EXTI:
+                regResult = (uint32)NexaWatt_Hal_Infineon_Cat1B_Gpio_Reg_Get_EXTI_Status(portNum, pinNum);
+                pdlResult = NexaWatt_Test_Gpio_Reg_Pdl_Get_Interrupt_Status(&nwTestPdlPorts[portNum], pinNum);
+                break;
+            case NW_TEST_GPIO_CLEAR_EXTI:
+                NexaWatt_Hal_Infineon_Cat1B_Gpio_Reg_Clear_EXTI_Status(portNum, pinNum);
+                NexaWatt_Test_Gpio_Reg_Pdl_Clear_Interrupt(&nwTestPdlPorts[portNum], pinNum);
+                break;
+            default:
+                break;
+        }
+
+        // Both paths write the same values to the same registers
+        if ((regResult != pdlResult) || (NexaWatt_Test_Gpio_Reg_Ports_Equal(portNum) == nwFalse))
+        {
+            mismatchCnt++;
+        }
+
+        NexaWatt_Test_Gpio_Reg_Update_Port(&nwTestRegPorts[portNum], pendingIntr[portNum], (operation == NW_TEST_GPIO_CLEAR_EXTI) ? nwTrue : nwFalse);
+        NexaWatt_Test_Gpio_Reg_Update_Port(&nwTestPdlPorts[portNum], pendingIntr[portNum], (operation == NW_TEST_GPIO_CLEAR_EXTI) ? nwTrue : nwFalse);
+        pendingIntr[portNum] = nwTestPdlPorts[portNum].INTR;
+        if (NexaWatt_Test_Gpio_Reg_Ports_Equal(portNum) == nwFalse)
+        {
+            mismatchCnt++;
+        }
+    }
+
+    NW_TEST_EXPECT(mismatchCnt == 0u);
+}
+
+static uint32 NexaWatt_Test_Gpio_Reg_Pdl_Read(GPIO_PRT_Type* const base, const uint32 pinNum)
+{
+    return (GPIO_PRT_IN(base) >> (pinNum)) & CY_GPIO_IN_MASK;
+}
+
+static void NexaWatt_Test_Gpio_Reg_Pdl_Write(GPIO_PRT_Type* const base, const uint32 pinNum, const uint32 value)
+{
+    if (0UL == value)
+    {
+        GPIO_PRT_OUT_CLR(base) = CY_GPIO_OUT_MASK << pinNum;
+    }
+    else
+    {
+        GPIO_PRT_OUT_SET(base) = CY_GPIO_OUT_MASK << pinNum;
+    }
+}
+
+static void NexaWatt_Test_Gpio_Reg_Pdl_Inv(GPIO_PRT_Type* const base, const uint32 pinNum)
+{
+    GPIO_PRT_OUT_INV(base) = CY_GPIO_OUT_MASK << pinNum;
+}
+
+static uint32 NexaWatt_Test_Gpio_Reg_Pdl_Get_Interrupt_Status(GPIO_PRT_Type* const base, const uint32 pinNum)
+{
+    return (GPIO_PRT_INTR(base) >> pinNum) & CY_GPIO_INTR_STATUS_MASK;
+}
+
+static void NexaWatt_Test_Gpio_Reg_Pdl_Clear_Interrupt(GPIO_PRT_Type* const base, const uint32 pinNum)
+{
+    GPIO_PRT_INTR(base) = CY_GPIO_INTR_STATUS_MASK << pinNum;
+    (void)GPIO_PRT_INTR(base);
+}
+
+static uint32 NexaWatt_Test_Gpio_Reg_Random(void)
+{
+    nwTestRandomState = (nwTestRandomState * 1664525u) + 1013904223u;
+
+    return nwTestRandomState;
+}
+
+static void NexaWatt_Test_Gpio_Reg_Update_Port(GPIO_PRT_Type* const port, const uint32 pendingIntr, const nw_bool intrWritten)
+{
+    port->OUT = ((port->OUT | port->OUT_SET) & ~port->OUT_CLR) ^ port->OUT_INV;
+    port->OUT_SET = 0u;
+    port->OUT_CLR = 0u;
+    port->OUT_INV = 0u;
+    port->INTR = (intrWritten == nwTrue) ? (pendingIntr & ~port->INTR) : pendingIntr;
+}
+
+static nw_bool NexaWatt_Test_Gpio_Reg_Ports_Equal(const uint8 portNum)
+{
+    const GPIO_PRT_Type* regPort = &nwTestRegPorts[portNum];
+    const GPIO_PRT_Type* pdlPort = &nwTestPdlPorts[portNum];
+
+    return ((regPort->OUT == pdlPort->OUT) &&
+            (regPort->OUT_CLR == pdlPort->OUT_CLR) &&
+            (regPort->OUT_SET == pdlPort->OUT_SET) &&
+            (regPort->OUT_INV == pdlPort->OUT_INV) &&
+            (regPort->IN == pdlPort->IN) &&
+            (regPort->INTR == pdlPort->INTR)) ? nwTrue : nwFalse;
+}
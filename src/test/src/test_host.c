@@ -0,0 +1,53 @@
+/*******************************************************************************
+* File Name:   test_host.c
+*
+* Description: This is the source file containing definitions,
+* related to the host tests of the NexaWatt-IV.DC framework.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "test_host.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+static uint32 nwTestExpectationCnt = 0u;
+static uint32 nwTestFailureCnt = 0u;
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+void NexaWatt_Test_Expect(const nw_bool isMet, const char* const expression, const char* const file, const int line)
+{
+    nwTestExpectationCnt++;
+
+    if (isMet == nwFalse)
+    {
+        nwTestFailureCnt++;
+        printf("%s:%d: expectation failed: %s\n", file, line, expression);
+    }
+}
+
+int NexaWatt_Test_Result(const char* const testName)
+{
+    printf("%s: %lu expectations, %lu failed\n", testName, (unsigned long)nwTestExpectationCnt, (unsigned long)nwTestFailureCnt);
+
+    return (nwTestFailureCnt == 0u) ? 0 : 1;
+}
@@ -0,0 +1,265 @@
+/*******************************************************************************
+* File Name:   test_logging.c
+*
+* Description: This is the source file containing the host test,
+* related to the binary logger and its host decoder of the NexaWatt-IV.DC framework.
+* Records are logged on all channels in turn, until the ring of the ISR channel
+* overflows. The logger is drained in small chunks, the stream is fed to the decoder
+* in even smaller pieces, with corrupted bytes inserted between two records. The test
+* compares the decoded lines with the logged records, checks the merge of the channels
+* in the order of the time stamps, the drop reports and the resynchronization.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "test_host.h"
+#include "platform_fixed_point.h"
+#include "logging.h"
+#include "logging_decoder.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Number of logging rounds. A round logs on the control and the ISR channel, every third round on the main channel.
+ * The ISR channel (5 words per record) overflows after 51 rounds.
+ */
+#define NW_TEST_ROUNDS                      (60u)
+#define NW_TEST_MAX_LINES                   (3u * NW_TEST_ROUNDS)
+#define NW_TEST_LINE_LEN                    (96u)
+
+/**
+ * \brief Length of a drain chunk (a record with the maximum arguments) and of a piece fed to the decoder.
+ */
+#define NW_TEST_DRAIN_CHUNK_LEN             (NW_LOG_MAX_RECORD_WORDS * sizeof(uint32))
+#define NW_TEST_FEED_PIECE_LEN              (7u)
+
+/**
+ * \brief The chunk, before which the corrupted bytes are inserted.
+ */
+#define NW_TEST_CORRUPTED_CHUNK             (3u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+/**
+ * \brief Corrupted bytes: a header with a valid synchronization byte, but too many arguments, followed by a stray byte.
+ */
+static const uint8 nwTestCorruptedBytes[5u] = { 0x12u, 0x34u, 0x07u, NW_LOG_HEADER_SYNC, 0x5Au };
+
+static NexaWattLogger nwTestLogger;
+static NexaWattLogDecoder nwTestDecoder;
+
+static char nwTestExpectedLines[NW_TEST_MAX_LINES][NW_TEST_LINE_LEN + 16u];
+static uint32 nwTestExpectedCnt = 0u;
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that records the expected decoded line of a stored record.
+ * \param isStored - The result of the log call. A dropped record is not expected.
+ * \param channel - The channel of the record.
+ * \param text - The expected text of the record.
+ */
+static void NexaWatt_Test_Logging_Expect_Line(nw_bool isStored, uint8 channel, const char* text);
+
+/**
+ * \brief Simple helper function that feeds a chunk of the stream to the decoder in small pieces.
+ * \param stream - The chunk.
+ * \param streamLen - The length of the chunk in bytes.
+ */
+static void NexaWatt_Test_Logging_Feed(const uint8* stream, uint32 streamLen);
+
+static void NexaWatt_Test_Logging_Round_Trip(void);
+static void NexaWatt_Test_Logging_Format(void);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+int main(void)
+{
+    NexaWatt_Test_Logging_Round_Trip();
+    NexaWatt_Test_Logging_Format();
+
+    return NexaWatt_Test_Result("logging");
+}
+
+static void NexaWatt_Test_Logging_Round_Trip(void)
+{
+    FILE* const output = tmpfile();
+    uint8 stream[NW_TEST_DRAIN_CHUNK_LEN];
+    char text[NW_TEST_LINE_LEN];
+    char line[NW_TEST_LINE_LEN + 32u];
+    char decoded[sizeof(line) + 16u];
+    NexaWattLogStats logStats;
+    NexaWattLogDecoderStats decoderStats;
+    uint32 roundIdx = 0u;
+    uint32 chunkCnt = 0u;
+    uint32 streamLen = 0u;
+    uint32 lineIdx = 0u;
+    uint32 lineCnt = 0u;
+    uint32 reportCnt = 0u;
+    uint32 reportedDropCnt = 0u;
+    uint32 storedIsrCnt = 0u;
+    nw_bool isStored = nwFalse;
+    nw_bool isOrdered = nwTrue;
+    nw_bool isMatching = nwTrue;
+    double timeSec = 0.0;
+    double lastTimeSec = 0.0;
+    unsigned int channel = 0u;
+    unsigned int droppedChannel = 0u;
+    unsigned int droppedCnt = 0u;
+    int textPos = 0;
+
+    NW_TEST_EXPECT(output != NULL);
+    NW_TEST_EXPECT(NexaWatt_Logging_Init(&nwTestLogger) == NW_LOG_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_Logging_Decoder_Init(&nwTestDecoder, 100000000u, output) == NW_LOG_DECODER_SUCCESS);
+
+    // The channels are written in turn, so the merged stream must follow the order of the calls
+    for (roundIdx = 0u; roundIdx < NW_TEST_ROUNDS; roundIdx++)
+    {
+        isStored = NexaWatt_Logging_Log_2(&nwTestLogger, NW_LOG_CHANNEL_CONTROL, NW_LOG_MSG_CONTROL_TIMING, 100u + roundIdx, 900u);
+        (void)snprintf(text, sizeof(text), "control exec %u cycles, max 900 cycles", (unsigned int)(100u + roundIdx));
+        NexaWatt_Test_Logging_Expect_Line(isStored, NW_LOG_CHANNEL_CONTROL, text);
+
+        isStored = NexaWatt_Logging_Log_3(&nwTestLogger, NW_LOG_CHANNEL_ISR, NW_LOG_MSG_STATE_TRANSITION, roundIdx, roundIdx + 1u, 7u);
+        (void)snprintf(text, sizeof(text), "state %u -> %u on event 7", (unsigned int)roundIdx, (unsigned int)(roundIdx + 1u));
+        NexaWatt_Test_Logging_Expect_Line(isStored, NW_LOG_CHANNEL_ISR, text);
+        storedIsrCnt += (isStored == nwTrue) ? 1u : 0u;
+
+        if ((roundIdx % 3u) == 0u)
+        {
+            isStored = NexaWatt_Logging_Log_2(&nwTestLogger, NW_LOG_CHANNEL_MAIN, NW_LOG_MSG_SIGNAL, roundIdx, (uint32)NW_Q15_CONST(-0.25));
+            (void)snprintf(text, sizeof(text), "signal %u = -0.25000", (unsigned int)roundIdx);
+            NexaWatt_Test_Logging_Expect_Line(isStored, NW_LOG_CHANNEL_MAIN, text);
+        }
+    }
+    NW_TEST_EXPECT(storedIsrCnt == (NW_LOG_RING_WORDS / NW_LOG_RECORD_WORDS(3u)));
+
+    // Small chunks: a drain stops at the first record, which does not fit, and postpones the drop report
+    do
+    {
+        if (chunkCnt == NW_TEST_CORRUPTED_CHUNK)
+        {
+            NexaWatt_Test_Logging_Feed(nwTestCorruptedBytes, sizeof(nwTestCorruptedBytes));
+        }
+
+        streamLen = NexaWatt_Logging_Drain(&nwTestLogger, stream, sizeof(stream));
+        NexaWatt_Test_Logging_Feed(stream, streamLen);
+        chunkCnt++;
+    } while ((streamLen > 0u) && (chunkCnt < (2u * NW_TEST_MAX_LINES)));
+    NW_TEST_EXPECT(streamLen == 0u);
+    NW_TEST_EXPECT(NexaWatt_Logging_Drain(&nwTestLogger, stream, sizeof(stream)) == 0u);
+
+    // The decoded records must match the logged ones and the drop reports must account for every dropped record
+    rewind(output);
+    while (fgets(line, sizeof(line), output) != NULL)
+    {
+        line[strcspn(line, "\n")] = '\0';
+        textPos = 0;
+        if (sscanf(line, "[%lf] ch%u %n", &timeSec, &channel, &textPos) != 2)
+        {
+            isMatching = nwFalse;
+        }
+        else if (sscanf(&line[textPos], "channel %u dropped %u records", &droppedChannel, &droppedCnt) == 2)
+        {
+            NW_TEST_EXPECT((channel == NW_LOG_CHANNEL_ISR) && (droppedChannel == NW_LOG_CHANNEL_ISR));
+            reportCnt++;
+            reportedDropCnt += droppedCnt;
+        }
+        else
+        {
+            // The drop reports are stamped at the drain, the logged records keep the order of their time stamps
+            isOrdered = ((lineIdx == 0u) || (timeSec >= lastTimeSec)) ? isOrdered : nwFalse;
+            lastTimeSec = timeSec;
+
+            (void)snprintf(decoded, sizeof(decoded), "ch%u %s", channel, &line[textPos]);
+            if ((lineIdx >= nwTestExpectedCnt) ||
+                (strcmp(decoded, nwTestExpectedLines[lineIdx]) != 0))
+            {
+                printf("logging: line %u \"%s\", expected \"%s\"\n", (unsigned int)lineIdx, decoded,
+                       (lineIdx < nwTestExpectedCnt) ? nwTestExpectedLines[lineIdx] : "");
+                isMatching = nwFalse;
+            }
+            lineIdx++;
+        }
+        lineCnt++;
+    }
+    (void)fclose(output);
+
+    printf("logging: %u lines in %u chunks, %u records dropped in %u reports\n",
+           (unsigned int)lineCnt, (unsigned int)chunkCnt, (unsigned int)reportedDropCnt, (unsigned int)reportCnt);
+    NW_TEST_EXPECT(isMatching == nwTrue);
+    NW_TEST_EXPECT(isOrdered == nwTrue);
+    NW_TEST_EXPECT(lineIdx == nwTestExpectedCnt);
+    NW_TEST_EXPECT(reportCnt == 1u);
+    NW_TEST_EXPECT(reportedDropCnt == (NW_TEST_ROUNDS - storedIsrCnt));
+
+    NW_TEST_EXPECT(NexaWatt_Logging_Get_Stats(&nwTestLogger, NW_LOG_CHANNEL_ISR, &logStats) == NW_LOG_SUCCESS);
+    NW_TEST_EXPECT(logStats.droppedCnt == (NW_TEST_ROUNDS - storedIsrCnt));
+    NW_TEST_EXPECT(logStats.drainedCnt == (storedIsrCnt + 1u));
+    NW_TEST_EXPECT(logStats.maxPendingWords == (storedIsrCnt * NW_LOG_RECORD_WORDS(3u)));
+    NW_TEST_EXPECT(NexaWatt_Logging_Get_Stats(&nwTestLogger, NW_LOG_CHANNEL_CONTROL, &logStats) == NW_LOG_SUCCESS);
+    NW_TEST_EXPECT((logStats.droppedCnt == 0u) && (logStats.drainedCnt == NW_TEST_ROUNDS));
+
+    // The corrupted bytes are skipped one by one, until the next record header is found
+    NexaWatt_Logging_Decoder_Get_Stats(&nwTestDecoder, &decoderStats);
+    NW_TEST_EXPECT(decoderStats.recordCnt == lineCnt);
+    NW_TEST_EXPECT(decoderStats.recordCnt == (nwTestExpectedCnt + reportCnt));
+    NW_TEST_EXPECT(decoderStats.droppedCnt == reportedDropCnt);
+    NW_TEST_EXPECT(decoderStats.skippedByteCnt == sizeof(nwTestCorruptedBytes));
+    NW_TEST_EXPECT(decoderStats.unknownCnt == 0u);
+}
+
+static void NexaWatt_Test_Logging_Format(void)
+{
+    const uint32 args[2u] = { 0x2Au, 0xFFFFFFFFu };
+    char text[NW_TEST_LINE_LEN];
+
+    NW_TEST_EXPECT(NexaWatt_Logging_Decoder_Format(NW_LOG_MSG_WATCHDOG_LEVEL, args, 2u, text, sizeof(text)) == nwTrue);
+    NW_TEST_EXPECT(strcmp(text, "timing watchdog level 42, violations 0xffffffff") == 0);
+    NW_TEST_EXPECT(NexaWatt_Logging_Decoder_Format(NW_LOG_MSG_VALUE, &args[1u], 1u, text, sizeof(text)) == nwTrue);
+    NW_TEST_EXPECT(strcmp(text, "value -1") == 0);
+
+    // A missing argument is marked, an unknown message is printed raw
+    NW_TEST_EXPECT(NexaWatt_Logging_Decoder_Format(NW_LOG_MSG_VALUE, args, 0u, text, sizeof(text)) == nwTrue);
+    NW_TEST_EXPECT(strcmp(text, "value <missing>") == 0);
+    NW_TEST_EXPECT(NexaWatt_Logging_Decoder_Format(NW_LOG_MSG_CNT, args, 1u, text, sizeof(text)) == nwFalse);
+    NW_TEST_EXPECT(strncmp(text, "unknown message", 15u) == 0);
+
+    // The text is truncated to the buffer
+    NW_TEST_EXPECT(NexaWatt_Logging_Decoder_Format(NW_LOG_MSG_CONTROL_TIMING, args, 2u, text, 8u) == nwTrue);
+    NW_TEST_EXPECT(strcmp(text, "control") == 0);
+}
+
+static void NexaWatt_Test_Logging_Expect_Line(const nw_bool isStored, const uint8 channel, const char* const text)
+{
+    if ((isStored == nwTrue) &&
+        (nwTestExpectedCnt < NW_TEST_MAX_LINES))
+    {
+        (void)snprintf(nwTestExpectedLines[nwTestExpectedCnt], sizeof(nwTestExpectedLines[0u]), "ch%u %s", (unsigned int)channel, text);
+        nwTestExpectedCnt++;
+    }
+}
+
+static void NexaWatt_Test_Logging_Feed(const uint8* const stream, const uint32 streamLen)
+{
+    uint32 byteIdx = 0u;
+    uint32 pieceLen = 0u;
+
+    for (byteIdx = 0u; byteIdx < streamLen; byteIdx += pieceLen)
+    {
+        pieceLen = ((streamLen - byteIdx) < NW_TEST_FEED_PIECE_LEN) ? (streamLen - byteIdx) : NW_TEST_FEED_PIECE_LEN;
+        NW_TEST_EXPECT(NexaWatt_Logging_Decoder_Feed(&nwTestDecoder, &stream[byteIdx], pieceLen) == NW_LOG_DECODER_SUCCESS);
+    }
+}
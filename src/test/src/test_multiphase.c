@@ -0,0 +1,275 @@
+/*******************************************************************************
+* File Name:   test_multiphase.c
+*
+* Description: This is the source file containing the host test,
+* related to the interleaved multiphase operation of the Topology Manager of the
+* NexaWatt-IV.DC framework. The phases are simulated as parallel buck stages with
+* mismatched resistances, which share a common output voltage. An outer loop sets
+* the duty cycle command for the load current. The test checks the current balancing,
+* the phase shifts and the phase adding and shedding with hysteresis and dwell time.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <math.h>
+#include "test_host.h"
+#include "topology_multiphase.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define NW_TEST_PHASE_CNT                   (4u)
+#define NW_TEST_VOUT                        (0.4)
+#define NW_TEST_PHASE_LAG                   (0.2)
+#define NW_TEST_OUTER_KI                    (0.002)
+#define NW_TEST_DWELL_SAMPLES               (50u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+/**
+ * \brief Simulated power stage: the phase current follows (duty - vout) / resistance with a first-order lag,
+ * a shed phase carries no current. The outer loop integrates the error of the total current.
+ */
+typedef struct sNexaWattTestPhases
+{
+    double phaseCurrents[NW_TEST_PHASE_CNT];
+    double dutyCommand;
+    NwQ15 measuredCurrents[NW_TEST_PHASE_CNT];
+} NexaWattTestPhases;
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+static const double nwTestPhaseResistances[NW_TEST_PHASE_CNT] = { 0.08, 0.1, 0.12, 0.1 };
+
+static const NexaWattMultiphaseConfig nwTestMultiphaseConfig =
+{
+    NW_TEST_PHASE_CNT,          // phaseCnt
+    1u,                         // minActivePhases
+    NW_Q15_CONST(0.2),          // phaseCurrentNominal
+    NW_Q16_CONST(0.8),          // addLevel
+    NW_Q16_CONST(0.5),          // shedLevel
+    NW_TEST_DWELL_SAMPLES,      // dwellSamples
+    NW_Q16_CONST(0.02),         // balanceKp
+    NW_Q16_CONST(0.002),        // balanceKi
+    NW_Q15_CONST(0.05),         // trimLimit
+    NW_Q16_CONST(0.05),         // totalCurrentAlpha
+};
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that runs the multiphase operation and the simulated power stage.
+ * \param multiphase - A pointer to the multiphase instance.
+ * \param phases - A pointer to the simulated power stage.
+ * \param loadCurrent - The total load current.
+ * \param sampleCnt - The number of samples to run.
+ * \return The number of acknowledged phase transitions.
+ */
+static uint32 NexaWatt_Test_Multiphase_Run(NexaWattMultiphase* multiphase, NexaWattTestPhases* phases, double loadCurrent, uint32 sampleCnt);
+
+/**
+ * \brief Simple helper function that calculates the largest deviation of the active phase currents from their average.
+ * \param multiphase - A pointer to the multiphase instance.
+ * \param phases - A pointer to the simulated power stage.
+ * \return The largest deviation.
+ */
+static double NexaWatt_Test_Multiphase_Imbalance(const NexaWattMultiphase* multiphase, const NexaWattTestPhases* phases);
+
+/**
+ * \brief Simple helper function that initializes the multiphase operation and the simulated power stage.
+ * \param multiphase - A pointer to the multiphase instance.
+ * \param multiphaseConfig - A pointer to the configuration.
+ * \param phases - A pointer to the simulated power stage.
+ */
+static void NexaWatt_Test_Multiphase_Setup(NexaWattMultiphase* multiphase, const NexaWattMultiphaseConfig* multiphaseConfig, NexaWattTestPhases* phases);
+
+static void NexaWatt_Test_Multiphase_Balancing(void);
+static void NexaWatt_Test_Multiphase_Shedding(void);
+static void NexaWatt_Test_Multiphase_Hysteresis(void);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+int main(void)
+{
+    NexaWatt_Test_Multiphase_Balancing();
+    NexaWatt_Test_Multiphase_Shedding();
+    NexaWatt_Test_Multiphase_Hysteresis();
+
+    return NexaWatt_Test_Result("multiphase");
+}
+
+static void NexaWatt_Test_Multiphase_Balancing(void)
+{
+    NexaWattMultiphase multiphase;
+    NexaWattMultiphaseConfig multiphaseConfig = nwTestMultiphaseConfig;
+    NexaWattTestPhases phases;
+    const NwQ16* phaseShifts = NULL;
+    double unbalancedImbalance = 0.0;
+    double balancedImbalance = 0.0;
+
+    // Without balancing the resistances split the current unevenly
+    multiphaseConfig.balanceKp = 0;
+    multiphaseConfig.balanceKi = 0;
+    NexaWatt_Test_Multiphase_Setup(&multiphase, &multiphaseConfig, &phases);
+    NW_TEST_EXPECT(NexaWatt_Test_Multiphase_Run(&multiphase, &phases, 0.6, 5000u) == 0u);
+    unbalancedImbalance = NexaWatt_Test_Multiphase_Imbalance(&multiphase, &phases);
+
+    NexaWatt_Test_Multiphase_Setup(&multiphase, &nwTestMultiphaseConfig, &phases);
+    NW_TEST_EXPECT(NexaWatt_Test_Multiphase_Run(&multiphase, &phases, 0.6, 5000u) == 0u);
+    balancedImbalance = NexaWatt_Test_Multiphase_Imbalance(&multiphase, &phases);
+
+    printf("multiphase: imbalance %.4f without and %.4f with balancing\n", unbalancedImbalance, balancedImbalance);
+    NW_TEST_EXPECT(unbalancedImbalance > 0.02);
+    NW_TEST_EXPECT(balancedImbalance < 0.002);
+    NW_TEST_EXPECT(fabs(phases.phaseCurrents[0u] + phases.phaseCurrents[1u] + phases.phaseCurrents[2u] + phases.phaseCurrents[3u] - 0.6) < 0.005);
+
+    phaseShifts = NexaWatt_Topology_Multiphase_Get_Phase_Shifts(&multiphase);
+    NW_TEST_EXPECT(phaseShifts[0u] == 0);
+    NW_TEST_EXPECT(phaseShifts[1u] == NW_Q16_CONST(0.25));
+    NW_TEST_EXPECT(phaseShifts[2u] == NW_Q16_CONST(0.5));
+    NW_TEST_EXPECT(phaseShifts[3u] == NW_Q16_CONST(0.75));
+}
+
+static void NexaWatt_Test_Multiphase_Shedding(void)
+{
+    NexaWattMultiphase multiphase;
+    NexaWattTestPhases phases;
+    const NwQ16* phaseShifts = NULL;
+
+    NexaWatt_Test_Multiphase_Setup(&multiphase, &nwTestMultiphaseConfig, &phases);
+    NW_TEST_EXPECT(NexaWatt_Test_Multiphase_Run(&multiphase, &phases, 0.6, 2000u) == 0u);
+
+    // Light load: phases are shed while the remaining phases stay above the shedding level
+    NW_TEST_EXPECT(NexaWatt_Test_Multiphase_Run(&multiphase, &phases, 0.12, 5000u) == 2u);
+    NW_TEST_EXPECT(NexaWatt_Topology_Multiphase_Get_Active_Phase_Cnt(&multiphase) == 2u);
+    NW_TEST_EXPECT(multiphase.phaseDuty[2u] == 0);
+    NW_TEST_EXPECT(multiphase.phaseDuty[3u] == 0);
+    NW_TEST_EXPECT(phases.phaseCurrents[2u] == 0.0);
+    NW_TEST_EXPECT(phases.phaseCurrents[3u] == 0.0);
+    NW_TEST_EXPECT(NexaWatt_Test_Multiphase_Imbalance(&multiphase, &phases) < 0.002);
+
+    phaseShifts = NexaWatt_Topology_Multiphase_Get_Phase_Shifts(&multiphase);
+    NW_TEST_EXPECT(phaseShifts[0u] == 0);
+    NW_TEST_EXPECT(phaseShifts[1u] == NW_Q16_CONST(0.5));
+
+    // Heavy load: all phases are added again and take an equal share
+    NW_TEST_EXPECT(NexaWatt_Test_Multiphase_Run(&multiphase, &phases, 0.7, 5000u) == 2u);
+    NW_TEST_EXPECT(NexaWatt_Topology_Multiphase_Get_Active_Phase_Cnt(&multiphase) == NW_TEST_PHASE_CNT);
+    NW_TEST_EXPECT(NexaWatt_Test_Multiphase_Imbalance(&multiphase, &phases) < 0.002);
+    NW_TEST_EXPECT(multiphase.phaseTransitionCnt == 4u);
+}
+
+static void NexaWatt_Test_Multiphase_Hysteresis(void)
+{
+    NexaWattMultiphase multiphase;
+    NexaWattTestPhases phases;
+    uint32 stepIdx = 0u;
+    uint32 transitionCnt = 0u;
+
+    NexaWatt_Test_Multiphase_Setup(&multiphase, &nwTestMultiphaseConfig, &phases);
+    NW_TEST_EXPECT(NexaWatt_Test_Multiphase_Run(&multiphase, &phases, 0.15, 5000u) == 2u);
+    NW_TEST_EXPECT(NexaWatt_Topology_Multiphase_Get_Active_Phase_Cnt(&multiphase) == 2u);
+
+    // A load between the shedding and the adding level of two phases changes nothing
+    for (stepIdx = 0u; stepIdx < 20u; stepIdx++)
+    {
+        transitionCnt += NexaWatt_Test_Multiphase_Run(&multiphase, &phases, ((stepIdx & 1u) != 0u) ? 0.22 : 0.3, 500u);
+    }
+    NW_TEST_EXPECT(transitionCnt == 0u);
+    NW_TEST_EXPECT(NexaWatt_Topology_Multiphase_Get_Active_Phase_Cnt(&multiphase) == 2u);
+
+    // Load spikes shorter than the dwell time are ignored
+    for (stepIdx = 0u; stepIdx < 20u; stepIdx++)
+    {
+        transitionCnt += NexaWatt_Test_Multiphase_Run(&multiphase, &phases, 0.5, NW_TEST_DWELL_SAMPLES / 5u);
+        transitionCnt += NexaWatt_Test_Multiphase_Run(&multiphase, &phases, 0.25, 500u);
+    }
+    NW_TEST_EXPECT(transitionCnt == 0u);
+
+    // Just above the adding level: the added phase does not trigger an immediate shedding
+    NW_TEST_EXPECT(NexaWatt_Test_Multiphase_Run(&multiphase, &phases, 0.34, 5000u) == 1u);
+    NW_TEST_EXPECT(NexaWatt_Topology_Multiphase_Get_Active_Phase_Cnt(&multiphase) == 3u);
+    NW_TEST_EXPECT(NexaWatt_Test_Multiphase_Imbalance(&multiphase, &phases) < 0.002);
+}
+
+static void NexaWatt_Test_Multiphase_Setup(NexaWattMultiphase* const multiphase, const NexaWattMultiphaseConfig* const multiphaseConfig, NexaWattTestPhases* const phases)
+{
+    uint8 phaseIdx = 0u;
+
+    NW_TEST_EXPECT(NexaWatt_Topology_Multiphase_Init(multiphase, multiphaseConfig) == NW_MULTIPHASE_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_Topology_Multiphase_Ack_Phase_Change(multiphase) == nwTrue);
+    NW_TEST_EXPECT(NexaWatt_Topology_Multiphase_Get_Active_Phase_Cnt(multiphase) == NW_TEST_PHASE_CNT);
+
+    for (phaseIdx = 0u; phaseIdx < NW_TEST_PHASE_CNT; phaseIdx++)
+    {
+        phases->phaseCurrents[phaseIdx] = 0.0;
+        phases->measuredCurrents[phaseIdx] = 0;
+    }
+    phases->dutyCommand = NW_TEST_VOUT;
+}
+
+static uint32 NexaWatt_Test_Multiphase_Run(NexaWattMultiphase* const multiphase, NexaWattTestPhases* const phases, const double loadCurrent, const uint32 sampleCnt)
+{
+    const NwQ15* phaseDuty = NULL;
+    double totalCurrent = 0.0;
+    double targetCurrent = 0.0;
+    uint32 transitionCnt = 0u;
+    uint32 sampleIdx = 0u;
+    uint8 phaseIdx = 0u;
+
+    for (sampleIdx = 0u; sampleIdx < sampleCnt; sampleIdx++)
+    {
+        phaseDuty = NexaWatt_Topology_Multiphase_Step(multiphase, NW_Q15_CONST(phases->dutyCommand), phases->measuredCurrents);
+        if (NexaWatt_Topology_Multiphase_Ack_Phase_Change(multiphase) == nwTrue)
+        {
+            transitionCnt++;
+        }
+
+        totalCurrent = 0.0;
+        for (phaseIdx = 0u; phaseIdx < NW_TEST_PHASE_CNT; phaseIdx++)
+        {
+            if (phaseDuty[phaseIdx] == 0)
+            {
+                phases->phaseCurrents[phaseIdx] = 0.0;
+            }
+            else
+            {
+                targetCurrent = (((double)phaseDuty[phaseIdx] / (double)NW_Q15_ONE) - NW_TEST_VOUT) / nwTestPhaseResistances[phaseIdx];
+                phases->phaseCurrents[phaseIdx] += NW_TEST_PHASE_LAG * (targetCurrent - phases->phaseCurrents[phaseIdx]);
+            }
+            phases->measuredCurrents[phaseIdx] = NW_Q15_CONST(phases->phaseCurrents[phaseIdx]);
+            totalCurrent += phases->phaseCurrents[phaseIdx];
+        }
+
+        phases->dutyCommand += NW_TEST_OUTER_KI * (loadCurrent - totalCurrent);
+    }
+
+    return transitionCnt;
+}
+
+static double NexaWatt_Test_Multiphase_Imbalance(const NexaWattMultiphase* const multiphase, const NexaWattTestPhases* const phases)
+{
+    const uint8 activePhaseCnt = NexaWatt_Topology_Multiphase_Get_Active_Phase_Cnt(multiphase);
+    double averageCurrent = 0.0;
+    double imbalance = 0.0;
+    uint8 phaseIdx = 0u;
+
+    for (phaseIdx = 0u; phaseIdx < activePhaseCnt; phaseIdx++)
+    {
+        averageCurrent += phases->phaseCurrents[phaseIdx] / (double)activePhaseCnt;
+    }
+    for (phaseIdx = 0u; phaseIdx < activePhaseCnt; phaseIdx++)
+    {
+        imbalance = fmax(imbalance, fabs(phases->phaseCurrents[phaseIdx] - averageCurrent));
+    }
+
+    return imbalance;
+}
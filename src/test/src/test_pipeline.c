@@ -0,0 +1,146 @@
+/*******************************************************************************
+* File Name:   test_pipeline.c
+*
+* Description: This is the source file containing the host test,
+* related to the control pipeline and its stage adapters of the NexaWatt-IV.DC framework.
+* A pipeline of a scaling stage, a filter stage, a PID and an NPNZ control stage and an
+* actuation stage is executed on synthetic ADC frames. The test checks the filtered
+* measurement, the controller outputs and their clamping to the duty limits of the topology.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "test_host.h"
+#include "digital_controller_pipeline.h"
+#include "filtering_iir.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define NW_TEST_CYCLE_BUDGET                (100000u)
+#define NW_TEST_PID_OUTPUT                  (0u)
+#define NW_TEST_NPNZ_OUTPUT                 (1u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+static NwQ15 nwTestActuatedOutputs[2u] = { 0, 0 };
+static uint32 nwTestActuateCnt = 0u;
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Scaling stage of the test: converts the 12-bit samples 0 and 1 to the Q15 measurements 0 and 1.
+ * \param stageContext - Not used.
+ * \param signals - The signals of the pipeline.
+ * \return nwTrue - Always.
+ */
+static nw_bool NexaWatt_Test_Pipeline_Scale_Stage(void* stageContext, NexaWattPipelineSignals* signals);
+
+/**
+ * \brief Actuation stage of the test: records the outputs of the controllers.
+ * \param stageContext - Not used.
+ * \param signals - The signals of the pipeline.
+ * \return nwTrue - Always.
+ */
+static nw_bool NexaWatt_Test_Pipeline_Actuate_Stage(void* stageContext, NexaWattPipelineSignals* signals);
+
+static void NexaWatt_Test_Pipeline_Adapters(void);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+int main(void)
+{
+    NexaWatt_Test_Pipeline_Adapters();
+
+    return NexaWatt_Test_Result("pipeline");
+}
+
+static void NexaWatt_Test_Pipeline_Adapters(void)
+{
+    static NexaWattControlPipeline pipeline;
+    NexaWattFilterIir1 filter;
+    NexaWattPidController pid;
+    NexaWattNpnzController npnz;
+    NexaWattPidConfig pidConfig = { { NW_Q16_ONE, 0, 0 }, 0, NW_Q15_ONE };
+    NexaWattNpnzConfig npnzConfig = { 1u, { NW_Q16_ONE, 0, 0, 0 }, { 0, 0, 0, 0 }, 0, NW_Q15_ONE };
+    NexaWattFilterIir1Stage filterStage = { &filter, 1u };
+    NexaWattPipelinePidStage pidStage = { &pid, 0, 0u, NW_TEST_PID_OUTPUT };
+    NexaWattPipelineNpnzStage npnzStage = { &npnz, 0, 0u, NW_TEST_NPNZ_OUTPUT };
+    NwAdcSample samples[2u] = { 0u, 0u };
+
+    NW_TEST_EXPECT(NexaWatt_Filtering_Iir1_Init(&filter, NW_Q16_CONST(0.5), 0) == NW_FILTER_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Pid_Init(&pid, &pidConfig) == NW_CONTROLLER_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Npnz_Init(&npnz, &npnzConfig) == NW_CONTROLLER_SUCCESS);
+
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Pipeline_Init(&pipeline, NW_TEST_CYCLE_BUDGET) == NW_CONTROLLER_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Pipeline_Register_Stage(&pipeline, NW_PIPELINE_STAGE_SCALE, NexaWatt_Test_Pipeline_Scale_Stage, NULL) == NW_CONTROLLER_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Pipeline_Register_Stage(&pipeline, NW_PIPELINE_STAGE_FILTER, NexaWatt_Filtering_Iir1_Pipeline_Stage, &filterStage) == NW_CONTROLLER_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Pipeline_Register_Stage(&pipeline, NW_PIPELINE_STAGE_CONTROL, NexaWatt_DigitalController_Pipeline_Pid_Stage, &pidStage) == NW_CONTROLLER_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Pipeline_Register_Stage(&pipeline, NW_PIPELINE_STAGE_CONTROL, NexaWatt_DigitalController_Pipeline_Npnz_Stage, &npnzStage) == NW_CONTROLLER_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Pipeline_Register_Stage(&pipeline, NW_PIPELINE_STAGE_ACTUATE, NexaWatt_Test_Pipeline_Actuate_Stage, NULL) == NW_CONTROLLER_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Pipeline_Seal(&pipeline) == NW_CONTROLLER_SUCCESS);
+
+    // Inside the duty limits: the output of the proportional controllers is the error
+    pidStage.reference = NW_Q15_CONST(0.5);
+    npnzStage.reference = NW_Q15_CONST(0.5);
+    samples[0u] = 1024u;
+    samples[1u] = 2048u;
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Pipeline_Execute(&pipeline, samples, 2u) == nwTrue);
+    NW_TEST_EXPECT(pipeline.signals.measurements[0u] == NW_Q15_CONST(0.25));
+    NW_TEST_EXPECT(pipeline.signals.measurements[1u] == NW_Q15_CONST(0.25));
+    NW_TEST_EXPECT(nwTestActuatedOutputs[NW_TEST_PID_OUTPUT] == NW_Q15_CONST(0.25));
+    NW_TEST_EXPECT(nwTestActuatedOutputs[NW_TEST_NPNZ_OUTPUT] == NW_Q15_CONST(0.25));
+
+    // Above the maximum duty of the topology
+    pidStage.reference = NW_Q15_ONE;
+    npnzStage.reference = NW_Q15_ONE;
+    samples[0u] = 0u;
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Pipeline_Execute(&pipeline, samples, 2u) == nwTrue);
+    NW_TEST_EXPECT(pipeline.signals.measurements[1u] == NW_Q15_CONST(0.375));
+    NW_TEST_EXPECT(nwTestActuatedOutputs[NW_TEST_PID_OUTPUT] == NW_TOPOLOGY_DUTY_MAX);
+    NW_TEST_EXPECT(nwTestActuatedOutputs[NW_TEST_NPNZ_OUTPUT] == NW_TOPOLOGY_DUTY_MAX);
+
+    // Below the minimum duty of the topology
+    pidStage.reference = 0;
+    npnzStage.reference = 0;
+    samples[0u] = 2048u;
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Pipeline_Execute(&pipeline, samples, 2u) == nwTrue);
+    NW_TEST_EXPECT(nwTestActuatedOutputs[NW_TEST_PID_OUTPUT] == NW_TOPOLOGY_DUTY_MIN);
+    NW_TEST_EXPECT(nwTestActuatedOutputs[NW_TEST_NPNZ_OUTPUT] == NW_TOPOLOGY_DUTY_MIN);
+
+    NW_TEST_EXPECT(nwTestActuateCnt == 3u);
+    NW_TEST_EXPECT(pipeline.executionCnt == 3u);
+    NW_TEST_EXPECT(pipeline.abortCnt == 0u);
+}
+
+static nw_bool NexaWatt_Test_Pipeline_Scale_Stage(void* const stageContext, NexaWattPipelineSignals* const signals)
+{
+    (void)stageContext;
+
+    signals->measurements[0u] = (NwQ15)signals->samples[0u] << 3u;
+    signals->measurements[1u] = (NwQ15)signals->samples[1u] << 3u;
+
+    return nwTrue;
+}
+
+static nw_bool NexaWatt_Test_Pipeline_Actuate_Stage(void* const stageContext, NexaWattPipelineSignals* const signals)
+{
+    (void)stageContext;
+
+    nwTestActuatedOutputs[NW_TEST_PID_OUTPUT] = signals->outputs[NW_TEST_PID_OUTPUT];
+    nwTestActuatedOutputs[NW_TEST_NPNZ_OUTPUT] = signals->outputs[NW_TEST_NPNZ_OUTPUT];
+    nwTestActuateCnt++;
+
+    return nwTrue;
+}
@@ -0,0 +1,383 @@
+/*******************************************************************************
+* File Name:   test_plant_host_sim.c
+*
+* Description: This is the source file containing the host test,
+* related to the Plant Models and their connection to the host simulation HAL
+* of the NexaWatt-IV.DC framework. A synchronous buck converter is regulated through
+* the ADC and PWM HAL wrappers, bound to the host simulation HAL, with the averaged
+* and the switched plant model. The test checks the regulation, a load step and an
+* input voltage transient, the agreement of both models, the output voltage sampling
+* of the switched model and the limits of the initialization.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <math.h>
+#include <stdlib.h>
+#include "test_host.h"
+#include "hal_context_bind.h"
+#include "hal_wrapper_adc.h"
+#include "hal_wrapper_pwm.h"
+#include "hal_host_sim_adc.h"
+#include "hal_host_sim_pwm.h"
+#include "digital_controller_pid.h"
+#include "topology_plant_host_sim.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define NW_TEST_PWM_CHANNEL                 (0u)
+#define NW_TEST_PWM_PERIOD_TICKS            (1000u)
+#define NW_TEST_ADC_CHANNEL_VOUT            (0u)
+#define NW_TEST_ADC_CHANNEL_VIN             (1u)
+#define NW_TEST_ADC_SHIFT                   (NW_Q15_FRAC_BITS - NW_HAL_HOST_SIM_ADC_RESOLUTION_BITS)
+
+/**
+ * \brief Operating point of the simulated converter: 12 V to 5 V at 100 kHz, full scale inputs of 20 V and 10 A.
+ */
+#define NW_TEST_CONTROL_FREQUENCY           (100000.0)
+#define NW_TEST_INPUT_VOLTAGE               (12.0)
+#define NW_TEST_OUTPUT_VOLTAGE              (5.0)
+#define NW_TEST_VOLTAGE_BASE                (20.0)
+#define NW_TEST_CURRENT_BASE                (10.0)
+
+/**
+ * \brief Scripted transients: a load step from 1 A to 2.5 A and an input voltage drop from 12 V to 9 V.
+ */
+#define NW_TEST_LOAD_STEP_IDX               (3000u)
+#define NW_TEST_INPUT_STEP_IDX              (6000u)
+#define NW_TEST_PERIOD_CNT                  (9000u)
+#define NW_TEST_SETTLE_PERIODS              (2000u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+static const uint8 nwTestAdcChannels[2u] = { NW_TEST_ADC_CHANNEL_VOUT, NW_TEST_ADC_CHANNEL_VIN };
+static const uint8 nwTestSensePoints[2u] = { NW_TOPOLOGY_SENSE_VOUT, NW_TOPOLOGY_SENSE_VIN };
+
+static const NexaWattPlantEvent nwTestEvents[2u] =
+{
+    { NW_TEST_LOAD_STEP_IDX, NW_PLANT_EVENT_LOAD_RESISTANCE, 2.0 },
+    { NW_TEST_INPUT_STEP_IDX, NW_PLANT_EVENT_INPUT_VOLTAGE, 9.0 },
+};
+
+static NexaWattPidController nwTestPid;
+static NwAdcSample nwTestLastVinSample = 0u;
+static uint32 nwTestFrameCnt = 0u;
+
+static double nwTestAveragedVout[NW_TEST_PERIOD_CNT];
+static double nwTestSwitchedVout[NW_TEST_PERIOD_CNT];
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Frame callback of the test: executes the voltage controller and commits the duty cycle of the next period.
+ * \param frame - The sample frame.
+ */
+static void NexaWatt_Test_Plant_Host_Sim_Control(const NexaWattADCFrame* frame);
+
+/**
+ * \brief Simple helper function that binds the host simulation HAL and initializes the PWM channel, the ADC sequence and the controller.
+ */
+static void NexaWatt_Test_Plant_Host_Sim_Setup(void);
+
+/**
+ * \brief Simple helper function that fills the configuration of the simulated converter.
+ * \param modelConfig - A pointer to the configuration to be filled.
+ * \param topologyId - The topology of the power stage.
+ * \param modelType - The type of the plant model.
+ */
+static void NexaWatt_Test_Plant_Host_Sim_Config(NexaWattPlantModelConfig* modelConfig, uint8 topologyId, NexaWattPlantModelType modelType);
+
+/**
+ * \brief Simple helper function that runs the closed loop with the scripted transients and records the output voltage.
+ * \param modelType - The type of the plant model.
+ * \param outputVoltages - The recorded output voltage of each period.
+ */
+static void NexaWatt_Test_Plant_Host_Sim_Run(NexaWattPlantModelType modelType, double* outputVoltages);
+
+/**
+ * \brief Simple helper function that calculates the largest undershoot of the output voltage below its reference in a range of periods.
+ * \param outputVoltages - The recorded output voltages.
+ * \param startIdx - The first period of the range.
+ * \param endIdx - The period after the range.
+ * \return The undershoot in Volts.
+ */
+static double NexaWatt_Test_Plant_Host_Sim_Undershoot(const double* outputVoltages, uint32 startIdx, uint32 endIdx);
+
+static void NexaWatt_Test_Plant_Host_Sim_Closed_Loop(void);
+static void NexaWatt_Test_Plant_Host_Sim_Switched_Sampling(void);
+static void NexaWatt_Test_Plant_Host_Sim_Init_Limits(void);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+int main(void)
+{
+    NexaWatt_Test_Plant_Host_Sim_Setup();
+
+    NexaWatt_Test_Plant_Host_Sim_Closed_Loop();
+    NexaWatt_Test_Plant_Host_Sim_Switched_Sampling();
+    NexaWatt_Test_Plant_Host_Sim_Init_Limits();
+
+    return NexaWatt_Test_Result("plant_host_sim");
+}
+
+static void NexaWatt_Test_Plant_Host_Sim_Closed_Loop(void)
+{
+    const double toleranceVoltage = 0.01 * NW_TEST_OUTPUT_VOLTAGE;
+    double averagedUndershoot = 0.0;
+    double switchedUndershoot = 0.0;
+    double largestDifference = 0.0;
+    uint32 periodIdx = 0u;
+
+    NexaWatt_Test_Plant_Host_Sim_Run(NW_PLANT_MODEL_AVERAGED, nwTestAveragedVout);
+    NW_TEST_EXPECT(nwTestFrameCnt == NW_TEST_PERIOD_CNT);
+    // The sampled input voltage follows the transient of the plant
+    NW_TEST_EXPECT(abs((int32)nwTestLastVinSample - (int32)((9.0 / NW_TEST_VOLTAGE_BASE) * 4096.0)) <= 2);
+
+    NexaWatt_Test_Plant_Host_Sim_Run(NW_PLANT_MODEL_SWITCHED, nwTestSwitchedVout);
+    NW_TEST_EXPECT(nwTestFrameCnt == NW_TEST_PERIOD_CNT);
+
+    // Regulation before each transient and at the end
+    NW_TEST_EXPECT(fabs(nwTestAveragedVout[NW_TEST_LOAD_STEP_IDX - 1u] - NW_TEST_OUTPUT_VOLTAGE) < toleranceVoltage);
+    NW_TEST_EXPECT(fabs(nwTestSwitchedVout[NW_TEST_LOAD_STEP_IDX - 1u] - NW_TEST_OUTPUT_VOLTAGE) < toleranceVoltage);
+    NW_TEST_EXPECT(fabs(nwTestAveragedVout[NW_TEST_INPUT_STEP_IDX - 1u] - NW_TEST_OUTPUT_VOLTAGE) < toleranceVoltage);
+    NW_TEST_EXPECT(fabs(nwTestSwitchedVout[NW_TEST_INPUT_STEP_IDX - 1u] - NW_TEST_OUTPUT_VOLTAGE) < toleranceVoltage);
+    NW_TEST_EXPECT(fabs(nwTestAveragedVout[NW_TEST_PERIOD_CNT - 1u] - NW_TEST_OUTPUT_VOLTAGE) < toleranceVoltage);
+    NW_TEST_EXPECT(fabs(nwTestSwitchedVout[NW_TEST_PERIOD_CNT - 1u] - NW_TEST_OUTPUT_VOLTAGE) < toleranceVoltage);
+
+    // The load step is recovered without an excessive undershoot, the same in both models
+    averagedUndershoot = NexaWatt_Test_Plant_Host_Sim_Undershoot(nwTestAveragedVout, NW_TEST_LOAD_STEP_IDX, NW_TEST_INPUT_STEP_IDX);
+    switchedUndershoot = NexaWatt_Test_Plant_Host_Sim_Undershoot(nwTestSwitchedVout, NW_TEST_LOAD_STEP_IDX, NW_TEST_INPUT_STEP_IDX);
+    printf("plant_host_sim: load step undershoot %.3f V averaged, %.3f V switched\n", averagedUndershoot, switchedUndershoot);
+    NW_TEST_EXPECT(averagedUndershoot > toleranceVoltage);
+    NW_TEST_EXPECT(averagedUndershoot < (0.1 * NW_TEST_OUTPUT_VOLTAGE));
+    NW_TEST_EXPECT(fabs(switchedUndershoot - averagedUndershoot) < (0.1 * averagedUndershoot));
+
+    // The input voltage drop is recovered the same way
+    averagedUndershoot = NexaWatt_Test_Plant_Host_Sim_Undershoot(nwTestAveragedVout, NW_TEST_INPUT_STEP_IDX, NW_TEST_PERIOD_CNT);
+    switchedUndershoot = NexaWatt_Test_Plant_Host_Sim_Undershoot(nwTestSwitchedVout, NW_TEST_INPUT_STEP_IDX, NW_TEST_PERIOD_CNT);
+    printf("plant_host_sim: input transient undershoot %.3f V averaged, %.3f V switched\n", averagedUndershoot, switchedUndershoot);
+    NW_TEST_EXPECT(averagedUndershoot > toleranceVoltage);
+    NW_TEST_EXPECT(averagedUndershoot < (0.1 * NW_TEST_OUTPUT_VOLTAGE));
+    NW_TEST_EXPECT(fabs(switchedUndershoot - averagedUndershoot) < (0.1 * averagedUndershoot));
+
+    // The switched model follows the averaged one along the whole run, apart from its ripple
+    for (periodIdx = NW_TEST_SETTLE_PERIODS; periodIdx < NW_TEST_PERIOD_CNT; periodIdx++)
+    {
+        largestDifference = fmax(largestDifference, fabs(nwTestSwitchedVout[periodIdx] - nwTestAveragedVout[periodIdx]));
+    }
+    printf("plant_host_sim: largest difference of the models %.4f V\n", largestDifference);
+    NW_TEST_EXPECT(largestDifference < toleranceVoltage);
+}
+
+static void NexaWatt_Test_Plant_Host_Sim_Switched_Sampling(void)
+{
+    NexaWattPlantModelConfig modelConfig;
+    NexaWattPlantModel switchedModel;
+    NexaWattPlantModel averagedModel;
+    const NexaWattPlantModelOutputs* outputs = NULL;
+    double offStateVoltage = 0.0;
+    double averagedStateVoltage = 0.0;
+    uint32 periodIdx = 0u;
+
+    // The boost stage has an output coefficient of 0 in the on state, so the sampled segment is visible through the ESR
+    NexaWatt_Test_Plant_Host_Sim_Config(&modelConfig, NW_TOPOLOGY_ID_BOOST_SYNC, NW_PLANT_MODEL_SWITCHED);
+    modelConfig.capacitorEsr = 0.05;
+    modelConfig.initialOutputVoltage = 2.0 * NW_TEST_INPUT_VOLTAGE;
+    modelConfig.eventCnt = 0u;
+    modelConfig.loadResistance = 24.0;
+    NW_TEST_EXPECT(NexaWatt_PlantModel_Init(&switchedModel, &modelConfig) == NW_PLANT_MODEL_SUCCESS);
+    modelConfig.modelType = NW_PLANT_MODEL_AVERAGED;
+    NW_TEST_EXPECT(NexaWatt_PlantModel_Init(&averagedModel, &modelConfig) == NW_PLANT_MODEL_SUCCESS);
+
+    for (periodIdx = 0u; periodIdx < NW_TEST_PERIOD_CNT; periodIdx++)
+    {
+        NexaWatt_PlantModel_Step(&switchedModel, NW_Q15_CONST(0.5));
+        NexaWatt_PlantModel_Step(&averagedModel, NW_Q15_CONST(0.5));
+    }
+
+    // The period ends in the off state: Vout = (vC + ESR * (iL - Iload)) / (1 + ESR * G)
+    outputs = NexaWatt_PlantModel_Get_Outputs(&switchedModel);
+    offStateVoltage = (switchedModel.capacitorVoltage + (modelConfig.capacitorEsr * (switchedModel.inductorCurrent - switchedModel.loadCurrent))) /
+                      (1.0 + (modelConfig.capacitorEsr * switchedModel.loadConductance));
+    averagedStateVoltage = (switchedModel.capacitorVoltage + (modelConfig.capacitorEsr * ((0.5 * switchedModel.inductorCurrent) - switchedModel.loadCurrent))) /
+                           (1.0 + (modelConfig.capacitorEsr * switchedModel.loadConductance));
+    NW_TEST_EXPECT(fabs(outputs->outputVoltage - offStateVoltage) < 1e-9);
+    NW_TEST_EXPECT(fabs(outputs->outputVoltage - averagedStateVoltage) > 0.01);
+
+    // The steady state of both models agrees within the ripple
+    printf("plant_host_sim: boost output %.3f V switched, %.3f V averaged\n",
+           outputs->outputVoltage, NexaWatt_PlantModel_Get_Outputs(&averagedModel)->outputVoltage);
+    NW_TEST_EXPECT(fabs(outputs->outputVoltage - NexaWatt_PlantModel_Get_Outputs(&averagedModel)->outputVoltage) < (0.01 * outputs->outputVoltage));
+
+    // A full duty period ends in the on state
+    NexaWatt_PlantModel_Step(&switchedModel, NW_Q15_ONE);
+    outputs = NexaWatt_PlantModel_Get_Outputs(&switchedModel);
+    NW_TEST_EXPECT(fabs(outputs->outputVoltage - ((switchedModel.capacitorVoltage - (modelConfig.capacitorEsr * switchedModel.loadCurrent)) /
+                                                  (1.0 + (modelConfig.capacitorEsr * switchedModel.loadConductance)))) < 1e-9);
+}
+
+static void NexaWatt_Test_Plant_Host_Sim_Init_Limits(void)
+{
+    NexaWattPlantModelConfig modelConfig;
+    NexaWattPlantModel model;
+    NexaWattPlantHostSim hostSim;
+    NexaWattPlantHostSimConfig hostSimConfig;
+
+    NexaWatt_Test_Plant_Host_Sim_Config(&modelConfig, NW_TOPOLOGY_ID_BUCK_SYNC, NW_PLANT_MODEL_SWITCHED);
+    modelConfig.subSteps = NW_PLANT_MODEL_MAX_SUB_STEPS + 1u;
+    NW_TEST_EXPECT(NexaWatt_PlantModel_Init(&model, &modelConfig) == NW_PLANT_MODEL_BAD_PARAM);
+
+    // The largest count still fits the segments: a full duty period integrates all sub-steps plus one
+    modelConfig.subSteps = NW_PLANT_MODEL_MAX_SUB_STEPS;
+    NW_TEST_EXPECT(NexaWatt_PlantModel_Init(&model, &modelConfig) == NW_PLANT_MODEL_SUCCESS);
+    NexaWatt_PlantModel_Step(&model, NW_Q15_ONE);
+    NW_TEST_EXPECT(model.inductorCurrent > 0.0);
+
+    modelConfig.subSteps = 0u;
+    NW_TEST_EXPECT(NexaWatt_PlantModel_Init(&model, &modelConfig) == NW_PLANT_MODEL_SUCCESS);
+    NW_TEST_EXPECT(model.config.subSteps == NW_PLANT_MODEL_DEFAULT_SUB_STEPS);
+
+    hostSimConfig.pwmChannel = NW_TEST_PWM_CHANNEL;
+    hostSimConfig.sensePoints = NULL;
+    hostSimConfig.sensePointCnt = 2u;
+    NW_TEST_EXPECT(NexaWatt_PlantHostSim_Init(&hostSim, &model, &hostSimConfig) == NW_PLANT_MODEL_BAD_PARAM);
+    hostSimConfig.sensePoints = nwTestSensePoints;
+    hostSimConfig.sensePointCnt = 0u;
+    NW_TEST_EXPECT(NexaWatt_PlantHostSim_Init(&hostSim, &model, &hostSimConfig) == NW_PLANT_MODEL_BAD_PARAM);
+    hostSimConfig.sensePointCnt = 2u;
+    NW_TEST_EXPECT(NexaWatt_PlantHostSim_Init(&hostSim, NULL, &hostSimConfig) == NW_PLANT_MODEL_BAD_PARAM);
+    NW_TEST_EXPECT(NexaWatt_PlantHostSim_Init(&hostSim, &model, &hostSimConfig) == NW_PLANT_MODEL_SUCCESS);
+}
+
+static void NexaWatt_Test_Plant_Host_Sim_Control(const NexaWattADCFrame* const frame)
+{
+    const NwQ15 reference = NW_Q15_CONST(NW_TEST_OUTPUT_VOLTAGE / NW_TEST_VOLTAGE_BASE);
+    const NwQ15 outputVoltage = (NwQ15)((uint32)frame->samples[NW_TEST_ADC_CHANNEL_VOUT] << NW_TEST_ADC_SHIFT);
+
+    nwTestLastVinSample = frame->samples[NW_TEST_ADC_CHANNEL_VIN];
+    nwTestFrameCnt++;
+
+    NexaWatt_HalWrapperPwm_Stage_Duty(NW_TEST_PWM_CHANNEL, NexaWatt_DigitalController_Pid_Step(&nwTestPid, reference, outputVoltage));
+    NexaWatt_HalWrapperPwm_Commit();
+}
+
+static void NexaWatt_Test_Plant_Host_Sim_Setup(void)
+{
+    NexaWattHalContextFunction function = { NULL, NULL, NULL };
+    NexaWattPWMChannelConfig pwmConfig;
+
+    NexaWatt_HalContext_Init();
+
+    function.fncPtr = (void*)NexaWatt_Hal_Host_Sim_Pwm_Init_Channel;
+    NW_TEST_EXPECT(NexaWatt_HalContext_Bind_Init_Function(NW_HAL_PWM_CHANNEL_INIT, &function) == NW_HAL_CONTEXT_OK);
+    function.fncPtr = (void*)NexaWatt_Hal_Host_Sim_Adc_Init_Sequence;
+    NW_TEST_EXPECT(NexaWatt_HalContext_Bind_Init_Function(NW_HAL_ADC_SEQUENCE_INIT, &function) == NW_HAL_CONTEXT_OK);
+    function.fncPtr = (void*)NexaWatt_Hal_Host_Sim_Pwm_Start;
+    NW_TEST_EXPECT(NexaWatt_HalContext_Bind_Function(NW_HAL_PWM_START, &function) == NW_HAL_CONTEXT_OK);
+    function.fncPtr = (void*)NexaWatt_Hal_Host_Sim_Pwm_Commit;
+    NW_TEST_EXPECT(NexaWatt_HalContext_Bind_Function(NW_HAL_PWM_COMMIT, &function) == NW_HAL_CONTEXT_OK);
+    function.fncPtr = (void*)NexaWatt_Hal_Host_Sim_Adc_Start;
+    NW_TEST_EXPECT(NexaWatt_HalContext_Bind_Function(NW_HAL_ADC_START, &function) == NW_HAL_CONTEXT_OK);
+
+    pwmConfig.periodTicks = NW_TEST_PWM_PERIOD_TICKS;
+    pwmConfig.alignment = NW_PWM_ALIGN_LEFT;
+    pwmConfig.deadTimeRiseTicks = 0u;
+    pwmConfig.deadTimeFallTicks = 0u;
+    pwmConfig.complementaryOutput = nwTrue;
+    pwmConfig.invertOutput = nwFalse;
+    NW_TEST_EXPECT(NexaWatt_HalWrapperPwm_Init_Channel(NW_TEST_PWM_CHANNEL, &pwmConfig) == NW_PWM_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_HalWrapperPwm_Start(NW_PWM_CHANNEL_MASK(NW_TEST_PWM_CHANNEL)) == NW_PWM_SUCCESS);
+}
+
+static void NexaWatt_Test_Plant_Host_Sim_Config(NexaWattPlantModelConfig* const modelConfig, const uint8 topologyId, const NexaWattPlantModelType modelType)
+{
+    modelConfig->topologyId = topologyId;
+    modelConfig->modelType = modelType;
+    modelConfig->inductance = 22e-6;
+    modelConfig->inductorResistance = 0.02;
+    modelConfig->capacitance = 100e-6;
+    modelConfig->capacitorEsr = 0.01;
+    modelConfig->transformerRatio = 1.0;
+    modelConfig->controlFrequency = NW_TEST_CONTROL_FREQUENCY;
+    modelConfig->subSteps = 0u;
+    modelConfig->switchingEnergy = 0.0;
+    modelConfig->inputVoltage = NW_TEST_INPUT_VOLTAGE;
+    modelConfig->loadResistance = 5.0;
+    modelConfig->loadCurrent = 0.0;
+    modelConfig->initialOutputVoltage = NW_TEST_OUTPUT_VOLTAGE;
+    modelConfig->voltageBase = NW_TEST_VOLTAGE_BASE;
+    modelConfig->currentBase = NW_TEST_CURRENT_BASE;
+    modelConfig->events = nwTestEvents;
+    modelConfig->eventCnt = 2u;
+}
+
+static void NexaWatt_Test_Plant_Host_Sim_Run(const NexaWattPlantModelType modelType, double* const outputVoltages)
+{
+    NexaWattPlantModelConfig modelConfig;
+    NexaWattPlantModel model;
+    NexaWattPlantHostSim hostSim;
+    NexaWattPlantHostSimConfig hostSimConfig;
+    NexaWattADCSequenceConfig sequenceConfig;
+    NexaWattPidConfig pidConfig;
+    uint32 periodIdx = 0u;
+
+    NexaWatt_Test_Plant_Host_Sim_Config(&modelConfig, NW_TOPOLOGY_ID_BUCK_SYNC, modelType);
+    NW_TEST_EXPECT(NexaWatt_PlantModel_Init(&model, &modelConfig) == NW_PLANT_MODEL_SUCCESS);
+
+    hostSimConfig.pwmChannel = NW_TEST_PWM_CHANNEL;
+    hostSimConfig.sensePoints = nwTestSensePoints;
+    hostSimConfig.sensePointCnt = 2u;
+    NW_TEST_EXPECT(NexaWatt_PlantHostSim_Init(&hostSim, &model, &hostSimConfig) == NW_PLANT_MODEL_SUCCESS);
+
+    // The integrator starts at the duty cycle of the operating point, so the run starts in steady state
+    pidConfig.gains.kp = NW_Q16_CONST(4.0);
+    pidConfig.gains.ki = NW_Q16_CONST(0.4);
+    pidConfig.gains.kd = NW_Q16_CONST(16.0);
+    pidConfig.outMin = 0;
+    pidConfig.outMax = NW_Q15_CONST(0.9);
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Pid_Init(&nwTestPid, &pidConfig) == NW_CONTROLLER_SUCCESS);
+    NexaWatt_DigitalController_Pid_Reset(&nwTestPid, NW_Q15_CONST(NW_TEST_OUTPUT_VOLTAGE / NW_TEST_INPUT_VOLTAGE));
+    NexaWatt_HalWrapperPwm_Stage_Duty(NW_TEST_PWM_CHANNEL, NW_Q15_CONST(NW_TEST_OUTPUT_VOLTAGE / NW_TEST_INPUT_VOLTAGE));
+    NexaWatt_HalWrapperPwm_Commit();
+
+    sequenceConfig.channelList = nwTestAdcChannels;
+    sequenceConfig.channelCnt = 2u;
+    sequenceConfig.triggerSource = NW_ADC_TRIGGER_PWM;
+    sequenceConfig.triggerPwmChannel = NW_TEST_PWM_CHANNEL;
+    sequenceConfig.intrPriority = 0u;
+    NW_TEST_EXPECT(NexaWatt_HalWrapperAdc_Init_Sequence(&sequenceConfig, NexaWatt_Test_Plant_Host_Sim_Control) == NW_ADC_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_HalWrapperAdc_Start() == NW_ADC_SUCCESS);
+
+    nwTestFrameCnt = 0u;
+    for (periodIdx = 0u; periodIdx < NW_TEST_PERIOD_CNT; periodIdx++)
+    {
+        NexaWatt_PlantHostSim_Step(&hostSim);
+        outputVoltages[periodIdx] = NexaWatt_PlantModel_Get_Outputs(&model)->outputVoltage;
+    }
+    NW_TEST_EXPECT(hostSim.periodCnt == NW_TEST_PERIOD_CNT);
+}
+
+static double NexaWatt_Test_Plant_Host_Sim_Undershoot(const double* const outputVoltages, const uint32 startIdx, const uint32 endIdx)
+{
+    double undershoot = 0.0;
+    uint32 periodIdx = 0u;
+
+    for (periodIdx = startIdx; periodIdx < endIdx; periodIdx++)
+    {
+        undershoot = fmax(undershoot, NW_TEST_OUTPUT_VOLTAGE - outputVoltages[periodIdx]);
+    }
+
+    return undershoot;
+}
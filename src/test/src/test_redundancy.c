@@ -0,0 +1,283 @@
+/*******************************************************************************
+* File Name:   test_redundancy.c
+*
+* Description: This is the source file containing the host test,
+* related to the redundancy group plausibility checks of the Safety Checker of the
+* NexaWatt-IV.DC framework. A current measured by a shunt and a Hall sensor and a
+* voltage measured by three channels are simulated with ripple and noise. The test
+* injects a sensor drift and a stuck-at fault and checks the detected members, the
+* fault and heal debouncing, the events and the forced trip of the safety checker.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <math.h>
+#include "test_host.h"
+#include "safety_checker_redundancy.h"
+#include "hal_wrapper_gpio.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define NW_TEST_WINDOW_SHIFT                (6u)
+#define NW_TEST_WINDOW_LEN                  (1u << NW_TEST_WINDOW_SHIFT)
+#define NW_TEST_DEBOUNCE_CNT                (3u)
+
+#define NW_TEST_CURRENT_GROUP               (0u)
+#define NW_TEST_VOLTAGE_GROUP               (1u)
+
+/**
+ * \brief Pipeline measurements of the members: shunt and Hall current, three voltage channels.
+ */
+#define NW_TEST_SHUNT_SIGNAL                (0u)
+#define NW_TEST_HALL_SIGNAL                 (1u)
+#define NW_TEST_VOLTAGE_SIGNAL              (2u)
+
+/**
+ * \brief Angular frequency of the voltage ripple per period: two ripple periods per window.
+ */
+#define NW_TEST_VOLTAGE_RIPPLE_FREQ         ((2.0 * 3.14159265358979323846 * 2.0) / (double)NW_TEST_WINDOW_LEN)
+
+#define NW_TEST_STUCK_MEMBER                (2u)
+#define NW_TEST_STUCK_VALUE                 (21000)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+static const NexaWattSafetyChannelLimits nwTestChannelLimits[1u] =
+{
+    { 0u, 4095u },
+};
+
+static const NexaWattSafetyConfig nwTestSafetyConfig =
+{
+    nwTestChannelLimits,
+    1u,
+    NULL,
+    0u,
+    1u,
+    0x01u,
+    nwTrue,
+};
+
+static const NexaWattSafetyRedundancyGroupConfig nwTestGroupConfigs[2u] =
+{
+    // Current: tripping group, the members are compared against their mean
+    { { NW_TEST_SHUNT_SIGNAL, NW_TEST_HALL_SIGNAL, 0u }, 2u, NW_Q15_CONST(0.02), NW_Q15_CONST(0.05), 4, 200,
+      NW_TEST_DEBOUNCE_CNT, NW_TEST_DEBOUNCE_CNT, nwTrue },
+    // Voltage: reporting group, the median outvotes a single faulty member
+    { { NW_TEST_VOLTAGE_SIGNAL, NW_TEST_VOLTAGE_SIGNAL + 1u, NW_TEST_VOLTAGE_SIGNAL + 2u }, 3u, NW_Q15_CONST(0.02), NW_Q15_CONST(0.05), 4, 200,
+      NW_TEST_DEBOUNCE_CNT, NW_TEST_DEBOUNCE_CNT, nwFalse },
+};
+
+static NexaWattSafetyChecker nwTestChecker;
+static NexaWattSafetyRedundancy nwTestRedundancy;
+static NexaWattPipelineSignals nwTestSignals;
+static uint32 nwTestPeriodIdx = 0u;
+
+static uint32 nwTestEventCnt = 0u;
+static uint32 nwTestLastEventArg = 0u;
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Handler of the group events of the test: counts the events and keeps the last argument.
+ * \param eventContext - Not used.
+ * \param eventArg - The packed group, suspected members and state.
+ */
+static void NexaWatt_Test_Redundancy_Notify_Handler(void* eventContext, uint32 eventArg);
+
+/**
+ * \brief Simple helper function that initializes the safety checker and the redundancy checks.
+ */
+static void NexaWatt_Test_Redundancy_Setup(void);
+
+/**
+ * \brief Simple helper function that simulates the measurements for a number of windows and executes the protection stage.
+ * \param windowCnt - The number of simulated windows.
+ * \param hallDrift - The drift of the Hall sensor, added per window.
+ * \param isStuck - nwTrue, if a voltage channel is stuck at a constant value.
+ * \return The number of periods, in which the stage ended the chain.
+ */
+static uint32 NexaWatt_Test_Redundancy_Run(uint32 windowCnt, int32 hallDrift, nw_bool isStuck);
+
+static void NexaWatt_Test_Redundancy_Healthy(void);
+static void NexaWatt_Test_Redundancy_Drift(void);
+static void NexaWatt_Test_Redundancy_Stuck_At(void);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattGPIOStatusResult NexaWatt_HalWrapperGpio_Port_Write(const uint8 portNum, const uint8 pinMask, const nw_bool value)
+{
+    (void)portNum;
+    (void)pinMask;
+    (void)value;
+
+    return NW_GPIO_SUCCESS;
+}
+
+NexaWattMiniOsStatusResult NexaWatt_MiniOs_Event_Post(const NwMiniOsEventHandler eventHandler, void* const eventContext, const uint32 eventArg)
+{
+    eventHandler(eventContext, eventArg);
+
+    return NW_MINI_OS_SUCCESS;
+}
+
+int main(void)
+{
+    NexaWatt_Test_Redundancy_Healthy();
+    NexaWatt_Test_Redundancy_Drift();
+    NexaWatt_Test_Redundancy_Stuck_At();
+
+    return NexaWatt_Test_Result("redundancy");
+}
+
+static void NexaWatt_Test_Redundancy_Healthy(void)
+{
+    NexaWattSafetyRedundancyStats redundancyStats;
+
+    NexaWatt_Test_Redundancy_Setup();
+
+    // Ripple, noise and small offsets between the sensors are plausible
+    NW_TEST_EXPECT(NexaWatt_Test_Redundancy_Run(30u, 0, nwFalse) == 0u);
+    NW_TEST_EXPECT(nwTestEventCnt == 0u);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Redundancy_Get_Stats(&nwTestRedundancy, NW_TEST_CURRENT_GROUP, &redundancyStats) == NW_SAFETY_SUCCESS);
+    NW_TEST_EXPECT(redundancyStats.evaluationCnt == 29u);
+    NW_TEST_EXPECT((redundancyStats.mismatchCnt == 0u) && (redundancyStats.stuckCnt == 0u));
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Redundancy_Get_Stats(&nwTestRedundancy, NW_TEST_VOLTAGE_GROUP, &redundancyStats) == NW_SAFETY_SUCCESS);
+    NW_TEST_EXPECT((redundancyStats.mismatchCnt == 0u) && (redundancyStats.stuckCnt == 0u));
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Get_Faults(&nwTestChecker) == 0u);
+}
+
+static void NexaWatt_Test_Redundancy_Drift(void)
+{
+    NexaWattSafetyRedundancyStats redundancyStats;
+    uint32 windowIdx = 0u;
+    uint32 windowsToFault = 0u;
+
+    NexaWatt_Test_Redundancy_Setup();
+    NW_TEST_EXPECT(NexaWatt_Test_Redundancy_Run(5u, 0, nwFalse) == 0u);
+
+    // A deviation shorter than the fault debounce is tolerated
+    NW_TEST_EXPECT(NexaWatt_Test_Redundancy_Run(NW_TEST_DEBOUNCE_CNT - 1u, 5000, nwFalse) == 0u);
+    NW_TEST_EXPECT(NexaWatt_Test_Redundancy_Run(5u, 0, nwFalse) == 0u);
+    NW_TEST_EXPECT(nwTestEventCnt == 0u);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Redundancy_Get_Stats(&nwTestRedundancy, NW_TEST_CURRENT_GROUP, &redundancyStats) == NW_SAFETY_SUCCESS);
+    NW_TEST_EXPECT(redundancyStats.mismatchCnt == (NW_TEST_DEBOUNCE_CNT - 1u));
+
+    // The Hall sensor drifts slowly: the group fails once the deviation from the mean exceeds the tolerance
+    for (windowIdx = 1u; (windowIdx <= 20u) && (NexaWatt_SafetyChecker_Redundancy_Is_Faulty(&nwTestRedundancy, NW_TEST_CURRENT_GROUP) == nwFalse); windowIdx++)
+    {
+        (void)NexaWatt_Test_Redundancy_Run(1u, (int32)windowIdx * 500, nwFalse);
+        windowsToFault = windowIdx;
+    }
+    // Tolerance 655 + 5% of 16000; the mean halves the drift, the decision lags the window by one evaluation
+    NW_TEST_EXPECT((windowsToFault >= 8u) && (windowsToFault <= 10u));
+    NW_TEST_EXPECT(nwTestEventCnt == 1u);
+    NW_TEST_EXPECT(NW_SAFETY_RED_EVENT_GET_GROUP(nwTestLastEventArg) == NW_TEST_CURRENT_GROUP);
+    NW_TEST_EXPECT(NW_SAFETY_RED_EVENT_GET_MEMBERS(nwTestLastEventArg) == 0x03u);
+    NW_TEST_EXPECT(NW_SAFETY_RED_EVENT_GET_FAULTY(nwTestLastEventArg) == nwTrue);
+    NW_TEST_EXPECT((NexaWatt_SafetyChecker_Get_Faults(&nwTestChecker) & NW_SAFETY_FAULT_REDUNDANCY(NW_TEST_CURRENT_GROUP)) != 0u);
+
+    // The failed tripping group ends the chain in every period
+    NW_TEST_EXPECT(NexaWatt_Test_Redundancy_Run(1u, 5000, nwFalse) == NW_TEST_WINDOW_LEN);
+
+    // The sensor recovers: the group heals after the heal debounce and the forced fault is released
+    NW_TEST_EXPECT(NexaWatt_Test_Redundancy_Run(NW_TEST_DEBOUNCE_CNT + 2u, 0, nwFalse) > 0u);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Redundancy_Is_Faulty(&nwTestRedundancy, NW_TEST_CURRENT_GROUP) == nwFalse);
+    NW_TEST_EXPECT(nwTestEventCnt == 2u);
+    NW_TEST_EXPECT(NW_SAFETY_RED_EVENT_GET_FAULTY(nwTestLastEventArg) == nwFalse);
+    NW_TEST_EXPECT((nwTestChecker.forcedFaults & NW_SAFETY_FAULT_REDUNDANCY(NW_TEST_CURRENT_GROUP)) == 0u);
+    NW_TEST_EXPECT(NexaWatt_Test_Redundancy_Run(2u, 0, nwFalse) == 0u);
+}
+
+static void NexaWatt_Test_Redundancy_Stuck_At(void)
+{
+    NexaWattSafetyRedundancyStats redundancyStats;
+
+    NexaWatt_Test_Redundancy_Setup();
+    NW_TEST_EXPECT(NexaWatt_Test_Redundancy_Run(5u, 0, nwFalse) == 0u);
+
+    // The stuck value is close to the average of the voltage, only the frozen span reveals the fault
+    NW_TEST_EXPECT(NexaWatt_Test_Redundancy_Run(NW_TEST_DEBOUNCE_CNT + 1u, 0, nwTrue) == 0u);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Redundancy_Is_Faulty(&nwTestRedundancy, NW_TEST_VOLTAGE_GROUP) == nwTrue);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Redundancy_Is_Faulty(&nwTestRedundancy, NW_TEST_CURRENT_GROUP) == nwFalse);
+    NW_TEST_EXPECT(nwTestEventCnt == 1u);
+    NW_TEST_EXPECT(NW_SAFETY_RED_EVENT_GET_GROUP(nwTestLastEventArg) == NW_TEST_VOLTAGE_GROUP);
+    NW_TEST_EXPECT(NW_SAFETY_RED_EVENT_GET_MEMBERS(nwTestLastEventArg) == (1u << NW_TEST_STUCK_MEMBER));
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Redundancy_Get_Stats(&nwTestRedundancy, NW_TEST_VOLTAGE_GROUP, &redundancyStats) == NW_SAFETY_SUCCESS);
+    NW_TEST_EXPECT((redundancyStats.stuckCnt >= NW_TEST_DEBOUNCE_CNT) && (redundancyStats.mismatchCnt == 0u));
+
+    // A reporting group does not trip the safety checker
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Get_Faults(&nwTestChecker) == 0u);
+
+    NW_TEST_EXPECT(NexaWatt_Test_Redundancy_Run(NW_TEST_DEBOUNCE_CNT + 2u, 0, nwFalse) == 0u);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Redundancy_Is_Faulty(&nwTestRedundancy, NW_TEST_VOLTAGE_GROUP) == nwFalse);
+    NW_TEST_EXPECT(nwTestEventCnt == 2u);
+}
+
+static void NexaWatt_Test_Redundancy_Notify_Handler(void* const eventContext, const uint32 eventArg)
+{
+    (void)eventContext;
+
+    nwTestEventCnt++;
+    nwTestLastEventArg = eventArg;
+}
+
+static void NexaWatt_Test_Redundancy_Setup(void)
+{
+    NexaWattSafetyRedundancyConfig redundancyConfig;
+
+    redundancyConfig.groups = nwTestGroupConfigs;
+    redundancyConfig.groupCnt = 2u;
+    redundancyConfig.windowShift = NW_TEST_WINDOW_SHIFT;
+    redundancyConfig.safetyChecker = &nwTestChecker;
+    redundancyConfig.notifyHandler = NexaWatt_Test_Redundancy_Notify_Handler;
+    redundancyConfig.notifyContext = NULL;
+
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Init(&nwTestChecker, &nwTestSafetyConfig) == NW_SAFETY_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Redundancy_Init(&nwTestRedundancy, &redundancyConfig) == NW_SAFETY_SUCCESS);
+
+    nwTestPeriodIdx = 0u;
+    nwTestEventCnt = 0u;
+}
+
+static uint32 NexaWatt_Test_Redundancy_Run(const uint32 windowCnt, const int32 hallDrift, const nw_bool isStuck)
+{
+    uint32 stoppedCnt = 0u;
+    uint32 periodIdx = 0u;
+    int32 noise = 0;
+    NwQ15 current = 0;
+    NwQ15 voltage = 0;
+
+    for (periodIdx = 0u; periodIdx < (windowCnt * NW_TEST_WINDOW_LEN); periodIdx++)
+    {
+        noise = (int32)(nwTestPeriodIdx % 3u) - 1;
+        current = (NwQ15)(16000.0 + (3000.0 * sin((double)nwTestPeriodIdx * 0.007))) + noise;
+        voltage = (NwQ15)(20000.0 + (2000.0 * sin((double)nwTestPeriodIdx * NW_TEST_VOLTAGE_RIPPLE_FREQ)));
+
+        nwTestSignals.measurements[NW_TEST_SHUNT_SIGNAL] = current;
+        nwTestSignals.measurements[NW_TEST_HALL_SIGNAL] = current + 40 + hallDrift;
+        nwTestSignals.measurements[NW_TEST_VOLTAGE_SIGNAL] = voltage;
+        nwTestSignals.measurements[NW_TEST_VOLTAGE_SIGNAL + 1u] = voltage + 5 - noise;
+        nwTestSignals.measurements[NW_TEST_VOLTAGE_SIGNAL + NW_TEST_STUCK_MEMBER] = (isStuck == nwTrue) ? NW_TEST_STUCK_VALUE : (voltage - 3);
+
+        if (NexaWatt_SafetyChecker_Redundancy_Pipeline_Stage(&nwTestRedundancy, &nwTestSignals) == nwFalse)
+        {
+            stoppedCnt++;
+        }
+        nwTestPeriodIdx++;
+    }
+
+    return stoppedCnt;
+}
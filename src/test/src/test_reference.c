@@ -0,0 +1,289 @@
+/*******************************************************************************
+* File Name:   test_reference.c
+*
+* Description: This is the source file containing the host test,
+* related to the reference trajectory generator of the NexaWatt-IV.DC framework.
+* Moves of the slew rate limited, S-curve and exponential profiles are executed
+* in both directions, up to the full scale. The test checks the monotonicity, the
+* exact final value, the rate limit, the duration and the completion events, also
+* for soft starts advancing by sub-LSB steps and for a new target during a move.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <math.h>
+#include <stdlib.h>
+#include "test_host.h"
+#include "digital_controller_reference.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define NW_TEST_SAMPLE_FREQ_HZ              (100000u)
+#define NW_TEST_MAX_RATE                    (NW_Q15_ONE * 10)
+#define NW_TEST_TIME_CONSTANT_US            (1000u)
+#define NW_TEST_MAX_SAMPLES                 (10000000u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+/**
+ * \brief Result of a move: the executed samples, the largest step and the monotonicity.
+ */
+typedef struct sNexaWattTestMove
+{
+    uint32 sampleCnt;
+    int32 maxStep;
+    NwQ15 finalValue;
+    nw_bool isMonotonic;
+} NexaWattTestMove;
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+/**
+ * \brief Start and target values of the moves, executed by every profile.
+ */
+static const NwQ15 nwTestMoves[][2u] =
+{
+    { 0, 30000 },
+    { 30000, 0 },
+    { NW_Q15_MAX, -NW_Q15_ONE },
+    { -NW_Q15_ONE, NW_Q15_MAX },
+    { 1000, -1000 },
+    { 5, 6 },
+    { 20000, -7 },
+};
+
+static uint32 nwTestDoneCnt = 0u;
+static uint32 nwTestDoneArg = 0u;
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Handler of the completion events of the test: counts the events and keeps the last argument.
+ * \param eventContext - Not used.
+ * \param eventArg - The reached target.
+ */
+static void NexaWatt_Test_Reference_Done_Handler(void* eventContext, uint32 eventArg);
+
+/**
+ * \brief Simple helper function that initializes a reference generator with the test configuration.
+ * \param reference - A pointer to the reference generator.
+ * \param profile - The profile.
+ * \param maxRate - The rate limit.
+ * \param initValue - The initial reference.
+ */
+static void NexaWatt_Test_Reference_Setup(NexaWattReference* reference, NexaWattReferenceProfile profile, NwQ15 maxRate, NwQ15 initValue);
+
+/**
+ * \brief Simple helper function that executes a move until the target is reached.
+ * \param reference - A pointer to the reference generator.
+ * \param target - The target.
+ * \return The result of the move.
+ */
+static NexaWattTestMove NexaWatt_Test_Reference_Move(NexaWattReference* reference, NwQ15 target);
+
+static void NexaWatt_Test_Reference_Profiles(void);
+static void NexaWatt_Test_Reference_Sub_Lsb(void);
+static void NexaWatt_Test_Reference_Retarget(void);
+static void NexaWatt_Test_Reference_Invalid_Config(void);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattMiniOsStatusResult NexaWatt_MiniOs_Event_Post(const NwMiniOsEventHandler eventHandler, void* const eventContext, const uint32 eventArg)
+{
+    eventHandler(eventContext, eventArg);
+
+    return NW_MINI_OS_SUCCESS;
+}
+
+int main(void)
+{
+    NexaWatt_Test_Reference_Profiles();
+    NexaWatt_Test_Reference_Sub_Lsb();
+    NexaWatt_Test_Reference_Retarget();
+    NexaWatt_Test_Reference_Invalid_Config();
+
+    return NexaWatt_Test_Result("reference");
+}
+
+static void NexaWatt_Test_Reference_Profiles(void)
+{
+    // The largest step of the rate limit, with one LSB of rounding
+    const int32 rateStep = (NW_TEST_MAX_RATE / (int32)NW_TEST_SAMPLE_FREQ_HZ) + 1;
+    NexaWattReference reference;
+    NexaWattTestMove move;
+    uint32 moveIdx = 0u;
+    uint32 slewSampleCnt = 0u;
+    int32 moveSpan = 0;
+
+    for (moveIdx = 0u; moveIdx < (sizeof(nwTestMoves) / sizeof(nwTestMoves[0u])); moveIdx++)
+    {
+        moveSpan = abs(nwTestMoves[moveIdx][1u] - nwTestMoves[moveIdx][0u]);
+
+        // Slew: the duration is given by the rate limit
+        NexaWatt_Test_Reference_Setup(&reference, NW_REFERENCE_PROFILE_SLEW, NW_TEST_MAX_RATE, nwTestMoves[moveIdx][0u]);
+        move = NexaWatt_Test_Reference_Move(&reference, nwTestMoves[moveIdx][1u]);
+        NW_TEST_EXPECT(move.isMonotonic == nwTrue);
+        NW_TEST_EXPECT(move.finalValue == nwTestMoves[moveIdx][1u]);
+        NW_TEST_EXPECT(move.maxStep <= rateStep);
+        slewSampleCnt = (uint32)(((int64)moveSpan * NW_TEST_SAMPLE_FREQ_HZ) / NW_TEST_MAX_RATE);
+        NW_TEST_EXPECT((move.sampleCnt >= slewSampleCnt) && (move.sampleCnt <= (slewSampleCnt + 2u)));
+
+        // S-curve: the peak rate respects the rate limit, so the move lasts longer than the ramp
+        NexaWatt_Test_Reference_Setup(&reference, NW_REFERENCE_PROFILE_S_CURVE, NW_TEST_MAX_RATE, nwTestMoves[moveIdx][0u]);
+        move = NexaWatt_Test_Reference_Move(&reference, nwTestMoves[moveIdx][1u]);
+        NW_TEST_EXPECT(move.isMonotonic == nwTrue);
+        NW_TEST_EXPECT(move.finalValue == nwTestMoves[moveIdx][1u]);
+        NW_TEST_EXPECT(move.maxStep <= rateStep);
+        NW_TEST_EXPECT(move.sampleCnt >= slewSampleCnt);
+
+        // Exponential: the end is exact despite the asymptotic approach
+        NexaWatt_Test_Reference_Setup(&reference, NW_REFERENCE_PROFILE_EXPONENTIAL, NW_TEST_MAX_RATE, nwTestMoves[moveIdx][0u]);
+        move = NexaWatt_Test_Reference_Move(&reference, nwTestMoves[moveIdx][1u]);
+        NW_TEST_EXPECT(move.isMonotonic == nwTrue);
+        NW_TEST_EXPECT(move.finalValue == nwTestMoves[moveIdx][1u]);
+        NW_TEST_EXPECT(move.sampleCnt < NW_TEST_MAX_SAMPLES);
+        NW_TEST_EXPECT(nwTestDoneCnt == 1u);
+        NW_TEST_EXPECT((NwQ15)nwTestDoneArg == nwTestMoves[moveIdx][1u]);
+    }
+
+    // The exponential approach covers 63.2 % of the move after one time constant
+    NexaWatt_Test_Reference_Setup(&reference, NW_REFERENCE_PROFILE_EXPONENTIAL, NW_TEST_MAX_RATE, 0);
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Reference_Set_Target(&reference, 30000) == NW_CONTROLLER_SUCCESS);
+    for (moveIdx = 0u; moveIdx < ((NW_TEST_TIME_CONSTANT_US * NW_TEST_SAMPLE_FREQ_HZ) / 1000000u); moveIdx++)
+    {
+        (void)NexaWatt_DigitalController_Reference_Step(&reference);
+    }
+    NW_TEST_EXPECT(fabs((double)NexaWatt_DigitalController_Reference_Get_Value(&reference) - (30000.0 * (1.0 - exp(-1.0)))) < 300.0);
+}
+
+static void NexaWatt_Test_Reference_Sub_Lsb(void)
+{
+    NexaWattReference reference;
+    NexaWattTestMove move;
+    uint32 slewSampleCnt = 0u;
+
+    // A soft start of 1 % of the full scale per second advances by 0.003 LSB per sample
+    NexaWatt_Test_Reference_Setup(&reference, NW_REFERENCE_PROFILE_SLEW, NW_Q15_ONE / 100, 0);
+    move = NexaWatt_Test_Reference_Move(&reference, 100);
+    NW_TEST_EXPECT(move.isMonotonic == nwTrue);
+    NW_TEST_EXPECT(move.finalValue == 100);
+    NW_TEST_EXPECT(move.maxStep == 1);
+    // The step is rounded down to the resolution of the reference, the rate stays within 2 % below the limit
+    slewSampleCnt = (100u * NW_TEST_SAMPLE_FREQ_HZ) / (uint32)(NW_Q15_ONE / 100);
+    NW_TEST_EXPECT((move.sampleCnt >= slewSampleCnt) && (move.sampleCnt <= ((slewSampleCnt * 102u) / 100u)));
+
+    NexaWatt_Test_Reference_Setup(&reference, NW_REFERENCE_PROFILE_S_CURVE, NW_Q15_ONE / 100, 0);
+    move = NexaWatt_Test_Reference_Move(&reference, -100);
+    NW_TEST_EXPECT(move.isMonotonic == nwTrue);
+    NW_TEST_EXPECT(move.finalValue == -100);
+    NW_TEST_EXPECT(move.maxStep == 1);
+}
+
+static void NexaWatt_Test_Reference_Retarget(void)
+{
+    const int32 rateStep = (NW_TEST_MAX_RATE / (int32)NW_TEST_SAMPLE_FREQ_HZ) + 1;
+    NexaWattReference reference;
+    NexaWattTestMove move;
+    NwQ15 reversalValue = 0;
+    uint32 sampleIdx = 0u;
+
+    NexaWatt_Test_Reference_Setup(&reference, NW_REFERENCE_PROFILE_S_CURVE, NW_TEST_MAX_RATE, 0);
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Reference_Set_Target(&reference, 30000) == NW_CONTROLLER_SUCCESS);
+    for (sampleIdx = 0u; sampleIdx < 2000u; sampleIdx++)
+    {
+        reversalValue = NexaWatt_DigitalController_Reference_Step(&reference);
+    }
+    NW_TEST_EXPECT((reversalValue > 0) && (reversalValue < 30000));
+
+    // The new move starts from the current reference without a jump
+    move = NexaWatt_Test_Reference_Move(&reference, -10000);
+    NW_TEST_EXPECT(move.isMonotonic == nwTrue);
+    NW_TEST_EXPECT(move.finalValue == -10000);
+    NW_TEST_EXPECT(move.maxStep <= rateStep);
+    NW_TEST_EXPECT(nwTestDoneCnt == 1u);
+
+    // A reset sets the reference immediately and posts no completion
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Reference_Set_Target(&reference, 0) == NW_CONTROLLER_SUCCESS);
+    (void)NexaWatt_DigitalController_Reference_Step(&reference);
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Reference_Reset(&reference, 1234) == NW_CONTROLLER_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Reference_Is_Done(&reference) == nwTrue);
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Reference_Step(&reference) == 1234);
+    NW_TEST_EXPECT(nwTestDoneCnt == 1u);
+}
+
+static void NexaWatt_Test_Reference_Invalid_Config(void)
+{
+    NexaWattReferenceConfig referenceConfig = { NW_REFERENCE_PROFILE_SLEW, NW_TEST_SAMPLE_FREQ_HZ, 1, 0u, NULL, NULL };
+    NexaWattReference reference;
+
+    // The rate limit is below the resolution at the sample frequency
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Reference_Init(&reference, &referenceConfig, 0) == NW_CONTROLLER_BAD_PARAM);
+    referenceConfig.profile = NW_REFERENCE_PROFILE_EXPONENTIAL;
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Reference_Init(&reference, &referenceConfig, 0) == NW_CONTROLLER_BAD_PARAM);
+    referenceConfig.maxRate = NW_TEST_MAX_RATE;
+    referenceConfig.sampleFreqHz = 0u;
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Reference_Init(&reference, &referenceConfig, 0) == NW_CONTROLLER_BAD_PARAM);
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Reference_Init(NULL, &referenceConfig, 0) == NW_CONTROLLER_BAD_PARAM);
+}
+
+static void NexaWatt_Test_Reference_Done_Handler(void* const eventContext, const uint32 eventArg)
+{
+    (void)eventContext;
+
+    nwTestDoneCnt++;
+    nwTestDoneArg = eventArg;
+}
+
+static void NexaWatt_Test_Reference_Setup(NexaWattReference* const reference, const NexaWattReferenceProfile profile, const NwQ15 maxRate, const NwQ15 initValue)
+{
+    NexaWattReferenceConfig referenceConfig;
+
+    referenceConfig.profile = profile;
+    referenceConfig.sampleFreqHz = NW_TEST_SAMPLE_FREQ_HZ;
+    referenceConfig.maxRate = maxRate;
+    referenceConfig.timeConstantUs = NW_TEST_TIME_CONSTANT_US;
+    referenceConfig.doneHandler = NexaWatt_Test_Reference_Done_Handler;
+    referenceConfig.doneContext = NULL;
+
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Reference_Init(reference, &referenceConfig, initValue) == NW_CONTROLLER_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Reference_Get_Value(reference) == initValue);
+    nwTestDoneCnt = 0u;
+}
+
+static NexaWattTestMove NexaWatt_Test_Reference_Move(NexaWattReference* const reference, const NwQ15 target)
+{
+    NexaWattTestMove move = { 0u, 0, 0, nwTrue };
+    const NwQ15 startValue = NexaWatt_DigitalController_Reference_Get_Value(reference);
+    NwQ15 previousValue = startValue;
+    NwQ15 value = startValue;
+    int32 step = 0;
+
+    NW_TEST_EXPECT(NexaWatt_DigitalController_Reference_Set_Target(reference, target) == NW_CONTROLLER_SUCCESS);
+
+    while ((NexaWatt_DigitalController_Reference_Is_Done(reference) == nwFalse) &&
+           (move.sampleCnt < NW_TEST_MAX_SAMPLES))
+    {
+        value = NexaWatt_DigitalController_Reference_Step(reference);
+        step = value - previousValue;
+        if (((target > startValue) && (step < 0)) ||
+            ((target < startValue) && (step > 0)))
+        {
+            move.isMonotonic = nwFalse;
+        }
+        move.maxStep = (abs(step) > move.maxStep) ? abs(step) : move.maxStep;
+        previousValue = value;
+        move.sampleCnt++;
+    }
+    move.finalValue = value;
+
+    return move;
+}
@@ -0,0 +1,392 @@
+/*******************************************************************************
+* File Name:   test_safety_checker.c
+*
+* Description: This is the source file containing the host test,
+* related to the safety checker (fault protection) of the NexaWatt-IV.DC framework.
+* Faults are injected as ADC frames: under- and over-voltage, over-current,
+* I2t overload and out-of-range samples (0xFFFF). The gate disable write is recorded
+* by a fake GPIO wrapper. The pass and trip durations are reported in host cycles.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "test_host.h"
+#include "safety_checker.h"
+#include "hal_wrapper_gpio.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define NW_TEST_CHANNEL_CNT                 (5u)
+#define NW_TEST_CURRENT_CHANNEL             (4u)
+#define NW_TEST_RATED_LEVEL                 (500u)
+#define NW_TEST_TRIP_ENERGY                 (1000000u)
+#define NW_TEST_GATE_PORT                   (3u)
+#define NW_TEST_GATE_PIN_MSK                (0x30u)
+#define NW_TEST_CHANNEL_FAULTS_MSK          (NW_SAFETY_FAULT_CHANNEL(NW_TEST_CHANNEL_CNT) - 1u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+static const NexaWattSafetyChannelLimits nwTestChannelLimits[NW_TEST_CHANNEL_CNT] =
+{
+    { 100u, 3000u },    // Input voltage
+    { 0u, 2000u },      // Output voltage
+    { 500u, 600u },     // Auxiliary supply
+    { 10u, 4095u },     // Temperature
+    { 0u, 1000u },      // Output current
+};
+
+static const NexaWattSafetyI2tLimit nwTestI2tLimits[1u] =
+{
+    { NW_TEST_CURRENT_CHANNEL, NW_TEST_RATED_LEVEL, NW_TEST_TRIP_ENERGY },
+};
+
+static const NexaWattSafetyConfig nwTestSafetyConfig =
+{
+    nwTestChannelLimits,
+    NW_TEST_CHANNEL_CNT,
+    nwTestI2tLimits,
+    1u,
+    NW_TEST_GATE_PORT,
+    NW_TEST_GATE_PIN_MSK,
+    nwFalse,
+};
+
+static const NwAdcSample nwTestNominalSamples[NW_TEST_CHANNEL_CNT] = { 200u, 1000u, 550u, 100u, 400u };
+
+static uint32 nwTestGateWriteCnt = 0u;
+static uint8 nwTestGatePort = 0u;
+static uint8 nwTestGatePinMask = 0u;
+static nw_bool nwTestGateLevel = nwTrue;
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that initializes a checker with the test configuration and nominal samples.
+ * \param checker - A pointer to the checker.
+ * \param samples - A pointer to the frame receiving the nominal samples.
+ */
+static void NexaWatt_Test_SafetyChecker_Setup(NexaWattSafetyChecker* checker, NwAdcSample* samples);
+
+static void NexaWatt_Test_SafetyChecker_Instantaneous(void);
+static void NexaWatt_Test_SafetyChecker_Out_Of_Range(void);
+static void NexaWatt_Test_SafetyChecker_I2t(void);
+static void NexaWatt_Test_SafetyChecker_Forced_Trip(void);
+static void NexaWatt_Test_SafetyChecker_Invalid_Config(void);
+static void NexaWatt_Test_SafetyChecker_Topology_Limits(void);
+static void NexaWatt_Test_SafetyChecker_Latency(void);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattGPIOStatusResult NexaWatt_HalWrapperGpio_Port_Write(const uint8 portNum, const uint8 pinMask, const nw_bool value)
+{
+    nwTestGateWriteCnt++;
+    nwTestGatePort = portNum;
+    nwTestGatePinMask = pinMask;
+    nwTestGateLevel = value;
+
+    return NW_GPIO_SUCCESS;
+}
+
+int main(void)
+{
+    NexaWatt_Test_SafetyChecker_Instantaneous();
+    NexaWatt_Test_SafetyChecker_Out_Of_Range();
+    NexaWatt_Test_SafetyChecker_I2t();
+    NexaWatt_Test_SafetyChecker_Forced_Trip();
+    NexaWatt_Test_SafetyChecker_Invalid_Config();
+    NexaWatt_Test_SafetyChecker_Topology_Limits();
+    NexaWatt_Test_SafetyChecker_Latency();
+
+    return NexaWatt_Test_Result("safety_checker");
+}
+
+static void NexaWatt_Test_SafetyChecker_Setup(NexaWattSafetyChecker* const checker, NwAdcSample* const samples)
+{
+    uint8 channelIdx = 0u;
+
+    for (channelIdx = 0u; channelIdx < NW_TEST_CHANNEL_CNT; channelIdx++)
+    {
+        samples[channelIdx] = nwTestNominalSamples[channelIdx];
+    }
+    nwTestGateWriteCnt = 0u;
+
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Init(checker, &nwTestSafetyConfig) == NW_SAFETY_SUCCESS);
+}
+
+static void NexaWatt_Test_SafetyChecker_Instantaneous(void)
+{
+    NexaWattSafetyChecker checker;
+    NwAdcSample samples[NW_TEST_CHANNEL_CNT];
+
+    NexaWatt_Test_SafetyChecker_Setup(&checker, samples);
+
+    // Samples on the limits are no faults
+    samples[2u] = 500u;
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Check(&checker, samples) == nwTrue);
+    samples[2u] = 600u;
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Check(&checker, samples) == nwTrue);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Get_Faults(&checker) == 0u);
+    NW_TEST_EXPECT(nwTestGateWriteCnt == 0u);
+
+    // Under-voltage of the input: the gates are disabled by one masked port write
+    samples[0u] = 99u;
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Check(&checker, samples) == nwFalse);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Get_Faults(&checker) == NW_SAFETY_FAULT_CHANNEL(0u));
+    NW_TEST_EXPECT(nwTestGateWriteCnt == 1u);
+    NW_TEST_EXPECT(nwTestGatePort == NW_TEST_GATE_PORT);
+    NW_TEST_EXPECT(nwTestGatePinMask == NW_TEST_GATE_PIN_MSK);
+    NW_TEST_EXPECT(nwTestGateLevel == nwFalse);
+
+    // Over-voltage and over-current in the same frame, while tripped: latched, no second write
+    samples[0u] = 200u;
+    samples[1u] = 2001u;
+    samples[NW_TEST_CURRENT_CHANNEL] = 1001u;
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Check(&checker, samples) == nwFalse);
+    NW_TEST_EXPECT(checker.activeFaults == (NW_SAFETY_FAULT_CHANNEL(1u) | NW_SAFETY_FAULT_CHANNEL(NW_TEST_CURRENT_CHANNEL)));
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Get_Faults(&checker) ==
+                   (NW_SAFETY_FAULT_CHANNEL(0u) | NW_SAFETY_FAULT_CHANNEL(1u) | NW_SAFETY_FAULT_CHANNEL(NW_TEST_CURRENT_CHANNEL)));
+    NW_TEST_EXPECT(nwTestGateWriteCnt == 1u);
+
+    // The faults cannot be cleared while active, but once the frame is nominal again
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Clear_Faults(&checker) == NW_SAFETY_FAULT_ACTIVE);
+    samples[1u] = 2000u;
+    samples[NW_TEST_CURRENT_CHANNEL] = 400u;
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Check(&checker, samples) == nwFalse);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Clear_Faults(&checker) == NW_SAFETY_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Get_Faults(&checker) == 0u);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Check(&checker, samples) == nwTrue);
+
+    // A new fault trips the checker again
+    samples[3u] = 9u;
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Check(&checker, samples) == nwFalse);
+    NW_TEST_EXPECT(nwTestGateWriteCnt == 2u);
+    NW_TEST_EXPECT(checker.tripCnt == 2u);
+}
+
+static void NexaWatt_Test_SafetyChecker_Out_Of_Range(void)
+{
+    NexaWattSafetyChecker checker;
+    NwAdcSample samples[NW_TEST_CHANNEL_CNT];
+    uint8 channelIdx = 0u;
+
+    // Every channel with 0xFFFF alone: only its own fault, the guard bit of the neighbour is not disturbed
+    for (channelIdx = 0u; channelIdx < NW_TEST_CHANNEL_CNT; channelIdx++)
+    {
+        NexaWatt_Test_SafetyChecker_Setup(&checker, samples);
+        samples[channelIdx] = 0xFFFFu;
+
+        NW_TEST_EXPECT(NexaWatt_SafetyChecker_Check(&checker, samples) == nwFalse);
+        NW_TEST_EXPECT((checker.activeFaults & NW_TEST_CHANNEL_FAULTS_MSK) == NW_SAFETY_FAULT_CHANNEL(channelIdx));
+    }
+
+    // Values with only the bit 15 set or just above the maximum level
+    NexaWatt_Test_SafetyChecker_Setup(&checker, samples);
+    samples[0u] = 0x8000u;
+    samples[1u] = (NwAdcSample)(NW_SAFETY_MAX_LEVEL + 1u);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Check(&checker, samples) == nwFalse);
+    NW_TEST_EXPECT(checker.activeFaults == (NW_SAFETY_FAULT_CHANNEL(0u) | NW_SAFETY_FAULT_CHANNEL(1u)));
+
+    // A whole frame of 0xFFFF: every channel and the I2t limit, whose integration must not overflow
+    NexaWatt_Test_SafetyChecker_Setup(&checker, samples);
+    for (channelIdx = 0u; channelIdx < NW_TEST_CHANNEL_CNT; channelIdx++)
+    {
+        samples[channelIdx] = 0xFFFFu;
+    }
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Check(&checker, samples) == nwFalse);
+    NW_TEST_EXPECT(checker.activeFaults ==
+                   (NW_TEST_CHANNEL_FAULTS_MSK | NW_SAFETY_FAULT_I2T(0u)));
+    NW_TEST_EXPECT(checker.i2tChannels[0u].energy == (int32)NW_TEST_TRIP_ENERGY);
+    NW_TEST_EXPECT(nwTestGateWriteCnt == 1u);
+}
+
+static void NexaWatt_Test_SafetyChecker_I2t(void)
+{
+    NexaWattSafetyChecker checker;
+    NexaWattSafetyI2tLimit i2tLimit = { NW_TEST_CURRENT_CHANNEL, NW_TEST_RATED_LEVEL, NW_SAFETY_MAX_I2T_ENERGY };
+    NexaWattSafetyConfig safetyConfig = nwTestSafetyConfig;
+    NwAdcSample samples[NW_TEST_CHANNEL_CNT];
+    const uint32 overload = 600u;
+    const uint32 expectedPasses = NW_TEST_TRIP_ENERGY / ((overload * overload) - (NW_TEST_RATED_LEVEL * NW_TEST_RATED_LEVEL));
+    uint32 passCnt = 0u;
+    uint32 cycleIdx = 0u;
+
+    // The overload is within the instantaneous limit, so only the integration trips
+    NexaWatt_Test_SafetyChecker_Setup(&checker, samples);
+    samples[NW_TEST_CURRENT_CHANNEL] = (NwAdcSample)overload;
+    while ((NexaWatt_SafetyChecker_Check(&checker, samples) == nwTrue) &&
+           (passCnt <= expectedPasses))
+    {
+        passCnt++;
+    }
+    NW_TEST_EXPECT(passCnt == expectedPasses);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Get_Faults(&checker) == NW_SAFETY_FAULT_I2T(0u));
+    NW_TEST_EXPECT(nwTestGateWriteCnt == 1u);
+
+    // The energy is released below the rated level and never becomes negative
+    samples[NW_TEST_CURRENT_CHANNEL] = 0u;
+    for (cycleIdx = 0u; cycleIdx < 10u; cycleIdx++)
+    {
+        (void)NexaWatt_SafetyChecker_Check(&checker, samples);
+    }
+    NW_TEST_EXPECT(checker.i2tChannels[0u].energy == 0);
+    NW_TEST_EXPECT(checker.activeFaults == 0u);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Clear_Faults(&checker) == NW_SAFETY_SUCCESS);
+
+    // The largest trip energy with samples at the maximum level stays bounded
+    safetyConfig.i2tLimits = &i2tLimit;
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Init(&checker, &safetyConfig) == NW_SAFETY_SUCCESS);
+    samples[NW_TEST_CURRENT_CHANNEL] = 0xFFFFu;
+    for (cycleIdx = 0u; cycleIdx < 1000u; cycleIdx++)
+    {
+        (void)NexaWatt_SafetyChecker_Check(&checker, samples);
+        NW_TEST_EXPECT((checker.i2tChannels[0u].energy >= 0) && (checker.i2tChannels[0u].energy <= (int32)NW_SAFETY_MAX_I2T_ENERGY));
+    }
+    NW_TEST_EXPECT((NexaWatt_SafetyChecker_Get_Faults(&checker) & NW_SAFETY_FAULT_I2T(0u)) != 0u);
+}
+
+static void NexaWatt_Test_SafetyChecker_Forced_Trip(void)
+{
+    NexaWattSafetyChecker checker;
+    NwAdcSample samples[NW_TEST_CHANNEL_CNT];
+
+    NexaWatt_Test_SafetyChecker_Setup(&checker, samples);
+
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Force_Trip(&checker, NW_SAFETY_FAULT_CHANNEL(0u)) == NW_SAFETY_BAD_PARAM);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Force_Trip(&checker, NW_SAFETY_FAULT_TIMING) == NW_SAFETY_SUCCESS);
+    NW_TEST_EXPECT(nwTestGateWriteCnt == 1u);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Check(&checker, samples) == nwFalse);
+
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Clear_Faults(&checker) == NW_SAFETY_FAULT_ACTIVE);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Release_Forced_Faults(&checker, NW_SAFETY_FAULT_TIMING) == NW_SAFETY_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Clear_Faults(&checker) == NW_SAFETY_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Check(&checker, samples) == nwTrue);
+}
+
+static void NexaWatt_Test_SafetyChecker_Invalid_Config(void)
+{
+    NexaWattSafetyChecker checker;
+    NexaWattSafetyChannelLimits channelLimits[NW_TEST_CHANNEL_CNT];
+    NexaWattSafetyI2tLimit i2tLimit = nwTestI2tLimits[0u];
+    NexaWattSafetyConfig safetyConfig = nwTestSafetyConfig;
+    uint8 channelIdx = 0u;
+
+    for (channelIdx = 0u; channelIdx < NW_TEST_CHANNEL_CNT; channelIdx++)
+    {
+        channelLimits[channelIdx] = nwTestChannelLimits[channelIdx];
+    }
+    safetyConfig.channelLimits = channelLimits;
+    safetyConfig.i2tLimits = &i2tLimit;
+
+    channelLimits[2u].lowerLimit = 700u;
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Init(&checker, &safetyConfig) == NW_SAFETY_BAD_PARAM);
+    channelLimits[2u] = nwTestChannelLimits[2u];
+
+    channelLimits[1u].upperLimit = (NwAdcSample)(NW_SAFETY_MAX_LEVEL + 1u);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Init(&checker, &safetyConfig) == NW_SAFETY_BAD_PARAM);
+    channelLimits[1u] = nwTestChannelLimits[1u];
+
+    i2tLimit.tripEnergy = NW_SAFETY_MAX_I2T_ENERGY + 1u;
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Init(&checker, &safetyConfig) == NW_SAFETY_BAD_PARAM);
+    i2tLimit.tripEnergy = NW_TEST_TRIP_ENERGY;
+
+    i2tLimit.channel = NW_TEST_CHANNEL_CNT;
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Init(&checker, &safetyConfig) == NW_SAFETY_BAD_PARAM);
+    i2tLimit.channel = NW_TEST_CURRENT_CHANNEL;
+
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Init(&checker, &safetyConfig) == NW_SAFETY_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Init(NULL, &safetyConfig) == NW_SAFETY_BAD_PARAM);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Init(&checker, NULL) == NW_SAFETY_BAD_PARAM);
+}
+
+static void NexaWatt_Test_SafetyChecker_Topology_Limits(void)
+{
+    static const NexaWattSafetyChannelLimits topologyLimits[3u] =
+    {
+        NW_SAFETY_TOPOLOGY_VIN_LIMITS,
+        NW_SAFETY_TOPOLOGY_VOUT_LIMITS,
+        NW_SAFETY_TOPOLOGY_CURRENT_LIMITS,
+    };
+    const NwAdcSample voutMaxLevel = NW_SAFETY_Q15_TO_LEVEL(NW_TOPOLOGY_VOUT_MAX);
+    const NwAdcSample currentMaxLevel = NW_SAFETY_Q15_TO_LEVEL(NW_TOPOLOGY_CURRENT_MAX);
+    NexaWattSafetyChecker checker;
+    NexaWattSafetyConfig safetyConfig = nwTestSafetyConfig;
+    NwAdcSample samples[3u];
+
+    safetyConfig.channelLimits = topologyLimits;
+    safetyConfig.channelCnt = 3u;
+    safetyConfig.i2tCnt = 0u;
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Init(&checker, &safetyConfig) == NW_SAFETY_SUCCESS);
+
+    // The limits of the topology, converted to the codes of the 12-bit full scale
+    NW_TEST_EXPECT(topologyLimits[0u].lowerLimit == (NwAdcSample)((uint32)NW_TOPOLOGY_VIN_MIN >> 3u));
+    NW_TEST_EXPECT(voutMaxLevel == (NwAdcSample)((uint32)NW_TOPOLOGY_VOUT_MAX >> 3u));
+    NW_TEST_EXPECT(voutMaxLevel < 4096u);
+
+    samples[0u] = topologyLimits[0u].lowerLimit;
+    samples[1u] = voutMaxLevel;
+    samples[2u] = currentMaxLevel;
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Check(&checker, samples) == nwTrue);
+
+    samples[1u] = (NwAdcSample)(voutMaxLevel + 1u);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Check(&checker, samples) == nwFalse);
+    NW_TEST_EXPECT(checker.activeFaults == NW_SAFETY_FAULT_CHANNEL(1u));
+
+    samples[1u] = voutMaxLevel;
+    samples[2u] = (NwAdcSample)(currentMaxLevel + 1u);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Check(&checker, samples) == nwFalse);
+    NW_TEST_EXPECT(checker.activeFaults == NW_SAFETY_FAULT_CHANNEL(2u));
+}
+
+static void NexaWatt_Test_SafetyChecker_Latency(void)
+{
+    NexaWattSafetyChecker checker;
+    NexaWattSafetyChannelLimits channelLimits[NW_SAFETY_MAX_CHANNELS];
+    NexaWattSafetyI2tLimit i2tLimits[NW_SAFETY_MAX_I2T_CHANNELS];
+    NexaWattSafetyConfig safetyConfig = nwTestSafetyConfig;
+    NwAdcSample samples[NW_SAFETY_MAX_CHANNELS];
+    uint32 passIdx = 0u;
+    uint8 channelIdx = 0u;
+
+    // The maximum configuration gives the worst-case pass
+    for (channelIdx = 0u; channelIdx < NW_SAFETY_MAX_CHANNELS; channelIdx++)
+    {
+        channelLimits[channelIdx].lowerLimit = 100u;
+        channelLimits[channelIdx].upperLimit = 3000u;
+        samples[channelIdx] = 1000u;
+    }
+    for (channelIdx = 0u; channelIdx < NW_SAFETY_MAX_I2T_CHANNELS; channelIdx++)
+    {
+        i2tLimits[channelIdx].channel = channelIdx;
+        i2tLimits[channelIdx].ratedLevel = 2000u;
+        i2tLimits[channelIdx].tripEnergy = NW_TEST_TRIP_ENERGY;
+    }
+    safetyConfig.channelLimits = channelLimits;
+    safetyConfig.channelCnt = NW_SAFETY_MAX_CHANNELS;
+    safetyConfig.i2tLimits = i2tLimits;
+    safetyConfig.i2tCnt = NW_SAFETY_MAX_I2T_CHANNELS;
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Init(&checker, &safetyConfig) == NW_SAFETY_SUCCESS);
+
+    for (passIdx = 0u; passIdx < 10000u; passIdx++)
+    {
+        NW_TEST_EXPECT(NexaWatt_SafetyChecker_Check(&checker, samples) == nwTrue);
+    }
+    samples[NW_SAFETY_MAX_CHANNELS - 1u] = 0xFFFFu;
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Check(&checker, samples) == nwFalse);
+
+    // Host cycles, indicative only; the target figures are read from the same fields on the target
+    printf("safety_checker: worst pass %lu cycles, trip %lu cycles (host, %u channels, %u I2t channels)\n",
+           (unsigned long)checker.maxCheckCycles, (unsigned long)checker.maxTripCycles,
+           (unsigned int)NW_SAFETY_MAX_CHANNELS, (unsigned int)NW_SAFETY_MAX_I2T_CHANNELS);
+}
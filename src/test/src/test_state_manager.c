@@ -0,0 +1,308 @@
+/*******************************************************************************
+* File Name:   test_state_manager.c
+*
+* Description: This is the source file containing the host test,
+* related to the state manager and the converter state machine of the NexaWatt-IV.DC framework.
+* The converter state machine is driven by an event-sequence script. Every step posts an event
+* with the results of the application guards and checks the resulting leaf state and the trace
+* of the executed hooks (one nibble per hook, in the order of execution).
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "test_host.h"
+#include "state_manager_converter.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Identifiers of the hooks in the trace.
+ */
+#define NW_TEST_HOOK_INIT                   (0x1u)
+#define NW_TEST_HOOK_SHUTDOWN               (0x2u)
+#define NW_TEST_HOOK_PRECHARGE              (0x3u)
+#define NW_TEST_HOOK_SOFTSTART              (0x4u)
+#define NW_TEST_HOOK_RUN                    (0x5u)
+#define NW_TEST_HOOK_DERATE                 (0x6u)
+#define NW_TEST_HOOK_FAULT                  (0x7u)
+#define NW_TEST_HOOK_ACTIVE_EXIT            (0x8u)
+
+#define NW_TEST_FAULT_MASK                  (0x00010000u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+/**
+ * \brief Step of an event-sequence script: the posted event, the results of the guards and the expectations.
+ */
+typedef struct sNexaWattTestConverterStep
+{
+    NexaWattConverterEvent event;
+    uint32 eventArg;
+    nw_bool canStart;
+    nw_bool canClearFault;
+    NexaWattConverterState expectedState;
+    uint32 expectedTrace;
+} NexaWattTestConverterStep;
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+static const NexaWattTestConverterStep nwTestConverterScript[] =
+{
+    // Unhandled event, then the initialization is done
+    { NW_CONVERTER_EVENT_START,          0u,                 nwTrue,  nwFalse, NW_CONVERTER_STATE_INIT,      0x0u },
+    { NW_CONVERTER_EVENT_INIT_DONE,      0u,                 nwTrue,  nwFalse, NW_CONVERTER_STATE_SHUTDOWN,  0x2u },
+    // The start is refused by the application, then accepted
+    { NW_CONVERTER_EVENT_START,          0u,                 nwFalse, nwFalse, NW_CONVERTER_STATE_SHUTDOWN,  0x0u },
+    { NW_CONVERTER_EVENT_START,          0u,                 nwTrue,  nwFalse, NW_CONVERTER_STATE_PRECHARGE, 0x3u },
+    { NW_CONVERTER_EVENT_SOFTSTART_DONE, 0u,                 nwTrue,  nwFalse, NW_CONVERTER_STATE_PRECHARGE, 0x0u },
+    { NW_CONVERTER_EVENT_PRECHARGE_DONE, 0u,                 nwTrue,  nwFalse, NW_CONVERTER_STATE_SOFTSTART, 0x4u },
+    // The initial child of POWER is entered
+    { NW_CONVERTER_EVENT_SOFTSTART_DONE, 0u,                 nwTrue,  nwFalse, NW_CONVERTER_STATE_RUN,       0x5u },
+    { NW_CONVERTER_EVENT_DERATE,         0u,                 nwTrue,  nwFalse, NW_CONVERTER_STATE_DERATE,    0x6u },
+    { NW_CONVERTER_EVENT_DERATE_CLEAR,   0u,                 nwTrue,  nwFalse, NW_CONVERTER_STATE_RUN,       0x5u },
+    // The fault leaves ACTIVE through its exit; a repeated fault is ignored
+    { NW_CONVERTER_EVENT_FAULT,          NW_TEST_FAULT_MASK, nwTrue,  nwFalse, NW_CONVERTER_STATE_FAULT,     0x87u },
+    { NW_CONVERTER_EVENT_FAULT,          NW_TEST_FAULT_MASK, nwTrue,  nwFalse, NW_CONVERTER_STATE_FAULT,     0x0u },
+    { NW_CONVERTER_EVENT_START,          0u,                 nwTrue,  nwFalse, NW_CONVERTER_STATE_FAULT,     0x0u },
+    // The clearance is refused by the application, then accepted
+    { NW_CONVERTER_EVENT_FAULT_CLEAR,    0u,                 nwTrue,  nwFalse, NW_CONVERTER_STATE_FAULT,     0x0u },
+    { NW_CONVERTER_EVENT_FAULT_CLEAR,    0u,                 nwTrue,  nwTrue,  NW_CONVERTER_STATE_SHUTDOWN,  0x2u },
+    // A stop from any active state leaves ACTIVE through its exit
+    { NW_CONVERTER_EVENT_START,          0u,                 nwTrue,  nwFalse, NW_CONVERTER_STATE_PRECHARGE, 0x3u },
+    { NW_CONVERTER_EVENT_STOP,           0u,                 nwTrue,  nwFalse, NW_CONVERTER_STATE_SHUTDOWN,  0x82u },
+    // A fault outside ACTIVE does not execute its exit
+    { NW_CONVERTER_EVENT_FAULT,          NW_TEST_FAULT_MASK, nwTrue,  nwFalse, NW_CONVERTER_STATE_FAULT,     0x7u },
+};
+
+static nw_bool nwTestCanStart = nwFalse;
+static nw_bool nwTestCanClearFault = nwFalse;
+static uint32 nwTestTrace = 0u;
+static uint32 nwTestFaultArg = 0u;
+static void* nwTestHookContext = NULL;
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Simple helper function that appends a hook to the trace.
+ * \param context - The application context passed to the hook.
+ * \param hookId - The identifier of the hook.
+ */
+static void NexaWatt_Test_StateManager_Record(void* context, uint32 hookId);
+
+static void NexaWatt_Test_StateManager_Init_Enter(void* context, uint32 eventArg);
+static void NexaWatt_Test_StateManager_Shutdown_Enter(void* context, uint32 eventArg);
+static void NexaWatt_Test_StateManager_Precharge_Enter(void* context, uint32 eventArg);
+static void NexaWatt_Test_StateManager_Softstart_Enter(void* context, uint32 eventArg);
+static void NexaWatt_Test_StateManager_Run_Enter(void* context, uint32 eventArg);
+static void NexaWatt_Test_StateManager_Derate_Enter(void* context, uint32 eventArg);
+static void NexaWatt_Test_StateManager_Fault_Enter(void* context, uint32 eventArg);
+static void NexaWatt_Test_StateManager_Active_Exit(void* context, uint32 eventArg);
+static nw_bool NexaWatt_Test_StateManager_Can_Start(void* context, uint32 eventArg);
+static nw_bool NexaWatt_Test_StateManager_Can_Clear_Fault(void* context, uint32 eventArg);
+
+static void NexaWatt_Test_StateManager_Script(void);
+static void NexaWatt_Test_StateManager_Missing_Fault_Guard(void);
+static void NexaWatt_Test_StateManager_Queue(void);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+int main(void)
+{
+    NexaWatt_Test_StateManager_Script();
+    NexaWatt_Test_StateManager_Missing_Fault_Guard();
+    NexaWatt_Test_StateManager_Queue();
+
+    return NexaWatt_Test_Result("state_manager");
+}
+
+static const NexaWattConverterStateHooks nwTestConverterHooks =
+{
+    NexaWatt_Test_StateManager_Init_Enter,
+    NexaWatt_Test_StateManager_Shutdown_Enter,
+    NexaWatt_Test_StateManager_Precharge_Enter,
+    NexaWatt_Test_StateManager_Softstart_Enter,
+    NexaWatt_Test_StateManager_Run_Enter,
+    NexaWatt_Test_StateManager_Derate_Enter,
+    NexaWatt_Test_StateManager_Fault_Enter,
+    NexaWatt_Test_StateManager_Active_Exit,
+    NexaWatt_Test_StateManager_Can_Start,
+    NexaWatt_Test_StateManager_Can_Clear_Fault,
+    (void*)&nwTestTrace,
+};
+
+static void NexaWatt_Test_StateManager_Script(void)
+{
+    static NexaWattConverterStateMachine converter;
+    NexaWattStateMachineStats machineStats;
+    const NexaWattTestConverterStep* step = NULL;
+    uint32 stepIdx = 0u;
+
+    NW_TEST_EXPECT(NexaWatt_StateManager_Converter_Init(&converter, &nwTestConverterHooks) == NW_STATE_MANAGER_SUCCESS);
+
+    nwTestTrace = 0u;
+    NW_TEST_EXPECT(NexaWatt_StateManager_Start(&converter.machine) == NW_STATE_MANAGER_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_StateManager_Get_State(&converter.machine) == NW_CONVERTER_STATE_INIT);
+    NW_TEST_EXPECT(nwTestTrace == NW_TEST_HOOK_INIT);
+    NW_TEST_EXPECT(nwTestHookContext == (void*)&nwTestTrace);
+
+    for (stepIdx = 0u; stepIdx < (sizeof(nwTestConverterScript) / sizeof(nwTestConverterScript[0u])); stepIdx++)
+    {
+        step = &nwTestConverterScript[stepIdx];
+        nwTestCanStart = step->canStart;
+        nwTestCanClearFault = step->canClearFault;
+        nwTestTrace = 0u;
+
+        NW_TEST_EXPECT(NexaWatt_StateManager_Post(&converter.machine, (uint8)step->event, step->eventArg) == NW_STATE_MANAGER_SUCCESS);
+        NW_TEST_EXPECT(NexaWatt_StateManager_Process(&converter.machine, NW_STATE_PROCESS_ALL) == 1u);
+
+        if ((NexaWatt_StateManager_Get_State(&converter.machine) != step->expectedState) ||
+            (nwTestTrace != step->expectedTrace))
+        {
+            printf("state_manager: step %lu: state %u trace 0x%lx\n", (unsigned long)stepIdx,
+                   (unsigned int)NexaWatt_StateManager_Get_State(&converter.machine), (unsigned long)nwTestTrace);
+        }
+        NW_TEST_EXPECT(NexaWatt_StateManager_Get_State(&converter.machine) == step->expectedState);
+        NW_TEST_EXPECT(nwTestTrace == step->expectedTrace);
+    }
+
+    NW_TEST_EXPECT(nwTestFaultArg == NW_TEST_FAULT_MASK);
+    NW_TEST_EXPECT(NexaWatt_StateManager_Is_In_State(&converter.machine, NW_CONVERTER_STATE_TOP) == nwTrue);
+    NW_TEST_EXPECT(NexaWatt_StateManager_Is_In_State(&converter.machine, NW_CONVERTER_STATE_ACTIVE) == nwFalse);
+
+    NexaWatt_StateManager_Get_Stats(&converter.machine, &machineStats);
+    NW_TEST_EXPECT(machineStats.processedCnt == (sizeof(nwTestConverterScript) / sizeof(nwTestConverterScript[0u])));
+    NW_TEST_EXPECT(machineStats.droppedCnt == 0u);
+
+    printf("state_manager: worst dispatch %lu cycles (host)\n", (unsigned long)machineStats.maxProcessCycles);
+}
+
+static void NexaWatt_Test_StateManager_Missing_Fault_Guard(void)
+{
+    static NexaWattConverterStateMachine converter;
+    NexaWattConverterStateHooks converterHooks = nwTestConverterHooks;
+
+    // Without the fault clearance guard the converter could leave FAULT unconfirmed
+    converterHooks.canClearFault = NULL;
+    NW_TEST_EXPECT(NexaWatt_StateManager_Converter_Init(&converter, &converterHooks) == NW_STATE_MANAGER_BAD_PARAM);
+
+    // The other hooks are optional
+    converterHooks = nwTestConverterHooks;
+    converterHooks.canStart = NULL;
+    converterHooks.onActiveExit = NULL;
+    NW_TEST_EXPECT(NexaWatt_StateManager_Converter_Init(&converter, &converterHooks) == NW_STATE_MANAGER_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_StateManager_Converter_Init(NULL, &converterHooks) == NW_STATE_MANAGER_BAD_PARAM);
+    NW_TEST_EXPECT(NexaWatt_StateManager_Converter_Init(&converter, NULL) == NW_STATE_MANAGER_BAD_PARAM);
+}
+
+static void NexaWatt_Test_StateManager_Queue(void)
+{
+    static NexaWattConverterStateMachine converter;
+    NexaWattStateMachineStats machineStats;
+    uint32 eventIdx = 0u;
+
+    NW_TEST_EXPECT(NexaWatt_StateManager_Converter_Init(&converter, &nwTestConverterHooks) == NW_STATE_MANAGER_SUCCESS);
+
+    // The events posted before the start wait in the queue and are processed in the order of their posting
+    NW_TEST_EXPECT(NexaWatt_StateManager_Post(&converter.machine, NW_CONVERTER_EVENT_INIT_DONE, 0u) == NW_STATE_MANAGER_SUCCESS);
+    nwTestCanStart = nwTrue;
+    NW_TEST_EXPECT(NexaWatt_StateManager_Post(&converter.machine, NW_CONVERTER_EVENT_START, 0u) == NW_STATE_MANAGER_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_StateManager_Post(&converter.machine, NW_CONVERTER_EVENT_CNT, 0u) == NW_STATE_MANAGER_BAD_PARAM);
+    NW_TEST_EXPECT(NexaWatt_StateManager_Start(&converter.machine) == NW_STATE_MANAGER_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_StateManager_Start(&converter.machine) == NW_STATE_MANAGER_BAD_PARAM);
+    NW_TEST_EXPECT(NexaWatt_StateManager_Process(&converter.machine, NW_STATE_PROCESS_ALL) == 2u);
+    NW_TEST_EXPECT(NexaWatt_StateManager_Get_State(&converter.machine) == NW_CONVERTER_STATE_PRECHARGE);
+
+    // A full queue drops the event and counts it
+    for (eventIdx = 0u; eventIdx < NW_STATE_EVENT_QUEUE_LEN; eventIdx++)
+    {
+        (void)NexaWatt_StateManager_Post(&converter.machine, NW_CONVERTER_EVENT_DERATE, 0u);
+    }
+    NW_TEST_EXPECT(NexaWatt_StateManager_Post(&converter.machine, NW_CONVERTER_EVENT_FAULT, 0u) == NW_STATE_MANAGER_QUEUE_FULL);
+    NW_TEST_EXPECT(NexaWatt_StateManager_Process(&converter.machine, 1u) == 1u);
+    NW_TEST_EXPECT(NexaWatt_StateManager_Post(&converter.machine, NW_CONVERTER_EVENT_FAULT, 0u) == NW_STATE_MANAGER_SUCCESS);
+    (void)NexaWatt_StateManager_Process(&converter.machine, NW_STATE_PROCESS_ALL);
+    NW_TEST_EXPECT(NexaWatt_StateManager_Get_State(&converter.machine) == NW_CONVERTER_STATE_FAULT);
+
+    NexaWatt_StateManager_Get_Stats(&converter.machine, &machineStats);
+    NW_TEST_EXPECT(machineStats.droppedCnt >= 1u);
+    NW_TEST_EXPECT(machineStats.unhandledCnt >= 1u);
+}
+
+static void NexaWatt_Test_StateManager_Record(void* const context, const uint32 hookId)
+{
+    nwTestHookContext = context;
+    nwTestTrace = (nwTestTrace << 4u) | hookId;
+}
+
+static void NexaWatt_Test_StateManager_Init_Enter(void* const context, const uint32 eventArg)
+{
+    (void)eventArg;
+    NexaWatt_Test_StateManager_Record(context, NW_TEST_HOOK_INIT);
+}
+
+static void NexaWatt_Test_StateManager_Shutdown_Enter(void* const context, const uint32 eventArg)
+{
+    (void)eventArg;
+    NexaWatt_Test_StateManager_Record(context, NW_TEST_HOOK_SHUTDOWN);
+}
+
+static void NexaWatt_Test_StateManager_Precharge_Enter(void* const context, const uint32 eventArg)
+{
+    (void)eventArg;
+    NexaWatt_Test_StateManager_Record(context, NW_TEST_HOOK_PRECHARGE);
+}
+
+static void NexaWatt_Test_StateManager_Softstart_Enter(void* const context, const uint32 eventArg)
+{
+    (void)eventArg;
+    NexaWatt_Test_StateManager_Record(context, NW_TEST_HOOK_SOFTSTART);
+}
+
+static void NexaWatt_Test_StateManager_Run_Enter(void* const context, const uint32 eventArg)
+{
+    (void)eventArg;
+    NexaWatt_Test_StateManager_Record(context, NW_TEST_HOOK_RUN);
+}
+
+static void NexaWatt_Test_StateManager_Derate_Enter(void* const context, const uint32 eventArg)
+{
+    (void)eventArg;
+    NexaWatt_Test_StateManager_Record(context, NW_TEST_HOOK_DERATE);
+}
+
+static void NexaWatt_Test_StateManager_Fault_Enter(void* const context, const uint32 eventArg)
+{
+    nwTestFaultArg = eventArg;
+    NexaWatt_Test_StateManager_Record(context, NW_TEST_HOOK_FAULT);
+}
+
+static void NexaWatt_Test_StateManager_Active_Exit(void* const context, const uint32 eventArg)
+{
+    (void)eventArg;
+    NexaWatt_Test_StateManager_Record(context, NW_TEST_HOOK_ACTIVE_EXIT);
+}
+
+static nw_bool NexaWatt_Test_StateManager_Can_Start(void* const context, const uint32 eventArg)
+{
+    (void)context;
+    (void)eventArg;
+
+    return nwTestCanStart;
+}
+
+static nw_bool NexaWatt_Test_StateManager_Can_Clear_Fault(void* const context, const uint32 eventArg)
+{
+    (void)context;
+    (void)eventArg;
+
+    return nwTestCanClearFault;
+}
@@ -0,0 +1,456 @@
+/*******************************************************************************
+* File Name:   test_watchdog.c
+*
+* Description: This is the source file containing the host test,
+* related to the timing watchdog of the Safety Checker of the NexaWatt-IV.DC framework.
+* The control interrupt and the main loop are simulated on the host cycle counter: the
+* periods are started by busy waiting. The window margins are about 10 ms on a 2 GHz host,
+* above the preemption of the test process on a loaded host. The simulated hardware
+* watchdog is bound through the HAL Context and advanced by the nominal period.
+* The test checks the violation counting, the leaky violation score, the escalation
+* order, the stall detection of the main loop poll, the kick gating and the reset.
+*
+* Related Document: See README.md
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "test_host.h"
+#include "safety_checker_watchdog.h"
+#include "hal_context_bind.h"
+#include "hal_wrapper_gpio.h"
+#include "hal_host_sim_wdt.h"
+#include "platform_cycle_counter.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/**
+ * \brief Nominal period of the simulated control interrupt in host cycles and the simulated time of a period.
+ * The clean periods pass with a margin of half a period to the late start and to the budget,
+ * the early start (a quarter of the period) with a margin of half a period to the early tolerance.
+ */
+#define NW_TEST_PERIOD_CYCLES               (40000000u)
+#define NW_TEST_EARLY_TOLERANCE_CYCLES      (NW_TEST_PERIOD_CYCLES / 4u)
+#define NW_TEST_LATE_TOLERANCE_CYCLES       (NW_TEST_PERIOD_CYCLES / 2u)
+#define NW_TEST_BUDGET_CYCLES               (NW_TEST_PERIOD_CYCLES / 2u)
+#define NW_TEST_EARLY_CYCLES                (NW_TEST_PERIOD_CYCLES / 4u)
+#define NW_TEST_OVERRUN_CYCLES              (NW_TEST_PERIOD_CYCLES)
+#define NW_TEST_PERIOD_US                   (100u)
+
+/**
+ * \brief The hardware watchdog expires after 10 periods without a kick and is kicked every 4 periods.
+ */
+#define NW_TEST_WDT_TIMEOUT_US              (10u * NW_TEST_PERIOD_US)
+#define NW_TEST_KICK_DIVIDER                (4u)
+
+#define NW_TEST_MAX_EVENTS                  (8u)
+
+/*******************************************************************************
+* Type definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Local Variables
+*******************************************************************************/
+static const NexaWattSafetyChannelLimits nwTestChannelLimits[1u] =
+{
+    { 0u, 4095u },
+};
+
+static const NexaWattSafetyConfig nwTestSafetyConfig =
+{
+    nwTestChannelLimits,
+    1u,
+    NULL,
+    0u,
+    1u,
+    0x01u,
+    nwTrue,
+};
+
+static const NexaWattSafetyWatchdogLevel nwTestLevels[3u] =
+{
+    { 3u, NW_SAFETY_WDG_ACTION_NOTIFY },
+    { 6u, NW_SAFETY_WDG_ACTION_SAFE_SHUTDOWN },
+    { 10u, NW_SAFETY_WDG_ACTION_RESET },
+};
+
+static NexaWattSafetyChecker nwTestChecker;
+static NexaWattSafetyWatchdog nwTestWatchdog;
+
+static uint32 nwTestEvents[NW_TEST_MAX_EVENTS];
+static uint32 nwTestEventCnt = 0u;
+static uint32 nwTestKickCnt = 0u;
+static uint32 nwTestResetCnt = 0u;
+
+/*******************************************************************************
+* Local Function Prototypes
+*******************************************************************************/
+/**
+ * \brief Handler of the watchdog notifications of the test: records the event arguments.
+ * \param eventContext - Not used.
+ * \param eventArg - The packed level and violation flags.
+ */
+static void NexaWatt_Test_Watchdog_Notify_Handler(void* eventContext, uint32 eventArg);
+
+/**
+ * \brief Callback of the hardware watchdog kick, bound in the HAL Context: counts the kicks.
+ */
+static void NexaWatt_Test_Watchdog_Kick_Callback(void);
+
+/**
+ * \brief Reset handler of the simulated hardware watchdog: counts the resets.
+ */
+static void NexaWatt_Test_Watchdog_Reset_Handler(void);
+
+/**
+ * \brief Simple helper function that initializes the safety checker, the simulated hardware watchdog and the timing watchdog.
+ */
+static void NexaWatt_Test_Watchdog_Setup(void);
+
+/**
+ * \brief Simple helper function that busy waits on the cycle counter.
+ * \param startCycles - The cycle counter value, the wait is counted from.
+ * \param waitCycles - The number of cycles to wait.
+ */
+static void NexaWatt_Test_Watchdog_Wait(uint32 startCycles, uint32 waitCycles);
+
+/**
+ * \brief Simple helper function that simulates periods of the control interrupt, each followed by a poll of the main loop.
+ * \param periodCnt - The number of periods.
+ * \param intervalCycles - The interval from the start of the previous period.
+ * \param execCycles - The execution time of the period.
+ * \param isPolled - nwTrue, if the main loop polls the watchdog after the period.
+ * \return The result of the last period end.
+ */
+static nw_bool NexaWatt_Test_Watchdog_Run(uint32 periodCnt, uint32 intervalCycles, uint32 execCycles, nw_bool isPolled);
+
+static void NexaWatt_Test_Watchdog_Counting(void);
+static void NexaWatt_Test_Watchdog_Leaky_Score(void);
+static void NexaWatt_Test_Watchdog_Escalation(void);
+static void NexaWatt_Test_Watchdog_Stall(void);
+static void NexaWatt_Test_Watchdog_Kick_Gating(void);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+NexaWattGPIOStatusResult NexaWatt_HalWrapperGpio_Port_Write(const uint8 portNum, const uint8 pinMask, const nw_bool value)
+{
+    (void)portNum;
+    (void)pinMask;
+    (void)value;
+
+    return NW_GPIO_SUCCESS;
+}
+
+NexaWattMiniOsStatusResult NexaWatt_MiniOs_Event_Post(const NwMiniOsEventHandler eventHandler, void* const eventContext, const uint32 eventArg)
+{
+    eventHandler(eventContext, eventArg);
+
+    return NW_MINI_OS_SUCCESS;
+}
+
+int main(void)
+{
+    NexaWattHalContextFunction function = { NULL, NULL, NULL };
+
+    NexaWatt_Platform_Cycle_Counter_Init();
+
+    NexaWatt_HalContext_Init();
+    function.fncPtr = (void*)NexaWatt_Hal_Host_Sim_Wdt_Init;
+    NW_TEST_EXPECT(NexaWatt_HalContext_Bind_Init_Function(NW_HAL_WDT_INIT, &function) == NW_HAL_CONTEXT_OK);
+    function.fncPtr = (void*)NexaWatt_Hal_Host_Sim_Wdt_Kick;
+    function.fncCallback = NexaWatt_Test_Watchdog_Kick_Callback;
+    NW_TEST_EXPECT(NexaWatt_HalContext_Bind_Function(NW_HAL_WDT_KICK, &function) == NW_HAL_CONTEXT_OK);
+    NexaWatt_Hal_Host_Sim_Wdt_Set_Reset_Handler(NexaWatt_Test_Watchdog_Reset_Handler);
+
+    NexaWatt_Test_Watchdog_Counting();
+    NexaWatt_Test_Watchdog_Leaky_Score();
+    NexaWatt_Test_Watchdog_Escalation();
+    NexaWatt_Test_Watchdog_Stall();
+    NexaWatt_Test_Watchdog_Kick_Gating();
+
+    return NexaWatt_Test_Result("watchdog");
+}
+
+static void NexaWatt_Test_Watchdog_Counting(void)
+{
+    NexaWattSafetyWatchdogStats watchdogStats;
+
+    NexaWatt_Test_Watchdog_Setup();
+
+    // The first period has no previous start, then the starts are within the window
+    NW_TEST_EXPECT(NexaWatt_Test_Watchdog_Run(5u, NW_TEST_PERIOD_CYCLES, 0u, nwTrue) == nwTrue);
+    NexaWatt_SafetyChecker_Watchdog_Get_Stats(&nwTestWatchdog, &watchdogStats);
+    NW_TEST_EXPECT(watchdogStats.periodCnt == 5u);
+    NW_TEST_EXPECT((watchdogStats.earlyStartCnt == 0u) && (watchdogStats.lateStartCnt == 0u) && (watchdogStats.overrunCnt == 0u));
+    NW_TEST_EXPECT(watchdogStats.maxJitterCycles < NW_TEST_LATE_TOLERANCE_CYCLES);
+
+    // Three quarters of a period early
+    (void)NexaWatt_Test_Watchdog_Run(1u, NW_TEST_EARLY_CYCLES, 0u, nwTrue);
+    NexaWatt_SafetyChecker_Watchdog_Get_Stats(&nwTestWatchdog, &watchdogStats);
+    NW_TEST_EXPECT(watchdogStats.earlyStartCnt == 1u);
+    NW_TEST_EXPECT(watchdogStats.lastJitterCycles > NW_TEST_EARLY_TOLERANCE_CYCLES);
+
+    // Three periods after the previous start: late, with two missed periods in between
+    (void)NexaWatt_Test_Watchdog_Run(1u, 3u * NW_TEST_PERIOD_CYCLES, 0u, nwTrue);
+    NexaWatt_SafetyChecker_Watchdog_Get_Stats(&nwTestWatchdog, &watchdogStats);
+    NW_TEST_EXPECT(watchdogStats.lateStartCnt == 1u);
+    NW_TEST_EXPECT(watchdogStats.missedPeriodCnt == 2u);
+    NW_TEST_EXPECT(watchdogStats.maxJitterCycles >= 2u * NW_TEST_PERIOD_CYCLES);
+
+    // The execution takes twice the budget
+    (void)NexaWatt_Test_Watchdog_Run(1u, NW_TEST_PERIOD_CYCLES, NW_TEST_OVERRUN_CYCLES, nwTrue);
+    NexaWatt_SafetyChecker_Watchdog_Get_Stats(&nwTestWatchdog, &watchdogStats);
+    NW_TEST_EXPECT(watchdogStats.overrunCnt == 1u);
+    NW_TEST_EXPECT(watchdogStats.lastExecCycles >= NW_TEST_OVERRUN_CYCLES);
+    NW_TEST_EXPECT((watchdogStats.earlyStartCnt == 1u) && (watchdogStats.lateStartCnt == 1u));
+    NW_TEST_EXPECT(watchdogStats.periodCnt == 8u);
+
+    // The three violations in a row reach the first level, reported with the flags of the third period
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Watchdog_Get_Level(&nwTestWatchdog) == 1u);
+    NW_TEST_EXPECT(nwTestEventCnt == 1u);
+    NW_TEST_EXPECT(NW_SAFETY_WDG_EVENT_GET_VIOLATIONS(nwTestEvents[0u]) == NW_SAFETY_WDG_VIOLATION_OVERRUN);
+    printf("watchdog: max jitter %u cycles, max execution %u cycles\n", (unsigned)watchdogStats.maxJitterCycles, (unsigned)watchdogStats.maxExecCycles);
+}
+
+static void NexaWatt_Test_Watchdog_Leaky_Score(void)
+{
+    uint32 cycleIdx = 0u;
+
+    NexaWatt_Test_Watchdog_Setup();
+    (void)NexaWatt_Test_Watchdog_Run(1u, NW_TEST_PERIOD_CYCLES, 0u, nwTrue);
+
+    // A violation in every third period is drained by the two clean periods
+    for (cycleIdx = 0u; cycleIdx < 6u; cycleIdx++)
+    {
+        (void)NexaWatt_Test_Watchdog_Run(1u, NW_TEST_PERIOD_CYCLES, NW_TEST_OVERRUN_CYCLES, nwTrue);
+        (void)NexaWatt_Test_Watchdog_Run(2u, NW_TEST_PERIOD_CYCLES, 0u, nwTrue);
+    }
+    NW_TEST_EXPECT(nwTestWatchdog.violationScore == 0u);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Watchdog_Get_Level(&nwTestWatchdog) == 0u);
+
+    // A violation in every second period accumulates: the score reaches the first level (6) after five cycles
+    for (cycleIdx = 0u; (cycleIdx < 10u) && (NexaWatt_SafetyChecker_Watchdog_Get_Level(&nwTestWatchdog) == 0u); cycleIdx++)
+    {
+        (void)NexaWatt_Test_Watchdog_Run(1u, NW_TEST_PERIOD_CYCLES, 0u, nwTrue);
+        (void)NexaWatt_Test_Watchdog_Run(1u, NW_TEST_PERIOD_CYCLES, NW_TEST_OVERRUN_CYCLES, nwTrue);
+    }
+    NW_TEST_EXPECT(cycleIdx == 5u);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Watchdog_Get_Level(&nwTestWatchdog) == 1u);
+    NW_TEST_EXPECT(nwTestEventCnt == 1u);
+    NW_TEST_EXPECT(NW_SAFETY_WDG_EVENT_GET_VIOLATIONS(nwTestEvents[0u]) == NW_SAFETY_WDG_VIOLATION_OVERRUN);
+    NW_TEST_EXPECT(nwTestWatchdog.isShutdown == nwFalse);
+}
+
+static void NexaWatt_Test_Watchdog_Escalation(void)
+{
+    uint32 periodIdx = 0u;
+    uint32 kickCnt = 0u;
+    uint32 resetCnt = 0u;
+
+    NexaWatt_Test_Watchdog_Setup();
+    (void)NexaWatt_Test_Watchdog_Run(1u, NW_TEST_PERIOD_CYCLES, 0u, nwTrue);
+
+    // Consecutive overruns: notification after 3, safe shutdown after 6
+    NW_TEST_EXPECT(NexaWatt_Test_Watchdog_Run(2u, NW_TEST_PERIOD_CYCLES, NW_TEST_OVERRUN_CYCLES, nwTrue) == nwTrue);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Watchdog_Get_Level(&nwTestWatchdog) == 0u);
+    NW_TEST_EXPECT(NexaWatt_Test_Watchdog_Run(1u, NW_TEST_PERIOD_CYCLES, NW_TEST_OVERRUN_CYCLES, nwTrue) == nwTrue);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Watchdog_Get_Level(&nwTestWatchdog) == 1u);
+    NW_TEST_EXPECT((nwTestEventCnt == 1u) && (NW_SAFETY_WDG_EVENT_GET_LEVEL(nwTestEvents[0u]) == 1u));
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Get_Faults(&nwTestChecker) == 0u);
+
+    NW_TEST_EXPECT(NexaWatt_Test_Watchdog_Run(2u, NW_TEST_PERIOD_CYCLES, NW_TEST_OVERRUN_CYCLES, nwTrue) == nwTrue);
+    NW_TEST_EXPECT(NexaWatt_Test_Watchdog_Run(1u, NW_TEST_PERIOD_CYCLES, NW_TEST_OVERRUN_CYCLES, nwTrue) == nwFalse);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Watchdog_Get_Level(&nwTestWatchdog) == 2u);
+    NW_TEST_EXPECT((NexaWatt_SafetyChecker_Get_Faults(&nwTestChecker) & NW_SAFETY_FAULT_TIMING) != 0u);
+    NW_TEST_EXPECT(nwTestChecker.isTripped == nwTrue);
+    NW_TEST_EXPECT(nwTestEventCnt == 1u);
+
+    // The safe shutdown keeps kicking the hardware watchdog, while the main loop runs
+    kickCnt = nwTestKickCnt;
+    NW_TEST_EXPECT(NexaWatt_Test_Watchdog_Run(3u, NW_TEST_PERIOD_CYCLES, NW_TEST_OVERRUN_CYCLES, nwTrue) == nwFalse);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Watchdog_Get_Level(&nwTestWatchdog) == 2u);
+    NW_TEST_EXPECT(nwTestKickCnt > kickCnt);
+
+    // The reset level stops the kicks: the hardware watchdog resets the device, although the main loop still polls
+    NW_TEST_EXPECT(NexaWatt_Test_Watchdog_Run(1u, NW_TEST_PERIOD_CYCLES, NW_TEST_OVERRUN_CYCLES, nwTrue) == nwFalse);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Watchdog_Get_Level(&nwTestWatchdog) == 3u);
+    NW_TEST_EXPECT(nwTestWatchdog.isKickStopped == nwTrue);
+    kickCnt = nwTestKickCnt;
+    resetCnt = nwTestResetCnt;
+    for (periodIdx = 0u; (periodIdx < 20u) && (nwTestResetCnt == resetCnt); periodIdx++)
+    {
+        (void)NexaWatt_Test_Watchdog_Run(1u, NW_TEST_PERIOD_CYCLES, 0u, nwTrue);
+    }
+    NW_TEST_EXPECT(nwTestKickCnt == kickCnt);
+    NW_TEST_EXPECT(nwTestResetCnt == (resetCnt + 1u));
+    NW_TEST_EXPECT(NexaWatt_Hal_Host_Sim_Wdt_Get_Reset_Status() == nwTrue);
+    NW_TEST_EXPECT(periodIdx <= (NW_TEST_WDT_TIMEOUT_US / NW_TEST_PERIOD_US));
+
+    // The reset returns to the level 0 and releases the forced timing fault, so the faults can be cleared
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Watchdog_Reset(&nwTestWatchdog) == NW_SAFETY_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Watchdog_Get_Level(&nwTestWatchdog) == 0u);
+    NW_TEST_EXPECT((nwTestChecker.forcedFaults & NW_SAFETY_FAULT_TIMING) == 0u);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Clear_Faults(&nwTestChecker) == NW_SAFETY_SUCCESS);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Get_Faults(&nwTestChecker) == 0u);
+    NW_TEST_EXPECT(NexaWatt_Test_Watchdog_Run(3u, NW_TEST_PERIOD_CYCLES, 0u, nwTrue) == nwTrue);
+    NW_TEST_EXPECT(nwTestWatchdog.isKickStopped == nwFalse);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Watchdog_Reset(NULL) == NW_SAFETY_BAD_PARAM);
+}
+
+static void NexaWatt_Test_Watchdog_Stall(void)
+{
+    NexaWattSafetyWatchdogStats watchdogStats;
+    uint32 startCycles = 0u;
+
+    NexaWatt_Test_Watchdog_Setup();
+    (void)NexaWatt_Test_Watchdog_Run(3u, NW_TEST_PERIOD_CYCLES, 0u, nwTrue);
+
+    // The main loop tolerates the interrupt silence up to the stall time
+    startCycles = nwTestWatchdog.lastStartCycles;
+    NexaWatt_Test_Watchdog_Wait(startCycles, 2u * NW_TEST_PERIOD_CYCLES);
+    NexaWatt_SafetyChecker_Watchdog_Poll(&nwTestWatchdog);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Watchdog_Get_Level(&nwTestWatchdog) == 0u);
+
+    // The stopped interrupt cannot escalate by itself: the poll executes all levels in their order
+    NexaWatt_Test_Watchdog_Wait(startCycles, 4u * NW_TEST_PERIOD_CYCLES);
+    NexaWatt_SafetyChecker_Watchdog_Poll(&nwTestWatchdog);
+    NexaWatt_SafetyChecker_Watchdog_Get_Stats(&nwTestWatchdog, &watchdogStats);
+    NW_TEST_EXPECT(watchdogStats.stallCnt == 1u);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Watchdog_Get_Level(&nwTestWatchdog) == 3u);
+    NW_TEST_EXPECT(nwTestEventCnt == 1u);
+    NW_TEST_EXPECT(NW_SAFETY_WDG_EVENT_GET_LEVEL(nwTestEvents[0u]) == 1u);
+    NW_TEST_EXPECT(NW_SAFETY_WDG_EVENT_GET_VIOLATIONS(nwTestEvents[0u]) == NW_SAFETY_WDG_VIOLATION_STALL);
+    NW_TEST_EXPECT((NexaWatt_SafetyChecker_Get_Faults(&nwTestChecker) & NW_SAFETY_FAULT_TIMING) != 0u);
+    NW_TEST_EXPECT(nwTestWatchdog.isKickStopped == nwTrue);
+
+    // The shutdown is detected once
+    NexaWatt_SafetyChecker_Watchdog_Poll(&nwTestWatchdog);
+    NexaWatt_SafetyChecker_Watchdog_Get_Stats(&nwTestWatchdog, &watchdogStats);
+    NW_TEST_EXPECT(watchdogStats.stallCnt == 1u);
+
+    // The reset restarts the supervision with the next period, so the silence is not counted again
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Watchdog_Reset(&nwTestWatchdog) == NW_SAFETY_SUCCESS);
+    NexaWatt_SafetyChecker_Watchdog_Poll(&nwTestWatchdog);
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Watchdog_Get_Level(&nwTestWatchdog) == 0u);
+    NW_TEST_EXPECT((nwTestChecker.forcedFaults & NW_SAFETY_FAULT_TIMING) == 0u);
+}
+
+static void NexaWatt_Test_Watchdog_Kick_Gating(void)
+{
+    uint32 kickCnt = 0u;
+    uint32 resetCnt = 0u;
+    uint32 periodIdx = 0u;
+
+    NexaWatt_Test_Watchdog_Setup();
+
+    // Both loops running: a kick every kick divider periods, the hardware watchdog never expires
+    resetCnt = nwTestResetCnt;
+    NW_TEST_EXPECT(NexaWatt_Test_Watchdog_Run(3u * NW_TEST_KICK_DIVIDER, NW_TEST_PERIOD_CYCLES, 0u, nwTrue) == nwTrue);
+    NW_TEST_EXPECT(nwTestKickCnt == 3u);
+    NW_TEST_EXPECT(nwTestResetCnt == resetCnt);
+
+    // The main loop stops polling: after the kick confirmed by its last poll, the kicks stop, while the control interrupt keeps running
+    kickCnt = nwTestKickCnt;
+    for (periodIdx = 0u; (periodIdx < 20u) && (nwTestResetCnt == resetCnt); periodIdx++)
+    {
+        NW_TEST_EXPECT(NexaWatt_Test_Watchdog_Run(1u, NW_TEST_PERIOD_CYCLES, 0u, nwFalse) == nwTrue);
+    }
+    printf("watchdog: hardware reset %u periods after the main loop stopped\n", (unsigned)periodIdx);
+    NW_TEST_EXPECT(nwTestKickCnt <= (kickCnt + 1u));
+    NW_TEST_EXPECT(nwTestResetCnt == (resetCnt + 1u));
+    NW_TEST_EXPECT(periodIdx <= (NW_TEST_KICK_DIVIDER + (NW_TEST_WDT_TIMEOUT_US / NW_TEST_PERIOD_US)));
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Watchdog_Get_Level(&nwTestWatchdog) == 0u);
+}
+
+static void NexaWatt_Test_Watchdog_Notify_Handler(void* const eventContext, const uint32 eventArg)
+{
+    (void)eventContext;
+
+    if (nwTestEventCnt < NW_TEST_MAX_EVENTS)
+    {
+        nwTestEvents[nwTestEventCnt] = eventArg;
+    }
+    nwTestEventCnt++;
+}
+
+static void NexaWatt_Test_Watchdog_Kick_Callback(void)
+{
+    nwTestKickCnt++;
+}
+
+static void NexaWatt_Test_Watchdog_Reset_Handler(void)
+{
+    nwTestResetCnt++;
+}
+
+static void NexaWatt_Test_Watchdog_Setup(void)
+{
+    NexaWattSafetyWatchdogConfig watchdogConfig;
+
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Init(&nwTestChecker, &nwTestSafetyConfig) == NW_SAFETY_SUCCESS);
+
+    watchdogConfig.periodCycles = NW_TEST_PERIOD_CYCLES;
+    watchdogConfig.earlyToleranceCycles = NW_TEST_EARLY_TOLERANCE_CYCLES;
+    watchdogConfig.lateToleranceCycles = NW_TEST_LATE_TOLERANCE_CYCLES;
+    watchdogConfig.budgetCycles = NW_TEST_BUDGET_CYCLES;
+    watchdogConfig.stallCycles = 3u * NW_TEST_PERIOD_CYCLES;
+    watchdogConfig.levels = nwTestLevels;
+    watchdogConfig.levelCnt = 3u;
+    watchdogConfig.safetyChecker = &nwTestChecker;
+    watchdogConfig.notifyHandler = NexaWatt_Test_Watchdog_Notify_Handler;
+    watchdogConfig.notifyContext = NULL;
+    watchdogConfig.hardwareTimeoutUs = NW_TEST_WDT_TIMEOUT_US;
+    watchdogConfig.kickDivider = NW_TEST_KICK_DIVIDER;
+
+    // The escalation must end in a shutdown and the reset needs the hardware watchdog
+    watchdogConfig.levelCnt = 1u;
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Watchdog_Init(&nwTestWatchdog, &watchdogConfig) == NW_SAFETY_BAD_PARAM);
+    watchdogConfig.levelCnt = 3u;
+    watchdogConfig.hardwareTimeoutUs = 0u;
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Watchdog_Init(&nwTestWatchdog, &watchdogConfig) == NW_SAFETY_BAD_PARAM);
+    watchdogConfig.hardwareTimeoutUs = NW_TEST_WDT_TIMEOUT_US;
+
+    NW_TEST_EXPECT(NexaWatt_SafetyChecker_Watchdog_Init(&nwTestWatchdog, &watchdogConfig) == NW_SAFETY_SUCCESS);
+
+    nwTestEventCnt = 0u;
+    nwTestKickCnt = 0u;
+}
+
+static void NexaWatt_Test_Watchdog_Wait(const uint32 startCycles, const uint32 waitCycles)
+{
+    while ((NexaWatt_Platform_Cycle_Counter_Get() - startCycles) < waitCycles)
+    {
+        // Busy wait
+    }
+}
+
+static nw_bool NexaWatt_Test_Watchdog_Run(const uint32 periodCnt, const uint32 intervalCycles, const uint32 execCycles, const nw_bool isPolled)
+{
+    nw_bool retVal = nwTrue;
+    uint32 periodIdx = 0u;
+
+    for (periodIdx = 0u; periodIdx < periodCnt; periodIdx++)
+    {
+        if (nwTestWatchdog.hasStarted == nwTrue)
+        {
+            NexaWatt_Test_Watchdog_Wait(nwTestWatchdog.lastStartCycles, intervalCycles);
+        }
+
+        NexaWatt_SafetyChecker_Watchdog_Period_Start(&nwTestWatchdog);
+        NexaWatt_Test_Watchdog_Wait(nwTestWatchdog.lastStartCycles, execCycles);
+        retVal = NexaWatt_SafetyChecker_Watchdog_Period_End(&nwTestWatchdog);
+        NexaWatt_Hal_Host_Sim_Wdt_Advance(NW_TEST_PERIOD_US);
+
+        if (isPolled == nwTrue)
+        {
+            NexaWatt_SafetyChecker_Watchdog_Poll(&nwTestWatchdog);
+        }
+    }
+
+    return retVal;
+}